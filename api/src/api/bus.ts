@@ -1,4 +1,5 @@
 import { randomUUID } from "crypto";
+import { connect, Socket } from "net";
 import { parentPort, MessagePort } from "worker_threads";
 
 import * as ipc from "./proto/ipc";
@@ -76,11 +77,18 @@ type EndpointMapping = {
   "storage.remove": "storage.remove";
   "storage.clear": "storage.clear";
   "storage.list": "storage.list";
+  "storage.multiGet": "storage.multiGet";
+  "storage.multiSet": "storage.multiSet";
+  "storage.batch": "storage.batch";
 
   "oauth.authorize": "oauth.authorize";
 
   "clipboard.copy": "clipboard.copy";
   "clipboard.paste": "clipboard.paste";
+
+  "cache.set": "cache.set";
+  "cache.remove": "cache.remove";
+  "cache.clear": "cache.clear";
 };
 
 type RequestEndpoint = keyof EndpointMapping;
@@ -122,6 +130,11 @@ class Bus {
     { resolve: (message: extension.Response) => void }
   >();
   private eventListeners = new Map<string, EventListenerInfo[]>();
+  // set once the channel to vicinae is open, messages go through the manager until then
+  private channel: Socket | undefined;
+  // events are dispatched once everything already received is read, see queueEvent
+  private pendingEvents: extension.Event[] = [];
+  private dispatchScheduled = false;
 
   async turboRequest<T extends RequestEndpoint>(
     endpoint: T,
@@ -151,8 +164,50 @@ class Bus {
     return Ok(resData);
   }
 
+  /**
+   * Events that only matter as long as no newer one of the same id came in, such as search text changes,
+   * are dropped in favor of that newer one if the worker did not get to them yet.
+   */
+  private queueEvent(event: extension.Event) {
+    if (event.generic?.latestOnly) {
+      const index = this.pendingEvents.findIndex(
+        (pending) => pending.id === event.id,
+      );
+
+      if (index != -1) this.pendingEvents.splice(index, 1);
+    }
+
+    this.pendingEvents.push(event);
+
+    if (!this.dispatchScheduled) {
+      this.dispatchScheduled = true;
+      setImmediate(() => this.dispatchEvents());
+    }
+  }
+
+  private dispatchEvents() {
+    const events = this.pendingEvents;
+
+    this.dispatchScheduled = false;
+    this.pendingEvents = [];
+
+    for (const { id, generic } of events) {
+      if (generic) {
+        const listeners = this.listEventListeners(id);
+        const args = JSON.parse(generic.json);
+
+        for (const listener of listeners) {
+          listener.callback(...(args ?? []));
+        }
+      }
+    }
+  }
+
   private handleSafeMessage(message: ipc.ExtensionMessage) {
     if (message.response) {
+      // events received before the response are handled before it
+      this.dispatchEvents();
+
       //console.log('got response response', message.response.requestId);
       const request = this.safeRequestMap.get(message.response.requestId);
 
@@ -161,24 +216,13 @@ class Bus {
         return;
       }
 
-      this.requestMap.delete(message.response.requestId);
+      this.safeRequestMap.delete(message.response.requestId);
       request.resolve(message.response);
       return;
     }
 
     if (message.event) {
-      const { id, generic } = message.event;
-
-      //console.error('got event with id', id);
-
-      if (generic) {
-        const listeners = this.listEventListeners(id);
-        const args = JSON.parse(generic.json);
-
-        for (const listener of listeners) {
-          listener.callback(...(args ?? []));
-        }
-      }
+      this.queueEvent(message.event);
     }
   }
 
@@ -206,6 +250,64 @@ class Bus {
     });
   }
 
+  /**
+   * Open a channel to vicinae on the socket at `path`, for the messages of the command to stop going through
+   * the main thread of the manager. Packets are length prefixed (32 bit, big endian), the first one saying
+   * which session the channel is for. Resolves to whether it could be opened.
+   */
+  openChannel(path: string, sessionId: string, token: string): Promise<boolean> {
+    return new Promise((resolve) => {
+      const socket = connect(path);
+
+      socket.once("error", (error) => {
+        console.error(`Failed to open channel to vicinae, going through the manager instead`, error);
+        resolve(false);
+      });
+
+      socket.once("connect", () => {
+        let pending = Buffer.alloc(0);
+
+        socket.on("data", (data: Buffer) => {
+          pending = pending.length ? Buffer.concat([pending, data]) : data;
+
+          while (pending.length >= 4) {
+            const length = pending.readUInt32BE(0);
+
+            if (pending.length - 4 < length) break;
+
+            this.handleSafeMessage(
+              ipc.ExtensionMessage.decode(pending.subarray(4, 4 + length)),
+            );
+            pending = pending.subarray(4 + length);
+          }
+        });
+
+        socket.on("close", () => {
+          if (this.channel === socket) this.channel = undefined;
+        });
+
+        // the command is done when nothing but the channel is left
+        socket.unref();
+        this.writePacket(
+          socket,
+          ipc.ChannelHello.encode({ sessionId, token }).finish(),
+        );
+        this.channel = socket;
+        resolve(true);
+      });
+    });
+  }
+
+  private writePacket(socket: Socket, packet: Uint8Array) {
+    const header = Buffer.allocUnsafe(4);
+
+    header.writeUInt32BE(packet.length);
+    socket.cork();
+    socket.write(header);
+    socket.write(packet);
+    socket.uncork();
+  }
+
   listEventListeners(type: string): EventListenerInfo[] {
     return this.eventListeners.get(type) ?? [];
   }
@@ -247,7 +349,26 @@ class Bus {
   }
 
   sendMessage(message: ipc.ExtensionMessage) {
-    this.port.postMessage(ipc.ExtensionMessage.encode(message).finish());
+    const start = performance.now();
+    const writer = ipc.ExtensionMessage.encode(message);
+
+    // written last, as field 4 of the message, so that it can tell how long
+    // serializing the rest of it took
+    if (message.request) {
+      const sentAt = performance.now();
+      const timing = {
+        sentAt: performance.timeOrigin + sentAt,
+        serializeTime: sentAt - start,
+      };
+
+      ipc.RequestTiming.encode(timing, writer.uint32(34).fork()).join();
+    }
+
+    if (this.channel) {
+      this.writePacket(this.channel, writer.finish());
+    } else {
+      this.port.postMessage(writer.finish());
+    }
   }
 
   request2(
@@ -1,3 +1,8 @@
+import { readFileSync } from "fs";
+import { join } from "path";
+import { bus } from "./bus";
+import { environment } from "./environment";
+
 interface AbstractCache {
   /**
    * @returns the full path to the directory where the data is stored on disk.
@@ -41,64 +46,248 @@ interface AbstractCache {
   subscribe(subscriber: Cache.Subscriber): Cache.Subscription;
 }
 
+// operations of the records of a log, see vicinae/src/services/extension-cache/extension-cache-service.hpp
+const OP_SET = 1;
+const OP_REMOVE = 2;
+const OP_CLEAR = 3;
+const RECORD_HEADER_SIZE = 9;
+
+const DEFAULT_CAPACITY = 10 * 1024 * 1024;
+
+type Entry = { data: string; size: number };
+
+/**
+ * Copy of a namespace, read from its log the first time one of its caches is used, and kept up to date by
+ * the writes made from this worker. Entries are in order of use, least recent first, as vicinae evicts them.
+ */
+type Namespace = {
+  entries: Map<string, Entry>;
+  // of the keys and data of the entries, in bytes
+  size: number;
+  // keys read since the previous write, which are used as far as vicinae is concerned once it is sent
+  touched: Set<string>;
+};
+
+const namespaces = new Map<string, Namespace>();
+
+const readLog = (path: string): Namespace => {
+  const ns: Namespace = { entries: new Map(), size: 0, touched: new Set() };
+  let log: Buffer;
+
+  try {
+    log = readFileSync(path);
+  } catch {
+    return ns;
+  }
+
+  let offset = 0;
+
+  while (offset + RECORD_HEADER_SIZE <= log.length) {
+    const op = log[offset];
+    const keySize = log.readUInt32BE(offset + 1);
+    const dataSize = log.readUInt32BE(offset + 5);
+    const keyEnd = offset + RECORD_HEADER_SIZE + keySize;
+    const end = keyEnd + dataSize;
+
+    // the record being written by vicinae right now
+    if (end > log.length) break;
+
+    const key = log.toString("utf8", offset + RECORD_HEADER_SIZE, keyEnd);
+
+    if (op == OP_SET) {
+      ns.entries.delete(key);
+      ns.entries.set(key, {
+        data: log.toString("utf8", keyEnd, end),
+        size: keySize + dataSize,
+      });
+    } else if (op == OP_REMOVE) {
+      ns.entries.delete(key);
+    } else if (op == OP_CLEAR) {
+      ns.entries.clear();
+    } else {
+      break;
+    }
+
+    offset = end;
+  }
+
+  for (const entry of ns.entries.values()) {
+    ns.size += entry.size;
+  }
+
+  return ns;
+};
+
+/**
+ * Reads are served from a copy of the cache held by the worker, without asking vicinae: only writes are sent
+ * to it. The copy is read from the log vicinae keeps of the cache, which it is the only one to write to, so
+ * that the cache survives the command.
+ */
 export class Cache implements AbstractCache {
-  constructor(options?: Cache.Options) {}
+  private readonly namespace: string;
+  private readonly directory: string;
+  private readonly capacity: number;
+  private readonly subscribers: Cache.Subscriber[] = [];
+
+  constructor(options?: Cache.Options) {
+    this.namespace = options?.namespace ?? "";
+    this.capacity = options?.capacity ?? DEFAULT_CAPACITY;
+    this.directory = join(environment.supportPath, "cache", this.namespace);
+  }
+
+  private get ns(): Namespace {
+    let ns = namespaces.get(this.directory);
+
+    if (!ns) {
+      ns = readLog(join(this.directory, "cache.log"));
+      namespaces.set(this.directory, ns);
+    }
+
+    return ns;
+  }
 
   /**
    * @returns the full path to the directory where the data is stored on disk.
    */
   get storageDirectory(): string {
-    return "";
+    return this.directory;
   }
   /**
    * @returns the data for the given key. If there is no data for the key, `undefined` is returned.
    * @remarks If you want to just check for the existence of a key, use {@link has}.
    */
   get(key: string): string | undefined {
-    return undefined;
+    const ns = this.ns;
+    const entry = ns.entries.get(key);
+
+    if (!entry) return undefined;
+
+    ns.entries.delete(key);
+    ns.entries.set(key, entry);
+    ns.touched.delete(key);
+    ns.touched.add(key);
+
+    return entry.data;
   }
   /**
    * @returns `true` if data for the key exists, `false` otherwise.
    * @remarks You can use this method to check for entries without affecting the LRU access.
    */
   has(key: string): boolean {
-    return false;
+    return this.ns.entries.has(key);
   }
   /**
    * @returns `true` if the cache is empty, `false` otherwise.
    */
   get isEmpty(): boolean {
-    return true;
+    return this.ns.entries.size == 0;
   }
   /**
    * Sets the data for the given key.
    * If the data exceeds the configured `capacity`, the least recently used entries are removed.
    * This also notifies registered subscribers (see {@link subscribe}).
    */
-  set(key: string, data: string): void {}
+  set(key: string, data: string): void {
+    const ns = this.ns;
+    const previous = ns.entries.get(key);
+    const touched = [...ns.touched];
+    const size = Buffer.byteLength(key) + Buffer.byteLength(data);
+
+    if (previous) {
+      ns.size -= previous.size;
+      ns.entries.delete(key);
+    }
+
+    ns.entries.set(key, { data, size });
+    ns.size += size;
+    ns.touched.clear();
+    this.maintainCapacity(key);
+    this.write("cache.set", {
+      namespace: this.namespace,
+      key,
+      data,
+      capacity: this.capacity,
+      touched,
+    });
+    this.notifySubscribers(key, data);
+  }
   /**
    * Removes the data for the given key.
    * This also notifies registered subscribers (see {@link subscribe}).
    * @returns `true` if data for the key was removed, `false` otherwise.
    */
   remove(key: string): boolean {
-    return false;
+    const ns = this.ns;
+    const entry = ns.entries.get(key);
+
+    if (!entry) return false;
+
+    ns.entries.delete(key);
+    ns.touched.delete(key);
+    ns.size -= entry.size;
+    this.write("cache.remove", { namespace: this.namespace, key });
+    this.notifySubscribers(key, undefined);
+
+    return true;
   }
   /**
    * Clears all stored data.
    * This also notifies registered subscribers (see {@link subscribe}) unless the  `notifySubscribers` option is set to `false`.
    */
-  clear(options?: { notifySubscribers: boolean }): void {}
+  clear(options?: { notifySubscribers: boolean }): void {
+    const ns = this.ns;
+
+    ns.entries.clear();
+    ns.touched.clear();
+    ns.size = 0;
+    this.write("cache.clear", { namespace: this.namespace });
+
+    if (options?.notifySubscribers ?? true) {
+      this.notifySubscribers(undefined, undefined);
+    }
+  }
   /**
    * Registers a new subscriber that gets notified when cache data is set or removed.
    * @returns a function that can be called to remove the subscriber.
    */
   subscribe(subscriber: Cache.Subscriber): Cache.Subscription {
-    return () => {};
+    this.subscribers.push(subscriber);
+
+    return () => {
+      const index = this.subscribers.indexOf(subscriber);
+
+      if (index != -1) this.subscribers.splice(index, 1);
+    };
+  }
+
+  // evicted the same way vicinae does, which does not tell which entries it evicted
+  private maintainCapacity(written: string) {
+    const ns = this.ns;
+
+    for (const [key, entry] of ns.entries) {
+      if (ns.size <= this.capacity || key === written) break;
+
+      ns.entries.delete(key);
+      ns.touched.delete(key);
+      ns.size -= entry.size;
+    }
   }
 
-  private maintainCapacity;
-  private notifySubscribers;
+  private notifySubscribers(key: string | undefined, data: string | undefined) {
+    for (const subscriber of [...this.subscribers]) {
+      subscriber(key, data);
+    }
+  }
+
+  // writes are not waited for, they are applied in order by vicinae
+  private write(
+    endpoint: "cache.set" | "cache.remove" | "cache.clear",
+    data: Record<string, any>,
+  ) {
+    bus.turboRequest(endpoint, data as any).then((res) => {
+      if (!res.ok) console.error(`Failed to write to the cache`, res.error);
+    });
+  }
 }
 
 export declare namespace Cache {
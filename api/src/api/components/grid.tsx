@@ -2,7 +2,7 @@ import React, { ReactNode, useRef } from "react";
 import { Image, ImageLike, serializeImageLike } from "../image";
 import { randomUUID } from "crypto";
 import { EmptyView } from "./empty-view";
-import { useEventListener } from "../hooks";
+import { Pagination, useEventListener, usePagination } from "../hooks";
 import { Color, ColorLike } from "../color";
 import { Dropdown } from "./dropdown";
 
@@ -86,6 +86,7 @@ type GridProps = SectionConfig & {
   searchBarAccessory?: ReactNode;
   onSearchTextChange?: (text: string) => void;
   onSelectionChange?: (id: string) => void;
+  pagination?: Pagination;
 };
 
 type GridSectionProps = SectionConfig & {
@@ -98,6 +99,7 @@ const GridRoot: React.FC<GridProps> = ({
   onSearchTextChange,
   searchBarAccessory,
   onSelectionChange,
+  pagination,
   children,
   actions,
   inset,
@@ -107,6 +109,7 @@ const GridRoot: React.FC<GridProps> = ({
 }) => {
   const searchTextChangeHandler = useEventListener(onSearchTextChange);
   const selectionChangeHandler = useEventListener(onSelectionChange);
+  const nativePagination = usePagination(pagination);
 
   if (
     typeof props.enableFiltering === "boolean" &&
@@ -122,6 +125,7 @@ const GridRoot: React.FC<GridProps> = ({
       aspectRatio={aspectRatio}
       onSearchTextChange={searchTextChangeHandler}
       onSelectionChange={selectionChangeHandler}
+      pagination={nativePagination}
       {...props}
     >
       {searchBarAccessory}
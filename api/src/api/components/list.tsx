@@ -3,7 +3,7 @@ import { Image, ImageLike, serializeImageLike } from "../image";
 import { randomUUID } from "crypto";
 import { Metadata } from "./metadata";
 import { EmptyView } from "./empty-view";
-import { useEventListener } from "../hooks";
+import { Pagination, useEventListener, usePagination } from "../hooks";
 import { Color, ColorLike } from "../color";
 import { Dropdown } from "./dropdown";
 
@@ -47,6 +47,7 @@ type ListProps = {
   searchBarAccessory?: ReactNode;
   onSearchTextChange?: (text: string) => void;
   onSelectionChange?: (id: string) => void;
+  pagination?: Pagination;
 };
 
 export type ListItemProps = {
@@ -70,12 +71,14 @@ const ListRoot: React.FC<ListProps> = ({
   onSearchTextChange,
   searchBarAccessory,
   onSelectionChange,
+  pagination,
   children,
   actions,
   ...props
 }) => {
   const searchTextChangeHandler = useEventListener(onSearchTextChange);
   const selectionChangeHandler = useEventListener(onSelectionChange);
+  const nativePagination = usePagination(pagination);
 
   if (
     typeof props.enableFiltering === "boolean" &&
@@ -88,6 +91,7 @@ const ListRoot: React.FC<ListProps> = ({
     <list
       onSearchTextChange={searchTextChangeHandler}
       onSelectionChange={selectionChangeHandler}
+      pagination={nativePagination}
       {...props}
     >
       {searchBarAccessory}
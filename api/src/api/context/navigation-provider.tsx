@@ -1,11 +1,29 @@
-import React, { ReactNode, useEffect, useState } from "react";
+import React, { ReactNode, Suspense, useEffect, useState } from "react";
 import context from "./navigation-context";
 import { bus } from "../bus";
 
-const View: React.FC<{ children: ReactNode }> = ({ children }) => {
+// never settles, what suspends on it stays suspended until it is rendered again without suspending
+const never = new Promise<never>(() => {});
+
+const Suspender: React.FC<{ suspend: boolean; children: ReactNode }> = ({ suspend, children }) => {
+  if (suspend) throw never;
+
   return <>{children}</>;
 };
 
+/**
+ * Views below the top of the stack are suspended: their state and effects are kept, but they are not
+ * rendered again until they are back on top, updates made to them in the meantime being rendered at that
+ * point. The renderer does not hide suspended instances, which keeps showing what the view rendered last.
+ */
+const View: React.FC<{ suspended: boolean; children: ReactNode }> = ({ suspended, children }) => {
+  return (
+    <Suspense fallback={null}>
+      <Suspender suspend={suspended}>{children}</Suspender>
+    </Suspense>
+  );
+};
+
 export const NavigationProvider: React.FC<{ root: ReactNode }> = ({ root }) => {
   const [navStack, setNavStack] = useState<ReactNode[]>([root]);
 
@@ -41,7 +59,9 @@ export const NavigationProvider: React.FC<{ root: ReactNode }> = ({ root }) => {
       }}
     >
       {navStack.map((el, idx) => (
-        <View key={idx}>{el}</View>
+        <View key={idx} suspended={idx !== navStack.length - 1}>
+          {el}
+        </View>
       ))}
     </context.Provider>
   );
@@ -28,3 +28,24 @@ export const useEventListener = (
 
   return fn && id.current;
 };
+
+export type Pagination = {
+  onLoadMore: () => void;
+  hasMore: boolean;
+  pageSize: number;
+};
+
+/**
+ * `pagination` as sent to vicinae, which calls `onLoadMore` before the end of the list is reached.
+ */
+export const usePagination = (pagination: Pagination | undefined) => {
+  const loadMoreHandler = useEventListener(pagination?.onLoadMore);
+
+  return (
+    pagination && {
+      hasMore: pagination.hasMore,
+      pageSize: pagination.pageSize,
+      onLoadMore: loadMoreHandler,
+    }
+  );
+};
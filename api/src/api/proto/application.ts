@@ -14,10 +14,17 @@ export interface OpenApplicationRequest {
   appId?: string | undefined;
 }
 
-export interface ListApplicationRequest {}
+export interface ListApplicationRequest {
+  /** generation of the list the caller already has, if any */
+  knownGeneration?: number | undefined;
+}
 
 export interface ListApplicationResponse {
   apps: Application[];
+  /** bumped every time the applications are rescanned */
+  generation: number;
+  /** the list is still at `known_generation`, in which case `apps` is empty */
+  notModified: boolean;
 }
 
 export interface Request {
@@ -123,14 +130,17 @@ export const OpenApplicationRequest: MessageFns<OpenApplicationRequest> = {
 };
 
 function createBaseListApplicationRequest(): ListApplicationRequest {
-  return {};
+  return { knownGeneration: undefined };
 }
 
 export const ListApplicationRequest: MessageFns<ListApplicationRequest> = {
   encode(
-    _: ListApplicationRequest,
+    message: ListApplicationRequest,
     writer: BinaryWriter = new BinaryWriter(),
   ): BinaryWriter {
+    if (message.knownGeneration !== undefined) {
+      writer.uint32(8).uint32(message.knownGeneration);
+    }
     return writer;
   },
 
@@ -145,6 +155,14 @@ export const ListApplicationRequest: MessageFns<ListApplicationRequest> = {
     while (reader.pos < end) {
       const tag = reader.uint32();
       switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 8) {
+            break;
+          }
+
+          message.knownGeneration = reader.uint32();
+          continue;
+        }
       }
       if ((tag & 7) === 4 || tag === 0) {
         break;
@@ -154,12 +172,19 @@ export const ListApplicationRequest: MessageFns<ListApplicationRequest> = {
     return message;
   },
 
-  fromJSON(_: any): ListApplicationRequest {
-    return {};
+  fromJSON(object: any): ListApplicationRequest {
+    return {
+      knownGeneration: isSet(object.knownGeneration)
+        ? globalThis.Number(object.knownGeneration)
+        : undefined,
+    };
   },
 
-  toJSON(_: ListApplicationRequest): unknown {
+  toJSON(message: ListApplicationRequest): unknown {
     const obj: any = {};
+    if (message.knownGeneration !== undefined) {
+      obj.knownGeneration = Math.round(message.knownGeneration);
+    }
     return obj;
   },
 
@@ -169,15 +194,16 @@ export const ListApplicationRequest: MessageFns<ListApplicationRequest> = {
     return ListApplicationRequest.fromPartial(base ?? ({} as any));
   },
   fromPartial<I extends Exact<DeepPartial<ListApplicationRequest>, I>>(
-    _: I,
+    object: I,
   ): ListApplicationRequest {
     const message = createBaseListApplicationRequest();
+    message.knownGeneration = object.knownGeneration ?? undefined;
     return message;
   },
 };
 
 function createBaseListApplicationResponse(): ListApplicationResponse {
-  return { apps: [] };
+  return { apps: [], generation: 0, notModified: false };
 }
 
 export const ListApplicationResponse: MessageFns<ListApplicationResponse> = {
@@ -188,6 +214,12 @@ export const ListApplicationResponse: MessageFns<ListApplicationResponse> = {
     for (const v of message.apps) {
       Application.encode(v!, writer.uint32(10).fork()).join();
     }
+    if (message.generation !== 0) {
+      writer.uint32(16).uint32(message.generation);
+    }
+    if (message.notModified !== false) {
+      writer.uint32(24).bool(message.notModified);
+    }
     return writer;
   },
 
@@ -210,6 +242,22 @@ export const ListApplicationResponse: MessageFns<ListApplicationResponse> = {
           message.apps.push(Application.decode(reader, reader.uint32()));
           continue;
         }
+        case 2: {
+          if (tag !== 16) {
+            break;
+          }
+
+          message.generation = reader.uint32();
+          continue;
+        }
+        case 3: {
+          if (tag !== 24) {
+            break;
+          }
+
+          message.notModified = reader.bool();
+          continue;
+        }
       }
       if ((tag & 7) === 4 || tag === 0) {
         break;
@@ -224,6 +272,12 @@ export const ListApplicationResponse: MessageFns<ListApplicationResponse> = {
       apps: globalThis.Array.isArray(object?.apps)
         ? object.apps.map((e: any) => Application.fromJSON(e))
         : [],
+      generation: isSet(object.generation)
+        ? globalThis.Number(object.generation)
+        : 0,
+      notModified: isSet(object.notModified)
+        ? globalThis.Boolean(object.notModified)
+        : false,
     };
   },
 
@@ -232,6 +286,12 @@ export const ListApplicationResponse: MessageFns<ListApplicationResponse> = {
     if (message.apps?.length) {
       obj.apps = message.apps.map((e) => Application.toJSON(e));
     }
+    if (message.generation !== 0) {
+      obj.generation = Math.round(message.generation);
+    }
+    if (message.notModified !== false) {
+      obj.notModified = message.notModified;
+    }
     return obj;
   },
 
@@ -245,6 +305,8 @@ export const ListApplicationResponse: MessageFns<ListApplicationResponse> = {
   ): ListApplicationResponse {
     const message = createBaseListApplicationResponse();
     message.apps = object.apps?.map((e) => Application.fromPartial(e)) || [];
+    message.generation = object.generation ?? 0;
+    message.notModified = object.notModified ?? false;
     return message;
   },
 };
@@ -34,6 +34,7 @@ export interface ManagerResponse {
 export interface QualifiedExtensionRequest {
   sessionId: string;
   request: Request | undefined;
+  timing?: RequestTiming | undefined;
 }
 
 export interface QualifiedExtensionResponse {
@@ -50,6 +51,16 @@ export interface ExtensionMessage {
   request?: Request | undefined;
   response?: Response | undefined;
   event?: Event | undefined;
+  /** only set for requests, appended by the worker once the rest of the message is serialized */
+  timing?: RequestTiming | undefined;
+}
+
+/** when a request left the worker that sent it, for vicinae to trace the time it took to get to it */
+export interface RequestTiming {
+  /** wall clock time the request was sent at, in milliseconds since the epoch */
+  sentAt: number;
+  /** time it took the worker to serialize the request, in milliseconds */
+  serializeTime: number;
 }
 
 function createBaseIpcMessage(): IpcMessage {
@@ -454,7 +465,7 @@ export const ManagerResponse: MessageFns<ManagerResponse> = {
 };
 
 function createBaseQualifiedExtensionRequest(): QualifiedExtensionRequest {
-  return { sessionId: "", request: undefined };
+  return { sessionId: "", request: undefined, timing: undefined };
 }
 
 export const QualifiedExtensionRequest: MessageFns<QualifiedExtensionRequest> =
@@ -469,6 +480,9 @@ export const QualifiedExtensionRequest: MessageFns<QualifiedExtensionRequest> =
       if (message.request !== undefined) {
         Request.encode(message.request, writer.uint32(18).fork()).join();
       }
+      if (message.timing !== undefined) {
+        RequestTiming.encode(message.timing, writer.uint32(26).fork()).join();
+      }
       return writer;
     },
 
@@ -499,6 +513,14 @@ export const QualifiedExtensionRequest: MessageFns<QualifiedExtensionRequest> =
             message.request = Request.decode(reader, reader.uint32());
             continue;
           }
+          case 3: {
+            if (tag !== 26) {
+              break;
+            }
+
+            message.timing = RequestTiming.decode(reader, reader.uint32());
+            continue;
+          }
         }
         if ((tag & 7) === 4 || tag === 0) {
           break;
@@ -516,6 +538,9 @@ export const QualifiedExtensionRequest: MessageFns<QualifiedExtensionRequest> =
         request: isSet(object.request)
           ? Request.fromJSON(object.request)
           : undefined,
+        timing: isSet(object.timing)
+          ? RequestTiming.fromJSON(object.timing)
+          : undefined,
       };
     },
 
@@ -527,6 +552,9 @@ export const QualifiedExtensionRequest: MessageFns<QualifiedExtensionRequest> =
       if (message.request !== undefined) {
         obj.request = Request.toJSON(message.request);
       }
+      if (message.timing !== undefined) {
+        obj.timing = RequestTiming.toJSON(message.timing);
+      }
       return obj;
     },
 
@@ -544,6 +572,10 @@ export const QualifiedExtensionRequest: MessageFns<QualifiedExtensionRequest> =
         object.request !== undefined && object.request !== null
           ? Request.fromPartial(object.request)
           : undefined;
+      message.timing =
+        object.timing !== undefined && object.timing !== null
+          ? RequestTiming.fromPartial(object.timing)
+          : undefined;
       return message;
     },
   };
@@ -736,7 +768,12 @@ export const QualifiedExtensionEvent: MessageFns<QualifiedExtensionEvent> = {
 };
 
 function createBaseExtensionMessage(): ExtensionMessage {
-  return { request: undefined, response: undefined, event: undefined };
+  return {
+    request: undefined,
+    response: undefined,
+    event: undefined,
+    timing: undefined,
+  };
 }
 
 export const ExtensionMessage: MessageFns<ExtensionMessage> = {
@@ -753,6 +790,9 @@ export const ExtensionMessage: MessageFns<ExtensionMessage> = {
     if (message.event !== undefined) {
       Event.encode(message.event, writer.uint32(26).fork()).join();
     }
+    if (message.timing !== undefined) {
+      RequestTiming.encode(message.timing, writer.uint32(34).fork()).join();
+    }
     return writer;
   },
 
@@ -788,6 +828,14 @@ export const ExtensionMessage: MessageFns<ExtensionMessage> = {
           message.event = Event.decode(reader, reader.uint32());
           continue;
         }
+        case 4: {
+          if (tag !== 34) {
+            break;
+          }
+
+          message.timing = RequestTiming.decode(reader, reader.uint32());
+          continue;
+        }
       }
       if ((tag & 7) === 4 || tag === 0) {
         break;
@@ -806,6 +854,9 @@ export const ExtensionMessage: MessageFns<ExtensionMessage> = {
         ? Response.fromJSON(object.response)
         : undefined,
       event: isSet(object.event) ? Event.fromJSON(object.event) : undefined,
+      timing: isSet(object.timing)
+        ? RequestTiming.fromJSON(object.timing)
+        : undefined,
     };
   },
 
@@ -820,6 +871,9 @@ export const ExtensionMessage: MessageFns<ExtensionMessage> = {
     if (message.event !== undefined) {
       obj.event = Event.toJSON(message.event);
     }
+    if (message.timing !== undefined) {
+      obj.timing = RequestTiming.toJSON(message.timing);
+    }
     return obj;
   },
 
@@ -844,6 +898,96 @@ export const ExtensionMessage: MessageFns<ExtensionMessage> = {
       object.event !== undefined && object.event !== null
         ? Event.fromPartial(object.event)
         : undefined;
+    message.timing =
+      object.timing !== undefined && object.timing !== null
+        ? RequestTiming.fromPartial(object.timing)
+        : undefined;
+    return message;
+  },
+};
+
+function createBaseRequestTiming(): RequestTiming {
+  return { sentAt: 0, serializeTime: 0 };
+}
+
+export const RequestTiming: MessageFns<RequestTiming> = {
+  encode(
+    message: RequestTiming,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    if (message.sentAt !== 0) {
+      writer.uint32(9).double(message.sentAt);
+    }
+    if (message.serializeTime !== 0) {
+      writer.uint32(17).double(message.serializeTime);
+    }
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): RequestTiming {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseRequestTiming();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 9) {
+            break;
+          }
+
+          message.sentAt = reader.double();
+          continue;
+        }
+        case 2: {
+          if (tag !== 17) {
+            break;
+          }
+
+          message.serializeTime = reader.double();
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): RequestTiming {
+    return {
+      sentAt: isSet(object.sentAt) ? globalThis.Number(object.sentAt) : 0,
+      serializeTime: isSet(object.serializeTime)
+        ? globalThis.Number(object.serializeTime)
+        : 0,
+    };
+  },
+
+  toJSON(message: RequestTiming): unknown {
+    const obj: any = {};
+    if (message.sentAt !== 0) {
+      obj.sentAt = message.sentAt;
+    }
+    if (message.serializeTime !== 0) {
+      obj.serializeTime = message.serializeTime;
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<RequestTiming>, I>>(
+    base?: I,
+  ): RequestTiming {
+    return RequestTiming.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<RequestTiming>, I>>(
+    object: I,
+  ): RequestTiming {
+    const message = createBaseRequestTiming();
+    message.sentAt = object.sentAt ?? 0;
+    message.serializeTime = object.serializeTime ?? 0;
     return message;
   },
 };
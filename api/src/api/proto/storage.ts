@@ -46,12 +46,54 @@ export interface ListResponse_ValuesEntry {
   value: any | undefined;
 }
 
+export interface MultiGetRequest {
+  keys: string[];
+}
+
+/** keys that have no value are missing from the map */
+export interface MultiGetResponse {
+  values: { [key: string]: any | undefined };
+}
+
+export interface MultiGetResponse_ValuesEntry {
+  key: string;
+  value: any | undefined;
+}
+
+/** applied in a single transaction */
+export interface MultiSetRequest {
+  values: { [key: string]: any | undefined };
+}
+
+export interface MultiSetRequest_ValuesEntry {
+  key: string;
+  value: any | undefined;
+}
+
+export interface MultiSetResponse {}
+
+export interface BatchOperation {
+  set?: SetRequest | undefined;
+  remove?: RemoveRequest | undefined;
+  clear?: ClearRequest | undefined;
+}
+
+/** operations are applied in order in a single transaction: none of them is if one fails */
+export interface BatchRequest {
+  ops: BatchOperation[];
+}
+
+export interface BatchResponse {}
+
 export interface Request {
   get?: GetRequest | undefined;
   set?: SetRequest | undefined;
   remove?: RemoveRequest | undefined;
   clear?: ClearRequest | undefined;
   list?: ListRequest | undefined;
+  multiGet?: MultiGetRequest | undefined;
+  multiSet?: MultiSetRequest | undefined;
+  batch?: BatchRequest | undefined;
 }
 
 export interface Response {
@@ -60,6 +102,9 @@ export interface Response {
   remove?: RemoveResponse | undefined;
   clear?: ClearResponse | undefined;
   list?: ListResponse | undefined;
+  multiGet?: MultiGetResponse | undefined;
+  multiSet?: MultiSetResponse | undefined;
+  batch?: BatchResponse | undefined;
 }
 
 function createBaseClearRequest(): ClearRequest {
@@ -771,44 +816,26 @@ export const ListResponse_ValuesEntry: MessageFns<ListResponse_ValuesEntry> = {
   },
 };
 
-function createBaseRequest(): Request {
-  return {
-    get: undefined,
-    set: undefined,
-    remove: undefined,
-    clear: undefined,
-    list: undefined,
-  };
+function createBaseMultiGetRequest(): MultiGetRequest {
+  return { keys: [] };
 }
 
-export const Request: MessageFns<Request> = {
+export const MultiGetRequest: MessageFns<MultiGetRequest> = {
   encode(
-    message: Request,
+    message: MultiGetRequest,
     writer: BinaryWriter = new BinaryWriter(),
   ): BinaryWriter {
-    if (message.get !== undefined) {
-      GetRequest.encode(message.get, writer.uint32(10).fork()).join();
-    }
-    if (message.set !== undefined) {
-      SetRequest.encode(message.set, writer.uint32(18).fork()).join();
-    }
-    if (message.remove !== undefined) {
-      RemoveRequest.encode(message.remove, writer.uint32(26).fork()).join();
-    }
-    if (message.clear !== undefined) {
-      ClearRequest.encode(message.clear, writer.uint32(34).fork()).join();
-    }
-    if (message.list !== undefined) {
-      ListRequest.encode(message.list, writer.uint32(42).fork()).join();
+    for (const v of message.keys) {
+      writer.uint32(10).string(v!);
     }
     return writer;
   },
 
-  decode(input: BinaryReader | Uint8Array, length?: number): Request {
+  decode(input: BinaryReader | Uint8Array, length?: number): MultiGetRequest {
     const reader =
       input instanceof BinaryReader ? input : new BinaryReader(input);
     const end = length === undefined ? reader.len : reader.pos + length;
-    const message = createBaseRequest();
+    const message = createBaseMultiGetRequest();
     while (reader.pos < end) {
       const tag = reader.uint32();
       switch (tag >>> 3) {
@@ -817,39 +844,7 @@ export const Request: MessageFns<Request> = {
             break;
           }
 
-          message.get = GetRequest.decode(reader, reader.uint32());
-          continue;
-        }
-        case 2: {
-          if (tag !== 18) {
-            break;
-          }
-
-          message.set = SetRequest.decode(reader, reader.uint32());
-          continue;
-        }
-        case 3: {
-          if (tag !== 26) {
-            break;
-          }
-
-          message.remove = RemoveRequest.decode(reader, reader.uint32());
-          continue;
-        }
-        case 4: {
-          if (tag !== 34) {
-            break;
-          }
-
-          message.clear = ClearRequest.decode(reader, reader.uint32());
-          continue;
-        }
-        case 5: {
-          if (tag !== 42) {
-            break;
-          }
-
-          message.list = ListRequest.decode(reader, reader.uint32());
+          message.keys.push(reader.string());
           continue;
         }
       }
@@ -861,107 +856,61 @@ export const Request: MessageFns<Request> = {
     return message;
   },
 
-  fromJSON(object: any): Request {
+  fromJSON(object: any): MultiGetRequest {
     return {
-      get: isSet(object.get) ? GetRequest.fromJSON(object.get) : undefined,
-      set: isSet(object.set) ? SetRequest.fromJSON(object.set) : undefined,
-      remove: isSet(object.remove)
-        ? RemoveRequest.fromJSON(object.remove)
-        : undefined,
-      clear: isSet(object.clear)
-        ? ClearRequest.fromJSON(object.clear)
-        : undefined,
-      list: isSet(object.list) ? ListRequest.fromJSON(object.list) : undefined,
+      keys: globalThis.Array.isArray(object?.keys)
+        ? object.keys.map((e: any) => globalThis.String(e))
+        : [],
     };
   },
 
-  toJSON(message: Request): unknown {
+  toJSON(message: MultiGetRequest): unknown {
     const obj: any = {};
-    if (message.get !== undefined) {
-      obj.get = GetRequest.toJSON(message.get);
-    }
-    if (message.set !== undefined) {
-      obj.set = SetRequest.toJSON(message.set);
-    }
-    if (message.remove !== undefined) {
-      obj.remove = RemoveRequest.toJSON(message.remove);
-    }
-    if (message.clear !== undefined) {
-      obj.clear = ClearRequest.toJSON(message.clear);
-    }
-    if (message.list !== undefined) {
-      obj.list = ListRequest.toJSON(message.list);
+    if (message.keys?.length) {
+      obj.keys = message.keys;
     }
     return obj;
   },
 
-  create<I extends Exact<DeepPartial<Request>, I>>(base?: I): Request {
-    return Request.fromPartial(base ?? ({} as any));
+  create<I extends Exact<DeepPartial<MultiGetRequest>, I>>(
+    base?: I,
+  ): MultiGetRequest {
+    return MultiGetRequest.fromPartial(base ?? ({} as any));
   },
-  fromPartial<I extends Exact<DeepPartial<Request>, I>>(object: I): Request {
-    const message = createBaseRequest();
-    message.get =
-      object.get !== undefined && object.get !== null
-        ? GetRequest.fromPartial(object.get)
-        : undefined;
-    message.set =
-      object.set !== undefined && object.set !== null
-        ? SetRequest.fromPartial(object.set)
-        : undefined;
-    message.remove =
-      object.remove !== undefined && object.remove !== null
-        ? RemoveRequest.fromPartial(object.remove)
-        : undefined;
-    message.clear =
-      object.clear !== undefined && object.clear !== null
-        ? ClearRequest.fromPartial(object.clear)
-        : undefined;
-    message.list =
-      object.list !== undefined && object.list !== null
-        ? ListRequest.fromPartial(object.list)
-        : undefined;
+  fromPartial<I extends Exact<DeepPartial<MultiGetRequest>, I>>(
+    object: I,
+  ): MultiGetRequest {
+    const message = createBaseMultiGetRequest();
+    message.keys = object.keys?.map((e) => e) || [];
     return message;
   },
 };
 
-function createBaseResponse(): Response {
-  return {
-    get: undefined,
-    set: undefined,
-    remove: undefined,
-    clear: undefined,
-    list: undefined,
-  };
+function createBaseMultiGetResponse(): MultiGetResponse {
+  return { values: {} };
 }
 
-export const Response: MessageFns<Response> = {
+export const MultiGetResponse: MessageFns<MultiGetResponse> = {
   encode(
-    message: Response,
+    message: MultiGetResponse,
     writer: BinaryWriter = new BinaryWriter(),
   ): BinaryWriter {
-    if (message.get !== undefined) {
-      GetResponse.encode(message.get, writer.uint32(10).fork()).join();
-    }
-    if (message.set !== undefined) {
-      SetResponse.encode(message.set, writer.uint32(18).fork()).join();
-    }
-    if (message.remove !== undefined) {
-      RemoveResponse.encode(message.remove, writer.uint32(26).fork()).join();
-    }
-    if (message.clear !== undefined) {
-      ClearResponse.encode(message.clear, writer.uint32(34).fork()).join();
-    }
-    if (message.list !== undefined) {
-      ListResponse.encode(message.list, writer.uint32(42).fork()).join();
-    }
+    Object.entries(message.values).forEach(([key, value]) => {
+      if (value !== undefined) {
+        MultiGetResponse_ValuesEntry.encode(
+          { key: key as any, value },
+          writer.uint32(10).fork(),
+        ).join();
+      }
+    });
     return writer;
   },
 
-  decode(input: BinaryReader | Uint8Array, length?: number): Response {
+  decode(input: BinaryReader | Uint8Array, length?: number): MultiGetResponse {
     const reader =
       input instanceof BinaryReader ? input : new BinaryReader(input);
     const end = length === undefined ? reader.len : reader.pos + length;
-    const message = createBaseResponse();
+    const message = createBaseMultiGetResponse();
     while (reader.pos < end) {
       const tag = reader.uint32();
       switch (tag >>> 3) {
@@ -970,39 +919,13 @@ export const Response: MessageFns<Response> = {
             break;
           }
 
-          message.get = GetResponse.decode(reader, reader.uint32());
-          continue;
-        }
-        case 2: {
-          if (tag !== 18) {
-            break;
-          }
-
-          message.set = SetResponse.decode(reader, reader.uint32());
-          continue;
-        }
-        case 3: {
-          if (tag !== 26) {
-            break;
-          }
-
-          message.remove = RemoveResponse.decode(reader, reader.uint32());
-          continue;
-        }
-        case 4: {
-          if (tag !== 34) {
-            break;
-          }
-
-          message.clear = ClearResponse.decode(reader, reader.uint32());
-          continue;
-        }
-        case 5: {
-          if (tag !== 42) {
-            break;
+          const entry1 = MultiGetResponse_ValuesEntry.decode(
+            reader,
+            reader.uint32(),
+          );
+          if (entry1.value !== undefined) {
+            message.values[entry1.key] = entry1.value;
           }
-
-          message.list = ListResponse.decode(reader, reader.uint32());
           continue;
         }
       }
@@ -1014,48 +937,1031 @@ export const Response: MessageFns<Response> = {
     return message;
   },
 
-  fromJSON(object: any): Response {
+  fromJSON(object: any): MultiGetResponse {
     return {
-      get: isSet(object.get) ? GetResponse.fromJSON(object.get) : undefined,
-      set: isSet(object.set) ? SetResponse.fromJSON(object.set) : undefined,
-      remove: isSet(object.remove)
-        ? RemoveResponse.fromJSON(object.remove)
-        : undefined,
-      clear: isSet(object.clear)
-        ? ClearResponse.fromJSON(object.clear)
-        : undefined,
-      list: isSet(object.list) ? ListResponse.fromJSON(object.list) : undefined,
+      values: isObject(object.values)
+        ? Object.entries(object.values).reduce<{
+            [key: string]: any | undefined;
+          }>((acc, [key, value]) => {
+            acc[key] = value as any | undefined;
+            return acc;
+          }, {})
+        : {},
     };
   },
 
-  toJSON(message: Response): unknown {
+  toJSON(message: MultiGetResponse): unknown {
     const obj: any = {};
-    if (message.get !== undefined) {
-      obj.get = GetResponse.toJSON(message.get);
-    }
-    if (message.set !== undefined) {
-      obj.set = SetResponse.toJSON(message.set);
-    }
-    if (message.remove !== undefined) {
-      obj.remove = RemoveResponse.toJSON(message.remove);
-    }
-    if (message.clear !== undefined) {
-      obj.clear = ClearResponse.toJSON(message.clear);
-    }
-    if (message.list !== undefined) {
-      obj.list = ListResponse.toJSON(message.list);
+    if (message.values) {
+      const entries = Object.entries(message.values);
+      if (entries.length > 0) {
+        obj.values = {};
+        entries.forEach(([k, v]) => {
+          obj.values[k] = v;
+        });
+      }
     }
     return obj;
   },
 
-  create<I extends Exact<DeepPartial<Response>, I>>(base?: I): Response {
-    return Response.fromPartial(base ?? ({} as any));
+  create<I extends Exact<DeepPartial<MultiGetResponse>, I>>(
+    base?: I,
+  ): MultiGetResponse {
+    return MultiGetResponse.fromPartial(base ?? ({} as any));
   },
-  fromPartial<I extends Exact<DeepPartial<Response>, I>>(object: I): Response {
-    const message = createBaseResponse();
-    message.get =
-      object.get !== undefined && object.get !== null
-        ? GetResponse.fromPartial(object.get)
+  fromPartial<I extends Exact<DeepPartial<MultiGetResponse>, I>>(
+    object: I,
+  ): MultiGetResponse {
+    const message = createBaseMultiGetResponse();
+    message.values = Object.entries(object.values ?? {}).reduce<{
+      [key: string]: any | undefined;
+    }>((acc, [key, value]) => {
+      if (value !== undefined) {
+        acc[key] = value;
+      }
+      return acc;
+    }, {});
+    return message;
+  },
+};
+
+function createBaseMultiGetResponse_ValuesEntry(): MultiGetResponse_ValuesEntry {
+  return { key: "", value: undefined };
+}
+
+export const MultiGetResponse_ValuesEntry: MessageFns<MultiGetResponse_ValuesEntry> =
+  {
+    encode(
+      message: MultiGetResponse_ValuesEntry,
+      writer: BinaryWriter = new BinaryWriter(),
+    ): BinaryWriter {
+      if (message.key !== "") {
+        writer.uint32(10).string(message.key);
+      }
+      if (message.value !== undefined) {
+        Value.encode(
+          Value.wrap(message.value),
+          writer.uint32(18).fork(),
+        ).join();
+      }
+      return writer;
+    },
+
+    decode(
+      input: BinaryReader | Uint8Array,
+      length?: number,
+    ): MultiGetResponse_ValuesEntry {
+      const reader =
+        input instanceof BinaryReader ? input : new BinaryReader(input);
+      const end = length === undefined ? reader.len : reader.pos + length;
+      const message = createBaseMultiGetResponse_ValuesEntry();
+      while (reader.pos < end) {
+        const tag = reader.uint32();
+        switch (tag >>> 3) {
+          case 1: {
+            if (tag !== 10) {
+              break;
+            }
+
+            message.key = reader.string();
+            continue;
+          }
+          case 2: {
+            if (tag !== 18) {
+              break;
+            }
+
+            message.value = Value.unwrap(Value.decode(reader, reader.uint32()));
+            continue;
+          }
+        }
+        if ((tag & 7) === 4 || tag === 0) {
+          break;
+        }
+        reader.skip(tag & 7);
+      }
+      return message;
+    },
+
+    fromJSON(object: any): MultiGetResponse_ValuesEntry {
+      return {
+        key: isSet(object.key) ? globalThis.String(object.key) : "",
+        value: isSet(object?.value) ? object.value : undefined,
+      };
+    },
+
+    toJSON(message: MultiGetResponse_ValuesEntry): unknown {
+      const obj: any = {};
+      if (message.key !== "") {
+        obj.key = message.key;
+      }
+      if (message.value !== undefined) {
+        obj.value = message.value;
+      }
+      return obj;
+    },
+
+    create<I extends Exact<DeepPartial<MultiGetResponse_ValuesEntry>, I>>(
+      base?: I,
+    ): MultiGetResponse_ValuesEntry {
+      return MultiGetResponse_ValuesEntry.fromPartial(base ?? ({} as any));
+    },
+    fromPartial<I extends Exact<DeepPartial<MultiGetResponse_ValuesEntry>, I>>(
+      object: I,
+    ): MultiGetResponse_ValuesEntry {
+      const message = createBaseMultiGetResponse_ValuesEntry();
+      message.key = object.key ?? "";
+      message.value = object.value ?? undefined;
+      return message;
+    },
+  };
+
+function createBaseMultiSetRequest(): MultiSetRequest {
+  return { values: {} };
+}
+
+export const MultiSetRequest: MessageFns<MultiSetRequest> = {
+  encode(
+    message: MultiSetRequest,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    Object.entries(message.values).forEach(([key, value]) => {
+      if (value !== undefined) {
+        MultiSetRequest_ValuesEntry.encode(
+          { key: key as any, value },
+          writer.uint32(10).fork(),
+        ).join();
+      }
+    });
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): MultiSetRequest {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseMultiSetRequest();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 10) {
+            break;
+          }
+
+          const entry1 = MultiSetRequest_ValuesEntry.decode(
+            reader,
+            reader.uint32(),
+          );
+          if (entry1.value !== undefined) {
+            message.values[entry1.key] = entry1.value;
+          }
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): MultiSetRequest {
+    return {
+      values: isObject(object.values)
+        ? Object.entries(object.values).reduce<{
+            [key: string]: any | undefined;
+          }>((acc, [key, value]) => {
+            acc[key] = value as any | undefined;
+            return acc;
+          }, {})
+        : {},
+    };
+  },
+
+  toJSON(message: MultiSetRequest): unknown {
+    const obj: any = {};
+    if (message.values) {
+      const entries = Object.entries(message.values);
+      if (entries.length > 0) {
+        obj.values = {};
+        entries.forEach(([k, v]) => {
+          obj.values[k] = v;
+        });
+      }
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<MultiSetRequest>, I>>(
+    base?: I,
+  ): MultiSetRequest {
+    return MultiSetRequest.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<MultiSetRequest>, I>>(
+    object: I,
+  ): MultiSetRequest {
+    const message = createBaseMultiSetRequest();
+    message.values = Object.entries(object.values ?? {}).reduce<{
+      [key: string]: any | undefined;
+    }>((acc, [key, value]) => {
+      if (value !== undefined) {
+        acc[key] = value;
+      }
+      return acc;
+    }, {});
+    return message;
+  },
+};
+
+function createBaseMultiSetRequest_ValuesEntry(): MultiSetRequest_ValuesEntry {
+  return { key: "", value: undefined };
+}
+
+export const MultiSetRequest_ValuesEntry: MessageFns<MultiSetRequest_ValuesEntry> =
+  {
+    encode(
+      message: MultiSetRequest_ValuesEntry,
+      writer: BinaryWriter = new BinaryWriter(),
+    ): BinaryWriter {
+      if (message.key !== "") {
+        writer.uint32(10).string(message.key);
+      }
+      if (message.value !== undefined) {
+        Value.encode(
+          Value.wrap(message.value),
+          writer.uint32(18).fork(),
+        ).join();
+      }
+      return writer;
+    },
+
+    decode(
+      input: BinaryReader | Uint8Array,
+      length?: number,
+    ): MultiSetRequest_ValuesEntry {
+      const reader =
+        input instanceof BinaryReader ? input : new BinaryReader(input);
+      const end = length === undefined ? reader.len : reader.pos + length;
+      const message = createBaseMultiSetRequest_ValuesEntry();
+      while (reader.pos < end) {
+        const tag = reader.uint32();
+        switch (tag >>> 3) {
+          case 1: {
+            if (tag !== 10) {
+              break;
+            }
+
+            message.key = reader.string();
+            continue;
+          }
+          case 2: {
+            if (tag !== 18) {
+              break;
+            }
+
+            message.value = Value.unwrap(Value.decode(reader, reader.uint32()));
+            continue;
+          }
+        }
+        if ((tag & 7) === 4 || tag === 0) {
+          break;
+        }
+        reader.skip(tag & 7);
+      }
+      return message;
+    },
+
+    fromJSON(object: any): MultiSetRequest_ValuesEntry {
+      return {
+        key: isSet(object.key) ? globalThis.String(object.key) : "",
+        value: isSet(object?.value) ? object.value : undefined,
+      };
+    },
+
+    toJSON(message: MultiSetRequest_ValuesEntry): unknown {
+      const obj: any = {};
+      if (message.key !== "") {
+        obj.key = message.key;
+      }
+      if (message.value !== undefined) {
+        obj.value = message.value;
+      }
+      return obj;
+    },
+
+    create<I extends Exact<DeepPartial<MultiSetRequest_ValuesEntry>, I>>(
+      base?: I,
+    ): MultiSetRequest_ValuesEntry {
+      return MultiSetRequest_ValuesEntry.fromPartial(base ?? ({} as any));
+    },
+    fromPartial<I extends Exact<DeepPartial<MultiSetRequest_ValuesEntry>, I>>(
+      object: I,
+    ): MultiSetRequest_ValuesEntry {
+      const message = createBaseMultiSetRequest_ValuesEntry();
+      message.key = object.key ?? "";
+      message.value = object.value ?? undefined;
+      return message;
+    },
+  };
+
+function createBaseMultiSetResponse(): MultiSetResponse {
+  return {};
+}
+
+export const MultiSetResponse: MessageFns<MultiSetResponse> = {
+  encode(
+    _: MultiSetResponse,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): MultiSetResponse {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseMultiSetResponse();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(_: any): MultiSetResponse {
+    return {};
+  },
+
+  toJSON(_: MultiSetResponse): unknown {
+    const obj: any = {};
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<MultiSetResponse>, I>>(
+    base?: I,
+  ): MultiSetResponse {
+    return MultiSetResponse.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<MultiSetResponse>, I>>(
+    _: I,
+  ): MultiSetResponse {
+    const message = createBaseMultiSetResponse();
+    return message;
+  },
+};
+
+function createBaseBatchOperation(): BatchOperation {
+  return { set: undefined, remove: undefined, clear: undefined };
+}
+
+export const BatchOperation: MessageFns<BatchOperation> = {
+  encode(
+    message: BatchOperation,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    if (message.set !== undefined) {
+      SetRequest.encode(message.set, writer.uint32(10).fork()).join();
+    }
+    if (message.remove !== undefined) {
+      RemoveRequest.encode(message.remove, writer.uint32(18).fork()).join();
+    }
+    if (message.clear !== undefined) {
+      ClearRequest.encode(message.clear, writer.uint32(26).fork()).join();
+    }
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): BatchOperation {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseBatchOperation();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 10) {
+            break;
+          }
+
+          message.set = SetRequest.decode(reader, reader.uint32());
+          continue;
+        }
+        case 2: {
+          if (tag !== 18) {
+            break;
+          }
+
+          message.remove = RemoveRequest.decode(reader, reader.uint32());
+          continue;
+        }
+        case 3: {
+          if (tag !== 26) {
+            break;
+          }
+
+          message.clear = ClearRequest.decode(reader, reader.uint32());
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): BatchOperation {
+    return {
+      set: isSet(object.set) ? SetRequest.fromJSON(object.set) : undefined,
+      remove: isSet(object.remove)
+        ? RemoveRequest.fromJSON(object.remove)
+        : undefined,
+      clear: isSet(object.clear)
+        ? ClearRequest.fromJSON(object.clear)
+        : undefined,
+    };
+  },
+
+  toJSON(message: BatchOperation): unknown {
+    const obj: any = {};
+    if (message.set !== undefined) {
+      obj.set = SetRequest.toJSON(message.set);
+    }
+    if (message.remove !== undefined) {
+      obj.remove = RemoveRequest.toJSON(message.remove);
+    }
+    if (message.clear !== undefined) {
+      obj.clear = ClearRequest.toJSON(message.clear);
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<BatchOperation>, I>>(
+    base?: I,
+  ): BatchOperation {
+    return BatchOperation.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<BatchOperation>, I>>(
+    object: I,
+  ): BatchOperation {
+    const message = createBaseBatchOperation();
+    message.set =
+      object.set !== undefined && object.set !== null
+        ? SetRequest.fromPartial(object.set)
+        : undefined;
+    message.remove =
+      object.remove !== undefined && object.remove !== null
+        ? RemoveRequest.fromPartial(object.remove)
+        : undefined;
+    message.clear =
+      object.clear !== undefined && object.clear !== null
+        ? ClearRequest.fromPartial(object.clear)
+        : undefined;
+    return message;
+  },
+};
+
+function createBaseBatchRequest(): BatchRequest {
+  return { ops: [] };
+}
+
+export const BatchRequest: MessageFns<BatchRequest> = {
+  encode(
+    message: BatchRequest,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    for (const v of message.ops) {
+      BatchOperation.encode(v!, writer.uint32(10).fork()).join();
+    }
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): BatchRequest {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseBatchRequest();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 10) {
+            break;
+          }
+
+          message.ops.push(BatchOperation.decode(reader, reader.uint32()));
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): BatchRequest {
+    return {
+      ops: globalThis.Array.isArray(object?.ops)
+        ? object.ops.map((e: any) => BatchOperation.fromJSON(e))
+        : [],
+    };
+  },
+
+  toJSON(message: BatchRequest): unknown {
+    const obj: any = {};
+    if (message.ops?.length) {
+      obj.ops = message.ops.map((e) => BatchOperation.toJSON(e));
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<BatchRequest>, I>>(
+    base?: I,
+  ): BatchRequest {
+    return BatchRequest.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<BatchRequest>, I>>(
+    object: I,
+  ): BatchRequest {
+    const message = createBaseBatchRequest();
+    message.ops = object.ops?.map((e) => BatchOperation.fromPartial(e)) || [];
+    return message;
+  },
+};
+
+function createBaseBatchResponse(): BatchResponse {
+  return {};
+}
+
+export const BatchResponse: MessageFns<BatchResponse> = {
+  encode(
+    _: BatchResponse,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): BatchResponse {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseBatchResponse();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(_: any): BatchResponse {
+    return {};
+  },
+
+  toJSON(_: BatchResponse): unknown {
+    const obj: any = {};
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<BatchResponse>, I>>(
+    base?: I,
+  ): BatchResponse {
+    return BatchResponse.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<BatchResponse>, I>>(
+    _: I,
+  ): BatchResponse {
+    const message = createBaseBatchResponse();
+    return message;
+  },
+};
+
+function createBaseRequest(): Request {
+  return {
+    get: undefined,
+    set: undefined,
+    remove: undefined,
+    clear: undefined,
+    list: undefined,
+    multiGet: undefined,
+    multiSet: undefined,
+    batch: undefined,
+  };
+}
+
+export const Request: MessageFns<Request> = {
+  encode(
+    message: Request,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    if (message.get !== undefined) {
+      GetRequest.encode(message.get, writer.uint32(10).fork()).join();
+    }
+    if (message.set !== undefined) {
+      SetRequest.encode(message.set, writer.uint32(18).fork()).join();
+    }
+    if (message.remove !== undefined) {
+      RemoveRequest.encode(message.remove, writer.uint32(26).fork()).join();
+    }
+    if (message.clear !== undefined) {
+      ClearRequest.encode(message.clear, writer.uint32(34).fork()).join();
+    }
+    if (message.list !== undefined) {
+      ListRequest.encode(message.list, writer.uint32(42).fork()).join();
+    }
+    if (message.multiGet !== undefined) {
+      MultiGetRequest.encode(message.multiGet, writer.uint32(50).fork()).join();
+    }
+    if (message.multiSet !== undefined) {
+      MultiSetRequest.encode(message.multiSet, writer.uint32(58).fork()).join();
+    }
+    if (message.batch !== undefined) {
+      BatchRequest.encode(message.batch, writer.uint32(66).fork()).join();
+    }
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): Request {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseRequest();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 10) {
+            break;
+          }
+
+          message.get = GetRequest.decode(reader, reader.uint32());
+          continue;
+        }
+        case 2: {
+          if (tag !== 18) {
+            break;
+          }
+
+          message.set = SetRequest.decode(reader, reader.uint32());
+          continue;
+        }
+        case 3: {
+          if (tag !== 26) {
+            break;
+          }
+
+          message.remove = RemoveRequest.decode(reader, reader.uint32());
+          continue;
+        }
+        case 4: {
+          if (tag !== 34) {
+            break;
+          }
+
+          message.clear = ClearRequest.decode(reader, reader.uint32());
+          continue;
+        }
+        case 5: {
+          if (tag !== 42) {
+            break;
+          }
+
+          message.list = ListRequest.decode(reader, reader.uint32());
+          continue;
+        }
+        case 6: {
+          if (tag !== 50) {
+            break;
+          }
+
+          message.multiGet = MultiGetRequest.decode(reader, reader.uint32());
+          continue;
+        }
+        case 7: {
+          if (tag !== 58) {
+            break;
+          }
+
+          message.multiSet = MultiSetRequest.decode(reader, reader.uint32());
+          continue;
+        }
+        case 8: {
+          if (tag !== 66) {
+            break;
+          }
+
+          message.batch = BatchRequest.decode(reader, reader.uint32());
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): Request {
+    return {
+      get: isSet(object.get) ? GetRequest.fromJSON(object.get) : undefined,
+      set: isSet(object.set) ? SetRequest.fromJSON(object.set) : undefined,
+      remove: isSet(object.remove)
+        ? RemoveRequest.fromJSON(object.remove)
+        : undefined,
+      clear: isSet(object.clear)
+        ? ClearRequest.fromJSON(object.clear)
+        : undefined,
+      list: isSet(object.list) ? ListRequest.fromJSON(object.list) : undefined,
+      multiGet: isSet(object.multiGet)
+        ? MultiGetRequest.fromJSON(object.multiGet)
+        : undefined,
+      multiSet: isSet(object.multiSet)
+        ? MultiSetRequest.fromJSON(object.multiSet)
+        : undefined,
+      batch: isSet(object.batch)
+        ? BatchRequest.fromJSON(object.batch)
+        : undefined,
+    };
+  },
+
+  toJSON(message: Request): unknown {
+    const obj: any = {};
+    if (message.get !== undefined) {
+      obj.get = GetRequest.toJSON(message.get);
+    }
+    if (message.set !== undefined) {
+      obj.set = SetRequest.toJSON(message.set);
+    }
+    if (message.remove !== undefined) {
+      obj.remove = RemoveRequest.toJSON(message.remove);
+    }
+    if (message.clear !== undefined) {
+      obj.clear = ClearRequest.toJSON(message.clear);
+    }
+    if (message.list !== undefined) {
+      obj.list = ListRequest.toJSON(message.list);
+    }
+    if (message.multiGet !== undefined) {
+      obj.multiGet = MultiGetRequest.toJSON(message.multiGet);
+    }
+    if (message.multiSet !== undefined) {
+      obj.multiSet = MultiSetRequest.toJSON(message.multiSet);
+    }
+    if (message.batch !== undefined) {
+      obj.batch = BatchRequest.toJSON(message.batch);
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<Request>, I>>(base?: I): Request {
+    return Request.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<Request>, I>>(object: I): Request {
+    const message = createBaseRequest();
+    message.get =
+      object.get !== undefined && object.get !== null
+        ? GetRequest.fromPartial(object.get)
+        : undefined;
+    message.set =
+      object.set !== undefined && object.set !== null
+        ? SetRequest.fromPartial(object.set)
+        : undefined;
+    message.remove =
+      object.remove !== undefined && object.remove !== null
+        ? RemoveRequest.fromPartial(object.remove)
+        : undefined;
+    message.clear =
+      object.clear !== undefined && object.clear !== null
+        ? ClearRequest.fromPartial(object.clear)
+        : undefined;
+    message.list =
+      object.list !== undefined && object.list !== null
+        ? ListRequest.fromPartial(object.list)
+        : undefined;
+    message.multiGet =
+      object.multiGet !== undefined && object.multiGet !== null
+        ? MultiGetRequest.fromPartial(object.multiGet)
+        : undefined;
+    message.multiSet =
+      object.multiSet !== undefined && object.multiSet !== null
+        ? MultiSetRequest.fromPartial(object.multiSet)
+        : undefined;
+    message.batch =
+      object.batch !== undefined && object.batch !== null
+        ? BatchRequest.fromPartial(object.batch)
+        : undefined;
+    return message;
+  },
+};
+
+function createBaseResponse(): Response {
+  return {
+    get: undefined,
+    set: undefined,
+    remove: undefined,
+    clear: undefined,
+    list: undefined,
+    multiGet: undefined,
+    multiSet: undefined,
+    batch: undefined,
+  };
+}
+
+export const Response: MessageFns<Response> = {
+  encode(
+    message: Response,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    if (message.get !== undefined) {
+      GetResponse.encode(message.get, writer.uint32(10).fork()).join();
+    }
+    if (message.set !== undefined) {
+      SetResponse.encode(message.set, writer.uint32(18).fork()).join();
+    }
+    if (message.remove !== undefined) {
+      RemoveResponse.encode(message.remove, writer.uint32(26).fork()).join();
+    }
+    if (message.clear !== undefined) {
+      ClearResponse.encode(message.clear, writer.uint32(34).fork()).join();
+    }
+    if (message.list !== undefined) {
+      ListResponse.encode(message.list, writer.uint32(42).fork()).join();
+    }
+    if (message.multiGet !== undefined) {
+      MultiGetResponse.encode(
+        message.multiGet,
+        writer.uint32(50).fork(),
+      ).join();
+    }
+    if (message.multiSet !== undefined) {
+      MultiSetResponse.encode(
+        message.multiSet,
+        writer.uint32(58).fork(),
+      ).join();
+    }
+    if (message.batch !== undefined) {
+      BatchResponse.encode(message.batch, writer.uint32(66).fork()).join();
+    }
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): Response {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseResponse();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 10) {
+            break;
+          }
+
+          message.get = GetResponse.decode(reader, reader.uint32());
+          continue;
+        }
+        case 2: {
+          if (tag !== 18) {
+            break;
+          }
+
+          message.set = SetResponse.decode(reader, reader.uint32());
+          continue;
+        }
+        case 3: {
+          if (tag !== 26) {
+            break;
+          }
+
+          message.remove = RemoveResponse.decode(reader, reader.uint32());
+          continue;
+        }
+        case 4: {
+          if (tag !== 34) {
+            break;
+          }
+
+          message.clear = ClearResponse.decode(reader, reader.uint32());
+          continue;
+        }
+        case 5: {
+          if (tag !== 42) {
+            break;
+          }
+
+          message.list = ListResponse.decode(reader, reader.uint32());
+          continue;
+        }
+        case 6: {
+          if (tag !== 50) {
+            break;
+          }
+
+          message.multiGet = MultiGetResponse.decode(reader, reader.uint32());
+          continue;
+        }
+        case 7: {
+          if (tag !== 58) {
+            break;
+          }
+
+          message.multiSet = MultiSetResponse.decode(reader, reader.uint32());
+          continue;
+        }
+        case 8: {
+          if (tag !== 66) {
+            break;
+          }
+
+          message.batch = BatchResponse.decode(reader, reader.uint32());
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): Response {
+    return {
+      get: isSet(object.get) ? GetResponse.fromJSON(object.get) : undefined,
+      set: isSet(object.set) ? SetResponse.fromJSON(object.set) : undefined,
+      remove: isSet(object.remove)
+        ? RemoveResponse.fromJSON(object.remove)
+        : undefined,
+      clear: isSet(object.clear)
+        ? ClearResponse.fromJSON(object.clear)
+        : undefined,
+      list: isSet(object.list) ? ListResponse.fromJSON(object.list) : undefined,
+      multiGet: isSet(object.multiGet)
+        ? MultiGetResponse.fromJSON(object.multiGet)
+        : undefined,
+      multiSet: isSet(object.multiSet)
+        ? MultiSetResponse.fromJSON(object.multiSet)
+        : undefined,
+      batch: isSet(object.batch)
+        ? BatchResponse.fromJSON(object.batch)
+        : undefined,
+    };
+  },
+
+  toJSON(message: Response): unknown {
+    const obj: any = {};
+    if (message.get !== undefined) {
+      obj.get = GetResponse.toJSON(message.get);
+    }
+    if (message.set !== undefined) {
+      obj.set = SetResponse.toJSON(message.set);
+    }
+    if (message.remove !== undefined) {
+      obj.remove = RemoveResponse.toJSON(message.remove);
+    }
+    if (message.clear !== undefined) {
+      obj.clear = ClearResponse.toJSON(message.clear);
+    }
+    if (message.list !== undefined) {
+      obj.list = ListResponse.toJSON(message.list);
+    }
+    if (message.multiGet !== undefined) {
+      obj.multiGet = MultiGetResponse.toJSON(message.multiGet);
+    }
+    if (message.multiSet !== undefined) {
+      obj.multiSet = MultiSetResponse.toJSON(message.multiSet);
+    }
+    if (message.batch !== undefined) {
+      obj.batch = BatchResponse.toJSON(message.batch);
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<Response>, I>>(base?: I): Response {
+    return Response.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<Response>, I>>(object: I): Response {
+    const message = createBaseResponse();
+    message.get =
+      object.get !== undefined && object.get !== null
+        ? GetResponse.fromPartial(object.get)
         : undefined;
     message.set =
       object.set !== undefined && object.set !== null
@@ -1073,6 +1979,18 @@ export const Response: MessageFns<Response> = {
       object.list !== undefined && object.list !== null
         ? ListResponse.fromPartial(object.list)
         : undefined;
+    message.multiGet =
+      object.multiGet !== undefined && object.multiGet !== null
+        ? MultiGetResponse.fromPartial(object.multiGet)
+        : undefined;
+    message.multiSet =
+      object.multiSet !== undefined && object.multiSet !== null
+        ? MultiSetResponse.fromPartial(object.multiSet)
+        : undefined;
+    message.batch =
+      object.batch !== undefined && object.batch !== null
+        ? BatchResponse.fromPartial(object.batch)
+        : undefined;
     return message;
   },
 };
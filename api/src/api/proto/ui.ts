@@ -223,11 +223,8 @@ export interface ShowHudRequest {
 }
 
 export interface RenderRequest {
-  /**
-   * repeated RenderNode views = 1;
-   * we will migrate to actual protobuf
-   */
-  json: string;
+  /** changes made to the render tree since the previous render, applied in order */
+  ops: RenderOperation[];
 }
 
 export interface ConfirmAlertRequest {
@@ -278,10 +275,9 @@ export interface Response {
 
 export interface RenderNode {
   type: string;
-  hasDirtyChild: boolean;
-  hasDirtyProps: boolean;
   props: { [key: string]: any | undefined };
   children: RenderNode[];
+  id: number;
 }
 
 export interface RenderNode_PropsEntry {
@@ -289,6 +285,46 @@ export interface RenderNode_PropsEntry {
   value: any | undefined;
 }
 
+export interface InsertNodeOperation {
+  parent: number;
+  /** appended if not set */
+  before?: number | undefined;
+  node?: RenderNode | undefined;
+}
+
+export interface MoveNodeOperation {
+  parent: number;
+  id: number;
+  before?: number | undefined;
+}
+
+export interface RemoveNodeOperation {
+  parent: number;
+  id: number;
+}
+
+export interface UpdateNodeOperation {
+  id: number;
+  props: { [key: string]: any | undefined };
+}
+
+export interface UpdateNodeOperation_PropsEntry {
+  key: string;
+  value: any | undefined;
+}
+
+export interface ClearNodeOperation {
+  id: number;
+}
+
+export interface RenderOperation {
+  insert?: InsertNodeOperation | undefined;
+  move?: MoveNodeOperation | undefined;
+  remove?: RemoveNodeOperation | undefined;
+  update?: UpdateNodeOperation | undefined;
+  clear?: ClearNodeOperation | undefined;
+}
+
 export interface ThemedImageSource {
   light: string;
   dark: string;
@@ -1066,7 +1102,7 @@ export const ShowHudRequest: MessageFns<ShowHudRequest> = {
 };
 
 function createBaseRenderRequest(): RenderRequest {
-  return { json: "" };
+  return { ops: [] };
 }
 
 export const RenderRequest: MessageFns<RenderRequest> = {
@@ -1074,8 +1110,8 @@ export const RenderRequest: MessageFns<RenderRequest> = {
     message: RenderRequest,
     writer: BinaryWriter = new BinaryWriter(),
   ): BinaryWriter {
-    if (message.json !== "") {
-      writer.uint32(10).string(message.json);
+    for (const v of message.ops) {
+      RenderOperation.encode(v!, writer.uint32(18).fork()).join();
     }
     return writer;
   },
@@ -1088,12 +1124,12 @@ export const RenderRequest: MessageFns<RenderRequest> = {
     while (reader.pos < end) {
       const tag = reader.uint32();
       switch (tag >>> 3) {
-        case 1: {
-          if (tag !== 10) {
+        case 2: {
+          if (tag !== 18) {
             break;
           }
 
-          message.json = reader.string();
+          message.ops.push(RenderOperation.decode(reader, reader.uint32()));
           continue;
         }
       }
@@ -1106,27 +1142,27 @@ export const RenderRequest: MessageFns<RenderRequest> = {
   },
 
   fromJSON(object: any): RenderRequest {
-    return { json: isSet(object.json) ? globalThis.String(object.json) : "" };
+    return {
+      ops: globalThis.Array.isArray(object?.ops)
+        ? object.ops.map((e: any) => RenderOperation.fromJSON(e))
+        : [],
+    };
   },
 
   toJSON(message: RenderRequest): unknown {
     const obj: any = {};
-    if (message.json !== "") {
-      obj.json = message.json;
+    if (message.ops?.length) {
+      obj.ops = message.ops.map((e) => RenderOperation.toJSON(e));
     }
     return obj;
   },
 
-  create<I extends Exact<DeepPartial<RenderRequest>, I>>(
-    base?: I,
-  ): RenderRequest {
+  create<I extends Exact<DeepPartial<RenderRequest>, I>>(base?: I): RenderRequest {
     return RenderRequest.fromPartial(base ?? ({} as any));
   },
-  fromPartial<I extends Exact<DeepPartial<RenderRequest>, I>>(
-    object: I,
-  ): RenderRequest {
+  fromPartial<I extends Exact<DeepPartial<RenderRequest>, I>>(object: I): RenderRequest {
     const message = createBaseRenderRequest();
-    message.json = object.json ?? "";
+    message.ops = object.ops?.map((e) => RenderOperation.fromPartial(e)) || [];
     return message;
   },
 };
@@ -2110,10 +2146,9 @@ export const Response: MessageFns<Response> = {
 function createBaseRenderNode(): RenderNode {
   return {
     type: "",
-    hasDirtyChild: false,
-    hasDirtyProps: false,
     props: {},
     children: [],
+    id: 0,
   };
 }
 
@@ -2125,12 +2160,6 @@ export const RenderNode: MessageFns<RenderNode> = {
     if (message.type !== "") {
       writer.uint32(10).string(message.type);
     }
-    if (message.hasDirtyChild !== false) {
-      writer.uint32(16).bool(message.hasDirtyChild);
-    }
-    if (message.hasDirtyProps !== false) {
-      writer.uint32(24).bool(message.hasDirtyProps);
-    }
     Object.entries(message.props).forEach(([key, value]) => {
       if (value !== undefined) {
         RenderNode_PropsEntry.encode(
@@ -2142,6 +2171,9 @@ export const RenderNode: MessageFns<RenderNode> = {
     for (const v of message.children) {
       RenderNode.encode(v!, writer.uint32(42).fork()).join();
     }
+    if (message.id !== 0) {
+      writer.uint32(48).uint32(message.id);
+    }
     return writer;
   },
 
@@ -2161,22 +2193,6 @@ export const RenderNode: MessageFns<RenderNode> = {
           message.type = reader.string();
           continue;
         }
-        case 2: {
-          if (tag !== 16) {
-            break;
-          }
-
-          message.hasDirtyChild = reader.bool();
-          continue;
-        }
-        case 3: {
-          if (tag !== 24) {
-            break;
-          }
-
-          message.hasDirtyProps = reader.bool();
-          continue;
-        }
         case 4: {
           if (tag !== 34) {
             break;
@@ -2196,6 +2212,14 @@ export const RenderNode: MessageFns<RenderNode> = {
           message.children.push(RenderNode.decode(reader, reader.uint32()));
           continue;
         }
+        case 6: {
+          if (tag !== 48) {
+            break;
+          }
+
+          message.id = reader.uint32();
+          continue;
+        }
       }
       if ((tag & 7) === 4 || tag === 0) {
         break;
@@ -2208,12 +2232,6 @@ export const RenderNode: MessageFns<RenderNode> = {
   fromJSON(object: any): RenderNode {
     return {
       type: isSet(object.type) ? globalThis.String(object.type) : "",
-      hasDirtyChild: isSet(object.hasDirtyChild)
-        ? globalThis.Boolean(object.hasDirtyChild)
-        : false,
-      hasDirtyProps: isSet(object.hasDirtyProps)
-        ? globalThis.Boolean(object.hasDirtyProps)
-        : false,
       props: isObject(object.props)
         ? Object.entries(object.props).reduce<{
             [key: string]: any | undefined;
@@ -2225,6 +2243,7 @@ export const RenderNode: MessageFns<RenderNode> = {
       children: globalThis.Array.isArray(object?.children)
         ? object.children.map((e: any) => RenderNode.fromJSON(e))
         : [],
+      id: isSet(object.id) ? globalThis.Number(object.id) : 0,
     };
   },
 
@@ -2233,12 +2252,6 @@ export const RenderNode: MessageFns<RenderNode> = {
     if (message.type !== "") {
       obj.type = message.type;
     }
-    if (message.hasDirtyChild !== false) {
-      obj.hasDirtyChild = message.hasDirtyChild;
-    }
-    if (message.hasDirtyProps !== false) {
-      obj.hasDirtyProps = message.hasDirtyProps;
-    }
     if (message.props) {
       const entries = Object.entries(message.props);
       if (entries.length > 0) {
@@ -2251,6 +2264,9 @@ export const RenderNode: MessageFns<RenderNode> = {
     if (message.children?.length) {
       obj.children = message.children.map((e) => RenderNode.toJSON(e));
     }
+    if (message.id !== 0) {
+      obj.id = Math.round(message.id);
+    }
     return obj;
   },
 
@@ -2262,8 +2278,6 @@ export const RenderNode: MessageFns<RenderNode> = {
   ): RenderNode {
     const message = createBaseRenderNode();
     message.type = object.type ?? "";
-    message.hasDirtyChild = object.hasDirtyChild ?? false;
-    message.hasDirtyProps = object.hasDirtyProps ?? false;
     message.props = Object.entries(object.props ?? {}).reduce<{
       [key: string]: any | undefined;
     }>((acc, [key, value]) => {
@@ -2274,6 +2288,7 @@ export const RenderNode: MessageFns<RenderNode> = {
     }, {});
     message.children =
       object.children?.map((e) => RenderNode.fromPartial(e)) || [];
+    message.id = object.id ?? 0;
     return message;
   },
 };
@@ -2365,6 +2380,689 @@ export const RenderNode_PropsEntry: MessageFns<RenderNode_PropsEntry> = {
   },
 };
 
+function createBaseInsertNodeOperation(): InsertNodeOperation {
+  return { parent: 0, before: undefined, node: undefined };
+}
+
+export const InsertNodeOperation: MessageFns<InsertNodeOperation> = {
+  encode(
+    message: InsertNodeOperation,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    if (message.parent !== 0) {
+      writer.uint32(8).uint32(message.parent);
+    }
+    if (message.before !== undefined) {
+      writer.uint32(16).uint32(message.before);
+    }
+    if (message.node !== undefined) {
+      RenderNode.encode(message.node, writer.uint32(26).fork()).join();
+    }
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): InsertNodeOperation {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseInsertNodeOperation();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 8) {
+            break;
+          }
+
+          message.parent = reader.uint32();
+          continue;
+        }
+        case 2: {
+          if (tag !== 16) {
+            break;
+          }
+
+          message.before = reader.uint32();
+          continue;
+        }
+        case 3: {
+          if (tag !== 26) {
+            break;
+          }
+
+          message.node = RenderNode.decode(reader, reader.uint32());
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): InsertNodeOperation {
+    return {
+      parent: isSet(object.parent) ? globalThis.Number(object.parent) : 0,
+      before: isSet(object.before) ? globalThis.Number(object.before) : undefined,
+      node: isSet(object.node) ? RenderNode.fromJSON(object.node) : undefined,
+    };
+  },
+
+  toJSON(message: InsertNodeOperation): unknown {
+    const obj: any = {};
+    if (message.parent !== 0) {
+      obj.parent = Math.round(message.parent);
+    }
+    if (message.before !== undefined) {
+      obj.before = Math.round(message.before);
+    }
+    if (message.node !== undefined) {
+      obj.node = RenderNode.toJSON(message.node);
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<InsertNodeOperation>, I>>(base?: I): InsertNodeOperation {
+    return InsertNodeOperation.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<InsertNodeOperation>, I>>(object: I): InsertNodeOperation {
+    const message = createBaseInsertNodeOperation();
+    message.parent = object.parent ?? 0;
+    message.before = object.before ?? undefined;
+    message.node =
+      object.node !== undefined && object.node !== null
+        ? RenderNode.fromPartial(object.node)
+        : undefined;
+    return message;
+  },
+};
+
+function createBaseMoveNodeOperation(): MoveNodeOperation {
+  return { parent: 0, id: 0, before: undefined };
+}
+
+export const MoveNodeOperation: MessageFns<MoveNodeOperation> = {
+  encode(
+    message: MoveNodeOperation,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    if (message.parent !== 0) {
+      writer.uint32(8).uint32(message.parent);
+    }
+    if (message.id !== 0) {
+      writer.uint32(16).uint32(message.id);
+    }
+    if (message.before !== undefined) {
+      writer.uint32(24).uint32(message.before);
+    }
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): MoveNodeOperation {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseMoveNodeOperation();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 8) {
+            break;
+          }
+
+          message.parent = reader.uint32();
+          continue;
+        }
+        case 2: {
+          if (tag !== 16) {
+            break;
+          }
+
+          message.id = reader.uint32();
+          continue;
+        }
+        case 3: {
+          if (tag !== 24) {
+            break;
+          }
+
+          message.before = reader.uint32();
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): MoveNodeOperation {
+    return {
+      parent: isSet(object.parent) ? globalThis.Number(object.parent) : 0,
+      id: isSet(object.id) ? globalThis.Number(object.id) : 0,
+      before: isSet(object.before) ? globalThis.Number(object.before) : undefined,
+    };
+  },
+
+  toJSON(message: MoveNodeOperation): unknown {
+    const obj: any = {};
+    if (message.parent !== 0) {
+      obj.parent = Math.round(message.parent);
+    }
+    if (message.id !== 0) {
+      obj.id = Math.round(message.id);
+    }
+    if (message.before !== undefined) {
+      obj.before = Math.round(message.before);
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<MoveNodeOperation>, I>>(base?: I): MoveNodeOperation {
+    return MoveNodeOperation.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<MoveNodeOperation>, I>>(object: I): MoveNodeOperation {
+    const message = createBaseMoveNodeOperation();
+    message.parent = object.parent ?? 0;
+    message.id = object.id ?? 0;
+    message.before = object.before ?? undefined;
+    return message;
+  },
+};
+
+function createBaseRemoveNodeOperation(): RemoveNodeOperation {
+  return { parent: 0, id: 0 };
+}
+
+export const RemoveNodeOperation: MessageFns<RemoveNodeOperation> = {
+  encode(
+    message: RemoveNodeOperation,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    if (message.parent !== 0) {
+      writer.uint32(8).uint32(message.parent);
+    }
+    if (message.id !== 0) {
+      writer.uint32(16).uint32(message.id);
+    }
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): RemoveNodeOperation {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseRemoveNodeOperation();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 8) {
+            break;
+          }
+
+          message.parent = reader.uint32();
+          continue;
+        }
+        case 2: {
+          if (tag !== 16) {
+            break;
+          }
+
+          message.id = reader.uint32();
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): RemoveNodeOperation {
+    return {
+      parent: isSet(object.parent) ? globalThis.Number(object.parent) : 0,
+      id: isSet(object.id) ? globalThis.Number(object.id) : 0,
+    };
+  },
+
+  toJSON(message: RemoveNodeOperation): unknown {
+    const obj: any = {};
+    if (message.parent !== 0) {
+      obj.parent = Math.round(message.parent);
+    }
+    if (message.id !== 0) {
+      obj.id = Math.round(message.id);
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<RemoveNodeOperation>, I>>(base?: I): RemoveNodeOperation {
+    return RemoveNodeOperation.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<RemoveNodeOperation>, I>>(object: I): RemoveNodeOperation {
+    const message = createBaseRemoveNodeOperation();
+    message.parent = object.parent ?? 0;
+    message.id = object.id ?? 0;
+    return message;
+  },
+};
+
+function createBaseUpdateNodeOperation(): UpdateNodeOperation {
+  return { id: 0, props: {} };
+}
+
+export const UpdateNodeOperation: MessageFns<UpdateNodeOperation> = {
+  encode(
+    message: UpdateNodeOperation,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    if (message.id !== 0) {
+      writer.uint32(8).uint32(message.id);
+    }
+    Object.entries(message.props).forEach(([key, value]) => {
+      if (value !== undefined) {
+        UpdateNodeOperation_PropsEntry.encode(
+          { key: key as any, value },
+          writer.uint32(18).fork(),
+        ).join();
+      }
+    });
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): UpdateNodeOperation {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseUpdateNodeOperation();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 8) {
+            break;
+          }
+
+          message.id = reader.uint32();
+          continue;
+        }
+        case 2: {
+          if (tag !== 18) {
+            break;
+          }
+
+          const entry2 = UpdateNodeOperation_PropsEntry.decode(reader, reader.uint32());
+          if (entry2.value !== undefined) {
+            message.props[entry2.key] = entry2.value;
+          }
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): UpdateNodeOperation {
+    return {
+      id: isSet(object.id) ? globalThis.Number(object.id) : 0,
+      props: isObject(object.props)
+        ? Object.entries(object.props).reduce<{
+            [key: string]: any | undefined;
+          }>((acc, [key, value]) => {
+            acc[key] = value as any | undefined;
+            return acc;
+          }, {})
+        : {},
+    };
+  },
+
+  toJSON(message: UpdateNodeOperation): unknown {
+    const obj: any = {};
+    if (message.id !== 0) {
+      obj.id = Math.round(message.id);
+    }
+    if (message.props) {
+      const entries = Object.entries(message.props);
+      if (entries.length > 0) {
+        obj.props = {};
+        entries.forEach(([k, v]) => {
+          obj.props[k] = v;
+        });
+      }
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<UpdateNodeOperation>, I>>(base?: I): UpdateNodeOperation {
+    return UpdateNodeOperation.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<UpdateNodeOperation>, I>>(object: I): UpdateNodeOperation {
+    const message = createBaseUpdateNodeOperation();
+    message.id = object.id ?? 0;
+    message.props = Object.entries(object.props ?? {}).reduce<{
+      [key: string]: any | undefined;
+    }>((acc, [key, value]) => {
+      if (value !== undefined) {
+        acc[key] = value;
+      }
+      return acc;
+    }, {});
+    return message;
+  },
+};
+
+function createBaseUpdateNodeOperation_PropsEntry(): UpdateNodeOperation_PropsEntry {
+  return { key: "", value: undefined };
+}
+
+export const UpdateNodeOperation_PropsEntry: MessageFns<UpdateNodeOperation_PropsEntry> = {
+  encode(
+    message: UpdateNodeOperation_PropsEntry,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    if (message.key !== "") {
+      writer.uint32(10).string(message.key);
+    }
+    if (message.value !== undefined) {
+      Value.encode(Value.wrap(message.value), writer.uint32(18).fork()).join();
+    }
+    return writer;
+  },
+
+  decode(
+    input: BinaryReader | Uint8Array,
+    length?: number,
+  ): UpdateNodeOperation_PropsEntry {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseUpdateNodeOperation_PropsEntry();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 10) {
+            break;
+          }
+
+          message.key = reader.string();
+          continue;
+        }
+        case 2: {
+          if (tag !== 18) {
+            break;
+          }
+
+          message.value = Value.unwrap(Value.decode(reader, reader.uint32()));
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): UpdateNodeOperation_PropsEntry {
+    return {
+      key: isSet(object.key) ? globalThis.String(object.key) : "",
+      value: isSet(object?.value) ? object.value : undefined,
+    };
+  },
+
+  toJSON(message: UpdateNodeOperation_PropsEntry): unknown {
+    const obj: any = {};
+    if (message.key !== "") {
+      obj.key = message.key;
+    }
+    if (message.value !== undefined) {
+      obj.value = message.value;
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<UpdateNodeOperation_PropsEntry>, I>>(
+    base?: I,
+  ): UpdateNodeOperation_PropsEntry {
+    return UpdateNodeOperation_PropsEntry.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<UpdateNodeOperation_PropsEntry>, I>>(
+    object: I,
+  ): UpdateNodeOperation_PropsEntry {
+    const message = createBaseUpdateNodeOperation_PropsEntry();
+    message.key = object.key ?? "";
+    message.value = object.value ?? undefined;
+    return message;
+  },
+};
+
+function createBaseClearNodeOperation(): ClearNodeOperation {
+  return { id: 0 };
+}
+
+export const ClearNodeOperation: MessageFns<ClearNodeOperation> = {
+  encode(
+    message: ClearNodeOperation,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    if (message.id !== 0) {
+      writer.uint32(8).uint32(message.id);
+    }
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): ClearNodeOperation {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseClearNodeOperation();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 8) {
+            break;
+          }
+
+          message.id = reader.uint32();
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): ClearNodeOperation {
+    return {
+      id: isSet(object.id) ? globalThis.Number(object.id) : 0,
+    };
+  },
+
+  toJSON(message: ClearNodeOperation): unknown {
+    const obj: any = {};
+    if (message.id !== 0) {
+      obj.id = Math.round(message.id);
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<ClearNodeOperation>, I>>(base?: I): ClearNodeOperation {
+    return ClearNodeOperation.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<ClearNodeOperation>, I>>(object: I): ClearNodeOperation {
+    const message = createBaseClearNodeOperation();
+    message.id = object.id ?? 0;
+    return message;
+  },
+};
+
+function createBaseRenderOperation(): RenderOperation {
+  return {
+    insert: undefined,
+    move: undefined,
+    remove: undefined,
+    update: undefined,
+    clear: undefined,
+  };
+}
+
+export const RenderOperation: MessageFns<RenderOperation> = {
+  encode(
+    message: RenderOperation,
+    writer: BinaryWriter = new BinaryWriter(),
+  ): BinaryWriter {
+    if (message.insert !== undefined) {
+      InsertNodeOperation.encode(message.insert, writer.uint32(10).fork()).join();
+    }
+    if (message.move !== undefined) {
+      MoveNodeOperation.encode(message.move, writer.uint32(18).fork()).join();
+    }
+    if (message.remove !== undefined) {
+      RemoveNodeOperation.encode(message.remove, writer.uint32(26).fork()).join();
+    }
+    if (message.update !== undefined) {
+      UpdateNodeOperation.encode(message.update, writer.uint32(34).fork()).join();
+    }
+    if (message.clear !== undefined) {
+      ClearNodeOperation.encode(message.clear, writer.uint32(42).fork()).join();
+    }
+    return writer;
+  },
+
+  decode(input: BinaryReader | Uint8Array, length?: number): RenderOperation {
+    const reader =
+      input instanceof BinaryReader ? input : new BinaryReader(input);
+    const end = length === undefined ? reader.len : reader.pos + length;
+    const message = createBaseRenderOperation();
+    while (reader.pos < end) {
+      const tag = reader.uint32();
+      switch (tag >>> 3) {
+        case 1: {
+          if (tag !== 10) {
+            break;
+          }
+
+          message.insert = InsertNodeOperation.decode(reader, reader.uint32());
+          continue;
+        }
+        case 2: {
+          if (tag !== 18) {
+            break;
+          }
+
+          message.move = MoveNodeOperation.decode(reader, reader.uint32());
+          continue;
+        }
+        case 3: {
+          if (tag !== 26) {
+            break;
+          }
+
+          message.remove = RemoveNodeOperation.decode(reader, reader.uint32());
+          continue;
+        }
+        case 4: {
+          if (tag !== 34) {
+            break;
+          }
+
+          message.update = UpdateNodeOperation.decode(reader, reader.uint32());
+          continue;
+        }
+        case 5: {
+          if (tag !== 42) {
+            break;
+          }
+
+          message.clear = ClearNodeOperation.decode(reader, reader.uint32());
+          continue;
+        }
+      }
+      if ((tag & 7) === 4 || tag === 0) {
+        break;
+      }
+      reader.skip(tag & 7);
+    }
+    return message;
+  },
+
+  fromJSON(object: any): RenderOperation {
+    return {
+      insert: isSet(object.insert) ? InsertNodeOperation.fromJSON(object.insert) : undefined,
+      move: isSet(object.move) ? MoveNodeOperation.fromJSON(object.move) : undefined,
+      remove: isSet(object.remove) ? RemoveNodeOperation.fromJSON(object.remove) : undefined,
+      update: isSet(object.update) ? UpdateNodeOperation.fromJSON(object.update) : undefined,
+      clear: isSet(object.clear) ? ClearNodeOperation.fromJSON(object.clear) : undefined,
+    };
+  },
+
+  toJSON(message: RenderOperation): unknown {
+    const obj: any = {};
+    if (message.insert !== undefined) {
+      obj.insert = InsertNodeOperation.toJSON(message.insert);
+    }
+    if (message.move !== undefined) {
+      obj.move = MoveNodeOperation.toJSON(message.move);
+    }
+    if (message.remove !== undefined) {
+      obj.remove = RemoveNodeOperation.toJSON(message.remove);
+    }
+    if (message.update !== undefined) {
+      obj.update = UpdateNodeOperation.toJSON(message.update);
+    }
+    if (message.clear !== undefined) {
+      obj.clear = ClearNodeOperation.toJSON(message.clear);
+    }
+    return obj;
+  },
+
+  create<I extends Exact<DeepPartial<RenderOperation>, I>>(base?: I): RenderOperation {
+    return RenderOperation.fromPartial(base ?? ({} as any));
+  },
+  fromPartial<I extends Exact<DeepPartial<RenderOperation>, I>>(object: I): RenderOperation {
+    const message = createBaseRenderOperation();
+    message.insert =
+      object.insert !== undefined && object.insert !== null
+        ? InsertNodeOperation.fromPartial(object.insert)
+        : undefined;
+    message.move =
+      object.move !== undefined && object.move !== null
+        ? MoveNodeOperation.fromPartial(object.move)
+        : undefined;
+    message.remove =
+      object.remove !== undefined && object.remove !== null
+        ? RemoveNodeOperation.fromPartial(object.remove)
+        : undefined;
+    message.update =
+      object.update !== undefined && object.update !== null
+        ? UpdateNodeOperation.fromPartial(object.update)
+        : undefined;
+    message.clear =
+      object.clear !== undefined && object.clear !== null
+        ? ClearNodeOperation.fromPartial(object.clear)
+        : undefined;
+    return message;
+  },
+};
+
 function createBaseThemedImageSource(): ThemedImageSource {
   return { light: "", dark: "" };
 }
@@ -58,16 +58,26 @@ export const getFrontmostApplication = async (): Promise<Application> => {
   return deserializeApp(res.data.app);
 };
 
+// the list is only sent again once the applications have been rescanned
+let cachedApplications: { generation: number; apps: Application[] } | undefined;
+
 export const getApplications = async (
   path?: PathLike,
 ): Promise<Application[]> => {
-  const res = await bus.turboRequest("app.list", {});
+  const res = await bus.turboRequest("app.list", {
+    knownGeneration: cachedApplications?.generation,
+  });
 
   if (!res.ok) return [];
 
-  console.log("got turbo apps", { apps: res.value });
+  if (!res.value.notModified || !cachedApplications) {
+    cachedApplications = {
+      generation: res.value.generation,
+      apps: res.value.apps.map(deserializeApp),
+    };
+  }
 
-  return [];
+  return [...cachedApplications.apps];
 };
 
 export const getDefaultApplication = async (
@@ -24,6 +24,11 @@ declare module "react" {
         navigationTitle?: string;
         onSearchTextChange?: HandlerId;
         onSelectionChange?: HandlerId;
+        pagination?: {
+          hasMore: boolean;
+          pageSize: number;
+          onLoadMore?: HandlerId;
+        };
       };
       "list-section": {
         title?: string;
@@ -55,6 +60,11 @@ declare module "react" {
         navigationTitle?: string;
         onSearchTextChange?: HandlerId;
         onSelectionChange?: HandlerId;
+        pagination?: {
+          hasMore: boolean;
+          pageSize: number;
+          onLoadMore?: HandlerId;
+        };
       };
       "grid-section": {
         inset?: Grid.Inset;
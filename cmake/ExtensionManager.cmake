@@ -3,6 +3,7 @@ include(ExtensionApi)
 
 set(EXT_MGR_SRC_DIR "${CMAKE_SOURCE_DIR}/extension-manager")
 set(EXT_MGR_OUT "${CMAKE_SOURCE_DIR}/vicinae/assets/extension-runtime.js")
+set(EXT_MGR_SNAPSHOT_OUT "${CMAKE_SOURCE_DIR}/vicinae/assets/extension-runtime.blob")
 set(EXT_PROTO_PATH "${CMAKE_SOURCE_DIR}/proto/extensions")
 set(EXT_PROTO_OUT "${EXT_MGR_SRC_DIR}/src/proto")
 
@@ -30,19 +31,22 @@ endforeach()
 file(MAKE_DIRECTORY ${EXT_PROTO_OUT})
 
 add_custom_command(
-    OUTPUT ${EXT_MGR_OUT}
+    OUTPUT ${EXT_MGR_OUT} ${EXT_MGR_SNAPSHOT_OUT}
     COMMAND npm install
 	COMMAND protobuf::protoc --plugin=./node_modules/.bin/protoc-gen-ts_proto -I ${protobuf_SOURCE_DIR}/src -I ${EXT_PROTO_PATH} ${EXT_PROTO_FILES} --ts_proto_out ${EXT_PROTO_OUT}
     COMMAND npm run build
     COMMAND ${CMAKE_COMMAND} -E copy
             ${EXT_MGR_SRC_DIR}/dist/runtime.js
             ${EXT_MGR_OUT}
+    COMMAND ${CMAKE_COMMAND} -E copy
+            ${EXT_MGR_SRC_DIR}/dist/runtime.blob
+            ${EXT_MGR_SNAPSHOT_OUT}
     WORKING_DIRECTORY ${EXT_MGR_SRC_DIR}
 	DEPENDS ${FILTERED_TS_FILES} ${API_OUT}
     COMMENT "Building extension manager JavaScript bundle"
 )
 
 add_custom_target(extension-manager ALL
-    DEPENDS api ${EXT_MGR_OUT}
+    DEPENDS api ${EXT_MGR_OUT} ${EXT_MGR_SNAPSHOT_OUT}
 )
 
@@ -1,9 +1,13 @@
 import * as esbuild from 'esbuild'
+import { execFileSync } from 'child_process';
 import { mkdirSync, rmSync } from 'fs'
 import { join } from 'path';
 
 const outDir = join(import.meta.dirname, '..', 'dist');
 const outFile = join(outDir, 'runtime.js');
+// V8 startup snapshot of the evaluated runtime, which the manager process starts from. It is only valid for
+// the node binary it is built with
+const snapshotFile = join(outDir, 'runtime.blob');
 
 rmSync(outDir, { recursive: true, force: true });
 mkdirSync(outDir, { recursive: true });
@@ -26,6 +30,10 @@ await esbuild.build({
 	}
 })
 
+console.log(`Building startup snapshot...`);
+
+execFileSync(process.execPath, ['--snapshot-blob', snapshotFile, '--build-snapshot', outFile], { stdio: 'inherit' });
+
 const end = performance.now();
 const buildTimeMs = end - start;
 
@@ -0,0 +1,83 @@
+import Module from 'module';
+import { mkdir, readFile, rename, stat, writeFile } from 'fs/promises';
+import { basename, dirname, join } from 'path';
+import * as vm from 'vm';
+
+// extension code compiled after this long is likely to be compiled on every run (rendering, hooks), so it
+// is worth including in the cache
+const CACHE_WRITE_DELAY_MS = 2000;
+
+type CacheKey = {
+	mtimeMs: number;
+	size: number;
+	node: string;
+};
+
+const isSameKey = (a: CacheKey, b: CacheKey) => {
+	return a.mtimeMs === b.mtimeMs && a.size === b.size && a.node === b.node;
+}
+
+/**
+ * Cache files start with a line holding the key of the bundle they were made from, the V8 code cache
+ * following it.
+ */
+const readCache = async (path: string, key: CacheKey): Promise<Buffer | undefined> => {
+	try {
+		const data = await readFile(path);
+		const headerEnd = data.indexOf(0x0a);
+
+		if (headerEnd == -1 || !isSameKey(JSON.parse(data.subarray(0, headerEnd).toString()), key)) return ;
+
+		return data.subarray(headerEnd + 1);
+	} catch (error) {
+		return ;
+	}
+}
+
+const writeCache = async (path: string, key: CacheKey, data: Buffer) => {
+	const tmpPath = `${path}.${process.pid}.tmp`;
+
+	await mkdir(dirname(path), { recursive: true });
+	await writeFile(tmpPath, Buffer.concat([Buffer.from(`${JSON.stringify(key)}\n`), data]));
+	await rename(tmpPath, path);
+}
+
+/**
+ * Load the CommonJS bundle at `entrypoint` the way require would, using the V8 code cache saved in
+ * `cacheDir` by a previous run so that it does not have to be compiled from scratch again.
+ * The cache is invalidated when the bundle changes, which is checked from its modification time and size.
+ * V8 makes sure on its own that the cache matches the source and the engine it is loaded in.
+ */
+export const loadCachedModule = async (entrypoint: string, cacheDir: string): Promise<any> => {
+	const importModuleDynamically = (vm as any).constants?.USE_MAIN_CONTEXT_DEFAULT_LOADER;
+
+	// without it the bundle could not use dynamic imports
+	if (!importModuleDynamically) return (await import(entrypoint)).default;
+
+	const cachePath = join(cacheDir, `${basename(entrypoint)}.cache`);
+	const [source, stats] = await Promise.all([readFile(entrypoint, 'utf8'), stat(entrypoint)]);
+	const key: CacheKey = { mtimeMs: stats.mtimeMs, size: stats.size, node: process.version };
+	const cachedData = await readCache(cachePath, key);
+	const script = new vm.Script(Module.wrap(source), {
+		filename: entrypoint,
+		cachedData,
+		importModuleDynamically,
+	});
+
+	const module = new Module(entrypoint);
+	const require = Module.createRequire(entrypoint);
+
+	module.filename = entrypoint;
+	script.runInThisContext().call(module.exports, module.exports, require, module, entrypoint, dirname(entrypoint));
+	module.loaded = true;
+
+	if (!cachedData || script.cachedDataRejected) {
+		setTimeout(() => {
+			writeCache(cachePath, key, script.createCachedData()).catch((error) => {
+				console.error(`Failed to write compile cache for ${entrypoint}`, error);
+			});
+		}, CACHE_WRITE_DELAY_MS).unref();
+	}
+
+	return module.exports;
+}
@@ -1,6 +1,9 @@
 import { randomUUID } from 'crypto';
-import { isMainThread, Worker } from "worker_threads";
+import { startupSnapshot } from "v8";
+import { isMainThread, ResourceLimits, Worker } from "worker_threads";
 import { main as workerMain } from './worker';
+import { CommandLaunch, WorkerPool } from './worker-pool';
+import { startWorker, WorkerMonitor } from './worker-monitor';
 import { isatty } from "tty";
 
 import * as ipc from './proto/ipc';
@@ -11,14 +14,68 @@ import { existsSync, mkdirSync } from 'fs';
 import { appendFile, mkdir } from 'fs/promises';
 import { join } from 'path';
 
+/**
+ * The runtime is evaluated at build time when it is made into a startup snapshot, so nothing depending on the
+ * environment it runs in can be computed before `main` is.
+ */
+const vicinaeVersion = () => ({
+	tag: process.env.VICINAE_VERSION ?? 'unknown',
+	commit: process.env.VICINAE_COMMIT ?? 'unknown',
+});
+
+// what workers run: __filename is where the snapshot was built when starting from one
+const runtimePath = () => process.argv[1];
+
+// idle workers kept around to run the next commands, see WorkerPool
+const DEFAULT_WORKER_POOL_SIZE = 1;
+const DEFAULT_WORKER_IDLE_TIMEOUT_S = 10 * 60;
+// heap caps of every worker, so that a leaking command gets terminated instead of growing the whole manager
+const DEFAULT_WORKER_MAX_HEAP_MB = 512;
+const DEFAULT_WORKER_MAX_YOUNG_HEAP_MB = 32;
+
+const envInteger = (name: string, fallback: number) => {
+	const value = Number.parseInt(process.env[name] ?? '');
+
+	return Number.isInteger(value) && value >= 0 ? value : fallback;
+}
+
+// 0 leaves the heap of workers as large as V8 lets it grow
+const workerResourceLimits = (): ResourceLimits => {
+	const maxOldGenerationSizeMb = envInteger('VICINAE_EXTENSION_WORKER_MAX_HEAP_MB', DEFAULT_WORKER_MAX_HEAP_MB);
+	const maxYoungGenerationSizeMb = Math.min(DEFAULT_WORKER_MAX_YOUNG_HEAP_MB, maxOldGenerationSizeMb);
+
+	if (maxOldGenerationSizeMb == 0) return {};
+
+	return { maxOldGenerationSizeMb, maxYoungGenerationSizeMb };
+}
+
 class Vicinae {
+	private readonly resourceLimits = workerResourceLimits();
+	private readonly workerPool = new WorkerPool(runtimePath(), {
+		size: envInteger('VICINAE_EXTENSION_WORKER_POOL_SIZE', DEFAULT_WORKER_POOL_SIZE),
+		idleTimeoutMs: envInteger('VICINAE_EXTENSION_WORKER_IDLE_TIMEOUT', DEFAULT_WORKER_IDLE_TIMEOUT_S) * 1000,
+		env: {
+			'NODE_ENV': 'production',
+			'RECONCILER_TRACE': process.env.RECONCILER_TRACE,
+			'NODE_COMPILE_CACHE': process.env.NODE_COMPILE_CACHE,
+		},
+		resourceLimits: this.resourceLimits,
+	});
 	private readonly workerMap = new Map<string, Worker>;
+	private readonly monitors = new WeakMap<Worker, WorkerMonitor>;
 	private readonly requestMap = new Map<string, Worker>;
 	private currentMessage: { data: Buffer }= {
 		data: Buffer.from(''),
 	};
 
 	private formatError(error: Error) {
+		const limit = this.resourceLimits.maxOldGenerationSizeMb;
+
+		if ((error as NodeJS.ErrnoException).code == 'ERR_WORKER_OUT_OF_MEMORY' && limit) {
+			return `The command ran out of memory and was terminated, its heap being limited to ${limit}MB.\n` +
+				`The limit can be raised with the VICINAE_EXTENSION_WORKER_MAX_HEAP_MB environment variable.\n\n${error.stack}`;
+		}
+
 		return `${error.stack}`;
 	}
 
@@ -47,41 +104,53 @@ class Vicinae {
 		return ipc.IpcMessage.decode(packet);
 	}
 
+	private async commandLaunch(command: manager.ManagerLoadCommand | manager.ManagerPrewarmCommand,
+								argumentValues: Record<string, any>): Promise<CommandLaunch> {
+		const supportPath = join(command.extensionPath, "support");
+		const assetsPath = join(command.extensionPath, "assets");
+
+		await Promise.all([
+			mkdir(supportPath, { recursive: true }),
+			mkdir(assetsPath, { recursive: true })
+		]);
+
+		return {
+			entrypoint: command.entrypoint,
+			preferenceValues: command.preferenceValues,
+			launchProps: { arguments: argumentValues },
+			commandMode: command.mode == manager.CommandMode.View ? "view" : "no-view",
+			supportPath,
+			assetsPath,
+			vicinaeVersion: vicinaeVersion(),
+		};
+	}
+
 	private async handleManagerRequest(request: ipc.ManagerRequest) {
 		if (request.payload?.load) {
 			const load = request.payload.load;
 			const sessionId = randomUUID();
-			const supportPath = join(load.extensionPath, "support");
-			const assetsPath = join(load.extensionPath, "assets");
-
-			await Promise.all([
-				mkdir(supportPath, { recursive: true }),
-				mkdir(assetsPath, { recursive: true })
-			]);
-
-			const worker = new Worker(__filename, {
-				workerData: {
-					// the transpiled JS file to execute
-					entrypoint: load.entrypoint,
-					preferenceValues: load.preferenceValues,
-					launchProps: { arguments: load.argumentValues },
-					commandMode: load.mode == manager.CommandMode.View ? "view" : "no-view",
-					supportPath,
-					assetsPath,
-					vicinaeVersion: {
-						tag: process.env.VICINAE_VERSION ?? 'unknown',
-						commit: process.env.VICINAE_COMMIT ?? 'unknown',
-					}
-				},
+			const launch = await this.commandLaunch(load, load.argumentValues);
+			const channelPath = process.env.VICINAE_EXTENSION_CHANNEL;
 
+			if (channelPath && load.channelToken) {
+				launch.channel = { path: channelPath, sessionId, token: load.channelToken };
+			}
+
+			// the pool only holds production workers, as React picks its build when the runtime is evaluated
+			const isDevelopment = load.env == manager.CommandEnv.Development;
+			const { worker, monitor } = (!isDevelopment && this.workerPool.acquire(launch)) || startWorker(runtimePath(), {
+				workerData: launch,
 				stdout: true,
 				env: {
-					'NODE_ENV': load.env == manager.CommandEnv.Development ? 'development' : 'production',
+					'NODE_ENV': isDevelopment ? 'development' : 'production',
 					'RECONCILER_TRACE': process.env.RECONCILER_TRACE,
-				}
+					'NODE_COMPILE_CACHE': process.env.NODE_COMPILE_CACHE,
+				},
+				resourceLimits: this.resourceLimits,
 			});
 
 			this.workerMap.set(sessionId, worker);
+			this.monitors.set(worker, monitor);
 			
 			worker.on('messageerror', (error) => {
 				console.error(error);
@@ -100,7 +169,7 @@ class Vicinae {
 
 			worker.on('message', (buf: Buffer) => {
 				try {
-					const { event, request } = ipc.ExtensionMessage.decode(buf);
+					const { event, request, timing } = ipc.ExtensionMessage.decode(buf);
 
 					/**
 					 * Here we qualify the request or event by appending to it the runtime session id
@@ -110,7 +179,7 @@ class Vicinae {
 					if (request) {
 						//console.error('request of type', JSON.stringify(request, null, 2));
 						this.requestMap.set(request.requestId, worker);
-						this.writeMessage({ extensionRequest: { sessionId, request } });
+						this.writeMessage({ extensionRequest: { sessionId, request, timing } });
 						return ;
 					}
 
@@ -156,6 +225,13 @@ class Vicinae {
 			return this.respond(request.requestId, { load: { sessionId } });
 		}
 
+		// sent for the command selected in the root search, launching it is likely to follow
+		if (request.payload?.prewarm) {
+			this.workerPool.speculate(await this.commandLaunch(request.payload.prewarm, {}));
+
+			return this.respond(request.requestId, { ack: {} });
+		}
+
 		if (request.payload?.unload) {
 			const { sessionId } = request.payload.unload;
 			const worker = this.workerMap.get(sessionId);
@@ -173,6 +249,16 @@ class Vicinae {
 
 		}
 
+		if (request.payload?.stats) {
+			const workers = [...this.workerMap].flatMap(([sessionId, worker]) => {
+				const monitor = this.monitors.get(worker);
+
+				return monitor ? [monitor.stats(sessionId)] : [];
+			});
+
+			return this.respond(request.requestId, { stats: { workers, idleWorkerCount: this.workerPool.idleCount } });
+		}
+
 		return this.respondError(request.requestId, { errorText: "No handler configured for this command" });
 	}
 
@@ -227,11 +313,12 @@ class Vicinae {
 			throw new Error(`${error}`);
 		});
 		process.stdin.on('data', (buf) => this.handleRead(buf));
+		this.workerPool.fill();
 	}
 };
 
 const main = async () => {
-	if (!isMainThread) workerMain();
+	if (!isMainThread) return workerMain();
 
 	if (isatty(process.stdout.fd)) {
 		console.error('Running the extension manager from a TTY is not supported.');
@@ -241,4 +328,8 @@ const main = async () => {
 	const vicinae = new Vicinae()
 }
 
-main();
+if (startupSnapshot.isBuildingSnapshot()) {
+	startupSnapshot.setDeserializeMainFunction(main);
+} else {
+	main();
+}
@@ -1,5 +1,5 @@
 import Reconciler, { OpaqueRoot } from 'react-reconciler';
-import { setTimeout, clearTimeout } from 'node:timers';
+import { setTimeout, clearTimeout, setImmediate } from 'node:timers';
 import { DefaultEventPriority } from 'react-reconciler/constants';
 import React, { ReactElement } from 'react';
 import { isDeepEqual } from './utils';
@@ -16,7 +16,7 @@ type LinkNode = {
 class ChildList {
 	private m_size: number = 0;
 	private m_front: LinkNode | null = null;
-	private m_indexMap = new Map<Symbol, LinkNode>;
+	private m_indexMap = new Map<number, LinkNode>;
 	private m_rear: LinkNode | null = null;
 
 	insertBefore(before: Instance, data: Instance) {
@@ -112,11 +112,11 @@ class ChildList {
 type InstanceType = string;
 type InstanceProps = Record<string, any>;
 type Instance = {
-	id: Symbol,
+	id: number,
 	type: InstanceType,
 	props: InstanceProps;
-	dirty: boolean;
-	propsDirty: boolean;
+	// whether the host knows about this instance, i.e. it was sent as part of an insert operation
+	mounted: boolean;
 	parent?: Instance;
 	children: Instance[];
 };
@@ -134,13 +134,80 @@ type NoTimeout = number;
 const ctx: HostContext = {
 };
 
-const emitDirty = (instance?: Instance) => {
-	let current: Instance | undefined = instance;
+/**
+ * Changes made to the mounted tree, sent to the host after every commit instead of the whole tree.
+ * The host keeps its own copy of the tree, to which it applies them in order (see RetainedRenderTree).
+ * Instances are only referred to by their id, the container always being 0.
+ * Shaped after the RenderOperation protobuf message.
+ */
+export type RenderOp =
+	| { insert: { parent: number, before?: number, node: SerializedInstance } }
+	| { move: { parent: number, id: number, before?: number } }
+	| { remove: { parent: number, id: number } }
+	| { update: { id: number, props: InstanceProps } }
+	| { clear: { id: number } };
+
+/**
+ * Operations waiting to be sent to the host. Updates only ever carry the full props of an instance, so an
+ * instance updated several times before a frame is sent only needs its last update.
+ */
+class RenderQueue {
+	private m_ops: RenderOp[] = [];
+	private m_updates = new Map<number, { update: { id: number, props: InstanceProps } }>();
+
+	push(op: RenderOp) { this.m_ops.push(op); }
+
+	update(id: number, props: InstanceProps) {
+		const pending = this.m_updates.get(id);
+
+		if (pending) {
+			pending.update.props = props;
+			return ;
+		}
+
+		const op = { update: { id, props } };
+
+		this.m_updates.set(id, op);
+		this.m_ops.push(op);
+	}
+
+	size() { return this.m_ops.length; }
+
+	take(): RenderOp[] {
+		this.m_updates.clear();
+		return this.m_ops.splice(0);
+	}
+};
+
+type SerializedInstance = {
+	id: number;
+	type: string;
+	props: InstanceProps;
+	children: SerializedInstance[];
+};
+
+const serializeInstance = (instance: Instance): SerializedInstance => {
+	const obj: SerializedInstance = {
+		id: instance.id,
+		type: instance.type,
+		props: instance.props,
+		children: new Array<SerializedInstance>(instance.children.length)
+	};
+
+	let i = 0;
+
+	for (const child of instance.children) {
+		obj.children[i++] = serializeInstance(child);
+	}
+	
+	return obj;
+}
+
+const setMounted = (instance: Instance, mounted: boolean) => {
+	instance.mounted = mounted;
 
-	//while (current && !current.dirty) {
-	while (current) {
-		current.dirty = true;
-		current = current.parent;
+	for (const child of instance.children) {
+		setMounted(child, mounted);
 	}
 }
 
@@ -156,6 +223,44 @@ function traceWrap(hostConfig: any) {
   return traceWrappedHostConfig;
 }
 
+/**
+ * Props are sent as protobuf values, which only hold what JSON can. Values are converted the way
+ * JSON.stringify would: toJSON is honored (dates become strings), unsupported values are dropped
+ * from objects and become null in arrays.
+ */
+const toPlainValue = (value: any): any => {
+	if (value === null) return null;
+	if (typeof value?.toJSON === 'function') value = value.toJSON();
+
+	switch (typeof value) {
+		case 'string':
+		case 'boolean':
+			return value;
+		case 'number':
+			return Number.isFinite(value) ? value : null;
+		case 'object':
+			break;
+		default:
+			return undefined;
+	}
+
+	if (value === null) return null;
+
+	if (Array.isArray(value)) {
+		return value.map((item) => toPlainValue(item) ?? null);
+	}
+
+	const obj: Record<string, any> = {};
+
+	for (const key of Object.keys(value)) {
+		const item = toPlainValue(value[key]);
+
+		if (item !== undefined) obj[key] = item;
+	}
+
+	return obj;
+}
+
 const sanitizeProps = (props: Record<string, any>): Record<string, any> => {
 	const sanitized: Record<string, any> = {};
 
@@ -163,14 +268,34 @@ const sanitizeProps = (props: Record<string, any>): Record<string, any> => {
 		if (React.isValidElement(props[key])) {
 			console.error(`React element in props is ignored for key ${key}`);
 		} else if (key !== 'children') {
-			sanitized[key] = props[key];
+			const value = toPlainValue(props[key]);
+
+			if (value !== undefined) sanitized[key] = value;
 		}
 	}
 
 	return sanitized;
 }
 
-const createHostConfig = (hostCtx: HostContext, callback: () => void) => {
+const createHostConfig = (hostCtx: HostContext, ops: RenderQueue, callback: () => void) => {
+	let nextId = 1;
+
+	/**
+	 * Record the placement of `child` in `parent`, which is only needed if the host knows about `parent`.
+	 * Children of instances that are not mounted yet are sent along with them.
+	 */
+	const recordPlacement = (parent: Instance, child: Instance, before: Instance | null) => {
+		if (!parent.mounted) return ;
+
+		if (child.mounted) {
+			ops.push({ move: { parent: parent.id, id: child.id, before: before?.id } });
+			return ;
+		}
+
+		ops.push({ insert: { parent: parent.id, before: before?.id, node: serializeInstance(child) } });
+		setMounted(child, true);
+	}
+
 	const hostConfig: Reconciler.HostConfig<
 		InstanceType,
 		InstanceProps,
@@ -194,12 +319,11 @@ const createHostConfig = (hostCtx: HostContext, callback: () => void) => {
 			let { children, key, ...rest } = props;
 
 			return {
-				id: Symbol(type),
+				id: nextId++,
 				type,
 				props: sanitizeProps(rest),
 				children: [],
-				dirty: true,
-				propsDirty: true,
+				mounted: false,
 			}
 		},
 
@@ -302,8 +426,8 @@ const createHostConfig = (hostCtx: HostContext, callback: () => void) => {
 			}	
 
 			child.parent = parent;
-			emitDirty(parent);
 			parent.children.push(child);
+			recordPlacement(parent, child, null);
 		},
 
 		appendChildToContainer(container: Instance, child: Instance) {
@@ -323,7 +447,7 @@ const createHostConfig = (hostCtx: HostContext, callback: () => void) => {
 			if (beforeIndex != -1) {
 				parent.children.splice(beforeIndex, 0, child);
 				child.parent = parent;
-				emitDirty(parent);
+				recordPlacement(parent, child, beforeChild);
 			} else {
 				throw new Error('Unreachable');
 			}
@@ -334,10 +458,15 @@ const createHostConfig = (hostCtx: HostContext, callback: () => void) => {
 		},
 
 		removeChild(parent: Instance, child: Instance) {
-			emitDirty(parent);
 			const idx = parent.children.indexOf(child);
 			parent.children.splice(idx, 1);
 			delete child.parent;
+
+			if (parent.mounted) {
+				ops.push({ remove: { parent: parent.id, id: child.id } });
+			}
+
+			setMounted(child, false);
 		},
 
 		removeChildFromContainer(container: Instance, child: Instance) {
@@ -351,24 +480,12 @@ const createHostConfig = (hostCtx: HostContext, callback: () => void) => {
 		commitMount() {},
 
 		commitUpdate(instance: Instance, payload, type, prevProps, nextProps, handle) {
-			let i = 0;
-			
-			if (payload.length > 0) {
-				instance.propsDirty = true;
-				emitDirty(instance.parent);
-			}
-
-
 			instance.props = sanitizeProps(nextProps);
 
-			/*
-			while (i < payload.length) {
-				const key = payload[i++];
-				const value = payload[i++];
-
-				instance.props[key] = value;
+			// props removed from the element are not part of the payload, so they are always sent in full
+			if (payload.length > 0 && instance.mounted) {
+				ops.update(instance.id, instance.props);
 			}
-			*/
 		},
 
 		replaceContainerChildren() {
@@ -383,105 +500,84 @@ const createHostConfig = (hostCtx: HostContext, callback: () => void) => {
 		unhideTextInstance() {},
 
 		clearContainer(container) {
+			for (const child of container.children) {
+				setMounted(child, false);
+			}
+
 			container.children = [];
+			ops.push({ clear: { id: container.id } });
 		},
 	};
 
 	return hostConfig;
 }
 
-export type ViewData = {
-	root: SerializedInstance;
-};
-
 export type RendererConfig = {
 	maxRendersPerSecond?: number,
-	onInitialRender: (views: ViewData[]) => void
-	onUpdate?: (views: ViewData[]) => void;
-};
-
-type SerializedInstance = {
-	props: InstanceProps;
-	type: string;
-	dirty: boolean;
-	propsDirty: boolean;
-	children: SerializedInstance[];
+	/**
+	 * Send a frame to the host, resolving once the host is done with it.
+	 */
+	onUpdate: (ops: RenderOp[]) => Promise<unknown>;
 };
 
-const serializeInstance = (instance: Instance): SerializedInstance => {
-	const obj: SerializedInstance = {
-		props: instance.props,
-		type: instance.type,
-		dirty: instance.dirty,
-		propsDirty: instance.propsDirty,
-		children: new Array<SerializedInstance>(instance.children.length)
-	};
-
-	instance.dirty = false;
-	instance.propsDirty = false;
-
-	let i = 0;
-
-	for (const child of instance.children) {
-		obj.children[i++] = serializeInstance(child);
-	}
-	
-	return obj;
-}
-
 const createContainer = (): Container => {
 	return {
-		id: Symbol('root'),
+		id: 0,
 		type: 'root',
-		dirty: true,
-		propsDirty: false,
+		mounted: true,
 		props: {},
 		children: []
 	}
 }
 
-const MAX_RENDER_PER_SECOND = 60;
+// frames sent to the host and not acknowledged yet, past which commits are coalesced into the next frame
+const MAX_FRAMES_IN_FLIGHT = 2;
 
+/**
+ * Frames are sent as soon as the host is able to take them, so that the first commit following some input
+ * is painted right away. Commits made while the host is busy are coalesced until it acknowledges one of the
+ * frames in flight, which paces continuous updates to the speed at which the host renders them.
+ * Nothing is sent while the view is hidden, the changes being sent as a single frame once it is shown again.
+ */
 export const createRenderer = (config: RendererConfig) => {
 	const container = createContainer(); 
-	let debounce: NodeJS.Timer | null = null;
-	// 60 renders per second at most
-	let debounceInterval = 1000 / MAX_RENDER_PER_SECOND;
-	let lastRender = performance.now();
-
-	const renderImpl = () => {
-		if (!debounce) {
-			debounce = setTimeout(() => {
-				debounce = null;
-
-				const start = performance.now();
-				const views: ViewData[] = [];
-				const root = serializeInstance(container);
+	const ops = new RenderQueue();
+	const minInterval = config.maxRendersPerSecond ? 1000 / config.maxRendersPerSecond : 0;
+	let framesInFlight = 0;
+	let visible = true;
+	let scheduled = false;
+	let lastRender = 0;
 
+	const flush = () => {
+		scheduled = false;
 
-				//writeFileSync('/tmp/render.txt', `${inspect(root, { depth: null, colors: true })}`);
-				//appendFileSync('/tmp/render.txt', JSON.stringify(root, null, 2));
+		if (!visible || framesInFlight >= MAX_FRAMES_IN_FLIGHT || ops.size() == 0) return ;
 
-				for (let i = 0; i != root.children.length; ++i) {
-					const view = root.children[i];
+		const wait = lastRender + minInterval - performance.now();
 
-					views.push({ root: view });
-				}
-
-				//console.error(JSON.stringify({ views }, null, 2));
+		if (wait > 0) {
+			scheduled = true;
+			setTimeout(flush, wait);
+			return ;
+		}
 
-				config.onUpdate?.(views)
+		++framesInFlight;
+		lastRender = performance.now();
+		config.onUpdate(ops.take()).finally(() => {
+			--framesInFlight;
+			renderImpl();
+		});
+	}
 
-				const end = performance.now();
+	const renderImpl = () => {
+		if (scheduled) return ;
 
-				//console.error(`[PERF] processed render frame in ${end - start}ms`);
-				///console.error(`[PERF] last render ${end - lastRender}ms`);
-				lastRender = end;
-			}, debounceInterval);
-		}
+		scheduled = true;
+		// commits made from the same task are sent together
+		setImmediate(flush);
 	}
 
-	const hostConfig = createHostConfig({}, renderImpl);
+	const hostConfig = createHostConfig({}, ops, renderImpl);
 	const reconciler = Reconciler(process.env.RECONCILER_TRACE === '1' ? traceWrap(hostConfig) : hostConfig);
 
 	return {
@@ -491,6 +587,11 @@ export const createRenderer = (config: RendererConfig) => {
 			}
 
 			reconciler.updateContainer(element, container._root, null, renderImpl);
+		},
+
+		setVisible(value: boolean) {
+			visible = value;
+			if (visible) renderImpl();
 		}
 	}
 }
@@ -0,0 +1,86 @@
+import { EventLoopUtilization } from "perf_hooks";
+import { getHeapStatistics } from "v8";
+import { MessageChannel, MessagePort, Worker, WorkerOptions } from "worker_threads";
+import * as manager from './proto/manager';
+
+// how often workers sample the size of their heap
+const HEAP_SAMPLE_INTERVAL_MS = 5000;
+
+type HeapSample = {
+	used: number;
+	total: number;
+	limit: number;
+};
+
+/**
+ * Worker side of the monitor: sample the heap of the worker on `port` for as long as it runs.
+ *
+ * The heap of a worker can only be read from the thread it belongs to, its event loop utilization is read by
+ * the manager directly.
+ */
+export const reportHeapUsage = (port: MessagePort) => {
+	const sample = () => {
+		const { used_heap_size, total_heap_size, heap_size_limit } = getHeapStatistics();
+		const heap: HeapSample = { used: used_heap_size, total: total_heap_size, limit: heap_size_limit };
+
+		port.postMessage(heap);
+	};
+
+	sample();
+	// sampling must not keep a command that is done from exiting
+	setInterval(sample, HEAP_SAMPLE_INTERVAL_MS).unref();
+	port.unref();
+}
+
+/**
+ * Resources used by a worker, started with `startWorker`.
+ */
+export class WorkerMonitor {
+	private heap: HeapSample = { used: 0, total: 0, limit: 0 };
+	private peakHeapUsed = 0;
+	private lastUtilization: EventLoopUtilization | undefined;
+	private readonly startedAt = Date.now();
+
+	constructor(private readonly worker: Worker, port: MessagePort) {
+		port.on('message', (heap: HeapSample) => {
+			this.heap = heap;
+			this.peakHeapUsed = Math.max(this.peakHeapUsed, heap.used);
+		});
+		port.unref();
+		worker.once('exit', () => port.close());
+	}
+
+	stats(sessionId: string): manager.WorkerStats {
+		const total = this.worker.performance.eventLoopUtilization();
+		const recent = this.lastUtilization
+			? this.worker.performance.eventLoopUtilization(total, this.lastUtilization)
+			: total;
+
+		this.lastUtilization = total;
+
+		return {
+			sessionId,
+			heapUsed: this.heap.used,
+			heapTotal: this.heap.total,
+			peakHeapUsed: this.peakHeapUsed,
+			heapLimit: this.heap.limit,
+			activeMs: total.active,
+			utilization: recent.utilization,
+			uptimeMs: Date.now() - this.startedAt,
+		};
+	}
+};
+
+/**
+ * Start a worker that reports its heap usage to the returned monitor (see worker.tsx).
+ */
+export const startWorker = (filename: string, options: WorkerOptions) => {
+	const { port1, port2 } = new MessageChannel();
+	const worker = new Worker(filename, {
+		...options,
+		workerData: { ...options.workerData, statsPort: port2 },
+		transferList: [...(options.transferList ?? []), port2],
+	});
+
+	return { worker, monitor: new WorkerMonitor(worker, port1) };
+}
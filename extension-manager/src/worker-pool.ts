@@ -0,0 +1,197 @@
+import { MessageChannel, MessagePort, ResourceLimits, Worker } from "worker_threads";
+import { startWorker, WorkerMonitor } from "./worker-monitor";
+
+/**
+ * What a worker needs to know to run a command, passed to it as its workerData.
+ */
+export type CommandLaunch = {
+	// the transpiled JS file to execute
+	entrypoint: string;
+	preferenceValues: Record<string, any>;
+	launchProps: Record<string, any>;
+	commandMode: 'view' | 'no-view';
+	supportPath: string;
+	assetsPath: string;
+	vicinaeVersion: { tag: string, commit: string };
+	// where the worker opens its channel to vicinae, its messages are relayed by the manager without one
+	channel?: { path: string, sessionId: string, token: string };
+};
+
+/**
+ * Sent to a pooled worker over its launch port. A worker can be told to preload a command before it is
+ * launched, in which case the launch is expected to be for that same command.
+ */
+export type LaunchMessage = {
+	kind: 'preload' | 'launch';
+	launch: CommandLaunch;
+};
+
+// commands preloaded at once, the oldest speculation is discarded to make room for a new one
+const MAX_SPECULATIONS = 2;
+// a command that was not launched after being preloaded for that long is not going to be
+const SPECULATION_TIMEOUT_MS = 30 * 1000;
+
+type IdleWorker = {
+	worker: Worker;
+	monitor: WorkerMonitor;
+	launchPort: MessagePort;
+	recycleTimer: NodeJS.Timeout | undefined;
+	onExit: () => void;
+	onError: (error: Error) => void;
+};
+
+type Speculation = {
+	idle: IdleWorker;
+	launch: CommandLaunch;
+	expiryTimer: NodeJS.Timeout;
+};
+
+// whether a worker that preloaded `preloaded` can run `launch`, which only adds the arguments to it
+const isSameCommand = (preloaded: CommandLaunch, launch: CommandLaunch) => {
+	return preloaded.entrypoint === launch.entrypoint &&
+		preloaded.commandMode === launch.commandMode &&
+		JSON.stringify(preloaded.preferenceValues) === JSON.stringify(launch.preferenceValues);
+}
+
+export type PoolOptions = {
+	size: number;
+	// idle workers are terminated once they waited that long for a command, 0 to keep them forever
+	idleTimeoutMs: number;
+	env: Record<string, string | undefined>;
+	resourceLimits: ResourceLimits;
+};
+
+/**
+ * Workers started ahead of time, with the runtime (React, the reconciler and the API) already evaluated, which
+ * is what most of the startup time of a worker goes into. They wait for a command to be sent to them over their
+ * launch port (see worker.tsx).
+ *
+ * Workers are not reused once they ran a command, which is free to alter the global state of the worker it
+ * runs in: the pool is topped up with a fresh one every time a worker is handed out instead.
+ *
+ * Workers left idle for `idleTimeoutMs` are terminated to give their memory back, as nothing was launched for
+ * a while. The pool is filled again on the next launch.
+ *
+ * A command that is likely to be launched soon can also be speculatively preloaded (see `speculate`): it
+ * gets a worker of its own that evaluates its bundle right away, so that launching it only has to render it.
+ */
+export class WorkerPool {
+	private readonly idle: IdleWorker[] = [];
+	private readonly speculations: Speculation[] = [];
+
+	constructor(
+		private readonly filename: string,
+		private readonly options: PoolOptions
+	) {}
+
+	get idleCount() {
+		return this.idle.length;
+	}
+
+	fill() {
+		while (this.idle.length < this.options.size) {
+			this.idle.push(this.spawn());
+		}
+	}
+
+	/**
+	 * Preload the command of `launch` in a worker of its own, ahead of it being launched. Unused speculations
+	 * are terminated after a while, or to make room for newer ones.
+	 */
+	speculate(launch: CommandLaunch) {
+		if (this.speculations.some((speculation) => isSameCommand(speculation.launch, launch))) return ;
+
+		const idle = this.idle.shift() ?? this.spawn();
+		const expiryTimer = setTimeout(() => this.discard(idle.worker), SPECULATION_TIMEOUT_MS).unref();
+		const message: LaunchMessage = { kind: 'preload', launch };
+
+		setImmediate(() => this.fill());
+		clearTimeout(idle.recycleTimer);
+		idle.launchPort.postMessage(message);
+		this.speculations.push({ idle, launch, expiryTimer });
+
+		while (this.speculations.length > MAX_SPECULATIONS) {
+			this.discard(this.speculations[0].idle.worker);
+		}
+	}
+
+	/**
+	 * Hand `launch` to the worker that preloaded it, or to an idle worker, returning it. Nothing is returned if
+	 * the pool is empty.
+	 */
+	acquire(launch: CommandLaunch): { worker: Worker, monitor: WorkerMonitor } | null {
+		const speculationIndex = this.speculations.findIndex((speculation) => {
+			return isSameCommand(speculation.launch, launch);
+		});
+		let idle: IdleWorker | undefined;
+
+		if (speculationIndex != -1) {
+			const [speculation] = this.speculations.splice(speculationIndex, 1);
+
+			clearTimeout(speculation.expiryTimer);
+			idle = speculation.idle;
+		} else {
+			idle = this.idle.shift();
+			setImmediate(() => this.fill());
+		}
+
+		if (!idle) return null;
+
+		const { worker, monitor, launchPort, recycleTimer, onExit, onError } = idle;
+		const message: LaunchMessage = { kind: 'launch', launch };
+
+		clearTimeout(recycleTimer);
+		worker.off('exit', onExit);
+		worker.off('error', onError);
+		worker.ref();
+		launchPort.postMessage(message);
+
+		return { worker, monitor };
+	}
+
+	private discard(worker: Worker) {
+		const index = this.speculations.findIndex((speculation) => speculation.idle.worker === worker);
+
+		if (index == -1) return ;
+
+		const [speculation] = this.speculations.splice(index, 1);
+
+		clearTimeout(speculation.expiryTimer);
+		worker.terminate();
+	}
+
+	private spawn(): IdleWorker {
+		const { port1, port2 } = new MessageChannel();
+		const { worker, monitor } = startWorker(this.filename, {
+			workerData: { launchPort: port2 },
+			transferList: [port2],
+			stdout: true,
+			env: this.options.env,
+			resourceLimits: this.options.resourceLimits,
+		});
+		const recycleTimer = this.options.idleTimeoutMs > 0
+			? setTimeout(() => worker.terminate(), this.options.idleTimeoutMs).unref()
+			: undefined;
+
+		// idle workers must not keep the manager alive. One that dies is only replaced on the next launch,
+		// so that a worker failing to start is not respawned in a loop
+		const onExit = () => {
+			const index = this.idle.findIndex((idle) => idle.worker === worker);
+
+			if (index != -1) this.idle.splice(index, 1);
+			this.discard(worker);
+			clearTimeout(recycleTimer);
+			port1.close();
+		};
+
+		const onError = (error: Error) => {
+			console.error(`idle worker error: ${error.name}:${error.message}`);
+		};
+
+		worker.unref();
+		worker.once('exit', onExit);
+		worker.on('error', onError);
+
+		return { worker, monitor, launchPort: port1, recycleTimer, onExit, onError };
+	}
+};
@@ -1,9 +1,13 @@
-import { parentPort, workerData } from "worker_threads";
+import { MessagePort, parentPort, workerData } from "worker_threads";
 import { createRenderer } from './reconciler';
 import { LaunchType, NavigationProvider, bus, environment } from '@vicinae/api';
 import { ComponentType, ReactNode, Suspense } from "react";
 import * as React from 'react';
 import { patchRequire } from "./patch-require";
+import { loadCachedModule } from "./compile-cache";
+import { join } from "path";
+import { reportHeapUsage } from "./worker-monitor";
+import type { LaunchMessage } from "./worker-pool";
 
 class ErrorBoundary extends React.Component<{ children: ReactNode }, { error: string }> {
   constructor(props: { children: ReactNode }) {
@@ -52,33 +56,37 @@ const loadEnviron = () => {
 	environment.vicinaeVersion = vicinaeVersion;
 }
 
+let commandModule: Promise<any> | undefined;
+
+// the code cache of the command, kept with the extension as it is only valid for its bundle. The module may
+// already be loading if the command was preloaded
+const loadCommandModule = () => {
+	commandModule ??= loadCachedModule(workerData.entrypoint, join(workerData.supportPath, '.compile-cache'));
+
+	return commandModule;
+}
+
 const loadView = async () => {
-	const module = await import(workerData.entrypoint);
-	const Component = module.default.default;
+	const module = await loadCommandModule();
+	const Component = module.default;
 
 	process.on('uncaughtException', (error) => {
 		console.error('uncaught exception:', error);
 	});
 
-	let lastRender = performance.now();
-
 	const renderer = createRenderer({
-		onInitialRender: (views) => {
-			bus.turboRequest('ui.render', { json: JSON.stringify({ views }) });
-		},
-		onUpdate: (views) => {
-			const now = performance.now();
-			lastRender = now;
-			bus.turboRequest('ui.render', { json: JSON.stringify({ views }) });
-		}
+		// acknowledged once the frame is rendered, or dropped in favor of a newer one
+		onUpdate: (ops) => bus.turboRequest('ui.render', { ops })
 	});
 
+	bus.subscribe('view-visibility', (visible) => renderer.setVisible(visible === true));
+
 	renderer.render(<App launchProps={workerData.launchProps} component={Component} />);
 }
 
 const loadNoView = async () => {
-	const module = await import(workerData.entrypoint);
-	const entrypoint = module.default.default;
+	const module = await loadCommandModule();
+	const entrypoint = module.default;
 
 	if (typeof entrypoint !== 'function') {
 		throw new Error(`no-view command does not export a function as its default export`);
@@ -87,13 +95,59 @@ const loadNoView = async () => {
 	await entrypoint(workerData.launchProps);
 }
 
+/**
+ * Pooled workers are started before knowing which command they are going to run, which is sent to them over
+ * their launch port (see WorkerPool). The API reads the command from workerData, so that is where it goes.
+ *
+ * A command can be preloaded before it is launched: its bundle is then evaluated while waiting for the
+ * launch, errors only being reported once it is launched.
+ */
+const waitForLaunch = async () => {
+	const launchPort: MessagePort | undefined = workerData.launchPort;
+
+	if (!launchPort) return ;
+
+	while (true) {
+		const { kind, launch } = await new Promise<LaunchMessage>((resolve) => launchPort.once('message', resolve));
+
+		Object.assign(workerData, launch);
+
+		if (kind == 'launch') break ;
+
+		loadEnviron();
+		loadCommandModule().catch(() => {});
+	}
+
+	launchPort.close();
+	delete workerData.launchPort;
+}
+
+/**
+ * Talk to vicinae directly, so that the messages of the command do not wait on those of every other command
+ * in the main thread of the manager. They keep going through the manager if the channel cannot be opened.
+ */
+const openChannel = async () => {
+	const { channel } = workerData;
+
+	if (!channel) return ;
+
+	delete workerData.channel;
+	await bus.openChannel(channel.path, channel.sessionId, channel.token);
+}
+
 export const main = async () => {
 	if (!parentPort) {
 		console.error(`Unable to get workerData. Is this code running inside a NodeJS worker? Manually invoking this runtime is not supported.`)
 		return ;
 	}
 
+	// not something the command gets to see
+	reportHeapUsage(workerData.statsPort);
+	delete workerData.statsPort;
+
 	patchRequire();
+	await waitForLaunch();
+	await openChannel();
 	loadEnviron();
 
 	(process as any).noDeprecation = !environment.isDevelopment;
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""
+Benchmark of the file indexer full text indexes: index size and query latency of prefix searches
+(unicode61 index) and substring searches (optional trigram index) on a synthetic corpus.
+
+The schema is read from the file-indexer migrations. The rank expression is a simplified version of the
+one built by RelevancyScorer, which is what dominates query time.
+
+Usage: ./bench-file-index.py [--files 1000000] [--runs 5] [--db /tmp/file-index-bench.db]
+"""
+
+import argparse
+import os
+import random
+import sqlite3
+import statistics
+import time
+from pathlib import Path
+
+MIGRATIONS_DIR = Path(__file__).resolve().parent.parent / "vicinae/database/file-indexer/migrations"
+
+# must stay in sync with file-indexer-db.cpp
+SUBSTRING_INDEX = [
+    """CREATE VIRTUAL TABLE IF NOT EXISTS trigram_idx USING fts5(
+	name, content=indexed_file, tokenize='trigram'
+)""",
+    "INSERT INTO trigram_idx(trigram_idx) VALUES('rebuild')",
+]
+
+# (user query, prefix expression, substring expression)
+QUERIES = [
+    ("conf", '"conf"*', '"conf"'),
+    ("report 2023", '"report" "2023"*', '"report" "2023"'),
+    ("invoice", '"invoice"*', '"invoice"'),
+    ("shot", '"shot"*', '"shot"'),
+    ("ailwind", '"ailwind"*', '"ailwind"'),
+    ("test spec", '"test" "spec"*', '"test" "spec"'),
+]
+
+WORDS = [
+    "config", "report", "invoice", "screenshot", "backup", "project", "notes", "draft", "final", "tailwind",
+    "index", "main", "utils", "test", "spec", "photo", "holiday", "budget", "readme", "license", "server",
+    "client", "module", "package", "build", "release", "summary", "meeting", "resume", "letter", "schema",
+]
+EXTENSIONS = ["txt", "md", "pdf", "png", "jpg", "cpp", "hpp", "ts", "json", "yaml", "conf", "docx", "csv"]
+SEPARATORS = ["-", "_", " ", "", "."]
+
+
+def random_name(rng):
+    parts = [rng.choice(WORDS) for _ in range(rng.randint(1, 3))]
+
+    if rng.random() < 0.5:
+        parts.append(str(rng.randint(2015, 2025)))
+
+    name = rng.choice(SEPARATORS).join(parts)
+
+    if rng.random() < 0.3:
+        name = name.capitalize()
+
+    return f"{name}.{rng.choice(EXTENSIONS)}"
+
+
+def populate(db, file_count, rng):
+    for migration in sorted(MIGRATIONS_DIR.glob("*.sql")):
+        db.executescript(migration.read_text())
+
+    # bulk load, as done by the indexer for the first scan
+    db.execute("DROP TRIGGER unicode_idx_ai")
+    db.execute("DROP TRIGGER unicode_idx_ad")
+
+    rows = []
+    now = int(time.time())
+
+    for i in range(file_count):
+        parent = f"/home/user/dir{i // 200}/sub{i % 7}"
+        name = random_name(rng)
+        rows.append((f"{parent}/{i}-{name}", parent, f"{i}-{name}", now - rng.randint(0, 3 * 365 * 86400),
+                     rng.uniform(0.1, 2.0)))
+
+    db.executemany("INSERT INTO indexed_file (path, parent_path, name, last_modified_at, relevancy_score) "
+                   "VALUES (?, ?, ?, ?, ?)", rows)
+    db.execute("INSERT INTO unicode_idx(unicode_idx) VALUES('rebuild')")
+    db.commit()
+
+
+def page_bytes(db):
+    page_size = db.execute("PRAGMA page_size").fetchone()[0]
+    return db.execute("PRAGMA page_count").fetchone()[0] * page_size
+
+
+def time_query(db, statement, params, runs):
+    timings = []
+
+    for _ in range(runs):
+        started_at = time.perf_counter()
+        db.execute(statement, params).fetchall()
+        timings.append((time.perf_counter() - started_at) * 1000)
+
+    return statistics.median(timings)
+
+
+PREFIX_STATEMENT = """
+SELECT f.path, -bm25(unicode_idx) * f.relevancy_score AS score FROM unicode_idx
+JOIN indexed_file f ON f.id = unicode_idx.rowid
+WHERE unicode_idx MATCH :query ORDER BY score DESC LIMIT 50
+"""
+
+SUBSTRING_STATEMENT = """
+SELECT f.path, -bm25(trigram_idx) * f.relevancy_score
+    * (CASE WHEN f.id IN (SELECT rowid FROM unicode_idx WHERE unicode_idx MATCH :prefix) THEN 2.0 ELSE 1.0 END)
+    AS score FROM trigram_idx
+JOIN indexed_file f ON f.id = trigram_idx.rowid
+WHERE trigram_idx MATCH :query ORDER BY score DESC LIMIT 50
+"""
+
+
+def count_matches(db, table, query):
+    return db.execute(f"SELECT COUNT(*) FROM {table} WHERE {table} MATCH ?", (query,)).fetchone()[0]
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--files", type=int, default=1_000_000)
+    parser.add_argument("--runs", type=int, default=5)
+    parser.add_argument("--db", default="/tmp/file-index-bench.db")
+    args = parser.parse_args()
+
+    for suffix in ["", "-wal", "-shm"]:
+        if os.path.exists(args.db + suffix):
+            os.remove(args.db + suffix)
+
+    db = sqlite3.connect(args.db)
+    rng = random.Random(42)
+
+    print(f"sqlite {sqlite3.sqlite_version}, {args.files} files")
+
+    started_at = time.perf_counter()
+    populate(db, args.files, rng)
+    print(f"populated in {time.perf_counter() - started_at:.1f}s, database size {page_bytes(db) / 2**20:.1f}MB")
+
+    size_before = page_bytes(db)
+    started_at = time.perf_counter()
+
+    for statement in SUBSTRING_INDEX:
+        db.execute(statement)
+
+    db.commit()
+    print(f"substring index built in {time.perf_counter() - started_at:.1f}s, "
+          f"{(page_bytes(db) - size_before) / 2**20:.1f}MB")
+
+    print(f"\n{'query':<14}{'prefix ms':>10}{'matches':>10}{'substring ms':>14}{'matches':>10}")
+
+    for query, prefix, substring in QUERIES:
+        prefix_ms = time_query(db, PREFIX_STATEMENT, {"query": prefix}, args.runs)
+        substring_ms = time_query(db, SUBSTRING_STATEMENT, {"query": substring, "prefix": prefix}, args.runs)
+        print(f"{query:<14}{prefix_ms:>10.1f}{count_matches(db, 'unicode_idx', prefix):>10}"
+              f"{substring_ms:>14.1f}{count_matches(db, 'trigram_idx', substring):>10}")
+
+
+if __name__ == "__main__":
+    main()
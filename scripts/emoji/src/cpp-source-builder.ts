@@ -1,6 +1,7 @@
 import { join } from 'path';
 import { mkdir, writeFile } from 'fs/promises';
 import { spawnSync } from 'child_process';
+import { tokenize } from './tokenizer';
 
 type EmojiInfo = {
 	emoji: string;
@@ -18,6 +19,8 @@ export class CppSourceBuilder {
 	private m_groups: string[] = [];
 	private m_keywordMap = new Map<string, number>();
 	private m_groupMap = new Map<string, number>();
+	// normalized token -> indexes of the emojis it matches, in insertion order
+	private m_searchIndex = new Map<string, number[]>();
 
 	private buildItemStruct(info: EmojiInfo): string {
 		return `\tEmojiData{ .emoji = "${info.emoji}", .name = ${quoted(info.name)}, .group = GRP(${info.group}), .keywords = {${info.keywords.map(idx => `KW(${idx})`).join(',')}}, .skinToneSupport = ${info.skinToneSupport}}`;
@@ -25,7 +28,9 @@ export class CppSourceBuilder {
 
 	private buildHeader = (): string => {
 const HEADER_BASE = `#pragma once
+#include <cstdint>
 #include <vector>
+#include <span>
 #include <string_view>
 #include <array>
 #include <unordered_map>
@@ -38,12 +43,42 @@ struct EmojiData {
 	bool skinToneSupport = false;
 };
 
+/**
+ * Entry of the precomputed keyword search index. \`token\` is a keyword normalized with \`TextTokenizer\`,
+ * matching the emojis whose index in \`orderedList\` are stored in
+ * \`searchPostings()[postingOffset, postingOffset + postingCount)\`.
+ */
+struct EmojiSearchToken {
+	std::string_view token;
+	uint32_t postingOffset;
+	uint32_t postingCount;
+};
+
+/**
+ * Emojis of a group, which are contiguous in \`orderedList\`.
+ */
+struct EmojiGroup {
+	std::string_view name;
+	uint32_t offset;
+	uint32_t count;
+
+	std::span<const EmojiData> emojis() const;
+};
+
 class StaticEmojiDatabase {
 	public:
 		StaticEmojiDatabase() = delete;
 		static const std::array<EmojiData, ${this.m_emojis.length}>& orderedList();
 		static const std::unordered_map<std::string_view, const EmojiData*>& mapping();
 		static const std::array<std::string_view, ${this.m_groups.length}>& groups();
+		// groups in order, as they are listed before any search
+		static std::span<const EmojiGroup> groupedList();
+
+		/**
+		 * Search tokens, sorted by their UTF-8 representation.
+		 */
+		static std::span<const EmojiSearchToken> searchTokens();
+		static std::span<const uint16_t> searchPostings();
 };
 `
 
@@ -55,17 +90,93 @@ class StaticEmojiDatabase {
 	}
 	
 	private buildSource() {
-		return `// clang-format off\n\n#include "emoji.hpp"\n#include <string_view>\n#include <array>\n\n${this.buildCategories()}\n\n${this.buildKeywords()}\n\n${this.buildStaticArray()}\n\nconst std::array<EmojiData, ${this.m_emojis.length}>& StaticEmojiDatabase::orderedList() { return EMOJI_LIST; }\n${this.buildMap()} const std::unordered_map<std::string_view, const EmojiData*>& StaticEmojiDatabase::mapping() { return MAPPING; }\n\nconst std::array<std::string_view, ${this.m_groups.length}>& StaticEmojiDatabase::groups() { return GROUPS; }`;
+		return `// clang-format off\n\n#include "emoji.hpp"\n#include <string_view>\n#include <array>\n\n${this.buildCategories()}\n\n${this.buildKeywords()}\n\n${this.buildStaticArray()}\n\nconst std::array<EmojiData, ${this.m_emojis.length}>& StaticEmojiDatabase::orderedList() { return EMOJI_LIST; }\n${this.buildMap()} const std::unordered_map<std::string_view, const EmojiData*>& StaticEmojiDatabase::mapping() { return MAPPING; }\n\nconst std::array<std::string_view, ${this.m_groups.length}>& StaticEmojiDatabase::groups() { return GROUPS; }\n\n${this.buildGroupedList()}\n\n${this.buildSearchIndex()}`;
 	}
 
 	private buildCategories() {
 		return `#define GRP(idx) GROUPS[idx]\n\nstatic constexpr std::array<std::string_view, ${this.m_groups.length}> GROUPS = {\n${this.m_groups.map(quoted).join(',')}\n};`;
 	}
 
+	/**
+	 * The emojis of a group are expected to follow each other, so that the grouped list is only made of
+	 * ranges of the ordered one.
+	 */
+	private buildGroupedList() {
+		const ranges: { group: number; offset: number; count: number }[] = [];
+
+		this.m_emojis.forEach(({ group }, idx) => {
+			const last = ranges[ranges.length - 1];
+
+			if (last?.group === group) {
+				last.count += 1;
+				return;
+			}
+
+			if (ranges.some((range) => range.group === group)) {
+				throw new Error(`Emojis of group ${this.m_groups[group]} are not contiguous`);
+			}
+
+			ranges.push({ group, offset: idx, count: 1 });
+		});
+
+		return [
+			`static constexpr std::array<EmojiGroup, ${ranges.length}> GROUPED_LIST = {{\n${ranges.map(({ group, offset, count }) => `{ GRP(${group}), ${offset}, ${count} }`).join(',\n')}\n}};`,
+			`std::span<const EmojiData> EmojiGroup::emojis() const { return std::span(EMOJI_LIST).subspan(offset, count); }`,
+			`std::span<const EmojiGroup> StaticEmojiDatabase::groupedList() { return GROUPED_LIST; }`
+		].join('\n\n');
+	}
+
 	private buildKeywords() {
 		return `#define KW(idx) KEYWORDS[idx]\n\nstatic constexpr std::array<std::string_view, ${this.m_keywords.length}> KEYWORDS = {\n${this.m_keywords.map(quoted).join(',')}\n};`;
 	}
 
+	private buildSearchIndex() {
+		const utf8 = new TextEncoder();
+		const tokens = [...this.m_searchIndex.keys()].sort((a, b) => Buffer.compare(utf8.encode(a), utf8.encode(b)));
+		const entries: string[] = [];
+		const postings: number[] = [];
+
+		for (const token of tokens) {
+			const emojis = this.m_searchIndex.get(token)!;
+
+			entries.push(`{ ${quoted(token)}, ${postings.length}, ${emojis.length} }`);
+			postings.push(...emojis);
+		}
+
+		return [
+			`static constexpr std::array<EmojiSearchToken, ${entries.length}> SEARCH_TOKENS = {{\n${entries.join(',\n')}\n}};`,
+			`static constexpr std::array<uint16_t, ${postings.length}> SEARCH_POSTINGS = {\n${postings.join(',')}\n};`,
+			`std::span<const EmojiSearchToken> StaticEmojiDatabase::searchTokens() { return SEARCH_TOKENS; }`,
+			`std::span<const uint16_t> StaticEmojiDatabase::searchPostings() { return SEARCH_POSTINGS; }`
+		].join('\n\n');
+	}
+
+	private indexToken(token: string, emojiIdx: number) {
+		const emojis = this.m_searchIndex.get(token);
+
+		if (!emojis) {
+			this.m_searchIndex.set(token, [emojiIdx]);
+		} else if (emojis[emojis.length - 1] != emojiIdx) {
+			emojis.push(emojiIdx);
+		}
+	}
+
+	/**
+	 * Mirrors what the application used to do when building its search trie at startup.
+	 */
+	private indexKeyword(keyword: string, emojiIdx: number) {
+		const { normalized, tokens } = tokenize(keyword);
+
+		for (const token of tokens) {
+			this.indexToken(token, emojiIdx);
+		}
+
+		// emoticons such as ":D" are mostly punctuation the tokenizer would drop, keep them searchable as is
+		if (normalized && !/^[a-zA-Z0-9]/.test(keyword)) {
+			this.indexToken(normalized, emojiIdx);
+		}
+	}
+
 	private buildMap() {
 		return `const std::unordered_map<std::string_view, const EmojiData*> MAPPING = {
 ${this.m_emojis.map(({ emoji }, idx) => `{ ${quoted(emoji)}, &EMOJI_LIST[${idx}] }`).join(',\n')}
@@ -88,9 +199,13 @@ ${this.m_emojis.map(({ emoji }, idx) => `{ ${quoted(emoji)}, &EMOJI_LIST[${idx}]
 			this.m_groups.push(group);
 		}
 
+		const emojiIdx = this.m_emojis.length;
+
 		for (const keyword of keywords) {
 			if (keyword.includes("\\")) continue ;
 
+			this.indexKeyword(keyword, emojiIdx);
+
 			if (!this.m_keywordMap.has(keyword)) {
 				this.m_keywordMap.set(keyword, this.m_keywords.length);
 				keywordIndexes.push(this.m_keywords.length);
@@ -0,0 +1,64 @@
+/**
+ * Port of the application tokenizer (`vicinae/src/lib/text-tokenizer.cpp`), used to precompute the
+ * emoji search index. Both implementations need to agree on how words are split and normalized,
+ * otherwise queries normalized at runtime will not match the precomputed tokens.
+ */
+
+type CharClass = 'lower' | 'upper' | 'caseless' | 'separator' | 'mark';
+
+const classify = (ch: string): CharClass => {
+	if (/\p{M}/u.test(ch)) return 'mark';
+	if (/\p{Ll}/u.test(ch)) return 'lower';
+	if (/[\p{Lu}\p{Lt}]/u.test(ch)) return 'upper';
+	if (/[\p{Lm}\p{Lo}\p{Nd}\p{Nl}\p{No}]/u.test(ch)) return 'caseless';
+	return 'separator';
+}
+
+const hasStrippableDiacritics = (cp: number) => (cp >= 0xC0 && cp < 0x530) || (cp >= 0x1E00 && cp < 0x2000);
+
+const stripDiacritics = (ch: string): string => {
+	if (!hasStrippableDiacritics(ch.codePointAt(0)!)) return ch;
+	return String.fromCodePoint(ch.normalize('NFD').codePointAt(0)!);
+}
+
+export type TokenizedText = {
+	normalized: string;
+	tokens: string[];
+};
+
+export const tokenize = (text: string, splitCamelCase = true): TokenizedText => {
+	const tokens: string[] = [];
+	let normalized = '';
+	let token = '';
+	let prev: CharClass = 'separator';
+
+	const endToken = () => {
+		if (token) tokens.push(token);
+		token = '';
+	}
+
+	for (const ch of text) {
+		const cls = classify(ch);
+
+		if (cls == 'mark') continue ;
+
+		if (cls == 'separator') {
+			endToken();
+			normalized += ch;
+			prev = cls;
+			continue ;
+		}
+
+		if (splitCamelCase && cls == 'upper' && prev == 'lower') endToken();
+
+		const folded = stripDiacritics(ch).toLowerCase();
+
+		token += folded;
+		normalized += folded;
+		prev = cls;
+	}
+
+	endToken();
+
+	return { normalized, tokens };
+}
@@ -20,6 +20,7 @@
   autoPatchelfHook,
   writeShellScriptBin,
   minizip,
+  zstd,
   qt6,
   typescript,
   wayland,
@@ -92,6 +93,7 @@ in
       minizip-ng
       cmark-gfm
       libqalculate
+      zstd
     ];
 
     configurePhase = ''
@@ -2,7 +2,7 @@
 #include "common.hpp"
 #include "ui/views/list-view.hpp"
 #include "clipboard-actions.hpp"
-#include "trie.hpp"
+#include "lib/search-index.hpp"
 #include <QtConcurrent/QtConcurrent>
 #include "services/config/config-service.hpp"
 #include "src/ui/image/url.hpp"
@@ -156,25 +156,43 @@ public:
 };
 
 class BrowseFontsView : public ListView {
-  std::unique_ptr<Trie<QString>> m_trie;
+  using FontIndex = SearchIndex<QString>;
 
-  QFuture<std::unique_ptr<Trie<QString>>> buildTrieAsync() {
-    auto fontService = ServiceRegistry::instance()->fontService();
+  // results past this are not worth laying out, refining the query is what is expected
+  static constexpr size_t MAX_RESULTS = 500;
+
+  std::unique_ptr<FontIndex> m_index;
 
+  QFuture<std::unique_ptr<FontIndex>> buildIndexAsync(const FontService::Catalog &catalog) {
     return QtConcurrent::run(
-        [&fontService]() { return std::make_unique<Trie<QString>>(fontService->buildFontSearchIndex()); });
+        [catalog]() { return std::make_unique<FontIndex>(FontService::buildFontSearchIndex(catalog)); });
+  }
+
+  // the catalog is enumerated in the background once, the index is built from it as soon as it is there
+  void indexCatalog() {
+    auto watcher = QSharedPointer<QFutureWatcher<std::unique_ptr<FontIndex>>>::create();
+
+    watcher->setFuture(buildIndexAsync(*ServiceRegistry::instance()->fontService()->catalog()));
+    connect(watcher.get(), &QFutureWatcher<std::unique_ptr<FontIndex>>::finished, this, [this, watcher]() {
+      m_index = watcher->future().takeResult();
+      render(searchText());
+    });
   }
 
 public:
   void renderEmptySearch() {
+    auto catalog = ServiceRegistry::instance()->fontService()->catalog();
+
+    if (!catalog) return;
+
     m_list->beginResetModel();
 
-    for (const auto &system : QFontDatabase::writingSystems()) {
+    for (const auto &[system, families] : catalog->writingSystems) {
       QString sname = QFontDatabase::writingSystemName(system);
       auto &section = m_list->addSection(QString("%1 Fonts").arg(sname));
       auto nonWide = [](const QString &name) { return !name.contains("wide", Qt::CaseInsensitive); };
       auto items =
-          QFontDatabase::families(system) | std::views::filter(nonWide) |
+          families | std::views::filter(nonWide) |
           std::views::transform([](const QString &family) { return std::make_unique<FontListItem>(family); });
 
       for (auto item : items) {
@@ -189,16 +207,17 @@ public:
     QString query = s.trimmed();
 
     if (query.isEmpty()) return renderEmptySearch();
-    if (!m_trie) return;
+    if (!m_index) return;
 
     m_list->beginResetModel();
-    Timer timer;
-    auto results = m_trie->prefixSearch(query.toStdString(), 500);
-    auto nonWide = [](const QString &name) { return !name.contains("wide", Qt::CaseInsensitive); };
+    auto results = m_index->search(query, MAX_RESULTS);
+    auto nonWide = [](const FontIndex::Result &result) {
+      return !result.item->contains("wide", Qt::CaseInsensitive);
+    };
 
     auto &section = m_list->addSection("Fonts");
-    auto items = results | std::views::filter(nonWide) | std::views::transform([](const QString &family) {
-                   return std::make_unique<FontListItem>(family);
+    auto items = results | std::views::filter(nonWide) | std::views::transform([](const auto &result) {
+                   return std::make_unique<FontListItem>(*result.item);
                  });
 
     for (auto item : items) {
@@ -212,12 +231,13 @@ public:
   void initialize() override { setSearchPlaceholderText("Browse fonts to preview..."); }
 
   BrowseFontsView() {
-    auto watcher = QSharedPointer<QFutureWatcher<std::unique_ptr<Trie<QString>>>>::create();
+    auto fontService = ServiceRegistry::instance()->fontService();
 
-    watcher->setFuture(buildTrieAsync());
-    connect(watcher.get(), &QFutureWatcher<Trie<QString>>::finished, this, [this, watcher]() {
-      m_trie = watcher->future().takeResult();
-      render(searchText());
-    });
+    if (fontService->catalog()) {
+      indexCatalog();
+    } else {
+      connect(fontService, &FontService::catalogLoaded, this, &BrowseFontsView::indexCatalog,
+              Qt::SingleShotConnection);
+    }
   }
 };
@@ -0,0 +1,13 @@
+-- the history is listed by pin and update time, idx_selection_pinned_created
+-- does not match that order and forced a sort of the whole history.
+CREATE INDEX IF NOT EXISTS idx_selection_pinned_updated
+ON selection(
+	pinned_at DESC,
+	updated_at DESC
+);
+
+-- looked up on every copy, to bubble up selections that were already copied
+CREATE INDEX IF NOT EXISTS idx_selection_hash
+ON selection(
+	hash_md5
+);
@@ -0,0 +1,10 @@
+-- the history is listed page after page from the last entry of the previous one, which needs
+-- the index to cover the whole ordering (see ClipboardDatabase::listAll).
+DROP INDEX IF EXISTS idx_selection_pinned_updated;
+
+CREATE INDEX IF NOT EXISTS idx_selection_history
+ON selection(
+	pinned_at,
+	updated_at,
+	id
+);
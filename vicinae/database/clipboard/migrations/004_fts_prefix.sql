@@ -0,0 +1,17 @@
+-- short query prefixes had to be expanded against the whole vocabulary of the index: prefix
+-- indexes of 2 and 3 characters answer them directly. selection_id is only used to join with
+-- the selections and is no longer tokenized, which also kept queries from matching ids.
+CREATE TEMP TABLE selection_fts_backup AS SELECT selection_id, content FROM selection_fts;
+
+DROP TABLE selection_fts;
+
+CREATE VIRTUAL TABLE selection_fts USING fts5(
+	content,
+	selection_id UNINDEXED,
+	tokenize='porter',
+	prefix='2 3'
+);
+
+INSERT INTO selection_fts (selection_id, content) SELECT selection_id, content FROM selection_fts_backup;
+
+DROP TABLE selection_fts_backup;
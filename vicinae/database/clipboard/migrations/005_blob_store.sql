@@ -0,0 +1,20 @@
+-- offer data is stored once per distinct content, in a file named after the blob id. Blobs are
+-- reference counted by their offers, and their files removed once they are no longer referenced
+-- (see ClipboardDatabase::removeUnusedBlobs).
+CREATE TABLE IF NOT EXISTS blob (
+	id TEXT PRIMARY KEY,
+	ref_count INTEGER NOT NULL DEFAULT 0
+);
+
+ALTER TABLE data_offer ADD COLUMN blob_id TEXT;
+
+-- existing offers keep their own file, named after the offer
+UPDATE data_offer SET blob_id = id;
+
+INSERT INTO blob (id, ref_count) SELECT id, 1 FROM data_offer;
+
+CREATE TRIGGER data_offer_blob_ai AFTER INSERT ON data_offer BEGIN
+  INSERT INTO blob (id, ref_count) VALUES (new.blob_id, 1) ON CONFLICT(id) DO UPDATE SET ref_count = ref_count + 1;END;
+
+CREATE TRIGGER data_offer_blob_ad AFTER DELETE ON data_offer BEGIN
+  UPDATE blob SET ref_count = ref_count - 1 WHERE id = old.blob_id;END;
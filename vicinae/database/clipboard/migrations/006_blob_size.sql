@@ -0,0 +1,9 @@
+-- blob sizes are summed up to enforce the history size budget
+ALTER TABLE blob ADD COLUMN size INTEGER NOT NULL DEFAULT 0;
+
+UPDATE blob SET size = o.size FROM data_offer o WHERE o.blob_id = blob.id;
+
+DROP TRIGGER IF EXISTS data_offer_blob_ai;
+
+CREATE TRIGGER data_offer_blob_ai AFTER INSERT ON data_offer BEGIN
+  INSERT INTO blob (id, ref_count, size) VALUES (new.blob_id, 1, new.size) ON CONFLICT(id) DO UPDATE SET ref_count = ref_count + 1;END;
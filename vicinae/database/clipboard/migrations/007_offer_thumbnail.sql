@@ -0,0 +1,3 @@
+-- small preview of image offers shown in the history, encrypted like the offer itself:
+-- decoding the original image for every row of the history is slow.
+ALTER TABLE data_offer ADD COLUMN thumbnail BLOB;
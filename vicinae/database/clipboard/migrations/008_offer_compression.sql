@@ -0,0 +1,2 @@
+-- large text offers are stored compressed, in blobs of their own (see ClipboardService::computeBlobId).
+ALTER TABLE data_offer ADD COLUMN compression_type INT NOT NULL DEFAULT 0;
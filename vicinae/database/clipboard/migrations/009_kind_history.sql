@@ -0,0 +1,43 @@
+-- pages of the history are selected from its index alone, without looking up the selections: the index
+-- covers every column the page is made of (see ClipboardDatabase::listHistorySegment).
+DROP INDEX IF EXISTS idx_selection_history;
+
+CREATE INDEX IF NOT EXISTS idx_selection_history
+ON selection(
+	pinned_at,
+	updated_at,
+	id,
+	kind,
+	preferred_mime_type
+);
+
+-- the history filtered by kind, in the same order, which otherwise had to go through all of it
+CREATE INDEX IF NOT EXISTS idx_selection_kind_history
+ON selection(
+	kind,
+	pinned_at,
+	updated_at,
+	id,
+	preferred_mime_type
+);
+
+-- selections by kind, kept up to date by the triggers below, for the history filter not to count them
+CREATE TABLE IF NOT EXISTS selection_kind_count (
+	kind INTEGER PRIMARY KEY,
+	count INTEGER NOT NULL
+);
+
+INSERT INTO selection_kind_count (kind, count)
+SELECT kind, COUNT(*) FROM selection WHERE kind IS NOT NULL GROUP BY kind;
+
+CREATE TRIGGER selection_kind_count_ai AFTER INSERT ON selection WHEN new.kind IS NOT NULL BEGIN
+  INSERT INTO selection_kind_count (kind, count) VALUES (new.kind, 1)
+  ON CONFLICT (kind) DO UPDATE SET count = count + 1;END;
+
+CREATE TRIGGER selection_kind_count_ad AFTER DELETE ON selection WHEN old.kind IS NOT NULL BEGIN
+  UPDATE selection_kind_count SET count = count - 1 WHERE kind = old.kind;END;
+
+CREATE TRIGGER selection_kind_count_auk AFTER UPDATE OF kind ON selection BEGIN
+  UPDATE selection_kind_count SET count = count - 1 WHERE kind = old.kind;
+  INSERT INTO selection_kind_count (kind, count) SELECT new.kind, 1 WHERE new.kind IS NOT NULL
+  ON CONFLICT (kind) DO UPDATE SET count = count + 1;END;
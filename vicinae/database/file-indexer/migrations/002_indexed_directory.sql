@@ -0,0 +1,11 @@
+-- Times of the indexed directories as of the last time they were listed, in nanoseconds.
+-- Incremental scans only list directories again if these changed.
+-- Directories that are known but have never been listed have null times.
+CREATE TABLE IF NOT EXISTS indexed_directory (
+	path TEXT PRIMARY KEY,
+	parent_path TEXT NOT NULL,
+	last_modified_ns INT,
+	last_changed_ns INT
+) WITHOUT ROWID;
+
+CREATE INDEX idx_indexed_directory_parent_path ON indexed_directory(parent_path);
@@ -0,0 +1,7 @@
+-- files opened from the search results, used to rank frequently and recently opened files higher
+-- rows are keyed by path so that they survive files being indexed again
+CREATE TABLE IF NOT EXISTS file_open (
+	path TEXT PRIMARY KEY,
+	open_count INT NOT NULL DEFAULT 0,
+	last_opened_at INT NOT NULL
+) WITHOUT ROWID;
@@ -0,0 +1,56 @@
+-- Directories of the indexed files, stored once instead of as a prefix of the path of each of their files.
+-- Paths end with a separator ('/' for the root), so that the path of a file is the path of its directory
+-- followed by its name.
+CREATE TABLE IF NOT EXISTS directory (
+	id INTEGER PRIMARY KEY,
+	parent_id INT,
+	path TEXT UNIQUE NOT NULL
+);
+
+CREATE INDEX idx_directory_parent_id ON directory(parent_id);
+
+-- every directory holding files, along with all of its ancestors up to the root
+INSERT INTO directory (path)
+WITH RECURSIVE ancestor(path) AS (
+	SELECT DISTINCT CASE parent_path WHEN '/' THEN '/' ELSE parent_path || '/' END FROM indexed_file
+	UNION
+	SELECT rtrim(substr(path, 1, length(path) - 1), replace(substr(path, 1, length(path) - 1), '/', ''))
+	FROM ancestor WHERE path != '/'
+)
+SELECT path FROM ancestor ORDER BY path;
+
+UPDATE directory SET parent_id = (
+	SELECT p.id FROM directory p WHERE p.path = rtrim(
+		substr(directory.path, 1, length(directory.path) - 1),
+		replace(substr(directory.path, 1, length(directory.path) - 1), '/', '')
+	)
+) WHERE path != '/';
+
+-- the triggers and indexes of the old table go away with it
+ALTER TABLE indexed_file RENAME TO indexed_file_v1;
+
+-- ids are kept, so that the full text indexes remain valid
+CREATE TABLE indexed_file (
+	id INTEGER PRIMARY KEY AUTOINCREMENT,
+	dir_id INT NOT NULL,
+	name TEXT NOT NULL,
+	last_modified_at INT,
+	relevancy_score REAL NOT NULL,
+	UNIQUE (dir_id, name)
+);
+
+INSERT INTO indexed_file (id, dir_id, name, last_modified_at, relevancy_score)
+SELECT f.id, d.id, f.name, f.last_modified_at, f.relevancy_score FROM indexed_file_v1 f
+JOIN directory d ON d.path = CASE f.parent_path WHEN '/' THEN '/' ELSE f.parent_path || '/' END;
+
+DROP TABLE indexed_file_v1;
+
+CREATE TRIGGER unicode_idx_ai AFTER INSERT ON indexed_file BEGIN
+  INSERT INTO unicode_idx(rowid, name) VALUES (new.id, new.name);END;
+
+CREATE TRIGGER unicode_idx_ad AFTER DELETE ON indexed_file BEGIN
+  INSERT INTO unicode_idx(unicode_idx, rowid, name) VALUES('delete', old.id, old.name);END;
+
+-- The triggers of the optional substring index are created again on startup, when the missing ones are
+-- detected. The deletion log is dropped along with its trigger, which makes the filename index rebuild.
+DROP TABLE IF EXISTS deleted_file;
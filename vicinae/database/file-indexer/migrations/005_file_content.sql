@@ -0,0 +1,30 @@
+-- Text content of the files of the entrypoints that have content indexing enabled.
+-- Files are recorded along with their modification time once they have been read, so that they are only read
+-- again after they change. Files that have no text content are recorded as well, without any chunk.
+CREATE TABLE IF NOT EXISTS file_content (
+	file_id INTEGER PRIMARY KEY,
+	last_modified_at INT
+);
+
+-- content is split into chunks, so that matches are ranked by the part of a file they are in
+CREATE TABLE IF NOT EXISTS file_chunk (
+	id INTEGER PRIMARY KEY,
+	file_id INT NOT NULL,
+	body TEXT NOT NULL
+);
+
+CREATE INDEX idx_file_chunk_file_id ON file_chunk(file_id);
+
+CREATE VIRTUAL TABLE IF NOT EXISTS content_idx USING fts5(
+	body, content=file_chunk, content_rowid=id, tokenize='unicode61'
+);
+
+CREATE TRIGGER content_idx_ai AFTER INSERT ON file_chunk BEGIN
+  INSERT INTO content_idx(rowid, body) VALUES (new.id, new.body);END;
+
+CREATE TRIGGER content_idx_ad AFTER DELETE ON file_chunk BEGIN
+  INSERT INTO content_idx(content_idx, rowid, body) VALUES('delete', old.id, old.body);END;
+
+-- the content of a file goes away with it
+CREATE TRIGGER file_content_ad AFTER DELETE ON indexed_file BEGIN
+  DELETE FROM file_chunk WHERE file_id = old.id; DELETE FROM file_content WHERE file_id = old.id;END;
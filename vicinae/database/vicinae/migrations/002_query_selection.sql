@@ -0,0 +1,9 @@
+-- root items launched from a search, by the query that was typed, used to put them first the next time
+-- the same query is typed
+CREATE TABLE IF NOT EXISTS root_query_selection (
+	query TEXT NOT NULL,
+	item_id TEXT NOT NULL,
+	selection_count INT NOT NULL DEFAULT 0,
+	last_selected_at INT NOT NULL,
+	PRIMARY KEY (query, item_id)
+) WITHOUT ROWID;
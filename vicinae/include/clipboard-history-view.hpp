@@ -119,6 +119,10 @@ class ClipboardHistoryItemWidget : public SelectableOmniListWidget {
   ImageURL iconForMime(const ClipboardHistoryEntry &entry) const {
     switch (entry.kind) {
     case ClipboardOfferKind::Image:
+      // the original image is only decoded when the entry is opened
+      if (entry.thumbnail && !entry.thumbnail->isEmpty()) {
+        return ImageURL::rawData(*entry.thumbnail, QMimeDatabase().mimeTypeForData(*entry.thumbnail).name());
+      }
       return ImageURL::builtin("image");
     case ClipboardOfferKind::Link:
       return getLinkIcon(entry.urlHost);
@@ -157,6 +161,9 @@ public:
 };
 
 class ClipboardHistoryDetail : public DetailWithMetadataWidget {
+  // the start of larger texts is all there is to see at a glance, the rest is only loaded when pasted
+  static constexpr qsizetype MAX_TEXT_SIZE = 1024 * 1024;
+
   QTemporaryFile m_tmpFile;
 
   std::vector<MetadataItem> createEntryMetadata(const ClipboardHistoryEntry &entry) const {
@@ -181,9 +188,11 @@ class ClipboardHistoryDetail : public DetailWithMetadataWidget {
   }
 
   QWidget *createEntryWidget(const ClipboardHistoryEntry &entry) {
-    auto data = ServiceRegistry::instance()->clipman()->decryptMainSelectionOffer(entry.id);
+    bool isText = entry.mimeType.startsWith("text/");
+    auto clipman = ServiceRegistry::instance()->clipman();
+    auto data = clipman->decryptMainSelectionOffer(entry.id, isText ? MAX_TEXT_SIZE : -1);
 
-    if (entry.mimeType.startsWith("text/")) {
+    if (isText) {
       auto container = new TextContainer;
       auto viewer = new TextFileViewer();
 
@@ -511,50 +520,105 @@ class ClipboardHistoryView : public SimpleView {
   EmptyViewWidget *m_emptyView = new EmptyViewWidget;
   QStackedWidget *m_content = new QStackedWidget(this);
   PreferenceDropdown *m_filterInput = new PreferenceDropdown(this);
-  using Watcher = QFutureWatcher<PaginatedResponse<ClipboardHistoryEntry>>;
+  using Watcher = QFutureWatcher<ClipboardHistoryPage>;
   Watcher m_watcher;
   std::optional<ClipboardOfferKind> m_kindFilter;
 
-  void reloadCurrentSearch() { startSearch({.query = searchText(), .kind = m_kindFilter}); }
+  // the history is loaded one page at a time, as the list is scrolled
+  static constexpr size_t PAGE_SIZE = 100;
+  std::vector<ClipboardHistoryEntry> m_entries;
+  std::optional<ClipboardHistoryCursor> m_nextPage;
+  ClipboardListSettings m_currentOpts;
+  // whether the pending request is for the next page, and not a new search
+  bool m_loadingNextPage = false;
+
+  // reloads as many entries as were loaded, so that the list doesn't shrink back to its first page
+  void reloadCurrentSearch() {
+    startSearch({.query = searchText(), .kind = m_kindFilter}, std::max(PAGE_SIZE, m_entries.size()));
+  }
 
   void handleListFinished() {
-    if (!m_watcher.isFinished()) return;
+    // superseded by a newer request
+    if (!m_watcher.isFinished() || m_watcher.isCanceled()) return;
+
+    auto page = m_watcher.result();
+    bool append = m_loadingNextPage;
+
+    m_loadingNextPage = false;
+    m_nextPage = page.next;
+
+    if (append) {
+      m_entries.insert(m_entries.end(), page.data.begin(), page.data.end());
+    } else {
+      m_entries = std::move(page.data);
+    }
+
+    generateList(m_entries, append ? OmniList::PreserveSelection : OmniList::SelectFirst);
+  }
 
-    generateList(m_watcher.result());
+  void handleScrolledNearEnd() {
+    if (!m_nextPage || m_watcher.isRunning()) return;
+
+    auto clipman = context()->services->clipman();
+
+    m_loadingNextPage = true;
+    m_watcher.setFuture(clipman->listAll(PAGE_SIZE, m_nextPage, m_currentOpts));
   }
 
   QWidget *searchBarAccessory() const override { return m_filterInput; }
 
-  void generateList(const PaginatedResponse<ClipboardHistoryEntry> &result) {
+  // the counts are kept by the database, looking them up after every change is free
+  void updateFilterCounts() {
+    auto counts = ServiceRegistry::instance()->clipman()->countSelectionsByKind();
+
+    if (!counts) return;
+
+    for (const auto &option : filterSelectorOptions) {
+      auto it = typeToOfferKind.find(option.value);
+
+      if (it == typeToOfferKind.end()) continue;
+
+      auto count = counts->find(it->second);
+      QString name = QString("%1 (%2)").arg(option.title).arg(count == counts->end() ? 0 : count->second);
+
+      m_filterInput->updateItem(option.value, [&name](SelectorInput::AbstractItem *item) {
+        static_cast<PreferenceDropdownItem *>(item)->setDisplayName(name);
+      });
+    }
+  }
+
+  void generateList(const std::vector<ClipboardHistoryEntry> &entries, OmniList::SelectionPolicy policy) {
     size_t i = 0;
 
-    if (result.data.empty()) {
+    if (entries.empty()) {
       m_content->setCurrentWidget(m_emptyView);
     } else {
       m_content->setCurrentWidget(m_split);
     }
 
-    m_statusToolbar->setLeftText(QString("%1 Items").arg(result.data.size()));
+    m_statusToolbar->setLeftText(QString("%1%2 Items").arg(entries.size()).arg(m_nextPage ? "+" : ""));
 
-    m_list->updateModel([&]() {
-      auto &pinnedSection = m_list->addSection();
+    m_list->updateModel(
+        [&]() {
+          auto &pinnedSection = m_list->addSection();
 
-      while (i < result.data.size() && result.data[i].pinnedAt) {
-        auto &entry = result.data[i];
-        auto candidate = std::make_unique<ClipboardHistoryItem>(entry);
+          while (i < entries.size() && entries[i].pinnedAt) {
+            auto &entry = entries[i];
+            auto candidate = std::make_unique<ClipboardHistoryItem>(entry);
 
-        pinnedSection.addItem(std::move(candidate));
-        ++i;
-      }
+            pinnedSection.addItem(std::move(candidate));
+            ++i;
+          }
 
-      while (i < result.data.size()) {
-        auto &entry = result.data[i];
-        auto candidate = std::make_unique<ClipboardHistoryItem>(entry);
+          while (i < entries.size()) {
+            auto &entry = entries[i];
+            auto candidate = std::make_unique<ClipboardHistoryItem>(entry);
 
-        pinnedSection.addItem(std::move(candidate));
-        ++i;
-      }
-    });
+            pinnedSection.addItem(std::move(candidate));
+            ++i;
+          }
+        },
+        policy);
   }
 
   void initialize() override {
@@ -583,7 +647,10 @@ class ClipboardHistoryView : public SimpleView {
 
   void textChanged(const QString &value) override { startSearch({.query = value, .kind = m_kindFilter}); }
 
-  void clipboardSelectionInserted(const ClipboardHistoryEntry &entry) { reloadCurrentSearch(); }
+  void clipboardSelectionInserted(const ClipboardHistoryEntry &entry) {
+    updateFilterCounts();
+    reloadCurrentSearch();
+  }
 
   void handlePinChanged(int entryId, bool value) { reloadCurrentSearch(); }
   void handleRemoved(int entryId) { reloadCurrentSearch(); }
@@ -647,12 +714,14 @@ class ClipboardHistoryView : public SimpleView {
     return SimpleView::inputFilter(event);
   }
 
-  void startSearch(const ClipboardListSettings &opts) {
+  void startSearch(const ClipboardListSettings &opts, size_t limit = PAGE_SIZE) {
     auto clipman = context()->services->clipman();
 
     if (m_watcher.isRunning()) { m_watcher.cancel(); }
 
-    m_watcher.setFuture(clipman->listAll(1000, 0, opts));
+    m_currentOpts = opts;
+    m_loadingNextPage = false;
+    m_watcher.setFuture(clipman->listAll(limit, {}, opts));
   }
 
   void handleFilterChange(const SelectorInput::AbstractItem &item) {
@@ -684,6 +753,7 @@ public:
     m_filterInput->setFocusPolicy(Qt::NoFocus);
     m_filterInput->setOptions(filterSelectorOptions);
     m_filterInput->setValue("all");
+    updateFilterCounts();
 
     m_content->addWidget(m_split);
     m_content->addWidget(m_emptyView);
@@ -703,11 +773,19 @@ public:
     setLayout(layout);
 
     connect(clipman, &ClipboardService::selectionPinStatusChanged, this, [this]() { reloadCurrentSearch(); });
-    connect(clipman, &ClipboardService::selectionRemoved, this, [this]() { reloadCurrentSearch(); });
-    connect(clipman, &ClipboardService::allSelectionsRemoved, this, [this]() { reloadCurrentSearch(); });
+    connect(clipman, &ClipboardService::selectionRemoved, this, [this]() {
+      updateFilterCounts();
+      reloadCurrentSearch();
+    });
+    connect(clipman, &ClipboardService::allSelectionsRemoved, this, [this]() {
+      updateFilterCounts();
+      reloadCurrentSearch();
+    });
 
     connect(m_list, &OmniList::selectionChanged, this, &ClipboardHistoryView::selectionChanged);
     connect(m_list, &OmniList::itemActivated, this, [this]() { executePrimaryAction(); });
+    connect(m_list, &OmniList::scrolledNearEnd, this, &ClipboardHistoryView::handleScrolledNearEnd,
+            Qt::QueuedConnection);
     connect(clipman, &ClipboardService::itemInserted, this,
             &ClipboardHistoryView::clipboardSelectionInserted);
     connect(clipman, &ClipboardService::monitoringChanged, this,
@@ -302,18 +302,18 @@ public:
             }
           }
 
-          for (const auto &[group, emojis] : emojiService->grouped()) {
-            auto &section = m_grid->addSection(QString::fromStdString(std::string(group)));
+          for (const auto &group : emojiService->grouped()) {
+            auto &section = m_grid->addSection(QString::fromUtf8(group.name.data(), group.name.size()));
 
             section.setColumns(8);
             section.setSpacing(10);
 
-            for (const auto &item : emojis) {
-              if (auto it = metadataMap.find(item->emoji); it != metadataMap.end()) {
+            for (const auto &item : group.emojis()) {
+              if (auto it = metadataMap.find(item.emoji); it != metadataMap.end()) {
                 section.addItem(
                     std::make_unique<EmojiGridItem>(*it->second.data, it->second.pinnedAt.has_value()));
               } else {
-                section.addItem(std::make_unique<EmojiGridItem>(*item, false));
+                section.addItem(std::make_unique<EmojiGridItem>(item, false));
               }
             }
           }
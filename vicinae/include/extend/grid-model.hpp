@@ -2,6 +2,7 @@
 #include "extend/action-model.hpp"
 #include "extend/empty-view-model.hpp"
 #include "extend/image-model.hpp"
+#include "extend/node-model-cache.hpp"
 #include "extend/pagination-model.hpp"
 #include "ui/omni-grid/grid-item-content-widget.hpp"
 #include <qjsonobject.h>
@@ -23,6 +24,11 @@ struct GridItemViewModel {
   std::optional<ActionPannelModel> actionPannel;
 };
 
+/**
+ * Items are shared between the models of the frames they did not change in, see `NodeModelCache`.
+ */
+using GridItemPtr = std::shared_ptr<const GridItemViewModel>;
+
 struct GridSectionModel {
   QString title;
   QString subtitle;
@@ -31,10 +37,12 @@ struct GridSectionModel {
   std::optional<int> columns;
   GridFit fit;
   std::optional<GridItemContentWidget::Inset> inset;
-  std::vector<GridItemViewModel> children;
+  std::vector<GridItemPtr> children;
+
+  bool operator==(const GridSectionModel &) const = default;
 };
 
-using GridChild = std::variant<GridItemViewModel, GridSectionModel>;
+using GridChild = std::variant<GridItemPtr, GridSectionModel>;
 
 struct GridModel {
   bool isLoading;
@@ -61,13 +69,17 @@ struct GridModel {
   std::optional<int> searchBarAccessory;
 };
 
+using GridItemCache = NodeModelCache<GridItemViewModel>;
+
 class GridModelParser {
+  GridItemCache *m_cache = nullptr;
+
   GridItemContentWidget::Inset parseInset(const QString &s);
-  GridItemViewModel parseListItem(const QJsonObject &instance, size_t index);
+  GridItemPtr parseListItem(const QJsonObject &instance, size_t index);
   GridSectionModel parseSection(const QJsonObject &instance);
 
 public:
-  GridModelParser();
+  GridModelParser(GridItemCache *cache = nullptr);
 
   GridModel parse(const QJsonObject &instance);
 };
@@ -4,7 +4,10 @@
 #include "extend/empty-view-model.hpp"
 #include "extend/image-model.hpp"
 #include "extend/dropdown-model.hpp"
+#include "extend/node-model-cache.hpp"
 #include "extend/pagination-model.hpp"
+#include "lib/search-index.hpp"
+#include <memory>
 #include <qjsonobject.h>
 
 struct ListItemViewModel {
@@ -12,18 +15,26 @@ struct ListItemViewModel {
   QString id;
   QString title;
   QString subtitle;
+  std::vector<QString> keywords;
   std::optional<ImageLikeModel> icon;
   std::optional<DetailModel> detail;
   std::optional<ActionPannelModel> actionPannel;
 };
 
+/**
+ * Items are shared between the models of the frames they did not change in, see `NodeModelCache`.
+ */
+using ListItemPtr = std::shared_ptr<const ListItemViewModel>;
+
 struct ListSectionModel {
   QString title;
   QString subtitle;
-  std::vector<ListItemViewModel> children;
+  std::vector<ListItemPtr> children;
+
+  bool operator==(const ListSectionModel &) const = default;
 };
 
-using ListChild = std::variant<ListItemViewModel, ListSectionModel>;
+using ListChild = std::variant<ListItemPtr, ListSectionModel>;
 
 using ListSearchBarAccessory = std::variant<DropdownModel>;
 
@@ -40,6 +51,11 @@ struct ListModel {
   std::optional<QString> onSearchTextChange;
   std::optional<QString> searchText;
   std::vector<ListChild> items;
+  /**
+   * Text of every item (in model order, section children included) for the builtin filtering to match
+   * against. Only built when filtering is enabled, while parsing, so that it's done away from the UI thread.
+   */
+  std::shared_ptr<const SearchIndexText> filterIndex;
   std::optional<ActionPannelModel> actions;
   std::optional<EmptyViewModel> emptyView;
   std::optional<QString> selectedItemId;
@@ -47,12 +63,17 @@ struct ListModel {
   std::optional<ListSearchBarAccessory> searchBarAccessory;
 };
 
+using ListItemCache = NodeModelCache<ListItemViewModel>;
+
 class ListModelParser {
-  ListItemViewModel parseListItem(const QJsonObject &instance, size_t index);
+  ListItemCache *m_cache = nullptr;
+
+  ListItemPtr parseListItem(const QJsonObject &instance, size_t index);
   ListSectionModel parseSection(const QJsonObject &instance);
+  std::shared_ptr<const SearchIndexText> buildFilterIndex(const std::vector<ListChild> &items);
 
 public:
-  ListModelParser();
+  ListModelParser(ListItemCache *cache = nullptr);
 
   ListModel parse(const QJsonObject &instance);
 };
@@ -21,6 +21,8 @@ using MetadataItem = std::variant<MetadataLabel, MetadataLink, MetadataSeparator
 
 struct MetadataModel {
   QList<MetadataItem> children;
+  // of the JSON the children were parsed from, never 0
+  size_t hash = 1;
 };
 
 class MetadataModelParser {
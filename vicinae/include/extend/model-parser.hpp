@@ -23,7 +23,14 @@ struct ParsedRenderData {
   std::vector<RenderRoot> items;
 };
 
+/**
+ * Parsers kept from one frame to the next share what did not change between them with the previous frame,
+ * see `NodeModelCache`.
+ */
 class ModelParser {
+  ListItemCache m_listItems;
+  GridItemCache m_gridItems;
+
 public:
   ModelParser();
 
@@ -0,0 +1,64 @@
+#pragma once
+#include <memory>
+#include <qjsonobject.h>
+#include <qjsonvalue.h>
+#include <unordered_map>
+
+/**
+ * Items parsed from the previous frame, by the id of the node they were parsed from (see
+ * `RetainedRenderTree`). Items whose props and children are still the same are reused as is instead of
+ * being parsed again, which makes them the same pointer as in the previous model: lists and grids compare
+ * them by pointer and leave their rows alone.
+ *
+ * Items that are not seen for a frame are forgotten, such as the ones of views that are not rendered again.
+ */
+template <typename T> class NodeModelCache {
+public:
+  using Ptr = std::shared_ptr<const T>;
+
+  /**
+   * The item previously parsed from `node`, if it did not change and still has `id`.
+   */
+  Ptr reuse(const QJsonObject &node, const QString &id) {
+    auto it = m_previous.find(node.value("nodeId").toInteger(-1));
+
+    if (it == m_previous.end() || it->second.item->id != id) return nullptr;
+    // shared with the previous frame when the node did not change, which compares right away
+    if (it->second.props != node.value("props") || it->second.children != node.value("children")) {
+      return nullptr;
+    }
+
+    auto item = it->second.item;
+
+    m_current.insert(m_previous.extract(it));
+
+    return item;
+  }
+
+  void insert(const QJsonObject &node, Ptr item) {
+    auto nodeId = node.value("nodeId").toInteger(-1);
+
+    if (nodeId < 0) return;
+
+    m_current[nodeId] =
+        Entry{.props = node.value("props"), .children = node.value("children"), .item = std::move(item)};
+  }
+
+  /**
+   * To be called once a frame is parsed.
+   */
+  void endFrame() {
+    m_previous = std::move(m_current);
+    m_current.clear();
+  }
+
+private:
+  struct Entry {
+    QJsonValue props;
+    QJsonValue children;
+    Ptr item;
+  };
+
+  std::unordered_map<qint64, Entry> m_previous;
+  std::unordered_map<qint64, Entry> m_current;
+};
@@ -0,0 +1,75 @@
+#pragma once
+#include "lib/proto-string.hpp"
+#include "proto/ui.pb.h"
+#include <cstdint>
+#include <qjsonarray.h>
+#include <qjsonobject.h>
+#include <qstring.h>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Copy of the render tree of an extension, kept in sync with the one of its reconciler by applying the
+ * changes it sends after every commit (insert, move, remove, update and clear operations on nodes referred
+ * to by id), so that only what changed has to be sent and parsed. Props are decoded straight from their
+ * protobuf values.
+ *
+ * Nodes keep track of whether they changed since the last call to `views`, the same way the reconciler
+ * used to: inserted nodes are dirty and props dirty, updated nodes are props dirty and any change makes
+ * the ancestors of the changed node dirty. The JSON of unchanged subtrees is reused from the previous call.
+ *
+ * Every node is serialized along with its id, as `nodeId`, for what is parsed from it to be reused by
+ * identity while it does not change.
+ */
+class RetainedRenderTree {
+public:
+  using NodeId = int64_t;
+
+  static constexpr NodeId ROOT_ID = 0;
+
+  using Operations = google::protobuf::RepeatedPtrField<proto::ext::ui::RenderOperation>;
+
+  /**
+   * Apply `ops` in order. Returns false if one of them refers to a node that is not part of the tree, in
+   * which case the remaining ones are not applied.
+   */
+  bool apply(const Operations &ops);
+
+  /**
+   * JSON of the children of the root, as expected by `ModelParser::parse`. Changes are only reported once.
+   */
+  QJsonArray views();
+
+  void clear();
+
+  RetainedRenderTree();
+
+private:
+  struct Node {
+    QString type;
+    QJsonObject props;
+    NodeId parent = -1;
+    std::vector<NodeId> children;
+    bool dirty = true;
+    bool propsDirty = true;
+    // JSON of the subtree as of the last call to views, only valid if the node did not change since
+    QJsonObject serialized;
+  };
+
+  std::unordered_map<NodeId, Node> m_nodes;
+  // the same few types are sent over and over
+  ProtoString::Pool m_types;
+
+  bool insert(const proto::ext::ui::InsertNodeOperation &op);
+  bool move(const proto::ext::ui::MoveNodeOperation &op);
+  bool remove(const proto::ext::ui::RemoveNodeOperation &op);
+  bool update(const proto::ext::ui::UpdateNodeOperation &op);
+  bool clearChildren(NodeId id);
+
+  bool placeChild(Node &parent, NodeId id, std::optional<NodeId> before);
+  void addSubtree(NodeId parent, const proto::ext::ui::RenderNode &node);
+  void eraseSubtree(NodeId id);
+  void markDirty(NodeId id);
+  QJsonObject serialize(NodeId id, Node &node);
+};
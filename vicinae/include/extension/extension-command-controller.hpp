@@ -1,17 +1,92 @@
 #pragma once
 #include "extension/manager/extension-manager.hpp"
+#include <chrono>
+#include <functional>
+#include <qtimer.h>
+#include <unordered_map>
 
 class ExtensionCommandController {
+  // a search text is considered handled once the command renders, or if it did not after that long
+  static constexpr auto SEARCH_ACK_TIMEOUT = std::chrono::milliseconds(100);
+
   ExtensionManager *m_manager = nullptr;
   QString m_sessionId;
+  QTimer m_searchAckTimer;
+  bool m_searchInFlight = false;
+  // latest search text of every handler, held while the command handles the one in flight
+  std::unordered_map<QString, QString> m_heldSearches;
+  std::function<void()> m_searchUnanswered;
+
+  void sendSearchText(const QString &handlerId, const QString &text) {
+    m_manager->emitGenericExtensionEvent(m_sessionId, handlerId, {text}, true);
+    m_searchInFlight = true;
+    m_searchAckTimer.start();
+  }
+
+  void sendHeldSearches() {
+    auto held = std::move(m_heldSearches);
+
+    m_heldSearches.clear();
+    for (const auto &[handlerId, text] : held) {
+      sendSearchText(handlerId, text);
+    }
+  }
 
 public:
   void setSessionId(const QString &id) { m_sessionId = id; }
   void notify(const QString &handlerId, const QJsonArray &args) {
-    QJsonObject payload;
-
     m_manager->emitGenericExtensionEvent(m_sessionId, handlerId, args);
   }
 
-  ExtensionCommandController(ExtensionManager *manager) : m_manager(manager) {}
+  /**
+   * Notify a change of the search text, of which only the latest one matters. The command handles one at a
+   * time: changes made while it has not rendered since the previous one are coalesced into the latest, and
+   * the worker drops the ones superseded before it got to them.
+   */
+  void notifySearchText(const QString &handlerId, const QString &text) {
+    if (m_searchInFlight) {
+      m_heldSearches[handlerId] = text;
+      return;
+    }
+
+    sendSearchText(handlerId, text);
+  }
+
+  /**
+   * To be called for every frame the command renders, which acknowledges the search text in flight. Returns
+   * whether a newer search text was sent, the frame being for one that is already out of date.
+   */
+  bool frameReceived() {
+    if (!m_searchInFlight) return false;
+
+    m_searchInFlight = false;
+    m_searchAckTimer.stop();
+
+    if (m_heldSearches.empty()) return false;
+
+    sendHeldSearches();
+
+    return true;
+  }
+
+  /**
+   * Called when the command did not render after being sent a search text, as the frames that were out of
+   * date are then the latest ones.
+   */
+  void setSearchUnansweredHandler(std::function<void()> handler) { m_searchUnanswered = std::move(handler); }
+
+  ExtensionCommandController(ExtensionManager *manager) : m_manager(manager) {
+    m_searchAckTimer.setSingleShot(true);
+    m_searchAckTimer.setInterval(SEARCH_ACK_TIMEOUT);
+    m_searchAckTimer.callOnTimeout([this]() {
+      m_searchInFlight = false;
+
+      if (m_heldSearches.empty()) {
+        if (m_searchUnanswered) m_searchUnanswered();
+        return;
+      }
+
+      sendHeldSearches();
+    });
+  }
 };
@@ -16,10 +16,17 @@
 #include <qtimer.h>
 
 class ExtensionGridItem : public OmniGrid::AbstractGridItem {
-  GridItemViewModel _item;
+  GridItemPtr _item;
   double m_aspectRatio = 1;
 
-  QString generateId() const override { return _item.id; }
+  QString generateId() const override { return _item->id; }
+
+  // items that did not change since the previous frame are shared with it
+  bool hasSameContent(const AbstractVirtualItem &previous) const override {
+    auto item = dynamic_cast<const ExtensionGridItem *>(&previous);
+
+    return item && item->_item == _item && item->m_aspectRatio == m_aspectRatio && item->inset() == inset();
+  }
 
   QWidget *centerWidget() const override {
     auto icon = new ImageWidget;
@@ -34,12 +41,12 @@ class ExtensionGridItem : public OmniGrid::AbstractGridItem {
         overloads{[](const ImageLikeModel &model) { return QString(""); },
                   [](const ImageContentWithTooltip &model) { return model.tooltip.value_or(""); }};
 
-    return std::visit(visitor, _item.content);
+    return std::visit(visitor, _item->content);
   }
 
-  QString title() const override { return _item.title; }
+  QString title() const override { return _item->title; }
 
-  QString subtitle() const override { return _item.subtitle; }
+  QString subtitle() const override { return _item->subtitle; }
 
   void recycleCenterWidget(QWidget *widget) const override { refreshCenterWidget(widget); }
 
@@ -50,18 +57,19 @@ class ExtensionGridItem : public OmniGrid::AbstractGridItem {
     const auto visitor = overloads{[](const ImageLikeModel &model) { return model; },
                                    [](const ImageContentWithTooltip &model) { return model.value; }};
 
-    icon->setUrl(std::visit(visitor, _item.content));
+    icon->setUrl(std::visit(visitor, _item->content));
   }
 
-  const QString &name() const { return _item.title; }
+  const QString &name() const { return _item->title; }
 
   double aspectRatio() const override { return m_aspectRatio; }
 
 public:
-  const GridItemViewModel &model() const { return _item; }
+  const GridItemViewModel &model() const { return *_item; }
+  const GridItemPtr &sharedModel() const { return _item; }
 
-  ExtensionGridItem(const GridItemViewModel &model, double aspectRatio = 1)
-      : _item(model), m_aspectRatio(aspectRatio) {}
+  ExtensionGridItem(GridItemPtr model, double aspectRatio = 1)
+      : _item(std::move(model)), m_aspectRatio(aspectRatio) {}
 };
 
 class ExtensionGridList : public QWidget {
@@ -81,7 +89,7 @@ class ExtensionGridList : public QWidget {
   }
 
   void render(OmniList::SelectionPolicy selectionPolicy) {
-    auto matches = [&](const GridItemViewModel &item) { return matchesFilter(item, m_filter); };
+    auto matches = [&](const GridItemPtr &item) { return matchesFilter(*item, m_filter); };
     std::vector<std::shared_ptr<OmniList::AbstractVirtualItem>> currentSectionItems;
     auto appendSectionLess = [&]() {
       if (!currentSectionItems.empty()) {
@@ -97,7 +105,7 @@ class ExtensionGridList : public QWidget {
     m_list->updateModel(
         [&]() {
           for (const auto &item : m_model) {
-            if (auto listItem = std::get_if<GridItemViewModel>(&item)) {
+            if (auto listItem = std::get_if<GridItemPtr>(&item)) {
               if (!matches(*listItem)) continue;
               currentSectionItems.emplace_back(std::static_pointer_cast<OmniList::AbstractVirtualItem>(
                   std::make_shared<ExtensionGridItem>(*listItem)));
@@ -161,6 +169,7 @@ public:
 
     connect(m_list, &OmniList::selectionChanged, this, &ExtensionGridList::handleSelectionChanged);
     connect(m_list, &OmniList::itemActivated, this, &ExtensionGridList::handleItemActivated);
+    connect(m_list, &OmniList::scrolledNearEnd, this, &ExtensionGridList::scrolledNearEnd);
   }
 
   void setColumns(int cols) {
@@ -181,10 +190,13 @@ public:
   bool selectLeft() { return m_list->selectLeft(); }
   bool selectRight() { return m_list->selectRight(); }
   void activateCurrentSelection() const { m_list->activateCurrentSelection(); }
+  void setNearEndThreshold(size_t items) { m_list->setNearEndThreshold(items); }
 
-  GridItemViewModel const *selected() const {
+  GridItemPtr selected() const {
     if (auto selected = m_list->selected()) {
-      if (auto qualified = dynamic_cast<ExtensionGridItem const *>(selected)) { return &qualified->model(); }
+      if (auto qualified = dynamic_cast<ExtensionGridItem const *>(selected)) {
+        return qualified->sharedModel();
+      }
     }
 
     return nullptr;
@@ -194,6 +206,9 @@ public:
 
   void setModel(const std::vector<GridChild> &model,
                 OmniList::SelectionPolicy selection = OmniList::SelectFirst) {
+    // unchanged items are shared with the previous model, its props alone changed
+    if (selection == OmniList::PreserveSelection && model == m_model) return;
+
     m_model = model;
     render(selection);
   }
@@ -207,11 +222,14 @@ public:
 signals:
   void selectionChanged(const GridItemViewModel *);
   void itemActivated(const GridItemViewModel &);
+  void scrolledNearEnd();
 };
 
 class ExtensionGridComponent : public ExtensionSimpleView {
   GridModel _model;
   ExtensionGridList *m_list = new ExtensionGridList;
+  // selected item as of the last render, whose actions are shown
+  GridItemPtr m_renderedSelection;
   bool _shouldResetSelection;
   QTimer *_debounce;
 
@@ -220,6 +238,7 @@ public:
   void onSelectionChanged(const GridItemViewModel *item);
   void onItemActivated(const GridItemViewModel &item);
   void handleDebouncedSearchNotification();
+  void handleScrolledNearEnd();
   void textChanged(const QString &text) override;
   bool inputFilter(QKeyEvent *event) override;
 
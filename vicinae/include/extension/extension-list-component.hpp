@@ -1,9 +1,13 @@
 #pragma once
 #include "extend/list-model.hpp"
 #include <memory>
+#include <numeric>
 #include <qdebug.h>
 #include "extension/extension-list-detail.hpp"
 #include "extension/extension-view.hpp"
+#include "lib/incremental-search-cache.hpp"
+#include "lib/search-index.hpp"
+#include "lib/text-tokenizer.hpp"
 #include "ui/form/selector-input.hpp"
 #include "ui/omni-list/omni-list.hpp"
 #include "ui/split-detail/split-detail.hpp"
@@ -19,77 +23,143 @@
 class AppWindow;
 
 class ExtensionListItem : public AbstractDefaultListItem {
-  ListItemViewModel _item;
+  ListItemPtr m_item;
 
   ItemData data() const override {
     return {
-        .iconUrl = _item.icon,
-        .name = _item.title,
-        .subtitle = _item.subtitle,
+        .iconUrl = m_item->icon,
+        .name = m_item->title,
+        .subtitle = m_item->subtitle,
     };
   }
 
   bool hasPartialUpdates() const override { return true; }
 
-  QString generateId() const override { return _item.id; }
+  // items that did not change since the previous frame are shared with it
+  bool hasSameContent(const AbstractVirtualItem &previous) const override {
+    auto item = dynamic_cast<const ExtensionListItem *>(&previous);
+
+    return (item && item->m_item == m_item) || AbstractDefaultListItem::hasSameContent(previous);
+  }
+
+  QString generateId() const override { return m_item->id; }
 
 public:
-  const ListItemViewModel &model() const { return _item; }
+  const ListItemViewModel &model() const { return *m_item; }
+  const ListItemPtr &sharedModel() const { return m_item; }
 
-  ExtensionListItem(const ListItemViewModel &model) : _item(model) {}
+  ExtensionListItem(ListItemPtr model) : m_item(std::move(model)) {}
 };
 
 class ExtensionList : public QWidget {
   Q_OBJECT
 
   OmniList *m_list = new OmniList;
-  std::vector<ListChild> m_model;
+  std::shared_ptr<const std::vector<ListChild>> m_model = std::make_shared<std::vector<ListChild>>();
+  std::shared_ptr<const SearchIndexText> m_filterIndex;
   QString m_filter;
+  // positions (in model order) of the items that matched the last filter
+  IncrementalSearchCache<uint32_t> m_filterCache;
+
+  size_t itemCount() const {
+    size_t count = 0;
 
-  bool matchesFilter(const ListItemViewModel &item, const QString &query) {
-    // TODO: use better search algorithm if we run into issues
-    return item.title.contains(query, Qt::CaseInsensitive) ||
-           item.subtitle.contains(query, Qt::CaseInsensitive);
+    for (const auto &item : *m_model) {
+      if (auto section = std::get_if<ListSectionModel>(&item)) {
+        count += section->children.size();
+      } else {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * Score of every item (in model order) against the filter, negative for the ones not matching it. Empty
+   * if there is nothing to filter.
+   */
+  std::vector<double> scoreItems() {
+    QString query = TextTokenizer::normalize(QStringView(m_filter).trimmed());
+
+    if (query.isEmpty() || !m_filterIndex) return {};
+
+    std::vector<double> scores(itemCount(), -1);
+    std::vector<uint32_t> all;
+    auto candidates = m_filterCache.candidates(query);
+
+    if (!candidates) {
+      all.resize(std::min(scores.size(), m_filterIndex->size()));
+      std::iota(all.begin(), all.end(), 0);
+    }
+
+    std::vector<uint32_t> matched;
+    auto matches = m_filterIndex->match(query, candidates ? *candidates : all);
+
+    matched.reserve(matches.size());
+
+    for (const auto &match : matches) {
+      scores[match.index] = match.score;
+      matched.emplace_back(match.index);
+    }
+
+    // shorter queries are not fuzzily matched, longer ones could match items they did not
+    if (query.size() >= SearchIndexText::MIN_FUZZY_QUERY_LENGTH) {
+      m_filterCache.update(query, std::move(matched));
+    }
+
+    return scores;
   }
 
   void render(OmniList::SelectionPolicy selectionPolicy) {
-    auto matches = [&](const ListItemViewModel &item) { return matchesFilter(item, m_filter); };
-    std::vector<std::shared_ptr<OmniList::AbstractVirtualItem>> currentSectionItems;
-    auto appendSectionLess = [&]() {
-      if (!currentSectionItems.empty()) {
-        auto &listSection = m_list->addSection();
-
-        listSection.addItems(currentSectionItems);
-        currentSectionItems.clear();
+    auto scores = scoreItems();
+    bool filtering = !scores.empty();
+    uint32_t position = 0;
+    // matching items of the current section (or run of section-less items), ranked by score when filtering
+    std::vector<std::pair<double, const ListItemPtr *>> matches;
+
+    auto collect = [&](const ListItemPtr &item) {
+      uint32_t idx = position++;
+
+      if (!filtering) {
+        matches.emplace_back(0, &item);
+      } else if (scores[idx] >= 0) {
+        matches.emplace_back(scores[idx], &item);
       }
     };
+    auto flush = [&](const QString &title) {
+      if (matches.empty()) return;
 
-    m_list->updateModel(
-        [&]() {
-          for (const auto &item : m_model) {
-            if (auto listItem = std::get_if<ListItemViewModel>(&item)) {
-              if (!matches(*listItem)) continue;
-              currentSectionItems.emplace_back(std::static_pointer_cast<OmniList::AbstractVirtualItem>(
-                  std::make_shared<ExtensionListItem>(*listItem)));
+      std::vector<std::unique_ptr<OmniList::AbstractVirtualItem>> items;
 
-            } else if (auto section = std::get_if<ListSectionModel>(&item)) {
-              appendSectionLess();
+      if (filtering) {
+        std::ranges::stable_sort(matches, std::greater{}, [](const auto &match) { return match.first; });
+      }
 
-              auto items =
-                  section->children | std::views::filter(matches) |
-                  std::views::transform([](auto &&item) -> std::unique_ptr<OmniList::AbstractVirtualItem> {
-                    return std::make_unique<ExtensionListItem>(item);
-                  }) |
-                  std::ranges::to<std::vector>();
+      items.reserve(matches.size());
 
-              if (items.empty()) continue;
+      for (const auto &[score, item] : matches) {
+        items.emplace_back(std::make_unique<ExtensionListItem>(*item));
+      }
 
-              auto &sec = m_list->addSection(section->title);
+      m_list->addSection(title).addItems(std::move(items));
+      matches.clear();
+    };
 
-              sec.addItems(std::move(items));
+    m_list->updateModel(
+        [&]() {
+          for (const auto &item : *m_model) {
+            if (auto listItem = std::get_if<ListItemPtr>(&item)) {
+              collect(*listItem);
+            } else if (auto section = std::get_if<ListSectionModel>(&item)) {
+              flush({});
+              for (const auto &child : section->children) {
+                collect(child);
+              }
+              flush(section->title);
             }
           }
-          appendSectionLess();
+          flush({});
         },
         selectionPolicy);
   }
@@ -116,21 +186,26 @@ public:
   ExtensionList() {
     auto layout = new QVBoxLayout;
 
+    m_list->setRowRendering(OmniList::PaintedRows);
     layout->setContentsMargins(0, 0, 0, 0);
     layout->addWidget(m_list);
     setLayout(layout);
 
     connect(m_list, &OmniList::selectionChanged, this, &ExtensionList::handleSelectionChanged);
     connect(m_list, &OmniList::itemActivated, this, &ExtensionList::handleItemActivated);
+    connect(m_list, &OmniList::scrolledNearEnd, this, &ExtensionList::scrolledNearEnd);
   }
 
   bool selectUp() { return m_list->selectUp(); }
   bool selectDown() { return m_list->selectDown(); }
   void activateCurrentSelection() const { m_list->activateCurrentSelection(); }
+  void setNearEndThreshold(size_t items) { m_list->setNearEndThreshold(items); }
 
-  ListItemViewModel const *selected() const {
+  ListItemPtr selected() const {
     if (auto selected = m_list->selected()) {
-      if (auto qualified = dynamic_cast<ExtensionListItem const *>(selected)) { return &qualified->model(); }
+      if (auto qualified = dynamic_cast<ExtensionListItem const *>(selected)) {
+        return qualified->sharedModel();
+      }
     }
 
     return nullptr;
@@ -138,9 +213,18 @@ public:
 
   bool empty() const { return m_list->virtualHeight() == 0; }
 
-  void setModel(const std::vector<ListChild> &model,
+  /**
+   * `filterIndex` holds the text of the items of `model` (see `ListModel::filterIndex`), items are not
+   * filtered without it.
+   */
+  void setModel(const std::vector<ListChild> &model, std::shared_ptr<const SearchIndexText> filterIndex,
                 OmniList::SelectionPolicy selection = OmniList::SelectFirst) {
-    m_model = model;
+    // unchanged items are shared with the previous model, and so is the text they are filtered by
+    if (selection == OmniList::PreserveSelection && model == *m_model) return;
+
+    m_model = std::make_shared<const std::vector<ListChild>>(model);
+    m_filterIndex = std::move(filterIndex);
+    m_filterCache.invalidate();
     render(selection);
   }
   void setFilter(const QString &query) {
@@ -153,6 +237,7 @@ public:
 signals:
   void selectionChanged(const ListItemViewModel *);
   void itemActivated(const ListItemViewModel &);
+  void scrolledNearEnd();
 };
 
 class ExtensionListComponent : public ExtensionSimpleView {
@@ -161,15 +246,17 @@ class ExtensionListComponent : public ExtensionSimpleView {
   ExtensionListDetail *m_detail = new ExtensionListDetail;
   ListModel _model;
   ExtensionList *m_list = new ExtensionList;
+  // selected item as of the last render, whose detail and actions are shown
+  ListItemPtr m_renderedSelection;
   bool _shouldResetSelection;
   QTimer *_debounce;
-  QTimer *m_dropdownDebounce = new QTimer(this);
   bool m_dropdownShouldResetSelection = false;
   int m_renderCount = 0;
 
   void renderDropdown(const DropdownModel &dropdown);
   void handleDropdownSelectionChanged(const SelectorInput::AbstractItem &item);
   void handleDropdownSearchChanged(const QString &text);
+  void handleScrolledNearEnd();
 
   QWidget *searchBarAccessory() const override { return m_selector; }
 
@@ -34,32 +34,27 @@ class ExtensionListDetail : public QWidget {
     connect(m_metadata, &VerticalScrollArea::widgetResized, this, &ExtensionListDetail::recalculateMetadata);
   };
 
+  void setMetadata(const MetadataModel &metadata) {
+    bool hasMeta = !metadata.children.isEmpty();
+
+    // the widgets of metadata shown a moment ago are reused, as documents are by the markdown renderer
+    m_metadata->setMetadata(metadata.children | std::ranges::to<std::vector>(), metadata.hash);
+    m_metadata->setVisible(hasMeta);
+    m_divider->setVisible(hasMeta);
+    if (hasMeta) { recalculateMetadata(); }
+  }
+
 public:
   ExtensionListDetail() { setupUI(); }
 
   void setDetail(const DetailModel &model) {
     markdownRenderer->setMarkdown(model.markdown);
-    m_metadata->setMetadata(model.metadata.children | std::ranges::to<std::vector>());
-    bool hasMeta = !model.metadata.children.isEmpty();
-
-    m_metadata->setVisible(hasMeta);
-    m_divider->setVisible(hasMeta);
+    setMetadata(model.metadata);
   }
 
   void updateDetail(const DetailModel &model) {
-    // optimization to append markdown, particularily useful when content is streamed
-    if (model.markdown.startsWith(markdownRenderer->markdown())) {
-      auto appended = QStringView(model.markdown).sliced(markdownRenderer->markdown().size());
-
-      if (!appended.isEmpty()) { markdownRenderer->appendMarkdown(appended); }
-    } else {
-      markdownRenderer->setMarkdown(model.markdown);
-    }
-
-    bool hasMeta = !model.metadata.children.isEmpty();
-
-    m_metadata->setMetadata(model.metadata.children | std::ranges::to<std::vector>());
-    m_metadata->setVisible(hasMeta);
-    m_divider->setVisible(hasMeta);
+    // streamed content is appended by the renderer
+    markdownRenderer->setMarkdown(model.markdown);
+    setMetadata(model.metadata);
   }
 };
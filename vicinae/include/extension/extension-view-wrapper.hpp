@@ -32,6 +32,14 @@ class ExtensionViewWrapper : public BaseView {
     if (m_current) { m_current->activate(); }
   }
 
+  // the command stops rendering the views below the top of its stack on its own (see NavigationProvider)
+  void onSuspend() override {
+    if (m_current) m_current->suspend();
+  }
+  void onResume() override {
+    if (m_current) m_current->resume();
+  }
+
   bool inputFilter(QKeyEvent *event) override {
     if (auto view = m_current) return view->inputFilter(event);
 
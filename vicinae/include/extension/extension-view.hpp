@@ -3,10 +3,12 @@
 #include "ui/views/base-view.hpp"
 #include "extend/action-model.hpp"
 #include "extend/model-parser.hpp"
+#include "extend/pagination-model.hpp"
 #include "extension/extension-command-controller.hpp"
 #include "../../src/ui/image/url.hpp"
 #include "ui/action-pannel/action.hpp"
 #include "ui/views/simple-view.hpp"
+#include <algorithm>
 #include <qboxlayout.h>
 #include <qevent.h>
 #include <qjsonarray.h>
@@ -19,8 +21,10 @@
 class ExtensionSimpleView : public SimpleView {
   Q_OBJECT
 
-  ExtensionCommandController *m_controller;
+  ExtensionCommandController *m_controller = nullptr;
   std::vector<KeyboardShortcutModel> m_defaultActionShortcuts;
+  // the extension was asked for the next page, which was not rendered yet
+  bool m_pageRequested = false;
 
   AbstractAction *createActionFromModel(const ActionModel &model) {
     return new StaticAction(model.title, model.icon.value_or(std::monostate()), [this, model]() {
@@ -115,6 +119,40 @@ public:
     emit notificationRequested(handler, args);
   }
 
+  /**
+   * Send the new search text to the extension, coalesced with the previous ones it did not handle yet.
+   */
+  void notifySearchText(const QString &handler, const QString &text) const {
+    if (m_controller) m_controller->notifySearchText(handler, text);
+  }
+
+  /**
+   * Number of items from the end of the list at which the next page of `pagination` starts being loaded,
+   * for it to be there by the time the end is reached. 0 if there is nothing to load.
+   */
+  static size_t nearEndThreshold(const std::optional<PaginationModel> &pagination) {
+    if (!pagination || !pagination->hasMore || !pagination->onLoadMore) return 0;
+
+    return std::max<size_t>(1, pagination->pageSize / 2);
+  }
+
+  /**
+   * Ask the extension for the next page of `pagination`, once: the request is only made again after
+   * `pageReceived` is called.
+   */
+  void requestNextPage(const std::optional<PaginationModel> &pagination) {
+    if (m_pageRequested || nearEndThreshold(pagination) == 0) return;
+
+    m_pageRequested = true;
+    notify(*pagination->onLoadMore, {});
+  }
+
+  /**
+   * To be called when a render changes the items of the list, which is how the extension answers
+   * `requestNextPage`.
+   */
+  void pageReceived() { m_pageRequested = false; }
+
 signals:
   void notificationRequested(const QString &handler, const QJsonArray &args) const;
 };
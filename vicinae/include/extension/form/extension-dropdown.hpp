@@ -57,32 +57,33 @@ public:
       selectionPolicy = OmniList::SelectFirst;
     }
 
-    m_input->list()->updateModel(
-        [&]() {
-          OmniList::Section *currentSection = nullptr;
-
-          for (const auto &item : m_model->m_items) {
-            if (auto listItem = std::get_if<DropdownModel::Item>(&item)) {
-              if (!currentSection) { currentSection = &m_input->list()->addSection(); }
-
-              currentSection->addItem(std::make_unique<DropdownSelectorItem>(*listItem));
-            } else if (auto section = std::get_if<DropdownModel::Section>(&item)) {
-              auto &sec = m_input->list()->addSection(section->title);
-              auto items =
-                  section->items |
-                  std::views::transform([](auto &&item) -> std::unique_ptr<OmniList::AbstractVirtualItem> {
-                    return std::make_unique<DropdownSelectorItem>(item);
-                  }) |
-                  std::ranges::to<std::vector>();
-
-              sec.addItems(std::move(items));
-            }
-          }
-        },
-        selectionPolicy);
+    auto mapItem = [](auto &&item) -> std::shared_ptr<SelectorInput::AbstractItem> {
+      return std::make_shared<DropdownSelectorItem>(item);
+    };
+    std::vector<std::shared_ptr<SelectorInput::AbstractItem>> freeItems;
+
+    m_input->resetModel();
+
+    for (const auto &item : m_model->m_items) {
+      if (auto listItem = std::get_if<DropdownModel::Item>(&item)) {
+        freeItems.emplace_back(mapItem(*listItem));
+      } else if (auto section = std::get_if<DropdownModel::Section>(&item)) {
+        if (!freeItems.empty()) {
+          m_input->addSection("", freeItems);
+          freeItems.clear();
+        }
+
+        m_input->addSection(section->title,
+                            section->items | std::views::transform(mapItem) | std::ranges::to<std::vector>());
+      }
+    }
 
-    m_input->setIsLoading(m_model->isLoading);
+    if (!freeItems.empty()) { m_input->addSection("", freeItems); }
+
+    m_input->setSearchThrottled(m_model->throttle);
     m_input->setEnableDefaultFilter(m_model->filtering);
+    m_input->updateModel(selectionPolicy);
+    m_input->setIsLoading(m_model->isLoading);
 
     if (auto value = m_model->value) m_input->setValue(value->toString());
   }
@@ -1,5 +1,6 @@
 #pragma once
 #include "ui/image/url.hpp"
+#include <QCache>
 #include <QSqlError>
 #include <cassert>
 #include <expected>
@@ -11,14 +12,36 @@
 #include <qobject.h>
 #include <qpixmap.h>
 #include <qpixmapcache.h>
+#include <qpromise.h>
 #include <qsqldatabase.h>
 #include <qsqlquery.h>
 #include <qstringview.h>
+#include <qtimer.h>
+#include <chrono>
+#include <deque>
 #include <unordered_map>
 
+/**
+ * Favicons are kept in memory in an LRU bounded by their decoded size, and persisted as PNGs scaled down
+ * to at most STORED_SIZE in `favicon-data`, next to the database indexing them.
+ *
+ * Stored favicons are served right away, those older than REFRESH_TTL being fetched again in the
+ * background. Domains that have no favicon are remembered for MISS_TTL so that lists showing them do not
+ * go through the network on every render.
+ *
+ * Domains that are likely to be shown soon can be prefetched: those that are neither stored nor known to
+ * be missing are fetched in the background, a few at a time, so that their favicons are on disk by the
+ * time they are needed.
+ */
 class FaviconService : public QObject {
-  // TODO: limit cache based on storage size not number of elements
-  static constexpr size_t maxCacheCount = 50;
+  static constexpr qsizetype MAX_CACHE_BYTES = 8 * 1024 * 1024;
+  static constexpr int STORED_SIZE = 64;
+  static constexpr qint64 REFRESH_TTL = 7 * 24 * 60 * 60;
+  // short enough for domains that only failed because we were offline to be tried again soon
+  static constexpr qint64 MISS_TTL = 6 * 60 * 60;
+  // prefetching is not worth hammering the provider for, it is never urgent
+  static constexpr size_t MAX_PREFETCH_IN_FLIGHT = 4;
+  static constexpr auto PREFETCH_INTERVAL = std::chrono::milliseconds(250);
 
 public:
   using FaviconResponse = std::expected<QPixmap, QString>;
@@ -37,11 +60,23 @@ private:
   QSqlDatabase _db;
   RequesterType _requesterType;
   QDir _dataDir;
-  std::unordered_map<QString, QPixmap> _cache;
+  QCache<QString, QPixmap> _cache;
+  // domains with no favicon, with the time they were last checked at
+  std::unordered_map<QString, qint64> _misses;
+  // requests being fetched, a background refresh having no promise waiting on it
+  std::unordered_map<QString, std::vector<QPromise<FaviconResponse>>> _pending;
+  std::deque<QString> _prefetchQueue;
+  QTimer *_prefetchTimer = new QTimer(this);
 
   void handleFetchedFavicon(const QString &domain, const QPixmap &favicon);
+  void handleMissingFavicon(const QString &domain);
   void insertCache(const QString &key, const QPixmap &favicon);
   QPixmap retrieveFromCache(const QString &domain);
+  bool isMissing(const QString &domain) const;
+  bool isStored(const QString &domain) const;
+  void startRequest(const QString &domain);
+  void loadMisses();
+  void prefetchNext();
 
 public:
   static std::vector<FaviconServiceData> providers();
@@ -51,6 +86,12 @@ public:
   void setService(RequesterType type);
   void setService(const QString &id);
 
-  QFuture<FaviconResponse> makeRequest(const QString &domain, QObject *parent = nullptr);
+  QFuture<FaviconResponse> makeRequest(const QString &domain);
+
+  /**
+   * Queue `domains` for their favicons to be fetched in the background, if they are not already stored.
+   * Requests made for a domain while it is being prefetched share the same fetch.
+   */
+  void prefetch(const std::vector<QString> &domains);
   FaviconService(const std::filesystem::path &path, QObject *parent = nullptr);
 };
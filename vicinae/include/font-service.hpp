@@ -1,41 +1,98 @@
 #pragma once
-#include "trie.hpp"
+#include "lib/search-index.hpp"
+#include <map>
+#include <optional>
+#include <vector>
 #include <cstdlib>
 #include <qfont.h>
 #include <qfontdatabase.h>
 #include <qfontinfo.h>
+#include <qfuturewatcher.h>
 #include <qhash.h>
+#include <qobject.h>
 #include <qstring.h>
 #include <qlist.h>
 #include <qdebug.h>
+#include <qtmetamacros.h>
 
-class FontService {
+/**
+ * Fonts installed on the system, with the font catalog enumerated once on a background thread.
+ *
+ * Enumerating the families of every writing system is slow on systems with thousands of fonts, so the
+ * catalog is also cached on disk. The cache is only used as long as the fontconfig caches were not
+ * updated since it was written, which is what happens when fonts are installed or removed.
+ */
+class FontService : public QObject {
+  Q_OBJECT
+
+public:
+  struct WritingSystemFamilies {
+    QFontDatabase::WritingSystem system;
+    QStringList families;
+  };
+
+  struct Catalog {
+    QStringList families;
+    std::vector<WritingSystemFamilies> writingSystems;
+  };
+
+private:
   QFont m_emojiFont;
+  std::optional<Catalog> m_catalog;
+  QFutureWatcher<Catalog> m_catalogWatcher;
+
   QFont findEmojiFont();
 
+  static Catalog loadCatalog();
+  static Catalog enumerateCatalog();
+  static std::optional<Catalog> readCatalogCache(qint64 key);
+  static void writeCatalogCache(const Catalog &catalog, qint64 key);
+
+  /**
+   * The last time a fontconfig cache directory was modified, in seconds since epoch.
+   */
+  static qint64 fontconfigCacheKey();
+
 public:
   const QFont &emojiFont() const { return m_emojiFont; }
-  QStringList families() const { return QFontDatabase::families(); }
 
-  Trie<QString> buildFontSearchIndex() {
-    Trie<QString> trie;
+  /**
+   * Every installed family, read from the catalog once it is loaded.
+   */
+  QStringList families() const;
+
+  /**
+   * The font catalog, or nullptr until it is loaded. `catalogLoaded` is emitted once it is.
+   */
+  const Catalog *catalog() const;
 
-    for (const auto &system : QFontDatabase::writingSystems()) {
-      std::string sname = QFontDatabase::writingSystemName(system).toStdString();
+  /**
+   * Families by name, then by the writing systems they support.
+   */
+  static SearchIndex<QString> buildFontSearchIndex(const Catalog &catalog) {
+    // families supporting several writing systems are listed by each of them, they are only indexed once
+    std::map<QString, QStringList> systems;
+    SearchIndex<QString> index;
 
-      for (const auto &family : QFontDatabase::families(system)) {
-        trie.index(sname, family);
+    for (const auto &[system, families] : catalog.writingSystems) {
+      QString sname = QFontDatabase::writingSystemName(system);
 
-        if (system == QFontDatabase::WritingSystem::Latin) {
-          trie.indexLatinText(family.toStdString(), family);
-        } else {
-          trie.index(family.toStdString(), family);
-        }
+      for (const auto &family : families) {
+        systems[family] << sname;
       }
     }
 
-    return trie;
+    index.reserve(systems.size());
+
+    for (const auto &[family, names] : systems) {
+      index.add(family, {family, names.join(' ')});
+    }
+
+    return index;
   }
 
   FontService();
+
+signals:
+  void catalogLoaded() const;
 };
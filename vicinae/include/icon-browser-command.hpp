@@ -3,6 +3,7 @@
 #include "ui/views/base-view.hpp"
 #include "../src/ui/image/url.hpp"
 #include "ui/image/image.hpp"
+#include "lib/search-index.hpp"
 #include "ui/omni-grid/omni-grid.hpp"
 #include "ui/omni-list/omni-list.hpp"
 #include <qlabel.h>
@@ -48,11 +49,11 @@ class IconBrowserView : public GridView {
     IconBrowserItem(const QString &name) : _name(name) {}
   };
 
+  SearchIndex<QString> m_index;
+
   void textChanged(const QString &s) override {
-    int inset = 20;
-    auto filter = [&](const QString &name) { return name.contains(s, Qt::CaseInsensitive); };
-    auto makeIcon = [&](auto &&icon) -> std::unique_ptr<OmniList::AbstractVirtualItem> {
-      auto item = std::make_unique<IconBrowserItem>(icon);
+    auto makeIcon = [&](const auto &result) -> std::unique_ptr<OmniList::AbstractVirtualItem> {
+      auto item = std::make_unique<IconBrowserItem>(*result.item);
 
       item->setInset(GridItemContentWidget::Inset::Large);
       return item;
@@ -65,14 +66,23 @@ class IconBrowserView : public GridView {
       section.setSpacing(10);
       m_grid->setInset(GridItemContentWidget::Inset::Large);
 
-      auto items = BuiltinIconService::icons() | std::views::filter(filter) |
-                   std::views::transform(makeIcon) | std::ranges::to<std::vector>();
+      auto items = m_index.search(s) | std::views::transform(makeIcon) | std::ranges::to<std::vector>();
 
       section.addItems(std::move(items));
     });
   }
 
-  void initialize() override { textChanged(searchText()); }
+  void initialize() override {
+    const auto &icons = BuiltinIconService::icons();
+
+    m_index.reserve(icons.size());
+
+    for (const auto &icon : icons) {
+      m_index.add(icon, {icon});
+    }
+
+    textChanged(searchText());
+  }
 
 public:
   IconBrowserView() { setSearchPlaceholderText("Search builtin icons..."); }
@@ -1,4 +1,19 @@
 #pragma once
 #include <qstring.h>
+#include <qstringview.h>
+#include <span>
+#include <vector>
 
-bool isEmoji(const QString &emoji);
+/**
+ * Whether `str` is only made of emojis, including their sequences: modifiers, variation selectors, ZWJ
+ * sequences, keycaps and flags (regional indicator pairs and tag sequences).
+ *
+ * This looks UTF-16 code units up directly in a precomputed table and never allocates, so that it can be
+ * called for every row of a list.
+ */
+bool isEmoji(QStringView str);
+
+/**
+ * `isEmoji` for every string of `strings`, in the same order.
+ */
+std::vector<bool> classifyEmojis(std::span<const QString> strings);
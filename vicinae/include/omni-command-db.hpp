@@ -7,6 +7,9 @@
 #include <qobject.h>
 #include <qsqlquery.h>
 #include <qtmetamacros.h>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
 
 struct CommandDbEntry {
   std::shared_ptr<AbstractCmd> command;
@@ -20,17 +23,27 @@ class OmniCommandDatabase : public QObject {
   Q_OBJECT
 
   std::vector<CommandDbEntry> entries;
-  std::vector<std::shared_ptr<AbstractCommandRepository>> repositories;
+  std::unordered_map<QString, std::shared_ptr<AbstractCommandRepository>> repositories;
+  // unique ids of the commands of `entries`
+  std::unordered_set<QString> commandIds;
 
   const AbstractCommandRepository *findRepository(const QString &id) {
-    for (const auto &repo : repositories) {
-      if (repo->id() == id) return repo.get();
-    }
+    auto it = repositories.find(id);
 
-    return nullptr;
+    return it != repositories.end() ? it->second.get() : nullptr;
+  }
+
+  void removeCommands(const std::unordered_set<QString> &repositoryIds) {
+    std::erase_if(entries, [&](const CommandDbEntry &entry) {
+      if (!repositoryIds.contains(entry.repositoryId)) return false;
+      commandIds.erase(entry.command->uniqueId());
+      return true;
+    });
   }
 
 public:
+  using RepositoryList = std::vector<std::shared_ptr<AbstractCommandRepository>>;
+
   std::vector<CommandDbEntry> commands() const { return entries; }
 
   OmniCommandDatabase() {}
@@ -57,13 +70,7 @@ public:
     return nullptr;
   }
 
-  bool hasCommand(const QString &id) const {
-    for (const auto &cmd : entries) {
-      if (cmd.command->uniqueId() == id) return true;
-    }
-
-    return false;
-  }
+  bool hasCommand(const QString &id) const { return commandIds.contains(id); }
 
   void registerCommand(const QString &repositoryId, const std::shared_ptr<AbstractCmd> &cmd) {
     // qDebug() << "registering command with id" << cmd->uniqueId();
@@ -79,41 +86,78 @@ public:
 
       // TODO: use something better
       entries.insert(entries.begin(), entry);
+      commandIds.insert(cmd->uniqueId());
       emit commandRegistered(entry);
     }
   }
 
   void removeRepository(const QString &id) {
-    if (auto it = std::ranges::find_if(repositories, [&](auto &&repo) { return repo->id() == id; });
-        it != repositories.end()) {
-      repositories.erase(it);
+    if (repositories.erase(id)) {
+      removeCommands({id});
       emit repositoryRemoved(id);
     }
   }
 
-  void registerRepository(const std::shared_ptr<AbstractCommandRepository> &repository) {
-    for (const auto &cmd : repository->commands()) {
-      registerCommand(repository->id(), cmd);
+  /**
+   * Register the commands of every repository of `batch` in one pass, with a single
+   * `repositoriesRegistered` for all of them. A repository with the same id as a registered one is replaced
+   * along with its commands, which leaves the other repositories untouched.
+   */
+  void registerRepositories(std::span<const std::shared_ptr<AbstractCommandRepository>> batch) {
+    RepositoryList added;
+    RepositoryList updated;
+    std::unordered_set<QString> batchIds;
+    std::unordered_set<QString> replacedIds;
+    std::vector<CommandDbEntry> registered;
+
+    for (const auto &repository : batch) {
+      if (!batchIds.insert(repository->id()).second) {
+        qWarning() << "Repository" << repository->id() << "is registered twice in the same batch, ignoring";
+        continue;
+      }
+
+      if (auto it = repositories.find(repository->id()); it != repositories.end()) {
+        it->second = repository;
+        replacedIds.insert(repository->id());
+        updated.emplace_back(repository);
+      } else {
+        repositories.emplace(repository->id(), repository);
+        added.emplace_back(repository);
+      }
     }
 
-    int index = -1;
+    if (!replacedIds.empty()) { removeCommands(replacedIds); }
+
+    for (const auto &repository : batch) {
+      if (!batchIds.erase(repository->id())) continue;
+
+      for (const auto &cmd : repository->commands()) {
+        if (!commandIds.insert(cmd->uniqueId()).second) continue;
+
+        auto &entry = registered.emplace_back();
 
-    for (int i = 0; i != repositories.size(); ++i) {
-      if (repositories[i]->id() == repository->id()) {
-        repositories[i] = repository;
-        index = i;
-        break;
+        entry.command = cmd;
+        entry.disabled = false;
+        entry.repositoryId = repository->id();
+        emit commandRegistered(entry);
       }
     }
 
-    if (index == -1) {
-      repositories.push_back(repository);
-      emit registryAdded(repository);
-    }
+    // the most recently registered commands come first, as with registerCommand
+    entries.insert(entries.begin(), registered.rbegin(), registered.rend());
+
+    if (!added.empty() || !updated.empty()) { emit repositoriesRegistered(added, updated); }
+  }
+
+  void registerRepository(const std::shared_ptr<AbstractCommandRepository> &repository) {
+    registerRepositories(std::span(&repository, 1));
   }
 
 signals:
   void commandRegistered(const CommandDbEntry &entry) const;
-  void registryAdded(const std::shared_ptr<AbstractCommandRepository> &registry) const;
+  /**
+   * Repositories that were registered at once, `updated` ones replaced a previous version of themselves.
+   */
+  void repositoriesRegistered(const RepositoryList &added, const RepositoryList &updated) const;
   void repositoryRemoved(const QString &id);
 };
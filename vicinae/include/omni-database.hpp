@@ -1,34 +1,90 @@
 #pragma once
-#include "utils/migration-manager/migration-manager.hpp"
+#include <qfuture.h>
 #include <qlogging.h>
 #include <qsqldatabase.h>
 #include <qsqlquery.h>
+#include <qthreadpool.h>
+#include <qtimer.h>
+#include <qvariant.h>
 #include <filesystem>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
-static const std::vector<QString> pragmas = {"PRAGMA foreign_keys = ON;"};
-
+/**
+ * The main SQLite database, shared by the services keeping small amounts of state in it: root item
+ * metadata, shortcuts, emoji visits, calculator history, local storage...
+ *
+ * The connection is tuned for many small writes made from the GUI thread: the journal is write-ahead and
+ * is only synced at checkpoints.
+ */
 class OmniDatabase {
-  QSqlDatabase _db;
-
 public:
-  QSqlDatabase &db() { return _db; }
+  /**
+   * A cached statement, reset once it goes out of scope: an active statement keeps its read transaction
+   * open, and the connection would not see changes made by other connections until it is reset.
+   */
+  class Statement {
+    QSqlQuery *m_query;
+
+  public:
+    QSqlQuery *operator->() const { return m_query; }
+    QSqlQuery &operator*() const { return *m_query; }
+
+    Statement(QSqlQuery *query) : m_query(query) {}
+    ~Statement();
+  };
 
-  QSqlQuery createQuery() { return QSqlQuery(_db); }
+  /**
+   * The connection, with the deferred writes flushed so that transactions do not end up including them.
+   */
+  QSqlDatabase &db();
 
-  OmniDatabase(const std::filesystem::path &path) : _db(QSqlDatabase::addDatabase("QSQLITE", "omni")) {
-    std::filesystem::create_directories(path.parent_path());
-    _db.setDatabaseName(path.c_str());
+  QSqlQuery createQuery();
 
-    if (!_db.open()) { qFatal() << "Could not open main omnicast SQLite database."; }
+  /**
+   * Statement for `sql`, prepared the first time any service requests it. Bound values are kept from the
+   * previous execution.
+   */
+  Statement prepare(const QString &sql);
 
-    MigrationManager manager(_db, "omnicast");
+  /**
+   * Execute `sql` with `values` bound to it later, batched with the other deferred writes into a single
+   * transaction committed from a background thread. Meant for frequent writes of state that is also kept
+   * in memory, such as visit counters: a deferred write that is lost to a crash costs little.
+   *
+   * Deferred writes are flushed before any other query runs on the connection, so reads see them, and
+   * when the database is destroyed.
+   */
+  void deferWrite(const QString &sql, const QVariantList &values);
+  void flushDeferredWrites();
 
-    manager.runMigrations();
+  /**
+   * Release the page cache of the connection, which fills up again as it is used.
+   */
+  void shrinkMemory();
+
+  OmniDatabase(const std::filesystem::path &path);
+  ~OmniDatabase();
+
+private:
+  static constexpr int DEFERRED_WRITE_FLUSH_MS = 2000;
+
+  struct DeferredWrite {
+    QString sql;
+    QVariantList values;
+  };
+
+  QSqlDatabase _db;
+  // statements of this connection, by SQL
+  std::unordered_map<QString, std::unique_ptr<QSqlQuery>> m_statements;
+  std::vector<DeferredWrite> m_deferredWrites;
+  QTimer m_flushTimer;
+  QThreadPool m_flushPool;
+  QFuture<void> m_flush;
 
-    auto query = createQuery();
+  static bool executeWrites(QSqlDatabase &db, const std::vector<DeferredWrite> &writes);
 
-    for (const auto &pragma : pragmas) {
-      query.exec(pragma);
-    }
-  }
+  QSqlQuery &statement(const QString &sql);
+  void flushInBackground();
 };
@@ -1,41 +1,77 @@
 #pragma once
-#include <qdiriterator.h>
-#include <qfiledevice.h>
+#include <chrono>
+#include <memory>
+#include <qfuturewatcher.h>
+#include <qobject.h>
+#include <qtimer.h>
+#include <qtmetamacros.h>
 #include <unistd.h>
+#include <unordered_map>
+#include <vector>
 
 struct ProcessInfo {
   pid_t pid;
   QString comm;
+  // share of a single CPU used since the previous sample, in percent
+  double cpuPercent = 0;
+  // resident set size, in bytes
+  uint64_t rss = 0;
+  // change of the resident set size since the previous sample, in bytes
+  int64_t rssDelta = 0;
 };
 
-class ProcessManagerService {
+/**
+ * Samples the running processes from /proc, off the GUI thread.
+ *
+ * Processes are kept in a table that each sample updates in place: only the `stat` file of each process is
+ * read, through file descriptors relative to /proc and a buffer reused across processes, and its name is
+ * only decoded for processes that were not in the previous sample. Views get what changed between two
+ * samples instead of a full list.
+ */
+class ProcessManagerService : public QObject {
+  Q_OBJECT
 
 public:
-  QList<ProcessInfo> list() {
-    QList<ProcessInfo> procList;
-    QDir baseDir("/proc");
+  /**
+   * Changes between two samples. A pid that was reused by a new process is both removed and added, removals
+   * are to be applied first.
+   */
+  struct Diff {
+    std::vector<ProcessInfo> added;
+    std::vector<ProcessInfo> updated;
+    std::vector<pid_t> removed;
+  };
 
-    for (const auto &name : baseDir.entryList()) {
-      bool isNum = false;
-      auto pid = name.toInt(&isNum);
+  /**
+   * The processes as of the last sample, without reading /proc. Empty until a first sample was taken.
+   */
+  std::vector<ProcessInfo> list() const;
 
-      if (!isNum) continue;
+  /**
+   * Sample processes every `interval`, starting right away, until `stopSampling` is called.
+   */
+  void startSampling(std::chrono::milliseconds interval = std::chrono::seconds(2));
+  void stopSampling();
 
-      ProcessInfo info{.pid = pid};
-      auto processPath = baseDir.absoluteFilePath(name);
-      {
-        QFile commFile(processPath + QDir::separator() + "comm");
+  ProcessManagerService();
+  ~ProcessManagerService();
 
-        if (!commFile.open(QIODevice::ReadOnly | QIODevice::Text)) continue;
+signals:
+  void sampled(const ProcessManagerService::Diff &diff) const;
 
-        info.comm = commFile.readAll().trimmed();
-      }
+private:
+  class Sampler;
 
-      procList << info;
-    }
+  struct Sample {
+    std::vector<ProcessInfo> processes;
+    Diff diff;
+  };
 
-    return procList;
-  }
+  // only ever used by one sample at a time, from the sampling thread
+  std::shared_ptr<Sampler> m_sampler;
+  std::vector<ProcessInfo> m_processes;
+  QFutureWatcher<Sample> m_watcher;
+  QTimer *m_timer = new QTimer(this);
 
-  ProcessManagerService() {}
+  void sample();
 };
@@ -1,9 +1,11 @@
 #pragma once
 #include "action-panel/action-panel.hpp"
 #include "actions/app/app-actions.hpp"
+#include "actions/files/file-actions.hpp"
 #include "ui/views/base-view.hpp"
 #include "clipboard-history-view.hpp"
 #include "manage-quicklinks-command.hpp"
+#include "services/files-service/file-metadata-loader.hpp"
 #include "services/files-service/file-service.hpp"
 #include "../src/ui/image/url.hpp"
 #include "service-registry.hpp"
@@ -11,98 +13,127 @@
 #include "timer.hpp"
 #include "ui/omni-list/omni-list.hpp"
 #include "utils/utils.hpp"
+#include <algorithm>
 #include <filesystem>
 #include <qfuturewatcher.h>
 #include <qlocale.h>
-#include <qmimedatabase.h>
+#include <qtimer.h>
+#include <unordered_map>
 
+/**
+ * Only what is known from the path is shown at first, the rest fills in once the metadata of the file is
+ * loaded by the `FileMetadataLoader`.
+ */
 class FileListItemMetadata : public DetailWithMetadataWidget {
   std::filesystem::path m_path;
-  QMimeDatabase m_mimeDb;
+  QFutureWatcher<FileMetadata> m_watcher;
 
-  std::vector<MetadataItem> createEntryMetadata(const std::filesystem::path &path) const {
-    auto mimeType = m_mimeDb.mimeTypeForFile(path.c_str());
-    auto stat = std::filesystem::status(path);
-    QFileInfo info(path);
-
-    auto lastModifiedAt = MetadataLabel{
-        .text = info.lastModified().toString(),
-        .title = "Last modified at",
-    };
-    auto mime = MetadataLabel{
-        .text = mimeType.name(),
-        .title = "Type",
-    };
-    auto name = MetadataLabel{
-        .text = path.filename().c_str(),
-        .title = "Name",
-    };
-    auto where = MetadataLabel{
-        .text = compressPath(path).c_str(),
-        .title = "Where",
+  std::vector<MetadataItem> createEntryMetadata(const std::filesystem::path &path,
+                                                const FileMetadata *metadata) const {
+    std::vector<MetadataItem> items{
+        MetadataLabel{.text = path.filename().c_str(), .title = "Name"},
+        MetadataLabel{.text = compressPath(path).c_str(), .title = "Where"},
     };
 
-    return {name, where, mime, lastModifiedAt};
+    if (metadata) {
+      items.emplace_back(MetadataLabel{.text = metadata->mimeType.name(), .title = "Type"});
+      items.emplace_back(
+          MetadataLabel{.text = metadata->lastModifiedAt.toString(), .title = "Last modified at"});
+    }
+
+    return items;
   }
 
-  QWidget *createEntryWidget(const std::filesystem::path &path) {
-    auto mime = m_mimeDb.mimeTypeForFile(path.c_str());
+  static QWidget *createIconWidget(const QMimeType &mime) {
+    auto icon = new ImageWidget;
 
-    if (mime.name().startsWith("image/")) {
+    icon->setContentsMargins(10, 10, 10, 10);
+    icon->setUrl(ImageURL::system(mime.iconName()).withFallback(ImageURL::system(mime.genericIconName())));
+
+    return icon;
+  }
+
+  QWidget *createEntryWidget(const std::filesystem::path &path, const FileMetadata &metadata) {
+    if (metadata.mimeType.name().startsWith("image/")) {
       auto icon = new ImageWidget;
+      // thumbnails are not animated
+      bool animated = metadata.mimeType.name() == "image/gif";
 
       icon->setContentsMargins(10, 10, 10, 10);
-      icon->setUrl(ImageURL::local(path));
+      icon->setUrl(animated ? ImageURL::local(path) : ImageURL::thumbnail(path));
 
       return icon;
     }
 
-    if (isTextMimeType(mime)) {
+    if (auto preview = metadata.textPreview) {
       auto container = new TextContainer;
       auto viewer = new TextFileViewer;
 
       container->setWidget(viewer);
-      viewer->load(path);
+      viewer->load(*preview);
 
       return container;
     }
 
-    auto icon = new ImageWidget;
+    return createIconWidget(metadata.mimeType);
+  }
 
-    icon->setContentsMargins(10, 10, 10, 10);
-    icon->setUrl(ImageURL::system(mime.iconName()).withFallback(ImageURL::system(mime.genericIconName())));
+  void applyMetadata(const FileMetadata &metadata) {
+    setContent(createEntryWidget(m_path, metadata));
+    setMetadata(createEntryMetadata(m_path, &metadata));
+  }
 
-    return icon;
+  void handleMetadataLoaded() {
+    if (m_watcher.isCanceled() || m_watcher.resultCount() == 0) return;
+
+    applyMetadata(m_watcher.result());
   }
 
 public:
   void setPath(const std::filesystem::path &path) {
-    if (auto previous = content()) { previous->deleteLater(); }
+    auto &loader = FileMetadataLoader::instance();
+    auto future = loader.load(path);
 
     m_path = path;
 
-    auto widget = createEntryWidget(path);
-    auto metadata = createEntryMetadata(path);
+    // prefetched, no need to show a placeholder first
+    if (future.isFinished() && future.resultCount() > 0) {
+      applyMetadata(future.result());
+      return;
+    }
+
+    setContent(createIconWidget(loader.mimeTypeForName(path)));
+    setMetadata(createEntryMetadata(path, nullptr));
+    m_watcher.setFuture(future);
+  }
 
-    setContent(widget);
-    setMetadata(metadata);
+  FileListItemMetadata() {
+    connect(&m_watcher, &QFutureWatcher<FileMetadata>::finished, this,
+            &FileListItemMetadata::handleMetadataLoaded);
   }
 };
 
+/**
+ * Rows are kept cheap: their icon is guessed from the name of the file, without touching the file itself.
+ */
 class FileListItem : public AbstractDefaultListItem, public ListView::Actionnable {
   std::filesystem::path m_path;
-  QMimeDatabase m_mimeDb;
 
   ImageURL getIcon() const {
-    auto mime = m_mimeDb.mimeTypeForFile(m_path.c_str());
+    // looking up an icon in the theme is what's expensive here, and files of the same type share theirs
+    static std::unordered_map<QString, ImageURL> icons;
+    auto mime = FileMetadataLoader::instance().mimeTypeForName(m_path);
 
-    if (!mime.name().isEmpty()) {
-      if (!QIcon::fromTheme(mime.iconName()).isNull()) { return ImageURL::system(mime.iconName()); }
+    if (mime.name().isEmpty()) return ImageURL::builtin("question-mark-circle");
 
-      return ImageURL::system(mime.genericIconName());
-    }
+    if (auto it = icons.find(mime.name()); it != icons.end()) return it->second;
+
+    auto icon = QIcon::fromTheme(mime.iconName()).isNull() ? ImageURL::system(mime.genericIconName())
+                                                            : ImageURL::system(mime.iconName());
 
-    return ImageURL::builtin("question-mark-circle");
+    icons.emplace(mime.name(), icon);
+
+    return icon;
   }
 
   QWidget *generateDetail() const override {
@@ -119,7 +150,7 @@ class FileListItem : public AbstractDefaultListItem, public ListView::Actionnabl
     auto openInFolder = new OpenAppAction(appDb->fileBrowser(), "Open in folder", {m_path.c_str()});
 
     if (auto app = appDb->findBestOpener(m_path.c_str())) {
-      auto open = new OpenAppAction(app, "Open", {m_path.c_str()});
+      auto open = new OpenFileAction(app, m_path);
       open->setPrimary(true);
       section->addAction(open);
     } else {
@@ -132,6 +163,8 @@ class FileListItem : public AbstractDefaultListItem, public ListView::Actionnabl
   }
 
 public:
+  const std::filesystem::path &path() const { return m_path; }
+
   QString generateId() const override { return m_path.c_str(); }
 
   ItemData data() const override {
@@ -144,28 +177,141 @@ public:
   FileListItem(const std::filesystem::path &path) : m_path(path) {}
 };
 
+class IndexerStatListItem : public AbstractDefaultListItem {
+  QString m_id;
+  ImageURL m_icon;
+  QString m_title;
+  QString m_value;
+
+public:
+  QString generateId() const override { return m_id; }
+
+  ItemData data() const override {
+    return {.iconUrl = m_icon, .name = m_title, .accessories = {{.text = m_value}}};
+  }
+
+  IndexerStatListItem(const QString &id, const ImageURL &icon, const QString &title, const QString &value)
+      : m_id(id), m_icon(icon), m_title(title), m_value(value) {}
+};
+
 class SearchFilesView : public ListView {
   using Watcher = QFutureWatcher<std::vector<IndexerFileResult>>;
   Watcher m_pendingFileResults;
+  // results of the current query, chunks being appended as they come
+  std::vector<std::filesystem::path> m_results;
   QString m_lastSearchText;
+  // indexer stats are shown while the search text is empty
+  QTimer m_statsTimer;
 
   QString currentQuery;
 
-  void initialize() override { setSearchPlaceholderText("Search for files..."); }
+  static constexpr int STATS_REFRESH_INTERVAL_MS = 1000;
+  // results around the selected one whose metadata is loaded ahead, for the detail to show up right away
+  static constexpr size_t PREFETCH_NEIGHBOURS = 2;
+
+  void initialize() override {
+    setSearchPlaceholderText("Search for files...");
+    showIndexerStats();
+    m_statsTimer.start();
+  }
+
+  static QString formatDuration(std::chrono::microseconds duration) {
+    return QString("%1ms").arg(duration.count() / 1000.0, 0, 'f', 1);
+  }
+
+  static QString formatNumber(size_t n) { return QLocale().toString(static_cast<qulonglong>(n)); }
+
+  static QString formatEntrypointProgress(const IndexerStats::Entrypoint &entrypoint) {
+    using State = IndexerStats::Entrypoint::State;
+
+    QString text;
+
+    switch (entrypoint.state) {
+    case State::Idle:
+      text = "Idle";
+      break;
+    case State::Queued:
+      text = "Queued";
+      break;
+    case State::Scanning:
+      text = QString("Scanning, %1").arg(formatNumber(entrypoint.walkedFileCount));
+      if (auto expected = entrypoint.expectedFileCount) {
+        text += QString("/~%1").arg(formatNumber(*expected));
+      }
+      text += " files";
+      break;
+    }
+
+    if (auto date = entrypoint.lastScannedAt; date && entrypoint.state != State::Scanning) {
+      text += QString(" - last scanned %1").arg(QLocale().toString(*date, QLocale::ShortFormat));
+    }
+
+    return text;
+  }
+
+  void showIndexerStats() {
+    IndexerStats stats = context()->services->fileService()->stats();
+
+    m_list->updateModel(
+        [&]() {
+          auto &indexer = m_list->addSection("File Indexer");
+          auto add = [&](const QString &id, const char *icon, const QString &title, const QString &value) {
+            indexer.addItem(std::make_unique<IndexerStatListItem>(id, ImageURL::builtin(icon), title, value));
+          };
+
+          add("walk-rate", "gauge", "Walk rate", QString("%1 files/s").arg(stats.filesPerSecond, 0, 'f', 0));
+          add("walked", "layers", "Files walked", formatNumber(stats.walkedFileCount));
+          add("queued-batches", "hourglass", "Queued batches", QString::number(stats.queuedBatchCount));
+          add("write-time", "stopwatch", "Batch write time",
+              QString("%1 last, %2 average, %3 max")
+                  .arg(formatDuration(stats.lastBatchWriteTime))
+                  .arg(formatDuration(stats.averageBatchWriteTime))
+                  .arg(formatDuration(stats.maxBatchWriteTime)));
+          add("backpressure", "clock", "Blocked on backpressure",
+              QString("%1s").arg(stats.backpressureWaitTime.count() / 1000.0, 0, 'f', 1));
+          add("db-size", "hard-drive", "Database size", formatSize(stats.databaseSize));
+
+          if (auto count = stats.ftsSegmentCount) {
+            add("fts-segments", "bar-chart", "Full text index segments", QString::number(*count));
+          }
+
+          auto &entrypoints = m_list->addSection("Search Paths");
+
+          for (const auto &entrypoint : stats.entrypoints) {
+            entrypoints.addItem(std::make_unique<IndexerStatListItem>(
+                QString("entrypoint-%1").arg(entrypoint.root.c_str()), ImageURL::builtin("folder"),
+                compressPath(entrypoint.root).c_str(), formatEntrypointProgress(entrypoint)));
+          }
+        },
+        OmniList::SelectionPolicy::PreserveSelection);
+  }
 
-  void handleSearchResults() {
-    if (!m_pendingFileResults.isFinished()) return;
+  /**
+   * Results of a query come in chunks, the list being shown as soon as the first one is in. The previous
+   * results stay in place until then, which avoids flashing an empty list between keystrokes.
+   */
+  void handleSearchResults(int begin, int end) {
+    if (m_pendingFileResults.isCanceled() || currentQuery != m_lastSearchText) return;
 
-    if (currentQuery != m_lastSearchText) return;
+    bool isFirstChunk = begin == 0;
 
-    auto results = m_pendingFileResults.result();
+    if (isFirstChunk) { m_results.clear(); }
 
-    m_list->updateModel([&]() {
-      auto &section = m_list->addSection("Files");
-      for (const auto &result : results) {
-        section.addItem(std::make_unique<FileListItem>(result.path));
+    for (int i = begin; i != end; ++i) {
+      for (auto &result : m_pendingFileResults.resultAt(i)) {
+        m_results.emplace_back(std::move(result.path));
       }
-    });
+    }
+
+    // items that are already shown are matched by id, only the new ones are laid out
+    m_list->updateModel(
+        [&]() {
+          auto &section = m_list->addSection("Files");
+          for (const auto &path : m_results) {
+            section.addItem(std::make_unique<FileListItem>(path));
+          }
+        },
+        isFirstChunk ? OmniList::SelectionPolicy::SelectFirst : OmniList::SelectionPolicy::PreserveSelection);
   }
 
   void generateFilteredList(const QString &query) {
@@ -174,15 +320,48 @@ class SearchFilesView : public ListView {
     currentQuery = query;
     if (m_pendingFileResults.isRunning()) { m_pendingFileResults.cancel(); }
     m_lastSearchText = query;
-    m_pendingFileResults.setFuture(fileService->queryAsync(query.toStdString()));
+    m_pendingFileResults.setFuture(
+        fileService->queryStreamAsync(query.toStdString(), {.consumer = "search-files"}));
+  }
+
+  void selectionChanged(const OmniList::AbstractVirtualItem *next,
+                        const OmniList::AbstractVirtualItem *previous) override {
+    ListView::selectionChanged(next, previous);
+
+    auto item = dynamic_cast<const FileListItem *>(next);
+
+    if (!item) return;
+
+    auto it = std::ranges::find(m_results, item->path());
+
+    if (it == m_results.end()) return;
+
+    auto &loader = FileMetadataLoader::instance();
+    size_t index = std::distance(m_results.begin(), it);
+
+    // the selection is more likely to move down
+    for (size_t i = 1; i <= PREFETCH_NEIGHBOURS; ++i) {
+      if (index + i < m_results.size()) { loader.prefetch(m_results[index + i]); }
+      if (index >= i) { loader.prefetch(m_results[index - i]); }
+    }
   }
 
   void textChanged(const QString &query) override {
-    if (!query.isEmpty()) generateFilteredList(query);
+    if (query.isEmpty()) {
+      currentQuery.clear();
+      showIndexerStats();
+      m_statsTimer.start();
+      return;
+    }
+
+    m_statsTimer.stop();
+    generateFilteredList(query);
   }
 
 public:
   SearchFilesView() {
-    connect(&m_pendingFileResults, &Watcher::finished, this, &SearchFilesView::handleSearchResults);
+    m_statsTimer.setInterval(STATS_REFRESH_INTERVAL_MS);
+    connect(&m_pendingFileResults, &Watcher::resultsReadyAt, this, &SearchFilesView::handleSearchResults);
+    connect(&m_statsTimer, &QTimer::timeout, this, &SearchFilesView::showIndexerStats);
   }
 };
@@ -2,6 +2,7 @@
 #include "ui/action-pannel/action.hpp"
 #include "ui/omni-list/omni-list.hpp"
 #include "../src/ui/image/url.hpp"
+#include "lib/search-index.hpp"
 #include "service-registry.hpp"
 #include "services/window-manager/window-manager.hpp"
 #include <chrono>
@@ -16,7 +17,7 @@ class FocusWindowAction : public AbstractAction {
 
   void execute(ApplicationContext *ctx) override {
     auto wm = ctx->services->windowManager();
-    wm->provider()->focusWindowSync(*_window.get());
+    wm->provider()->focusWindow(*_window.get());
   }
 
 public:
@@ -29,7 +30,7 @@ class CloseWindowAction : public AbstractAction {
 
   void execute(ApplicationContext *ctx) override {
     auto wm = ctx->services->windowManager();
-    bool success = wm->provider()->closeWindow(*_window.get());
+    wm->provider()->closeWindow(*_window.get());
   }
 
 public:
@@ -111,48 +112,58 @@ public:
 };
 
 class SwitchWindowsView : public ListView {
+  struct IndexedWindow {
+    AbstractWindowManager::WindowPtr window;
+    std::shared_ptr<Application> app;
+  };
+
   AbstractWindowManager::WindowList windows;
+  // windows by title, then by the name of their app
+  SearchIndex<IndexedWindow> m_index;
+  QFutureWatcher<AbstractWindowManager::WindowList> m_pendingWindows;
   std::chrono::time_point<std::chrono::high_resolution_clock> m_lastWindowFetch =
       std::chrono::high_resolution_clock::now();
 
-public:
-  void refreshWindowsList() {
-    // Force a refresh by clearing the cache
-    windows.clear();
-    m_lastWindowFetch = std::chrono::time_point<std::chrono::high_resolution_clock>{};
-    textChanged(searchText());
-  }
+  // windows are listed asynchronously, the view is rendered again once they are
+  void fetchWindows() {
+    if (m_pendingWindows.isRunning()) return;
 
-  // Method to refresh with a delay (for after window operations)
-  // Uses a small delay to ensure the window manager has processed the close operation
-  void refreshWindowsListDelayed() {
-    QTimer::singleShot(100, this, [this]() { refreshWindowsList(); });
+    m_pendingWindows.setFuture(ServiceRegistry::instance()->windowManager()->listWindows());
+    m_lastWindowFetch = std::chrono::high_resolution_clock::now();
   }
 
-  void textChanged(const QString &s) override {
-    auto wm = ServiceRegistry::instance()->windowManager();
-    auto appDb = ServiceRegistry::instance()->appDb();
-    auto now = std::chrono::high_resolution_clock::now();
-    auto elapsedSeconds = std::chrono::duration_cast<std::chrono::seconds>(now - m_lastWindowFetch).count();
+  void handleWindowsFetched() {
+    if (m_pendingWindows.isCanceled() || m_pendingWindows.future().resultCount() == 0) return;
 
-    if (windows.empty() || elapsedSeconds > 1) {
-      windows = wm->listWindowsSync();
-      m_lastWindowFetch = now;
-    }
+    windows = m_pendingWindows.result();
+    indexWindows();
+    render(searchText());
+  }
 
-    m_list->beginResetModel();
+  void indexWindows() {
+    auto appDb = ServiceRegistry::instance()->appDb();
 
-    auto &section = m_list->addSection("Open Windows");
+    m_index.clear();
+    m_index.reserve(windows.size());
 
     for (const auto &win : windows) {
       auto app = appDb->findByClass(win->wmClass());
 
       if (!app) { app = appDb->findById(win->wmClass()); }
 
-      bool appMatches = app && app->name().contains(s, Qt::CaseInsensitive);
-      bool matches = appMatches || win->title().contains(s, Qt::CaseInsensitive);
+      QString appName = app ? app->name() : QString();
+
+      m_index.add({.window = win, .app = app}, {win->title(), appName});
+    }
+  }
 
-      if (!matches) continue;
+  void render(const QString &s) {
+    m_list->beginResetModel();
+
+    auto &section = m_list->addSection("Open Windows");
+
+    for (const auto &result : m_index.search(s)) {
+      const auto &[win, app] = *result.item;
 
       if (app) {
         section.addItem(std::make_unique<AppWindowListItem>(win, app));
@@ -164,11 +175,37 @@ public:
     m_list->endResetModel(OmniList::SelectFirst);
   }
 
+public:
+  void refreshWindowsList() {
+    // Force a refresh by clearing the cache
+    windows.clear();
+    m_index.clear();
+    m_lastWindowFetch = std::chrono::time_point<std::chrono::high_resolution_clock>{};
+    textChanged(searchText());
+  }
+
+  // Method to refresh with a delay (for after window operations)
+  // Uses a small delay to ensure the window manager has processed the close operation
+  void refreshWindowsListDelayed() {
+    QTimer::singleShot(100, this, [this]() { refreshWindowsList(); });
+  }
+
+  void textChanged(const QString &s) override {
+    auto now = std::chrono::high_resolution_clock::now();
+    auto elapsedSeconds = std::chrono::duration_cast<std::chrono::seconds>(now - m_lastWindowFetch).count();
+
+    if (windows.empty() || elapsedSeconds > 1) { fetchWindows(); }
+
+    render(s);
+  }
+
   void initialize() override {
     auto wm = context()->services->windowManager();
 
     connect(wm->provider(), &AbstractWindowManager::windowsChanged, this,
             &SwitchWindowsView::refreshWindowsListDelayed);
+    connect(&m_pendingWindows, &QFutureWatcher<AbstractWindowManager::WindowList>::finished, this,
+            &SwitchWindowsView::handleWindowsFetched);
 
     setSearchPlaceholderText("Search open window...");
     textChanged("");
@@ -100,14 +100,23 @@ enum TextSize { TextRegular, TextTitle, TextSmaller };
 
 struct ThemeLinearGradient {
   std::vector<QColor> points;
+
+  bool operator==(const ThemeLinearGradient &) const = default;
 };
 
 struct ThemeRadialGradient {
   std::vector<QColor> points;
+
+  bool operator==(const ThemeRadialGradient &) const = default;
 };
 
 using ColorLike = std::variant<QColor, ThemeLinearGradient, ThemeRadialGradient, SemanticColor>;
 
+/**
+ * Hash of `color`, for colors to be part of cache keys.
+ */
+size_t colorHash(const ColorLike &color, size_t seed = 0);
+
 struct ColorPalette {
   QColor background;
   QColor foreground;
@@ -130,6 +139,18 @@ struct ParsedThemeData {
   ColorPalette palette;
 };
 
+/**
+ * A theme found in a theme directory, as parsed from its file. The catalog of these is persisted, so that
+ * themes don't all have to be parsed again on every start.
+ */
+struct ThemeCatalogEntry {
+  std::filesystem::path path;
+  // of the file when it was parsed, for it to be parsed again once it changes
+  std::filesystem::file_time_type mtime;
+  uintmax_t size = 0;
+  ParsedThemeData data;
+};
+
 struct ThemeInfo {
   QString appearance;
   QString id;
@@ -221,7 +242,11 @@ struct ThemeInfo {
 class ThemeService : public QObject {
   Q_OBJECT
 
+  static constexpr int CATALOG_VERSION = 1;
+
   std::vector<ThemeInfo> m_themes;
+  // themes of the theme directories, as of the last scan or as persisted by the previous run
+  std::vector<ThemeCatalogEntry> m_catalog;
   ThemeInfo m_theme;
   double m_baseFontPointSize = 10;
 
@@ -230,6 +255,27 @@ class ThemeService : public QObject {
 
   ThemeService();
 
+  static QString catalogPath();
+  /**
+   * Register the themes of the persisted catalog, without checking them against their files. Returns false
+   * if there is no usable catalog.
+   */
+  bool loadCatalog();
+  void saveCatalog() const;
+  void registerCatalog();
+
+  /**
+   * Parse the theme file at `path`, whose icon is relative to `dir`.
+   */
+  static std::optional<ParsedThemeData> parseThemeFile(const std::filesystem::path &path,
+                                                       const std::filesystem::path &dir);
+
+  /**
+   * The theme `name`, checked against its file first: only the theme that is set is parsed again if it
+   * changed since it was cataloged. The theme directories are scanned again if the theme is not found.
+   */
+  std::optional<ThemeInfo> resolveTheme(const QString &name);
+
 public:
   static ThemeService &instance();
 
@@ -255,16 +301,27 @@ public:
 
   void setFontBasePointSize(double pointSize);
 
+  /**
+   * Set the application font, at the base point size. Widgets that need a different size
+   * derive it from pointSize() and follow themeChanged.
+   */
+  void setFontFamily(const QString &family);
+
   void reloadCurrentTheme();
 
   void registerBuiltinThemes();
   std::optional<ThemeInfo> findTheme(const QString &name);
   void upsertTheme(const ParsedThemeData &data);
-  void scanThemeDirectory(const std::filesystem::path &path);
+  /**
+   * Add the themes found under `path` to `catalog`. Themes that did not change since they were cataloged are
+   * not parsed again.
+   */
+  void scanThemeDirectory(const std::filesystem::path &path, std::vector<ThemeCatalogEntry> &catalog) const;
   void handleDirectoryChanged(const QString &directory);
 
   /**
-   * Scan themes in local config directory first, then try to load themes from data directories.
+   * Scan themes in local config directory first, then try to load themes from data directories. This is
+   * only needed to list the themes: the catalog persisted by the previous scan is used until then.
    */
   void scanThemeDirectories();
 
@@ -7,6 +7,7 @@
 #include <qevent.h>
 #include <qlogging.h>
 #include <qtmetamacros.h>
+#include <unordered_map>
 
 class AppWindow;
 class ActionPanelView;
@@ -40,6 +41,8 @@ public:
     return m_shortcuts.front();
   }
 
+  const std::vector<KeyboardShortcutModel> &shortcuts() const { return m_shortcuts; }
+
   bool isBoundTo(const QKeyEvent *event) { return isBoundTo(KeyboardShortcut(event)); }
   bool isBoundTo(const KeyboardShortcutModel &model) { return std::ranges::contains(m_shortcuts, model); }
   bool isBoundTo(const KeyboardShortcut &shortcut) {
@@ -87,6 +90,35 @@ private:
   mutable QString m_id;
 };
 
+/**
+ * Actions indexed by the shortcuts they are bound to, so that finding the action a key event triggers does
+ * not mean resolving the shortcuts of every action again.
+ *
+ * Shortcuts are resolved when actions are added: actions whose shortcuts change afterwards need to be added
+ * again. When several actions are bound to the same shortcut, the first one added wins.
+ */
+class ActionShortcutTable {
+public:
+  void add(AbstractAction *action) {
+    for (const auto &model : action->shortcuts()) {
+      KeyboardShortcut shortcut(model);
+
+      if (shortcut.key) { m_actions.try_emplace(shortcut.toCombined(), action); }
+    }
+  }
+
+  void clear() { m_actions.clear(); }
+
+  AbstractAction *find(const QKeyEvent *event) const {
+    auto it = m_actions.find(KeyboardShortcut(event).toCombined());
+
+    return it != m_actions.end() ? it->second : nullptr;
+  }
+
+private:
+  std::unordered_map<int, AbstractAction *> m_actions;
+};
+
 struct StaticAction : public AbstractAction {
   std::function<void(ApplicationContext *ctx)> m_fn;
 
@@ -20,8 +20,12 @@ class BaseInput : public JsonFormItemWidget {
   QWidget *leftAccessory;
   QMargins m_defaultTextMargins = QMargins(10, 5, 10, 5);
 
+  static constexpr int BORDER_WIDTH = 2;
+  static constexpr int BORDER_RADIUS = 5;
+
   bool event(QEvent *) override;
   void resizeEvent(QResizeEvent *event) override;
+  void paintEvent(QPaintEvent *event) override;
   void setFocusState(bool value);
 
   QJsonValue asJsonValue() const override;
@@ -1,6 +1,6 @@
 #pragma once
 #include "common.hpp"
-#include "trie.hpp"
+#include "lib/search-index.hpp"
 #include "../../../src/ui/image/url.hpp"
 #include "ui/focus-notifier.hpp"
 #include "ui/form/base-input.hpp"
@@ -9,11 +9,13 @@
 #include "ui/omni-list/omni-list.hpp"
 #include "ui/popover/popover.hpp"
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <qjsonvalue.h>
 #include <qlineedit.h>
 #include <qobject.h>
 #include <qstackedwidget.h>
+#include <qtimer.h>
 #include <qtmetamacros.h>
 #include <qwidget.h>
 
@@ -40,26 +42,40 @@ public:
 
   QJsonValue asJsonValue() const override;
 
+  /**
+   * Extensions can have thousands of options: they are indexed once when the section is added, and filtering
+   * only hands the matching items to the list, which lays out the visible ones only.
+   */
   struct DropdownSection {
     QString title;
-    std::vector<std::shared_ptr<AbstractItem>> items;
-    Trie<std::shared_ptr<OmniList::AbstractVirtualItem>> index;
-
-    void buildIndex() {
-      std::ranges::for_each(
-          items, [&](auto &&item) { index.indexLatinText(item->displayName().toStdString(), item); });
-    }
+    SearchIndex<std::shared_ptr<AbstractItem>> index;
 
+    // items matching `query`, best first, or all of them in order if it is empty
     std::vector<std::shared_ptr<OmniList::AbstractVirtualItem>> search(const QString &query) const {
-      return index.prefixSearch(query.toStdString());
+      std::vector<std::shared_ptr<OmniList::AbstractVirtualItem>> items;
+      auto results = index.search(query);
+
+      items.reserve(results.size());
+      for (const auto &result : results) {
+        items.emplace_back(*result.item);
+      }
+
+      return items;
     }
 
     DropdownSection(const QString &title, const std::vector<std::shared_ptr<AbstractItem>> &items)
-        : title(title), items(items) {
-      buildIndex();
+        : title(title) {
+      index.reserve(items.size());
+      for (const auto &item : items) {
+        auto name = item->displayName();
+        index.add(item, {name});
+      }
     }
   };
 
+  // how long the search text has to stay the same before throttled selectors emit `textChanged`
+  static constexpr std::chrono::milliseconds SEARCH_THROTTLE_INTERVAL{300};
+
 private:
   Q_OBJECT
 
@@ -69,8 +85,10 @@ private:
   int POPOVER_HEIGHT = 300;
 
   void listHeightChanged(int height);
+  void renderSections(OmniList::SelectionPolicy policy);
 
   std::vector<DropdownSection> m_sections;
+  QTimer *m_searchThrottle = new QTimer(this);
 
 protected:
   OmniList *m_list;
@@ -104,18 +122,11 @@ public:
 
   void resetModel() { m_sections.clear(); }
 
-  void updateModel() {
-    m_list->updateModel([&]() {
-      for (const auto &section : m_sections) {
-        auto &sec = m_list->addSection(section.title);
-
-        sec.addItems(section.items |
-                     std::views::transform(
-                         [](auto &&v) -> std::shared_ptr<OmniList::AbstractVirtualItem> { return v; }) |
-                     std::ranges::to<std::vector>());
-      }
-    });
-  }
+  /**
+   * Show the sections added since the last reset, filtered by the current search text if the default filter
+   * is enabled.
+   */
+  void updateModel(OmniList::SelectionPolicy policy = OmniList::SelectFirst) { renderSections(policy); }
 
   FocusNotifier *focusNotifier() const override;
   void setIsLoading(bool value);
@@ -128,6 +139,12 @@ public:
   void setValueAsJson(const QJsonValue &value) override;
   QString searchText();
   void setEnableDefaultFilter(bool value);
+
+  /**
+   * Whether `textChanged` waits for the user to stop typing, for handlers that load options on every change.
+   * Default filtering is never throttled.
+   */
+  void setSearchThrottled(bool value);
   void openSelector() { showPopover(); }
 
 signals:
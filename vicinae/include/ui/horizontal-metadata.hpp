@@ -1,6 +1,7 @@
 #pragma once
 #include "extend/metadata-model.hpp"
 #include "ui/vertical-scroll-area/vertical-scroll-area.hpp"
+#include <QCache>
 #include <qboxlayout.h>
 #include <qjsonvalue.h>
 #include <qscrollarea.h>
@@ -8,10 +9,23 @@
 
 class HorizontalMetadata : public VerticalScrollArea {
 private:
+  // total number of items of the cached containers
+  static constexpr int MAX_CACHED_ITEMS = 256;
+
   QWidget *container;
+  // key of the metadata `container` was built for, 0 if it is not cached
+  size_t m_key = 0;
+  // containers built for metadata shown before, which list details switch back and forth between
+  QCache<size_t, QWidget> m_containers{MAX_CACHED_ITEMS};
+
+  void build(QWidget *target, const std::vector<MetadataItem> &metadatas);
 
 public:
   HorizontalMetadata();
 
-  void setMetadata(const std::vector<MetadataItem> &metadatas);
+  /**
+   * Metadata with a non zero `key`, such as `MetadataModel::hash`, is cached by it: setting the same key
+   * again shows the widgets that were built for it instead of building them again.
+   */
+  void setMetadata(const std::vector<MetadataItem> &metadatas, size_t key = 0);
 };
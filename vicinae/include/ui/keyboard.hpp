@@ -135,6 +135,11 @@ public:
     return key == other.key && modifiers.toInt() == other.modifiers.toInt();
   }
 
+  /**
+   * Key and modifiers packed in a single integer, the same way `QKeyEvent::keyCombination` does.
+   */
+  int toCombined() const { return QKeyCombination(modifiers, key).toCombined(); }
+
   KeyboardShortcut() {}
 
   bool matchesKeyEvent(const QKeyEvent *event) const {
@@ -21,6 +21,7 @@
 #include <qstackedwidget.h>
 #include <qtmetamacros.h>
 #include <qwidget.h>
+#include <optional>
 #include <ranges>
 
 class NoResultListItem : public OmniList::AbstractVirtualItem {
@@ -88,6 +89,15 @@ protected:
 
 public:
   virtual QList<AbstractAction *> actions() const { return {}; }
+
+  virtual AbstractAction *findBoundAction(const QKeyEvent *event) const {
+    for (const auto &action : actions()) {
+      if (action->isBoundTo(event)) return action;
+    }
+
+    return nullptr;
+  }
+
   virtual QString searchText() const { return {}; };
   virtual void setSearchText(const QString &text) {}
   virtual void reset() {}
@@ -172,11 +182,9 @@ protected:
         }
       }
 
-      for (const auto &action : actions()) {
-        if (action->isBoundTo(keyEvent)) {
-          emit actionActivated(action);
-          return true;
-        }
+      if (auto action = findBoundAction(keyEvent)) {
+        emit actionActivated(action);
+        return true;
       }
     }
 
@@ -215,6 +223,7 @@ class ActionPanelStaticListView : public ActionPanelListView {
   };
 
   std::vector<ActionSection> m_sections;
+  ActionShortcutTable m_shortcuts;
   QString m_title;
 
   void onInitialize() override { onSearchChanged(""); }
@@ -232,21 +241,24 @@ public:
     return actions;
   }
 
+  AbstractAction *findBoundAction(const QKeyEvent *event) const override { return m_shortcuts.find(event); }
+
   void setTitle(const QString &title) { m_title = title; }
 
   void addSection(const QString &title = "") { m_sections.emplace_back(ActionSection{}); }
 
-  void clear() { m_sections.clear(); }
+  void clear() {
+    m_sections.clear();
+    m_shortcuts.clear();
+  }
 
   void addAction(const std::shared_ptr<AbstractAction> &action) {
     if (m_sections.empty()) { addSection(m_title); }
     m_sections.at(m_sections.size() - 1).actions.emplace_back(action);
+    m_shortcuts.add(action.get());
   }
 
-  void addAction(AbstractAction *action) {
-    if (m_sections.empty()) { addSection(m_title); }
-    m_sections.at(m_sections.size() - 1).actions.emplace_back(std::shared_ptr<AbstractAction>(action));
-  }
+  void addAction(AbstractAction *action) { addAction(std::shared_ptr<AbstractAction>(action)); }
 
   std::vector<AbstractAction *> filterActions(const QString &text) {
     auto filterAction = [&](const std::shared_ptr<AbstractAction> &action) -> bool {
@@ -320,8 +332,32 @@ public:
 class ActionPanelV2Widget : public Popover {
   Q_OBJECT
 
+  struct PendingSection {
+    QString name;
+    std::vector<std::shared_ptr<AbstractAction>> actions;
+  };
+
   std::stack<ActionPanelView *> m_viewStack;
   QStackedLayout *m_layout = new QStackedLayout(this);
+  // actions set while the panel is closed, their view is only built once it is opened
+  std::optional<std::vector<PendingSection>> m_pendingActions;
+
+  void buildPendingActions() {
+    if (!m_pendingActions) return;
+
+    auto panel = new ActionPanelStaticListView;
+
+    for (const auto &section : *m_pendingActions) {
+      panel->addSection(section.name);
+
+      for (const auto &action : section.actions) {
+        panel->addAction(action);
+      }
+    }
+
+    m_pendingActions.reset();
+    setView(panel);
+  }
 
   bool eventFilter(QObject *obj, QEvent *event) override {
     if (!m_viewStack.empty() && obj == m_viewStack.top() &&
@@ -359,6 +395,7 @@ class ActionPanelV2Widget : public Popover {
   }
 
   void showEvent(QShowEvent *event) override {
+    buildPendingActions();
     emit opened();
     emit openChanged(true);
     resizeView();
@@ -466,20 +503,30 @@ public:
     resizeView();
   }
 
+  /**
+   * Actions change with every selection, but are rarely looked at: the list showing them is only built when
+   * the panel is opened, or right away if it already is.
+   */
   void setNewActions(const ActionPanelState &state) {
-    auto panel = new ActionPanelStaticListView;
+    std::vector<PendingSection> sections;
     size_t count = 0;
 
+    sections.reserve(state.sections().size());
+
     for (const auto &section : state.sections()) {
-      panel->addSection(section->name());
+      auto &pending = sections.emplace_back(section->name(), section->actions());
 
-      for (const auto &action : section->actions()) {
-        count++;
-        panel->addAction(action);
-      }
+      count += pending.actions.size();
     }
 
-    setView(panel);
+    m_pendingActions = std::move(sections);
+
+    if (isVisible()) {
+      buildPendingActions();
+    } else {
+      // the actions of the previous selection are not to be kept alive until then
+      popToRoot();
+    }
 
     if (!count) close();
   }
@@ -7,6 +7,7 @@ class OpenAppAction : public AbstractAction {
   std::vector<QString> args;
   bool m_clearSearch = false;
 
+protected:
   void execute(ApplicationContext *context) override;
 
 public:
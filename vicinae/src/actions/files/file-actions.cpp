@@ -0,0 +1,11 @@
+#include "actions/files/file-actions.hpp"
+#include "service-registry.hpp"
+#include "services/files-service/file-service.hpp"
+
+void OpenFileAction::execute(ApplicationContext *ctx) {
+  ctx->services->fileService()->recordFileOpen(m_path);
+  OpenAppAction::execute(ctx);
+}
+
+OpenFileAction::OpenFileAction(const std::shared_ptr<Application> &app, const std::filesystem::path &path)
+    : OpenAppAction(app, "Open", {path.c_str()}), m_path(path) {}
@@ -0,0 +1,15 @@
+#pragma once
+#include "actions/app/app-actions.hpp"
+#include <filesystem>
+
+/**
+ * Opens an indexed file with `app`. Opened files rank higher in later file searches.
+ */
+class OpenFileAction : public OpenAppAction {
+  std::filesystem::path m_path;
+
+  void execute(ApplicationContext *ctx) override;
+
+public:
+  OpenFileAction(const std::shared_ptr<Application> &app, const std::filesystem::path &path);
+};
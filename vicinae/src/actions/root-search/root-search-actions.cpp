@@ -81,8 +81,10 @@ ToggleItemAsFavorite::ToggleItemAsFavorite(const QString &id, bool currentValue)
 
 void DefaultActionWrapper::execute(ApplicationContext *ctx) {
   auto manager = ctx->services->rootItemManager();
+  // only what is launched from the root search teaches anything about its queries
+  QString query = ctx->navigation->viewStackSize() == 1 ? ctx->navigation->searchText() : QString();
 
-  if (manager->registerVisit(m_id)) {
+  if (manager->registerVisit(m_id, query)) {
   } else {
     qWarning() << "Failed to register root item visit";
   }
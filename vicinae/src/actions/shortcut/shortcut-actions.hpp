@@ -24,24 +24,7 @@ public:
     auto appDb = ctx->services->appDb();
     auto toast = ctx->services->toastService();
     auto shortcut = ctx->services->shortcuts();
-    QString expanded;
-    size_t argumentIndex = 0;
-
-    for (const auto &part : m_shortcut->parts()) {
-      if (auto s = std::get_if<QString>(&part)) {
-        expanded += *s;
-      } else if (auto placeholder = std::get_if<Shortcut::ParsedPlaceholder>(&part)) {
-        if (placeholder->id == "clipboard") {
-          expanded += QApplication::clipboard()->text();
-        } else if (placeholder->id == "selected") {
-          // TODO: selected text
-        } else if (placeholder->id == "uuid") {
-          expanded += QUuid::createUuid().toString(QUuid::StringFormat::WithoutBraces);
-        } else {
-          if (argumentIndex < m_arguments.size()) { expanded += m_arguments.at(argumentIndex++); }
-        }
-      }
-    }
+    QString expanded = m_shortcut->expand(m_arguments);
 
     if (m_app) {
       appDb->launch(*m_app, {expanded});
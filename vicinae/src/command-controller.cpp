@@ -75,7 +75,9 @@ void CommandController::launch(const std::shared_ptr<AbstractCmd> &cmd) {
   // unload stalled no-view command
   if (!m_frames.empty() && m_frames.back()->viewCount == 0) { m_frames.pop_back(); }
 
-  if (cmd->type() == CommandType::CommandTypeExtension && !m_ctx->services->extensionManager()->isRunning()) {
+  auto extensionManager = m_ctx->services->extensionManager();
+
+  if (cmd->type() == CommandType::CommandTypeExtension && !extensionManager->ensureStarted()) {
     m_ctx->services->toastService()->failure("Extension manager is not running");
     return;
   }
@@ -1,5 +1,10 @@
 #include "ipc-client.hpp"
 #include "vicinae.hpp"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <poll.h>
+#include <qlogging.h>
+#include <unistd.h>
 
 void DaemonIpcClient::writeRequest(const proto::ext::daemon::Request &req) {
   std::string data;
@@ -12,6 +17,33 @@ void DaemonIpcClient::writeRequest(const proto::ext::daemon::Request &req) {
   m_conn.waitForBytesWritten(1000);
 }
 
+std::optional<proto::ext::daemon::Response> DaemonIpcClient::readResponse(int timeout) {
+  QByteArray data;
+  std::optional<uint32_t> length;
+
+  while (!length || data.size() - sizeof(uint32_t) < *length) {
+    if (m_conn.bytesAvailable() == 0 && !m_conn.waitForReadyRead(timeout)) {
+      qWarning() << "Failed to read response from server" << m_conn.errorString();
+      return std::nullopt;
+    }
+
+    data.append(m_conn.readAll());
+
+    if (!length && data.size() >= sizeof(uint32_t)) {
+      length = ntohl(*reinterpret_cast<const uint32_t *>(data.constData()));
+    }
+  }
+
+  proto::ext::daemon::Response res;
+
+  if (!res.ParseFromArray(data.constData() + sizeof(uint32_t), *length)) {
+    qWarning() << "Failed to parse response from server";
+    return std::nullopt;
+  }
+
+  return res;
+}
+
 void DaemonIpcClient::toggle() {
   QUrl url;
 
@@ -29,6 +61,118 @@ void DaemonIpcClient::passUrl(const QUrl &url) {
   writeRequest(req);
 }
 
+std::optional<proto::ext::daemon::IndexerStatsResponse> DaemonIpcClient::indexerStats() {
+  proto::ext::daemon::Request req;
+
+  req.set_allocated_indexer_stats(new proto::ext::daemon::IndexerStatsRequest());
+  writeRequest(req);
+
+  auto res = readResponse();
+
+  if (!res || !res->has_indexer_stats()) return std::nullopt;
+
+  return res->indexer_stats();
+}
+
+std::optional<proto::ext::daemon::MetricsResponse> DaemonIpcClient::metrics() {
+  proto::ext::daemon::Request req;
+
+  req.mutable_metrics();
+  writeRequest(req);
+
+  auto res = readResponse();
+
+  if (!res || !res->has_metrics()) return std::nullopt;
+
+  return res->metrics();
+}
+
+std::optional<proto::ext::daemon::TraceResponse>
+DaemonIpcClient::trace(proto::ext::daemon::TraceAction action, const std::string &path) {
+  proto::ext::daemon::Request req;
+  auto traceReq = req.mutable_trace();
+
+  traceReq->set_action(action);
+  traceReq->set_path(path);
+  writeRequest(req);
+
+  auto res = readResponse();
+
+  if (!res || !res->has_trace()) return std::nullopt;
+
+  return res->trace();
+}
+
+std::optional<proto::ext::daemon::DmenuResponse> DaemonIpcClient::dmenu(const std::string &placeholder,
+                                                                       int fd) {
+  static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+  auto send = [&](auto fill) {
+    proto::ext::daemon::Request req;
+
+    fill(req.mutable_dmenu());
+    writeRequest(req);
+
+    // large chunks do not make it out in a single write, and the server is not going to wait for them
+    while (m_conn.bytesToWrite() > 0) {
+      if (!m_conn.waitForBytesWritten(-1)) return false;
+    }
+
+    return true;
+  };
+
+  if (!send([&](auto dmenu) { dmenu->mutable_open()->set_placeholder(placeholder); })) return std::nullopt;
+
+  std::string pending;
+  std::vector<char> buf(CHUNK_SIZE);
+  pollfd fds[] = {{.fd = fd, .events = POLLIN}, {.fd = int(m_conn.socketDescriptor()), .events = POLLIN}};
+
+  // stop reading as soon as the server replies, the user may pick a line before input ends
+  while (m_conn.bytesAvailable() == 0) {
+    if (poll(fds, std::size(fds), -1) == -1) {
+      if (errno == EINTR) continue;
+      return std::nullopt;
+    }
+
+    if (fds[1].revents) break;
+    if (!fds[0].revents) continue;
+
+    ssize_t n = read(fd, buf.data(), buf.size());
+
+    if (n == -1 && errno == EINTR) continue;
+
+    if (n <= 0) {
+      // the last line does not have to end with a newline
+      if (!pending.empty()) {
+        pending.push_back('\n');
+        if (!send([&](auto dmenu) { dmenu->mutable_lines()->set_data(pending); })) return std::nullopt;
+      }
+
+      if (!send([](auto dmenu) { dmenu->mutable_end(); })) return std::nullopt;
+      break;
+    }
+
+    pending.append(buf.data(), n);
+
+    // only complete lines are sent, the rest waits for the next read
+    auto end = pending.rfind('\n');
+
+    if (end == std::string::npos) continue;
+
+    if (!send([&](auto dmenu) { dmenu->mutable_lines()->set_data(pending.substr(0, end + 1)); })) {
+      return std::nullopt;
+    }
+
+    pending.erase(0, end + 1);
+  }
+
+  auto res = readResponse(-1);
+
+  if (!res || !res->has_dmenu()) return std::nullopt;
+
+  return res->dmenu();
+}
+
 bool DaemonIpcClient::connect() { return m_conn.waitForConnected(1000); }
 
 DaemonIpcClient::DaemonIpcClient() { m_conn.connectToServer(Omnicast::commandSocketPath().c_str()); }
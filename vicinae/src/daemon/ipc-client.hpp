@@ -10,15 +10,33 @@
 #include <qobject.h>
 #include <qstringview.h>
 #include <QIODevice>
+#include <optional>
 
 class DaemonIpcClient {
   QLocalSocket m_conn;
 
   void writeRequest(const proto::ext::daemon::Request &req);
+  // -1 waits for as long as it takes
+  std::optional<proto::ext::daemon::Response> readResponse(int timeout = 5000);
 
 public:
   void toggle();
   void passUrl(const QUrl &url);
+  std::optional<proto::ext::daemon::IndexerStatsResponse> indexerStats();
+  std::optional<proto::ext::daemon::MetricsResponse> metrics();
+
+  /**
+   * Start tracing, or stop it and have the trace written to `path` if one is given.
+   */
+  std::optional<proto::ext::daemon::TraceResponse> trace(proto::ext::daemon::TraceAction action,
+                                                         const std::string &path = {});
+
+  /**
+   * Stream the lines read from `fd` until end of file for the user to pick one, and wait for them to do so.
+   * Lines are sent as they are read, the user can start filtering before the input ends, and picking a line
+   * stops the reading. The response has no selection if the window was closed without picking one.
+   */
+  std::optional<proto::ext::daemon::DmenuResponse> dmenu(const std::string &placeholder, int fd);
   bool connect();
 
   DaemonIpcClient();
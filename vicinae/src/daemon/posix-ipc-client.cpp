@@ -0,0 +1,76 @@
+#include "posix-ipc-client.hpp"
+#include "proto/daemon.pb.h"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+std::optional<std::filesystem::path> PosixIpcClient::socketPath() {
+  // keep in sync with Omnicast::commandSocketPath, anything less common is left to DaemonIpcClient
+  const char *runtimeDir = getenv("XDG_RUNTIME_DIR");
+
+  if (!runtimeDir || !*runtimeDir) return std::nullopt;
+
+  return std::filesystem::path(runtimeDir) / "vicinae" / "vicinae.sock";
+}
+
+bool PosixIpcClient::connect() {
+  auto path = socketPath();
+  sockaddr_un addr{};
+
+  if (!path || path->native().size() >= sizeof(addr.sun_path)) return false;
+
+  m_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+  if (m_fd == -1) return false;
+
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, path->c_str(), sizeof(addr.sun_path) - 1);
+
+  if (::connect(m_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == -1) {
+    close(m_fd);
+    m_fd = -1;
+    return false;
+  }
+
+  return true;
+}
+
+bool PosixIpcClient::writeAll(const std::string &data) const {
+  size_t written = 0;
+
+  while (written < data.size()) {
+    ssize_t n = send(m_fd, data.data() + written, data.size() - written, MSG_NOSIGNAL);
+
+    if (n == -1 && errno == EINTR) continue;
+    if (n <= 0) return false;
+
+    written += n;
+  }
+
+  return true;
+}
+
+bool PosixIpcClient::passUrl(const std::string &url) const {
+  if (m_fd == -1) return false;
+
+  proto::ext::daemon::Request req;
+  std::string data;
+
+  req.mutable_url()->set_url(url);
+  req.SerializeToString(&data);
+
+  // same framing as QDataStream serializing a QByteArray: a big endian length, then the bytes
+  uint32_t length = htonl(data.size());
+
+  return writeAll(std::string(reinterpret_cast<const char *>(&length), sizeof(length)) + data);
+}
+
+bool PosixIpcClient::toggle() const { return passUrl("vicinae://toggle"); }
+
+PosixIpcClient::~PosixIpcClient() {
+  if (m_fd != -1) { close(m_fd); }
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <filesystem>
+#include <optional>
+#include <string>
+
+/**
+ * Talks to the running Vicinae daemon over plain POSIX sockets, for commands that are run often enough for
+ * the startup cost of a QApplication to matter, like toggling the window from a launcher hotkey.
+ *
+ * Requests are framed the way DaemonIpcClient frames them. Commands that need anything more than
+ * sending a url go through DaemonIpcClient instead.
+ */
+class PosixIpcClient {
+  int m_fd = -1;
+
+  static std::optional<std::filesystem::path> socketPath();
+  bool writeAll(const std::string &data) const;
+
+public:
+  bool connect();
+  bool passUrl(const std::string &url) const;
+  bool toggle() const;
+
+  PosixIpcClient() = default;
+  PosixIpcClient(const PosixIpcClient &) = delete;
+  PosixIpcClient &operator=(const PosixIpcClient &) = delete;
+  ~PosixIpcClient();
+};
@@ -0,0 +1,75 @@
+#include "dmenu/dmenu-index.hpp"
+#include <algorithm>
+#include <numeric>
+
+std::shared_ptr<const DmenuSegment> DmenuSegment::build(uint32_t firstLine, QByteArrayView data) {
+  auto segment = std::make_shared<DmenuSegment>();
+  size_t lineCount = std::count(data.begin(), data.end(), '\n');
+
+  segment->firstLine = firstLine;
+  segment->lines.reserve(lineCount + 1);
+  segment->text.reserve(lineCount + 1);
+
+  while (!data.isEmpty()) {
+    auto end = data.indexOf('\n');
+    auto line = data.first(end == -1 ? data.size() : end);
+
+    // lines of files written on other systems
+    if (line.endsWith('\r')) { line.chop(1); }
+
+    auto &text = segment->lines.emplace_back(QString::fromUtf8(line));
+
+    segment->text.add({text});
+    data = end == -1 ? QByteArrayView() : data.sliced(end + 1);
+  }
+
+  segment->positions.resize(segment->lines.size());
+  std::iota(segment->positions.begin(), segment->positions.end(), 0);
+
+  return segment;
+}
+
+void DmenuMatches::merge(DmenuMatches other, size_t limit) {
+  matches.insert(matches.end(), other.matches.begin(), other.matches.end());
+  count += other.count;
+  SearchIndexText::rank(matches, limit);
+}
+
+std::optional<DmenuMatches> searchDmenuSegments(QStringView query,
+                                                std::span<const DmenuSegments::value_type> segments,
+                                                size_t limit, const CancellationToken &token) {
+  DmenuMatches result;
+
+  for (const auto &segment : segments) {
+    if (token.isCancelled()) return std::nullopt;
+
+    auto matches = segment->text.match(query, segment->positions);
+
+    for (auto &match : matches) {
+      match.index += segment->firstLine;
+    }
+
+    result.count += matches.size();
+    result.matches.insert(result.matches.end(), matches.begin(), matches.end());
+
+    // ranking as matches come keeps memory in check when most lines match
+    if (result.matches.size() > limit * 4) { SearchIndexText::rank(result.matches, limit); }
+  }
+
+  SearchIndexText::rank(result.matches, limit);
+
+  return result;
+}
+
+const DmenuSegment *findDmenuSegment(const DmenuSegments &segments, uint32_t position) {
+  auto it = std::ranges::upper_bound(segments, position, {},
+                                     [](const auto &segment) { return segment->firstLine; });
+
+  if (it == segments.begin()) return nullptr;
+
+  auto segment = std::prev(it)->get();
+
+  if (position - segment->firstLine >= segment->lines.size()) return nullptr;
+
+  return segment;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "lib/search-index.hpp"
+#include "task-scheduler/task-scheduler.hpp"
+#include <QByteArrayView>
+#include <QString>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+/**
+ * Lines received in a single chunk of a dmenu session, along with their search text. Segments are immutable
+ * once built, so that they can be searched from any thread while the next ones are still coming in.
+ */
+struct DmenuSegment {
+  // position of the first line of the segment among all the lines of the session
+  uint32_t firstLine = 0;
+  std::vector<QString> lines;
+  SearchIndexText text;
+  // 0 to the number of lines, for the whole segment to be matched at once
+  std::vector<uint32_t> positions;
+
+  /**
+   * Split `data` into lines, which are expected to end with a newline. Empty lines are kept, they can be
+   * picked like any other.
+   */
+  static std::shared_ptr<const DmenuSegment> build(uint32_t firstLine, QByteArrayView data);
+};
+
+using DmenuSegments = std::vector<std::shared_ptr<const DmenuSegment>>;
+
+struct DmenuMatches {
+  // best matches first, by position among all the lines of the session
+  std::vector<SearchIndexText::Match> matches;
+  // matches before they were cut down to the limit
+  size_t count = 0;
+
+  /**
+   * Merge matches of other segments, keeping the `limit` best ones.
+   */
+  void merge(DmenuMatches other, size_t limit);
+};
+
+/**
+ * The `limit` lines of `segments` best matching `query`, which is expected to be normalized. Returns nothing
+ * if `token` is cancelled before every segment has been gone through.
+ */
+std::optional<DmenuMatches> searchDmenuSegments(QStringView query,
+                                                std::span<const DmenuSegments::value_type> segments,
+                                                size_t limit, const CancellationToken &token);
+
+/**
+ * The segment the line at `position` belongs to. `segments` are expected to be ordered.
+ */
+const DmenuSegment *findDmenuSegment(const DmenuSegments &segments, uint32_t position);
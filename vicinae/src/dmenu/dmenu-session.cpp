@@ -0,0 +1,196 @@
+#include "dmenu/dmenu-session.hpp"
+#include "lib/text-tokenizer.hpp"
+#include "navigation-controller.hpp"
+#include <algorithm>
+
+void DmenuSession::appendLines(QByteArray data) {
+  if (m_finished || data.isEmpty()) return;
+
+  ++m_pendingChunks;
+  m_indexQueue.start([this, data = std::move(data)]() {
+    auto segment = DmenuSegment::build(m_indexedLineCount, data);
+
+    m_indexedLineCount += segment->lines.size();
+    QMetaObject::invokeMethod(this, [this, segment]() { segmentBuilt(segment); }, Qt::QueuedConnection);
+  });
+  updateLoading();
+}
+
+void DmenuSession::endInput() {
+  m_inputEnded = true;
+  updateLoading();
+}
+
+void DmenuSession::segmentBuilt(std::shared_ptr<const DmenuSegment> segment) {
+  --m_pendingChunks;
+  m_lineCount += segment->lines.size();
+  m_segments.emplace_back(std::move(segment));
+
+  if (!m_query.isEmpty()) { searchSegments(m_searchedSegments, m_segments.size()); }
+
+  scheduleUpdate();
+  updateLoading();
+}
+
+void DmenuSession::search(const QString &text) {
+  QString query = TextTokenizer::normalize(text.trimmed());
+
+  if (query == m_query) return;
+
+  m_searchToken.cancel();
+  m_searchToken = {};
+  m_query = query;
+  ++m_generation;
+  m_matches = {};
+  m_searchedSegments = 0;
+  m_pendingSlices = 0;
+
+  if (m_query.isEmpty()) {
+    updateView();
+    updateLoading();
+    return;
+  }
+
+  size_t sliceCount = std::min(TaskScheduler::instance().concurrency(TaskScheduler::Priority::Interactive),
+                               std::max<size_t>(1, m_segments.size()));
+  size_t sliceSize = (m_segments.size() + sliceCount - 1) / std::max<size_t>(1, sliceCount);
+
+  for (size_t begin = 0; begin < m_segments.size(); begin += sliceSize) {
+    searchSegments(begin, std::min(begin + sliceSize, m_segments.size()));
+  }
+
+  // the previous results no longer apply, even if nothing is searched yet
+  updateView();
+  updateLoading();
+}
+
+void DmenuSession::searchSegments(size_t begin, size_t end) {
+  if (begin >= end) return;
+
+  DmenuSegments slice(m_segments.begin() + begin, m_segments.begin() + end);
+
+  m_searchedSegments = std::max(m_searchedSegments, end);
+  ++m_pendingSlices;
+  m_searchTasks.start(
+      [this, slice = std::move(slice), query = m_query, token = m_searchToken, generation = m_generation]() {
+        auto matches = searchDmenuSegments(query, slice, MAX_RESULTS, token);
+
+        if (!matches) return;
+
+        QMetaObject::invokeMethod(
+            this,
+            [this, generation, matches = std::move(*matches)]() mutable {
+              sliceSearched(generation, std::move(matches));
+            },
+            Qt::QueuedConnection);
+      },
+      m_searchToken);
+}
+
+void DmenuSession::sliceSearched(uint64_t generation, DmenuMatches matches) {
+  if (generation != m_generation) return;
+
+  --m_pendingSlices;
+  m_matches.merge(std::move(matches), MAX_RESULTS);
+  scheduleUpdate();
+  updateLoading();
+}
+
+void DmenuSession::scheduleUpdate() {
+  if (!m_updateTimer->isActive()) { m_updateTimer->start(); }
+}
+
+void DmenuSession::updateView() {
+  m_updateTimer->stop();
+
+  if (!m_view) return;
+
+  std::vector<DmenuView::Row> rows;
+
+  if (m_query.isEmpty()) {
+    rows.reserve(std::min(m_lineCount, MAX_RESULTS));
+
+    for (const auto &segment : m_segments) {
+      for (size_t i = 0; i != segment->lines.size() && rows.size() != MAX_RESULTS; ++i) {
+        rows.emplace_back(DmenuView::Row{.position = static_cast<uint32_t>(segment->firstLine + i),
+                                         .line = segment->lines[i]});
+      }
+
+      if (rows.size() == MAX_RESULTS) break;
+    }
+
+    m_view->setRows(QString("Lines (%1)").arg(m_lineCount), rows);
+    return;
+  }
+
+  rows.reserve(m_matches.matches.size());
+
+  for (const auto &match : m_matches.matches) {
+    if (auto segment = findDmenuSegment(m_segments, match.index)) {
+      rows.emplace_back(
+          DmenuView::Row{.position = match.index, .line = segment->lines[match.index - segment->firstLine]});
+    }
+  }
+
+  m_view->setRows(QString("Results (%1)").arg(m_matches.count), rows);
+}
+
+void DmenuSession::updateLoading() {
+  if (m_view) { m_view->setLoading(!m_inputEnded || m_pendingChunks > 0 || m_pendingSlices > 0); }
+}
+
+void DmenuSession::finish(const std::optional<QString> &selection) {
+  if (m_finished) return;
+
+  m_finished = true;
+  m_searchToken.cancel();
+  m_reply(selection);
+  closeView();
+  emit finished();
+}
+
+void DmenuSession::closeView() {
+  if (!m_view) return;
+
+  auto view = m_view;
+
+  m_view.clear();
+  view->disconnect(this);
+
+  if (m_navigation.isWindowOpened()) {
+    m_navigation.closeWindow({.popToRootType = PopToRootType::Immediate});
+  } else {
+    m_navigation.popToRoot();
+  }
+}
+
+DmenuSession::DmenuSession(NavigationController &navigation, const QString &placeholder, Reply reply)
+    : m_navigation(navigation), m_reply(std::move(reply)) {
+  m_updateTimer->setSingleShot(true);
+  m_updateTimer->setInterval(UPDATE_INTERVAL);
+  connect(m_updateTimer, &QTimer::timeout, this, &DmenuSession::updateView);
+
+  m_view = new DmenuView(this, placeholder);
+  // going back from the view or hiding the window is how the user gives up on picking a line
+  connect(m_view, &QObject::destroyed, this, [this]() { finish(std::nullopt); });
+  connect(&m_navigation, &NavigationController::windowVisiblityChanged, this, [this](bool visible) {
+    if (!visible) { finish(std::nullopt); }
+  });
+
+  m_navigation.popToRoot();
+  m_navigation.pushView(m_view);
+  m_navigation.showWindow();
+  updateLoading();
+}
+
+DmenuSession::~DmenuSession() {
+  // the client went away before picking a line, there is no one to reply to
+  m_finished = true;
+  closeView();
+
+  // the tasks post their results to the session
+  m_searchToken.cancel();
+  m_indexQueue.clear();
+  m_indexQueue.waitForDone();
+  m_searchTasks.waitForDone();
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include "dmenu/dmenu-index.hpp"
+#include "dmenu/dmenu-view.hpp"
+#include "task-scheduler/task-scheduler.hpp"
+#include <QByteArray>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <chrono>
+#include <functional>
+#include <optional>
+
+class NavigationController;
+
+/**
+ * A session of `vicinae dmenu`, which streams lines over the IPC connection for the user to pick one.
+ *
+ * Chunks of lines are split and indexed in order off the GUI thread, each into a segment of its own, and
+ * filtering works while lines are still coming in: a query is matched against slices of the segments in
+ * parallel, the results of every slice being merged as they come, and segments added afterwards are only
+ * matched on their own. At most `MAX_RESULTS` lines are shown at once, which keeps the view responsive
+ * whatever the number of lines.
+ *
+ * The session is over once a line was picked or the view went away, at which point the client is replied
+ * to.
+ */
+class DmenuSession : public QObject {
+  Q_OBJECT
+
+public:
+  using Reply = std::function<void(const std::optional<QString> &selection)>;
+
+  static constexpr size_t MAX_RESULTS = 1000;
+  // lines come in faster than it is worth showing them
+  static constexpr auto UPDATE_INTERVAL = std::chrono::milliseconds(50);
+
+  void appendLines(QByteArray data);
+  void endInput();
+  void search(const QString &text);
+
+  /**
+   * Reply with `selection`, or with nothing if nothing was picked, and close the view. Only the first call
+   * replies.
+   */
+  void finish(const std::optional<QString> &selection);
+
+  /**
+   * Opens the view on top of the root search, in place of whatever was shown.
+   */
+  DmenuSession(NavigationController &navigation, const QString &placeholder, Reply reply);
+  ~DmenuSession();
+
+signals:
+  void finished() const;
+
+private:
+  void segmentBuilt(std::shared_ptr<const DmenuSegment> segment);
+  // search the segments from `begin` to `end` for the current query
+  void searchSegments(size_t begin, size_t end);
+  void sliceSearched(uint64_t generation, DmenuMatches matches);
+  void scheduleUpdate();
+  void updateView();
+  void updateLoading();
+  void closeView();
+
+  NavigationController &m_navigation;
+  QPointer<DmenuView> m_view;
+  Reply m_reply;
+  bool m_finished = false;
+
+  DmenuSegments m_segments;
+  size_t m_lineCount = 0;
+  size_t m_pendingChunks = 0;
+  bool m_inputEnded = false;
+  // only accessed from the index queue
+  uint32_t m_indexedLineCount = 0;
+
+  QString m_query;
+  uint64_t m_generation = 0;
+  CancellationToken m_searchToken;
+  DmenuMatches m_matches;
+  // segments the current query was matched against, or is being matched against
+  size_t m_searchedSegments = 0;
+  size_t m_pendingSlices = 0;
+
+  QTimer *m_updateTimer = new QTimer(this);
+
+  TaskQueue m_indexQueue{TaskScheduler::Priority::VisibleUi};
+  TaskGroup m_searchTasks{TaskScheduler::Priority::Interactive};
+};
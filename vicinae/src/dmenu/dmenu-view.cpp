@@ -0,0 +1,56 @@
+#include "dmenu/dmenu-view.hpp"
+#include "dmenu/dmenu-session.hpp"
+#include "ui/action-pannel/action.hpp"
+#include "ui/omni-list/omni-list.hpp"
+
+class DmenuListItem : public AbstractDefaultListItem, public ListView::Actionnable {
+  DmenuView::Row m_row;
+  DmenuView *m_view;
+
+public:
+  // lines are not unique, positions are
+  QString generateId() const override { return QString::number(m_row.position); }
+
+  ItemData data() const override { return {.name = m_row.line}; }
+
+  std::unique_ptr<ActionPanelState> newActionPanel(ApplicationContext *ctx) const override {
+    auto panel = std::make_unique<ActionPanelState>();
+    auto section = panel->createSection();
+    auto view = m_view;
+    auto select = new StaticAction("Select line", ImageURL::builtin("checkmark"),
+                                   [view, line = m_row.line]() { view->select(line); });
+
+    select->setPrimary(true);
+    select->setShortcut(KeyboardShortcutModel::enter());
+    section->addAction(select);
+
+    return panel;
+  }
+
+  DmenuListItem(DmenuView::Row row, DmenuView *view) : m_row(std::move(row)), m_view(view) {}
+};
+
+void DmenuView::setRows(const QString &title, const std::vector<Row> &rows) {
+  m_list->updateModel([&]() {
+    auto &section = m_list->addSection(title);
+
+    for (const auto &row : rows) {
+      section.addItem(std::make_unique<DmenuListItem>(row, this));
+    }
+  });
+}
+
+void DmenuView::initialize() {
+  setSearchPlaceholderText(m_placeholder.isEmpty() ? "Search lines..." : m_placeholder);
+}
+
+void DmenuView::textChanged(const QString &text) {
+  if (m_session) { m_session->search(text); }
+}
+
+void DmenuView::select(const QString &line) {
+  if (m_session) { m_session->finish(line); }
+}
+
+DmenuView::DmenuView(DmenuSession *session, QString placeholder)
+    : m_session(session), m_placeholder(std::move(placeholder)) {}
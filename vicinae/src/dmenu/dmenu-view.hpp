@@ -0,0 +1,33 @@
+#pragma once
+#include "ui/views/list-view.hpp"
+#include <QPointer>
+#include <functional>
+#include <vector>
+
+class DmenuSession;
+
+/**
+ * Lines of a dmenu session, as filtered by the session: the view only shows what it is given.
+ */
+class DmenuView : public ListView {
+public:
+  struct Row {
+    // position of the line among all the lines of the session
+    uint32_t position;
+    QString line;
+  };
+
+  void setRows(const QString &title, const std::vector<Row> &rows);
+
+  DmenuView(DmenuSession *session, QString placeholder);
+
+private:
+  void initialize() override;
+  void textChanged(const QString &text) override;
+  void select(const QString &line);
+
+  QPointer<DmenuSession> m_session;
+  QString m_placeholder;
+
+  friend class DmenuListItem;
+};
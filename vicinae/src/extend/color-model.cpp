@@ -2,18 +2,33 @@
 #include "../ui/image/url.hpp"
 #include "theme.hpp"
 #include "ui/omni-painter/omni-painter.hpp"
+#include <QHash>
+#include <mutex>
 #include <qjsonobject.h>
 
 ColorLikeModelParser::ColorLikeModelParser() {}
 
 ColorLike ColorLikeModelParser::parse(const QJsonValue &colorLike) {
-  if (colorLike.isString()) {
-    if (auto tint = ImageURL::tintForName(colorLike.toString()); tint != SemanticColor::InvalidTint) {
-      return tint;
-    }
+  if (!colorLike.isString()) return QColor();
 
-    return QColor(colorLike.toString());
+  // tints are resolved at paint time, what a name parses to does not depend on the theme. Models are
+  // parsed off the GUI thread, by as many threads as there are extensions rendering.
+  static constexpr qsizetype MAX_CACHED = 512;
+  static QHash<QString, ColorLike> cache;
+  static std::mutex mutex;
+  QString name = colorLike.toString();
+  std::lock_guard lock(mutex);
+
+  if (auto it = cache.constFind(name); it != cache.constEnd()) return *it;
+  if (cache.size() >= MAX_CACHED) { cache.clear(); }
+
+  ColorLike color;
+
+  if (auto tint = ImageURL::tintForName(name); tint != SemanticColor::InvalidTint) {
+    color = tint;
+  } else {
+    color = QColor(name);
   }
 
-  return QColor();
+  return *cache.insert(name, color);
 }
@@ -8,12 +8,19 @@
 #include <qjsonarray.h>
 #include <qjsonobject.h>
 
-GridItemViewModel GridModelParser::parseListItem(const QJsonObject &instance, size_t index) {
-  GridItemViewModel model;
+GridItemPtr GridModelParser::parseListItem(const QJsonObject &instance, size_t index) {
   auto props = instance.value("props").toObject();
+  auto id = props["id"].toString(QString::number(index));
+
+  if (m_cache) {
+    if (auto item = m_cache->reuse(instance, id)) return item;
+  }
+
   auto children = instance.value("children").toArray();
+  auto item = std::make_shared<GridItemViewModel>();
+  auto &model = *item;
 
-  model.id = props["id"].toString(QString::number(index));
+  model.id = id;
   model.title = props["title"].toString();
   model.subtitle = props["subtitle"].toString();
 
@@ -43,7 +50,9 @@ GridItemViewModel GridModelParser::parseListItem(const QJsonObject &instance, si
     if (type == "action-panel") { model.actionPannel = ActionPannelParser().parse(obj); }
   }
 
-  return model;
+  if (m_cache) { m_cache->insert(instance, item); }
+
+  return item;
 }
 
 GridSectionModel GridModelParser::parseSection(const QJsonObject &instance) {
@@ -65,11 +74,7 @@ GridSectionModel GridModelParser::parseSection(const QJsonObject &instance) {
     auto obj = child.toObject();
     auto type = obj.value("type").toString();
 
-    if (type == "grid-item") {
-      auto item = parseListItem(obj, index);
-
-      model.children.push_back(item);
-    }
+    if (type == "grid-item") { model.children.emplace_back(parseListItem(obj, index)); }
 
     ++index;
   }
@@ -130,11 +135,7 @@ GridModel GridModelParser::parse(const QJsonObject &instance) {
 
     if (type == "action-panel") { model.actions = ActionPannelParser().parse(childObj); }
 
-    if (type == "grid-item") {
-      auto item = parseListItem(childObj, index);
-
-      model.items.push_back(item);
-    }
+    if (type == "grid-item") { model.items.emplace_back(parseListItem(childObj, index)); }
 
     if (type == "grid-section") {
       auto section = parseSection(childObj);
@@ -150,4 +151,4 @@ GridModel GridModelParser::parse(const QJsonObject &instance) {
   return model;
 }
 
-GridModelParser::GridModelParser() {}
+GridModelParser::GridModelParser(GridItemCache *cache) : m_cache(cache) {}
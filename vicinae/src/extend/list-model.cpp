@@ -8,15 +8,26 @@
 #include <qjsonobject.h>
 #include <qlogging.h>
 
-ListItemViewModel ListModelParser::parseListItem(const QJsonObject &instance, size_t index) {
-  ListItemViewModel model;
+ListItemPtr ListModelParser::parseListItem(const QJsonObject &instance, size_t index) {
   auto props = instance.value("props").toObject();
+  auto id = props["id"].toString(QString::number(index));
+
+  if (m_cache) {
+    if (auto item = m_cache->reuse(instance, id)) return item;
+  }
+
   auto children = instance.value("children").toArray();
+  auto item = std::make_shared<ListItemViewModel>();
+  auto &model = *item;
 
-  model.id = props["id"].toString(QString::number(index));
+  model.id = id;
   model.title = props["title"].toString();
   model.subtitle = props["subtitle"].toString();
 
+  for (const auto &keyword : props.value("keywords").toArray()) {
+    model.keywords.emplace_back(keyword.toString());
+  }
+
   if (props.contains("icon")) { model.icon = ImageModelParser().parse((props.value("icon").toObject())); }
 
   size_t i = 0;
@@ -32,7 +43,9 @@ ListItemViewModel ListModelParser::parseListItem(const QJsonObject &instance, si
     i += 1;
   }
 
-  return model;
+  if (m_cache) { m_cache->insert(instance, item); }
+
+  return item;
 }
 
 ListSectionModel ListModelParser::parseSection(const QJsonObject &instance) {
@@ -49,11 +62,7 @@ ListSectionModel ListModelParser::parseSection(const QJsonObject &instance) {
     auto obj = child.toObject();
     auto type = obj.value("type").toString();
 
-    if (type == "list-item") {
-      auto item = parseListItem(obj, index);
-
-      model.children.push_back(item);
-    }
+    if (type == "list-item") { model.children.emplace_back(parseListItem(obj, index)); }
 
     ++index;
   }
@@ -61,7 +70,36 @@ ListSectionModel ListModelParser::parseSection(const QJsonObject &instance) {
   return model;
 }
 
-ListModelParser::ListModelParser() {}
+std::shared_ptr<const SearchIndexText>
+ListModelParser::buildFilterIndex(const std::vector<ListChild> &items) {
+  auto index = std::make_shared<SearchIndexText>();
+  std::vector<QStringView> fields;
+  auto add = [&](const ListItemViewModel &item) {
+    fields.clear();
+    fields.emplace_back(item.title);
+    fields.emplace_back(item.subtitle);
+    for (const auto &keyword : item.keywords) {
+      fields.emplace_back(keyword);
+    }
+    index->add(fields);
+  };
+
+  index->reserve(items.size());
+
+  for (const auto &child : items) {
+    if (auto item = std::get_if<ListItemPtr>(&child)) {
+      add(**item);
+    } else if (auto section = std::get_if<ListSectionModel>(&child)) {
+      for (const auto &item : section->children) {
+        add(*item);
+      }
+    }
+  }
+
+  return index;
+}
+
+ListModelParser::ListModelParser(ListItemCache *cache) : m_cache(cache) {}
 
 ListModel ListModelParser::parse(const QJsonObject &instance) {
   ListModel model;
@@ -101,11 +139,7 @@ ListModel ListModelParser::parse(const QJsonObject &instance) {
 
     if (type == "action-panel") { model.actions = ActionPannelParser().parse(childObj); }
 
-    if (type == "list-item") {
-      auto item = parseListItem(childObj, index);
-
-      model.items.push_back(item);
-    }
+    if (type == "list-item") { model.items.emplace_back(parseListItem(childObj, index)); }
 
     if (type == "list-section") {
       auto section = parseSection(childObj);
@@ -120,5 +154,7 @@ ListModel ListModelParser::parse(const QJsonObject &instance) {
     ++index;
   }
 
+  if (model.filtering) { model.filterIndex = buildFilterIndex(model.items); }
+
   return model;
 }
@@ -1,5 +1,6 @@
 #include "extend/metadata-model.hpp"
 #include "extend/tag-model.hpp"
+#include <algorithm>
 #include <qjsonarray.h>
 #include <qjsonobject.h>
 
@@ -34,5 +35,6 @@ MetadataModel MetadataModelParser::parse(const QJsonObject &instance) {
     if (type == "tag-list") { items.push_back(TagListParser().parse(child)); }
   }
 
-  return {items};
+  // 0 stands for metadata that is not cached, see `HorizontalMetadata::setMetadata`
+  return {.children = items, .hash = std::max<size_t>(qHash(children), 1)};
 }
@@ -23,11 +23,17 @@ ParsedRenderData ModelParser::parse(const QJsonArray &views) {
     rootData.dirty = root.value("dirty").toBool(true);
     rootData.propsDirty = root.value("propsDirty").toBool(true);
 
+    // unchanged views are not rendered again, no need to parse them
+    if (!rootData.dirty && !rootData.propsDirty) {
+      render.items.emplace_back(rootData);
+      continue;
+    }
+
     if (type == "list") {
-      rootData.root = ListModelParser().parse(root);
+      rootData.root = ListModelParser(&m_listItems).parse(root);
       // qDebug() << "push list model with";
     } else if (type == "grid") {
-      rootData.root = GridModelParser().parse(root);
+      rootData.root = GridModelParser(&m_gridItems).parse(root);
     } else if (type == "detail") {
       rootData.root = RootDetailModelParser().parse(root);
     } else if (type == "form") {
@@ -39,5 +45,8 @@ ParsedRenderData ModelParser::parse(const QJsonArray &views) {
     render.items.emplace_back(rootData);
   }
 
+  m_listItems.endFrame();
+  m_gridItems.endFrame();
+
   return render;
 }
@@ -0,0 +1,226 @@
+#include "extend/retained-render-tree.hpp"
+#include "lib/proto-string.hpp"
+#include "utils/utils.hpp"
+#include <algorithm>
+#include <qlogging.h>
+
+RetainedRenderTree::RetainedRenderTree() { clear(); }
+
+void RetainedRenderTree::clear() {
+  m_nodes.clear();
+  m_nodes[ROOT_ID] = Node{.type = "root", .propsDirty = false};
+}
+
+static QJsonObject parseProps(const google::protobuf::Map<std::string, google::protobuf::Value> &props) {
+  QJsonObject obj;
+
+  for (const auto &[key, value] : props) {
+    ProtoString::insert(obj, key, protoToJsonValue(value));
+  }
+
+  return obj;
+}
+
+bool RetainedRenderTree::apply(const Operations &ops) {
+  using Operation = proto::ext::ui::RenderOperation;
+
+  for (const auto &op : ops) {
+    bool ok = false;
+
+    switch (op.payload_case()) {
+    case Operation::kInsert:
+      ok = insert(op.insert());
+      break;
+    case Operation::kMove:
+      ok = move(op.move());
+      break;
+    case Operation::kRemove:
+      ok = remove(op.remove());
+      break;
+    case Operation::kUpdate:
+      ok = update(op.update());
+      break;
+    case Operation::kClear:
+      ok = clearChildren(op.clear().id());
+      break;
+    default:
+      qWarning() << "RetainedRenderTree: unknown render operation" << op.payload_case();
+      ok = true;
+      break;
+    }
+
+    if (!ok) {
+      qCritical() << "RetainedRenderTree: failed to apply render operation" << op.payload_case();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool RetainedRenderTree::insert(const proto::ext::ui::InsertNodeOperation &op) {
+  auto it = m_nodes.find(op.parent());
+  NodeId id = op.node().id();
+  std::optional<NodeId> before;
+
+  if (op.has_before()) before = op.before();
+  if (it == m_nodes.end() || id == ROOT_ID || m_nodes.contains(id)) return false;
+  if (!placeChild(it->second, id, before)) return false;
+
+  addSubtree(op.parent(), op.node());
+  markDirty(op.parent());
+
+  return true;
+}
+
+bool RetainedRenderTree::move(const proto::ext::ui::MoveNodeOperation &op) {
+  auto parentIt = m_nodes.find(op.parent());
+  auto it = m_nodes.find(op.id());
+  std::optional<NodeId> before;
+
+  if (op.has_before()) before = op.before();
+  if (parentIt == m_nodes.end() || it == m_nodes.end() || op.id() == ROOT_ID) return false;
+
+  // the reconciler also uses moves to append nodes that were in another parent
+  if (auto oldParent = m_nodes.find(it->second.parent); oldParent != m_nodes.end()) {
+    std::erase(oldParent->second.children, op.id());
+    markDirty(oldParent->first);
+  }
+
+  if (!placeChild(parentIt->second, op.id(), before)) return false;
+
+  it->second.parent = op.parent();
+  markDirty(op.parent());
+
+  return true;
+}
+
+bool RetainedRenderTree::remove(const proto::ext::ui::RemoveNodeOperation &op) {
+  auto it = m_nodes.find(op.parent());
+
+  if (it == m_nodes.end() || std::erase(it->second.children, op.id()) == 0) return false;
+
+  eraseSubtree(op.id());
+  markDirty(op.parent());
+
+  return true;
+}
+
+bool RetainedRenderTree::update(const proto::ext::ui::UpdateNodeOperation &op) {
+  auto it = m_nodes.find(op.id());
+
+  if (it == m_nodes.end()) return false;
+
+  it->second.props = parseProps(op.props());
+  it->second.propsDirty = true;
+  markDirty(it->second.parent);
+
+  return true;
+}
+
+bool RetainedRenderTree::clearChildren(NodeId id) {
+  auto it = m_nodes.find(id);
+
+  if (it == m_nodes.end()) return false;
+
+  auto children = std::move(it->second.children);
+
+  it->second.children.clear();
+
+  for (NodeId child : children) {
+    eraseSubtree(child);
+  }
+
+  markDirty(id);
+
+  return true;
+}
+
+bool RetainedRenderTree::placeChild(Node &parent, NodeId id, std::optional<NodeId> before) {
+  if (!before) {
+    parent.children.emplace_back(id);
+    return true;
+  }
+
+  auto pos = std::ranges::find(parent.children, *before);
+
+  if (pos == parent.children.end()) return false;
+
+  parent.children.insert(pos, id);
+
+  return true;
+}
+
+void RetainedRenderTree::addSubtree(NodeId parent, const proto::ext::ui::RenderNode &proto) {
+  auto &node = m_nodes[proto.id()];
+
+  node.type = m_types.get(proto.type());
+  node.props = parseProps(proto.props());
+  node.parent = parent;
+  node.children.reserve(proto.children_size());
+
+  for (const auto &child : proto.children()) {
+    node.children.emplace_back(child.id());
+    addSubtree(proto.id(), child);
+  }
+}
+
+void RetainedRenderTree::eraseSubtree(NodeId id) {
+  auto it = m_nodes.find(id);
+
+  if (it == m_nodes.end()) return;
+
+  auto children = std::move(it->second.children);
+
+  m_nodes.erase(it);
+
+  for (NodeId child : children) {
+    eraseSubtree(child);
+  }
+}
+
+void RetainedRenderTree::markDirty(NodeId id) {
+  for (auto it = m_nodes.find(id); it != m_nodes.end(); it = m_nodes.find(it->second.parent)) {
+    it->second.dirty = true;
+  }
+}
+
+QJsonObject RetainedRenderTree::serialize(NodeId id, Node &node) {
+  if (!node.dirty && !node.propsDirty) return node.serialized;
+
+  QJsonArray children;
+
+  for (NodeId child : node.children) {
+    children.append(serialize(child, m_nodes.at(child)));
+  }
+
+  QJsonObject obj;
+
+  obj["nodeId"] = static_cast<qint64>(id);
+  obj["type"] = node.type;
+  obj["props"] = node.props;
+  obj["children"] = children;
+  obj["dirty"] = false;
+  obj["propsDirty"] = false;
+  node.serialized = obj;
+
+  obj["dirty"] = node.dirty;
+  obj["propsDirty"] = node.propsDirty;
+  node.dirty = false;
+  node.propsDirty = false;
+
+  return obj;
+}
+
+QJsonArray RetainedRenderTree::views() {
+  QJsonArray views;
+  auto &root = m_nodes.at(ROOT_ID);
+
+  for (NodeId id : root.children) {
+    views.append(QJsonObject{{"root", serialize(id, m_nodes.at(id))}});
+  }
+
+  root.dirty = false;
+
+  return views;
+}
@@ -3,6 +3,7 @@
 #include "extension/extension-navigation-controller.hpp"
 #include "extension-error-view.hpp"
 #include "extension/requests/app-request-router.hpp"
+#include "extension/requests/cache-request-router.hpp"
 #include "extension/requests/clipboard-request-router.hpp"
 #include "extension/requests/storage-request-router.hpp"
 #include "extension/requests/ui-request-router.hpp"
@@ -60,9 +61,11 @@ proto::ext::extension::Response *ExtensionCommandRuntime::dispatchRequest(Extens
 
   switch (data.payload_case()) {
   case Request::kUi:
-    return m_uiRouter->route(data.ui());
+    return m_uiRouter->route(request);
   case Request::kStorage:
     return m_storageRouter->route(data.storage());
+  case Request::kCache:
+    return m_cacheRouter->route(data.cache());
   case Request::kApp:
     return m_appRouter->route(data.app());
   case Request::kClipboard:
@@ -80,6 +83,9 @@ proto::ext::extension::Response *ExtensionCommandRuntime::dispatchRequest(Extens
 void ExtensionCommandRuntime::handleRequest(ExtensionRequest *request) {
   if (request->sessionId() != m_sessionId) return;
 
+  request->span().setExtensionId(m_command->extensionId());
+  request->span().enter("handle");
+
   if (auto res = dispatchRequest(request)) {
     request->respond(res);
     delete request;
@@ -121,6 +127,9 @@ void ExtensionCommandRuntime::initialize() {
   m_uiRouter = std::make_unique<UIRequestRouter>(m_navigation.get(), *context()->services->toastService());
   m_storageRouter =
       std::make_unique<StorageRequestRouter>(context()->services->localStorage(), m_command->extensionId());
+  // where the API reads the cache from, see api/src/api/cache.ts
+  m_cacheRouter = std::make_unique<CacheRequestRouter>(*context()->services->extensionCache(),
+                                                       m_command->path() / "support" / "cache");
   m_appRouter = std::make_unique<AppRequestRouter>(*context()->services->appDb());
   m_clipboardRouter = std::make_unique<ClipboardRequestRouter>(*context()->services->clipman());
 
@@ -4,6 +4,7 @@
 
 class ExtensionCommand;
 class StorageRequestRouter;
+class CacheRequestRouter;
 class ExtensionNavigationController;
 class UIRequestRouter;
 class AppRequestRouter;
@@ -17,6 +18,7 @@ class ExtensionCommandRuntime : public CommandContext {
   std::shared_ptr<ExtensionCommand> m_command;
 
   std::unique_ptr<StorageRequestRouter> m_storageRouter;
+  std::unique_ptr<CacheRequestRouter> m_cacheRouter;
   std::unique_ptr<ExtensionNavigationController> m_navigation;
   std::unique_ptr<UIRequestRouter> m_uiRouter;
   std::unique_ptr<AppRequestRouter> m_appRouter;
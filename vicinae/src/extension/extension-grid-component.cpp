@@ -52,8 +52,13 @@ void ExtensionGridComponent::render(const RenderModel &baseModel) {
 
   // m_selector->setVisible(newModel.searchBarAccessory.has_value() && isVisible());
 
-  if (!newModel.navigationTitle.isEmpty()) { setNavigationTitle(newModel.navigationTitle); }
-  if (!newModel.searchPlaceholderText.isEmpty()) { setSearchPlaceholderText(newModel.searchPlaceholderText); }
+  if (!newModel.navigationTitle.isEmpty() && newModel.navigationTitle != _model.navigationTitle) {
+    setNavigationTitle(newModel.navigationTitle);
+  }
+  if (!newModel.searchPlaceholderText.isEmpty() &&
+      newModel.searchPlaceholderText != _model.searchPlaceholderText) {
+    setSearchPlaceholderText(newModel.searchPlaceholderText);
+  }
 
   if (auto text = newModel.searchText) { setSearchText(*text); }
 
@@ -81,6 +86,8 @@ void ExtensionGridComponent::render(const RenderModel &baseModel) {
 
   m_list->setColumns(newModel.columns.value_or(1));
   m_list->setInset(newModel.inset.value_or(GridItemContentWidget::Inset::Small));
+  if (newModel.dirty) { pageReceived(); }
+  m_list->setNearEndThreshold(nearEndThreshold(newModel.pagination));
   m_list->setModel(newModel.items, policy);
 
   if (!newModel.searchText) {
@@ -95,10 +102,13 @@ void ExtensionGridComponent::render(const RenderModel &baseModel) {
 
   _model = newModel;
 
-  if (auto selected = m_list->selected()) {
+  // the same item as last time did not change, its actions are already shown
+  if (auto selected = m_list->selected(); selected && selected != m_renderedSelection) {
     if (auto panel = selected->actionPannel) { setActionPanel(*panel); }
   }
 
+  m_renderedSelection = m_list->selected();
+
   if (m_list->empty()) {
     if (auto pannel = newModel.actions) { setActionPanel(*pannel); }
   }
@@ -116,6 +126,10 @@ void ExtensionGridComponent::onSelectionChanged(const GridItemViewModel *next) {
 
 void ExtensionGridComponent::handleDebouncedSearchNotification() { auto text = searchText(); }
 
+void ExtensionGridComponent::handleScrolledNearEnd() {
+  if (!_model.isLoading) { requestNextPage(_model.pagination); }
+}
+
 void ExtensionGridComponent::onItemActivated(const GridItemViewModel &item) { executePrimaryAction(); }
 
 void ExtensionGridComponent::textChanged(const QString &text) {
@@ -129,7 +143,7 @@ void ExtensionGridComponent::textChanged(const QString &text) {
     // flag next render to reset the search selection
     _shouldResetSelection = !_model.filtering;
 
-    notify(*handler, {text});
+    notifySearchText(*handler, text);
   }
 }
 
@@ -140,4 +154,7 @@ ExtensionGridComponent::ExtensionGridComponent() : _debounce(new QTimer(this)),
   connect(_debounce, &QTimer::timeout, this, &ExtensionGridComponent::handleDebouncedSearchNotification);
   connect(m_list, &ExtensionGridList::selectionChanged, this, &ExtensionGridComponent::onSelectionChanged);
   connect(m_list, &ExtensionGridList::itemActivated, this, &ExtensionGridComponent::onItemActivated);
+  // emitted while a render lays the grid out, before the model it comes with is current
+  connect(m_list, &ExtensionGridList::scrolledNearEnd, this, &ExtensionGridComponent::handleScrolledNearEnd,
+          Qt::QueuedConnection);
 }
@@ -20,8 +20,8 @@ static const KeyboardShortcutModel secondaryShortcut{.key = "return", .modifiers
 void ExtensionListComponent::renderDropdown(const DropdownModel &dropdown) {
   OmniList::SelectionPolicy selectionPolicy = OmniList::PreserveSelection;
 
-  m_dropdownDebounce->setInterval(dropdown.throttle ? THROTTLE_DEBOUNCE_DURATION
-                                                    : std::chrono::milliseconds(0));
+  m_selector->setSearchThrottled(dropdown.throttle);
+  m_selector->setEnableDefaultFilter(dropdown.filtering.enabled);
 
   if (dropdown.dirty) {
     if (m_dropdownShouldResetSelection) {
@@ -56,11 +56,9 @@ void ExtensionListComponent::renderDropdown(const DropdownModel &dropdown) {
       freeSectionItems.clear();
     }
 
-    m_selector->updateModel();
+    m_selector->updateModel(selectionPolicy);
   }
 
-  m_selector->setEnableDefaultFilter(dropdown.filtering.enabled);
-
   if (auto controlledValue = dropdown.value) {
     m_selector->setValue(*controlledValue);
   } else if (!m_selector->value()) {
@@ -86,8 +84,13 @@ void ExtensionListComponent::render(const RenderModel &baseModel) {
 
   m_selector->setVisible(newModel.searchBarAccessory.has_value() && isVisible());
 
-  if (!newModel.navigationTitle.isEmpty()) { setNavigationTitle(newModel.navigationTitle); }
-  if (!newModel.searchPlaceholderText.isEmpty()) { setSearchPlaceholderText(newModel.searchPlaceholderText); }
+  if (!newModel.navigationTitle.isEmpty() && newModel.navigationTitle != _model.navigationTitle) {
+    setNavigationTitle(newModel.navigationTitle);
+  }
+  if (!newModel.searchPlaceholderText.isEmpty() &&
+      newModel.searchPlaceholderText != _model.searchPlaceholderText) {
+    setSearchPlaceholderText(newModel.searchPlaceholderText);
+  }
   if (auto text = newModel.searchText) { setSearchText(*text); }
 
   if (newModel.throttle != _model.throttle) {
@@ -101,6 +104,8 @@ void ExtensionListComponent::render(const RenderModel &baseModel) {
   }
 
   setLoading(newModel.isLoading);
+  // set before the list is laid out, which is when a page that does not fill the list asks for the next one
+  m_list->setNearEndThreshold(nearEndThreshold(newModel.pagination));
 
   if (newModel.dirty) {
     OmniList::SelectionPolicy policy = OmniList::SelectFirst;
@@ -112,7 +117,8 @@ void ExtensionListComponent::render(const RenderModel &baseModel) {
       policy = OmniList::PreserveSelection;
     }
 
-    m_list->setModel(newModel.items, policy);
+    pageReceived();
+    m_list->setModel(newModel.items, newModel.filterIndex, policy);
   }
 
   /*
@@ -132,20 +138,25 @@ void ExtensionListComponent::render(const RenderModel &baseModel) {
   if (auto selected = m_list->selected(); selected && newModel.dirty) {
     m_split->setDetailVisibility(_model.isShowingDetail);
 
-    if (auto detail = selected->detail) {
-      m_split->detailWidget()->show();
-      if (m_split->isDetailVisible()) {
-        m_detail->updateDetail(*detail);
+    // the same item as last time did not change, there is nothing to update
+    if (selected != m_renderedSelection) {
+      if (auto detail = selected->detail) {
+        m_split->detailWidget()->show();
+        if (m_split->isDetailVisible()) {
+          m_detail->updateDetail(*detail);
+        } else {
+          m_detail->setDetail(*detail);
+        }
       } else {
-        m_detail->setDetail(*detail);
+        m_split->detailWidget()->hide();
       }
-    } else {
-      m_split->detailWidget()->hide();
-    }
 
-    if (auto panel = selected->actionPannel; panel && _model.dirty && panel->dirty) {
-      setActionPanel(*panel);
+      if (auto panel = selected->actionPannel; panel && _model.dirty && panel->dirty) {
+        setActionPanel(*panel);
+      }
     }
+
+    m_renderedSelection = selected;
   }
 
   if (m_list->empty()) {
@@ -188,7 +199,7 @@ void ExtensionListComponent::handleDropdownSearchChanged(const QString &text) {
     if (auto dropdown = std::get_if<DropdownModel>(&*accessory)) {
       m_dropdownShouldResetSelection = !dropdown->filtering.enabled;
 
-      if (auto onChange = dropdown->onSearchTextChange) { emit notify(*onChange, {text}); }
+      if (auto onChange = dropdown->onSearchTextChange) { notifySearchText(*onChange, text); }
     }
   }
 }
@@ -209,10 +220,14 @@ void ExtensionListComponent::handleDebouncedSearchNotification() {
     // flag next render to reset the search selection
     _shouldResetSelection = !_model.filtering;
 
-    notify(*handler, {text});
+    notifySearchText(*handler, text);
   }
 }
 
+void ExtensionListComponent::handleScrolledNearEnd() {
+  if (!_model.isLoading) { requestNextPage(_model.pagination); }
+}
+
 void ExtensionListComponent::onItemActivated(const ListItemViewModel &item) { executePrimaryAction(); }
 
 void ExtensionListComponent::textChanged(const QString &text) {
@@ -229,7 +244,7 @@ void ExtensionListComponent::textChanged(const QString &text) {
   if (auto handler = _model.onSearchTextChange) {
     // flag next render to reset the search selection
     _shouldResetSelection = !_model.filtering;
-    notify(*handler, {text});
+    notifySearchText(*handler, text);
   }
 
   //_debounce->start();
@@ -249,6 +264,9 @@ ExtensionListComponent::ExtensionListComponent() : _debounce(new QTimer(this)),
   connect(_debounce, &QTimer::timeout, this, &ExtensionListComponent::handleDebouncedSearchNotification);
   connect(m_list, &ExtensionList::selectionChanged, this, &ExtensionListComponent::onSelectionChanged);
   connect(m_list, &ExtensionList::itemActivated, this, &ExtensionListComponent::onItemActivated);
+  // emitted while a render lays the list out, before the model it comes with is current
+  connect(m_list, &ExtensionList::scrolledNearEnd, this, &ExtensionListComponent::handleScrolledNearEnd,
+          Qt::QueuedConnection);
   connect(m_selector, &SelectorInput::selectionChanged, this,
           &ExtensionListComponent::handleDropdownSelectionChanged);
   connect(m_selector, &SelectorInput::textChanged, this,
@@ -3,6 +3,7 @@
 #include "extension/extension-command.hpp"
 #include "extension/extension-view-wrapper.hpp"
 #include "navigation-controller.hpp"
+#include <algorithm>
 #include <qobject.h>
 
 class ExtensionNavigationController : public QObject {
@@ -12,12 +13,27 @@ class ExtensionNavigationController : public QObject {
   std::unique_ptr<ExtensionCommandController> m_controller;
   QString m_sessionId;
   bool m_devMode = false;
+  const BaseView *m_topView = nullptr;
+  bool m_visible = true;
 
   QString defaultNavigationTitle() {
     if (m_devMode) return QString("%1 (Dev)").arg(m_command->name());
     return m_command->name();
   }
 
+  /**
+   * The extension stops rendering while none of its views can be seen, either because the window is
+   * closed or because a view that is not part of the command was pushed on top of them.
+   */
+  void updateVisibility() {
+    bool visible = m_navigation->isWindowOpened() && std::ranges::contains(m_views, m_topView);
+
+    if (visible == m_visible) return;
+
+    m_visible = visible;
+    m_controller->notify("view-visibility", {visible});
+  }
+
 public:
   ExtensionCommandController *controller() const { return m_controller.get(); }
 
@@ -30,6 +46,7 @@ public:
     m_navigation->setNavigationTitle(defaultNavigationTitle());
     m_navigation->setNavigationIcon(m_command->iconUrl());
     m_views.emplace_back(view);
+    updateVisibility();
   }
 
   std::vector<ExtensionViewWrapper *> views() const { return m_views; }
@@ -58,5 +75,12 @@ public:
         m_controller(std::make_unique<ExtensionCommandController>(manager)) {
     connect(navigation, &NavigationController::viewPoped, this,
             &ExtensionNavigationController::handleViewPoped);
+    connect(navigation, &NavigationController::currentViewChanged, this,
+            [this](const NavigationController::ViewState &state) {
+              m_topView = state.sender;
+              updateVisibility();
+            });
+    connect(navigation, &NavigationController::windowVisiblityChanged, this,
+            &ExtensionNavigationController::updateVisibility);
   }
 };
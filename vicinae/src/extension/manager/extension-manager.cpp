@@ -1,27 +1,33 @@
 #include "extension/manager/extension-manager.hpp"
+#include "extension/extension-command.hpp"
+#include "startup-benchmark.hpp"
+#include "utils/utils.hpp"
+#include <QSaveFile>
+#include <QStandardPaths>
 #include <QtConcurrent/qtconcurrentrun.h>
 #include <absl/strings/internal/str_format/extension.h>
 #include <qfuturewatcher.h>
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cstring>
 #include <qlogging.h>
 #include <qstringview.h>
 #include <string>
 #include <unordered_map>
 #include "pid-file/pid-file.hpp"
+#include "trace/trace.hpp"
+#include "vicinae.hpp"
 #include "proto/extension.pb.h"
 #include "proto/manager.pb.h"
 
-void Bus::sendMessage(const QByteArray &data) {
-  QByteArray message;
-  QDataStream dataStream(&message, QIODevice::WriteOnly);
-
-  dataStream << data;
-
-  device->write(message);
+void Bus::sendMessage(const google::protobuf::MessageLite &message) {
+  PacketFramer::frame(message, m_packet);
+  device->write(m_packet);
   device->waitForBytesWritten(1000);
 }
 
-void Bus::handleMessage(const proto::ext::IpcMessage &msg) {
-  if (msg.has_extension_request()) { emit extensionRequest(msg.extension_request()); }
+void Bus::handleMessage(proto::ext::IpcMessage &msg, const std::shared_ptr<google::protobuf::Arena> &arena) {
+  if (msg.has_extension_request()) { emit extensionRequest(msg.mutable_extension_request(), arena); }
   if (msg.has_extension_event()) { emit extensionEvent(msg.extension_event()); }
   if (msg.has_manager_response()) {
     auto &response = msg.manager_response();
@@ -39,34 +45,37 @@ void Bus::handleMessage(const proto::ext::IpcMessage &msg) {
 }
 
 void Bus::readyRead() {
-  while (device->bytesAvailable() > 0) {
-    auto read = device->readAll();
+  TraceScope trace("ipc", "bus read");
 
-    _message.data.append(read);
+  if (!m_framer.readFrom(device)) return;
 
-    while (_message.data.size() >= sizeof(uint32_t)) {
-      uint32_t length = ntohl(*reinterpret_cast<uint32_t *>(_message.data.data()));
-      bool isComplete = _message.data.size() - sizeof(uint32_t) >= length;
+  while (auto packet = m_framer.next()) {
+    // every message gets its own arena, which requests keep alive until they are fully handled
+    google::protobuf::ArenaOptions options;
 
-      if (!isComplete) break;
+    options.start_block_size = std::clamp(packet->size() * 2, ARENA_MIN_BLOCK_SIZE, ARENA_MAX_BLOCK_SIZE);
+    options.max_block_size = ARENA_MAX_BLOCK_SIZE;
 
-      auto packet = _message.data.sliced(sizeof(uint32_t), length);
-      std::string stringData = packet.toStdString();
+    auto arena = std::make_shared<google::protobuf::Arena>(options);
+    auto msg = google::protobuf::Arena::Create<proto::ext::IpcMessage>(arena.get());
 
-      proto::ext::IpcMessage msg;
+    {
+      TraceScope trace("ipc", "bus parse");
 
-      msg.ParseFromString(stringData);
+      if (!msg->ParseFromArray(packet->data(), packet->size())) {
+        qCritical() << "Failed to parse message from extension manager";
+        continue;
+      }
+    }
 
-      handleMessage(msg);
+    TraceScope trace("ipc", "bus dispatch");
 
-      // m_parseMessageTask.setFuture(task);
-      _message.data = _message.data.sliced(sizeof(uint32_t) + length);
-    }
+    // the packet is no longer referenced, handlers are free to read more data
+    handleMessage(*msg, arena);
   }
 }
 
 ManagerRequest *Bus::requestManager(proto::ext::manager::RequestData *req) {
-  std::string data;
   proto::ext::IpcMessage message;
   auto request = new proto::ext::ManagerRequest;
   auto id = QUuid::createUuid().toString(QUuid::WithoutBraces).toStdString();
@@ -75,8 +84,7 @@ ManagerRequest *Bus::requestManager(proto::ext::manager::RequestData *req) {
   request->set_allocated_payload(req);
 
   message.set_allocated_manager_request(request);
-  message.SerializeToString(&data);
-  sendMessage(QByteArray::fromStdString(data));
+  sendMessage(message);
 
   auto handle = new ManagerRequest;
 
@@ -86,37 +94,129 @@ ManagerRequest *Bus::requestManager(proto::ext::manager::RequestData *req) {
 }
 
 void Bus::emitExtensionEvent(proto::ext::QualifiedExtensionEvent *event) {
-  std::string data;
+  if (auto channel = this->channel(event->session_id())) {
+    proto::ext::ExtensionMessage message;
+
+    message.set_allocated_event(event->release_event());
+    channel->send(message);
+    delete event;
+    return;
+  }
+
   proto::ext::IpcMessage message;
 
   message.set_allocated_extension_event(event);
-  message.SerializeToString(&data);
-  sendMessage(QByteArray::fromStdString(data));
+  sendMessage(message);
 }
 
 bool Bus::respondToExtension(const QString &sessionId, const QString &requestId,
                              proto::ext::extension::Response *response) {
-  proto::ext::IpcMessage message;
-  std::string serialized;
+  // wrapped on the arena of the response, if it has one
+  auto arena = response->GetArena();
 
-  auto qualifiedResponse = new proto::ext::QualifiedExtensionResponse;
+  if (auto channel = this->channel(sessionId.toStdString())) {
+    auto message = google::protobuf::Arena::Create<proto::ext::ExtensionMessage>(arena);
+    std::unique_ptr<proto::ext::ExtensionMessage> owned(arena ? nullptr : message);
+
+    message->set_allocated_response(response);
+    channel->send(*message);
+
+    return true;
+  }
+
+  auto message = google::protobuf::Arena::Create<proto::ext::IpcMessage>(arena);
+  std::unique_ptr<proto::ext::IpcMessage> owned(arena ? nullptr : message);
+  auto qualifiedResponse = message->mutable_extension_response();
 
   // TODO: get session id from request
   qualifiedResponse->set_session_id(sessionId.toStdString());
   qualifiedResponse->set_allocated_response(response);
+  sendMessage(*message);
 
-  message.set_allocated_extension_response(qualifiedResponse);
-  message.SerializeToString(&serialized);
+  return true;
+}
 
-  sendMessage(QByteArray::fromStdString(serialized));
+void Bus::ping() {}
+
+WorkerChannel *Bus::channel(const std::string &sessionId) const {
+  if (auto it = m_channels.find(sessionId); it != m_channels.end()) return it->second;
+
+  return nullptr;
+}
+
+bool Bus::listenForChannels(const std::filesystem::path &path) {
+  if (m_channelServer.isListening()) return true;
+
+  // left behind by an instance that did not exit cleanly
+  QLocalServer::removeServer(path.c_str());
+  m_channelServer.setSocketOptions(QLocalServer::UserAccessOption);
+
+  if (!m_channelServer.listen(path.c_str())) {
+    qWarning() << "Failed to listen for extension worker channels on" << path.c_str()
+               << m_channelServer.errorString();
+    return false;
+  }
 
   return true;
 }
 
-void Bus::ping() {}
+std::string Bus::issueChannelToken() {
+  auto token = QUuid::createUuid().toString(QUuid::WithoutBraces).toStdString();
+
+  m_channelTokens.insert(token);
+
+  return token;
+}
+
+void Bus::handleChannelConnection() {
+  while (auto socket = m_channelServer.nextPendingConnection()) {
+    auto checkToken = [this](const std::string &token) { return m_channelTokens.erase(token) > 0; };
+    auto channel = new WorkerChannel(socket, checkToken, this);
+
+    connect(channel, &WorkerChannel::opened, this,
+            [this, channel]() { m_channels[channel->sessionId()] = channel; });
+    connect(channel, &WorkerChannel::messageReceived, this,
+            [this, channel](proto::ext::ExtensionMessage *message,
+                            const std::shared_ptr<google::protobuf::Arena> &arena) {
+              handleChannelMessage(channel->sessionId(), message, arena);
+            });
+    connect(channel, &WorkerChannel::closed, this, [this, channel]() {
+      if (auto it = m_channels.find(channel->sessionId()); it != m_channels.end() && it->second == channel) {
+        m_channels.erase(it);
+      }
+
+      channel->deleteLater();
+    });
+  }
+}
+
+void Bus::handleChannelMessage(const std::string &sessionId, proto::ext::ExtensionMessage *message,
+                               const std::shared_ptr<google::protobuf::Arena> &arena) {
+  TraceScope trace("ipc", "channel dispatch");
+
+  // qualified the way the manager does it when relaying, the session being the one the channel was opened for
+  if (message->has_request()) {
+    auto request = google::protobuf::Arena::Create<proto::ext::QualifiedExtensionRequest>(arena.get());
+
+    request->set_session_id(sessionId);
+    request->mutable_request()->Swap(message->mutable_request());
+    if (message->has_timing()) { request->mutable_timing()->Swap(message->mutable_timing()); }
+    emit extensionRequest(request, arena);
+    return;
+  }
+
+  if (message->has_event()) {
+    auto event = google::protobuf::Arena::Create<proto::ext::QualifiedExtensionEvent>(arena.get());
+
+    event->set_session_id(sessionId);
+    event->mutable_event()->Swap(message->mutable_event());
+    emit extensionEvent(*event);
+  }
+}
 
 Bus::Bus(QIODevice *socket) : device(socket) {
   connect(socket, &QIODevice::readyRead, this, &Bus::readyRead);
+  connect(&m_channelServer, &QLocalServer::newConnection, this, &Bus::handleChannelConnection);
   // connect(&m_parseMessageTask, &QFutureWatcher<FullMessage>::finished, this, &Bus::handleMessage);
 }
 
@@ -127,6 +227,21 @@ ExtensionManager::ExtensionManager(OmniCommandDatabase &commandDb) : commandDb(c
 
   env.insert("VICINAE_VERSION", VICINAE_GIT_TAG);
   env.insert("VICINAE_COMMIT", VICINAE_GIT_COMMIT_HASH);
+
+  // compile cache of the runtime, used by node 22.1 and later
+  env.insert("NODE_COMPILE_CACHE", (Omnicast::dataDir() / "extension-manager" / "compile-cache").c_str());
+
+  // tuning of the workers commands run in, see extension-manager/src/index.ts for the defaults
+  for (const char *name : {"VICINAE_EXTENSION_WORKER_POOL_SIZE", "VICINAE_EXTENSION_WORKER_IDLE_TIMEOUT",
+                           "VICINAE_EXTENSION_WORKER_MAX_HEAP_MB"}) {
+    if (auto value = qEnvironmentVariable(name); !value.isEmpty()) { env.insert(name, value); }
+  }
+
+  // workers open their channel to vicinae there, they go through the manager if it is not set
+  if (bus.listenForChannels(Omnicast::extensionChannelSocketPath())) {
+    env.insert("VICINAE_EXTENSION_CHANNEL", Omnicast::extensionChannelSocketPath().c_str());
+  }
+
   process.setProcessEnvironment(env);
 
   connect(&process, &QProcess::readyReadStandardError, this, &ExtensionManager::readError);
@@ -138,20 +253,93 @@ ExtensionManager::ExtensionManager(OmniCommandDatabase &commandDb) : commandDb(c
   connect(&bus, &Bus::extensionEvent, this,
           [this](const proto::ext::QualifiedExtensionEvent &proto) { emit extensionEvent(proto); });
 
-  connect(&bus, &Bus::extensionRequest, this, [this](const proto::ext::QualifiedExtensionRequest &req) {
-    auto request = new ExtensionRequest(bus, req);
-    emit extensionRequest(request);
-  });
+  connect(&bus, &Bus::extensionRequest, this,
+          [this](proto::ext::QualifiedExtensionRequest *req,
+                 const std::shared_ptr<google::protobuf::Arena> &arena) {
+            emit extensionRequest(new ExtensionRequest(bus, m_tracer, req, arena));
+          });
 }
 
 bool ExtensionManager::isRunning() const { return process.state() == QProcess::ProcessState::Running; }
 
+std::optional<qint64> ExtensionManager::processId() const {
+  if (!isRunning()) return std::nullopt;
+
+  return process.processId();
+}
+
+bool ExtensionManager::installRuntime(const QByteArray &code, const std::filesystem::path &path) {
+  QFile current(path);
+
+  // left untouched if it did not change, which keeps its compile cache valid
+  if (current.open(QIODevice::ReadOnly) && current.size() == code.size() && current.readAll() == code) {
+    return true;
+  }
+
+  std::error_code ec;
+
+  std::filesystem::create_directories(path.parent_path(), ec);
+
+  QSaveFile file(path.c_str());
+
+  if (!file.open(QIODevice::WriteOnly)) return false;
+
+  file.write(code);
+
+  return file.commit();
+}
+
+// node aborts right away when starting from a snapshot it did not build
+static const std::chrono::seconds SNAPSHOT_FAILURE_WINDOW(2);
+
+static std::filesystem::path snapshotPath() {
+  return Omnicast::dataDir() / "extension-manager" / "runtime.blob";
+}
+
+static std::filesystem::path rejectedSnapshotPath() {
+  return Omnicast::dataDir() / "extension-manager" / "runtime.blob.rejected";
+}
+
+/**
+ * Snapshots are only valid for the node binary they were built with, they are rejected when it gets
+ * updated to another version.
+ */
+static QByteArray nodeIdentity() {
+  QFileInfo info(QStandardPaths::findExecutable("node"));
+
+  return QString("%1:%2:%3")
+      .arg(info.canonicalFilePath())
+      .arg(info.lastModified().toSecsSinceEpoch())
+      .arg(info.size())
+      .toUtf8();
+}
+
+bool ExtensionManager::installSnapshot(const std::filesystem::path &path) {
+  QFile snapshot(":bin/extension-manager-snapshot");
+  QFile rejected(rejectedSnapshotPath());
+
+  if (!snapshot.open(QIODevice::ReadOnly)) return false;
+  if (rejected.open(QIODevice::ReadOnly) && rejected.readAll() == nodeIdentity()) return false;
+
+  return installRuntime(snapshot.readAll(), path);
+}
+
+static void rejectSnapshot() {
+  QSaveFile rejected(rejectedSnapshotPath());
+
+  if (!rejected.open(QIODevice::WriteOnly)) return;
+
+  rejected.write(nodeIdentity());
+  rejected.commit();
+}
+
 bool ExtensionManager::start() {
 #ifndef HAS_TYPESCRIPT_EXTENSIONS
   qCritical() << "Cannot start extension manager as extension support was disabled at compile time";
   return false;
 #endif
 
+  StartupBenchmark::Scope benchmark("extension-manager-spawn");
   PidFile pidFile("extension-manager");
   int maxWaitForStart = 5000;
   QFile file(":bin/extension-manager");
@@ -166,18 +354,23 @@ bool ExtensionManager::start() {
     return false;
   }
 
-  auto runtimeFile = new QTemporaryFile(this);
+  auto runtimePath = Omnicast::dataDir() / "extension-manager" / "runtime.js";
 
-  if (!runtimeFile->open()) {
-    qCritical("Failed to open temporary file to write extension runtime code");
+  if (!installRuntime(file.readAll(), runtimePath)) {
+    qCritical() << "Failed to write extension runtime code to" << runtimePath.c_str();
     return false;
   }
 
-  runtimeFile->write(file.readAll());
-
   if (pidFile.exists() && pidFile.kill()) { qInfo() << "Killed existing extension manager instance"; }
 
-  process.start("node", {runtimeFile->fileName()});
+  QStringList arguments = {runtimePath.c_str()};
+
+  // starting from the snapshot skips evaluating the runtime, which is most of the startup time of the manager
+  m_startedFromSnapshot = installSnapshot(snapshotPath());
+  if (m_startedFromSnapshot) { arguments = {"--snapshot-blob", snapshotPath().c_str(), runtimePath.c_str()}; }
+
+  m_startedAt = std::chrono::steady_clock::now();
+  process.start("node", arguments);
 
   if (!process.waitForStarted(maxWaitForStart)) {
     qCritical() << "Failed to start extension manager" << process.errorString();
@@ -186,17 +379,68 @@ bool ExtensionManager::start() {
 
   pidFile.write(process.processId());
 
-  qInfo() << "Started extension manager" << runtimeFile->fileName();
+  qInfo() << "Started extension manager" << runtimePath.c_str()
+          << (m_startedFromSnapshot ? "from its snapshot" : "");
+
+  return true;
+}
+
+bool ExtensionManager::ensureStarted() {
+  if (isRunning()) return true;
+  if (m_startFailed) return false;
+
+  if (!start()) {
+    qCritical() << "Failed to start extension manager. Extensions will not work";
+    m_startFailed = true;
+    return false;
+  }
 
   return true;
 }
 
+void ExtensionManager::startAfter(std::chrono::milliseconds delay) {
+  QTimer::singleShot(delay, this, [this]() { ensureStarted(); });
+}
+
 const std::vector<std::shared_ptr<Extension>> &ExtensionManager::extensions() const {
   return loadedExtensions;
 }
 
 ManagerRequest *ExtensionManager::requestManager(proto::ext::manager::RequestData *req) {
-  return bus.requestManager(req);
+  std::optional<WorkerSession> loaded;
+
+  if (req->has_load()) {
+    auto &load = *req->mutable_load();
+
+    load.set_channel_token(bus.issueChannelToken());
+
+    loaded = WorkerSession{.extensionPath = load.extension_path(), .entrypoint = load.entrypoint()};
+  }
+
+  auto request = bus.requestManager(req);
+
+  if (loaded) {
+    connect(request, &ManagerRequest::finished, this,
+            [this, session = *loaded](const proto::ext::manager::ResponseData &data) {
+              m_sessions.insert({QString::fromStdString(data.load().session_id()), session});
+            });
+  }
+
+  return request;
+}
+
+std::optional<WorkerSession> ExtensionManager::session(const QString &sessionId) const {
+  if (auto it = m_sessions.find(sessionId); it != m_sessions.end()) return it->second;
+
+  return std::nullopt;
+}
+
+ManagerRequest *ExtensionManager::requestWorkerStats() {
+  auto requestData = new proto::ext::manager::RequestData;
+
+  requestData->mutable_stats();
+
+  return requestManager(requestData);
 }
 
 void ExtensionManager::emitExtensionEvent(proto::ext::QualifiedExtensionEvent *event) {
@@ -212,7 +456,7 @@ bool ExtensionManager::hasDevelopmentSession(const QString &id) const {
 }
 
 void ExtensionManager::emitGenericExtensionEvent(const QString &sessionId, const QString &handlerId,
-                                                 const QJsonArray &args) {
+                                                 const QJsonArray &args, bool latestOnly) {
   auto qualified = new proto::ext::QualifiedExtensionEvent;
   auto event = new proto::ext::extension::Event;
   auto generic = new proto::ext::extension::GenericEventData;
@@ -223,6 +467,7 @@ void ExtensionManager::emitGenericExtensionEvent(const QString &sessionId, const
   event->set_id(handlerId.toStdString());
   event->set_allocated_generic(generic);
   generic->set_json(document.toJson(QJsonDocument::Compact).toStdString());
+  generic->set_latest_only(latestOnly);
   qualified->set_allocated_event(event);
   emitExtensionEvent(qualified);
 }
@@ -243,7 +488,16 @@ QJsonObject ExtensionManager::serializeLaunchProps(const LaunchProps &props) {
 }
 
 void ExtensionManager::finished(int exitCode, QProcess::ExitStatus status) {
-  qCritical() << "Extension manager crashed. Extensions will not work";
+  m_sessions.clear();
+
+  if (m_startedFromSnapshot && std::chrono::steady_clock::now() - m_startedAt < SNAPSHOT_FAILURE_WINDOW) {
+    qWarning() << "Extension manager failed to start from its snapshot, which was likely built by another "
+                  "version of node. Starting it without";
+    rejectSnapshot();
+    start();
+    return;
+  }
+  qCritical() << "Extension manager crashed, it will be restarted when an extension command runs";
 }
 
 void ExtensionManager::readError() {
@@ -255,6 +509,8 @@ void ExtensionManager::readError() {
 }
 
 void ExtensionManager::unloadCommand(const QString &sessionId) {
+  m_sessions.erase(sessionId);
+
   auto requestData = new proto::ext::manager::RequestData;
   auto unload = new proto::ext::manager::ManagerUnloadCommand;
 
@@ -263,4 +519,32 @@ void ExtensionManager::unloadCommand(const QString &sessionId) {
   requestManager(requestData);
 }
 
+void ExtensionManager::prewarmCommand(const ExtensionCommand &command, const QJsonObject &preferenceValues) {
+  if (hasDevelopmentSession(command.extensionId()) || !ensureStarted()) return;
+
+  auto requestData = new proto::ext::manager::RequestData;
+  auto prewarm = new proto::ext::manager::ManagerPrewarmCommand;
+
+  prewarm->set_entrypoint(command.manifest().entrypoint);
+  prewarm->set_extension_path(command.path());
+
+  if (command.mode() == CommandMode::CommandModeView) {
+    prewarm->set_mode(proto::ext::manager::CommandMode::View);
+  } else {
+    prewarm->set_mode(proto::ext::manager::CommandMode::NoView);
+  }
+
+  auto preferences = prewarm->mutable_preference_values();
+
+  for (const auto &key : preferenceValues.keys()) {
+    preferences->insert({key.toStdString(), transformJsonValueToProto(preferenceValues.value(key))});
+  }
+
+  requestData->set_allocated_prewarm(prewarm);
+
+  auto request = requestManager(requestData);
+
+  connect(request, &ManagerRequest::finished, request, &QObject::deleteLater);
+}
+
 void ExtensionManager::handleManagerResponse(const QString &action, QJsonObject &data) {}
@@ -5,8 +5,18 @@
 #include <QUuid>
 #include <QtCore>
 #include <cstdint>
+#include <filesystem>
+#include <google/protobuf/arena.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include "common.hpp"
 #include "extension/extension.hpp"
+#include "extension/manager/extension-tracer.hpp"
+#include "extension/manager/packet-framer.hpp"
+#include "extension/manager/worker-channel.hpp"
 #include "omni-command-db.hpp"
 #include "proto/common.pb.h"
 #include "proto/extension.pb.h"
@@ -47,20 +57,42 @@ signals:
 class Bus : public QObject {
   Q_OBJECT
 
-  struct MessageBuffer {
-    QByteArray data;
-    uint32_t length;
-  };
+  // bounds of the first block of the arena messages are parsed on, which is sized after the packet
+  static constexpr size_t ARENA_MIN_BLOCK_SIZE = 1024;
+  static constexpr size_t ARENA_MAX_BLOCK_SIZE = 64 * 1024;
 
   std::unordered_map<std::string, ManagerRequest *> m_pendingManagerRequests;
-  MessageBuffer _message = {.length = 0};
+  PacketFramer m_framer;
+  // reused for every message sent, so that it only gets allocated for the largest one
+  QByteArray m_packet;
+
+  // workers talk to vicinae directly once they opened a channel, the manager only relays for those that
+  // could not
+  QLocalServer m_channelServer;
+  std::unordered_map<std::string, WorkerChannel *> m_channels;
+  // issued to the commands being loaded, each opens a single channel
+  std::unordered_set<std::string> m_channelTokens;
 
   QIODevice *device = nullptr;
-  void sendMessage(const QByteArray &data);
-  void handleMessage(const proto::ext::IpcMessage &message);
+  void sendMessage(const google::protobuf::MessageLite &message);
+  void handleMessage(proto::ext::IpcMessage &message, const std::shared_ptr<google::protobuf::Arena> &arena);
   void readyRead();
+  void handleChannelConnection();
+  void handleChannelMessage(const std::string &sessionId, proto::ext::ExtensionMessage *message,
+                            const std::shared_ptr<google::protobuf::Arena> &arena);
+  WorkerChannel *channel(const std::string &sessionId) const;
 
 public:
+  /**
+   * Accept the channels of workers on the socket at `path`, replacing a stale one.
+   */
+  bool listenForChannels(const std::filesystem::path &path);
+
+  /**
+   * Token for the command about to be loaded to open its channel with, valid once.
+   */
+  std::string issueChannelToken();
+
   ManagerRequest *requestManager(proto::ext::manager::RequestData *req);
   bool respondToExtension(const QString &sessionId, const QString &requestId,
                           proto::ext::extension::Response *data);
@@ -71,25 +103,51 @@ public:
 
 signals:
   void managerResponse(const proto::ext::ManagerResponse &res);
-  void extensionRequest(const proto::ext::QualifiedExtensionRequest &req);
+  /**
+   * `req` is allocated on `arena`, which has to be kept alive for as long as it is used.
+   */
+  void extensionRequest(proto::ext::QualifiedExtensionRequest *req,
+                        const std::shared_ptr<google::protobuf::Arena> &arena);
   void extensionEvent(const proto::ext::QualifiedExtensionEvent &event);
 };
 
+/**
+ * The request lives on the arena it was parsed on, which responses are expected to be allocated on as well
+ * (see `arena`), so that handling a request only takes a few allocations.
+ *
+ * Its span is recorded by the tracer once it is responded to.
+ */
 class ExtensionRequest : public NonCopyable {
-  proto::ext::QualifiedExtensionRequest m_request;
+  std::shared_ptr<google::protobuf::Arena> m_arena;
+  proto::ext::QualifiedExtensionRequest *m_request;
   Bus &m_bus;
+  ExtensionTracer &m_tracer;
+  RequestSpan m_span;
   bool m_responded = false;
 
 public:
-  ExtensionRequest(Bus &bus, const proto::ext::QualifiedExtensionRequest &req) : m_bus(bus), m_request(req) {}
+  ExtensionRequest(Bus &bus, ExtensionTracer &tracer, proto::ext::QualifiedExtensionRequest *req,
+                   const std::shared_ptr<google::protobuf::Arena> &arena)
+      : m_arena(arena), m_request(req), m_bus(bus), m_tracer(tracer),
+        m_span(req->request().data(), req->has_timing() ? &req->timing() : nullptr) {}
 
   ~ExtensionRequest() {
     if (!m_responded) { respondWithError("Unhandled request"); }
   }
 
-  QString requestId() const { return QString::fromStdString(m_request.request().request_id()); }
-  QString sessionId() const { return QString::fromStdString(m_request.session_id()); }
-  const proto::ext::extension::RequestData &requestData() const { return m_request.request().data(); }
+  QString requestId() const { return QString::fromStdString(m_request->request().request_id()); }
+  QString sessionId() const { return QString::fromStdString(m_request->session_id()); }
+  const proto::ext::extension::RequestData &requestData() const { return m_request->request().data(); }
+  proto::ext::extension::RequestData &mutableRequestData() {
+    return *m_request->mutable_request()->mutable_data();
+  }
+
+  /**
+   * Owner of the request data, to hold on to in order to use it after the request is responded to.
+   */
+  const std::shared_ptr<google::protobuf::Arena> &arena() const { return m_arena; }
+
+  RequestSpan &span() { return m_span; }
 
   void respond(proto::ext::extension::Response *data) {
     if (m_responded) {
@@ -97,17 +155,18 @@ public:
       return;
     }
 
+    m_span.enter("respond");
     data->set_request_id(requestId().toStdString());
     m_bus.respondToExtension(sessionId(), requestId(), data);
     m_responded = true;
+    m_span.finish();
+    m_tracer.record(std::move(m_span));
   }
 
   void respondWithError(const QString &errorText) {
-    auto error = new proto::ext::common::ErrorResponse;
-    auto res = new proto::ext::extension::Response;
+    auto res = google::protobuf::Arena::Create<proto::ext::extension::Response>(m_arena.get());
 
-    error->set_error_text(errorText.toStdString());
-    res->set_allocated_error(error);
+    res->mutable_error()->set_error_text(errorText.toStdString());
     respond(res);
   }
 };
@@ -122,28 +181,62 @@ public:
   ExtensionEvent(const proto::ext::QualifiedExtensionEvent &event) : m_event(event) {}
 };
 
+class ExtensionCommand;
+
 struct PendingManagerRequestInfo {
   QString sessionId;
 };
 
+/**
+ * Command running in a worker of the extension manager, as it was loaded.
+ */
+struct WorkerSession {
+  std::filesystem::path extensionPath;
+  std::filesystem::path entrypoint;
+};
+
 class ExtensionManager : public QObject {
   Q_OBJECT
 
   QProcess process;
   Bus bus;
+  ExtensionTracer m_tracer;
   std::vector<std::shared_ptr<Extension>> loadedExtensions;
   OmniCommandDatabase &commandDb;
   std::unordered_set<QString> m_developmentSessions;
+  // commands loaded in the manager, each running in a worker of its own
+  std::unordered_map<QString, WorkerSession> m_sessions;
+  bool m_startFailed = false;
+  bool m_startedFromSnapshot = false;
+  std::chrono::steady_clock::time_point m_startedAt;
+
+  /**
+   * Write the bundled runtime to a stable location, only when it changed.
+   */
+  static bool installRuntime(const QByteArray &code, const std::filesystem::path &path);
+
+  /**
+   * Write the bundled startup snapshot of the runtime to `path`, unless there is none or the installed node
+   * already failed to start from it. Returns whether the manager can be started from it.
+   */
+  static bool installSnapshot(const std::filesystem::path &path);
 
 public:
   ExtensionManager(OmniCommandDatabase &commandDb);
 
   const std::vector<std::shared_ptr<Extension>> &extensions() const;
 
+  ExtensionTracer &tracer() { return m_tracer; }
+
   ManagerRequest *requestManager(proto::ext::manager::RequestData *req);
   bool respondToExtension(const QString &requestId, proto::ext::extension::ResponseData *data);
   void emitExtensionEvent(proto::ext::QualifiedExtensionEvent *event);
-  void emitGenericExtensionEvent(const QString &sessionId, const QString &handlerId, const QJsonArray &args);
+
+  /**
+   * With `latestOnly`, the worker drops the event if a newer one with the same handler is queued behind it.
+   */
+  void emitGenericExtensionEvent(const QString &sessionId, const QString &handlerId, const QJsonArray &args,
+                                 bool latestOnly = false);
 
   void addDevelopmentSession(const QString &id);
   void removeDevelopmentSession(const QString &id);
@@ -155,10 +248,37 @@ public:
   bool isRunning() const;
   bool start();
 
+  /**
+   * Start the manager process if it is not running, as it is only started once an extension command is
+   * about to run. A start that failed is not retried.
+   */
+  bool ensureStarted();
+
+  /**
+   * Start the manager after `delay`, unless a command needed it before then.
+   */
+  void startAfter(std::chrono::milliseconds delay);
+
+  size_t workerCount() const { return m_sessions.size(); }
+  std::optional<WorkerSession> session(const QString &sessionId) const;
+
+  /**
+   * Heap and event loop usage of the workers, sampled by the manager. Finishes with a `stats` response.
+   */
+  ManagerRequest *requestWorkerStats();
+  std::optional<qint64> processId() const;
+
   void loadCommand(const QString &extensionId, const QString &cmd, const QJsonObject &preferenceValues = {},
                    const LaunchProps &launchProps = {});
 
   void unloadCommand(const QString &sessionId);
+
+  /**
+   * Have the manager load `command` in a worker ahead of time, as it is likely to be launched soon. The
+   * worker is only used if it is launched with the same preferences, and discarded by the manager otherwise.
+   * Commands in development are not prewarmed.
+   */
+  void prewarmCommand(const ExtensionCommand &command, const QJsonObject &preferenceValues);
   void handleManagerResponse(const QString &action, QJsonObject &data);
   void finished(int exitCode, QProcess::ExitStatus status);
   void readError();
@@ -0,0 +1,181 @@
+#include "extension/manager/extension-tracer.hpp"
+#include <QJsonArray>
+#include <QJsonObject>
+#include <algorithm>
+#include <cmath>
+#include <ranges>
+
+using namespace std::chrono;
+
+void LatencyHistogram::add(microseconds duration) {
+  uint64_t value = std::max<int64_t>(duration.count(), 0);
+  size_t bucket = 0;
+
+  if (value > 1) { bucket = std::min<size_t>(std::log2(value) * BUCKETS_PER_POWER, BUCKET_COUNT - 1); }
+
+  ++m_buckets[bucket];
+  ++m_count;
+  m_total += value;
+  m_max = std::max(m_max, value);
+}
+
+microseconds LatencyHistogram::mean() const {
+  if (m_count == 0) return microseconds(0);
+
+  return microseconds(m_total / m_count);
+}
+
+microseconds LatencyHistogram::percentile(double p) const {
+  uint64_t rank = std::ceil(std::clamp(p, 0.0, 1.0) * m_count);
+  uint64_t seen = 0;
+
+  for (size_t i = 0; i != m_buckets.size(); ++i) {
+    seen += m_buckets[i];
+
+    if (seen >= rank && seen > 0) {
+      auto upperBound = std::exp2(static_cast<double>(i + 1) / BUCKETS_PER_POWER);
+
+      return microseconds(std::min<uint64_t>(upperBound, m_max));
+    }
+  }
+
+  return max();
+}
+
+QString RequestSpan::requestType(const proto::ext::extension::RequestData &data) {
+  auto reflection = data.GetReflection();
+  auto category = reflection->GetOneofFieldDescriptor(data, data.GetDescriptor()->oneof_decl(0));
+
+  if (!category) return "unknown";
+
+  auto &request = reflection->GetMessage(data, category);
+  auto descriptor = request.GetDescriptor();
+  auto name = [](const google::protobuf::FieldDescriptor *field) {
+    return QString::fromUtf8(field->name().data(), field->name().size());
+  };
+
+  // the oneofs made for optional fields come after the real ones
+  if (descriptor->real_oneof_decl_count() == 0) return name(category);
+
+  auto field = request.GetReflection()->GetOneofFieldDescriptor(request, descriptor->oneof_decl(0));
+
+  if (field) {
+    return QString("%1.%2").arg(name(category), name(field));
+  }
+
+  return name(category);
+}
+
+void RequestSpan::enter(const char *name) {
+  auto now = Clock::now();
+
+  m_phases.back().end = now;
+  m_phases.push_back({.name = name, .start = now, .end = now});
+}
+
+void RequestSpan::finish() { m_phases.back().end = Clock::now(); }
+
+RequestSpan::RequestSpan(const proto::ext::extension::RequestData &data,
+                         const proto::ext::RequestTiming *timing)
+    : m_type(requestType(data)) {
+  auto now = Clock::now();
+
+  if (timing) {
+    // the worker runs on the same machine, so its wall clock can be compared with ours
+    auto sentAt = duration<double, std::milli>(timing->sent_at());
+    auto elapsed = duration<double, std::milli>(system_clock::now().time_since_epoch()) - sentAt;
+    auto transfer = duration_cast<Clock::duration>(std::max(elapsed, duration<double, std::milli>(0)));
+    auto serialize = duration_cast<Clock::duration>(duration<double, std::milli>(timing->serialize_time()));
+
+    m_phases.push_back({.name = "serialize", .start = now - transfer - serialize, .end = now - transfer});
+    m_phases.push_back({.name = "transfer", .start = now - transfer, .end = now});
+  }
+
+  m_phases.push_back({.name = "queue", .start = now, .end = now});
+}
+
+void ExtensionTracer::record(RequestSpan span) {
+  QMutexLocker lock(&m_mutex);
+  auto [entry, inserted] = m_stats.try_emplace(
+      {span.extensionId(), span.type()}, Stats{.extensionId = span.extensionId(), .type = span.type()});
+  auto &stats = entry->second;
+
+  stats.total.add(duration_cast<microseconds>(span.end() - span.start()));
+
+  for (const auto &phase : span.phases()) {
+    auto it = std::ranges::find_if(stats.phases, [&](auto &&pair) { return pair.first == phase.name; });
+
+    if (it == stats.phases.end()) { it = stats.phases.insert(it, {phase.name, {}}); }
+
+    it->second.add(duration_cast<microseconds>(phase.end - phase.start));
+  }
+
+  if (m_spans.size() == MAX_SPANS) { m_spans.pop_front(); }
+
+  m_spans.emplace_back(std::move(span));
+}
+
+std::vector<ExtensionTracer::Stats> ExtensionTracer::stats() const {
+  QMutexLocker lock(&m_mutex);
+  std::vector<Stats> stats;
+
+  stats.reserve(m_stats.size());
+
+  for (const auto &[key, value] : m_stats) {
+    stats.emplace_back(value);
+  }
+
+  return stats;
+}
+
+QJsonDocument ExtensionTracer::chromeTrace() const {
+  QMutexLocker lock(&m_mutex);
+  QJsonArray events;
+  QJsonObject trace;
+  RequestSpan::Clock::time_point origin;
+  uint64_t id = 0;
+
+  // spans are recorded once responded to, so the first one is not necessarily the one that started first
+  if (!m_spans.empty()) { origin = std::ranges::min(m_spans | std::views::transform(&RequestSpan::start)); }
+
+  auto event = [&](const QString &name, const QString &category, const char *phase,
+                   RequestSpan::Clock::time_point time) {
+    QJsonObject obj;
+
+    obj["name"] = name;
+    obj["cat"] = category;
+    obj["ph"] = phase;
+    obj["id"] = static_cast<qint64>(id);
+    obj["ts"] = duration<double, std::micro>(time - origin).count();
+    obj["pid"] = 1;
+    obj["tid"] = 1;
+
+    return obj;
+  };
+
+  for (const auto &span : m_spans) {
+    QString category = span.extensionId().isEmpty() ? "unknown" : span.extensionId();
+
+    ++id;
+    events.push_back(event(span.type(), category, "b", span.start()));
+
+    for (const auto &phase : span.phases()) {
+      events.push_back(event(phase.name, category, "b", phase.start));
+      events.push_back(event(phase.name, category, "e", phase.end));
+    }
+
+    events.push_back(event(span.type(), category, "e", span.end()));
+  }
+
+  trace["traceEvents"] = events;
+  trace["displayTimeUnit"] = "ms";
+
+  return QJsonDocument(trace);
+}
+
+void ExtensionTracer::clear() {
+  QMutexLocker lock(&m_mutex);
+
+  m_stats.clear();
+  m_spans.clear();
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include <QJsonDocument>
+#include <QMutex>
+#include <QString>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <vector>
+#include "proto/extension.pb.h"
+#include "proto/ipc.pb.h"
+
+/**
+ * Distribution of latencies, counted in buckets growing exponentially from 1µs to about a minute (four per
+ * power of two), which keeps percentiles within 20% of the actual value in a constant amount of memory.
+ */
+class LatencyHistogram {
+public:
+  static constexpr size_t BUCKETS_PER_POWER = 4;
+  static constexpr size_t BUCKET_COUNT = 26 * BUCKETS_PER_POWER;
+
+  void add(std::chrono::microseconds duration);
+
+  uint64_t count() const { return m_count; }
+  std::chrono::microseconds max() const { return std::chrono::microseconds(m_max); }
+  std::chrono::microseconds mean() const;
+
+  /**
+   * Upper bound of the bucket the `p` (0 to 1) percentile falls in.
+   */
+  std::chrono::microseconds percentile(double p) const;
+
+private:
+  std::array<uint64_t, BUCKET_COUNT> m_buckets{};
+  uint64_t m_count = 0;
+  uint64_t m_total = 0;
+  uint64_t m_max = 0;
+};
+
+/**
+ * Timeline of a request, made of consecutive phases. It starts in the `queue` phase, until it is routed to
+ * the command it is for which then enters the phases it goes through as it handles it, and ends once the
+ * request is responded to.
+ * If the worker sent the request with its timing, the time it took to serialize it and get to us comes first.
+ */
+class RequestSpan {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Phase {
+    // static string
+    const char *name;
+    Clock::time_point start;
+    Clock::time_point end;
+  };
+
+  /**
+   * Type of request `data` is, such as `ui.render` or `storage.get`.
+   */
+  static QString requestType(const proto::ext::extension::RequestData &data);
+
+  /**
+   * End the current phase, starting `name`.
+   */
+  void enter(const char *name);
+
+  /**
+   * End the current phase, which is the last one.
+   */
+  void finish();
+
+  void setExtensionId(const QString &id) { m_extensionId = id; }
+
+  const QString &extensionId() const { return m_extensionId; }
+  const QString &type() const { return m_type; }
+  const std::vector<Phase> &phases() const { return m_phases; }
+  Clock::time_point start() const { return m_phases.front().start; }
+  Clock::time_point end() const { return m_phases.back().end; }
+
+  RequestSpan(const proto::ext::extension::RequestData &data, const proto::ext::RequestTiming *timing);
+
+private:
+  QString m_extensionId;
+  QString m_type;
+  std::vector<Phase> m_phases;
+};
+
+/**
+ * Latency histograms of the requests made by extensions, by extension and type of request, along with the
+ * spans of the most recent ones which can be exported as a Chrome trace, to be opened in
+ * https://ui.perfetto.dev or chrome://tracing.
+ *
+ * Spans can be recorded from any thread.
+ */
+class ExtensionTracer {
+public:
+  static constexpr size_t MAX_SPANS = 5000;
+
+  struct Stats {
+    QString extensionId;
+    QString type;
+    LatencyHistogram total;
+    // in the order they first appeared in
+    std::vector<std::pair<QString, LatencyHistogram>> phases;
+  };
+
+  void record(RequestSpan span);
+
+  /**
+   * Ordered by extension and type of request.
+   */
+  std::vector<Stats> stats() const;
+
+  /**
+   * Recent spans in the Chrome trace event format, as async events (one track per request) so that
+   * requests handled concurrently do not have to nest.
+   */
+  QJsonDocument chromeTrace() const;
+
+  void clear();
+
+private:
+  mutable QMutex m_mutex;
+  std::map<std::pair<QString, QString>, Stats> m_stats;
+  std::deque<RequestSpan> m_spans;
+};
@@ -0,0 +1,90 @@
+#include "extension/manager/packet-framer.hpp"
+#include <arpa/inet.h>
+#include <algorithm>
+#include <cstring>
+#include <qlogging.h>
+
+void PacketFramer::reserve(size_t size) {
+  size_t pending = m_end - m_start;
+
+  if (m_buffer.size() - m_end >= size) return;
+
+  if (m_start > 0) {
+    std::memmove(m_buffer.data(), m_buffer.data() + m_start, pending);
+    m_start = 0;
+    m_end = pending;
+  }
+
+  if (m_buffer.size() - m_end >= size) return;
+
+  size_t capacity = std::max(m_buffer.size(), INITIAL_CAPACITY);
+
+  while (capacity - m_end < size) {
+    capacity *= 2;
+  }
+
+  m_buffer.resize(capacity);
+}
+
+bool PacketFramer::readFrom(QIODevice *device) {
+  while (device->bytesAvailable() > 0) {
+    size_t available = device->bytesAvailable();
+    size_t pending = m_end - m_start;
+
+    // make room for the whole packet being read at once rather than growing the buffer several times
+    if (pending >= sizeof(uint32_t)) {
+      uint32_t length = 0;
+
+      std::memcpy(&length, m_buffer.data() + m_start, sizeof(length));
+
+      size_t packetSize = sizeof(length) + ntohl(length);
+
+      if (packetSize > pending) { available = std::max(available, packetSize - pending); }
+    }
+
+    reserve(available);
+
+    qint64 read = device->read(m_buffer.data() + m_end, m_buffer.size() - m_end);
+
+    if (read < 0) {
+      qCritical() << "PacketFramer: failed to read from device" << device->errorString();
+      return false;
+    }
+
+    if (read == 0) break;
+
+    m_end += read;
+  }
+
+  return true;
+}
+
+std::optional<std::span<const char>> PacketFramer::next() {
+  size_t pending = m_end - m_start;
+  uint32_t length = 0;
+
+  if (pending < sizeof(length)) return std::nullopt;
+
+  std::memcpy(&length, m_buffer.data() + m_start, sizeof(length));
+  length = ntohl(length);
+
+  if (pending - sizeof(length) < length) return std::nullopt;
+
+  std::span<const char> packet(m_buffer.data() + m_start + sizeof(length), length);
+
+  m_start += sizeof(length) + length;
+
+  // nothing left to move around once everything was consumed
+  if (m_start == m_end) { m_start = m_end = 0; }
+
+  return packet;
+}
+
+void PacketFramer::frame(const google::protobuf::MessageLite &message, QByteArray &packet) {
+  size_t size = message.ByteSizeLong();
+  uint32_t length = htonl(size);
+
+  packet.resize(sizeof(length) + size);
+  std::memcpy(packet.data(), &length, sizeof(length));
+  message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(packet.data() + sizeof(length)));
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <google/protobuf/message_lite.h>
+#include <optional>
+#include <qbytearray.h>
+#include <qiodevice.h>
+#include <span>
+#include <vector>
+
+/**
+ * Splits a stream into packets prefixed by their length (32 bit, big endian), without copying them out of
+ * the buffer they are read into.
+ *
+ * Data is read straight into the free space at the end of the buffer and packets are handed out in place.
+ * The space taken by consumed packets is only reclaimed, by moving the unconsumed bytes to the front, when
+ * there is not enough free space left for the next read, and the buffer only grows when that is still not
+ * enough, to the size of the packet being read if it is known.
+ */
+class PacketFramer {
+public:
+  static constexpr size_t INITIAL_CAPACITY = 64 * 1024;
+
+  /**
+   * Read everything currently available from `device`. Returns false if reading failed.
+   */
+  bool readFrom(QIODevice *device);
+
+  /**
+   * The next complete packet, consumed by this call. It points into the buffer, and is only valid until
+   * the next call to `readFrom`.
+   */
+  std::optional<std::span<const char>> next();
+
+  /**
+   * Serialize `message` into `packet`, right after its length prefix. The packet is reused, so that it only
+   * gets allocated for the largest message.
+   */
+  static void frame(const google::protobuf::MessageLite &message, QByteArray &packet);
+
+private:
+  std::vector<char> m_buffer;
+  size_t m_start = 0;
+  size_t m_end = 0;
+
+  void reserve(size_t size);
+};
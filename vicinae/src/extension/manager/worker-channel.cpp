@@ -0,0 +1,63 @@
+#include "extension/manager/worker-channel.hpp"
+#include "trace/trace.hpp"
+#include <algorithm>
+#include <qlogging.h>
+
+bool WorkerChannel::open(std::span<const char> packet) {
+  proto::ext::ChannelHello hello;
+
+  if (!hello.ParseFromArray(packet.data(), packet.size()) || !m_checkToken(hello.token())) {
+    qWarning() << "Rejected extension worker channel with an invalid token";
+    return false;
+  }
+
+  m_sessionId = hello.session_id();
+  emit opened();
+
+  return true;
+}
+
+void WorkerChannel::readyRead() {
+  TraceScope trace("ipc", "channel read");
+
+  if (!m_framer.readFrom(m_socket)) return;
+
+  while (auto packet = m_framer.next()) {
+    if (m_sessionId.empty()) {
+      if (!open(*packet)) {
+        m_socket->abort();
+        return;
+      }
+
+      continue;
+    }
+
+    google::protobuf::ArenaOptions options;
+
+    options.start_block_size = std::clamp(packet->size() * 2, ARENA_MIN_BLOCK_SIZE, ARENA_MAX_BLOCK_SIZE);
+    options.max_block_size = ARENA_MAX_BLOCK_SIZE;
+
+    auto arena = std::make_shared<google::protobuf::Arena>(options);
+    auto message = google::protobuf::Arena::Create<proto::ext::ExtensionMessage>(arena.get());
+
+    if (!message->ParseFromArray(packet->data(), packet->size())) {
+      qCritical() << "Failed to parse message from the worker of session" << m_sessionId.c_str();
+      continue;
+    }
+
+    emit messageReceived(message, arena);
+  }
+}
+
+void WorkerChannel::send(const google::protobuf::MessageLite &message) {
+  PacketFramer::frame(message, m_packet);
+  m_socket->write(m_packet);
+  m_socket->flush();
+}
+
+WorkerChannel::WorkerChannel(QLocalSocket *socket, TokenCheck checkToken, QObject *parent)
+    : QObject(parent), m_socket(socket), m_checkToken(std::move(checkToken)) {
+  m_socket->setParent(this);
+  connect(m_socket, &QLocalSocket::readyRead, this, &WorkerChannel::readyRead);
+  connect(m_socket, &QLocalSocket::disconnected, this, &WorkerChannel::closed);
+}
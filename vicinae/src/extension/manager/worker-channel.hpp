@@ -0,0 +1,60 @@
+#pragma once
+#include "extension/manager/packet-framer.hpp"
+#include "proto/ipc.pb.h"
+#include <functional>
+#include <google/protobuf/arena.h>
+#include <memory>
+#include <qbytearray.h>
+#include <qlocalsocket.h>
+#include <qobject.h>
+#include <qtmetamacros.h>
+#include <string>
+
+/**
+ * Connection opened by the worker a command runs in straight to vicinae, which the messages of its session
+ * go through instead of being relayed by the main thread of the extension manager along with the messages
+ * of every other command. That way, a command sending a lot of messages does not hold back the others.
+ *
+ * The worker starts by sending a `ChannelHello` with the session it runs and the token vicinae issued when
+ * loading it, which is checked with `checkToken`. Packets are length prefixed `ExtensionMessage`s after that.
+ */
+class WorkerChannel : public QObject {
+  Q_OBJECT
+
+public:
+  using TokenCheck = std::function<bool(const std::string &token)>;
+
+  /**
+   * Takes ownership of `socket`.
+   */
+  WorkerChannel(QLocalSocket *socket, TokenCheck checkToken, QObject *parent = nullptr);
+
+  /**
+   * Empty until the channel is opened.
+   */
+  const std::string &sessionId() const { return m_sessionId; }
+
+  void send(const google::protobuf::MessageLite &message);
+
+signals:
+  void opened();
+  /**
+   * `message` is allocated on `arena`, which has to be kept alive for as long as it is used.
+   */
+  void messageReceived(proto::ext::ExtensionMessage *message,
+                       const std::shared_ptr<google::protobuf::Arena> &arena);
+  void closed();
+
+private:
+  static constexpr size_t ARENA_MIN_BLOCK_SIZE = 1024;
+  static constexpr size_t ARENA_MAX_BLOCK_SIZE = 64 * 1024;
+
+  QLocalSocket *m_socket;
+  TokenCheck m_checkToken;
+  PacketFramer m_framer;
+  QByteArray m_packet;
+  std::string m_sessionId;
+
+  void readyRead();
+  bool open(std::span<const char> packet);
+};
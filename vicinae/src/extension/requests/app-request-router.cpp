@@ -1,29 +1,73 @@
 #include "app-request-router.hpp"
+#include "lib/proto-string.hpp"
 #include "proto/application.pb.h"
 
+namespace {
+
+/**
+ * The list as last sent, shared by every command. It is only built again once the applications have been
+ * rescanned, as it takes a few conversions per application. Only accessed from the main thread.
+ */
+struct CachedApplicationList {
+  uint32_t generation = 0;
+  proto::ext::application::ListApplicationResponse response;
+};
+
+CachedApplicationList &cachedApplicationList() {
+  static CachedApplicationList list;
+
+  return list;
+}
+
+} // namespace
+
+const proto::ext::application::ListApplicationResponse &AppRequestRouter::applicationList() const {
+  auto &cached = cachedApplicationList();
+
+  if (cached.generation == m_appDb.generation()) return cached.response;
+
+  auto apps = m_appDb.list();
+
+  cached.response.Clear();
+  cached.response.mutable_apps()->Reserve(apps.size());
+
+  for (const auto &app : apps) {
+    auto protoApp = cached.response.add_apps();
+
+    ProtoString::assign(protoApp->mutable_id(), app->id());
+    ProtoString::assign(protoApp->mutable_name(), app->name());
+    ProtoString::assign(protoApp->mutable_icon(), app->iconUrl().name());
+  }
+
+  cached.generation = m_appDb.generation();
+  cached.response.set_generation(cached.generation);
+
+  return cached.response;
+}
+
 proto::ext::application::Response *
 AppRequestRouter::listApplications(const proto::ext::application::ListApplicationRequest &req) const {
-  auto resData = new proto::ext::application::ListApplicationResponse;
-  auto res = new proto::ext::application::Response;
-
-  for (const auto &app : m_appDb.list()) {
-    auto protoApp = resData->add_apps();
+  auto res = google::protobuf::Arena::Create<proto::ext::application::Response>(req.GetArena());
+  auto resData = res->mutable_list();
 
-    protoApp->set_id(app->id().toStdString());
-    protoApp->set_name(app->name().toStdString());
-    protoApp->set_icon(app->iconUrl().name().toStdString());
+  // commands keep the list they were sent, there is no need to send it again if it did not change
+  if (req.has_known_generation() && req.known_generation() == m_appDb.generation()) {
+    resData->set_generation(req.known_generation());
+    resData->set_not_modified(true);
+    return res;
   }
 
-  res->set_allocated_list(resData);
+  resData->CopyFrom(applicationList());
+
   return res;
 }
 
 proto::ext::application::Response *
 AppRequestRouter::openApplication(const proto::ext::application::OpenApplicationRequest &req) const {
-  QString target = req.target().c_str();
+  QString target = ProtoString::toQString(req.target());
 
   if (req.has_app_id()) {
-    if (auto app = m_appDb.findById(req.app_id().c_str())) {
+    if (auto app = m_appDb.findById(ProtoString::toQString(req.app_id()))) {
       m_appDb.launch(*app, {target});
       return nullptr;
     }
@@ -37,12 +81,11 @@ AppRequestRouter::openApplication(const proto::ext::application::OpenApplication
 proto::ext::extension::Response *AppRequestRouter::route(const proto::ext::application::Request &req) {
   namespace app = proto::ext::application;
 
-  auto wrap = [](app::Response *appRes) -> proto::ext::extension::Response * {
-    auto res = new proto::ext::extension::Response;
-    auto data = new proto::ext::extension::ResponseData;
+  // responses are allocated on the arena of the request, and sent before it is released
+  auto wrap = [arena = req.GetArena()](app::Response *appRes) -> proto::ext::extension::Response * {
+    auto res = google::protobuf::Arena::Create<proto::ext::extension::Response>(arena);
 
-    data->set_allocated_app(appRes);
-    res->set_allocated_data(data);
+    res->mutable_data()->set_allocated_app(appRes);
     return res;
   };
 
@@ -7,6 +7,8 @@
 class AppRequestRouter {
   AppService &m_appDb;
 
+  const proto::ext::application::ListApplicationResponse &applicationList() const;
+
   proto::ext::application::Response *
   listApplications(const proto::ext::application::ListApplicationRequest &) const;
 
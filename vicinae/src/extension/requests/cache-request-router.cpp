@@ -0,0 +1,92 @@
+#include "cache-request-router.hpp"
+
+namespace cache = proto::ext::cache;
+using google::protobuf::Arena;
+
+std::optional<std::filesystem::path> CacheRequestRouter::logPath(const std::string &ns) const {
+  std::filesystem::path relative(ns);
+
+  if (relative.is_absolute()) return std::nullopt;
+
+  // namespaces may be nested, not get out of the directory
+  for (const auto &part : relative) {
+    if (part == "..") return std::nullopt;
+  }
+
+  return m_directory / relative / "cache.log";
+}
+
+cache::Response *CacheRequestRouter::set(const cache::SetRequest &req) {
+  auto path = logPath(req.namespace_());
+
+  if (!path) return nullptr;
+
+  std::vector<std::string> touched(req.touched().begin(), req.touched().end());
+
+  if (!m_cache.set(*path, req.key(), req.data(), req.capacity(), touched)) return nullptr;
+
+  auto res = Arena::Create<cache::Response>(req.GetArena());
+
+  res->mutable_set();
+
+  return res;
+}
+
+cache::Response *CacheRequestRouter::remove(const cache::RemoveRequest &req) {
+  auto path = logPath(req.namespace_());
+
+  if (!path) return nullptr;
+
+  // removing a key that is not there is not an error, the worker may not have seen it evicted yet
+  m_cache.remove(*path, req.key());
+
+  auto res = Arena::Create<cache::Response>(req.GetArena());
+
+  res->mutable_remove();
+
+  return res;
+}
+
+cache::Response *CacheRequestRouter::clear(const cache::ClearRequest &req) {
+  auto path = logPath(req.namespace_());
+
+  if (!path || !m_cache.clear(*path)) return nullptr;
+
+  auto res = Arena::Create<cache::Response>(req.GetArena());
+
+  res->mutable_clear();
+
+  return res;
+}
+
+proto::ext::extension::Response *CacheRequestRouter::route(const cache::Request &req) {
+  cache::Response *cacheRes = nullptr;
+
+  switch (req.payload_case()) {
+  case cache::Request::kSet:
+    cacheRes = set(req.set());
+    break;
+  case cache::Request::kRemove:
+    cacheRes = remove(req.remove());
+    break;
+  case cache::Request::kClear:
+    cacheRes = clear(req.clear());
+    break;
+  default:
+    break;
+  }
+
+  // responses are allocated on the arena of the request, and sent before it is released
+  auto res = Arena::Create<proto::ext::extension::Response>(req.GetArena());
+
+  if (cacheRes) {
+    res->mutable_data()->set_allocated_cache(cacheRes);
+  } else {
+    res->mutable_error()->set_error_text("Failed to write to the cache");
+  }
+
+  return res;
+}
+
+CacheRequestRouter::CacheRequestRouter(ExtensionCacheService &cache, std::filesystem::path directory)
+    : m_cache(cache), m_directory(std::move(directory)) {}
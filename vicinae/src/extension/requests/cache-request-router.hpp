@@ -0,0 +1,25 @@
+#pragma once
+#include "proto/cache.pb.h"
+#include "proto/extension.pb.h"
+#include "services/extension-cache/extension-cache-service.hpp"
+#include <filesystem>
+#include <optional>
+
+class CacheRequestRouter {
+  ExtensionCacheService &m_cache;
+  // of the extension, which its namespaces are logged in
+  std::filesystem::path m_directory;
+
+  /**
+   * Log of the namespace `ns`, unless it is not within the cache directory of the extension.
+   */
+  std::optional<std::filesystem::path> logPath(const std::string &ns) const;
+
+  proto::ext::cache::Response *set(const proto::ext::cache::SetRequest &req);
+  proto::ext::cache::Response *remove(const proto::ext::cache::RemoveRequest &req);
+  proto::ext::cache::Response *clear(const proto::ext::cache::ClearRequest &req);
+
+public:
+  proto::ext::extension::Response *route(const proto::ext::cache::Request &req);
+  CacheRequestRouter(ExtensionCacheService &cache, std::filesystem::path directory);
+};
@@ -1,4 +1,5 @@
 #include "clipboard-request-router.hpp"
+#include "lib/proto-string.hpp"
 #include "proto/clipboard.pb.h"
 
 Clipboard::Content
@@ -7,11 +8,11 @@ ClipboardRequestRouter::parseProtoClipboardContent(const proto::ext::clipboard::
 
   switch (content.content_case()) {
   case ProtoContent::kText:
-    return Clipboard::Text(content.text().c_str());
+    return Clipboard::Text(ProtoString::toQString(content.text()));
   case ProtoContent::kHtml: {
     auto &html = content.html();
 
-    return Clipboard::Html({html.html().c_str(), html.text().c_str()});
+    return Clipboard::Html({ProtoString::toQString(html.html()), ProtoString::toQString(html.text())});
   }
   case ProtoContent::kPath:
     return Clipboard::File(content.path().path());
@@ -29,10 +30,9 @@ ClipboardRequestRouter::paste(const proto::ext::clipboard::PasteToClipboardReque
   // wait for the window which might be closing
   QTimer::singleShot(100, this, [this, content]() { m_clipboard.pasteContent(content); });
 
-  auto resData = new proto::ext::clipboard::PasteToClipboardResponse;
-  auto res = new proto::ext::clipboard::Response;
+  auto res = google::protobuf::Arena::Create<proto::ext::clipboard::Response>(req.GetArena());
 
-  res->set_allocated_paste(resData);
+  res->mutable_paste();
 
   return res;
 }
@@ -44,10 +44,9 @@ ClipboardRequestRouter::copy(const proto::ext::clipboard::CopyToClipboardRequest
 
   m_clipboard.copyContent(content, {.concealed = concealed});
 
-  auto resData = new proto::ext::clipboard::CopyToClipboardResponse;
-  auto res = new proto::ext::clipboard::Response;
+  auto res = google::protobuf::Arena::Create<proto::ext::clipboard::Response>(req.GetArena());
 
-  res->set_allocated_copy(resData);
+  res->mutable_copy();
 
   return res;
 }
@@ -55,12 +54,11 @@ ClipboardRequestRouter::copy(const proto::ext::clipboard::CopyToClipboardRequest
 proto::ext::extension::Response *ClipboardRequestRouter::route(const proto::ext::clipboard::Request &req) {
   namespace clipboard = proto::ext::clipboard;
 
-  auto wrap = [](proto::ext::clipboard::Response *clipRes) -> proto::ext::extension::Response * {
-    auto res = new proto::ext::extension::Response;
-    auto data = new proto::ext::extension::ResponseData;
+  // responses are allocated on the arena of the request, and sent before it is released
+  auto wrap = [arena = req.GetArena()](clipboard::Response *clipRes) -> proto::ext::extension::Response * {
+    auto res = google::protobuf::Arena::Create<proto::ext::extension::Response>(arena);
 
-    data->set_allocated_clipboard(clipRes);
-    res->set_allocated_data(data);
+    res->mutable_data()->set_allocated_clipboard(clipRes);
     return res;
   };
 
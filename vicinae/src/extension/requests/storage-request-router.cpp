@@ -1,30 +1,32 @@
+#include "lib/proto-string.hpp"
 #include "services/local-storage/local-storage-service.hpp"
 #include "storage-request-router.hpp"
 #include "utils/utils.hpp"
 
 namespace storage = proto::ext::storage;
+using google::protobuf::Arena;
 
 proto::ext::storage::GetResponse *
 StorageRequestRouter::handleGetStorage(const proto::ext::storage::GetRequest &req) {
-  auto res = new proto::ext::storage::GetResponse;
-  QJsonValue value = m_storage->getItem(m_namespaceId, QString::fromStdString(req.key()));
+  auto res = Arena::Create<storage::GetResponse>(req.GetArena());
+  QJsonValue value = m_storage->getItem(m_namespaceId, ProtoString::toQString(req.key()));
 
-  res->set_allocated_value(new google::protobuf::Value(transformJsonValueToProto(value)));
+  *res->mutable_value() = transformJsonValueToProto(value);
 
   return res;
 }
 
 storage::SetResponse *StorageRequestRouter::handleSetStorage(const storage::SetRequest &req) {
-  auto res = new storage::SetResponse;
+  auto res = Arena::Create<storage::SetResponse>(req.GetArena());
   auto jsonValue = protoToJsonValue(req.value());
 
-  m_storage->setItem(m_namespaceId, QString::fromStdString(req.key()), jsonValue);
+  m_storage->setItem(m_namespaceId, ProtoString::toQString(req.key()), jsonValue);
 
   return res;
 }
 
 storage::ClearResponse *StorageRequestRouter::handleClearStorage(const storage::ClearRequest &req) {
-  auto res = new storage::ClearResponse;
+  auto res = Arena::Create<storage::ClearResponse>(req.GetArena());
 
   m_storage->clearNamespace(m_namespaceId);
 
@@ -32,29 +34,100 @@ storage::ClearResponse *StorageRequestRouter::handleClearStorage(const storage::
 }
 
 storage::RemoveResponse *StorageRequestRouter::handleRemoveStorage(const storage::RemoveRequest &req) {
-  auto res = new storage::RemoveResponse;
+  auto res = Arena::Create<storage::RemoveResponse>(req.GetArena());
 
-  m_storage->removeItem(m_namespaceId, QString::fromStdString(req.key()));
+  m_storage->removeItem(m_namespaceId, ProtoString::toQString(req.key()));
 
   return res;
 }
 
 storage::ListResponse *StorageRequestRouter::handleListStorage(const storage::ListRequest &req) {
-  auto res = new storage::ListResponse;
+  auto res = Arena::Create<storage::ListResponse>(req.GetArena());
   auto values = res->mutable_values();
   auto jsonValues = m_storage->listNamespaceItems(m_namespaceId);
 
-  for (const auto &key : jsonValues.keys()) {
-    auto value = transformJsonValueToProto(jsonValues.value(key));
-    values->insert({key.toStdString(), value});
+  for (auto it = jsonValues.constBegin(); it != jsonValues.constEnd(); ++it) {
+    (*values)[ProtoString::toStdString(it.key())] = transformJsonValueToProto(it.value());
   }
 
   return res;
 }
 
+storage::MultiGetResponse *StorageRequestRouter::handleMultiGet(const storage::MultiGetRequest &req) {
+  auto res = Arena::Create<storage::MultiGetResponse>(req.GetArena());
+  auto values = res->mutable_values();
+  std::vector<QString> keys;
+
+  keys.reserve(req.keys().size());
+
+  for (const auto &key : req.keys()) {
+    keys.emplace_back(ProtoString::toQString(key));
+  }
+
+  auto jsonValues = m_storage->getItems(m_namespaceId, keys);
+
+  for (auto it = jsonValues.constBegin(); it != jsonValues.constEnd(); ++it) {
+    (*values)[ProtoString::toStdString(it.key())] = transformJsonValueToProto(it.value());
+  }
+
+  return res;
+}
+
+storage::MultiSetResponse *StorageRequestRouter::handleMultiSet(const storage::MultiSetRequest &req) {
+  auto res = Arena::Create<storage::MultiSetResponse>(req.GetArena());
+  QJsonObject values;
+
+  for (const auto &[key, value] : req.values()) {
+    values[ProtoString::toQString(key)] = protoToJsonValue(value);
+  }
+
+  m_storage->setItems(m_namespaceId, values);
+
+  return res;
+}
+
+std::optional<LocalStorageService::Operation>
+StorageRequestRouter::parseBatchOperation(const storage::BatchOperation &op) {
+  using Operation = LocalStorageService::Operation;
+
+  switch (op.payload_case()) {
+  case storage::BatchOperation::kSet:
+    return Operation{.kind = Operation::Set,
+                     .key = ProtoString::toQString(op.set().key()),
+                     .value = protoToJsonValue(op.set().value())};
+  case storage::BatchOperation::kRemove:
+    return Operation{.kind = Operation::Remove, .key = ProtoString::toQString(op.remove().key())};
+  case storage::BatchOperation::kClear:
+    return Operation{.kind = Operation::Clear};
+  default:
+    break;
+  }
+
+  return std::nullopt;
+}
+
+storage::BatchResponse *StorageRequestRouter::handleBatch(const storage::BatchRequest &req) {
+  std::vector<LocalStorageService::Operation> operations;
+
+  operations.reserve(req.ops().size());
+
+  for (const auto &op : req.ops()) {
+    auto operation = parseBatchOperation(op);
+
+    if (!operation) return nullptr;
+
+    operations.emplace_back(std::move(*operation));
+  }
+
+  if (!m_storage->applyBatch(m_namespaceId, operations)) return nullptr;
+
+  return Arena::Create<storage::BatchResponse>(req.GetArena());
+}
+
 proto::ext::extension::Response *StorageRequestRouter::route(const storage::Request &req) {
   namespace storage = storage;
-  auto storageRes = new storage::Response();
+  // responses are allocated on the arena of the request, and sent before it is released
+  auto storageRes = Arena::Create<storage::Response>(req.GetArena());
 
   switch (req.payload_case()) {
   case storage::Request::kGet:
@@ -72,17 +145,31 @@ proto::ext::extension::Response *StorageRequestRouter::route(const storage::Requ
   case storage::Request::kList:
     storageRes->set_allocated_list(handleListStorage(req.list()));
     break;
+  case storage::Request::kMultiGet:
+    storageRes->set_allocated_multi_get(handleMultiGet(req.multi_get()));
+    break;
+  case storage::Request::kMultiSet:
+    storageRes->set_allocated_multi_set(handleMultiSet(req.multi_set()));
+    break;
+  case storage::Request::kBatch: {
+    // the extension has to know that none of the operations were applied
+    if (auto batch = handleBatch(req.batch())) {
+      storageRes->set_allocated_batch(batch);
+      break;
+    }
+
+    if (!storageRes->GetArena()) delete storageRes;
+    return makeErrorResponse("Failed to apply storage batch");
+  }
   default: {
-    delete storageRes;
+    if (!storageRes->GetArena()) delete storageRes;
     return makeErrorResponse("Unhandled storage response");
   }
   }
 
-  auto response = new proto::ext::extension::Response;
-  auto data = new proto::ext::extension::ResponseData;
+  auto response = Arena::Create<proto::ext::extension::Response>(req.GetArena());
 
-  data->set_allocated_storage(storageRes);
-  response->set_allocated_data(data);
+  response->mutable_data()->set_allocated_storage(storageRes);
 
   return response;
 }
@@ -1,9 +1,9 @@
 #pragma once
 #include "proto/storage.pb.h"
 #include "proto/extension.pb.h"
+#include "services/local-storage/local-storage-service.hpp"
 #include <QString>
-
-class LocalStorageService;
+#include <optional>
 
 class StorageRequestRouter {
   LocalStorageService *m_storage = nullptr;
@@ -24,6 +24,12 @@ class StorageRequestRouter {
   proto::ext::storage::ClearResponse *handleClearStorage(const proto::ext::storage::ClearRequest &req);
   proto::ext::storage::RemoveResponse *handleRemoveStorage(const proto::ext::storage::RemoveRequest &req);
   proto::ext::storage::ListResponse *handleListStorage(const proto::ext::storage::ListRequest &req);
+  proto::ext::storage::MultiGetResponse *handleMultiGet(const proto::ext::storage::MultiGetRequest &req);
+  proto::ext::storage::MultiSetResponse *handleMultiSet(const proto::ext::storage::MultiSetRequest &req);
+  proto::ext::storage::BatchResponse *handleBatch(const proto::ext::storage::BatchRequest &req);
+
+  std::optional<LocalStorageService::Operation>
+  parseBatchOperation(const proto::ext::storage::BatchOperation &op);
 
 public:
   StorageRequestRouter(LocalStorageService *storage, const QString &namespaceId)
@@ -1,10 +1,12 @@
 #include "ui-request-router.hpp"
+#include "lib/proto-string.hpp"
 #include "proto/ui.pb.h"
-#include "timer.hpp"
+#include "trace/trace.hpp"
 #include "ui/alert/alert.hpp"
 #include "ui/toast/toast.hpp"
-#include <QtConcurrent/QtConcurrent>
+#include <QApplication>
 #include <QClipboard>
+#include <ranges>
 #include <unordered_map>
 
 namespace ui = proto::ext::ui;
@@ -21,11 +23,15 @@ ToastPriority UIRequestRouter::parseProtoToastStyle(ui::ToastStyle style) {
   return ToastPriority::Success;
 }
 
-void UIRequestRouter::modelCreated() {
-  if (m_modelWatcher.isCanceled()) return;
+void UIRequestRouter::modelCreated(uint64_t frame, const ParsedRenderData &models) {
+  TraceScope trace("render", "widget update");
+
+  // frames complete in order, but only the newest one is worth rendering
+  if (frame <= m_lastRenderedFrame) return;
+
+  m_lastRenderedFrame = frame;
 
   auto views = m_navigation->views();
-  auto models = m_modelWatcher.result();
   auto items = models.items | std::views::take(views.size()) | std::views::enumerate;
 
   for (const auto &[n, model] : items) {
@@ -38,55 +44,114 @@ void UIRequestRouter::modelCreated() {
   }
 }
 
+void UIRequestRouter::parseFrame(uint64_t frame, const std::shared_ptr<ExtensionRequest> &request,
+                                 bool outdated) {
+  auto &ops = *request->mutableRequestData().mutable_ui()->mutable_render()->mutable_ops();
+  std::optional<ParsedRenderData> models;
+
+  request->span().enter("parse");
+
+  bool applied;
+
+  {
+    TraceScope trace("render", "tree apply");
+
+    // every frame has to be applied, in order, for the tree to stay in sync with the reconciler
+    applied = m_renderTree.apply(ops);
+  }
+
+  if (!applied) {
+    qCritical() << "Failed to apply render operations, the render tree is out of sync";
+  } else if (frame == m_lastFrame && !outdated) {
+    // superseded frames are only acknowledged: their changes are reported along with the ones of the newer
+    // frame
+    TraceScope trace("render", "model parse");
+
+    request->span().enter("model");
+    models = m_modelParser.parse(m_renderTree.views());
+  }
+
+  request->span().enter("gui queue");
+
+  QMetaObject::invokeMethod(
+      this,
+      [this, frame, request, models = std::move(models)]() {
+        if (models) {
+          request->span().enter("widget update");
+          modelCreated(frame, *models);
+        }
+        acknowledgeFrame(*request);
+      },
+      Qt::QueuedConnection);
+}
+
+void UIRequestRouter::parseOutdatedFrame() {
+  if (!m_outdatedFrame) return;
+
+  m_outdatedFrame = false;
+
+  // the command did not render for the newer search text, what it last rendered is up to date after all
+  m_renderQueue.start([this, frame = m_lastFrame.load()]() {
+    TraceScope trace("render", "model parse");
+    auto models = m_modelParser.parse(m_renderTree.views());
+
+    QMetaObject::invokeMethod(
+        this, [this, frame, models = std::move(models)]() { modelCreated(frame, models); },
+        Qt::QueuedConnection);
+  });
+}
+
+void UIRequestRouter::acknowledgeFrame(ExtensionRequest &request) {
+  auto res = google::protobuf::Arena::Create<proto::ext::extension::Response>(request.arena().get());
+
+  res->mutable_data()->mutable_ui()->mutable_render();
+  request.respond(res);
+}
+
 proto::ext::ui::Response *UIRequestRouter::showToast(const proto::ext::ui::ShowToastRequest &req) {
-  auto res = new proto::ext::ui::Response;
-  auto ack = new proto::ext::common::AckResponse;
+  auto res = google::protobuf::Arena::Create<ui::Response>(req.GetArena());
   auto style = parseProtoToastStyle(req.style());
 
-  m_toast.setToast(req.title().c_str(), style);
+  m_toast.setToast(ProtoString::toQString(req.title()), style);
 
-  res->set_allocated_show_toast(ack);
+  res->mutable_show_toast();
 
   return res;
 }
 
 proto::ext::ui::Response *UIRequestRouter::hideToast(const proto::ext::ui::HideToastRequest &req) {
   // TODO: implement needed
-  auto res = new proto::ext::ui::Response;
-  auto ack = new proto::ext::common::AckResponse;
+  auto res = google::protobuf::Arena::Create<ui::Response>(req.GetArena());
 
-  res->set_allocated_hide_toast(ack);
+  res->mutable_hide_toast();
 
   return res;
 }
 
 proto::ext::ui::Response *UIRequestRouter::updateToast(const proto::ext::ui::UpdateToastRequest &req) {
-  auto res = new proto::ext::ui::Response;
-  auto ack = new proto::ext::common::AckResponse;
+  auto res = google::protobuf::Arena::Create<ui::Response>(req.GetArena());
 
-  res->set_allocated_update_toast(ack);
+  res->mutable_update_toast();
 
   return res;
 }
 
 proto::ext::ui::Response *
 UIRequestRouter::handleSetSearchText(const proto::ext::ui::SetSearchTextRequest &req) {
-  auto res = new proto::ext::ui::Response;
-  auto ack = new proto::ext::common::AckResponse;
+  auto res = google::protobuf::Arena::Create<ui::Response>(req.GetArena());
 
-  m_navigation->handle()->setSearchText(req.text().c_str());
-  res->set_allocated_set_search_text(ack);
+  m_navigation->handle()->setSearchText(ProtoString::toQString(req.text()));
+  res->mutable_set_search_text();
 
   return res;
 }
 
 proto::ext::ui::Response *
 UIRequestRouter::handleCloseWindow(const proto::ext::ui::CloseMainWindowRequest &req) {
-  auto res = new proto::ext::ui::Response;
-  auto ack = new proto::ext::common::AckResponse;
+  auto res = google::protobuf::Arena::Create<ui::Response>(req.GetArena());
 
   m_navigation->handle()->closeWindow();
-  res->set_allocated_close_main_window(ack);
+  res->mutable_close_main_window();
 
   return res;
 }
@@ -94,30 +159,30 @@ UIRequestRouter::handleCloseWindow(const proto::ext::ui::CloseMainWindowRequest
 proto::ext::ui::Response *
 UIRequestRouter::getSelectedText(const proto::ext::ui::GetSelectedTextRequest &req) {
   auto text = QApplication::clipboard()->text(QClipboard::Mode::Selection);
-  auto res = new proto::ext::ui::Response;
-  auto selectedTextRes = new proto::ext::ui::GetSelectedTextResponse;
+  auto res = google::protobuf::Arena::Create<ui::Response>(req.GetArena());
 
-  selectedTextRes->set_text(text.toStdString());
-  res->set_allocated_get_selected_text(selectedTextRes);
+  ProtoString::assign(res->mutable_get_selected_text()->mutable_text(), text);
 
   return res;
 }
 
-proto::ext::extension::Response *UIRequestRouter::route(const proto::ext::ui::Request &req) {
+proto::ext::extension::Response *UIRequestRouter::route(ExtensionRequest *request) {
   using Request = proto::ext::ui::Request;
+  auto &req = *request->mutableRequestData().mutable_ui();
+  auto &arena = request->arena();
 
-  auto wrapUI = [](proto::ext::ui::Response *uiRes) -> proto::ext::extension::Response * {
-    auto res = new proto::ext::extension::Response;
-    auto data = new proto::ext::extension::ResponseData;
+  // responses are allocated on the arena of the request, and sent before it is released
+  auto wrapUI = [&arena](ui::Response *uiRes) -> proto::ext::extension::Response * {
+    auto res = google::protobuf::Arena::Create<proto::ext::extension::Response>(arena.get());
 
-    data->set_allocated_ui(uiRes);
-    res->set_allocated_data(data);
+    res->mutable_data()->set_allocated_ui(uiRes);
     return res;
   };
 
   switch (req.payload_case()) {
   case Request::kRender:
-    return wrapUI(handleRender(req.render()));
+    handleRender(request);
+    return nullptr;
   case Request::kSetSearchText:
     return wrapUI(handleSetSearchText(req.set_search_text()));
   case Request::kCloseMainWindow:
@@ -155,74 +220,53 @@ ui::Response *UIRequestRouter::confirmAlert(const ui::ConfirmAlertRequest &req)
   auto alert = new CallbackAlertWidget;
   auto controller = m_navigation->controller();
 
-  alert->setTitle(req.title().c_str());
-  alert->setMessage(req.description().c_str());
+  alert->setTitle(ProtoString::toQString(req.title()));
+  alert->setMessage(ProtoString::toQString(req.description()));
 
-  // Alert is dismissed on navigation change, so capturing is safe here.
-  alert->setCallback([req, controller](bool value) { controller->notify(req.handle().c_str(), {value}); });
+  // Alert is dismissed on navigation change, so capturing is safe here. Only the handle is kept, and only
+  // decoded if the alert is answered.
+  alert->setCallback([handle = req.handle(), controller](bool value) {
+    controller->notify(ProtoString::toQString(handle), {value});
+  });
 
   m_navigation->handle()->setDialog(alert);
 
-  auto res = new proto::ext::ui::Response;
-  auto ack = new proto::ext::common::AckResponse;
+  auto res = google::protobuf::Arena::Create<ui::Response>(req.GetArena());
 
-  res->set_allocated_confirm_alert(ack);
+  res->mutable_confirm_alert();
 
   return res;
 }
 
 proto::ext::ui::Response *UIRequestRouter::pushView(const proto::ext::ui::PushViewRequest &req) {
-  auto res = new proto::ext::ui::Response;
-  auto ack = new proto::ext::common::AckResponse;
+  auto res = google::protobuf::Arena::Create<ui::Response>(req.GetArena());
 
   m_navigation->pushView();
-  res->set_allocated_close_main_window(ack);
+  res->mutable_close_main_window();
 
   return res;
 }
 
 proto::ext::ui::Response *UIRequestRouter::popView(const proto::ext::ui::PopViewRequest &req) {
-  auto res = new proto::ext::ui::Response;
-  auto ack = new proto::ext::common::AckResponse;
+  auto res = google::protobuf::Arena::Create<ui::Response>(req.GetArena());
 
   m_navigation->popView();
-  res->set_allocated_pop_view(ack);
+  res->mutable_pop_view();
 
   return res;
 }
 
-proto::ext::ui::Response *UIRequestRouter::handleRender(const proto::ext::ui::RenderRequest &request) {
-  /**
-   * For now, we still process the render tree as JSON. Maybe later we can move that to protobuf as well,
-   * but that will require writing more serialization code in the reconciler.
-   */
-  QJsonParseError parseError;
-  auto doc = QJsonDocument::fromJson(request.json().c_str(), &parseError);
-
-  if (parseError.error) {
-    qCritical() << "Failed to parse render tree";
-    return {};
-  }
-
-  auto views = doc.object().value("views").toArray();
-
-  if (m_modelWatcher.isRunning()) {
-    m_modelWatcher.cancel();
-    m_modelWatcher.waitForFinished();
-  }
-
-  m_modelWatcher.setFuture(QtConcurrent::run([views]() {
-    Timer timer;
-    auto model = ModelParser().parse(views);
-
-    // timer.time("Model parsed");
-    return model;
-  }));
-
-  auto response = new proto::ext::ui::Response;
+void UIRequestRouter::handleRender(ExtensionRequest *request) {
+  // only the changes made since the previous render are sent, applied to our copy of the tree by the pool.
+  // the request is responded to once the frame is rendered, which the reconciler waits for before sending
+  // more than a couple of them: renders made in the meantime are coalesced into the next frame
+  std::shared_ptr<ExtensionRequest> owned(request);
+  uint64_t frame = ++m_lastFrame;
+  // the frame is for a search text the user already typed past, the command renders again for the new one
+  bool outdated = m_navigation->controller()->frameReceived();
 
-  response->set_allocated_render(new proto::ext::common::AckResponse);
+  m_outdatedFrame = outdated;
+  request->span().enter("render queue");
 
-  // render queued
-  return response;
+  m_renderQueue.start([this, frame, owned, outdated]() { parseFrame(frame, owned, outdated); });
 }
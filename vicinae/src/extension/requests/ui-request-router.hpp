@@ -1,14 +1,29 @@
 #pragma once
+#include "extend/model-parser.hpp"
+#include "extend/retained-render-tree.hpp"
 #include "extension/extension-navigation-controller.hpp"
+#include "extension/manager/extension-manager.hpp"
+#include <atomic>
+#include <memory>
+#include <optional>
 #include <qjsonarray.h>
 #include <qjsonobject.h>
 #include <qobject.h>
 #include "proto/ui.pb.h"
 #include "services/toast/toast-service.hpp"
+#include "task-scheduler/task-scheduler.hpp"
 #include "ui/toast/toast.hpp"
 
 class UIRequestRouter : public QObject {
-  QFutureWatcher<ParsedRenderData> m_modelWatcher;
+  // frames are applied and parsed in order, off the GUI thread, as the command waits on them to show its view
+  TaskQueue m_renderQueue{TaskScheduler::Priority::Interactive};
+  // only accessed from the render queue
+  RetainedRenderTree m_renderTree;
+  ModelParser m_modelParser;
+  std::atomic<uint64_t> m_lastFrame = 0;
+  uint64_t m_lastRenderedFrame = 0;
+  // the latest frame was not parsed, as a newer search text was sent to the command right as it came in
+  bool m_outdatedFrame = false;
   ExtensionNavigationController *m_navigation = nullptr;
   ToastService &m_toast;
 
@@ -17,7 +32,7 @@ class UIRequestRouter : public QObject {
   proto::ext::ui::Response *showToast(const proto::ext::ui::ShowToastRequest &request);
   proto::ext::ui::Response *hideToast(const proto::ext::ui::HideToastRequest &request);
   proto::ext::ui::Response *updateToast(const proto::ext::ui::UpdateToastRequest &request);
-  proto::ext::ui::Response *handleRender(const proto::ext::ui::RenderRequest &request);
+  void handleRender(ExtensionRequest *request);
   proto::ext::ui::Response *handleSetSearchText(const proto::ext::ui::SetSearchTextRequest &req);
   proto::ext::ui::Response *handleCloseWindow(const proto::ext::ui::CloseMainWindowRequest &req);
   proto::ext::ui::Response *pushView(const proto::ext::ui::PushViewRequest &req);
@@ -27,13 +42,26 @@ class UIRequestRouter : public QObject {
 
   proto::ext::ui::Response *getSelectedText(const proto::ext::ui::GetSelectedTextRequest &req);
 
-  void modelCreated();
+  void parseFrame(uint64_t frame, const std::shared_ptr<ExtensionRequest> &request, bool outdated);
+  void parseOutdatedFrame();
+  void modelCreated(uint64_t frame, const ParsedRenderData &models);
+  void acknowledgeFrame(ExtensionRequest &request);
 
 public:
-  proto::ext::extension::Response *route(const proto::ext::ui::Request &req);
+  /**
+   * Returns nothing for render requests, which are taken ownership of and responded to once the frame they
+   * carry is rendered.
+   */
+  proto::ext::extension::Response *route(ExtensionRequest *request);
 
   UIRequestRouter(ExtensionNavigationController *navigation, ToastService &toast)
       : m_navigation(navigation), m_toast(toast) {
-    connect(&m_modelWatcher, &QFutureWatcher<RenderModel>::finished, this, &UIRequestRouter::modelCreated);
+    m_navigation->controller()->setSearchUnansweredHandler([this]() { parseOutdatedFrame(); });
+  }
+
+  ~UIRequestRouter() {
+    // the members the running frame uses are destroyed before the queue is
+    m_renderQueue.clear();
+    m_renderQueue.waitForDone();
   }
 };
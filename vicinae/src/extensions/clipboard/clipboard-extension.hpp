@@ -3,7 +3,33 @@
 #include "extensions/clipboard/clipboard-history-command.hpp"
 #include "../../ui/image/url.hpp"
 #include "vicinae.hpp"
+#include <chrono>
 #include <qlogging.h>
+#include <unordered_map>
+
+static const std::vector<Preference::DropdownData::Option> maxEntriesOptions = {
+    {"Unlimited", "unlimited"},
+    {"100", "100"},
+    {"500", "500"},
+    {"1000", "1000"},
+    {"5000", "5000"},
+    {"10000", "10000"},
+};
+
+// in megabytes
+static const std::vector<Preference::DropdownData::Option> maxSizeOptions = {
+    {"Unlimited", "unlimited"}, {"100 MB", "100"}, {"500 MB", "500"}, {"1 GB", "1000"}, {"5 GB", "5000"},
+};
+
+static const std::vector<Preference::DropdownData::Option> maxAgeOptions = {
+    {"Forever", "forever"}, {"1 day", "day"},         {"1 week", "week"},
+    {"1 month", "month"},   {"3 months", "quarter"}, {"1 year", "year"},
+};
+
+static const std::unordered_map<QString, std::chrono::seconds> maxAgeByValue = {
+    {"day", std::chrono::days(1)},      {"week", std::chrono::weeks(1)}, {"month", std::chrono::days(30)},
+    {"quarter", std::chrono::days(91)}, {"year", std::chrono::days(365)},
+};
 
 class ClipboardExtension : public BuiltinCommandRepository {
 public:
@@ -29,15 +55,74 @@ public:
                                      "increase total storage size, but will refine the search.");
     storeAllOfferings.setDefaultValue(true);
 
-    return {monitoring, storeAllOfferings};
+    auto substringSearch = Preference::makeCheckbox("substring-search");
+
+    substringSearch.setTitle("Substring search");
+    substringSearch.setDescription("Match the search anywhere in the copied text, instead of only at the "
+                                   "start of its words. This requires a significantly larger search index.");
+    substringSearch.setDefaultValue(false);
+
+    auto maxEntries = Preference::makeDropdown("max-entries", maxEntriesOptions);
+
+    maxEntries.setTitle("Maximum entries");
+    maxEntries.setDescription("Number of entries after which the oldest ones are removed from the history. "
+                              "Pinned entries are always kept, and not counted.");
+    maxEntries.setDefaultValue("unlimited");
+
+    auto maxSize = Preference::makeDropdown("max-size", maxSizeOptions);
+
+    maxSize.setTitle("Maximum size");
+    maxSize.setDescription("Storage size after which the oldest entries are removed from the history.");
+    maxSize.setDefaultValue("unlimited");
+
+    auto keepText = Preference::makeDropdown("keep-text", maxAgeOptions);
+
+    keepText.setTitle("Keep text and links for");
+    keepText.setDescription("How long text and links stay in the history after they were last copied.");
+    keepText.setDefaultValue("forever");
+
+    auto keepImages = Preference::makeDropdown("keep-images", maxAgeOptions);
+
+    keepImages.setTitle("Keep images for");
+    keepImages.setDescription("How long images stay in the history after they were last copied.");
+    keepImages.setDefaultValue("forever");
+
+    return {monitoring, storeAllOfferings, substringSearch, maxEntries, maxSize, keepText, keepImages};
   }
 
   void preferenceValuesChanged(const QJsonObject &value) const override {
     auto clipman = ServiceRegistry::instance()->clipman();
 
     clipman->setRecordAllOffers(value.value("store-all-offerings").toBool());
+    clipman->setSubstringSearch(value.value("substring-search").toBool());
+    clipman->setRetentionPolicy(parseRetentionPolicy(value));
     clipman->setMonitoring(value.value("monitoring").toBool());
   }
 
+  static ClipboardRetentionPolicy parseRetentionPolicy(const QJsonObject &value) {
+    ClipboardRetentionPolicy policy;
+    bool ok = false;
+
+    if (auto count = value.value("max-entries").toString().toULongLong(&ok); ok) {
+      policy.maxEntries = count;
+    }
+
+    if (auto megabytes = value.value("max-size").toString().toULongLong(&ok); ok) {
+      policy.maxTotalSize = megabytes * 1'000'000;
+    }
+
+    if (auto it = maxAgeByValue.find(value.value("keep-text").toString()); it != maxAgeByValue.end()) {
+      for (auto kind : {ClipboardOfferKind::Text, ClipboardOfferKind::Link, ClipboardOfferKind::Unknown}) {
+        policy.maxAge[kind] = it->second;
+      }
+    }
+
+    if (auto it = maxAgeByValue.find(value.value("keep-images").toString()); it != maxAgeByValue.end()) {
+      policy.maxAge[ClipboardOfferKind::Image] = it->second;
+    }
+
+    return policy;
+  }
+
   ClipboardExtension() { registerCommand<ClipboardHistoryCommand>(); }
 };
@@ -1,6 +1,9 @@
 #include "command-database.hpp"
 #include "single-view-command-context.hpp"
 #include "create/create-extension-view.hpp"
+#include "performance/extension-performance-view.hpp"
+#include "performance/render-benchmark-view.hpp"
+#include "performance/search-performance-view.hpp"
 #include "theme.hpp"
 
 class CreateExtensionCommand : public BuiltinViewCommand<CreateExtensionView> {
@@ -11,6 +14,30 @@ class CreateExtensionCommand : public BuiltinViewCommand<CreateExtensionView> {
   }
 };
 
+class ExtensionPerformanceCommand : public BuiltinViewCommand<ExtensionPerformanceView> {
+  QString id() const override { return "extension-performance"; }
+  QString name() const override { return "Extension Performance"; }
+  ImageURL iconUrl() const override {
+    return ImageURL::builtin("stopwatch").setBackgroundTint(SemanticColor::Green);
+  }
+};
+
+class SearchPerformanceCommand : public BuiltinViewCommand<SearchPerformanceView> {
+  QString id() const override { return "search-performance"; }
+  QString name() const override { return "Search Performance"; }
+  ImageURL iconUrl() const override {
+    return ImageURL::builtin("magnifying-glass").setBackgroundTint(SemanticColor::Green);
+  }
+};
+
+class RenderBenchmarkCommand : public BuiltinViewCommand<RenderBenchmarkView> {
+  QString id() const override { return "render-benchmark"; }
+  QString name() const override { return "Render Benchmark"; }
+  ImageURL iconUrl() const override {
+    return ImageURL::builtin("stopwatch").setBackgroundTint(SemanticColor::Green);
+  }
+};
+
 class DeveloperExtension : public BuiltinCommandRepository {
   QString id() const override { return "developer"; }
   QString displayName() const override { return "Developer"; }
@@ -19,5 +46,10 @@ class DeveloperExtension : public BuiltinCommandRepository {
   }
 
 public:
-  DeveloperExtension() { registerCommand<CreateExtensionCommand>(); }
+  DeveloperExtension() {
+    registerCommand<CreateExtensionCommand>();
+    registerCommand<ExtensionPerformanceCommand>();
+    registerCommand<SearchPerformanceCommand>();
+    registerCommand<RenderBenchmarkCommand>();
+  }
 };
@@ -0,0 +1,293 @@
+#pragma once
+#include "common.hpp"
+#include "extension/manager/extension-manager.hpp"
+#include "service-registry.hpp"
+#include "proto/manager.pb.h"
+#include "services/toast/toast-service.hpp"
+#include "ui/action-pannel/action.hpp"
+#include "ui/markdown/markdown-renderer.hpp"
+#include "ui/omni-list/omni-list.hpp"
+#include "ui/toast/toast.hpp"
+#include "ui/views/list-view.hpp"
+#include "utils/utils.hpp"
+#include <QDateTime>
+#include <QFile>
+#include <chrono>
+#include <qboxlayout.h>
+#include <qwidget.h>
+
+static QString formatLatency(std::chrono::microseconds duration) {
+  auto us = duration.count();
+
+  if (us < 1000) return QString("%1µs").arg(us);
+  if (us < 1'000'000) return QString("%1ms").arg(us / 1000.0, 0, 'f', 1);
+
+  return QString("%1s").arg(us / 1'000'000.0, 0, 'f', 2);
+}
+
+static QString formatPercentiles(const LatencyHistogram &histogram) {
+  return QString("p50 %1 · p95 %2 · p99 %3 · max %4")
+      .arg(formatLatency(histogram.percentile(0.5)))
+      .arg(formatLatency(histogram.percentile(0.95)))
+      .arg(formatLatency(histogram.percentile(0.99)))
+      .arg(formatLatency(histogram.max()));
+}
+
+class ExportChromeTraceAction : public AbstractAction {
+  void execute(ApplicationContext *ctx) override {
+    auto toast = ctx->services->toastService();
+    auto trace = ctx->services->extensionManager()->tracer().chromeTrace();
+    auto timestamp = QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss");
+    auto path = downloadsFolder() / QString("vicinae-trace-%1.json").arg(timestamp).toStdString();
+    QFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly) || file.write(trace.toJson(QJsonDocument::Compact)) == -1) {
+      toast->setToast("Failed to export trace", ToastPriority::Danger);
+      return;
+    }
+
+    toast->setToast(QString("Trace exported to %1").arg(path.c_str()));
+  }
+
+public:
+  ExportChromeTraceAction() : AbstractAction("Export as Chrome trace", ImageURL::builtin("download")) {}
+};
+
+class ExtensionStatsDetail : public QWidget {
+  MarkdownRenderer *m_markdown = new MarkdownRenderer();
+
+public:
+  ExtensionStatsDetail(const ExtensionTracer::Stats &stats) {
+    auto layout = new QVBoxLayout(this);
+    QString markdown;
+
+    markdown += QString("# %1\n\n").arg(stats.type);
+    markdown += QString("%1 requests from `%2`\n\n").arg(stats.total.count()).arg(stats.extensionId);
+    markdown += "## End to end\n\n";
+    markdown += QString("%1 · mean %2\n\n")
+                    .arg(formatPercentiles(stats.total))
+                    .arg(formatLatency(stats.total.mean()));
+    markdown += "## Phases\n\n";
+
+    for (const auto &[name, histogram] : stats.phases) {
+      markdown += QString("- **%1**: %2\n").arg(name).arg(formatPercentiles(histogram));
+    }
+
+    m_markdown->setMarkdown(markdown);
+    layout->addWidget(m_markdown);
+    setLayout(layout);
+  }
+};
+
+/**
+ * Name of the command a worker runs, along with the extension it comes from.
+ */
+static std::pair<QString, QString> workerCommandName(const std::optional<WorkerSession> &session) {
+  if (!session) return {"Unknown command", ""};
+
+  return {session->entrypoint.stem().c_str(), session->extensionPath.filename().c_str()};
+}
+
+class WorkerStatsDetail : public QWidget {
+  MarkdownRenderer *m_markdown = new MarkdownRenderer();
+
+public:
+  WorkerStatsDetail(const proto::ext::manager::WorkerStats &stats,
+                    const std::optional<WorkerSession> &session) {
+    auto layout = new QVBoxLayout(this);
+    auto [command, extension] = workerCommandName(session);
+    auto active = std::chrono::microseconds(static_cast<int64_t>(stats.active_ms() * 1000));
+    auto uptime = std::chrono::microseconds(static_cast<int64_t>(stats.uptime_ms() * 1000));
+    QString markdown;
+
+    markdown += QString("# %1
+
+").arg(command);
+    markdown += QString("Session `%1` of `%2`
+
+").arg(stats.session_id().c_str()).arg(extension);
+    markdown += "## Heap
+
+";
+    markdown += QString("- **Used**: %1 of %2
+").arg(formatSize(stats.heap_used())).arg(formatSize(stats.heap_total()));
+    markdown += QString("- **Peak**: %1
+").arg(formatSize(stats.peak_heap_used()));
+    markdown += QString("- **Limit**: %1
+
+").arg(formatSize(stats.heap_limit()));
+    markdown += "## Event loop
+
+";
+    markdown += QString("- **Busy for**: %1 out of %2
+").arg(formatLatency(active)).arg(formatLatency(uptime));
+    markdown += QString("- **Recent utilization**: %1%
+").arg(stats.utilization() * 100, 0, 'f', 1);
+
+    m_markdown->setMarkdown(markdown);
+    layout->addWidget(m_markdown);
+    setLayout(layout);
+  }
+};
+
+class ExtensionPerformanceView : public ListView {
+  class WorkerListItem : public AbstractDefaultListItem, public ListView::Actionnable {
+    proto::ext::manager::WorkerStats m_stats;
+    std::optional<WorkerSession> m_session;
+    ExtensionPerformanceView *m_view;
+
+  public:
+    QString generateId() const override { return QString("worker.%1").arg(m_stats.session_id().c_str()); }
+
+    ItemData data() const override {
+      auto [command, extension] = workerCommandName(m_session);
+      auto utilization = QString("%1% busy").arg(m_stats.utilization() * 100, 0, 'f', 0);
+
+      return {.iconUrl = ImageURL::builtin("memory-stick"),
+              .name = command,
+              .subtitle = extension,
+              .accessories = {{.text = formatSize(m_stats.heap_used())}, {.text = utilization}}};
+    }
+
+    std::unique_ptr<ActionPanelState> newActionPanel(ApplicationContext *ctx) const override {
+      auto panel = std::make_unique<ActionPanelState>();
+      auto section = panel->createSection();
+      auto view = m_view;
+      auto refresh =
+          new StaticAction("Refresh", ImageURL::builtin("arrow-clockwise"), [view]() { view->refresh(); });
+
+      refresh->setShortcut({.key = "R", .modifiers = {"ctrl"}});
+      section->addAction(refresh);
+
+      return panel;
+    }
+
+    QWidget *generateDetail() const override { return new WorkerStatsDetail(m_stats, m_session); }
+
+    WorkerListItem(proto::ext::manager::WorkerStats stats, std::optional<WorkerSession> session,
+                   ExtensionPerformanceView *view)
+        : m_stats(std::move(stats)), m_session(std::move(session)), m_view(view) {}
+  };
+
+  class StatsListItem : public AbstractDefaultListItem, public ListView::Actionnable {
+    ExtensionTracer::Stats m_stats;
+    ExtensionPerformanceView *m_view;
+
+  public:
+    QString generateId() const override { return QString("%1.%2").arg(m_stats.extensionId, m_stats.type); }
+
+    ItemData data() const override {
+      auto p95 = formatLatency(m_stats.total.percentile(0.95));
+
+      return {.iconUrl = ImageURL::builtin("stopwatch"),
+              .name = m_stats.type,
+              .accessories = {{.text = QString("%1 requests").arg(m_stats.total.count())},
+                              {.text = QString("p95 %1").arg(p95)}}};
+    }
+
+    std::unique_ptr<ActionPanelState> newActionPanel(ApplicationContext *ctx) const override {
+      auto panel = std::make_unique<ActionPanelState>();
+      auto section = panel->createSection();
+      auto view = m_view;
+      auto exportTrace = new ExportChromeTraceAction;
+      auto refresh =
+          new StaticAction("Refresh", ImageURL::builtin("arrow-clockwise"), [view]() { view->refresh(); });
+      auto reset =
+          new StaticAction("Reset statistics", ImageURL::builtin("trash"), [view](ApplicationContext *ctx) {
+            ctx->services->extensionManager()->tracer().clear();
+            view->refresh();
+          });
+
+      exportTrace->setPrimary(true);
+      refresh->setShortcut({.key = "R", .modifiers = {"ctrl"}});
+      reset->setStyle(AbstractAction::Style::Danger);
+      section->addAction(exportTrace);
+      section->addAction(refresh);
+      section->addAction(reset);
+
+      return panel;
+    }
+
+    QWidget *generateDetail() const override { return new ExtensionStatsDetail(m_stats); }
+
+    StatsListItem(ExtensionTracer::Stats stats, ExtensionPerformanceView *view)
+        : m_stats(std::move(stats)), m_view(view) {}
+  };
+
+  void render(const QString &text) {
+    auto stats = ServiceRegistry::instance()->extensionManager()->tracer().stats();
+    QString query = text.trimmed();
+    QString extensionId;
+    OmniList::Section *section = nullptr;
+
+    m_list->beginResetModel();
+
+    if (m_workerStats && m_workerStats->workers_size() > 0) {
+      auto manager = ServiceRegistry::instance()->extensionManager();
+      auto idle = m_workerStats->idle_worker_count();
+      auto &workers = m_list->addSection(QString("Workers · %1 idle").arg(idle));
+
+      for (const auto &stats : m_workerStats->workers()) {
+        auto session = manager->session(stats.session_id().c_str());
+        auto [command, extension] = workerCommandName(session);
+
+        if (!command.contains(query, Qt::CaseInsensitive) &&
+            !extension.contains(query, Qt::CaseInsensitive)) {
+          continue;
+        }
+
+        workers.addItem(std::make_unique<WorkerListItem>(stats, session, this));
+      }
+    }
+
+    // ordered by extension
+    for (auto &entry : stats) {
+      if (!entry.type.contains(query, Qt::CaseInsensitive) &&
+          !entry.extensionId.contains(query, Qt::CaseInsensitive)) {
+        continue;
+      }
+
+      if (!section || entry.extensionId != extensionId) {
+        extensionId = entry.extensionId;
+        section = &m_list->addSection(extensionId.isEmpty() ? "Unknown extension" : extensionId);
+      }
+
+      section->addItem(std::make_unique<StatsListItem>(std::move(entry), this));
+    }
+
+    m_list->endResetModel(OmniList::KeepSelection);
+  }
+
+  std::optional<proto::ext::manager::ManagerStatsResponse> m_workerStats;
+
+public:
+  /**
+   * Request latencies are rendered right away, worker stats once the manager sent them.
+   */
+  void refresh() {
+    auto manager = ServiceRegistry::instance()->extensionManager();
+
+    render(searchText());
+
+    if (!manager->isRunning()) return;
+
+    auto request = manager->requestWorkerStats();
+
+    connect(request, &ManagerRequest::finished, this, [this](const proto::ext::manager::ResponseData &data) {
+      if (data.has_stats()) {
+        m_workerStats = data.stats();
+        render(searchText());
+      }
+    });
+    connect(request, &ManagerRequest::finished, request, &QObject::deleteLater);
+  }
+
+  void textChanged(const QString &text) override { render(text); }
+
+  void onActivate() override {
+    ListView::onActivate();
+    refresh();
+  }
+
+  void initialize() override { setSearchPlaceholderText("Search extension workers and requests..."); }
+};
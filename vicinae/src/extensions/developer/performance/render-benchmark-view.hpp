@@ -0,0 +1,162 @@
+#pragma once
+#include "extensions/developer/performance/extension-performance-view.hpp"
+#include "extensions/developer/performance/render-benchmark.hpp"
+#include <map>
+
+class ExportRenderBenchmarkAction : public AbstractAction {
+  RenderBenchmark::Result m_result;
+
+  void execute(ApplicationContext *ctx) override {
+    auto toast = ctx->services->toastService();
+    auto timestamp = QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss");
+    auto name = QString("vicinae-render-%1-%2.json").arg(m_result.scenario).arg(timestamp);
+    auto path = downloadsFolder() / name.toStdString();
+    QFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly) || file.write(m_result.toJson().toJson()) == -1) {
+      toast->setToast("Failed to export results", ToastPriority::Danger);
+      return;
+    }
+
+    toast->setToast(QString("Results exported to %1").arg(path.c_str()));
+  }
+
+public:
+  ExportRenderBenchmarkAction(RenderBenchmark::Result result)
+      : AbstractAction("Export as JSON", ImageURL::builtin("download")), m_result(std::move(result)) {}
+};
+
+static QString formatHeapGrowth(int64_t bytes) {
+  if (bytes < 0) return QString("-%1").arg(formatSize(-bytes));
+
+  return formatSize(bytes);
+}
+
+class RenderBenchmarkDetail : public QWidget {
+  MarkdownRenderer *m_markdown = new MarkdownRenderer();
+
+public:
+  RenderBenchmarkDetail(const RenderBenchmark::ScenarioInfo &info,
+                        const std::optional<RenderBenchmark::Result> &result) {
+    auto layout = new QVBoxLayout(this);
+    QString markdown;
+
+    markdown += QString("# %1\n\n%2\n\n").arg(info.name).arg(info.description);
+
+    if (!result) {
+      markdown += "Not run yet.\n";
+    } else {
+      if (!result->completed) { markdown += "**The view was closed before every frame was rendered.**\n\n"; }
+
+      markdown += "## Frames\n\n";
+      markdown += QString("- **Initial frame**: %1\n").arg(formatLatency(result->initialFrame));
+      markdown += QString("- **Updates** (%1): %2\n\n")
+                      .arg(result->frames)
+                      .arg(formatPercentiles(result->frame));
+      markdown += "## Phases\n\n";
+
+      for (const auto &[name, histogram] : result->phases) {
+        markdown += QString("- **%1**: %2\n").arg(name).arg(formatPercentiles(histogram));
+      }
+
+      markdown += "\n## Heap growth per update\n\n";
+      markdown += QString("mean %1 · max %2\n")
+                      .arg(formatHeapGrowth(result->meanHeapGrowth()))
+                      .arg(formatHeapGrowth(result->maxHeapGrowth));
+    }
+
+    m_markdown->setMarkdown(markdown);
+    layout->addWidget(m_markdown);
+    setLayout(layout);
+  }
+};
+
+class RenderBenchmarkView : public ListView {
+  class ScenarioListItem : public AbstractDefaultListItem, public ListView::Actionnable {
+    RenderBenchmark::ScenarioInfo m_info;
+    std::optional<RenderBenchmark::Result> m_result;
+    RenderBenchmarkView *m_view;
+
+  public:
+    QString generateId() const override { return m_info.id; }
+
+    ItemData data() const override {
+      AccessoryList accessories;
+
+      if (m_result) {
+        auto p95 = formatLatency(m_result->frame.percentile(0.95));
+
+        accessories.push_back({.text = QString("p95 %1").arg(p95)});
+      }
+
+      return {.iconUrl = ImageURL::builtin("stopwatch"), .name = m_info.name, .accessories = accessories};
+    }
+
+    std::unique_ptr<ActionPanelState> newActionPanel(ApplicationContext *ctx) const override {
+      auto panel = std::make_unique<ActionPanelState>();
+      auto section = panel->createSection();
+      auto view = m_view;
+      auto info = m_info;
+      auto run = new StaticAction("Run benchmark", ImageURL::builtin("play"),
+                                  [view, info](ApplicationContext *ctx) { view->run(info, ctx); });
+
+      run->setPrimary(true);
+      section->addAction(run);
+
+      if (m_result) { section->addAction(new ExportRenderBenchmarkAction(*m_result)); }
+
+      return panel;
+    }
+
+    QWidget *generateDetail() const override { return new RenderBenchmarkDetail(m_info, m_result); }
+
+    ScenarioListItem(RenderBenchmark::ScenarioInfo info, std::optional<RenderBenchmark::Result> result,
+                     RenderBenchmarkView *view)
+        : m_info(std::move(info)), m_result(std::move(result)), m_view(view) {}
+  };
+
+  RenderBenchmark *m_benchmark = new RenderBenchmark(this);
+  std::map<QString, RenderBenchmark::Result> m_results;
+
+  void run(const RenderBenchmark::ScenarioInfo &info, ApplicationContext *ctx) {
+    if (m_benchmark->isRunning()) return;
+
+    m_benchmark->start(info, ctx->navigation.get(), ctx->services->extensionManager());
+  }
+
+  void handleFinished(const RenderBenchmark::Result &result) {
+    m_results[result.scenario] = result;
+    refresh();
+  }
+
+  void render(const QString &text) {
+    QString query = text.trimmed();
+
+    m_list->beginResetModel();
+
+    auto &section = m_list->addSection("Scenarios");
+
+    for (const auto &info : RenderBenchmark::scenarios()) {
+      if (!info.name.contains(query, Qt::CaseInsensitive)) continue;
+
+      std::optional<RenderBenchmark::Result> result;
+
+      if (auto it = m_results.find(info.id); it != m_results.end()) { result = it->second; }
+
+      section.addItem(std::make_unique<ScenarioListItem>(info, result, this));
+    }
+
+    m_list->endResetModel(OmniList::KeepSelection);
+  }
+
+public:
+  void refresh() { render(searchText()); }
+
+  void textChanged(const QString &text) override { render(text); }
+
+  void initialize() override {
+    setSearchPlaceholderText("Search scenarios...");
+    connect(m_benchmark, &RenderBenchmark::finished, this, &RenderBenchmarkView::handleFinished);
+    refresh();
+  }
+};
@@ -0,0 +1,289 @@
+#include "extensions/developer/performance/render-benchmark.hpp"
+#include "extend/model-parser.hpp"
+#include "extension/extension-view-wrapper.hpp"
+#include "navigation-controller.hpp"
+#include "services/emoji-service/emoji.hpp"
+#include <QJsonObject>
+#include <QTimer>
+#include <format>
+#include <ranges>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using Props = google::protobuf::Map<std::string, google::protobuf::Value>;
+
+static int64_t heapInUse() {
+#ifdef __GLIBC__
+  return static_cast<int64_t>(mallinfo2().uordblks);
+#else
+  return 0;
+#endif
+}
+
+static void setString(Props &props, const char *key, const std::string &value) {
+  props[key].set_string_value(value);
+}
+
+static void setImage(Props &props, const char *key, std::string_view source) {
+  auto &fields = *props[key].mutable_struct_value()->mutable_fields();
+
+  fields["source"].set_string_value(std::string(source));
+}
+
+static void fillListItemProps(Props &props, size_t index, size_t revision) {
+  setString(props, "id", std::to_string(index));
+  setString(props, "title", std::format("Item {} (revision {})", index, revision));
+  setString(props, "subtitle", std::format("Subtitle of item {}", index));
+  setImage(props, "icon", "hammer");
+}
+
+static void fillGridItemProps(Props &props, size_t index, size_t revision) {
+  const auto &emojis = StaticEmojiDatabase::orderedList();
+  const auto &emoji = emojis[index % emojis.size()];
+
+  setString(props, "id", std::to_string(index));
+  setString(props, "title", std::format("{} (revision {})", emoji.name, revision));
+  setImage(props, "content", emoji.emoji);
+}
+
+static std::string detailMarkdown(size_t sections) {
+  std::string markdown;
+
+  for (size_t i = 0; i != sections; ++i) {
+    markdown += std::format("## Section {}\n\nParagraph of section {}, with **bold** and `code`.\n\n", i, i);
+    markdown += "- first item\n- second item\n  - nested item\n\n";
+  }
+
+  return markdown;
+}
+
+const std::vector<RenderBenchmark::ScenarioInfo> &RenderBenchmark::scenarios() {
+  static const std::vector<ScenarioInfo> scenarios = {
+      {.scenario = Scenario::LargeList,
+       .id = "large-list",
+       .name = "Large list",
+       .description = QString("List of %1 items, one of which changes every frame").arg(LIST_ITEM_COUNT)},
+      {.scenario = Scenario::DeepDetail,
+       .id = "deep-detail",
+       .name = "Deep detail",
+       .description = QString("Detail of %1 markdown sections and as many metadata labels, a section being "
+                              "appended every frame")
+                          .arg(DETAIL_SECTION_COUNT)},
+      {.scenario = Scenario::ImageGrid,
+       .id = "image-grid",
+       .name = "Image grid",
+       .description =
+           QString("Grid of %1 emoji images, one of which changes every frame").arg(GRID_ITEM_COUNT)},
+  };
+
+  return scenarios;
+}
+
+RetainedRenderTree::Operations RenderBenchmark::initialFrame() const {
+  RetainedRenderTree::Operations ops;
+  auto insert = ops.Add()->mutable_insert();
+  auto root = insert->mutable_node();
+
+  insert->set_parent(RetainedRenderTree::ROOT_ID);
+  root->set_id(VIEW_ID);
+
+  switch (m_scenario) {
+  case Scenario::LargeList:
+    root->set_type("list");
+
+    for (size_t i = 0; i != LIST_ITEM_COUNT; ++i) {
+      auto item = root->add_children();
+
+      item->set_type("list-item");
+      item->set_id(FIRST_CHILD_ID + i);
+      fillListItemProps(*item->mutable_props(), i, 0);
+    }
+    break;
+  case Scenario::ImageGrid:
+    root->set_type("grid");
+    (*root->mutable_props())["columns"].set_number_value(8);
+
+    for (size_t i = 0; i != GRID_ITEM_COUNT; ++i) {
+      auto item = root->add_children();
+
+      item->set_type("grid-item");
+      item->set_id(FIRST_CHILD_ID + i);
+      fillGridItemProps(*item->mutable_props(), i, 0);
+    }
+    break;
+  case Scenario::DeepDetail: {
+    auto metadata = root->add_children();
+
+    root->set_type("detail");
+    setString(*root->mutable_props(), "markdown", detailMarkdown(DETAIL_SECTION_COUNT));
+    metadata->set_type("metadata");
+    metadata->set_id(FIRST_CHILD_ID);
+
+    for (size_t i = 0; i != DETAIL_SECTION_COUNT; ++i) {
+      auto label = metadata->add_children();
+
+      label->set_type("metadata-label");
+      label->set_id(FIRST_CHILD_ID + 1 + i);
+      setString(*label->mutable_props(), "title", std::format("Label {}", i));
+      setString(*label->mutable_props(), "text", std::format("Value {}", i));
+    }
+    break;
+  }
+  }
+
+  return ops;
+}
+
+RetainedRenderTree::Operations RenderBenchmark::updateFrame(size_t frame) const {
+  RetainedRenderTree::Operations ops;
+  auto update = ops.Add()->mutable_update();
+
+  // props are replaced, not merged, the updated node has all of its props sent again
+  switch (m_scenario) {
+  case Scenario::LargeList: {
+    size_t index = (frame * 7919) % LIST_ITEM_COUNT;
+
+    update->set_id(FIRST_CHILD_ID + index);
+    fillListItemProps(*update->mutable_props(), index, frame);
+    break;
+  }
+  case Scenario::ImageGrid: {
+    size_t index = (frame * 7919) % GRID_ITEM_COUNT;
+
+    update->set_id(FIRST_CHILD_ID + index);
+    fillGridItemProps(*update->mutable_props(), index, frame);
+    break;
+  }
+  case Scenario::DeepDetail:
+    update->set_id(VIEW_ID);
+    setString(*update->mutable_props(), "markdown", detailMarkdown(DETAIL_SECTION_COUNT + frame));
+    break;
+  }
+
+  return ops;
+}
+
+void RenderBenchmark::start(const ScenarioInfo &info, NavigationController *navigation,
+                            ExtensionManager *manager) {
+  if (isRunning()) return;
+
+  m_scenario = info.scenario;
+  m_tree.clear();
+  m_frame = 0;
+  m_lastFrameEnd.reset();
+  m_result = Result{.scenario = info.id};
+  m_navigation = navigation;
+  m_controller = std::make_unique<ExtensionCommandController>(manager);
+  m_view = new ExtensionViewWrapper(m_controller.get());
+  m_navigation->pushView(m_view);
+  m_navigation->setNavigationTitle(info.name);
+  QTimer::singleShot(0, this, &RenderBenchmark::runFrame);
+}
+
+void RenderBenchmark::record(const char *phase, Clock::duration duration) {
+  auto it = std::ranges::find(m_result.phases, std::string_view(phase),
+                              [](auto &&pair) { return std::string_view(pair.first); });
+
+  if (it == m_result.phases.end()) { it = m_result.phases.insert(it, {phase, {}}); }
+
+  it->second.add(duration_cast<microseconds>(duration));
+}
+
+void RenderBenchmark::runFrame() {
+  // popped while frames were being replayed
+  if (!m_view) return finish();
+
+  bool isInitial = m_frame == 0;
+
+  if (m_lastFrameEnd && !isInitial) { record("paint", Clock::now() - *m_lastFrameEnd); }
+
+  // generating the payload is the job of the reconciler, it is not part of the measurement
+  auto ops = isInitial ? initialFrame() : updateFrame(m_frame);
+  auto start = Clock::now();
+  int64_t heap = heapInUse();
+
+  if (!m_tree.apply(ops)) {
+    qCritical() << "Render benchmark frame" << m_frame << "refers to nodes that are not part of the tree";
+    return finish();
+  }
+
+  auto applied = Clock::now();
+  auto views = m_tree.views();
+  auto serialized = Clock::now();
+  auto models = ModelParser().parse(views);
+  auto parsed = Clock::now();
+
+  if (!models.items.empty()) { m_view->render(models.items.front().root); }
+
+  auto end = Clock::now();
+  int64_t heapGrowth = heapInUse() - heap;
+
+  if (isInitial) {
+    m_result.initialFrame = duration_cast<microseconds>(end - start);
+  } else {
+    record("apply", applied - start);
+    record("serialize", serialized - applied);
+    record("model", parsed - serialized);
+    record("widget update", end - parsed);
+    m_result.frame.add(duration_cast<microseconds>(end - start));
+    m_result.totalHeapGrowth += heapGrowth;
+    m_result.maxHeapGrowth = std::max(m_result.maxHeapGrowth, heapGrowth);
+    ++m_result.frames;
+  }
+
+  m_lastFrameEnd = end;
+
+  if (++m_frame <= FRAME_COUNT) {
+    QTimer::singleShot(0, this, &RenderBenchmark::runFrame);
+    return;
+  }
+
+  m_result.completed = true;
+  finish();
+}
+
+void RenderBenchmark::finish() {
+  if (m_view && m_navigation->topView() == m_view) { m_navigation->popCurrentView(); }
+
+  m_view.clear();
+  m_tree.clear();
+  emit finished(m_result);
+}
+
+QJsonDocument RenderBenchmark::Result::toJson() const {
+  auto histogramJson = [](const LatencyHistogram &histogram) {
+    QJsonObject obj;
+
+    // microseconds, as reported by the histogram
+    obj["count"] = static_cast<qint64>(histogram.count());
+    obj["mean"] = static_cast<qint64>(histogram.mean().count());
+    obj["p50"] = static_cast<qint64>(histogram.percentile(0.5).count());
+    obj["p95"] = static_cast<qint64>(histogram.percentile(0.95).count());
+    obj["p99"] = static_cast<qint64>(histogram.percentile(0.99).count());
+    obj["max"] = static_cast<qint64>(histogram.max().count());
+
+    return obj;
+  };
+  QJsonObject obj;
+  QJsonObject phasesJson;
+
+  for (const auto &[name, histogram] : phases) {
+    phasesJson[name] = histogramJson(histogram);
+  }
+
+  obj["scenario"] = scenario;
+  obj["completed"] = completed;
+  obj["frames"] = static_cast<qint64>(frames);
+  obj["initialFrame"] = static_cast<qint64>(initialFrame.count());
+  obj["frame"] = histogramJson(frame);
+  obj["phases"] = phasesJson;
+  obj["meanHeapGrowth"] = static_cast<qint64>(meanHeapGrowth());
+  obj["maxHeapGrowth"] = static_cast<qint64>(maxHeapGrowth);
+
+  return QJsonDocument(obj);
+}
+
+RenderBenchmark::RenderBenchmark(QObject *parent) : QObject(parent) {}
@@ -0,0 +1,96 @@
+#pragma once
+#include "extend/retained-render-tree.hpp"
+#include "extension/extension-command-controller.hpp"
+#include "extension/manager/extension-tracer.hpp"
+#include <QJsonDocument>
+#include <QObject>
+#include <QPointer>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <vector>
+
+class ExtensionViewWrapper;
+class NavigationController;
+
+/**
+ * Replays synthetic render frames through the path extension renders take once they reach the daemon: the
+ * retained render tree, the model parser and the extension view the model is rendered in, timing every
+ * phase of every frame.
+ *
+ * The first frame inserts the whole tree, as the reconciler does when a command first renders, the
+ * following ones replace the props of a single node, which is what most re-renders amount to. Frames are
+ * one event loop iteration apart so that the view gets to lay out and paint in between, this being
+ * reported as the `paint` phase.
+ */
+class RenderBenchmark : public QObject {
+  Q_OBJECT
+
+public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class Scenario { LargeList, DeepDetail, ImageGrid };
+
+  struct ScenarioInfo {
+    Scenario scenario;
+    QString id;
+    QString name;
+    QString description;
+  };
+
+  struct Result {
+    QString scenario;
+    size_t frames = 0;
+    // the frame that built the whole tree, excluded from the other statistics
+    std::chrono::microseconds initialFrame{0};
+    LatencyHistogram frame;
+    std::vector<std::pair<const char *, LatencyHistogram>> phases;
+    // net growth of the heap over a frame, which is only known when built against glibc
+    int64_t totalHeapGrowth = 0;
+    int64_t maxHeapGrowth = 0;
+    bool completed = false;
+
+    int64_t meanHeapGrowth() const { return frames ? totalHeapGrowth / static_cast<int64_t>(frames) : 0; }
+
+    QJsonDocument toJson() const;
+  };
+
+  static const std::vector<ScenarioInfo> &scenarios();
+
+  bool isRunning() const { return !m_view.isNull(); }
+
+  /**
+   * Push the view the frames are rendered in and start replaying them. `finished` is emitted once they
+   * all went through, or as soon as the view is popped.
+   */
+  void start(const ScenarioInfo &info, NavigationController *navigation, ExtensionManager *manager);
+
+  RenderBenchmark(QObject *parent = nullptr);
+
+private:
+  static constexpr size_t FRAME_COUNT = 200;
+  static constexpr size_t LIST_ITEM_COUNT = 10'000;
+  static constexpr size_t GRID_ITEM_COUNT = 2'000;
+  static constexpr size_t DETAIL_SECTION_COUNT = 200;
+  static constexpr uint32_t VIEW_ID = 1;
+  static constexpr uint32_t FIRST_CHILD_ID = 2;
+
+  RetainedRenderTree::Operations initialFrame() const;
+  RetainedRenderTree::Operations updateFrame(size_t frame) const;
+
+  void runFrame();
+  void record(const char *phase, Clock::duration duration);
+  void finish();
+
+  Scenario m_scenario = Scenario::LargeList;
+  RetainedRenderTree m_tree;
+  std::unique_ptr<ExtensionCommandController> m_controller;
+  QPointer<ExtensionViewWrapper> m_view;
+  NavigationController *m_navigation = nullptr;
+  size_t m_frame = 0;
+  std::optional<Clock::time_point> m_lastFrameEnd;
+  Result m_result;
+
+signals:
+  void finished(const Result &result) const;
+};
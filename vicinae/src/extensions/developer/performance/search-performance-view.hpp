@@ -0,0 +1,114 @@
+#pragma once
+#include "extensions/developer/performance/extension-performance-view.hpp"
+#include "search-profiler/search-profiler.hpp"
+
+class ExportSearchReportAction : public AbstractAction {
+  void execute(ApplicationContext *ctx) override {
+    auto toast = ctx->services->toastService();
+    auto report = SearchProfiler::instance().report();
+    auto timestamp = QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss");
+    auto path = downloadsFolder() / QString("vicinae-search-%1.json").arg(timestamp).toStdString();
+    QFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly) || file.write(report.toJson(QJsonDocument::Indented)) == -1) {
+      toast->setToast("Failed to export report", ToastPriority::Danger);
+      return;
+    }
+
+    toast->setToast(QString("Report exported to %1").arg(path.c_str()));
+  }
+
+public:
+  ExportSearchReportAction() : AbstractAction("Export as JSON", ImageURL::builtin("download")) {}
+};
+
+class SearchPerformanceView : public ListView {
+  class StatsListItem : public AbstractDefaultListItem, public ListView::Actionnable {
+    SearchProfiler::Stats m_stats;
+    SearchPerformanceView *m_view;
+
+  public:
+    QString generateId() const override { return m_stats.path; }
+
+    ItemData data() const override {
+      auto p95 = formatLatency(m_stats.latency.percentile(0.95));
+
+      return {.iconUrl = ImageURL::builtin("magnifying-glass"),
+              .name = m_stats.path,
+              .accessories = {{.text = QString("%1 searches").arg(m_stats.latency.count())},
+                              {.text = QString("p95 %1").arg(p95)}}};
+    }
+
+    std::unique_ptr<ActionPanelState> newActionPanel(ApplicationContext *ctx) const override {
+      auto panel = std::make_unique<ActionPanelState>();
+      auto section = panel->createSection();
+      auto view = m_view;
+      auto exportReport = new ExportSearchReportAction;
+      auto refresh =
+          new StaticAction("Refresh", ImageURL::builtin("arrow-clockwise"), [view]() { view->refresh(); });
+      auto reset = new StaticAction("Reset statistics", ImageURL::builtin("trash"), [view]() {
+        SearchProfiler::instance().clear();
+        view->refresh();
+      });
+
+      exportReport->setPrimary(true);
+      refresh->setShortcut({.key = "R", .modifiers = {"ctrl"}});
+      reset->setStyle(AbstractAction::Style::Danger);
+      section->addAction(exportReport);
+      section->addAction(refresh);
+      section->addAction(reset);
+
+      return panel;
+    }
+
+    QWidget *generateDetail() const override {
+      auto widget = new QWidget;
+      auto layout = new QVBoxLayout(widget);
+      auto markdown = new MarkdownRenderer;
+      const auto &latency = m_stats.latency;
+      double meanResults = latency.count() ? static_cast<double>(m_stats.results) / latency.count() : 0;
+      QString text;
+
+      text += QString("# %1\n\n").arg(m_stats.path);
+      text += QString("%1 searches · %2 results on average\n\n")
+                  .arg(latency.count())
+                  .arg(meanResults, 0, 'f', 1);
+      text += QString("%1 · mean %2\n").arg(formatPercentiles(latency)).arg(formatLatency(latency.mean()));
+      markdown->setMarkdown(text);
+      layout->addWidget(markdown);
+
+      return widget;
+    }
+
+    StatsListItem(SearchProfiler::Stats stats, SearchPerformanceView *view)
+        : m_stats(std::move(stats)), m_view(view) {}
+  };
+
+  void render(const QString &text) {
+    QString query = text.trimmed();
+
+    m_list->beginResetModel();
+
+    auto &section = m_list->addSection("Search paths");
+
+    for (auto &entry : SearchProfiler::instance().stats()) {
+      if (!QString(entry.path).contains(query, Qt::CaseInsensitive)) continue;
+
+      section.addItem(std::make_unique<StatsListItem>(std::move(entry), this));
+    }
+
+    m_list->endResetModel(OmniList::KeepSelection);
+  }
+
+public:
+  void refresh() { render(searchText()); }
+
+  void textChanged(const QString &text) override { render(text); }
+
+  void onActivate() override {
+    ListView::onActivate();
+    refresh();
+  }
+
+  void initialize() override { setSearchPlaceholderText("Search search paths..."); }
+};
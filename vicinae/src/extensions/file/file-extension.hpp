@@ -69,16 +69,23 @@ public:
     paths.setDescription("Semicolon-separated list of paths that vicinae will search");
     paths.setDefaultValue(homeDir().c_str());
 
-    return {paths};
+    auto contentPaths = Preference::makeText("content-paths");
+    contentPaths.setTitle("Content search paths");
+    contentPaths.setDescription("Semicolon-separated list of search paths whose text files can also be found "
+                                "by their content. Indexing the content of files takes more disk space.");
+    contentPaths.setDefaultValue("");
+
+    return {paths, contentPaths};
   }
 
   void preferenceValuesChanged(const QJsonObject &preferences) const override {
     QStringList searchPaths = preferences.value("paths").toString().split(';', Qt::SkipEmptyParts);
+    QStringList contentPaths = preferences.value("content-paths").toString().split(';', Qt::SkipEmptyParts);
     FileService *service = ServiceRegistry::instance()->fileService();
 
     auto entrypointRange =
-        searchPaths | std::views::transform([](const QJsonValue &obj) -> AbstractFileIndexer::Entrypoint {
-          return {.root = obj.toString().toStdString()};
+        searchPaths | std::views::transform([&](const QString &path) -> AbstractFileIndexer::Entrypoint {
+          return {.root = path.toStdString(), .indexContent = contentPaths.contains(path)};
         });
 
     std::vector<AbstractFileIndexer::Entrypoint> entrypoints = {entrypointRange.begin(),
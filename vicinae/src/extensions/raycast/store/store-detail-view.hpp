@@ -5,6 +5,7 @@
 #include "ui/action-pannel/action.hpp"
 #include "ui/text-link/text-link.hpp"
 #include "../../../ui/image/url.hpp"
+#include "services/raycast/extension-update-checker.hpp"
 #include "services/raycast/raycast-store.hpp"
 #include "settings/extension-settings.hpp"
 #include "theme.hpp"
@@ -248,6 +249,19 @@ class RaycastStoreDetailView : public BaseView {
         "Install extension", m_ext.themedIcon(), [ext = m_ext](const ApplicationContext *ctx) {
           using Watcher = QFutureWatcher<Raycast::DownloadExtensionResult>;
           auto store = ctx->services->raycastStore();
+          auto updates = ctx->services->extensionUpdates();
+
+          // downloaded in the background already
+          if (auto update = updates->update(ext.id);
+              update && update->extension.updated_at >= ext.updated_at) {
+            if (updates->applyUpdate(ext.id)) {
+              ctx->services->toastService()->setToast("Extension updated");
+            } else {
+              ctx->services->toastService()->setToast("Failed to install extension", ToastPriority::Danger);
+            }
+            return;
+          }
+
           auto watcher = new Watcher;
           ctx->services->toastService()->setToast("Downloading extension...");
 
@@ -256,10 +270,18 @@ class RaycastStoreDetailView : public BaseView {
 
             watcher->deleteLater();
 
-            if (!result) { ctx->services->toastService()->setToast("Failed to download extension"); }
+            if (!result) {
+              ctx->services->toastService()->setToast("Failed to download extension", ToastPriority::Danger);
+              return;
+            }
+
+            auto registry = ctx->services->extensionRegistry();
+
+            if (!registry->installFromZip(ext.id, std::string_view(result->constData(), result->size()))) {
+              ctx->services->toastService()->setToast("Failed to install extension", ToastPriority::Danger);
+              return;
+            }
 
-            ctx->services->extensionRegistry()->installFromZip(ext.id,
-                                                               std::string_view(result->toStdString()));
             ctx->services->toastService()->setToast("Extension downloaded");
           });
 
@@ -122,12 +122,19 @@ public:
 };
 
 class RaycastStoreListingView : public ListView {
+  static constexpr int PAGE_SIZE = 50;
+
   RaycastStoreService *m_store = nullptr;
   QFutureWatcher<Raycast::ListResult> m_listResultWatcher;
   QFutureWatcher<Raycast::ListResult> m_queryResultWatcher;
   QString lastQueryText;
   QTimer m_debounce;
 
+  // pages are appended to the listing as it is scrolled
+  std::vector<Raycast::Extension> m_listing;
+  int m_loadedPages = 0;
+  bool m_hasMorePages = true;
+
   void refresh() { setSearchText(searchText()); }
 
   void handleDebounce() {
@@ -140,18 +147,41 @@ class RaycastStoreListingView : public ListView {
     m_queryResultWatcher.setFuture(result);
   }
 
+  void fetchNextPage() {
+    setLoading(true);
+    m_listResultWatcher.setFuture(
+        m_store->fetchExtensions({.page = m_loadedPages + 1, .perPage = PAGE_SIZE}));
+  }
+
+  void handleScrolledNearEnd() {
+    if (!searchText().isEmpty() || !m_hasMorePages || m_listResultWatcher.isRunning()) return;
+
+    fetchNextPage();
+  }
+
   void textChanged(const QString &text) override {
     if (text.isEmpty()) {
-      setLoading(true);
-      auto result = m_store->fetchExtensions();
-
-      m_listResultWatcher.setFuture(result);
-      return;
+      if (m_loadedPages == 0) return fetchNextPage();
+      return renderListing(OmniList::SelectFirst);
     }
 
     m_debounce.start();
   }
 
+  void renderListing(OmniList::SelectionPolicy policy) {
+    m_list->updateModel(
+        [&]() {
+          auto &results = m_list->addSection("Extensions");
+
+          for (const auto &extension : m_listing) {
+            bool installed = context()->services->extensionRegistry()->isInstalled(extension.id);
+
+            results.addItem(std::make_unique<RaycastStoreExtensionItem>(extension, installed));
+          }
+        },
+        policy);
+  }
+
   void handleFinishedQuery() {
     if (searchText() != lastQueryText) return;
 
@@ -176,8 +206,6 @@ class RaycastStoreListingView : public ListView {
   }
 
   void handleFinishedPage() {
-    if (!searchText().isEmpty()) return;
-
     auto result = m_listResultWatcher.result();
 
     if (!result) {
@@ -185,17 +213,19 @@ class RaycastStoreListingView : public ListView {
       return;
     }
 
-    setLoading(false);
+    bool isFirstPage = m_loadedPages == 0;
 
-    m_list->updateModel([&]() {
-      auto &results = m_list->addSection("Extensions");
+    ++m_loadedPages;
+    m_hasMorePages = result->m_extensions.size() >= static_cast<size_t>(PAGE_SIZE);
+    m_listing.insert(m_listing.end(), result->m_extensions.begin(), result->m_extensions.end());
 
-      for (const auto &extension : result->m_extensions) {
-        bool installed = context()->services->extensionRegistry()->isInstalled(extension.id);
+    // the page after is fetched while this one is looked at, for scrolling to it to feel instant
+    if (m_hasMorePages) { m_store->prefetchExtensions({.page = m_loadedPages + 1, .perPage = PAGE_SIZE}); }
 
-        results.addItem(std::make_unique<RaycastStoreExtensionItem>(extension, installed));
-      }
-    });
+    if (!searchText().isEmpty()) return;
+
+    setLoading(false);
+    renderListing(isFirstPage ? OmniList::SelectFirst : OmniList::PreserveSelection);
   }
 
 public:
@@ -203,14 +233,12 @@ public:
     auto registry = context()->services->extensionRegistry();
 
     m_store = context()->services->raycastStore();
-    setLoading(true);
     setSearchPlaceholderText("Browse Raycast extensions");
-
-    auto result = m_store->fetchExtensions();
-
-    m_listResultWatcher.setFuture(result);
+    fetchNextPage();
 
     connect(registry, &ExtensionRegistry::extensionsChanged, this, &RaycastStoreListingView::refresh);
+    connect(m_list, &OmniList::scrolledNearEnd, this, &RaycastStoreListingView::handleScrolledNearEnd,
+            Qt::QueuedConnection);
   }
 
   RaycastStoreListingView() {
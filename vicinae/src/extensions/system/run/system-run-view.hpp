@@ -54,7 +54,7 @@ public:
 class SystemRunView : public ListView {
   void generateRootSearch() {
     m_list->updateModel([&]() {
-      auto &results = m_programDb.programs();
+      auto &results = ProgramDb::instance().programs();
       auto &section = m_list->addSection(QString("Programs (%1)").arg(results.size()));
 
       for (const auto &prog : results) {
@@ -67,7 +67,7 @@ class SystemRunView : public ListView {
     if (text.isEmpty()) { return generateRootSearch(); }
 
     m_list->updateModel([&]() {
-      auto results = m_programDb.search(text);
+      auto results = ProgramDb::instance().search(text);
       auto &section = m_list->addSection(QString("Results (%1)").arg(results.size()));
 
       for (const auto &prog : results) {
@@ -78,11 +78,11 @@ class SystemRunView : public ListView {
 
   void initialize() override {
     setSearchPlaceholderText("Search for a program to execute...");
-    connect(&m_programDb, &ProgramDb::backgroundScanFinished, this,
-            [this]() { setSearchText(searchText()); });
-    m_programDb.backgroundScan();
-  }
+    auto &programDb = ProgramDb::instance();
+
+    connect(&programDb, &ProgramDb::backgroundScanFinished, this, [this]() { setSearchText(searchText()); });
 
-private:
-  ProgramDb m_programDb;
+    // the database keeps itself up to date once scanned, views opened later reuse it as is
+    if (!programDb.isScanned()) { programDb.backgroundScan(); }
+  }
 };
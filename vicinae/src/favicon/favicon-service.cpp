@@ -3,6 +3,10 @@
 #include "favicon/dummy-favicon-request.hpp"
 #include "favicon/google-favicon-request.hpp"
 #include "favicon/twenty-favicon-request.hpp"
+#include "memory-budget/memory-budget.hpp"
+#include "service-registry.hpp"
+#include "sql-profiler/sql-profiler.hpp"
+#include <qdatetime.h>
 #include <qlogging.h>
 
 static const std::vector<FaviconService::FaviconServiceData> faviconProviders = {
@@ -13,20 +17,31 @@ static const std::vector<FaviconService::FaviconServiceData> faviconProviders =
 std::vector<FaviconService::FaviconServiceData> FaviconService::providers() { return faviconProviders; }
 
 FaviconService *FaviconService::instance() {
+  // the service is started after the launcher, unless an icon needs it first
+  if (!_instance) { ServiceRegistry::instance()->startup().require("favicon"); }
+
   assert(_instance && "FaviconService::instance() called before FaviconService::initialize()");
   return _instance;
 }
 
 void FaviconService::insertCache(const QString &key, const QPixmap &favicon) {
-  if (_cache.size() > maxCacheCount) { _cache.erase(_cache.begin()); }
+  qsizetype cost = static_cast<qsizetype>(favicon.width()) * favicon.height() * favicon.depth() / 8;
 
-  _cache.insert({key, favicon});
+  _cache.insert(key, new QPixmap(favicon), std::max<qsizetype>(1, cost));
 }
 
 void FaviconService::handleFetchedFavicon(const QString &domain, const QPixmap &favicon) {
-  insertCache(domain, favicon);
+  // what is stored is only ever shown as an icon, larger favicons are not worth decoding each time
+  QPixmap stored = favicon;
+
+  if (stored.width() > STORED_SIZE || stored.height() > STORED_SIZE) {
+    stored = stored.scaled(STORED_SIZE, STORED_SIZE, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+  }
 
-  if (!favicon.save(_dataDir.filePath(domain), "PNG")) {
+  insertCache(domain, stored);
+  _misses.erase(domain);
+
+  if (!stored.save(_dataDir.filePath(domain), "PNG")) {
     qDebug() << "Failed to save favicon on disk";
     return;
   }
@@ -36,26 +51,91 @@ void FaviconService::handleFetchedFavicon(const QString &domain, const QPixmap &
   query.prepare(R"(
 		INSERT INTO favicon (id, size)
 		VALUES (:id, :size)
+		ON CONFLICT (id) DO UPDATE SET size = excluded.size, updated_at = unixepoch()
 	)");
   query.bindValue(":id", domain);
-  query.bindValue(":size", favicon.width());
+  query.bindValue(":size", stored.width());
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qDebug() << "Favicon DB: failed to insert favicon: " << query.lastError();
     return;
   }
+
+  query.prepare("DELETE FROM favicon_miss WHERE id = :id");
+  query.bindValue(":id", domain);
+
+  if (!SqlProfiler::exec(query)) {
+    qDebug() << "Favicon DB: failed to clear favicon miss" << query.lastError();
+  }
+}
+
+void FaviconService::handleMissingFavicon(const QString &domain) {
+  auto now = QDateTime::currentSecsSinceEpoch();
+
+  _misses[domain] = now;
+
+  QSqlQuery query(_db);
+
+  query.prepare(R"(
+		INSERT INTO favicon_miss (id, checked_at)
+		VALUES (:id, :checked_at)
+		ON CONFLICT (id) DO UPDATE SET checked_at = excluded.checked_at
+	)");
+  query.bindValue(":id", domain);
+  query.bindValue(":checked_at", now);
+
+  if (!SqlProfiler::exec(query)) {
+    qDebug() << "Favicon DB: failed to insert favicon miss" << query.lastError();
+  }
+}
+
+bool FaviconService::isMissing(const QString &domain) const {
+  auto it = _misses.find(domain);
+
+  return it != _misses.end() && QDateTime::currentSecsSinceEpoch() - it->second < MISS_TTL;
+}
+
+bool FaviconService::isStored(const QString &domain) const {
+  return _cache.contains(domain) || _dataDir.exists(domain);
+}
+
+void FaviconService::loadMisses() {
+  QSqlQuery query(_db);
+
+  query.prepare("SELECT id, checked_at FROM favicon_miss WHERE checked_at > :since");
+  query.bindValue(":since", QDateTime::currentSecsSinceEpoch() - MISS_TTL);
+
+  if (!SqlProfiler::exec(query)) {
+    qDebug() << "Favicon DB: failed to load favicon misses" << query.lastError();
+    return;
+  }
+
+  while (query.next()) {
+    _misses[query.value(0).toString()] = query.value(1).toLongLong();
+  }
 }
 
 QPixmap FaviconService::retrieveFromCache(const QString &domain) {
-  if (auto it = _cache.find(domain); it != _cache.end()) { return it->second; }
+  if (auto cached = _cache.object(domain)) { return *cached; }
 
   QPixmap pm;
   QSqlQuery query(_db);
 
+  query.prepare(R"(
+		SELECT coalesce(updated_at, created_at) FROM favicon WHERE id = :domain
+	)");
+  query.bindValue(":domain", domain);
+
+  if (!SqlProfiler::exec(query) || !query.next()) return pm;
+
+  bool stale = QDateTime::currentSecsSinceEpoch() - query.value(0).toLongLong() > REFRESH_TTL;
+
   query.prepare("UPDATE favicon SET last_used_at = unixepoch() WHERE id = :domain;");
   query.bindValue(":domain", domain);
 
-  if (!query.exec()) { qDebug() << "Favicon DB: failed to update last_used_at" << query.lastError(); }
+  if (!SqlProfiler::exec(query)) {
+    qDebug() << "Favicon DB: failed to update last_used_at" << query.lastError();
+  }
 
   QFile favicon(_dataDir.filePath(domain));
 
@@ -64,6 +144,9 @@ QPixmap FaviconService::retrieveFromCache(const QString &domain) {
     insertCache(domain, pm);
   }
 
+  // the stored favicon is served meanwhile, and kept if fetching it again fails
+  if (!pm.isNull() && stale && !_pending.contains(domain)) { startRequest(domain); }
+
   return pm;
 }
 
@@ -77,9 +160,63 @@ void FaviconService::setService(const QString &id) {
   qCritical() << "no favicon provider for id" << id;
 }
 
-void FaviconService::setService(RequesterType type) { _requesterType = type; }
+void FaviconService::setService(RequesterType type) {
+  _requesterType = type;
+
+  if (_requesterType == None) {
+    _prefetchQueue.clear();
+    _prefetchTimer->stop();
+  }
+}
+
+void FaviconService::startRequest(const QString &domain) {
+  AbstractFaviconRequest *requester = nullptr;
+
+  switch (_requesterType) {
+  case Google:
+    requester = new GoogleFaviconRequester(domain, this);
+    break;
+  case Twenty:
+    requester = new TwentyFaviconRequester(domain, this);
+    break;
+  case None:
+    return;
+  default:
+    requester = new DummyFaviconRequest(domain, this);
+  }
 
-QFuture<FaviconService::FaviconResponse> FaviconService::makeRequest(const QString &domain, QObject *parent) {
+  // promises are added by the caller, a background refresh has none
+  _pending.try_emplace(domain);
+
+  auto finish = [this, requester, domain](const QPixmap &favicon) {
+    auto waiting = std::move(_pending[domain]);
+
+    _pending.erase(domain);
+    requester->deleteLater();
+
+    // a favicon that could not be fetched again is still good to show
+    if (favicon.isNull() && !_cache.contains(domain)) {
+      handleMissingFavicon(domain);
+    } else if (!favicon.isNull()) {
+      handleFetchedFavicon(domain, favicon);
+    }
+
+    for (auto &promise : waiting) {
+      if (favicon.isNull()) {
+        promise.addResult(std::unexpected("No favicon found for domain"));
+      } else {
+        promise.addResult(favicon);
+      }
+      promise.finish();
+    }
+  };
+
+  connect(requester, &AbstractFaviconRequest::finished, this, finish);
+  connect(requester, &AbstractFaviconRequest::failed, this, [finish]() { finish(QPixmap()); });
+  requester->start();
+}
+
+QFuture<FaviconService::FaviconResponse> FaviconService::makeRequest(const QString &domain) {
   QPromise<FaviconResponse> promise;
   auto future = promise.future();
 
@@ -90,41 +227,71 @@ QFuture<FaviconService::FaviconResponse> FaviconService::makeRequest(const QStri
     return future;
   }
 
-  AbstractFaviconRequest *requester = nullptr;
+  if (isMissing(domain)) {
+    promise.addResult(std::unexpected("No favicon found for domain"));
+    promise.finish();
+    return future;
+  }
 
-  switch (_requesterType) {
-  case Google:
-    requester = new GoogleFaviconRequester(domain, parent);
-    break;
-  case Twenty:
-    requester = new TwentyFaviconRequester(domain, parent);
-    break;
-  case None:
+  if (_requesterType == None) {
     promise.addResult(std::unexpected("Favicon fetching is disabled"));
     promise.finish();
     return future;
-  default:
-    requester = new DummyFaviconRequest(domain, parent);
   }
 
-  qDebug() << "request start !";
-
-  connect(requester, &AbstractFaviconRequest::finished, this,
-          [this, requester, domain, promise = std::move(promise)](const QPixmap &favicon) mutable {
-            handleFetchedFavicon(domain, favicon);
-            promise.addResult(favicon);
-            promise.finish();
-            requester->deleteLater();
-          });
+  // rows showing the same domain share a single request, some requesters finish right as they start
+  bool fetching = _pending.contains(domain);
 
-  requester->start();
+  _pending[domain].emplace_back(std::move(promise));
+  if (!fetching) { startRequest(domain); }
 
   return future;
 }
 
+void FaviconService::prefetch(const std::vector<QString> &domains) {
+  if (_requesterType == None) return;
+
+  for (const auto &domain : domains) {
+    if (domain.isEmpty() || std::ranges::find(_prefetchQueue, domain) != _prefetchQueue.end()) continue;
+    _prefetchQueue.emplace_back(domain);
+  }
+
+  if (!_prefetchQueue.empty() && !_prefetchTimer->isActive()) { _prefetchTimer->start(); }
+}
+
+void FaviconService::prefetchNext() {
+  // whatever is being fetched for the rows that are shown goes first
+  if (_pending.size() >= MAX_PREFETCH_IN_FLIGHT) return;
+
+  while (!_prefetchQueue.empty()) {
+    QString domain = std::move(_prefetchQueue.front());
+
+    _prefetchQueue.pop_front();
+
+    // checked as late as possible, as the domain may have been shown meanwhile
+    if (isStored(domain) || isMissing(domain) || _pending.contains(domain)) continue;
+
+    startRequest(domain);
+    break;
+  }
+
+  if (_prefetchQueue.empty()) { _prefetchTimer->stop(); }
+}
+
 FaviconService::FaviconService(const std::filesystem::path &path, QObject *parent)
     : QObject(parent), _db(QSqlDatabase::addDatabase("QSQLITE", "favicon")),
       _requesterType(RequesterType::Google) {
+  _cache.setMaxCost(MAX_CACHE_BYTES);
+  _prefetchTimer->setInterval(PREFETCH_INTERVAL);
+  connect(_prefetchTimer, &QTimer::timeout, this, &FaviconService::prefetchNext);
+  // evicted favicons are still stored, they are read back from disk the next time they are needed
+  MemoryBudget::instance().add({.subsystem = MemoryBudget::Subsystem::FaviconCache,
+                                .usage = [this]() { return static_cast<size_t>(_cache.totalCost()); },
+                                .trim =
+                                    [this](size_t budget) {
+                                      _cache.setMaxCost(std::min<qsizetype>(budget, MAX_CACHE_BYTES));
+                                      _cache.setMaxCost(MAX_CACHE_BYTES);
+                                    }});
   _dataDir = QFileInfo(path).dir().filePath("favicon-data");
   _dataDir.mkpath(_dataDir.path());
   _db.setDatabaseName(path.c_str());
@@ -136,7 +303,7 @@ FaviconService::FaviconService(const std::filesystem::path &path, QObject *paren
 
   QSqlQuery query(_db);
 
-  bool ok = query.exec(R"(
+  bool ok = SqlProfiler::exec(query, R"(
 		CREATE TABLE IF NOT EXISTS favicon (
 			id TEXT PRIMARY KEY,
 			size INTEGER,
@@ -147,4 +314,15 @@ FaviconService::FaviconService(const std::filesystem::path &path, QObject *paren
 	)");
 
   if (!ok) { qDebug() << "Failed to init favicon database:" << query.lastError(); }
+
+  ok = SqlProfiler::exec(query, R"(
+		CREATE TABLE IF NOT EXISTS favicon_miss (
+			id TEXT PRIMARY KEY,
+			checked_at INTEGER NOT NULL
+		);
+	)");
+
+  if (!ok) { qDebug() << "Failed to init favicon miss table:" << query.lastError(); }
+
+  loadMisses();
 }
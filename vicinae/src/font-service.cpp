@@ -1,8 +1,18 @@
 #include "font-service.hpp"
+#include "task-scheduler/task-scheduler.hpp"
+#include "vicinae.hpp"
+#include <filesystem>
+#include <qfile.h>
 #include <qfontdatabase.h>
+#include <qjsonarray.h>
+#include <qjsondocument.h>
+#include <qjsonobject.h>
 #include <qlogging.h>
 #include <qnamespace.h>
 #include <qprocess.h>
+#include <qstandardpaths.h>
+
+namespace fs = std::filesystem;
 
 static const std::vector<QString> UNIX_EMOJI_FONT_CANDIDATES = {
     "Twemoji",
@@ -41,4 +51,127 @@ QFont FontService::findEmojiFont() {
   return {};
 }
 
-FontService::FontService() { m_emojiFont = findEmojiFont(); }
+qint64 FontService::fontconfigCacheKey() {
+  std::vector<fs::path> directories = {"/var/cache/fontconfig", "/usr/lib/fontconfig/cache"};
+  qint64 key = 0;
+
+  directories.emplace_back(
+      (QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + "/fontconfig").toStdString());
+
+  for (const auto &directory : directories) {
+    std::error_code ec;
+    auto time = fs::last_write_time(directory, ec);
+
+    if (ec) continue;
+
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch()).count();
+
+    key = std::max<qint64>(key, seconds);
+  }
+
+  return key;
+}
+
+std::optional<FontService::Catalog> FontService::readCatalogCache(qint64 key) {
+  QFile file(Omnicast::dataDir() / "font-catalog.json");
+
+  if (!file.open(QIODevice::ReadOnly)) return std::nullopt;
+
+  auto json = QJsonDocument::fromJson(file.readAll()).object();
+
+  if (json.value("key").toInteger() != key) return std::nullopt;
+
+  Catalog catalog;
+
+  for (const auto &family : json.value("families").toArray()) {
+    catalog.families << family.toString();
+  }
+
+  for (const auto &value : json.value("writingSystems").toArray()) {
+    auto obj = value.toObject();
+    auto &system = catalog.writingSystems.emplace_back(WritingSystemFamilies{
+        .system = static_cast<QFontDatabase::WritingSystem>(obj.value("system").toInt())});
+
+    for (const auto &family : obj.value("families").toArray()) {
+      system.families << family.toString();
+    }
+  }
+
+  return catalog;
+}
+
+void FontService::writeCatalogCache(const Catalog &catalog, qint64 key) {
+  QJsonObject json;
+  QJsonArray writingSystems;
+
+  for (const auto &[system, families] : catalog.writingSystems) {
+    QJsonObject obj;
+
+    obj["system"] = system;
+    obj["families"] = QJsonArray::fromStringList(families);
+    writingSystems.append(obj);
+  }
+
+  json["key"] = key;
+  json["families"] = QJsonArray::fromStringList(catalog.families);
+  json["writingSystems"] = writingSystems;
+
+  std::error_code ec;
+
+  fs::create_directories(Omnicast::dataDir(), ec);
+
+  QFile file(Omnicast::dataDir() / "font-catalog.json");
+
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+    qWarning() << "Failed to write font catalog cache" << file.errorString();
+    return;
+  }
+
+  file.write(QJsonDocument(json).toJson(QJsonDocument::Compact));
+}
+
+FontService::Catalog FontService::enumerateCatalog() {
+  Catalog catalog;
+
+  catalog.families = QFontDatabase::families();
+
+  for (const auto &system : QFontDatabase::writingSystems()) {
+    catalog.writingSystems.emplace_back(
+        WritingSystemFamilies{.system = system, .families = QFontDatabase::families(system)});
+  }
+
+  return catalog;
+}
+
+FontService::Catalog FontService::loadCatalog() {
+  qint64 key = fontconfigCacheKey();
+
+  if (auto cached = readCatalogCache(key)) return *cached;
+
+  auto catalog = enumerateCatalog();
+
+  writeCatalogCache(catalog, key);
+
+  return catalog;
+}
+
+QStringList FontService::families() const {
+  if (m_catalog) return m_catalog->families;
+
+  return QFontDatabase::families();
+}
+
+const FontService::Catalog *FontService::catalog() const { return m_catalog ? &*m_catalog : nullptr; }
+
+FontService::FontService() {
+  m_emojiFont = findEmojiFont();
+
+  connect(&m_catalogWatcher, &QFutureWatcher<Catalog>::finished, this, [this]() {
+    m_catalog = m_catalogWatcher.result();
+    emit catalogLoaded();
+  });
+
+  // the font database can be queried from any thread
+  m_catalogWatcher.setFuture(
+      TaskScheduler::instance().run(TaskScheduler::Priority::Background, &FontService::loadCatalog));
+}
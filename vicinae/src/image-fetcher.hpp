@@ -1,6 +1,7 @@
 #pragma once
 #include "common.hpp"
 #include "vicinae.hpp"
+#include <algorithm>
 #include <qmetacontainer.h>
 #include <qnetworkaccessmanager.h>
 #include <qnetworkdiskcache.h>
@@ -13,6 +14,19 @@
 #include <qurl.h>
 #include <quuid.h>
 #include <unordered_map>
+#include <vector>
+
+/**
+ * How a fetch uses the disk cache.
+ */
+enum class FetchCachePolicy {
+  // what is cached is used as is, images do not change once they are published
+  PreferCache,
+  // what is cached is revalidated with the server, through If-None-Match/If-Modified-Since
+  Revalidate,
+  // neither read from nor written to the cache, for downloads that would only evict everything else
+  NoCache,
+};
 
 class FetcherWorker : public QObject {
   Q_OBJECT
@@ -22,23 +36,51 @@ class FetcherWorker : public QObject {
   QNetworkAccessManager *m_manager = nullptr;
   QNetworkDiskCache *m_diskCache = nullptr;
 
-  void handleFetchRequest(const QString &id, const QUrl &url) {
+  static QNetworkRequest::CacheLoadControl cacheLoadControl(FetchCachePolicy policy) {
+    switch (policy) {
+    case FetchCachePolicy::Revalidate:
+      return QNetworkRequest::PreferNetwork;
+    case FetchCachePolicy::NoCache:
+      return QNetworkRequest::AlwaysNetwork;
+    default:
+      return QNetworkRequest::PreferCache;
+    }
+  }
+
+  void handleFetchRequest(const QString &id, const QUrl &url, int distance, FetchCachePolicy policy) {
     if (!m_manager) return;
 
     QNetworkRequest req(url);
 
-    req.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::PreferCache);
+    req.setAttribute(QNetworkRequest::CacheLoadControlAttribute, cacheLoadControl(policy));
+    req.setAttribute(QNetworkRequest::CacheSaveControlAttribute, policy != FetchCachePolicy::NoCache);
+    // many images come from the same few hosts, one multiplexed connection serves them all
+    req.setAttribute(QNetworkRequest::Http2AllowedAttribute, true);
+    req.setPriority(distance == 0 ? QNetworkRequest::HighPriority : QNetworkRequest::NormalPriority);
 
     auto reply = m_manager->get(req);
 
     connect(reply, &QNetworkReply::finished, this, [this, id, reply]() {
-      emit fetchFinished(id, reply->readAll());
+      emit fetchFinished(id, reply->readAll(), reply->error() == QNetworkReply::NoError);
       m_replies.erase(id);
     });
 
     m_replies.insert({id, QObjectUniquePtr<QNetworkReply>(reply)});
   }
 
+  void handleAbortRequest(const QString &id) {
+    auto it = m_replies.find(id);
+
+    if (it == m_replies.end()) return;
+
+    auto reply = std::move(it->second);
+
+    m_replies.erase(it);
+    // aborting emits finished, which is not a fetch that completed
+    disconnect(reply.get(), nullptr, this, nullptr);
+    reply->abort();
+  }
+
 public:
   FetcherWorker() {}
 
@@ -53,21 +95,30 @@ public:
     m_manager->setCache(m_diskCache);
 
     connect(this, &FetcherWorker::fetchRequested, this, &FetcherWorker::handleFetchRequest);
+    connect(this, &FetcherWorker::abortRequested, this, &FetcherWorker::handleAbortRequest);
   }
 
 signals:
-  void fetchRequested(const QString &id, const QUrl &url);
+  void fetchRequested(const QString &id, const QUrl &url, int distance, FetchCachePolicy policy);
   void abortRequested(const QString &id);
-  void fetchFinished(const QString &id, const QByteArray &array);
+  void fetchFinished(const QString &id, const QByteArray &array, bool ok);
 };
 
 class FetchReply : public QObject {
   Q_OBJECT
 
   QUrl m_url;
+  bool m_ok = false;
+
+  friend class NetworkFetcher;
 
 public:
   const QUrl &url() const { return m_url; }
+
+  /**
+   * Whether the fetch succeeded, once `finished` is emitted.
+   */
+  bool ok() const { return m_ok; }
   void abort() { emit aborted(); }
 
   FetchReply(const QUrl &url) : m_url(url) {}
@@ -77,56 +128,145 @@ signals:
   void aborted() const;
 };
 
+/**
+ * Fetches urls on a dedicated network thread, a few at a time and nearest to the viewport first.
+ *
+ * Replies asking for an url that is already being fetched share the fetch: a list showing the same
+ * favicon on every row only downloads it once. A fetch is aborted once all of its replies are.
+ *
+ * Everything fetching over http goes through here, so that it shares the connections and the disk cache.
+ */
 class NetworkFetcher : public QObject {
   Q_OBJECT
 
-  size_t m_concurrency = 6;
+  static constexpr size_t MAX_CONCURRENT_FETCHES = 16;
+  // keeps a single slow host from holding every slot while the others wait
+  static constexpr size_t MAX_FETCHES_PER_HOST = 6;
+
   FetcherWorker *m_worker = new FetcherWorker;
   QThread *m_thread = new QThread;
 
-  struct QueuedReply {
-    QString id;
-    FetchReply *reply;
+  struct Fetch {
+    QUrl url;
+    FetchCachePolicy policy;
+    std::vector<FetchReply *> replies;
+    int distance;
+    // ties in distance go to the latest fetch, which is what was scrolled to last
+    size_t sequence;
+    bool started = false;
   };
 
-  std::unordered_map<QString, FetchReply *> m_replies;
-  std::deque<QueuedReply> m_queue;
+  std::unordered_map<QString, Fetch> m_fetches;
+  std::unordered_map<QString, QString> m_fetchIds;
+  std::unordered_map<QString, size_t> m_hostFetches;
+  size_t m_running = 0;
+  size_t m_sequence = 0;
+
+  void release(const Fetch &fetch) {
+    if (fetch.started) {
+      --m_running;
+      if (auto it = m_hostFetches.find(fetch.url.host()); it != m_hostFetches.end() && --it->second == 0) {
+        m_hostFetches.erase(it);
+      }
+    }
 
-  void handleFetchFinished(const QString &id, const QByteArray &data) {
-    if (auto it = m_replies.find(id); it != m_replies.end()) {
-      m_replies.erase(id);
-      emit it->second->finished(data);
+    m_fetchIds.erase(fetchKey(fetch.url, fetch.policy));
+  }
+
+  void detach(const QString &id, const FetchReply *reply) {
+    auto it = m_fetches.find(id);
+
+    if (it == m_fetches.end()) return;
+
+    auto &fetch = it->second;
+
+    std::erase(fetch.replies, reply);
+    if (!fetch.replies.empty()) return;
+    if (fetch.started) { emit abortRequested(id); }
+
+    release(fetch);
+    m_fetches.erase(it);
+    startRequests();
+  }
+
+  static QString fetchKey(const QUrl &url, FetchCachePolicy policy) {
+    return QString("%1|%2").arg(static_cast<int>(policy)).arg(url.toString());
+  }
+
+  void handleFetchFinished(const QString &id, const QByteArray &data, bool ok) {
+    auto it = m_fetches.find(id);
+
+    if (it == m_fetches.end()) return;
+
+    auto replies = std::move(it->second.replies);
+
+    release(it->second);
+    m_fetches.erase(it);
+
+    for (auto reply : replies) {
+      disconnect(reply, nullptr, this, nullptr);
+      reply->m_ok = ok;
+      emit reply->finished(data);
     }
+
     startRequests();
   }
 
-  void startRequests() {
-    while (!m_queue.empty() && m_replies.size() < m_concurrency) {
-      auto queued = m_queue.back();
-      QString id = queued.id;
-      m_queue.pop_back();
+  static bool isBefore(const Fetch &a, const Fetch &b) {
+    if (a.distance != b.distance) return a.distance < b.distance;
+    return a.sequence > b.sequence;
+  }
 
-      emit fetchRequested(id, queued.reply->url());
-      m_replies.insert({id, queued.reply});
+  void startRequests() {
+    while (m_running < MAX_CONCURRENT_FETCHES) {
+      Fetch *next = nullptr;
+      const QString *nextId = nullptr;
+
+      for (auto &[id, fetch] : m_fetches) {
+        if (fetch.started) continue;
+        if (auto it = m_hostFetches.find(fetch.url.host());
+            it != m_hostFetches.end() && it->second >= MAX_FETCHES_PER_HOST) {
+          continue;
+        }
+        if (next && !isBefore(fetch, *next)) continue;
+
+        next = &fetch;
+        nextId = &id;
+      }
+
+      if (!next) break;
+
+      next->started = true;
+      ++m_running;
+      ++m_hostFetches[next->url.host()];
+      emit fetchRequested(*nextId, next->url, next->distance, next->policy);
     }
   }
 
 public:
-  FetchReply *fetch(const QUrl &url) {
-    auto id = QUuid::createUuid().toString(QUuid::WithoutBraces);
+  /**
+   * Fetch `url`, `distance` being how far from the viewport, in pixels, the fetched data is shown.
+   * The reply is owned by the caller.
+   */
+  FetchReply *fetch(const QUrl &url, int distance = 0,
+                    FetchCachePolicy policy = FetchCachePolicy::PreferCache) {
     auto reply = new FetchReply(url);
+    auto [idIt, inserted] = m_fetchIds.try_emplace(fetchKey(url, policy));
 
-    connect(reply, &FetchReply::aborted, this, [this, reply, id]() {
-      if (auto it = std::ranges::find_if(m_queue, [&](auto &&data) { return data.reply == reply; });
-          it != m_queue.end()) {
-        m_queue.erase(it);
-      };
+    if (inserted) {
+      idIt->second = QUuid::createUuid().toString(QUuid::WithoutBraces);
+      m_fetches[idIt->second] =
+          Fetch{.url = url, .policy = policy, .distance = distance, .sequence = m_sequence++};
+    }
 
-      m_replies.erase(id);
-      emit abortRequested(id);
-    });
+    QString id = idIt->second;
+    auto &fetch = m_fetches[id];
 
-    m_queue.emplace_back(QueuedReply{id, reply});
+    fetch.replies.push_back(reply);
+    fetch.distance = std::min(fetch.distance, distance);
+
+    connect(reply, &FetchReply::aborted, this, [this, reply, id]() { detach(id, reply); });
+    connect(reply, &QObject::destroyed, this, [this, reply, id]() { detach(id, reply); });
     startRequests();
 
     return reply;
@@ -134,9 +274,9 @@ public:
 
   NetworkFetcher() {
     connect(this, &NetworkFetcher::fetchRequested, m_worker, &FetcherWorker::fetchRequested);
+    connect(this, &NetworkFetcher::abortRequested, m_worker, &FetcherWorker::abortRequested);
     connect(m_thread, &QThread::started, m_worker, &FetcherWorker::initialize);
     connect(m_worker, &FetcherWorker::fetchFinished, this, &NetworkFetcher::handleFetchFinished);
-    connect(m_worker, &FetcherWorker::abortRequested, this, &NetworkFetcher::abortRequested);
     m_worker->moveToThread(m_thread);
     m_thread->start();
   }
@@ -148,6 +288,6 @@ public:
   }
 
 signals:
-  void fetchRequested(const QString &id, const QUrl &url) const;
-  void abortRequested(const QString &id);
+  void fetchRequested(const QString &id, const QUrl &url, int distance, FetchCachePolicy policy) const;
+  void abortRequested(const QString &id) const;
 };
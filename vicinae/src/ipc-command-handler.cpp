@@ -2,10 +2,17 @@
 #include "common.hpp"
 #include "proto/daemon.pb.h"
 #include <algorithm>
+#include "dmenu/dmenu-session.hpp"
+#include "memory-budget/memory-budget.hpp"
+#include "search-profiler/search-profiler.hpp"
+#include "sql-profiler/sql-profiler.hpp"
+#include "services/clipboard/clipboard-service.hpp"
 #include "services/config/config-service.hpp"
+#include "services/files-service/file-service.hpp"
 #include "services/toast/toast-service.hpp"
 #include "settings-controller/settings-controller.hpp"
 #include "services/extension-registry/extension-registry.hpp"
+#include "services/root-item-manager/root-item-manager.hpp"
 #include <qlogging.h>
 #include <qobjectdefs.h>
 #include "extension/manager/extension-manager.hpp"
@@ -17,8 +24,31 @@
 #include "omni-command-db.hpp"
 #include "command-controller.hpp"
 #include "theme.hpp"
+#include "trace/trace.hpp"
+#include "ui/image/image-cache.hpp"
+#include "ui/performance-hud/performance-hud.hpp"
+#include "ui/text-layout-cache/text-layout-cache.hpp"
 #include "ui/toast/toast.hpp"
 #include "vicinae.hpp"
+#include <format>
+#include <fstream>
+#include <unistd.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+/**
+ * Resident set size of process `pid`, as reported by the kernel.
+ */
+static std::optional<uint64_t> residentSetSize(qint64 pid) {
+  std::ifstream statm(std::format("/proc/{}/statm", pid));
+  uint64_t size = 0;
+  uint64_t resident = 0;
+
+  if (!(statm >> size >> resident)) return std::nullopt;
+
+  return resident * sysconf(_SC_PAGESIZE);
+}
 
 proto::ext::daemon::Response *IpcCommandHandler::handleCommand(const proto::ext::daemon::Request &request) {
   auto res = new proto::ext::daemon::Response;
@@ -30,9 +60,239 @@ proto::ext::daemon::Response *IpcCommandHandler::handleCommand(const proto::ext:
     res->set_allocated_url(new proto::ext::daemon::UrlResponse());
     break;
   }
+  case proto::ext::daemon::Request::kIndexerStats:
+    res->set_allocated_indexer_stats(handleIndexerStats());
+    break;
+  case proto::ext::daemon::Request::kTrace:
+    res->set_allocated_trace(handleTrace(request.trace()));
+    break;
+  case proto::ext::daemon::Request::kMetrics:
+    res->set_allocated_metrics(handleMetrics());
+    break;
+  default:
+    break;
+  }
+
+  return res;
+}
+
+bool IpcCommandHandler::handleSessionCommand(ClientId client, const proto::ext::daemon::Request &request,
+                                             const Reply &reply) {
+  switch (request.payload_case()) {
+  case proto::ext::daemon::Request::kDmenu:
+    handleDmenu(client, request.dmenu(), reply);
+    return true;
+  default:
+    return false;
+  }
+}
+
+void IpcCommandHandler::clientDisconnected(ClientId client) {
+  if (auto it = m_dmenuSessions.find(client); it != m_dmenuSessions.end()) {
+    auto session = it->second;
+
+    // closes the view without replying
+    m_dmenuSessions.erase(it);
+    delete session;
+  }
+}
+
+void IpcCommandHandler::handleDmenu(ClientId client, const proto::ext::daemon::DmenuRequest &request,
+                                    const Reply &reply) {
+  using Dmenu = proto::ext::daemon::DmenuRequest;
+
+  if (request.payload_case() == Dmenu::kOpen) {
+    // a client only gets one session at a time
+    clientDisconnected(client);
+
+    auto placeholder = QString::fromStdString(request.open().placeholder());
+    auto session = new DmenuSession(*m_ctx.navigation, placeholder,
+                                    [reply](const std::optional<QString> &selection) {
+                                      proto::ext::daemon::Response res;
+                                      auto dmenu = res.mutable_dmenu();
+
+                                      if (selection) { dmenu->set_selection(selection->toStdString()); }
+                                      reply(res);
+                                    });
+
+    m_dmenuSessions[client] = session;
+    QObject::connect(session, &DmenuSession::finished, session, [this, client, session]() {
+      if (auto it = m_dmenuSessions.find(client); it != m_dmenuSessions.end() && it->second == session) {
+        m_dmenuSessions.erase(it);
+      }
+      session->deleteLater();
+    });
+    return;
+  }
+
+  auto it = m_dmenuSessions.find(client);
+
+  if (it == m_dmenuSessions.end()) {
+    qWarning() << "dmenu request received without an open session";
+    return;
+  }
+
+  switch (request.payload_case()) {
+  case Dmenu::kLines: {
+    const auto &data = request.lines().data();
+    it->second->appendLines(QByteArray(data.data(), data.size()));
+    break;
+  }
+  case Dmenu::kEnd:
+    it->second->endInput();
+    break;
   default:
     break;
   }
+}
+
+proto::ext::daemon::TraceResponse *
+IpcCommandHandler::handleTrace(const proto::ext::daemon::TraceRequest &req) {
+  auto res = new proto::ext::daemon::TraceResponse;
+  auto &tracer = Tracer::instance();
+
+  if (req.action() == proto::ext::daemon::TraceStart) {
+    qInfo() << "Tracing started";
+    tracer.start();
+    return res;
+  }
+
+  if (auto result = tracer.stop(req.path()); result) {
+    qInfo() << "Tracing stopped," << *result << "events written to" << req.path().c_str();
+    res->set_event_count(*result);
+  } else {
+    res->set_error(result.error().toStdString());
+  }
+
+  return res;
+}
+
+proto::ext::daemon::MetricsResponse *IpcCommandHandler::handleMetrics() {
+  auto res = new proto::ext::daemon::MetricsResponse;
+  auto services = m_ctx.services;
+
+  for (const auto &stats : SearchProfiler::instance().stats()) {
+    auto latency = res->add_search_latencies();
+
+    latency->set_name(stats.path);
+    latency->set_count(stats.latency.count());
+    latency->set_mean_us(stats.latency.mean().count());
+    latency->set_p50_us(stats.latency.percentile(0.5).count());
+    latency->set_p95_us(stats.latency.percentile(0.95).count());
+    latency->set_p99_us(stats.latency.percentile(0.99).count());
+    latency->set_max_us(stats.latency.max().count());
+  }
+
+  for (const auto &stats : SqlProfiler::instance().stats()) {
+    auto latency = res->add_sql_latencies();
+
+    latency->set_name(stats.sql.toStdString());
+    latency->set_count(stats.latency.count());
+    latency->set_mean_us(stats.latency.mean().count());
+    latency->set_p50_us(stats.latency.percentile(0.5).count());
+    latency->set_p95_us(stats.latency.percentile(0.95).count());
+    latency->set_p99_us(stats.latency.percentile(0.99).count());
+    latency->set_max_us(stats.latency.max().count());
+  }
+
+  res->set_root_item_count(services->rootItemManager()->itemCount());
+
+  auto images = ImageCache::instance().stats();
+
+  res->set_image_cache_hits(images.hits);
+  res->set_image_cache_misses(images.misses);
+  res->set_image_cache_count(images.count);
+  res->set_image_cache_bytes(images.bytes);
+
+  auto texts = TextLayoutCache::instance().stats();
+
+  res->set_text_layout_cache_hits(texts.hits);
+  res->set_text_layout_cache_misses(texts.misses);
+  res->set_text_layout_cache_count(texts.count);
+
+  auto clipboard = services->clipman()->stats();
+
+  if (auto count = clipboard.selectionCount) { res->set_clipboard_selection_count(*count); }
+  res->set_clipboard_database_size(clipboard.databaseSize);
+
+  IndexerStats indexer = services->fileService()->stats();
+
+  res->set_indexer_files_per_second(indexer.filesPerSecond);
+  res->set_indexer_walked_file_count(indexer.walkedFileCount);
+  res->set_indexer_database_size(indexer.databaseSize);
+
+  auto manager = services->extensionManager();
+
+  res->set_extension_worker_count(manager->workerCount());
+
+  // subsystems of the daemon share its address space, only the processes it runs are accounted separately
+  auto addResident = [&](const char *subsystem, qint64 pid) {
+    if (auto rss = residentSetSize(pid)) {
+      auto memory = res->add_resident_memory();
+
+      memory->set_subsystem(subsystem);
+      memory->set_bytes(*rss);
+    }
+  };
+
+  addResident("daemon", getpid());
+  if (auto pid = manager->processId()) { addResident("extension manager", *pid); }
+
+#ifdef __GLIBC__
+  res->set_heap_in_use(mallinfo2().uordblks);
+#endif
+
+  for (const auto &usage : MemoryBudget::instance().usage()) {
+    auto memory = res->add_accounted_memory();
+
+    memory->set_subsystem(MemoryBudget::subsystemName(usage.subsystem));
+    memory->set_size(usage.size);
+    memory->set_counts_widgets(MemoryBudget::unit(usage.subsystem) == MemoryBudget::Unit::Widgets);
+    if (usage.budget) { memory->set_budget(*usage.budget); }
+  }
+
+  return res;
+}
+
+proto::ext::daemon::IndexerStatsResponse *IpcCommandHandler::handleIndexerStats() {
+  namespace daemon = proto::ext::daemon;
+
+  auto res = new daemon::IndexerStatsResponse;
+  IndexerStats stats = m_ctx.services->fileService()->stats();
+
+  res->set_files_per_second(stats.filesPerSecond);
+  res->set_walked_file_count(stats.walkedFileCount);
+  res->set_queued_batch_count(stats.queuedBatchCount);
+  res->set_written_batch_count(stats.writtenBatchCount);
+  res->set_last_batch_write_time_us(stats.lastBatchWriteTime.count());
+  res->set_average_batch_write_time_us(stats.averageBatchWriteTime.count());
+  res->set_max_batch_write_time_us(stats.maxBatchWriteTime.count());
+  res->set_backpressure_wait_time_ms(stats.backpressureWaitTime.count());
+  res->set_database_size(stats.databaseSize);
+
+  if (auto count = stats.ftsSegmentCount) { res->set_fts_segment_count(*count); }
+
+  for (const auto &entrypoint : stats.entrypoints) {
+    auto ep = res->add_entrypoints();
+
+    ep->set_root(entrypoint.root.native());
+    ep->set_walked_file_count(entrypoint.walkedFileCount);
+
+    switch (entrypoint.state) {
+    case IndexerStats::Entrypoint::State::Idle:
+      ep->set_state(daemon::Idle);
+      break;
+    case IndexerStats::Entrypoint::State::Queued:
+      ep->set_state(daemon::Queued);
+      break;
+    case IndexerStats::Entrypoint::State::Scanning:
+      ep->set_state(daemon::Scanning);
+      break;
+    }
+
+    if (auto count = entrypoint.expectedFileCount) { ep->set_expected_file_count(*count); }
+    if (auto date = entrypoint.lastScannedAt) { ep->set_last_scanned_at(date->toSecsSinceEpoch()); }
+  }
 
   return res;
 }
@@ -108,6 +368,20 @@ void IpcCommandHandler::handleUrl(const QUrl &url) {
     return;
   }
 
+  if (url.host() == "performance-hud") {
+    auto &monitor = FrameMonitor::instance();
+
+    if (url.path() == "/show") {
+      monitor.setEnabled(true);
+    } else if (url.path() == "/hide") {
+      monitor.setEnabled(false);
+    } else {
+      monitor.setEnabled(!monitor.isEnabled());
+    }
+
+    return;
+  }
+
   if (url.host() == "toast") {
     QString title = query.hasQueryItem("title") ? query.queryItemValue("title") : "Toast";
     m_ctx.services->toastService()->setToast(title, ToastPriority::Info);
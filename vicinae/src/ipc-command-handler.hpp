@@ -2,15 +2,27 @@
 #include "common.hpp"
 #include "ipc-command-server.hpp"
 #include "proto/daemon.pb.h"
+#include <unordered_map>
+
+class DmenuSession;
 
 class IpcCommandHandler : public ICommandHandler {
 
 public:
   proto::ext::daemon::Response *handleCommand(const proto::ext::daemon::Request &message) override;
+  bool handleSessionCommand(ClientId client, const proto::ext::daemon::Request &request,
+                            const Reply &reply) override;
+  void clientDisconnected(ClientId client) override;
   void handleUrl(const QUrl &url);
+  proto::ext::daemon::IndexerStatsResponse *handleIndexerStats();
+  proto::ext::daemon::TraceResponse *handleTrace(const proto::ext::daemon::TraceRequest &req);
+  proto::ext::daemon::MetricsResponse *handleMetrics();
 
   IpcCommandHandler(ApplicationContext &ctx);
 
 private:
+  void handleDmenu(ClientId client, const proto::ext::daemon::DmenuRequest &request, const Reply &reply);
+
   ApplicationContext &m_ctx;
+  std::unordered_map<ClientId, DmenuSession *> m_dmenuSessions;
 };
@@ -1,9 +1,23 @@
 #include "ipc-command-server.hpp"
 #include "proto/daemon.pb.h"
+#include "trace/trace.hpp"
 #include <qlogging.h>
+#include <qpointer.h>
 
-void IpcCommandServer::processFrame(QLocalSocket *conn, QByteArrayView frame) {
+static void writeResponse(QLocalSocket *conn, const proto::ext::daemon::Response &response) {
+  std::string packet;
+
+  response.SerializeToString(&packet);
+
+  // responses are framed the same way requests are
+  uint32_t length = htonl(packet.size());
+
+  conn->write(reinterpret_cast<const char *>(&length), sizeof(length));
+  conn->write(packet.data(), packet.size());
+}
 
+void IpcCommandServer::processFrame(const ClientInfo &client, QByteArrayView frame) {
+  TraceScope trace("ipc", "command");
   proto::ext::daemon::Request req;
 
   req.ParseFromString(frame.toByteArray().toStdString());
@@ -13,11 +27,16 @@ void IpcCommandServer::processFrame(QLocalSocket *conn, QByteArrayView frame) {
     return;
   }
 
-  auto handlerResult = _handler->handleCommand(req);
-  std::string packet;
+  QPointer<QLocalSocket> conn = client.conn;
+  auto reply = [conn](const proto::ext::daemon::Response &response) {
+    if (conn) { writeResponse(conn, response); }
+  };
 
-  handlerResult->SerializeToString(&packet);
-  conn->write(packet.data(), packet.size());
+  if (_handler->handleSessionCommand(client.id, req, reply)) return;
+
+  std::unique_ptr<proto::ext::daemon::Response> handlerResult(_handler->handleCommand(req));
+
+  writeResponse(client.conn, *handlerResult);
 }
 
 void IpcCommandServer::handleRead(QLocalSocket *conn) {
@@ -41,7 +60,7 @@ void IpcCommandServer::handleRead(QLocalSocket *conn) {
 
       auto packet = QByteArrayView(it->frame.data).sliced(sizeof(uint32_t), length);
 
-      processFrame(conn, packet);
+      processFrame(*it, packet);
 
       it->frame.data = it->frame.data.sliced(sizeof(uint32_t) + length);
     }
@@ -52,6 +71,8 @@ void IpcCommandServer::handleDisconnection(QLocalSocket *conn) {
   auto it = std::find_if(_clients.begin(), _clients.end(),
                          [conn](const ClientInfo &info) { return info.conn == conn; });
 
+  if (_handler) { _handler->clientDisconnected(it->id); }
+
   _clients.erase(it);
   conn->deleteLater();
 }
@@ -59,7 +80,7 @@ void IpcCommandServer::handleDisconnection(QLocalSocket *conn) {
 void IpcCommandServer::handleConnection() {
   QLocalSocket *conn = _server->nextPendingConnection();
 
-  _clients.push_back({.conn = conn});
+  _clients.push_back({.id = _nextClientId++, .conn = conn});
   connect(conn, &QLocalSocket::disconnected, this, [this, conn]() { handleDisconnection(conn); });
   connect(conn, &QLocalSocket::readyRead, this, [this, conn]() { handleRead(conn); });
 }
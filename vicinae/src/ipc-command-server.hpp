@@ -2,6 +2,7 @@
 #include "proto/daemon.pb.h"
 #include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <netinet/in.h>
 #include <qbytearrayview.h>
 #include <qcontainerfwd.h>
@@ -22,6 +23,7 @@ struct CommandMessage {
 };
 
 struct ClientInfo {
+  uint64_t id;
   QLocalSocket *conn;
   struct {
     QByteArray data;
@@ -40,15 +42,31 @@ enum CommandResponseStatus {
 
 class ICommandHandler {
 public:
+  using ClientId = uint64_t;
+  using Reply = std::function<void(const proto::ext::daemon::Response &response)>;
+
   virtual proto::ext::daemon::Response *handleCommand(const proto::ext::daemon::Request &request) = 0;
+
+  /**
+   * Commands that span several requests of the same client, and are replied to whenever the handler is done
+   * with them, possibly after the client sent further requests. `reply` is safe to call after the client
+   * went away. Returns false if `request` is not such a command, for `handleCommand` to reply to it at once.
+   */
+  virtual bool handleSessionCommand(ClientId client, const proto::ext::daemon::Request &request,
+                                    const Reply &reply) {
+    return false;
+  }
+
+  virtual void clientDisconnected(ClientId client) {}
 };
 
 class IpcCommandServer : public QObject {
-  ICommandHandler *_handler;
+  ICommandHandler *_handler = nullptr;
   QLocalServer *_server;
   std::vector<ClientInfo> _clients;
+  uint64_t _nextClientId = 0;
 
-  void processFrame(QLocalSocket *conn, QByteArrayView frame);
+  void processFrame(const ClientInfo &client, QByteArrayView frame);
   void handleRead(QLocalSocket *conn);
   void handleDisconnection(QLocalSocket *conn);
   void handleConnection();
@@ -0,0 +1,98 @@
+#include "crypto-benchmark.hpp"
+#include "crypto.hpp"
+#include <chrono>
+#include <iomanip>
+#include <vector>
+
+namespace Crypto::AES256GCM {
+
+using Clock = std::chrono::steady_clock;
+
+// every size is run for at least this long
+static constexpr auto RUN_DURATION = std::chrono::milliseconds(300);
+static constexpr qsizetype SIZES[] = {256, 4 << 10, 64 << 10, 1 << 20, 16 << 20};
+
+static void printCpuFeatures(std::ostream &out) {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+
+  std::pair<const char *, bool> features[] = {
+      {"aes", __builtin_cpu_supports("aes")},
+      {"pclmul", __builtin_cpu_supports("pclmul")},
+      {"avx2", __builtin_cpu_supports("avx2")},
+      {"vaes", __builtin_cpu_supports("vaes")},
+      {"vpclmulqdq", __builtin_cpu_supports("vpclmulqdq")},
+      {"avx512f", __builtin_cpu_supports("avx512f")},
+  };
+
+  out << "CPU features:";
+
+  for (const auto &[name, supported] : features) {
+    out << " " << name << (supported ? "+" : "-");
+  }
+
+  out << std::endl;
+#else
+  out << "CPU features: not detected on this architecture" << std::endl;
+#endif
+}
+
+/**
+ * Messages of `size` bytes processed per second by `run`, which processes one message.
+ */
+template <typename Run> static double messagesPerSecond(Run run) {
+  size_t count = 0;
+  auto start = Clock::now();
+  auto elapsed = Clock::duration::zero();
+
+  do {
+    for (int i = 0; i != 16; ++i) {
+      if (!run()) return 0;
+    }
+
+    count += 16;
+    elapsed = Clock::now() - start;
+  } while (elapsed < RUN_DURATION);
+
+  return count / std::chrono::duration<double>(elapsed).count();
+}
+
+void benchmark(std::ostream &out) {
+  auto key = generateKey();
+  auto engine = Engine::forKey(key);
+
+  printCpuFeatures(out);
+
+  if (!engine) {
+    out << "Failed to set up the engine" << std::endl;
+    return;
+  }
+
+  out << std::fixed << std::setprecision(1);
+
+  for (qsizetype size : SIZES) {
+    QByteArray plaintext(size, 'x');
+    QByteArray encrypted(size + OVERHEAD, Qt::Uninitialized);
+    double mb = size / (1024.0 * 1024.0);
+
+    double encryptions = messagesPerSecond([&]() { return engine->encrypt(plaintext, encrypted.data()); });
+    // not in place, the same ciphertext being decrypted on every run
+    QByteArray decrypted(size, Qt::Uninitialized);
+    double decryptions = messagesPerSecond([&]() { return engine->decrypt(encrypted, decrypted.data()); });
+    // what every message used to cost: a new context, keyed again
+    double fresh = messagesPerSecond([&]() {
+      std::unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(),
+                                                                           EVP_CIPHER_CTX_free);
+      auto raw = reinterpret_cast<const unsigned char *>(key.constData());
+      auto iv = reinterpret_cast<const unsigned char *>(encrypted.constData());
+
+      return ctx && EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_gcm(), nullptr, raw, iv) == 1;
+    });
+
+    out << std::setw(9) << size << " bytes: encrypt " << std::setw(8) << encryptions * mb << " MB/s, decrypt "
+        << std::setw(8) << decryptions * mb << " MB/s, context setup avoided "
+        << 1e6 / fresh << "us per message" << std::endl;
+  }
+}
+
+} // namespace Crypto::AES256GCM
@@ -0,0 +1,16 @@
+#pragma once
+#include <ostream>
+
+namespace Crypto::AES256GCM {
+
+/**
+ * Measure the throughput of `Engine` for messages of a few sizes, along with what setting up a context for
+ * every message (as opposed to reusing a keyed one) costs, and print it to `out` with the AES features of
+ * the CPU.
+ *
+ * Hardware AES runs in the GB/s range where the software fallback stays at about a hundred MB/s. OpenSSL
+ * can be made to ignore AES-NI with `OPENSSL_ia32cap=~0x200000200000000`, to see the difference.
+ */
+void benchmark(std::ostream &out);
+
+} // namespace Crypto::AES256GCM
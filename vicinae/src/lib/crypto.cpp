@@ -1,112 +1,211 @@
 #include "crypto.hpp"
 #include <openssl/rand.h>
 #include <QDebug>
+#include <cstring>
 #include <quuid.h>
 
 namespace Crypto::AES256GCM {
-QByteArray encrypt(const QByteArray &data, const QByteArray &key) {
-  QByteArray iv(12, 0);
+static auto bytes(const char *data) { return reinterpret_cast<const unsigned char *>(data); }
+static auto bytes(char *data) { return reinterpret_cast<unsigned char *>(data); }
 
-  RAND_bytes(reinterpret_cast<unsigned char *>(iv.data()), iv.size());
+Engine *Engine::forKey(const QByteArray &key) {
+  static thread_local Engine engine;
 
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
-  EVP_EncryptInit_ex(ctx, EVP_aes_256_gcm(), nullptr,
-                     reinterpret_cast<const unsigned char *>(key.constData()),
-                     reinterpret_cast<const unsigned char *>(iv.constData()));
+  if (engine.m_key != key && !engine.setKey(key)) return nullptr;
 
-  QByteArray ciphertext(data.size(), 0);
-  int len;
-  if (EVP_EncryptUpdate(ctx, reinterpret_cast<unsigned char *>(ciphertext.data()), &len,
-                        reinterpret_cast<const unsigned char *>(data.constData()), data.size()) != 1) {
-    EVP_CIPHER_CTX_free(ctx);
-    return {};
+  return &engine;
+}
+
+bool Engine::setKey(const QByteArray &key) {
+  m_key.clear();
+
+  if (key.size() != KEY_SIZE) {
+    qWarning() << "Key must be exactly 32 bytes (256 bits)";
+    return false;
   }
 
-  int ciphertext_len = len;
+  if (!m_encryption) m_encryption.reset(EVP_CIPHER_CTX_new());
+  if (!m_decryption) m_decryption.reset(EVP_CIPHER_CTX_new());
+  if (!m_encryption || !m_decryption) return false;
 
-  // Finalize encryption
-  if (EVP_EncryptFinal_ex(ctx, reinterpret_cast<unsigned char *>(ciphertext.data()) + len, &len) != 1) {
-    EVP_CIPHER_CTX_free(ctx);
-    return {};
+  auto cipher = EVP_aes_256_gcm();
+  auto raw = bytes(key.constData());
+
+  // the key is expanded once here, messages only set their IV
+  if (EVP_EncryptInit_ex(m_encryption.get(), cipher, nullptr, raw, nullptr) != 1 ||
+      EVP_DecryptInit_ex(m_decryption.get(), cipher, nullptr, raw, nullptr) != 1) {
+    return false;
   }
-  ciphertext_len += len;
 
-  // Get the authentication tag (16 bytes for GCM)
-  QByteArray tag(16, 0);
-  if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, 16, tag.data()) != 1) {
-    EVP_CIPHER_CTX_free(ctx);
-    return {};
+  m_key = key;
+
+  return true;
+}
+
+bool Engine::beginEncrypt(char *iv) {
+  m_stream = m_encryption.get();
+
+  return RAND_bytes(bytes(iv), IV_SIZE) == 1 &&
+         EVP_EncryptInit_ex(m_stream, nullptr, nullptr, nullptr, bytes(iv)) == 1;
+}
+
+bool Engine::beginDecrypt(const char *iv) {
+  m_stream = m_decryption.get();
+
+  return EVP_DecryptInit_ex(m_stream, nullptr, nullptr, nullptr, bytes(iv)) == 1;
+}
+
+bool Engine::update(const char *in, char *out, qsizetype size) {
+  int len = 0;
+
+  // GCM is a stream cipher mode: the output is exactly as large as the input, and is all written at once
+  for (qsizetype offset = 0; offset < size; offset += CHUNK_SIZE) {
+    int chunk = std::min(CHUNK_SIZE, size - offset);
+
+    if (EVP_CipherUpdate(m_stream, bytes(out + offset), &len, bytes(in + offset), chunk) != 1) return false;
   }
 
-  EVP_CIPHER_CTX_free(ctx);
-  ciphertext.resize(ciphertext_len);
+  return true;
+}
+
+bool Engine::finishEncrypt(char *tag) {
+  // nothing is written by GCM, everything was by `update`
+  unsigned char unused[EVP_MAX_BLOCK_LENGTH];
+  int len = 0;
 
-  // Return format: IV (12) + Ciphertext + Auth Tag (16)
-  return iv + ciphertext + tag;
+  return EVP_EncryptFinal_ex(m_stream, unused, &len) == 1 &&
+         EVP_CIPHER_CTX_ctrl(m_stream, EVP_CTRL_GCM_GET_TAG, TAG_SIZE, tag) == 1;
 }
 
-QByteArray decrypt(const QByteArray &encrypted, const QByteArray &key) {
-  if (key.size() != 32) {
-    qWarning() << "Key must be exactly 32 bytes (256 bits)";
-    return QByteArray();
+bool Engine::finishDecrypt(const char *tag) {
+  unsigned char unused[EVP_MAX_BLOCK_LENGTH];
+  int len = 0;
+
+  if (EVP_CIPHER_CTX_ctrl(m_stream, EVP_CTRL_GCM_SET_TAG, TAG_SIZE, const_cast<char *>(tag)) != 1) {
+    return false;
   }
 
-  if (encrypted.size() < 28) { // IV(12) + tag(16) = minimum 28 bytes
+  if (EVP_DecryptFinal_ex(m_stream, unused, &len) != 1) {
+    qWarning() << "Authentication failed - data may be corrupted";
+    return false;
+  }
+
+  return true;
+}
+
+bool Engine::encrypt(QByteArrayView data, char *out) {
+  char *ciphertext = out + IV_SIZE;
+
+  return beginEncrypt(out) && update(data.constData(), ciphertext, data.size()) &&
+         finishEncrypt(ciphertext + data.size());
+}
+
+bool Engine::decrypt(QByteArrayView encrypted, char *out) {
+  if (encrypted.size() < OVERHEAD) {
     qWarning() << "Encrypted data too short";
-    return QByteArray();
+    return false;
   }
 
-  // Extract components
-  QByteArray iv = encrypted.left(12);
-  QByteArray tag = encrypted.right(16);
-  QByteArray ciphertext = encrypted.mid(12, encrypted.size() - 28);
-
-  // Create cipher context
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
-  if (!ctx) return QByteArray();
-
-  // Initialize decryption
-  if (EVP_DecryptInit_ex(ctx, EVP_aes_256_gcm(), nullptr,
-                         reinterpret_cast<const unsigned char *>(key.constData()),
-                         reinterpret_cast<const unsigned char *>(iv.constData())) != 1) {
-    EVP_CIPHER_CTX_free(ctx);
-    return QByteArray();
+  qsizetype size = encrypted.size() - OVERHEAD;
+  const char *ciphertext = encrypted.constData() + IV_SIZE;
+
+  return beginDecrypt(encrypted.constData()) && update(ciphertext, out, size) &&
+         finishDecrypt(ciphertext + size);
+}
+
+bool Engine::decryptInPlace(QByteArray &data) {
+  char *ciphertext = data.data() + IV_SIZE;
+
+  if (!decrypt(data, ciphertext)) {
+    data.clear();
+    return false;
   }
 
-  // Decrypt
-  QByteArray plaintext(ciphertext.size(), 0);
-  int len;
-  if (EVP_DecryptUpdate(ctx, reinterpret_cast<unsigned char *>(plaintext.data()), &len,
-                        reinterpret_cast<const unsigned char *>(ciphertext.constData()),
-                        ciphertext.size()) != 1) {
-    EVP_CIPHER_CTX_free(ctx);
-    return QByteArray();
+  data.remove(0, IV_SIZE);
+  data.chop(TAG_SIZE);
+
+  return true;
+}
+
+bool encryptTo(QIODevice &device, const QByteArray &data, const QByteArray &key) {
+  auto engine = Engine::forKey(key);
+  // a single chunk is encrypted at a time, large offers would otherwise be held twice in memory
+  QByteArray chunk(std::min(CHUNK_SIZE, std::max<qsizetype>(data.size(), TAG_SIZE)), 0);
+  char iv[IV_SIZE];
+
+  if (!engine || !engine->beginEncrypt(iv)) return false;
+  if (device.write(iv, sizeof(iv)) != sizeof(iv)) return false;
+
+  for (qsizetype offset = 0; offset < data.size(); offset += CHUNK_SIZE) {
+    qsizetype size = std::min(CHUNK_SIZE, data.size() - offset);
+
+    if (!engine->update(data.constData() + offset, chunk.data(), size)) return false;
+    if (device.write(chunk.constData(), size) != size) return false;
   }
 
-  // Set expected tag
-  if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, 16,
-                          const_cast<void *>(reinterpret_cast<const void *>(tag.constData()))) != 1) {
-    EVP_CIPHER_CTX_free(ctx);
-    return QByteArray();
+  if (!engine->finishEncrypt(chunk.data())) return false;
+
+  return device.write(chunk.constData(), TAG_SIZE) == TAG_SIZE;
+}
+
+QByteArray encrypt(const QByteArray &data, const QByteArray &key) {
+  auto engine = Engine::forKey(key);
+  QByteArray encrypted(data.size() + OVERHEAD, Qt::Uninitialized);
+
+  if (!engine || !engine->encrypt(data, encrypted.data())) return {};
+
+  return encrypted;
+}
+
+QByteArray decrypt(const QByteArray &encrypted, const QByteArray &key) {
+  auto engine = Engine::forKey(key);
+
+  if (!engine || encrypted.size() < OVERHEAD) return {};
+
+  QByteArray plaintext(encrypted.size() - OVERHEAD, Qt::Uninitialized);
+
+  if (!engine->decrypt(encrypted, plaintext.data())) return {};
+
+  return plaintext;
+}
+
+QByteArray decryptFrom(QIODevice &device, const QByteArray &key) {
+  auto engine = Engine::forKey(key);
+  qint64 start = device.pos();
+  qint64 size = device.size() - start - OVERHEAD;
+  char iv[IV_SIZE];
+  char tag[TAG_SIZE];
+
+  if (!engine) return {};
+
+  if (size < 0) {
+    qWarning() << "Encrypted data too short";
+    return {};
   }
 
-  // Finalize and verify
-  int plaintext_len = len;
-  if (EVP_DecryptFinal_ex(ctx, reinterpret_cast<unsigned char *>(plaintext.data()) + len, &len) != 1) {
-    EVP_CIPHER_CTX_free(ctx);
-    qWarning() << "Authentication failed - data may be corrupted";
-    return QByteArray();
+  // the tag comes last but is only needed once everything is decrypted
+  if (!device.seek(start + IV_SIZE + size) || device.read(tag, TAG_SIZE) != TAG_SIZE) return {};
+  if (!device.seek(start) || device.read(iv, IV_SIZE) != IV_SIZE) return {};
+
+  QByteArray plaintext(size, Qt::Uninitialized);
+
+  if (!engine->beginDecrypt(iv)) return {};
+
+  // chunks are read into their place in the plaintext and decrypted there
+  for (qint64 offset = 0; offset < size; offset += CHUNK_SIZE) {
+    qint64 chunk = std::min<qint64>(CHUNK_SIZE, size - offset);
+    char *data = plaintext.data() + offset;
+
+    if (device.read(data, chunk) != chunk || !engine->update(data, data, chunk)) return {};
   }
 
-  plaintext_len += len;
-  EVP_CIPHER_CTX_free(ctx);
+  if (!engine->finishDecrypt(tag)) return {};
 
-  plaintext.resize(plaintext_len);
   return plaintext;
 }
 
 QByteArray generateKey() {
-  QByteArray keyData(32, 0);
+  QByteArray keyData(KEY_SIZE, 0);
 
   RAND_bytes(reinterpret_cast<unsigned char *>(keyData.data()), keyData.size());
 
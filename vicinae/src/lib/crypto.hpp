@@ -1,9 +1,94 @@
 #pragma once
 #include <QByteArray>
+#include <QByteArrayView>
+#include <QIODevice>
+#include <memory>
+#include <openssl/evp.h>
 
 namespace Crypto::AES256GCM {
+// size of the chunks `encryptTo` and `decryptFrom` go through at once
+static constexpr qsizetype CHUNK_SIZE = 1 << 16;
+static constexpr qsizetype KEY_SIZE = 32;
+static constexpr qsizetype IV_SIZE = 12;
+static constexpr qsizetype TAG_SIZE = 16;
+// encrypted data is the IV, then the ciphertext, as large as the plaintext, then the authentication tag
+static constexpr qsizetype OVERHEAD = IV_SIZE + TAG_SIZE;
+
+/**
+ * AES-256-GCM contexts of the calling thread, set up for a key once: every message after that only sets a
+ * new IV, skipping the allocation of a context and the expansion of the key. Data is encrypted and
+ * decrypted into buffers of the caller, possibly in place.
+ *
+ * OpenSSL picks the fastest implementation the CPU supports (AES-NI, VAES, ARMv8 crypto extensions), see
+ * `vicinae crypto-bench` for how fast that is on a given machine.
+ */
+class Engine {
+public:
+  /**
+   * Engine of the calling thread, keyed with `key`, or null if `key` is not a valid key. It stays keyed
+   * until it is asked for another key, the pointer is not to be used past that.
+   */
+  static Engine *forKey(const QByteArray &key);
+
+  /**
+   * Encrypt `data` into `out`, which must have room for `data.size() + OVERHEAD` bytes and not overlap
+   * `data`.
+   */
+  bool encrypt(QByteArrayView data, char *out);
+
+  /**
+   * Decrypt and authenticate `encrypted` into `out`, which must have room for `encrypted.size() - OVERHEAD`
+   * bytes. `out` can be the ciphertext itself (`encrypted.data() + IV_SIZE`), but must not overlap it
+   * otherwise.
+   * What was written to `out` is not to be used if this fails.
+   */
+  bool decrypt(QByteArrayView encrypted, char *out);
+
+  /**
+   * Decrypt `data` in place, leaving the plaintext in it, or nothing if it fails.
+   */
+  bool decryptInPlace(QByteArray &data);
+
+  /**
+   * Streaming interface, for data too large to be held more than once: a message is encrypted with
+   * `beginEncrypt`, then `update` for every chunk of it, in order, then `finishEncrypt`, the same goes for
+   * decryption. Chunks can be of any size, and be encrypted or decrypted in place.
+   */
+  bool beginEncrypt(char *iv);
+  bool beginDecrypt(const char *iv);
+  bool update(const char *in, char *out, qsizetype size);
+  bool finishEncrypt(char *tag);
+  bool finishDecrypt(const char *tag);
+
+private:
+  using Context = std::unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)>;
+
+  bool setKey(const QByteArray &key);
+
+  Context m_encryption{nullptr, EVP_CIPHER_CTX_free};
+  Context m_decryption{nullptr, EVP_CIPHER_CTX_free};
+  // the context of the message being streamed
+  EVP_CIPHER_CTX *m_stream = nullptr;
+  QByteArray m_key;
+};
+
 QByteArray encrypt(const QByteArray &dta, const QByteArray &ky);
+
+/**
+ * Encrypt `data` and write the result to `device`, in the same format as `encrypt`. Data is encrypted and
+ * written in chunks of `CHUNK_SIZE`, so memory usage does not depend on the size of `data`.
+ */
+bool encryptTo(QIODevice &device, const QByteArray &data, const QByteArray &key);
+
 QByteArray decrypt(const QByteArray &dta, const QByteArray &ky);
+
+/**
+ * Decrypt the rest of `device`, which must be seekable, as written by `encryptTo`. The data is read in
+ * chunks and decrypted straight into the returned array: the ciphertext is never held as a whole.
+ * Returns an empty array on failure.
+ */
+QByteArray decryptFrom(QIODevice &device, const QByteArray &key);
+
 QByteArray generateKey();
 } // namespace Crypto::AES256GCM
 
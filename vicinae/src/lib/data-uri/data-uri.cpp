@@ -1,7 +1,93 @@
 #include "data-uri.hpp"
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace {
+
+// value of the characters of both the standard and the url safe alphabets, -1 for any other
+constexpr std::array<int8_t, 128> BASE64_VALUES = []() {
+  std::array<int8_t, 128> values;
+  constexpr std::string_view alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+  values.fill(-1);
+
+  for (size_t i = 0; i != alphabet.size(); ++i) {
+    values[alphabet[i]] = i;
+  }
+
+  values['-'] = 62;
+  values['_'] = 63;
+
+  return values;
+}();
+
+int base64Value(char16_t c) { return c < BASE64_VALUES.size() ? BASE64_VALUES[c] : -1; }
+
+/**
+ * Decoded straight from UTF-16, inline images can be large and converting them first would copy them once
+ * more. Characters out of the alphabets, such as whitespace, are skipped and decoding stops at padding.
+ */
+QByteArray decodeBase64(QStringView text) {
+  const char16_t *src = text.utf16();
+  qsizetype size = text.size();
+  qsizetype i = 0;
+  QByteArray data(size / 4 * 3 + 3, Qt::Uninitialized);
+  char *dst = data.data();
+
+  // groups of four characters without anything to skip, which is about all of them
+  for (; i + 4 <= size; i += 4) {
+    int a = base64Value(src[i]);
+    int b = base64Value(src[i + 1]);
+    int c = base64Value(src[i + 2]);
+    int d = base64Value(src[i + 3]);
+
+    if ((a | b | c | d) < 0) break;
+
+    uint32_t group = a << 18 | b << 12 | c << 6 | d;
+
+    dst[0] = group >> 16;
+    dst[1] = group >> 8;
+    dst[2] = group;
+    dst += 3;
+  }
+
+  uint32_t group = 0;
+  int count = 0;
+
+  for (; i < size && src[i] != '='; ++i) {
+    int value = base64Value(src[i]);
+
+    if (value < 0) continue;
+
+    group = group << 6 | value;
+
+    if (++count == 4) {
+      dst[0] = group >> 16;
+      dst[1] = group >> 8;
+      dst[2] = group;
+      dst += 3;
+      group = 0;
+      count = 0;
+    }
+  }
+
+  if (count == 2) {
+    *dst++ = group >> 4;
+  } else if (count == 3) {
+    *dst++ = group >> 10;
+    *dst++ = group >> 2;
+  }
+
+  data.truncate(dst - data.data());
+
+  return data;
+}
+
+} // namespace
 
 QByteArray DataUri::decodeContent() const {
-  if (m_base64) return QByteArray::fromBase64(m_content.toUtf8(), QByteArray::Base64UrlEncoding);
+  if (m_base64) return decodeBase64(m_content);
   return QByteArray::fromPercentEncoding(m_content.toUtf8());
 }
 
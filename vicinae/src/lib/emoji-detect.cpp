@@ -1,26 +1,191 @@
 #include "lib/emoji-detect.hpp"
-#include <QList>
-#include <qdebug.h>
-
-static bool isEmojiCodePoint(uint codePoint) {
-
-  if ((codePoint >= 0x1F600 && codePoint <= 0x1F64F) || // Emoticons
-      (codePoint >= 0x1F300 && codePoint <= 0x1F5FF) || // Miscellaneous symbols and pictographs
-      (codePoint >= 0x1F680 && codePoint <= 0x1F6FF) || // Transport and map symbols
-      (codePoint >= 0x2600 && codePoint <= 0x26FF) ||   // Miscellaneous symbols
-      (codePoint >= 0x2700 && codePoint <= 0x27BF) ||   // Dingbats
-      (codePoint >= 0x1F900 && codePoint <= 0x1F9FF) || // Supplemental symbols and pictographs
-      (codePoint >= 0x1F1E6 && codePoint <= 0x1F1FF)) { // Regional indicator symbols (flags)
-    return true;
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace {
+
+struct CodePointRange {
+  char32_t first;
+  char32_t last;
+};
+
+// code points that are emojis on their own (Extended_Pictographic, modifiers and regional indicators)
+constexpr CodePointRange EMOJI_RANGES[] = {
+    {0x00A9, 0x00A9},   {0x00AE, 0x00AE},   {0x203C, 0x203C},   {0x2049, 0x2049},   {0x2122, 0x2122},
+    {0x2139, 0x2139},   {0x2194, 0x2199},   {0x21A9, 0x21AA},   {0x231A, 0x231B},   {0x2328, 0x2328},
+    {0x23CF, 0x23CF},   {0x23E9, 0x23F3},   {0x23F8, 0x23FA},   {0x24C2, 0x24C2},   {0x25AA, 0x25AB},
+    {0x25B6, 0x25B6},   {0x25C0, 0x25C0},   {0x25FB, 0x25FE},   {0x2600, 0x27BF},   {0x2934, 0x2935},
+    {0x2B05, 0x2B07},   {0x2B1B, 0x2B1C},   {0x2B50, 0x2B50},   {0x2B55, 0x2B55},   {0x3030, 0x3030},
+    {0x303D, 0x303D},   {0x3297, 0x3297},   {0x3299, 0x3299},   {0x1F004, 0x1F004}, {0x1F0CF, 0x1F0CF},
+    {0x1F170, 0x1F171}, {0x1F17E, 0x1F17F}, {0x1F18E, 0x1F18E}, {0x1F191, 0x1F19A}, {0x1F1E6, 0x1F1FF},
+    {0x1F201, 0x1F202}, {0x1F21A, 0x1F21A}, {0x1F22F, 0x1F22F}, {0x1F232, 0x1F23A}, {0x1F250, 0x1F251},
+    {0x1F300, 0x1F64F}, {0x1F680, 0x1F6FF}, {0x1F7E0, 0x1F7EB}, {0x1F7F0, 0x1F7F0}, {0x1F90C, 0x1F9FF},
+    {0x1FA70, 0x1FAFF},
+};
+
+constexpr char32_t ZERO_WIDTH_JOINER = 0x200D;
+constexpr char32_t TEXT_PRESENTATION_SELECTOR = 0xFE0E;
+constexpr char32_t EMOJI_PRESENTATION_SELECTOR = 0xFE0F;
+constexpr char32_t COMBINING_KEYCAP = 0x20E3;
+constexpr char32_t TAG_FIRST = 0xE0020;
+constexpr char32_t TAG_LAST = 0xE007F;
+constexpr char32_t INVALID_CODE_POINT = 0xFFFD;
+
+/**
+ * Two-level bitmap of the emoji code points: code points are split in blocks of `BLOCK_SIZE`, each block
+ * pointing to a bitmap. Most blocks have no emoji and share the empty bitmap, as all the blocks full of
+ * emojis share theirs, which keeps the table small enough to stay in cache.
+ */
+struct EmojiTable {
+  static constexpr char32_t LIMIT = 0x20000;
+  static constexpr size_t BLOCK_SIZE = 256;
+  static constexpr size_t BLOCK_COUNT = LIMIT / BLOCK_SIZE;
+  static constexpr size_t MAX_BITMAPS = 32;
+
+  using Bitmap = std::array<uint64_t, BLOCK_SIZE / 64>;
+
+  std::array<uint8_t, BLOCK_COUNT> blocks{};
+  // the first one is the empty bitmap
+  std::array<Bitmap, MAX_BITMAPS> bitmaps{};
+  size_t bitmapCount = 1;
+
+  constexpr bool contains(char32_t cp) const {
+    if (cp >= LIMIT) return false;
+
+    const auto &bitmap = bitmaps[blocks[cp / BLOCK_SIZE]];
+    size_t bit = cp % BLOCK_SIZE;
+
+    return bitmap[bit / 64] & (uint64_t(1) << (bit % 64));
+  }
+};
+
+constexpr EmojiTable buildEmojiTable() {
+  EmojiTable table;
+
+  for (size_t block = 0; block != EmojiTable::BLOCK_COUNT; ++block) {
+    char32_t first = block * EmojiTable::BLOCK_SIZE;
+    char32_t last = first + EmojiTable::BLOCK_SIZE - 1;
+    EmojiTable::Bitmap bitmap{};
+    bool empty = true;
+
+    for (const auto &range : EMOJI_RANGES) {
+      for (char32_t cp = std::max(range.first, first); cp <= std::min(range.last, last); ++cp) {
+        size_t bit = cp - first;
+
+        bitmap[bit / 64] |= uint64_t(1) << (bit % 64);
+        empty = false;
+      }
+    }
+
+    if (empty) continue;
+
+    size_t idx = 1;
+
+    while (idx != table.bitmapCount && table.bitmaps[idx] != bitmap) {
+      ++idx;
+    }
+
+    // running out of bitmaps indexes past the array, which fails the build
+    if (idx == table.bitmapCount) { table.bitmaps[table.bitmapCount++] = bitmap; }
+
+    table.blocks[block] = idx;
+  }
+
+  return table;
+}
+
+constexpr EmojiTable EMOJI_TABLE = buildEmojiTable();
+
+static_assert(EMOJI_TABLE.contains(0x1F600) && EMOJI_TABLE.contains(0x2764) && !EMOJI_TABLE.contains('a'));
+
+/**
+ * Decodes the UTF-16 code units of a string one code point at a time.
+ */
+class CodePointReader {
+  QStringView m_str;
+  qsizetype m_pos = 0;
+
+public:
+  bool atEnd() const { return m_pos == m_str.size(); }
+
+  char32_t peek() const {
+    char16_t high = m_str[m_pos].unicode();
+
+    if (!QChar::isSurrogate(high)) return high;
+    if (!QChar::isHighSurrogate(high) || m_pos + 1 == m_str.size()) return INVALID_CODE_POINT;
+
+    char16_t low = m_str[m_pos + 1].unicode();
+
+    if (!QChar::isLowSurrogate(low)) return INVALID_CODE_POINT;
+
+    return QChar::surrogateToUcs4(high, low);
+  }
+
+  char32_t next() {
+    char32_t cp = peek();
+
+    m_pos += cp > 0xFFFF ? 2 : 1;
+
+    return cp;
+  }
+
+  CodePointReader(QStringView str) : m_str(str) {}
+};
+
+bool isKeycapBase(char32_t cp) { return (cp >= '0' && cp <= '9') || cp == '#' || cp == '*'; }
+
+bool isTag(char32_t cp) { return cp >= TAG_FIRST && cp <= TAG_LAST; }
+
+} // namespace
+
+bool isEmoji(QStringView str) {
+  CodePointReader reader(str);
+  // whether the last code point was an emoji, which is what modifiers, selectors and joiners apply onto
+  bool afterEmoji = false;
+
+  while (!reader.atEnd()) {
+    char32_t cp = reader.next();
+
+    if (EMOJI_TABLE.contains(cp)) {
+      afterEmoji = true;
+      continue;
+    }
+
+    // keycaps are plain ASCII characters: only an emoji when followed by the keycap
+    if (isKeycapBase(cp)) {
+      if (!reader.atEnd() && reader.peek() == EMOJI_PRESENTATION_SELECTOR) { reader.next(); }
+      if (reader.atEnd() || reader.next() != COMBINING_KEYCAP) return false;
+
+      afterEmoji = true;
+      continue;
+    }
+
+    if (!afterEmoji) return false;
+
+    if (cp == ZERO_WIDTH_JOINER) {
+      afterEmoji = false;
+      continue;
+    }
+
+    bool isSequencePart = cp == EMOJI_PRESENTATION_SELECTOR || cp == TEXT_PRESENTATION_SELECTOR ||
+                          cp == COMBINING_KEYCAP || isTag(cp);
+
+    if (!isSequencePart) return false;
   }
 
-  return false;
+  // empty strings and dangling joiners are not emojis
+  return afterEmoji;
 }
 
-bool isEmoji(const QString &emoji) {
-  for (const auto &c : emoji.toUcs4()) {
-    if (!isEmojiCodePoint(c)) { return false; }
+std::vector<bool> classifyEmojis(std::span<const QString> strings) {
+  std::vector<bool> emojis;
+
+  emojis.reserve(strings.size());
+
+  for (const auto &str : strings) {
+    emojis.push_back(isEmoji(str));
   }
 
-  return true;
+  return emojis;
 }
@@ -0,0 +1,54 @@
+#pragma once
+#include <qstring.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Remembers the candidates that matched the last search query.
+ *
+ * When the user keeps typing, the new query usually extends the previous one ("fir" -> "fire"),
+ * in which case only the items that matched the previous query can still match: there is no
+ * need to filter the full data set again.
+ *
+ * This only holds for filters that are monotonic with regards to the query, i.e an item that does
+ * not match a query can't match a longer version of it (substring and prefix matching are).
+ *
+ * The owner is responsible for calling `invalidate` whenever the underlying data set changes.
+ */
+template <typename T> class IncrementalSearchCache {
+  QString m_query;
+  std::vector<T> m_candidates;
+  bool m_valid = false;
+  uint64_t m_generation = 0;
+
+public:
+  /**
+   * The candidates to look at for `query`, or nullptr if the full set needs to be searched.
+   */
+  const std::vector<T> *candidates(const QString &query) const {
+    if (!m_valid || !query.startsWith(m_query, Qt::CaseInsensitive)) return nullptr;
+
+    return &m_candidates;
+  }
+
+  void update(const QString &query, std::vector<T> candidates) {
+    m_query = query;
+    m_candidates = std::move(candidates);
+    m_valid = true;
+  }
+
+  void invalidate() {
+    ++m_generation;
+    m_valid = false;
+    m_query.clear();
+    m_candidates.clear();
+  }
+
+  bool isValid() const { return m_valid; }
+
+  /**
+   * Incremented every time the cache is invalidated. Allows results computed asynchronously
+   * to be discarded if the data set changed in the meantime.
+   */
+  uint64_t generation() const { return m_generation; }
+};
@@ -0,0 +1,90 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Difference between two sequences of keyed elements, such as the items of a list before and after it is
+ * rendered again, computed the way React reconciles keyed children.
+ *
+ * Elements are matched by key. Among the matched ones, the longest subsequence that kept its relative order
+ * is considered to stay in place and only the others to have moved, so that moving a single element does not
+ * look like every element after it moved.
+ *
+ * Keys are expected to be unique: an element whose key was already seen is treated as a new one.
+ */
+struct KeyedDiff {
+  static constexpr size_t npos = -1;
+
+  // for each previous element, index of the next element it matched, or npos if it was removed
+  std::vector<size_t> nextIndex;
+  // for each next element, index of the previous element it matched, or npos if it was inserted
+  std::vector<size_t> previousIndex;
+  // next elements that matched a previous one but did not keep their relative order, in order
+  std::vector<size_t> moved;
+  size_t insertedCount = 0;
+  size_t removedCount = 0;
+
+  bool unchanged() const { return insertedCount == 0 && removedCount == 0 && moved.empty(); }
+
+  template <typename Key>
+  static KeyedDiff compute(const std::vector<Key> &previous, const std::vector<Key> &next) {
+    KeyedDiff diff;
+    std::unordered_map<Key, size_t> indices;
+
+    diff.nextIndex.assign(previous.size(), npos);
+    diff.previousIndex.assign(next.size(), npos);
+    indices.reserve(previous.size());
+
+    for (size_t i = 0; i != previous.size(); ++i) {
+      indices.try_emplace(previous[i], i);
+    }
+
+    for (size_t i = 0; i != next.size(); ++i) {
+      auto it = indices.find(next[i]);
+
+      if (it == indices.end()) {
+        ++diff.insertedCount;
+        continue;
+      }
+
+      diff.previousIndex[i] = it->second;
+      diff.nextIndex[it->second] = i;
+      indices.erase(it);
+    }
+
+    diff.removedCount = std::ranges::count(diff.nextIndex, npos);
+
+    // longest increasing subsequence of the previous indices, in O(N log N): tails[n] is the element
+    // ending the increasing subsequence of length n + 1 that has the lowest previous index
+    std::vector<size_t> tails;
+    std::vector<size_t> parents(next.size(), npos);
+    std::vector<bool> stable(next.size(), false);
+    auto previousIndexOf = [&](size_t index) { return diff.previousIndex[index]; };
+
+    for (size_t i = 0; i != next.size(); ++i) {
+      if (diff.previousIndex[i] == npos) continue;
+
+      auto tail = std::ranges::lower_bound(tails, diff.previousIndex[i], {}, previousIndexOf);
+
+      if (tail != tails.begin()) { parents[i] = *(tail - 1); }
+
+      if (tail == tails.end()) {
+        tails.push_back(i);
+      } else {
+        *tail = i;
+      }
+    }
+
+    for (size_t i = tails.empty() ? npos : tails.back(); i != npos; i = parents[i]) {
+      stable[i] = true;
+    }
+
+    for (size_t i = 0; i != next.size(); ++i) {
+      if (diff.previousIndex[i] != npos && !stable[i]) { diff.moved.push_back(i); }
+    }
+
+    return diff;
+  }
+};
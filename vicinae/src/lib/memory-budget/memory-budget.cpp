@@ -0,0 +1,104 @@
+#include "memory-budget/memory-budget.hpp"
+#include <qlogging.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+MemoryBudget &MemoryBudget::instance() {
+  static MemoryBudget budget;
+
+  return budget;
+}
+
+const char *MemoryBudget::subsystemName(Subsystem subsystem) {
+  switch (subsystem) {
+  case Subsystem::ImageCache:
+    return "image cache";
+  case Subsystem::FaviconCache:
+    return "favicon cache";
+  case Subsystem::ListWidgetPools:
+    return "list widget pools";
+  case Subsystem::EmojiIndex:
+    return "emoji index";
+  case Subsystem::RootSearchIndex:
+    return "root search index";
+  }
+
+  return "unknown";
+}
+
+MemoryBudget::Unit MemoryBudget::unit(Subsystem subsystem) {
+  return subsystem == Subsystem::ListWidgetPools ? Unit::Widgets : Unit::Bytes;
+}
+
+MemoryBudget::Handle MemoryBudget::add(Consumer consumer) {
+  auto handle = m_nextHandle++;
+
+  m_consumers.emplace(handle, std::move(consumer));
+
+  return handle;
+}
+
+void MemoryBudget::remove(Handle handle) { m_consumers.erase(handle); }
+
+void MemoryBudget::setBudget(Subsystem subsystem, std::optional<size_t> budget) {
+  m_budgets[static_cast<size_t>(subsystem)] = budget;
+}
+
+void MemoryBudget::setTrimDelay(std::chrono::milliseconds delay) { m_trimTimer->setInterval(delay); }
+
+void MemoryBudget::setWindowVisible(bool visible) {
+  if (visible) {
+    m_trimTimer->stop();
+  } else {
+    m_trimTimer->start();
+  }
+}
+
+std::vector<MemoryBudget::Usage> MemoryBudget::usage() const {
+  std::vector<Usage> usage;
+
+  for (size_t i = 0; i != SUBSYSTEM_COUNT; ++i) {
+    usage.push_back({.subsystem = static_cast<Subsystem>(i), .budget = m_budgets[i]});
+  }
+
+  for (const auto &[handle, consumer] : m_consumers) {
+    usage[static_cast<size_t>(consumer.subsystem)].size += consumer.usage();
+  }
+
+  return usage;
+}
+
+void MemoryBudget::enterIdle() {
+  qDebug() << "Launcher hidden for a while, releasing memory";
+  emit idle();
+  // once the objects released by the idle handlers with deleteLater are actually deleted
+  QMetaObject::invokeMethod(this, &MemoryBudget::trim, Qt::QueuedConnection);
+}
+
+void MemoryBudget::trim() {
+  for (const auto &usage : usage()) {
+    if (!usage.budget || usage.size <= *usage.budget) continue;
+
+    for (const auto &[handle, consumer] : m_consumers) {
+      if (consumer.subsystem == usage.subsystem && consumer.trim) { consumer.trim(*usage.budget); }
+    }
+
+    qDebug() << "Trimmed" << subsystemName(usage.subsystem) << "from" << usage.size << "down to a budget of"
+             << *usage.budget;
+  }
+
+#ifdef __GLIBC__
+  // freed memory otherwise stays mapped in the arenas of the allocator
+  malloc_trim(0);
+#endif
+}
+
+MemoryBudget::MemoryBudget() {
+  setBudget(Subsystem::ImageCache, 16 * 1024 * 1024);
+  setBudget(Subsystem::FaviconCache, 2 * 1024 * 1024);
+  setBudget(Subsystem::ListWidgetPools, 0);
+  m_trimTimer->setSingleShot(true);
+  m_trimTimer->setInterval(DEFAULT_TRIM_DELAY);
+  connect(m_trimTimer, &QTimer::timeout, this, &MemoryBudget::enterIdle);
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <QObject>
+#include <QTimer>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <vector>
+
+/**
+ * Memory held by the big consumers of the daemon, which is left running for weeks: caches that only ever
+ * grow up to their hard limit, and widgets kept around to be reused.
+ *
+ * Every subsystem can be given a budget. Once the launcher has been hidden for `trimDelay`, the daemon goes
+ * idle: `idle` is emitted for what is not accounted here (views, database page caches) to be released, then
+ * the subsystems going over their budget are trimmed down to it and the heap memory freed in the process
+ * is returned to the system. Consumers of a subsystem share its budget, and are all trimmed when their
+ * total goes over it.
+ *
+ * Only meant to be used from the main thread.
+ */
+class MemoryBudget : public QObject {
+  Q_OBJECT
+
+public:
+  enum class Subsystem { ImageCache, FaviconCache, ListWidgetPools, EmojiIndex, RootSearchIndex };
+  // widget pools are accounted in widgets, everything else in bytes
+  enum class Unit { Bytes, Widgets };
+
+  static constexpr size_t SUBSYSTEM_COUNT = 5;
+  static constexpr auto DEFAULT_TRIM_DELAY = std::chrono::seconds(60);
+
+  struct Consumer {
+    Subsystem subsystem;
+    std::function<size_t()> usage;
+    // release what can be released for the usage to fit in `budget`, if anything can be
+    std::function<void(size_t budget)> trim;
+  };
+
+  struct Usage {
+    Subsystem subsystem;
+    size_t size = 0;
+    std::optional<size_t> budget;
+  };
+
+  using Handle = uint64_t;
+
+  static MemoryBudget &instance();
+
+  static const char *subsystemName(Subsystem subsystem);
+  static Unit unit(Subsystem subsystem);
+
+  /**
+   * Consumers owned by services are expected to be added for the lifetime of the process, others to be
+   * removed before they are destroyed.
+   */
+  Handle add(Consumer consumer);
+  void remove(Handle handle);
+
+  void setBudget(Subsystem subsystem, std::optional<size_t> budget);
+  void setTrimDelay(std::chrono::milliseconds delay);
+
+  /**
+   * Going idle is scheduled once the launcher window is hidden, and cancelled if it is shown again.
+   */
+  void setWindowVisible(bool visible);
+
+  std::vector<Usage> usage() const;
+
+  /**
+   * Trim the subsystems that go over their budget, returning the freed heap memory to the system.
+   */
+  void trim();
+
+private:
+  MemoryBudget();
+
+  void enterIdle();
+
+  std::map<Handle, Consumer> m_consumers;
+  std::array<std::optional<size_t>, SUBSYSTEM_COUNT> m_budgets;
+  Handle m_nextHandle = 1;
+  QTimer *m_trimTimer = new QTimer(this);
+
+signals:
+  void idle() const;
+};
@@ -1,47 +1,161 @@
 #include "program-db/program-db.hpp"
+#include "task-scheduler/task-scheduler.hpp"
 #include "vicinae.hpp"
+#include "rapidfuzz/fuzz.hpp"
 #include <filesystem>
 #include <qnamespace.h>
-#include <QtConcurrent/QtConcurrent>
 #include <ranges>
 
 namespace fs = std::filesystem;
 
+ProgramDb &ProgramDb::instance() {
+  static ProgramDb db;
+
+  return db;
+}
+
 ProgramDb::ProgramDb() {
+  m_rescanTimer->setSingleShot(true);
+  m_rescanTimer->setInterval(RESCAN_DEBOUNCE_MS);
+
   connect(m_watcher, &Watcher::finished, this, [this]() {
     if (m_watcher->isCanceled()) { return; }
 
-    m_progs = m_watcher->result();
+    merge(m_watcher->result(), m_fullScan);
     emit backgroundScanFinished();
   });
+
+  // installing a package usually touches a directory many times in a row
+  connect(m_fsWatcher, &QFileSystemWatcher::directoryChanged, this, [this](const QString &path) {
+    m_dirtyDirectories.insert(path.toStdString());
+    m_rescanTimer->start();
+  });
+  connect(m_rescanTimer, &QTimer::timeout, this, &ProgramDb::rescanDirtyDirectories);
 }
 
 std::vector<fs::path> ProgramDb::search(const QString &query, int limit) const {
-  // simple for now, we will optimize if needed
+  if (query.isEmpty()) { return m_progs | std::views::take(limit) | std::ranges::to<std::vector>(); }
 
-  auto filter = [&](const fs::path &path) {
-    return QString(path.filename().c_str()).contains(query, Qt::CaseInsensitive);
-  };
+  std::string folded = query.toCaseFolded().toStdString();
+  auto startsWith = [&](const Program &program) { return program.name.starts_with(folded); };
+  std::vector<const Program *> matches;
 
-  return m_progs | std::views::filter(filter) | std::views::take(limit) | std::ranges::to<std::vector>();
+  // the index is sorted by name, programs starting with the query are next to each other
+  auto first = std::ranges::lower_bound(m_index, folded, {}, &Program::name);
+  auto last = std::find_if_not(first, m_index.end(), startsWith);
+
+  for (auto it = first; it != last; ++it) {
+    matches.emplace_back(&*it);
+  }
+
+  std::ranges::stable_sort(matches, {}, [](const Program *program) { return program->name.size(); });
+
+  if (matches.size() > static_cast<size_t>(limit)) { matches.resize(limit); }
+
+  for (const auto &program : m_index) {
+    if (matches.size() >= static_cast<size_t>(limit)) break;
+    if (!startsWith(program) && program.name.find(folded) != std::string::npos) {
+      matches.emplace_back(&program);
+    }
+  }
+
+  // a single character fuzzily matches about everything
+  if (matches.size() < static_cast<size_t>(limit) && folded.size() > 1) {
+    rapidfuzz::fuzz::CachedPartialRatio<char> scorer(folded);
+    std::vector<std::pair<double, const Program *>> fuzzy;
+
+    for (const auto &program : m_index) {
+      if (program.name.find(folded) != std::string::npos) continue;
+      if (double score = scorer.similarity(program.name, FUZZY_SCORE_CUTOFF); score >= FUZZY_SCORE_CUTOFF) {
+        fuzzy.emplace_back(score, &program);
+      }
+    }
+
+    std::ranges::stable_sort(fuzzy, std::greater{}, &std::pair<double, const Program *>::first);
+
+    for (const auto &[score, program] : fuzzy) {
+      if (matches.size() >= static_cast<size_t>(limit)) break;
+      matches.emplace_back(program);
+    }
+  }
+
+  return matches | std::views::transform([](const Program *program) { return program->path; }) |
+         std::ranges::to<std::vector>();
 }
 
-void ProgramDb::scanSync() { m_progs = scan(); }
+void ProgramDb::scanSync() { merge(scan(Omnicast::systemPaths()), true); }
 
-void ProgramDb::backgroundScan() { m_watcher->setFuture(QtConcurrent::run(&ProgramDb::scan)); }
+void ProgramDb::backgroundScan() { startScan(Omnicast::systemPaths(), true); }
+
+bool ProgramDb::isScanned() const { return m_scanned; }
 
 const std::vector<std::filesystem::path> &ProgramDb::programs() const { return m_progs; }
 
-std::vector<fs::path> ProgramDb::scan() {
-  std::vector<fs::path> results;
+void ProgramDb::startScan(const std::vector<fs::path> &directories, bool full) {
+  m_fullScan = full;
+  m_watcher->setFuture(TaskScheduler::instance().run(TaskScheduler::Priority::Background,
+                                                     [directories]() { return scan(directories); }));
+}
 
-  results.reserve(1000);
+void ProgramDb::rescanDirtyDirectories() {
+  // the running scan may have read the directories before they changed, they are scanned once it is done
+  if (m_watcher->isRunning()) { return m_rescanTimer->start(); }
 
-  for (const auto &path : Omnicast::systemPaths()) {
+  if (m_dirtyDirectories.empty()) return;
+
+  startScan(m_dirtyDirectories | std::ranges::to<std::vector>(), false);
+  m_dirtyDirectories.clear();
+}
+
+void ProgramDb::merge(std::vector<DirectoryPrograms> scanned, bool full) {
+  if (full) {
+    m_directories = std::move(scanned);
+  } else {
+    for (auto &directory : scanned) {
+      auto it = std::ranges::find(m_directories, directory.first, &DirectoryPrograms::first);
+
+      if (it != m_directories.end()) { it->second = std::move(directory.second); }
+    }
+  }
+
+  m_progs.clear();
+  m_index.clear();
+
+  for (const auto &[directory, programs] : m_directories) {
+    for (const auto &program : programs) {
+      m_progs.emplace_back(program.path);
+      m_index.emplace_back(program);
+    }
+  }
+
+  std::ranges::stable_sort(m_index, {}, &Program::name);
+
+  if (full) {
+    if (auto watched = m_fsWatcher->directories(); !watched.isEmpty()) { m_fsWatcher->removePaths(watched); }
+
+    for (const auto &[directory, programs] : m_directories) {
+      std::error_code ec;
+
+      if (fs::is_directory(directory, ec)) { m_fsWatcher->addPath(directory.c_str()); }
+    }
+  }
+
+  m_scanned = true;
+}
+
+std::vector<ProgramDb::DirectoryPrograms> ProgramDb::scan(const std::vector<fs::path> &directories) {
+  std::vector<DirectoryPrograms> results;
+
+  results.reserve(directories.size());
+
+  for (const auto &path : directories) {
+    auto &[directory, programs] = results.emplace_back(path, std::vector<Program>{});
     std::error_code ec;
 
     for (const auto &entry : fs::directory_iterator(path, ec)) {
-      results.emplace_back(entry.path());
+      auto name = QString::fromStdString(entry.path().filename().string()).toCaseFolded().toStdString();
+
+      programs.emplace_back(Program{.name = std::move(name), .path = entry.path()});
     }
   }
 
@@ -1,17 +1,39 @@
 #pragma once
+#include <qfilesystemwatcher.h>
 #include <qfuturewatcher.h>
 #include <qobject.h>
 #include <filesystem>
+#include <qtimer.h>
 #include <qtmetamacros.h>
+#include <set>
 
+/**
+ * Executables found in the directories of $PATH, shared by everything that needs to search them.
+ *
+ * Program names are case folded once when they are scanned and kept sorted, so that searching does not
+ * convert every path to a QString and prefix matches are a binary search away. Directories are watched
+ * once scanned: a change only has the directory it happened in scanned again.
+ */
 class ProgramDb : public QObject {
 
 public:
   using PathList = std::vector<std::filesystem::path>;
 
+  static ProgramDb &instance();
+
   void scanSync();
   void backgroundScan();
-  PathList search(const QString &programs, int limit = 50) const;
+
+  /**
+   * Whether programs were scanned at least once. The database is kept up to date from then on.
+   */
+  bool isScanned() const;
+
+  /**
+   * Programs whose name starts with `query` first, shortest names first, then programs whose name
+   * contains it and finally programs whose name fuzzily matches it.
+   */
+  PathList search(const QString &query, int limit = 50) const;
   const PathList &programs() const;
 
   ProgramDb();
@@ -19,11 +41,34 @@ public:
 private:
   Q_OBJECT
 
-  static std::vector<std::filesystem::path> scan();
-  using Watcher = QFutureWatcher<PathList>;
+  static constexpr int RESCAN_DEBOUNCE_MS = 500;
+  static constexpr double FUZZY_SCORE_CUTOFF = 70;
+
+  struct Program {
+    std::string name; // case folded file name
+    std::filesystem::path path;
+  };
+
+  using DirectoryPrograms = std::pair<std::filesystem::path, std::vector<Program>>;
+  using Watcher = QFutureWatcher<std::vector<DirectoryPrograms>>;
+
+  static std::vector<DirectoryPrograms> scan(const std::vector<std::filesystem::path> &directories);
+
+  void startScan(const std::vector<std::filesystem::path> &directories, bool full);
+  void merge(std::vector<DirectoryPrograms> scanned, bool full);
+  void rescanDirtyDirectories();
 
   Watcher *m_watcher = new Watcher(this);
+  QFileSystemWatcher *m_fsWatcher = new QFileSystemWatcher(this);
+  QTimer *m_rescanTimer = new QTimer(this);
+  std::set<std::filesystem::path> m_dirtyDirectories;
+  bool m_scanned = false;
+  bool m_fullScan = false;
+
+  // in the order of $PATH, so that listed programs keep the order the shell would look them up in
+  std::vector<DirectoryPrograms> m_directories;
   std::vector<std::filesystem::path> m_progs;
+  std::vector<Program> m_index;
 
 signals:
   void backgroundScanFinished() const;
@@ -0,0 +1,90 @@
+#pragma once
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QLatin1StringView>
+#include <QString>
+#include <QStringEncoder>
+#include <QUtf8StringView>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * Conversions between the UTF-8 strings of protobuf messages and the UTF-16 strings of Qt, for the request
+ * routers and the render tree of extensions, where they happen for every field of every message.
+ *
+ * Strings that are only passed through, such as ids and paths, are best kept as they are. Those that are
+ * needed as QStrings are decoded once, straight from the message: `c_str()` measures them again and cuts
+ * them at the first null character, and `toStdString()` encodes into a byte array that is then copied into
+ * the message.
+ */
+namespace ProtoString {
+
+inline QString toQString(std::string_view str) { return QUtf8StringView(str.data(), str.size()).toString(); }
+
+/**
+ * Encode `str` as UTF-8 right into `out`, usually the mutable field of a message.
+ */
+inline void assign(std::string *out, QStringView str) {
+  QStringEncoder encoder(QStringEncoder::Utf8);
+
+  out->resize_and_overwrite(encoder.requiredSpace(str.size()), [&](char *data, size_t) {
+    return encoder.appendToBuffer(data, str) - data;
+  });
+}
+
+inline std::string toStdString(QStringView str) {
+  std::string out;
+
+  assign(&out, str);
+
+  return out;
+}
+
+// US-ASCII strings read the same in Latin-1 and in UTF-8
+inline bool isAscii(std::string_view str) {
+  return std::ranges::all_of(str, [](char c) { return static_cast<unsigned char>(c) < 0x80; });
+}
+
+/**
+ * Insert `value` under `key` in `obj`. Keys that are US-ASCII, as property names are, are stored by the
+ * object as they are, without being decoded first.
+ */
+inline void insert(QJsonObject &obj, std::string_view key, const QJsonValue &value) {
+  if (isAscii(key)) {
+    obj.insert(QLatin1StringView(key.data(), key.size()), value);
+  } else {
+    obj.insert(toQString(key), value);
+  }
+}
+
+/**
+ * Strings of a small vocabulary, such as the types of render nodes, decoded the first time they are seen
+ * and shared afterwards. Past `MAX_SIZE` distinct strings, new ones are decoded every time.
+ */
+class Pool {
+  struct Hash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view str) const { return std::hash<std::string_view>{}(str); }
+  };
+
+  std::unordered_map<std::string, QString, Hash, std::equal_to<>> m_strings;
+
+public:
+  static constexpr size_t MAX_SIZE = 512;
+
+  QString get(std::string_view str) {
+    if (auto it = m_strings.find(str); it != m_strings.end()) return it->second;
+
+    QString decoded = toQString(str);
+
+    if (m_strings.size() < MAX_SIZE) { m_strings.emplace(str, decoded); }
+
+    return decoded;
+  }
+};
+
+}; // namespace ProtoString
@@ -0,0 +1,116 @@
+#include "search-index.hpp"
+#include "rapidfuzz/fuzz.hpp"
+#include <optional>
+
+void SearchIndexText::add(std::initializer_list<QStringView> fields) {
+  add(std::span<const QStringView>(fields.begin(), fields.size()));
+}
+
+void SearchIndexText::add(std::span<const QStringView> fields) {
+  Document document{.fieldOffset = static_cast<uint32_t>(m_fields.size()),
+                    .fieldCount = static_cast<uint32_t>(fields.size())};
+
+  for (auto str : fields) {
+    Field field;
+    uint32_t base = m_text.size();
+
+    field.wordOffset = m_words.size();
+    TextTokenizer::tokenize(str, m_text, m_words);
+    field.text = {.offset = base, .length = static_cast<uint32_t>(m_text.size() - base)};
+    field.wordCount = m_words.size() - field.wordOffset;
+    m_fields.emplace_back(field);
+  }
+
+  if (document.fieldCount > 0) {
+    auto name = m_fields[document.fieldOffset].text;
+    QByteArray data = QStringView(m_text).mid(name.offset, name.length).toUtf8();
+
+    document.utf8Name = {.offset = static_cast<uint32_t>(m_utf8.size()),
+                         .length = static_cast<uint32_t>(data.size())};
+    m_utf8.append(data.constData(), data.size());
+  }
+
+  m_documents.emplace_back(document);
+}
+
+void SearchIndexText::reserve(size_t count) {
+  m_documents.reserve(count);
+  // rough estimate, avoids most of the reallocations for typical names
+  m_text.reserve(count * 32);
+  m_words.reserve(count * 3);
+}
+
+void SearchIndexText::clear() {
+  m_documents.clear();
+  m_fields.clear();
+  m_words.clear();
+  m_text.clear();
+  m_utf8.clear();
+}
+
+double SearchIndexText::fieldScore(const Field &field, QStringView query) const {
+  QStringView str = QStringView(m_text).mid(field.text.offset, field.text.length);
+
+  if (str == query) return 1;
+  if (str.startsWith(query)) return 0.9;
+  if (field.wordCount == 0) return 0;
+
+  size_t matchCount = 0;
+
+  for (uint32_t i = 0; i != field.wordCount; ++i) {
+    const auto &word = m_words[field.wordOffset + i];
+
+    matchCount += QStringView(m_text).mid(word.offset, word.length).startsWith(query);
+  }
+
+  return static_cast<double>(matchCount) / field.wordCount;
+}
+
+std::vector<SearchIndexText::Match> SearchIndexText::match(QStringView query,
+                                                           std::span<const uint32_t> candidates) const {
+  using FuzzyScorer = rapidfuzz::fuzz::CachedPartialRatio<char>;
+
+  std::string utf8Query = query.toString().toStdString();
+  std::optional<FuzzyScorer> scorer;
+  std::vector<Match> matches;
+
+  if (query.size() >= MIN_FUZZY_QUERY_LENGTH) { scorer.emplace(utf8Query); }
+
+  for (uint32_t index : candidates) {
+    const auto &document = m_documents[index];
+    double exactScore = 0;
+    double fuzzyScore = 0;
+
+    for (uint32_t i = 0; i != document.fieldCount; ++i) {
+      double weight = i == 0 ? NAME_WEIGHT : FIELD_WEIGHT;
+
+      exactScore += fieldScore(m_fields[document.fieldOffset + i], query) * weight;
+    }
+
+    if (scorer) {
+      auto name = std::string_view(m_utf8).substr(document.utf8Name.offset, document.utf8Name.length);
+
+      fuzzyScore = scorer->similarity(name, FUZZY_CUTOFF) / 100;
+    }
+
+    double score = std::clamp(exactScore, 0.0, 1.0) * EXACT_WEIGHT + fuzzyScore * FUZZY_WEIGHT;
+
+    if (score > 0) { matches.emplace_back(Match{.index = index, .score = score}); }
+  }
+
+  return matches;
+}
+
+void SearchIndexText::rank(std::vector<Match> &matches, size_t limit) {
+  auto better = [](const Match &a, const Match &b) {
+    if (a.score != b.score) return a.score > b.score;
+    return a.index < b.index;
+  };
+
+  if (limit < matches.size()) {
+    std::partial_sort(matches.begin(), matches.begin() + limit, matches.end(), better);
+    matches.resize(limit);
+  } else {
+    std::sort(matches.begin(), matches.end(), better);
+  }
+}
@@ -0,0 +1,176 @@
+#pragma once
+#include "lib/incremental-search-cache.hpp"
+#include "lib/text-tokenizer.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <numeric>
+#include <qstring.h>
+#include <qstringview.h>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * Normalized text of the documents of a `SearchIndex`, which is what queries are scored against. Documents
+ * are referenced by their position, in the order they were added.
+ *
+ * Every field is normalized and split into words by the shared `TextTokenizer` once, when it is added, and
+ * the text of all documents lives in a single buffer, so that scoring a query never allocates per document.
+ * Scoring follows the rules of the root search: fields are matched by prefix, word by word, and the first
+ * field of a document (its name) is also fuzzily matched against the query.
+ */
+class SearchIndexText {
+public:
+  struct Match {
+    uint32_t index;
+    double score;
+  };
+
+  // a single character fuzzily matches about everything, such queries are only matched by prefix
+  static constexpr qsizetype MIN_FUZZY_QUERY_LENGTH = 2;
+
+  /**
+   * The first field is the name of the document, the other ones weigh less.
+   */
+  void add(std::initializer_list<QStringView> fields);
+  void add(std::span<const QStringView> fields);
+  void reserve(size_t count);
+  void clear();
+  size_t size() const { return m_documents.size(); }
+
+  /**
+   * The documents at `candidates` matching `query`, which is expected to be normalized. Matches are in the
+   * order of the candidates.
+   */
+  std::vector<Match> match(QStringView query, std::span<const uint32_t> candidates) const;
+
+  /**
+   * Keep the `limit` best matches, best first. Documents with the same score stay in the order they were
+   * added in.
+   */
+  static void rank(std::vector<Match> &matches, size_t limit);
+
+private:
+  static constexpr double EXACT_WEIGHT = 0.7;
+  static constexpr double FUZZY_WEIGHT = 0.3;
+  static constexpr double FUZZY_CUTOFF = 70;
+  static constexpr double NAME_WEIGHT = 0.8;
+  static constexpr double FIELD_WEIGHT = 0.5;
+
+  struct Field {
+    TextSpan text;
+    uint32_t wordOffset = 0;
+    uint32_t wordCount = 0;
+  };
+
+  struct Document {
+    uint32_t fieldOffset = 0;
+    uint32_t fieldCount = 0;
+    // normalized UTF-8 name, fed as is to the fuzzy matcher
+    TextSpan utf8Name;
+  };
+
+  double fieldScore(const Field &field, QStringView query) const;
+
+  std::vector<Document> m_documents;
+  std::vector<Field> m_fields;
+  std::vector<TextSpan> m_words;
+  QString m_text;
+  std::string m_utf8;
+};
+
+/**
+ * In-memory search over the items of a view, for views that do not have a dedicated index: items are added
+ * along with the text they can be found by, and queries return them ranked the same way everywhere.
+ *
+ * Searching for a query that extends the previous one only scores the items that matched it, so that
+ * refining a search as the user types gets faster with every keystroke.
+ *
+ * An empty query returns every item, in the order they were added.
+ */
+template <typename T> class SearchIndex {
+public:
+  static constexpr size_t NO_LIMIT = std::numeric_limits<size_t>::max();
+
+  struct Result {
+    const T *item;
+    double score;
+  };
+
+  void add(T item, std::initializer_list<QStringView> fields) {
+    m_items.emplace_back(std::move(item));
+    m_text.add(fields);
+    m_cache.invalidate();
+  }
+
+  void reserve(size_t count) {
+    m_items.reserve(count);
+    m_text.reserve(count);
+  }
+
+  void clear() {
+    m_items.clear();
+    m_text.clear();
+    m_cache.invalidate();
+  }
+
+  size_t size() const { return m_items.size(); }
+  bool empty() const { return m_items.empty(); }
+  const std::vector<T> &items() const { return m_items; }
+
+  /**
+   * The `limit` items best matching `text`, best first.
+   */
+  std::vector<Result> search(QStringView text, size_t limit = NO_LIMIT) const {
+    QString query = TextTokenizer::normalize(text.trimmed());
+    std::vector<Result> results;
+
+    if (query.isEmpty()) {
+      results.reserve(std::min(limit, m_items.size()));
+
+      for (size_t i = 0; i != m_items.size() && i != limit; ++i) {
+        results.emplace_back(Result{.item = &m_items[i], .score = 0});
+      }
+
+      return results;
+    }
+
+    std::vector<uint32_t> all;
+    auto candidates = m_cache.candidates(query);
+
+    if (!candidates) {
+      all.resize(m_items.size());
+      std::iota(all.begin(), all.end(), 0);
+    }
+
+    auto matches = m_text.match(query, candidates ? *candidates : all);
+
+    // shorter queries are not fuzzily matched, longer ones could match items they did not
+    if (query.size() >= SearchIndexText::MIN_FUZZY_QUERY_LENGTH) {
+      std::vector<uint32_t> matched;
+
+      matched.reserve(matches.size());
+      for (const auto &match : matches) {
+        matched.emplace_back(match.index);
+      }
+
+      m_cache.update(query, std::move(matched));
+    }
+
+    SearchIndexText::rank(matches, limit);
+    results.reserve(matches.size());
+
+    for (const auto &match : matches) {
+      results.emplace_back(Result{.item = &m_items[match.index], .score = match.score});
+    }
+
+    return results;
+  }
+
+private:
+  std::vector<T> m_items;
+  SearchIndexText m_text;
+  mutable IncrementalSearchCache<uint32_t> m_cache;
+};
@@ -0,0 +1,65 @@
+#include "search-profiler/search-profiler.hpp"
+#include <QJsonObject>
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+SearchProfiler::Scope::~Scope() {
+  if (m_discarded) return;
+
+  SearchProfiler::instance().record(m_path, duration_cast<microseconds>(Clock::now() - m_start), m_results);
+}
+
+SearchProfiler &SearchProfiler::instance() {
+  static SearchProfiler profiler;
+
+  return profiler;
+}
+
+void SearchProfiler::record(const char *path, microseconds duration, size_t results) {
+  QMutexLocker lock(&m_mutex);
+  auto [entry, inserted] = m_stats.try_emplace(path, Stats{.path = path});
+
+  entry->second.latency.add(duration);
+  entry->second.results += results;
+}
+
+std::vector<SearchProfiler::Stats> SearchProfiler::stats() const {
+  QMutexLocker lock(&m_mutex);
+  std::vector<Stats> stats;
+
+  stats.reserve(m_stats.size());
+
+  for (const auto &[path, value] : m_stats) {
+    stats.emplace_back(value);
+  }
+
+  return stats;
+}
+
+QJsonDocument SearchProfiler::report() const {
+  QJsonObject report;
+
+  for (const auto &stats : this->stats()) {
+    const auto &latency = stats.latency;
+    QJsonObject entry;
+
+    // microseconds, as reported by the histogram
+    entry["count"] = static_cast<qint64>(latency.count());
+    entry["meanResults"] = latency.count() ? static_cast<double>(stats.results) / latency.count() : 0.0;
+    entry["mean"] = static_cast<qint64>(latency.mean().count());
+    entry["p50"] = static_cast<qint64>(latency.percentile(0.5).count());
+    entry["p95"] = static_cast<qint64>(latency.percentile(0.95).count());
+    entry["p99"] = static_cast<qint64>(latency.percentile(0.99).count());
+    entry["max"] = static_cast<qint64>(latency.max().count());
+    report[stats.path] = entry;
+  }
+
+  return QJsonDocument(report);
+}
+
+void SearchProfiler::clear() {
+  QMutexLocker lock(&m_mutex);
+
+  m_stats.clear();
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "extension/manager/extension-tracer.hpp"
+#include <QJsonDocument>
+#include <QMutex>
+#include <chrono>
+#include <map>
+#include <vector>
+
+/**
+ * Latencies of the search hot paths (root search, emoji, files, clipboard history), as they are hit by
+ * actual queries against actual data.
+ *
+ * Searches are timed in the daemon rather than in a separate benchmark, so that a regression shows up in
+ * the numbers of the next session and a report can be exported and compared with the one of another build.
+ */
+class SearchProfiler {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Stats {
+    // static string, such as `root` or `emoji`
+    const char *path;
+    LatencyHistogram latency;
+    // number of results returned, summed over all the searches
+    uint64_t results = 0;
+  };
+
+  /**
+   * Times the search it lives for, recording it as it goes out of scope. Searches that are cancelled
+   * before they complete are not representative and should be `discard`ed.
+   */
+  class Scope {
+  public:
+    void setResultCount(size_t count) { m_results = count; }
+    void discard() { m_discarded = true; }
+
+    Scope(const char *path) : m_path(path) {}
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    const char *m_path;
+    Clock::time_point m_start = Clock::now();
+    size_t m_results = 0;
+    bool m_discarded = false;
+  };
+
+  static SearchProfiler &instance();
+
+  void record(const char *path, std::chrono::microseconds duration, size_t results);
+
+  std::vector<Stats> stats() const;
+
+  /**
+   * Percentiles of every path as a JSON object keyed by path, meant to be diffed between builds.
+   */
+  QJsonDocument report() const;
+
+  void clear();
+
+private:
+  mutable QMutex m_mutex;
+  std::map<std::string_view, Stats> m_stats;
+};
@@ -0,0 +1,178 @@
+#include "sql-profiler/sql-profiler.hpp"
+#include <QSqlDriver>
+#include <QSqlError>
+#include <algorithm>
+#include <array>
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+SqlProfiler &SqlProfiler::instance() {
+  static SqlProfiler profiler;
+
+  return profiler;
+}
+
+bool SqlProfiler::exec(QSqlQuery &query) {
+  auto start = Clock::now();
+  bool ok = query.exec();
+
+  instance().record(query, duration_cast<microseconds>(Clock::now() - start));
+
+  return ok;
+}
+
+bool SqlProfiler::exec(QSqlQuery &query, const QString &sql) {
+  auto start = Clock::now();
+  bool ok = query.exec(sql);
+
+  instance().record(query, duration_cast<microseconds>(Clock::now() - start));
+
+  return ok;
+}
+
+QString SqlProfiler::normalize(QStringView sql) {
+  QString normalized;
+  bool pendingSpace = false;
+
+  normalized.reserve(std::min(sql.size(), MAX_SQL_LENGTH));
+
+  auto append = [&](QChar c) {
+    if (pendingSpace && !normalized.isEmpty()) { normalized += ' '; }
+    pendingSpace = false;
+    normalized += c;
+  };
+
+  for (qsizetype i = 0; i < sql.size() && normalized.size() < MAX_SQL_LENGTH; ++i) {
+    QChar c = sql[i];
+
+    if (c.isSpace()) {
+      pendingSpace = true;
+    } else if (c == '-' && i + 1 < sql.size() && sql[i + 1] == '-') {
+      while (i < sql.size() && sql[i] != '\n') {
+        ++i;
+      }
+      pendingSpace = true;
+    } else if (c == '\'') {
+      // quotes are escaped by doubling them
+      for (++i; i < sql.size(); ++i) {
+        if (sql[i] != '\'') continue;
+        if (i + 1 < sql.size() && sql[i + 1] == '\'') {
+          ++i;
+          continue;
+        }
+        break;
+      }
+      append('?');
+    } else if (c.isDigit() && (normalized.isEmpty() || pendingSpace ||
+                               !(normalized.back().isLetterOrNumber() || normalized.back() == '_'))) {
+      while (i + 1 < sql.size() && (sql[i + 1].isLetterOrNumber() || sql[i + 1] == '.')) {
+        ++i;
+      }
+      append('?');
+    } else {
+      append(c);
+    }
+  }
+
+  return normalized;
+}
+
+QString SqlProfiler::explain(const QSqlQuery &query) {
+  static constexpr std::array EXPLAINABLE = {"SELECT", "WITH", "INSERT", "UPDATE", "DELETE", "REPLACE"};
+
+  auto sql = query.lastQuery().trimmed();
+  bool explainable = std::ranges::any_of(
+      EXPLAINABLE, [&](const char *keyword) { return sql.startsWith(keyword, Qt::CaseInsensitive); });
+
+  if (!explainable || !query.driver()) return {};
+
+  // a query running on the same connection, which QSqlQuery does not expose otherwise
+  QSqlQuery plan(query.driver()->createResult());
+  auto values = query.boundValues();
+
+  if (!plan.prepare("EXPLAIN QUERY PLAN " + sql)) return {};
+
+  for (int i = 0; i != values.size(); ++i) {
+    plan.bindValue(i, values.at(i));
+  }
+
+  if (!plan.exec()) {
+    qWarning() << "Failed to explain slow query" << plan.lastError();
+    return {};
+  }
+
+  QStringList steps;
+
+  // id, parent, unused, detail
+  while (plan.next()) {
+    steps << plan.value(3).toString();
+  }
+
+  return steps.join('\n');
+}
+
+void SqlProfiler::record(QSqlQuery &query, microseconds duration) {
+  auto sql = normalize(query.lastQuery());
+  bool shouldExplain = false;
+
+  {
+    QMutexLocker lock(&m_mutex);
+    auto it = m_stats.find(sql);
+
+    if (it == m_stats.end()) {
+      if (m_stats.size() >= MAX_STATEMENTS) { sql = "(other statements)"; }
+      it = m_stats.try_emplace(sql, Stats{.sql = sql}).first;
+    }
+
+    it->second.latency.add(duration);
+
+    if (duration >= SLOW_QUERY_THRESHOLD && !it->second.explained) {
+      it->second.explained = true;
+      shouldExplain = true;
+    }
+  }
+
+  if (duration < SLOW_QUERY_THRESHOLD) return;
+
+  double ms = duration.count() / 1000.0;
+
+  // the plan of a statement does not change between executions, it is only worth getting once
+  if (shouldExplain) {
+    if (auto plan = explain(query); !plan.isEmpty()) {
+      qWarning().noquote() << "Slow query" << sql << "took" << ms << "ms, query plan:\n" << plan;
+      return;
+    }
+  }
+
+  qWarning().noquote() << "Slow query" << sql << "took" << ms << "ms";
+}
+
+std::vector<SqlProfiler::Stats> SqlProfiler::stats() const {
+  QMutexLocker lock(&m_mutex);
+  std::vector<Stats> stats;
+
+  stats.reserve(m_stats.size());
+
+  for (const auto &[sql, value] : m_stats) {
+    stats.emplace_back(value);
+  }
+
+  lock.unlock();
+
+  std::ranges::sort(stats, [](const Stats &a, const Stats &b) {
+    auto lhs = a.latency.percentile(0.95);
+    auto rhs = b.latency.percentile(0.95);
+
+    if (lhs != rhs) return lhs > rhs;
+    return a.latency.max() > b.latency.max();
+  });
+
+  return stats;
+}
+
+void SqlProfiler::clear() {
+  QMutexLocker lock(&m_mutex);
+
+  m_stats.clear();
+}
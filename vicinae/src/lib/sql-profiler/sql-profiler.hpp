@@ -0,0 +1,60 @@
+#pragma once
+#include "extension/manager/extension-tracer.hpp"
+#include <QMutex>
+#include <QSqlQuery>
+#include <QString>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Latencies of the statements run against the SQLite databases of the daemon, keyed by their SQL with the
+ * literals replaced by `?`, so that a user reporting slowness can tell whether SQLite is responsible.
+ *
+ * Queries are executed through `exec` rather than `QSqlQuery::exec` to be accounted. Executions taking
+ * longer than `SLOW_QUERY_THRESHOLD` are logged, along with the query plan the first time a statement is.
+ */
+class SqlProfiler {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr auto SLOW_QUERY_THRESHOLD = std::chrono::milliseconds(50);
+  // statements built on the fly would otherwise grow the map without bound
+  static constexpr size_t MAX_STATEMENTS = 256;
+  static constexpr qsizetype MAX_SQL_LENGTH = 300;
+
+  struct Stats {
+    QString sql;
+    LatencyHistogram latency;
+    bool explained = false;
+  };
+
+  static SqlProfiler &instance();
+
+  /**
+   * Same as `QSqlQuery::exec`, timed.
+   */
+  static bool exec(QSqlQuery &query);
+  static bool exec(QSqlQuery &query, const QString &sql);
+
+  /**
+   * `sql` with its literals replaced by `?` and its whitespace and comments collapsed into single spaces.
+   */
+  static QString normalize(QStringView sql);
+
+  void record(QSqlQuery &query, std::chrono::microseconds duration);
+
+  /**
+   * Statements from the slowest to the fastest, by 95th percentile.
+   */
+  std::vector<Stats> stats() const;
+
+  void clear();
+
+private:
+  // the query plan of the statement `query` last executed, one step per line
+  static QString explain(const QSqlQuery &query);
+
+  mutable QMutex m_mutex;
+  std::unordered_map<QString, Stats> m_stats;
+};
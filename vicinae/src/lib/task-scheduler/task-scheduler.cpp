@@ -0,0 +1,173 @@
+#include "task-scheduler/task-scheduler.hpp"
+#include <QThread>
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+size_t index(TaskScheduler::Priority priority) { return static_cast<size_t>(priority); }
+
+} // namespace
+
+TaskScheduler &TaskScheduler::instance() {
+  // never destroyed, for the queues destroyed along with the services on exit to see their tasks through
+  static auto *scheduler = new TaskScheduler;
+
+  return *scheduler;
+}
+
+void TaskScheduler::start(Priority priority, Task task, CancellationToken token) {
+  {
+    std::lock_guard lock(m_mutex);
+    m_pending[index(priority)].emplace_back(PendingTask{.task = std::move(task), .token = std::move(token)});
+  }
+
+  m_cv.notify_one();
+}
+
+size_t TaskScheduler::concurrency(Priority priority) const { return m_limits[index(priority)]; }
+
+std::optional<size_t> TaskScheduler::nextClass() const {
+  for (size_t i = 0; i != PRIORITY_COUNT; ++i) {
+    if (m_pending[i].empty() || m_running[i] >= m_limits[i]) continue;
+    // the last thread is kept for interactive tasks
+    if (i != index(Priority::Interactive) && m_nonInteractiveRunning + 1 >= m_threadCount) continue;
+
+    return i;
+  }
+
+  return std::nullopt;
+}
+
+void TaskScheduler::work() {
+  std::unique_lock lock(m_mutex);
+
+  while (true) {
+    std::optional<size_t> klass;
+
+    m_cv.wait(lock, [&]() { return (klass = nextClass()).has_value(); });
+
+    auto pending = std::move(m_pending[*klass].front());
+    bool interactive = *klass == index(Priority::Interactive);
+
+    m_pending[*klass].pop_front();
+
+    if (pending.token.isCancelled()) {
+      // what the task captured may well start tasks of its own as it is destroyed
+      lock.unlock();
+      pending.task = nullptr;
+      lock.lock();
+      continue;
+    }
+
+    ++m_running[*klass];
+    if (!interactive) { ++m_nonInteractiveRunning; }
+    lock.unlock();
+
+    pending.task();
+    // whatever the task captured is released before the next one starts
+    pending.task = nullptr;
+
+    lock.lock();
+    --m_running[*klass];
+    if (!interactive) { --m_nonInteractiveRunning; }
+  }
+}
+
+TaskScheduler::TaskScheduler() {
+  size_t ideal = std::max(2, QThread::idealThreadCount());
+  m_threadCount = ideal + 1;
+  m_limits[index(Priority::Interactive)] = m_threadCount;
+  m_limits[index(Priority::VisibleUi)] = std::max<size_t>(2, ideal - 1);
+  m_limits[index(Priority::Prefetch)] = 2;
+  m_limits[index(Priority::Background)] = 1;
+
+  for (size_t i = 0; i != m_threadCount; ++i) {
+    std::thread([this]() { work(); }).detach();
+  }
+}
+
+void TaskQueue::start(TaskScheduler::Task task) {
+  std::lock_guard lock(m_mutex);
+
+  m_tasks.emplace_back(std::move(task));
+  if (!m_scheduled) { scheduleNext(); }
+}
+
+void TaskQueue::scheduleNext() {
+  m_scheduled = true;
+  TaskScheduler::instance().start(m_priority, [this]() {
+    TaskScheduler::Task task;
+
+    {
+      std::lock_guard lock(m_mutex);
+
+      if (m_tasks.empty()) {
+        m_scheduled = false;
+        m_cv.notify_all();
+        return;
+      }
+
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+
+    task();
+    task = nullptr;
+
+    std::lock_guard lock(m_mutex);
+
+    if (!m_tasks.empty()) return scheduleNext();
+
+    m_scheduled = false;
+    m_cv.notify_all();
+  });
+}
+
+void TaskQueue::clear() {
+  std::lock_guard lock(m_mutex);
+  m_tasks.clear();
+}
+
+void TaskQueue::waitForDone() {
+  std::unique_lock lock(m_mutex);
+  m_cv.wait(lock, [this]() { return !m_scheduled; });
+}
+
+TaskQueue::TaskQueue(TaskScheduler::Priority priority) : m_priority(priority) {}
+
+TaskQueue::~TaskQueue() {
+  clear();
+  waitForDone();
+}
+
+void TaskGroup::start(TaskScheduler::Task task, CancellationToken token) {
+  {
+    std::lock_guard lock(m_mutex);
+    ++m_running;
+  }
+
+  // dropped tasks are destroyed without running, the count goes down either way
+  struct Done {
+    TaskGroup *group;
+
+    ~Done() {
+      std::lock_guard lock(group->m_mutex);
+
+      if (--group->m_running == 0) { group->m_cv.notify_all(); }
+    }
+  };
+
+  TaskScheduler::instance().start(
+      m_priority, [task = std::move(task), done = std::make_unique<Done>(this)]() mutable { task(); },
+      std::move(token));
+}
+
+void TaskGroup::waitForDone() {
+  std::unique_lock lock(m_mutex);
+  m_cv.wait(lock, [this]() { return m_running == 0; });
+}
+
+TaskGroup::TaskGroup(TaskScheduler::Priority priority) : m_priority(priority) {}
+
+TaskGroup::~TaskGroup() { waitForDone(); }
@@ -0,0 +1,164 @@
+#pragma once
+#include <QFuture>
+#include <QPromise>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+
+/**
+ * Shared flag telling a task that its result is no longer wanted. Tasks cancelled before they start are
+ * dropped by the scheduler, running ones are expected to check `isCancelled` whenever they can stop early.
+ */
+class CancellationToken {
+public:
+  void cancel() const { m_cancelled->store(true, std::memory_order_relaxed); }
+  bool isCancelled() const { return m_cancelled->load(std::memory_order_relaxed); }
+
+private:
+  std::shared_ptr<std::atomic<bool>> m_cancelled = std::make_shared<std::atomic<bool>>(false);
+};
+
+/**
+ * Threads running the short lived background work of the daemon, ordered by how much the user is waiting on
+ * it. Pools of their own all assume they have the machine to themselves: a grid full of images to decode
+ * would compete for the CPU with the root search loads the user is actually waiting for.
+ *
+ * Tasks of higher priority classes always start first, and each class is limited to a number of concurrent
+ * tasks, so that a burst of prefetches or of background scans never takes every thread. One thread is only
+ * ever used for interactive tasks, which therefore never wait on anything but other interactive tasks.
+ *
+ * Long lived work (indexer scans, event watchers) and work bound to the connections of its threads keeps
+ * threads of its own.
+ */
+class TaskScheduler {
+public:
+  enum class Priority {
+    // what the user is blocked on: the next keystroke or the view being opened waits for it
+    Interactive,
+    // what is shown right now, such as the images and previews of the visible rows
+    VisibleUi,
+    // what the user is likely to need next
+    Prefetch,
+    // maintenance that no one is waiting on
+    Background,
+  };
+
+  static constexpr size_t PRIORITY_COUNT = 4;
+
+  using Task = std::move_only_function<void()>;
+
+  static TaskScheduler &instance();
+
+  /**
+   * Run `task` on one of the scheduler threads. If `token` is cancelled before the task starts, it is
+   * dropped.
+   */
+  void start(Priority priority, Task task, CancellationToken token = {});
+
+  /**
+   * Run `fn` on one of the scheduler threads, and get its result. Cancelling the returned future before
+   * the task starts drops it.
+   */
+  template <typename F> auto run(Priority priority, F fn) -> QFuture<std::invoke_result_t<F>> {
+    using T = std::invoke_result_t<F>;
+    QPromise<T> promise;
+    auto future = promise.future();
+
+    // futures are running as soon as they are queued, as the ones of QtConcurrent are
+    promise.start();
+    start(priority, [promise = std::move(promise), fn = std::move(fn)]() mutable {
+      if (!promise.isCanceled()) {
+        if constexpr (std::is_void_v<T>) {
+          fn();
+        } else {
+          promise.addResult(fn());
+        }
+      }
+
+      promise.finish();
+    });
+
+    return future;
+  }
+
+  /**
+   * Maximum number of tasks of `priority` running at once.
+   */
+  size_t concurrency(Priority priority) const;
+  size_t threadCount() const { return m_threadCount; }
+
+private:
+  struct PendingTask {
+    Task task;
+    CancellationToken token;
+  };
+
+  TaskScheduler();
+
+  void work();
+  // highest priority class that has a task that can start now, if any
+  std::optional<size_t> nextClass() const;
+
+  std::array<size_t, PRIORITY_COUNT> m_limits;
+  std::array<size_t, PRIORITY_COUNT> m_running = {};
+  std::array<std::deque<PendingTask>, PRIORITY_COUNT> m_pending;
+  size_t m_nonInteractiveRunning = 0;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  size_t m_threadCount = 0;
+};
+
+/**
+ * Tasks running one at a time and in order on the threads of the `TaskScheduler`, for work that touches
+ * state only meant to be accessed by one thread at a time. Each task is scheduled on its own once the
+ * previous one is done, so that a long queue does not hold up work of higher priority.
+ *
+ * Pending tasks are dropped and the running one waited for when the queue is destroyed.
+ */
+class TaskQueue {
+public:
+  void start(TaskScheduler::Task task);
+
+  // drop the tasks that have not started yet
+  void clear();
+  void waitForDone();
+
+  TaskQueue(TaskScheduler::Priority priority);
+  ~TaskQueue();
+
+private:
+  // with `m_mutex` held
+  void scheduleNext();
+
+  TaskScheduler::Priority m_priority;
+  std::deque<TaskScheduler::Task> m_tasks;
+  bool m_scheduled = false;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+};
+
+/**
+ * Tasks started on the threads of the `TaskScheduler` that are waited for when the group is destroyed, for
+ * tasks that use their owner, such as to post their result back to it.
+ */
+class TaskGroup {
+public:
+  void start(TaskScheduler::Task task, CancellationToken token = {});
+  void waitForDone();
+
+  TaskGroup(TaskScheduler::Priority priority);
+  ~TaskGroup();
+
+private:
+  TaskScheduler::Priority m_priority;
+  size_t m_running = 0;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+};
@@ -0,0 +1,245 @@
+#include "text-tokenizer.hpp"
+#include <optional>
+#include <qchar.h>
+#include <unordered_map>
+
+namespace {
+
+enum class CharClass { Lower, Upper, Caseless, Separator, Mark };
+
+CharClass classify(char32_t cp) {
+  if (cp < 0x80) {
+    if (cp >= 'a' && cp <= 'z') return CharClass::Lower;
+    if (cp >= 'A' && cp <= 'Z') return CharClass::Upper;
+    if (cp >= '0' && cp <= '9') return CharClass::Caseless;
+    return CharClass::Separator;
+  }
+
+  switch (QChar::category(cp)) {
+  case QChar::Mark_NonSpacing:
+  case QChar::Mark_SpacingCombining:
+  case QChar::Mark_Enclosing:
+    return CharClass::Mark;
+  case QChar::Letter_Lowercase:
+    return CharClass::Lower;
+  case QChar::Letter_Uppercase:
+  case QChar::Letter_Titlecase:
+    return CharClass::Upper;
+  case QChar::Letter_Modifier:
+  case QChar::Letter_Other:
+  case QChar::Number_DecimalDigit:
+  case QChar::Number_Letter:
+  case QChar::Number_Other:
+    return CharClass::Caseless;
+  default:
+    return CharClass::Separator;
+  }
+}
+
+bool hasStrippableDiacritics(char32_t cp) {
+  // latin-1 supplement up to cyrillic, latin extended additional and greek extended.
+  // Other scripts are left alone as decomposing them can change the meaning of the character
+  // (hangul syllables, japanese dakuten...).
+  return (cp >= 0xC0 && cp < 0x530) || (cp >= 0x1E00 && cp < 0x2000);
+}
+
+/**
+ * Base letter of `cp`, derived from its canonical decomposition.
+ * Computing the decomposition allocates, so results are cached.
+ */
+char32_t stripDiacritics(char32_t cp) {
+  if (!hasStrippableDiacritics(cp)) return cp;
+
+  thread_local std::unordered_map<char32_t, char32_t> cache;
+
+  if (auto it = cache.find(cp); it != cache.end()) return it->second;
+
+  char32_t base = cp;
+
+  // decompositions can be nested (ṩ -> ṣ + ◌̇ -> s + ◌̣ + ◌̇)
+  while (QChar::decompositionTag(base) == QChar::Canonical) {
+    QString decomposition = QChar::decomposition(base);
+
+    if (decomposition.isEmpty()) break;
+
+    char32_t first = decomposition.at(0).unicode();
+
+    if (decomposition.size() > 1 && decomposition.at(0).isHighSurrogate()) {
+      first = QChar::surrogateToUcs4(decomposition.at(0), decomposition.at(1));
+    }
+
+    if (first == base) break;
+
+    base = first;
+  }
+
+  cache.emplace(cp, base);
+
+  return base;
+}
+
+char32_t fold(char32_t cp) {
+  if (cp < 0x80) { return (cp >= 'A' && cp <= 'Z') ? cp + ('a' - 'A') : cp; }
+
+  return QChar::toCaseFolded(cp);
+}
+
+struct Utf16Reader {
+  QStringView text;
+  qsizetype pos = 0;
+
+  bool atEnd() const { return pos >= text.size(); }
+
+  char32_t next() {
+    QChar ch = text[pos++];
+
+    if (ch.isHighSurrogate() && pos < text.size() && text[pos].isLowSurrogate()) {
+      return QChar::surrogateToUcs4(ch, text[pos++]);
+    }
+
+    return ch.unicode();
+  }
+};
+
+struct Utf8Reader {
+  std::string_view text;
+  size_t pos = 0;
+
+  bool atEnd() const { return pos >= text.size(); }
+
+  char32_t next() {
+    auto lead = static_cast<uint8_t>(text[pos++]);
+
+    if (lead < 0x80) return lead;
+
+    int length = 0;
+    char32_t cp = 0;
+
+    if ((lead & 0xE0) == 0xC0) {
+      length = 1;
+      cp = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+      length = 2;
+      cp = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+      length = 3;
+      cp = lead & 0x07;
+    } else {
+      return QChar::ReplacementCharacter;
+    }
+
+    for (int i = 0; i != length; ++i) {
+      if (atEnd() || (static_cast<uint8_t>(text[pos]) & 0xC0) != 0x80) { return QChar::ReplacementCharacter; }
+      cp = (cp << 6) | (static_cast<uint8_t>(text[pos++]) & 0x3F);
+    }
+
+    return cp;
+  }
+};
+
+struct Utf16Writer {
+  QString &out;
+
+  uint32_t size() const { return out.size(); }
+
+  void append(char32_t cp) {
+    if (QChar::requiresSurrogates(cp)) {
+      out.append(QChar(QChar::highSurrogate(cp)));
+      out.append(QChar(QChar::lowSurrogate(cp)));
+    } else {
+      out.append(QChar(static_cast<char16_t>(cp)));
+    }
+  }
+};
+
+struct Utf8Writer {
+  std::string &out;
+
+  uint32_t size() const { return out.size(); }
+
+  void append(char32_t cp) {
+    if (cp < 0x80) {
+      out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+      out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+      out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+      out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+      out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+      out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+      out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+  }
+};
+
+template <typename Reader, typename Writer>
+void scan(Reader reader, Writer writer, std::vector<TextSpan> *tokens, const TextTokenizerOptions &opts) {
+  CharClass prev = CharClass::Separator;
+  std::optional<uint32_t> tokenStart;
+
+  auto endToken = [&]() {
+    if (tokenStart && tokens) {
+      tokens->push_back({.offset = *tokenStart, .length = writer.size() - *tokenStart});
+    }
+    tokenStart.reset();
+  };
+
+  while (!reader.atEnd()) {
+    char32_t cp = reader.next();
+    CharClass cls = classify(cp);
+
+    // combining marks are diacritics applied to the previous character
+    if (cls == CharClass::Mark) continue;
+
+    if (cls == CharClass::Separator) {
+      endToken();
+      writer.append(cp);
+      prev = cls;
+      continue;
+    }
+
+    if (opts.splitCamelCase && cls == CharClass::Upper && prev == CharClass::Lower) { endToken(); }
+    if (!tokenStart) { tokenStart = writer.size(); }
+
+    writer.append(fold(stripDiacritics(cp)));
+    prev = cls;
+  }
+
+  endToken();
+}
+
+} // namespace
+
+void TextTokenizer::tokenize(QStringView text, QString &out, std::vector<TextSpan> &tokens,
+                             const TextTokenizerOptions &opts) {
+  out.reserve(out.size() + text.size());
+  scan(Utf16Reader{.text = text}, Utf16Writer{.out = out}, &tokens, opts);
+}
+
+void TextTokenizer::tokenize(std::string_view text, std::string &out, std::vector<TextSpan> &tokens,
+                             const TextTokenizerOptions &opts) {
+  out.reserve(out.size() + text.size());
+  scan(Utf8Reader{.text = text}, Utf8Writer{.out = out}, &tokens, opts);
+}
+
+QString TextTokenizer::normalize(QStringView text) {
+  QString out;
+
+  out.reserve(text.size());
+  scan(Utf16Reader{.text = text}, Utf16Writer{.out = out}, nullptr, {});
+
+  return out;
+}
+
+std::string TextTokenizer::normalize(std::string_view text) {
+  std::string out;
+
+  out.reserve(text.size());
+  scan(Utf8Reader{.text = text}, Utf8Writer{.out = out}, nullptr, {});
+
+  return out;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <qstring.h>
+#include <qstringview.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct TextSpan {
+  uint32_t offset = 0;
+  uint32_t length = 0;
+};
+
+struct TextTokenizerOptions {
+  // camelCase -> camel Case
+  bool splitCamelCase = true;
+};
+
+/**
+ * Tokenizer shared by the different search indexes (root search, tries, file search queries) so that
+ * all of them agree on what a word is.
+ *
+ * Text is normalized in the same pass:
+ * - Unicode case folding
+ * - Diacritics are stripped from latin, greek and cyrillic letters ("é" -> "e")
+ *
+ * Tokens are delimited by:
+ * - Anything that is not a letter or a digit (whitespace, punctuation, symbols...)
+ * - Case changes (camelCase -> camel Case), unless disabled
+ *
+ * The normalized text, separators included, is appended to the provided output buffer and tokens are
+ * reported as spans into it (in code units of the output encoding), so that nothing is allocated per token.
+ */
+class TextTokenizer {
+public:
+  TextTokenizer() = delete;
+
+  static void tokenize(QStringView text, QString &out, std::vector<TextSpan> &tokens,
+                       const TextTokenizerOptions &opts = {});
+  static void tokenize(std::string_view text, std::string &out, std::vector<TextSpan> &tokens,
+                       const TextTokenizerOptions &opts = {});
+
+  /**
+   * Normalize the text without tokenizing it. Meant to be used on search queries, so that they
+   * can be compared with tokenized text.
+   */
+  static QString normalize(QStringView text);
+  static std::string normalize(std::string_view text);
+};
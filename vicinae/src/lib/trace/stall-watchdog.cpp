@@ -0,0 +1,178 @@
+#include "trace/stall-watchdog.hpp"
+#include "trace/trace.hpp"
+#include <QDateTime>
+#include <QDir>
+#include <qlogging.h>
+#include <csignal>
+#include <cstdlib>
+#ifdef __GLIBC__
+#include <execinfo.h>
+#endif
+
+using namespace std::chrono_literals;
+
+namespace {
+
+#ifdef __GLIBC__
+// sent to the GUI thread for it to capture its own stack, as that can't be done from another thread
+const int STACK_SIGNAL = SIGRTMIN + 1;
+constexpr int MAX_STACK_FRAMES = 64;
+
+void *s_stackFrames[MAX_STACK_FRAMES];
+std::atomic<int> s_stackFrameCount = -1;
+
+void captureStack(int) {
+  s_stackFrameCount.store(backtrace(s_stackFrames, MAX_STACK_FRAMES), std::memory_order_release);
+}
+
+void installStackHandler() {
+  struct sigaction action = {};
+
+  // the first call loads libgcc, which is not something to do from a signal handler
+  backtrace(s_stackFrames, 1);
+  action.sa_handler = captureStack;
+  action.sa_flags = SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  sigaction(STACK_SIGNAL, &action, nullptr);
+}
+#endif
+
+} // namespace
+
+void StallWatchdog::setWatching(bool watching) {
+  {
+    std::lock_guard lock(m_mutex);
+    m_watching = watching;
+  }
+
+  m_cv.notify_one();
+}
+
+void StallWatchdog::run() {
+  while (true) {
+    {
+      std::unique_lock lock(m_mutex);
+
+      m_cv.wait(lock, [this]() { return !m_alive || m_watching; });
+
+      if (!m_alive) return;
+      // what is in flight when watching stopped is no longer meaningful
+      if (m_cv.wait_for(lock, POLL_INTERVAL, [this]() { return !m_alive || !m_watching; })) {
+        m_pingSentAt.reset();
+        m_stalled = false;
+        continue;
+      }
+    }
+
+    poll();
+  }
+}
+
+void StallWatchdog::poll() {
+  auto now = Clock::now();
+
+  if (m_pong.exchange(false)) {
+    if (m_stalled) {
+      auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - *m_pingSentAt).count();
+      qWarning() << "GUI thread was stalled for about" << ms << "ms";
+    }
+
+    m_pingSentAt.reset();
+    m_stalled = false;
+  }
+
+  if (!m_pingSentAt) {
+    m_pingSentAt = now;
+    QMetaObject::invokeMethod(this, [this]() { m_pong = true; }, Qt::QueuedConnection);
+    return;
+  }
+
+  auto stalledFor = now - *m_pingSentAt;
+
+  if (m_stalled || stalledFor < STALL_THRESHOLD) return;
+
+  m_stalled = true;
+
+  if (m_lastDump && now - *m_lastDump < DUMP_COOLDOWN) return;
+
+  m_lastDump = now;
+  dump(stalledFor);
+}
+
+QStringList StallWatchdog::captureGuiStack() {
+  QStringList frames;
+
+#ifdef __GLIBC__
+  s_stackFrameCount.store(-1, std::memory_order_relaxed);
+
+  if (pthread_kill(m_guiThread, STACK_SIGNAL) != 0) return frames;
+
+  for (int i = 0; i != 20 && s_stackFrameCount.load(std::memory_order_acquire) < 0; ++i) {
+    std::this_thread::sleep_for(5ms);
+  }
+
+  int count = s_stackFrameCount.load(std::memory_order_acquire);
+
+  if (count <= 0) return frames;
+
+  // the frames of the handler and of the signal trampoline are not relevant
+  if (char **symbols = backtrace_symbols(s_stackFrames, count)) {
+    for (int i = 2; i < count; ++i) {
+      frames << symbols[i];
+    }
+
+    free(symbols);
+  }
+#endif
+
+  return frames;
+}
+
+void StallWatchdog::dump(Clock::duration stalledFor) {
+  auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(stalledFor).count();
+  auto stack = captureGuiStack();
+  auto timestamp = QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss-zzz");
+  auto path = m_dumpDir / QString("stall-%1.json").arg(timestamp).toStdString();
+  QJsonObject metadata{{"stalledForMs", static_cast<qint64>(ms)},
+                       {"guiThreadStack", QJsonArray::fromStringList(stack)}};
+
+  std::error_code ec;
+  std::filesystem::create_directories(m_dumpDir, ec);
+
+  if (auto result = Tracer::instance().dumpFlightRecorder(path, metadata); !result) {
+    qWarning() << "GUI thread stalled for" << ms
+               << "ms, failed to dump the flight recorder:" << result.error();
+    return;
+  }
+
+  qWarning() << "GUI thread stalled for" << ms << "ms, flight recorder dumped to" << path.c_str();
+  removeOldDumps();
+}
+
+void StallWatchdog::removeOldDumps() {
+  QDir dir(m_dumpDir);
+  // timestamps sort by name
+  auto dumps = dir.entryList({"stall-*.json"}, QDir::Files, QDir::Name);
+
+  for (qsizetype i = 0; i < dumps.size() - static_cast<qsizetype>(MAX_DUMPS); ++i) {
+    dir.remove(dumps.at(i));
+  }
+}
+
+StallWatchdog::StallWatchdog(std::filesystem::path dumpDir)
+    : m_dumpDir(std::move(dumpDir)), m_guiThread(pthread_self()) {
+#ifdef __GLIBC__
+  installStackHandler();
+#endif
+  m_thread = std::thread([this]() { run(); });
+}
+
+StallWatchdog::~StallWatchdog() {
+  {
+    std::lock_guard lock(m_mutex);
+    m_alive = false;
+  }
+
+  m_cv.notify_one();
+  m_thread.join();
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <QObject>
+#include <QStringList>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <pthread.h>
+#include <thread>
+
+/**
+ * Watches the event loop of the GUI thread from a thread of its own, by posting it a ping every
+ * `POLL_INTERVAL` and waiting for it to be handled.
+ *
+ * When the GUI thread does not get back to its event loop for `STALL_THRESHOLD`, the flight recorder of the
+ * tracer is dumped along with the stack of the GUI thread, as it is stuck, to a file of `dumpDir`. Only the
+ * most recent `MAX_DUMPS` dumps are kept.
+ *
+ * Stalls only matter while the launcher is visible, the watchdog sleeps otherwise (see `setWatching`).
+ */
+class StallWatchdog : public QObject {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr auto POLL_INTERVAL = std::chrono::milliseconds(50);
+  static constexpr auto STALL_THRESHOLD = std::chrono::milliseconds(200);
+  // a stall tends to be followed by others, which would only give the same dump
+  static constexpr auto DUMP_COOLDOWN = std::chrono::seconds(10);
+  static constexpr size_t MAX_DUMPS = 10;
+
+  void setWatching(bool watching);
+
+  /**
+   * To be created from the GUI thread.
+   */
+  StallWatchdog(std::filesystem::path dumpDir);
+  ~StallWatchdog();
+
+private:
+  void run();
+  void poll();
+  void dump(Clock::duration stalledFor);
+  void removeOldDumps();
+
+  /**
+   * Symbolized frames of the GUI thread, interrupted with a signal. Empty if it could not be.
+   */
+  QStringList captureGuiStack();
+
+  std::filesystem::path m_dumpDir;
+  pthread_t m_guiThread;
+  std::atomic<bool> m_pong = false;
+
+  // only accessed from the watchdog thread
+  std::optional<Clock::time_point> m_pingSentAt;
+  std::optional<Clock::time_point> m_lastDump;
+  bool m_stalled = false;
+
+  bool m_alive = true;
+  bool m_watching = false;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::thread m_thread;
+};
@@ -0,0 +1,206 @@
+#include "trace/trace.hpp"
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonDocument>
+#include <QThread>
+#include <unistd.h>
+
+using std::chrono::duration;
+
+Tracer &Tracer::instance() {
+  static Tracer tracer;
+
+  return tracer;
+}
+
+Tracer::ThreadBuffer &Tracer::threadBuffer() {
+  // shared with the tracer, which keeps the buffer of a thread that exits until it is written
+  thread_local std::shared_ptr<ThreadBuffer> buffer;
+
+  if (!buffer) {
+    auto thread = QThread::currentThread();
+    std::lock_guard lock(m_mutex);
+
+    // buffers of threads that exited are otherwise only released once a trace is stopped, while the flight
+    // recorder keeps getting new ones from the threads pools start and expire
+    if (!isEnabled()) {
+      std::erase_if(m_buffers, [](const auto &entry) { return entry.use_count() == 1; });
+    }
+
+    buffer = std::make_shared<ThreadBuffer>();
+    buffer->tid = m_nextTid++;
+
+    if (qApp && thread == qApp->thread()) {
+      buffer->name = "main";
+    } else if (thread && !thread->objectName().isEmpty()) {
+      buffer->name = thread->objectName();
+    } else {
+      buffer->name = QString("thread %1").arg(buffer->tid);
+    }
+
+    m_buffers.emplace_back(buffer);
+  }
+
+  return *buffer;
+}
+
+void Tracer::record(const char *category, const char *name, Clock::time_point start, Clock::time_point end) {
+  bool tracing = isEnabled();
+  bool flightRecording = s_flightRecorderEnabled.load(std::memory_order_relaxed);
+
+  if (!tracing && !flightRecording) return;
+
+  auto &buffer = threadBuffer();
+  Event event{.category = category, .name = name, .start = start, .end = end};
+  std::lock_guard lock(buffer.mutex);
+
+  if (flightRecording) {
+    if (buffer.ring.size() < FLIGHT_RECORDER_EVENTS_PER_THREAD) {
+      buffer.ring.emplace_back(event);
+    } else {
+      buffer.ring[buffer.ringNext] = event;
+      buffer.ringNext = (buffer.ringNext + 1) % FLIGHT_RECORDER_EVENTS_PER_THREAD;
+    }
+  }
+
+  if (!tracing) return;
+
+  if (buffer.events.size() >= MAX_EVENTS_PER_THREAD) {
+    ++buffer.dropped;
+    return;
+  }
+
+  buffer.events.emplace_back(event);
+}
+
+size_t Tracer::appendEvents(QJsonArray &out, const ThreadBuffer &buffer, const std::vector<Event> &events,
+                            Clock::time_point since) {
+  qint64 pid = getpid();
+  auto tid = static_cast<qint64>(buffer.tid);
+  size_t count = 0;
+
+  for (const auto &event : events) {
+    if (event.end < since) continue;
+
+    if (count == 0) {
+      out.append(QJsonObject{{"ph", "M"},
+                             {"name", "thread_name"},
+                             {"pid", pid},
+                             {"tid", tid},
+                             {"args", QJsonObject{{"name", buffer.name}}}});
+    }
+
+    // microseconds, fractional so that short scopes do not all end up lasting 0
+    double ts = duration<double, std::micro>(event.start - since).count();
+    double dur = duration<double, std::micro>(event.end - event.start).count();
+
+    out.append(QJsonObject{{"ph", "X"},
+                           {"cat", event.category},
+                           {"name", event.name},
+                           {"pid", pid},
+                           {"tid", tid},
+                           {"ts", ts},
+                           {"dur", dur}});
+    ++count;
+  }
+
+  return count;
+}
+
+std::expected<void, QString> Tracer::writeTrace(const std::filesystem::path &path, QJsonObject trace) {
+  QFile file(path);
+
+  trace["displayTimeUnit"] = "ms";
+
+  if (!file.open(QIODevice::WriteOnly)) {
+    return std::unexpected(QString("Failed to open %1: %2").arg(path.c_str()).arg(file.errorString()));
+  }
+
+  if (file.write(QJsonDocument(trace).toJson(QJsonDocument::Compact)) == -1) {
+    return std::unexpected(QString("Failed to write %1: %2").arg(path.c_str()).arg(file.errorString()));
+  }
+
+  return {};
+}
+
+void Tracer::start() {
+  std::lock_guard lock(m_mutex);
+
+  for (auto &buffer : m_buffers) {
+    std::lock_guard bufferLock(buffer->mutex);
+
+    buffer->events.clear();
+    buffer->dropped = 0;
+  }
+
+  m_startedAt = Clock::now();
+  s_enabled.store(true, std::memory_order_relaxed);
+}
+
+std::expected<size_t, QString> Tracer::stop(const std::filesystem::path &path) {
+  if (!isEnabled()) return std::unexpected("Tracing is not started");
+
+  s_enabled.store(false, std::memory_order_relaxed);
+
+  std::lock_guard lock(m_mutex);
+  QJsonArray events;
+  size_t count = 0;
+
+  for (auto &buffer : m_buffers) {
+    std::lock_guard bufferLock(buffer->mutex);
+
+    count += appendEvents(events, *buffer, buffer->events, m_startedAt);
+
+    if (buffer->dropped > 0) {
+      qWarning() << "Dropped" << buffer->dropped << "trace events of" << buffer->name
+                 << "as its buffer was full";
+    }
+
+    buffer->events = {};
+    buffer->dropped = 0;
+  }
+
+  // buffers of threads that exited since are no longer referenced by them
+  std::erase_if(m_buffers, [](const auto &buffer) { return buffer.use_count() == 1; });
+
+  if (auto result = writeTrace(path, {{"traceEvents", events}}); !result) {
+    return std::unexpected(result.error());
+  }
+
+  return count;
+}
+
+void Tracer::setFlightRecorderEnabled(bool enabled) {
+  std::lock_guard lock(m_mutex);
+
+  s_flightRecorderEnabled.store(enabled, std::memory_order_relaxed);
+
+  if (enabled) return;
+
+  for (auto &buffer : m_buffers) {
+    std::lock_guard bufferLock(buffer->mutex);
+
+    buffer->ring = {};
+    buffer->ringNext = 0;
+  }
+}
+
+std::expected<size_t, QString> Tracer::dumpFlightRecorder(const std::filesystem::path &path,
+                                                          const QJsonObject &metadata) {
+  auto since = Clock::now() - FLIGHT_RECORDER_WINDOW;
+  std::lock_guard lock(m_mutex);
+  QJsonArray events;
+  size_t count = 0;
+
+  for (auto &buffer : m_buffers) {
+    std::lock_guard bufferLock(buffer->mutex);
+
+    count += appendEvents(events, *buffer, buffer->ring, since);
+  }
+
+  if (auto result = writeTrace(path, {{"traceEvents", events}, {"metadata", metadata}}); !result) {
+    return std::unexpected(result.error());
+  }
+
+  return count;
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QString>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/**
+ * Scoped trace events of the daemon, recorded in memory while tracing is started and written as a Chrome
+ * trace once it is stopped, which is what Perfetto and chrome://tracing open.
+ *
+ * Checking whether tracing is started is a relaxed atomic load, instrumented scopes cost about nothing
+ * otherwise. Events are recorded in a buffer owned by the thread they happen on, so that threads do not
+ * contend with each other while they record them.
+ *
+ * The flight recorder keeps the most recent events of every thread in a ring regardless of tracing being
+ * started, so that what led to a freeze can be dumped after the fact (see StallWatchdog).
+ */
+class Tracer {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  static Tracer &instance();
+
+  static constexpr auto FLIGHT_RECORDER_WINDOW = std::chrono::seconds(5);
+
+  static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+  /**
+   * Whether scopes need to be timed, for a started trace or the flight recorder.
+   */
+  static bool isRecording() {
+    return isEnabled() || s_flightRecorderEnabled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Start recording events, discarding those recorded by a previous trace that was not stopped.
+   */
+  void start();
+
+  /**
+   * Stop recording events and write them to `path`. Returns the number of events that were written.
+   */
+  std::expected<size_t, QString> stop(const std::filesystem::path &path);
+
+  void setFlightRecorderEnabled(bool enabled);
+
+  /**
+   * Write the events recorded by the flight recorder over the last `FLIGHT_RECORDER_WINDOW` to `path`, with
+   * `metadata` alongside them. Returns the number of events that were written.
+   */
+  std::expected<size_t, QString> dumpFlightRecorder(const std::filesystem::path &path,
+                                                    const QJsonObject &metadata = {});
+
+  /**
+   * `category` and `name` are expected to be static strings.
+   */
+  void record(const char *category, const char *name, Clock::time_point start, Clock::time_point end);
+
+private:
+  // about 32MB worth of events per thread, events past that are dropped
+  static constexpr size_t MAX_EVENTS_PER_THREAD = 1 << 20;
+  // about 64KB per thread, which covers the window of the recorder unless the thread is very busy
+  static constexpr size_t FLIGHT_RECORDER_EVENTS_PER_THREAD = 2048;
+
+  struct Event {
+    const char *category;
+    const char *name;
+    Clock::time_point start;
+    Clock::time_point end;
+  };
+
+  struct ThreadBuffer {
+    std::mutex mutex;
+    uint64_t tid;
+    QString name;
+    std::vector<Event> events;
+    size_t dropped = 0;
+    // flight recorder events, the oldest one being overwritten by the next one once it is full
+    std::vector<Event> ring;
+    size_t ringNext = 0;
+  };
+
+  static inline std::atomic<bool> s_enabled = false;
+  static inline std::atomic<bool> s_flightRecorderEnabled = false;
+
+  /**
+   * Append the events of `buffer` that ended after `since` as Chrome trace events, timestamped from it.
+   * Returns how many were.
+   */
+  static size_t appendEvents(QJsonArray &out, const ThreadBuffer &buffer, const std::vector<Event> &events,
+                             Clock::time_point since);
+  static std::expected<void, QString> writeTrace(const std::filesystem::path &path, QJsonObject trace);
+
+  ThreadBuffer &threadBuffer();
+
+  std::mutex m_mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+  Clock::time_point m_startedAt;
+  uint64_t m_nextTid = 1;
+};
+
+/**
+ * Records the scope it lives for as a trace event, if tracing is started when it is entered.
+ */
+class TraceScope {
+public:
+  TraceScope(const char *category, const char *name) : m_category(category), m_name(name) {
+    if (Tracer::isRecording()) { m_start = Tracer::Clock::now(); }
+  }
+
+  ~TraceScope() {
+    if (m_start) { Tracer::instance().record(m_category, m_name, *m_start, Tracer::Clock::now()); }
+  }
+
+  TraceScope(const TraceScope &) = delete;
+  TraceScope &operator=(const TraceScope &) = delete;
+
+private:
+  const char *m_category;
+  const char *m_name;
+  std::optional<Tracer::Clock::time_point> m_start;
+};
@@ -0,0 +1,66 @@
+#include "lib/typo-index.hpp"
+#include <algorithm>
+#include <qhashfunctions.h>
+
+namespace {
+
+/**
+ * Call `fn` with the hash of `word` and of every variant of it with one character deleted.
+ */
+template <typename Fn> void forEachVariant(QStringView word, QString &buffer, Fn &&fn) {
+  fn(static_cast<uint32_t>(qHash(word)));
+
+  for (qsizetype i = 0; i != word.size(); ++i) {
+    buffer.clear();
+    buffer.append(word.first(i));
+    buffer.append(word.sliced(i + 1));
+    fn(static_cast<uint32_t>(qHash(buffer)));
+  }
+}
+
+} // namespace
+
+void TypoIndex::add(uint32_t document, QStringView word) {
+  QString buffer;
+  auto addPosting = [&](uint32_t key) { m_postings.push_back({.key = key, .document = document}); };
+
+  // a query prefix of n characters is within one edit of word prefixes of n - 1 to n + 1 characters
+  qsizetype maxLength = std::min(word.size(), MAX_PREFIX_LENGTH + 1);
+
+  for (qsizetype length = MIN_WORD_LENGTH - 1; length <= maxLength; ++length) {
+    forEachVariant(word.first(length), buffer, addPosting);
+  }
+}
+
+void TypoIndex::build() {
+  auto key = [](const Posting &posting) { return std::pair(posting.key, posting.document); };
+
+  std::ranges::sort(m_postings, {}, key);
+
+  auto duplicates = std::ranges::unique(m_postings, {}, key);
+
+  m_postings.erase(duplicates.begin(), duplicates.end());
+  m_postings.shrink_to_fit();
+}
+
+void TypoIndex::clear() { m_postings.clear(); }
+
+std::vector<uint32_t> TypoIndex::candidates(QStringView word) const {
+  std::vector<uint32_t> documents;
+  QString buffer;
+
+  if (word.size() < MIN_WORD_LENGTH) return documents;
+
+  forEachVariant(word.first(std::min(word.size(), MAX_PREFIX_LENGTH)), buffer, [&](uint32_t key) {
+    auto range = std::ranges::equal_range(m_postings, key, {}, &Posting::key);
+
+    for (const auto &posting : range) {
+      documents.emplace_back(posting.document);
+    }
+  });
+
+  std::ranges::sort(documents);
+  documents.erase(std::ranges::unique(documents).begin(), documents.end());
+
+  return documents;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <qstring.h>
+#include <qstringview.h>
+#include <vector>
+
+/**
+ * Finds the documents having a word that is a typo away from a query word, without comparing the query to
+ * every word ("firfox" -> "firefox", "spotfy" -> "spotify").
+ *
+ * This is a deletion neighbourhood index, as popularized by SymSpell: every word is stored along with the
+ * variants obtained by deleting one of its characters, and so are queries when they are looked up. Two words
+ * within one edit of each other (insertion, deletion, substitution or transposition) always share one of
+ * these variants, so a lookup is a handful of binary searches.
+ *
+ * Queries are matched against the prefixes of the words, as they are typed, and only up to
+ * `MAX_PREFIX_LENGTH` characters. The index only narrows down the candidates: variants are hashed and a
+ * shared variant does not make a good match on its own, the candidates are expected to be scored afterwards.
+ */
+class TypoIndex {
+public:
+  // shorter words are one edit away from too many others for typos to be told apart
+  static constexpr qsizetype MIN_WORD_LENGTH = 4;
+  static constexpr qsizetype MAX_PREFIX_LENGTH = 6;
+
+  /**
+   * `word` is expected to be normalized. `build` needs to be called once all the words are added.
+   */
+  void add(uint32_t document, QStringView word);
+  void build();
+  void clear();
+
+  /**
+   * The documents with a word starting within one edit of `word`, which is expected to be normalized, in
+   * ascending order. Words shorter than `MIN_WORD_LENGTH` have none.
+   */
+  std::vector<uint32_t> candidates(QStringView word) const;
+
+  /**
+   * Approximate heap memory used by the index, in bytes.
+   */
+  size_t memUsage() const { return m_postings.capacity() * sizeof(Posting); }
+
+private:
+  struct Posting {
+    uint32_t key;
+    uint32_t document;
+  };
+
+  std::vector<Posting> m_postings;
+};
@@ -1,101 +1,238 @@
 #include "unzip.hpp"
+#include <QtConcurrent/QtConcurrent>
+#include <cstring>
+#include <numeric>
+#include <minizip/ioapi.h>
 #include <qlogging.h>
 
 namespace fs = std::filesystem;
 
-bool UnzipHandle::positionToIndex(int idx) {
-  if (info.number_entry <= idx) {
-    qCritical() << "Invalid idx" << idx;
-    return false;
+namespace {
+
+/**
+ * Memory I/O for minizip: every open handle gets a cursor of its own over the same buffer.
+ */
+struct MemoryStream {
+  std::string_view data;
+  ZPOS64_T offset = 0;
+};
+
+voidpf ZCALLBACK memoryOpen(voidpf opaque, const void *, int mode) {
+  if (mode & ZLIB_FILEFUNC_MODE_WRITE) return nullptr;
+
+  return new MemoryStream{.data = *static_cast<const std::string_view *>(opaque)};
+}
+
+uLong ZCALLBACK memoryRead(voidpf, voidpf stream, void *buffer, uLong size) {
+  auto memory = static_cast<MemoryStream *>(stream);
+  uLong count = std::min<ZPOS64_T>(size, memory->data.size() - memory->offset);
+
+  std::memcpy(buffer, memory->data.data() + memory->offset, count);
+  memory->offset += count;
+
+  return count;
+}
+
+uLong ZCALLBACK memoryWrite(voidpf, voidpf, const void *, uLong) { return 0; }
+
+ZPOS64_T ZCALLBACK memoryTell(voidpf, voidpf stream) { return static_cast<MemoryStream *>(stream)->offset; }
+
+long ZCALLBACK memorySeek(voidpf, voidpf stream, ZPOS64_T offset, int origin) {
+  auto memory = static_cast<MemoryStream *>(stream);
+  ZPOS64_T base = 0;
+
+  switch (origin) {
+  case ZLIB_FILEFUNC_SEEK_SET:
+    break;
+  case ZLIB_FILEFUNC_SEEK_CUR:
+    base = memory->offset;
+    break;
+  case ZLIB_FILEFUNC_SEEK_END:
+    base = memory->data.size();
+    break;
+  default:
+    return -1;
   }
 
-  unzGoToFirstFile(file);
+  if (base + offset > memory->data.size()) return -1;
+
+  memory->offset = base + offset;
+
+  return 0;
+}
+
+int ZCALLBACK memoryClose(voidpf, voidpf stream) {
+  delete static_cast<MemoryStream *>(stream);
+  return 0;
+}
+
+int ZCALLBACK memoryError(voidpf, voidpf) { return 0; }
 
-  for (int i = 0; i != idx; ++i) {
-    unzGoToNextFile(file);
+/**
+ * `path` with its first `count` components removed, or nothing if it would get out of the directory it is
+ * extracted to.
+ */
+std::optional<fs::path> stripComponents(const fs::path &path, int count) {
+  fs::path stripped;
+
+  for (const auto &component : path | std::views::drop(count)) {
+    if (component == "..") return std::nullopt;
+    stripped /= component;
   }
 
-  return true;
+  if (stripped.empty() || stripped.is_absolute()) return std::nullopt;
+
+  return stripped;
 }
 
-ZipedFile::ZipedFile(UnzipHandle handle, const std::filesystem::path &path, int idx)
-    : m_handle(handle), m_path(path), m_idx(idx) {}
+} // namespace
 
-std::string ZipedFile::readAll() {
-  m_handle.positionToIndex(m_idx);
+ZipedFile::ZipedFile(UnzipHandle handle, const std::filesystem::path &path, unz64_file_pos position)
+    : m_handle(handle), m_path(path), m_position(position) {}
 
+std::string ZipedFile::readAll() {
   std::array<char, 8192> buffer;
   std::string data;
   int bytesRead;
 
-  if (unzOpenCurrentFile(m_handle.file) != UNZ_OK) {
+  if (unzGoToFilePos64(m_handle.file, &m_position) != UNZ_OK || unzOpenCurrentFile(m_handle.file) != UNZ_OK) {
     qWarning() << "Failed to open ziped file" << path();
     return {};
   }
 
   while ((bytesRead = unzReadCurrentFile(m_handle.file, buffer.data(), buffer.size())) > 0) {
-    data += std::string(buffer.data(), bytesRead);
+    data.append(buffer.data(), bytesRead);
   }
 
+  unzCloseCurrentFile(m_handle.file);
+
   return data;
 }
 
-void Unzipper::extract(const std::filesystem::path &target, const Unzipper::ExtractOptions &opts) {
-  int sc = opts.stripComponents.value_or(0);
+unzFile Unzipper::open() const {
+  if (m_path) return unzOpen64(m_path->c_str());
 
-  for (auto &file : listFiles()) {
-    fs::path stripedFilePath =
-        std::ranges::fold_left(fs::path(file.path()) | std::views::drop(sc), fs::path(),
-                               [](auto &&p1, auto &&p2) { return p1 / p2; });
+  zlib_filefunc64_def functions{.zopen64_file = memoryOpen,
+                                .zread_file = memoryRead,
+                                .zwrite_file = memoryWrite,
+                                .ztell64_file = memoryTell,
+                                .zseek64_file = memorySeek,
+                                .zclose_file = memoryClose,
+                                .zerror_file = memoryError,
+                                .opaque = const_cast<std::string_view *>(&m_data)};
 
-    std::filesystem::path path = target / stripedFilePath;
-    std::filesystem::create_directories(path.parent_path());
-    std::ofstream ofs(path);
-    auto data = file.readAll();
-
-    ofs.write(data.data(), data.size());
-  }
+  // the name is only passed back to the open callback, which does not need it
+  return unzOpen2_64("memory", &functions);
 }
 
-std::vector<ZipedFile> Unzipper::listFiles() {
-  if (!m_handle.file) return {};
+std::vector<Unzipper::Entry> Unzipper::entries() {
+  std::vector<Entry> entries;
+
+  if (!m_handle.file) return entries;
 
-  std::vector<ZipedFile> files;
+  entries.reserve(m_handle.info.number_entry);
 
-  files.reserve(m_handle.info.number_entry);
-  unzGoToFirstFile(m_handle.file);
+  for (int status = unzGoToFirstFile(m_handle.file); status == UNZ_OK;
+       status = unzGoToNextFile(m_handle.file)) {
+    unz_file_info64 fileInfo;
+    Entry entry;
+
+    if (unzGetCurrentFileInfo64(m_handle.file, &fileInfo, nullptr, 0, nullptr, 0, nullptr, 0) != UNZ_OK) {
+      continue;
+    }
 
-  for (int i = 0; i != m_handle.info.number_entry; ++i) {
-    unz_file_info fileInfo;
-    char filename[256];
+    entry.name.resize(fileInfo.size_filename);
 
-    if (unzGetCurrentFileInfo(m_handle.file, &fileInfo, filename, sizeof(filename), nullptr, 0, nullptr, 0) !=
-        UNZ_OK) {
+    if (unzGetCurrentFileInfo64(m_handle.file, nullptr, entry.name.data(), entry.name.size(), nullptr, 0,
+                                nullptr, 0) != UNZ_OK ||
+        unzGetFilePos64(m_handle.file, &entry.position) != UNZ_OK) {
       continue;
     }
 
-    files.emplace_back(ZipedFile(m_handle, filename, i));
-    unzGoToNextFile(m_handle.file);
+    entries.emplace_back(std::move(entry));
   }
 
-  return files;
+  return entries;
 }
 
-Unzipper::Unzipper(std::string_view path) {
-  m_tmpFile = std::make_unique<QTemporaryFile>();
-  if (!m_tmpFile->open()) {
-    qCritical() << "Failed to open unzip temp file";
-    return;
+bool Unzipper::extractEntry(unzFile file, const Entry &entry, const fs::path &path) {
+  std::error_code ec;
+
+  if (entry.name.ends_with('/')) {
+    fs::create_directories(path, ec);
+    return !ec;
+  }
+
+  fs::create_directories(path.parent_path(), ec);
+
+  if (unzGoToFilePos64(file, &entry.position) != UNZ_OK || unzOpenCurrentFile(file) != UNZ_OK) {
+    qWarning() << "Failed to open ziped file" << entry.name.c_str();
+    return false;
+  }
+
+  std::array<char, 64 * 1024> buffer;
+  std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+  int bytesRead;
+
+  while ((bytesRead = unzReadCurrentFile(file, buffer.data(), buffer.size())) > 0) {
+    ofs.write(buffer.data(), bytesRead);
   }
 
-  m_tmpFile->write(path.data(), path.size());
-  m_handle.file = unzOpen(m_tmpFile->filesystemFileName().c_str());
-  unzGetGlobalInfo(m_handle.file, &m_handle.info);
+  // also checks the CRC of what was read
+  bool ok = bytesRead == 0 && unzCloseCurrentFile(file) == UNZ_OK && ofs.good();
+
+  if (!ok) { qWarning() << "Failed to extract ziped file" << entry.name.c_str() << "to" << path.c_str(); }
+
+  return ok;
+}
+
+bool Unzipper::extract(const std::filesystem::path &target, const Unzipper::ExtractOptions &opts) {
+  auto entries = this->entries();
+  size_t threadCount = std::clamp<size_t>(entries.size() / MIN_ENTRIES_PER_THREAD, 1,
+                                          QThreadPool::globalInstance()->maxThreadCount());
+  std::vector<size_t> shares(threadCount);
+  std::atomic<bool> ok = true;
+
+  std::iota(shares.begin(), shares.end(), 0);
+
+  QtConcurrent::blockingMap(shares, [&](size_t share) {
+    unzFile file = open();
+
+    if (!file) {
+      ok = false;
+      return;
+    }
+
+    // entries are interleaved between threads, so that big files in a row do not all fall to the same one
+    for (size_t i = share; i < entries.size(); i += threadCount) {
+      auto &entry = entries[i];
+      auto path = stripComponents(entry.name, opts.stripComponents.value_or(0));
+
+      if (!path) continue;
+      if (!extractEntry(file, entry, target / *path)) ok = false;
+    }
+
+    unzClose(file);
+  });
+
+  return ok;
+}
+
+std::vector<ZipedFile> Unzipper::listFiles() {
+  return entries() | std::views::transform([&](const Entry &entry) {
+           return ZipedFile(m_handle, entry.name, entry.position);
+         }) |
+         std::ranges::to<std::vector>();
+}
+
+Unzipper::Unzipper(std::string_view data) : m_data(data) {
+  m_handle.file = open();
+  if (m_handle.file) unzGetGlobalInfo64(m_handle.file, &m_handle.info);
 }
 
-Unzipper::Unzipper(const std::filesystem::path &path) {
-  m_handle.file = unzOpen(path.c_str());
-  unzGetGlobalInfo(m_handle.file, &m_handle.info);
+Unzipper::Unzipper(const std::filesystem::path &path) : m_path(path) {
+  m_handle.file = open();
+  if (m_handle.file) unzGetGlobalInfo64(m_handle.file, &m_handle.info);
 }
 
 Unzipper::~Unzipper() {
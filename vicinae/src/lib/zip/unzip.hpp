@@ -12,25 +12,28 @@
 
 struct UnzipHandle {
   unzFile file = nullptr;
-  unz_global_info info;
-
-public:
-  bool positionToIndex(int idx);
+  unz_global_info64 info;
 };
 
 class ZipedFile {
   UnzipHandle m_handle;
   std::filesystem::path m_path;
-  int m_idx;
+  unz64_file_pos m_position;
 
 public:
   const std::filesystem::path path() const { return m_path; }
   std::string readAll();
 
 public:
-  ZipedFile(UnzipHandle handle, const std::filesystem::path &path, int idx);
+  ZipedFile(UnzipHandle handle, const std::filesystem::path &path, unz64_file_pos position);
 };
 
+/**
+ * Archives are read either from a file or straight from memory, through minizip's I/O callbacks.
+ *
+ * Extraction is spread over several threads, each of them reading its share of the entries with an archive
+ * handle of its own, as a single handle can only be read from one thread at a time.
+ */
 class Unzipper {
 
 public:
@@ -38,19 +41,39 @@ public:
     std::optional<int> stripComponents;
   };
 
+  // archives with fewer entries than this are not worth extracting in parallel
+  static constexpr size_t MIN_ENTRIES_PER_THREAD = 16;
+
 private:
+  struct Entry {
+    std::string name;
+    unz64_file_pos position;
+  };
+
   UnzipHandle m_handle;
-  std::unique_ptr<QTemporaryFile> m_tmpFile;
+  std::optional<std::filesystem::path> m_path;
+  std::string_view m_data;
+
+  /**
+   * A new handle on the archive, to be closed with `unzClose`.
+   */
+  unzFile open() const;
+  std::vector<Entry> entries();
+  static bool extractEntry(unzFile file, const Entry &entry, const std::filesystem::path &path);
 
 public:
   operator bool() const { return m_handle.file; }
 
-  void extract(const std::filesystem::path &target, const ExtractOptions &opts = {});
+  /**
+   * Returns false if any entry failed to be extracted, in which case the ones that were stay in `target`.
+   */
+  bool extract(const std::filesystem::path &target, const ExtractOptions &opts = {});
   std::vector<ZipedFile> listFiles();
 
-  // Handling memory reading directly can be quite tricky so we use a temp file instead
-  // to keep things simple.
-  Unzipper(std::string_view path);
+  /**
+   * `data` is read in place, and must outlive the unzipper.
+   */
+  Unzipper(std::string_view data);
   Unzipper(const std::filesystem::path &path);
 
   ~Unzipper();
@@ -0,0 +1,68 @@
+#include "zstd/zstd.hpp"
+#include <memory>
+#include <qlogging.h>
+#include <zstd.h>
+
+namespace Zstd {
+
+QByteArray compress(QByteArrayView data, int level) {
+  QByteArray compressed(ZSTD_compressBound(data.size()), Qt::Uninitialized);
+  size_t size = ZSTD_compress(compressed.data(), compressed.size(), data.data(), data.size(), level);
+
+  if (ZSTD_isError(size)) {
+    qWarning() << "Failed to compress data:" << ZSTD_getErrorName(size);
+    return {};
+  }
+
+  compressed.resize(size);
+
+  return compressed;
+}
+
+QByteArray decompressFrom(QIODevice &device, qsizetype maxSize) {
+  std::unique_ptr<ZSTD_DStream, decltype(&ZSTD_freeDStream)> stream(ZSTD_createDStream(), ZSTD_freeDStream);
+  QByteArray input(ZSTD_DStreamInSize(), Qt::Uninitialized);
+  QByteArray output;
+  size_t outputChunk = ZSTD_DStreamOutSize();
+  // the frame is done once it returns 0, there is no telling it apart from an empty one otherwise
+  size_t remaining = 1;
+
+  if (!stream) return {};
+
+  while (remaining != 0 && (maxSize < 0 || output.size() < maxSize)) {
+    qint64 read = device.read(input.data(), input.size());
+
+    if (read <= 0) {
+      qWarning() << "Compressed data ended before the end of its frame";
+      return {};
+    }
+
+    ZSTD_inBuffer in{.src = input.data(), .size = static_cast<size_t>(read), .pos = 0};
+    // a full output buffer may leave decompressed data behind, even once all of the input is consumed
+    bool flushed = false;
+
+    while ((in.pos < in.size || !flushed) && remaining != 0 && (maxSize < 0 || output.size() < maxSize)) {
+      qsizetype offset = output.size();
+
+      output.resize(offset + outputChunk);
+
+      ZSTD_outBuffer out{.dst = output.data() + offset, .size = outputChunk, .pos = 0};
+
+      remaining = ZSTD_decompressStream(stream.get(), &out, &in);
+
+      if (ZSTD_isError(remaining)) {
+        qWarning() << "Failed to decompress data:" << ZSTD_getErrorName(remaining);
+        return {};
+      }
+
+      output.resize(offset + out.pos);
+      flushed = out.pos < out.size;
+    }
+  }
+
+  if (maxSize >= 0 && output.size() > maxSize) { output.truncate(maxSize); }
+
+  return output;
+}
+
+} // namespace Zstd
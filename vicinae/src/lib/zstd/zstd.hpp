@@ -0,0 +1,20 @@
+#pragma once
+#include <QByteArray>
+#include <QIODevice>
+
+namespace Zstd {
+// text compresses well even at low levels, higher ones cost a lot more time for little gain
+static constexpr int DEFAULT_LEVEL = 3;
+
+/**
+ * Compress `data` into a single zstd frame. Returns an empty array on failure.
+ */
+QByteArray compress(QByteArrayView data, int level = DEFAULT_LEVEL);
+
+/**
+ * Decompress the frame making up the rest of `device`, reading it in chunks: the compressed data is never
+ * held as a whole. Decompression stops once `maxSize` bytes are out, if set, leaving the rest of the frame
+ * unread. Returns an empty array on failure.
+ */
+QByteArray decompressFrom(QIODevice &device, qsizetype maxSize = -1);
+} // namespace Zstd
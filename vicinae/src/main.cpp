@@ -1,23 +1,35 @@
 #include "command-controller.hpp"
 #include "daemon/ipc-client.hpp"
+#include "daemon/posix-ipc-client.hpp"
 #include "favicon/favicon-service.hpp"
 #include "navigation-controller.hpp"
 #include "pid-file/pid-file.hpp"
 #include "ui/launcher-window/launcher-window.hpp"
 #include <QStyleHints>
 #include "common.hpp"
+#include "crypto-benchmark.hpp"
+#include "ui/omni-list/omni-list-benchmark.hpp"
 #include "ipc-command-server.hpp"
 #include "ipc-command-handler.hpp"
 #include "overlay-controller/overlay-controller.hpp"
 #include "services/app-service/app-service.hpp"
 #include "command-database.hpp"
 #include "root-search/apps/app-root-provider.hpp"
+#include "root-search/calculator/calculator-search-source.hpp"
+#include "root-search/files/file-search-source.hpp"
 #include "services/shortcut/shortcut-service.hpp"
 #include <QApplication>
 #include "services/calculator-service/calculator-service.hpp"
 #include "services/clipboard/clipboard-service.hpp"
 #include "services/config/config-service.hpp"
 #include "font-service.hpp"
+#include "memory-budget/memory-budget.hpp"
+#include "trace/stall-watchdog.hpp"
+#include "trace/trace.hpp"
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QFontDatabase>
 #include <QSurfaceFormat>
 #include <memory>
@@ -26,10 +38,12 @@
 #include "root-extension-manager.hpp"
 #include <QXmlStreamReader>
 #include <QtSql/qsqldatabase.h>
+#include <algorithm>
 #include <arpa/inet.h>
 #include <csignal>
 #include <filesystem>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <qapplication.h>
 #include <qbuffer.h>
@@ -46,129 +60,324 @@
 #include <qtmetamacros.h>
 #include "extension/manager/extension-manager.hpp"
 #include "services/emoji-service/emoji-service.hpp"
+#include "services/extension-cache/extension-cache-service.hpp"
 #include "services/extension-registry/extension-registry.hpp"
 #include "services/files-service/file-service.hpp"
 #include "services/local-storage/local-storage-service.hpp"
 #include "vicinae.hpp"
 #include "process-manager-service.hpp"
 #include "services/oauth/oauth-service.hpp"
+#include "services/raycast/extension-update-checker.hpp"
 #include "services/raycast/raycast-store.hpp"
 #include "services/root-item-manager/root-item-manager.hpp"
 #include "root-search/apps/app-root-provider.hpp"
 #include "root-search/shortcuts/shortcut-root-provider.hpp"
 #include "service-registry.hpp"
+#include "omni-database.hpp"
 #include "services/toast/toast-service.hpp"
+#include "utils/utils.hpp"
 #include "settings-controller/settings-controller.hpp"
 #include "settings/settings-window.hpp"
 #include "theme.hpp"
 #include "log/message-handler.hpp"
 #include "lib/pid-file/pid-file.hpp"
+#include "startup-benchmark.hpp"
+#include <QTemporaryDir>
+#include <unistd.h>
+
+/**
+ * What is released once the launcher has been hidden for a while, on top of what `MemoryBudget` trims.
+ * The root view is kept as is, for the launcher to show up as fast as ever.
+ */
+static void releaseIdleMemory(ApplicationContext &ctx) {
+  auto services = ctx.services;
+
+  if (services->config()->value().memory.popToRootWhenIdle && !ctx.navigation->isWindowOpened()) {
+    ctx.navigation->popToRoot({.clearSearch = false});
+  }
 
-int startDaemon() {
-  std::filesystem::create_directories(Omnicast::runtimeDir());
-  PidFile pidFile(Omnicast::APP_ID.toStdString());
+  services->omniDb()->shrinkMemory();
+  services->clipman()->shrinkMemory();
+  services->fileService()->indexer()->shrinkMemory();
+}
 
-  if (pidFile.exists() && pidFile.kill()) { qInfo() << "Killed existing vicinae instance"; }
+static void applyMemoryBudgets(const ConfigService::Value &config) {
+  using Subsystem = MemoryBudget::Subsystem;
+  constexpr size_t MB = 1024 * 1024;
+  auto &memory = MemoryBudget::instance();
+  auto budget = [](int value, size_t unit) -> std::optional<size_t> {
+    if (value < 0) return std::nullopt;
+    return value * unit;
+  };
+
+  memory.setTrimDelay(std::chrono::seconds(config.memory.trimDelay));
+  memory.setBudget(Subsystem::ImageCache, budget(config.memory.imageCacheBudget, MB));
+  memory.setBudget(Subsystem::FaviconCache, budget(config.memory.faviconCacheBudget, MB));
+  memory.setBudget(Subsystem::ListWidgetPools, budget(config.memory.listWidgetPoolBudget, 1));
+}
 
-  pidFile.write(qApp->applicationPid());
+/**
+ * Domains of the favicons quicklinks are shown with, each only once.
+ */
+static std::vector<QString> shortcutFaviconDomains(const ShortcutService &shortcuts) {
+  std::vector<QString> domains;
 
-  {
-    auto registry = ServiceRegistry::instance();
-    auto omniDb = std::make_unique<OmniDatabase>(Omnicast::dataDir() / "vicinae.db");
-    auto localStorage = std::make_unique<LocalStorageService>(*omniDb);
-    auto rootItemManager = std::make_unique<RootItemManager>(*omniDb.get());
-    auto commandDb = std::make_unique<OmniCommandDatabase>();
-    auto extensionManager = std::make_unique<ExtensionManager>(*commandDb);
-    auto windowManager = std::make_unique<WindowManager>();
-    auto appService = std::make_unique<AppService>(*omniDb.get());
-    auto clipboardManager =
-        std::make_unique<ClipboardService>(Omnicast::dataDir() / "clipboard.db", *windowManager, *appService);
-    auto processManager = std::make_unique<ProcessManagerService>();
-    auto fontService = std::make_unique<FontService>();
-    auto configService = std::make_unique<ConfigService>();
-    auto shortcutService = std::make_unique<ShortcutService>(*omniDb.get());
-    auto toastService = std::make_unique<ToastService>();
-    auto currentConfig = configService->value();
-    auto rootExtMan = std::make_unique<RootExtensionManager>(*rootItemManager.get(), *commandDb.get());
-    auto emojiService = std::make_unique<EmojiService>(*omniDb.get());
-    auto calculatorService = std::make_unique<CalculatorService>(*omniDb.get());
-    auto fileService = std::make_unique<FileService>();
-    auto extensionRegistry = std::make_unique<ExtensionRegistry>(*commandDb, *localStorage);
-    auto raycastStore = std::make_unique<RaycastStoreService>();
+  for (const auto &shortcut : shortcuts.shortcuts()) {
+    ImageURL icon(shortcut->icon());
 
-#ifdef HAS_TYPESCRIPT_EXTENSIONS
-    if (!extensionManager->start()) {
-      qCritical() << "Failed to load extension manager. Extensions will not work";
-    }
-#else
-    qInfo() << "Not starting extension manager has support for typescript extensions has been disabled for "
-               "this build.";
-#endif
+    if (icon.type() == ImageURLType::Favicon) { domains.emplace_back(icon.name()); }
+  }
 
-    registry->setFileService(std::move(fileService));
-    registry->setToastService(std::move(toastService));
-    registry->setShortcutService(std::move(shortcutService));
-    registry->setConfig(std::move(configService));
-    registry->setRootItemManager(std::move(rootItemManager));
-    registry->setCalculatorService(std::move(calculatorService));
-    registry->setAppDb(std::move(appService));
-    registry->setOmniDb(std::move(omniDb));
-    registry->setCommandDb(std::move(commandDb));
-    registry->setLocalStorage(std::move(localStorage));
-    registry->setExtensionManager(std::move(extensionManager));
-    registry->setClipman(std::move(clipboardManager));
-    registry->setWindowManager(std::move(windowManager));
-    registry->setFontService(std::move(fontService));
-    registry->setEmojiService(std::move(emojiService));
-    registry->setRaycastStore(std::move(raycastStore));
-    registry->setExtensionRegistry(std::move(extensionRegistry));
-    registry->setOAuthService(std::make_unique<OAuthService>());
-
-    auto p = rootExtMan.get();
-
-    registry->setRootExtMan(std::move(rootExtMan));
-
-    p->start();
-
-    auto builtinCommandDb = std::make_unique<CommandDatabase>();
-
-    for (const auto &repo : builtinCommandDb->repositories()) {
-      registry->commandDb()->registerRepository(repo);
-    }
+  std::ranges::sort(domains);
+  domains.erase(std::ranges::unique(domains).begin(), domains.end());
 
-    auto reg = ServiceRegistry::instance()->extensionRegistry();
+  return domains;
+}
 
-    QObject::connect(reg, &ExtensionRegistry::extensionsChanged, [reg]() {
-      for (const auto &manifest : reg->scanAll()) {
-        auto extension = std::make_shared<Extension>(manifest);
+/**
+ * Type the benchmark query once the window is painted, then spawn the extension manager once the deferred
+ * services are started and the results are in, print the report and exit.
+ */
+static void driveStartupBenchmark(ApplicationContext &ctx, StartupScheduler &startup) {
+  auto &benchmark = StartupBenchmark::instance();
+  auto timer = new QTimer(qApp);
+
+  startup.startDeferred([&benchmark]() { benchmark.reach(StartupBenchmark::DEFERRED_STARTED); });
+  ctx.navigation->showWindow();
+
+  QObject::connect(timer, &QTimer::timeout, [&ctx, &benchmark, timer, searched = false]() mutable {
+    if (!searched && benchmark.hasReached(StartupBenchmark::WINDOW_PAINTED)) {
+      searched = true;
+      ctx.navigation->setSearchText(StartupBenchmark::QUERY);
+    }
 
-        ServiceRegistry::instance()->commandDb()->registerRepository(extension);
-      }
-    });
+    bool done = benchmark.hasReached(StartupBenchmark::DEFERRED_STARTED) &&
+                benchmark.hasReached(StartupBenchmark::FIRST_SEARCH_RESULT);
+    bool timedOut = benchmark.elapsed() > StartupBenchmark::TIMEOUT;
 
-    QObject::connect(reg, &ExtensionRegistry::extensionUninstalled, [reg](const QString &id) {
-      ServiceRegistry::instance()->commandDb()->removeRepository(id);
-    });
+    if (!done && !timedOut) return;
 
-    for (const auto &manifest : reg->scanAll()) {
-      auto extension = std::make_shared<Extension>(manifest);
+    timer->stop();
 
-      ServiceRegistry::instance()->commandDb()->registerRepository(extension);
-    }
+#ifdef HAS_TYPESCRIPT_EXTENSIONS
+    if (done) { ctx.services->extensionManager()->ensureStarted(); }
+#endif
 
-    // this one needs to be set last
+    if (timedOut) { qCritical() << "Startup benchmark timed out, the report is incomplete"; }
 
-    registry->rootItemManager()->addProvider(std::make_unique<AppRootProvider>(*registry->appDb()));
-    registry->rootItemManager()->addProvider(std::make_unique<ShortcutRootProvider>(*registry->shortcuts()));
+    std::cout << benchmark.report().toJson().toStdString() << std::flush;
+    qApp->exit(done ? 0 : 1);
+  });
+  timer->start(StartupBenchmark::POLL_INTERVAL);
+}
 
-    // Force reload providers to make sure items that depend on them are shown
-    registry->rootItemManager()->reloadProviders();
+int startDaemon() {
+  std::filesystem::create_directories(Omnicast::runtimeDir());
+  PidFile pidFile(Omnicast::APP_ID.toStdString());
 
-    // Start indexing after registerRepository() so that search paths are configured properly
-    registry->fileService()->indexer()->start();
-  }
+  if (pidFile.exists() && pidFile.kill()) { qInfo() << "Killed existing vicinae instance"; }
 
-  FaviconService::initialize(new FaviconService(Omnicast::dataDir() / "favicon"));
+  pidFile.write(qApp->applicationPid());
+
+  auto registry = ServiceRegistry::instance();
+  auto &startup = registry->startup();
+
+  using Stage = StartupScheduler::Stage;
+
+  startup.add("omni-db", Stage::Critical, [registry]() {
+    registry->setOmniDb(std::make_unique<OmniDatabase>(Omnicast::dataDir() / "vicinae.db"));
+  });
+  startup.add(
+      "local-storage", Stage::Critical,
+      [registry]() { registry->setLocalStorage(std::make_unique<LocalStorageService>(*registry->omniDb())); },
+      {"omni-db"});
+  // logs are only opened once an extension writes to its cache
+  startup.add("extension-cache", Stage::Critical,
+              [registry]() { registry->setExtensionCache(std::make_unique<ExtensionCacheService>()); });
+  startup.add(
+      "root-item-manager", Stage::Critical,
+      [registry]() { registry->setRootItemManager(std::make_unique<RootItemManager>(*registry->omniDb())); },
+      {"omni-db"});
+  startup.add(
+      "root-snapshot", Stage::Critical,
+      [registry]() {
+        auto manager = registry->rootItemManager();
+
+        manager->loadSnapshot(Omnicast::dataDir() / "root-items.snapshot");
+        // acting on an item of the snapshot needs the item it stands for
+        QObject::connect(manager, &RootItemManager::providersRequired,
+                         []() { ServiceRegistry::instance()->startup().require("root-providers"); });
+      },
+      {"root-item-manager"});
+  startup.add("command-db", Stage::Critical,
+              [registry]() { registry->setCommandDb(std::make_unique<OmniCommandDatabase>()); });
+  startup.add(
+      "extension-manager", Stage::Critical,
+      [registry]() {
+        registry->setExtensionManager(std::make_unique<ExtensionManager>(*registry->commandDb()));
+#ifdef HAS_TYPESCRIPT_EXTENSIONS
+        // extension commands are listed from their manifests, node is only needed to run them: it is started
+        // as soon as one is selected or launched, or once the session settled down
+        registry->extensionManager()->startAfter(std::chrono::seconds(30));
+#else
+        qInfo() << "Not starting extension manager has support for typescript extensions has been disabled "
+                   "for this build.";
+#endif
+      },
+      {"command-db"});
+  startup.add("window-manager", Stage::Critical,
+              [registry]() { registry->setWindowManager(std::make_unique<WindowManager>()); });
+  startup.add(
+      "apps", Stage::Critical,
+      [registry]() { registry->setAppDb(std::make_unique<AppService>(*registry->omniDb())); }, {"omni-db"});
+  startup.add(
+      "clipboard", Stage::Critical,
+      [registry]() {
+        auto path = Omnicast::dataDir() / "clipboard.db";
+
+        registry->setClipman(
+            std::make_unique<ClipboardService>(path, *registry->windowManager(), *registry->appDb()));
+      },
+      {"window-manager", "apps"});
+  startup.add("fonts", Stage::Critical,
+              [registry]() { registry->setFontService(std::make_unique<FontService>()); });
+  startup.add("config", Stage::Critical,
+              [registry]() { registry->setConfig(std::make_unique<ConfigService>()); });
+  startup.add(
+      "shortcuts", Stage::Critical,
+      [registry]() { registry->setShortcutService(std::make_unique<ShortcutService>(*registry->omniDb())); },
+      {"omni-db"});
+  startup.add("toasts", Stage::Critical,
+              [registry]() { registry->setToastService(std::make_unique<ToastService>()); });
+  startup.add(
+      "calculator", Stage::Critical,
+      [registry]() {
+        registry->setCalculatorService(std::make_unique<CalculatorService>(*registry->omniDb()));
+      },
+      {"omni-db"});
+  startup.add("files", Stage::Critical,
+              [registry]() { registry->setFileService(std::make_unique<FileService>()); });
+  startup.add("oauth", Stage::Critical,
+              [registry]() { registry->setOAuthService(std::make_unique<OAuthService>()); });
+  startup.add(
+      "root-search-sources", Stage::Critical,
+      [registry]() {
+        auto manager = registry->rootItemManager();
+
+        manager->addSearchSource(std::make_unique<CalculatorSearchSource>(*registry->calculatorService()));
+        manager->addSearchSource(
+            std::make_unique<FileSearchSource>(*registry->fileService(), *registry->config()));
+      },
+      {"root-item-manager", "calculator", "files", "config"});
+  startup.add(
+      "root-extension-manager", Stage::Critical,
+      [registry]() {
+        auto rootExtMan =
+            std::make_unique<RootExtensionManager>(*registry->rootItemManager(), *registry->commandDb());
+
+        rootExtMan->start();
+        registry->setRootExtMan(std::move(rootExtMan));
+      },
+      {"root-item-manager", "command-db"});
+  startup.add(
+      "builtin-commands", Stage::Critical,
+      [registry]() {
+        auto builtinCommandDb = std::make_unique<CommandDatabase>();
+
+        registry->commandDb()->registerRepositories(builtinCommandDb->repositories());
+      },
+      // extension root providers are added as repositories are registered
+      {"command-db", "root-extension-manager", "root-snapshot"});
+  startup.add(
+      "extensions", Stage::Critical,
+      [registry]() {
+        registry->setExtensionRegistry(
+            std::make_unique<ExtensionRegistry>(*registry->commandDb(), *registry->localStorage()));
+
+        auto reg = registry->extensionRegistry();
+
+        // only the extensions that changed are registered again, the other ones are left alone
+        QObject::connect(reg, &ExtensionRegistry::extensionsChanged,
+                         [](const std::vector<ExtensionManifest> &added, const std::vector<QString> &removed,
+                            const std::vector<ExtensionManifest> &updated) {
+          auto commandDb = ServiceRegistry::instance()->commandDb();
+          OmniCommandDatabase::RepositoryList extensions;
+
+          for (const auto &id : removed) {
+            commandDb->removeRepository(id);
+          }
+
+          for (const auto &manifest : added) {
+            extensions.emplace_back(std::make_shared<Extension>(manifest));
+          }
+
+          for (const auto &manifest : updated) {
+            extensions.emplace_back(std::make_shared<Extension>(manifest));
+          }
+
+          commandDb->registerRepositories(extensions);
+        });
+
+        OmniCommandDatabase::RepositoryList extensions;
+
+        for (const auto &manifest : reg->scanAll()) {
+          extensions.emplace_back(std::make_shared<Extension>(manifest));
+        }
+
+        ServiceRegistry::instance()->commandDb()->registerRepositories(extensions);
+      },
+      {"command-db", "local-storage", "root-extension-manager", "root-snapshot"});
+  // root search shows the items of the snapshot until these ones are loaded
+  startup.add(
+      "root-providers", Stage::Deferred,
+      [registry]() {
+        registry->rootItemManager()->addProvider(std::make_unique<AppRootProvider>(*registry->appDb()));
+        registry->rootItemManager()->addProvider(
+            std::make_unique<ShortcutRootProvider>(*registry->shortcuts()));
+
+        // Force reload providers to make sure items that depend on them are shown
+        registry->rootItemManager()->reloadProviders();
+        registry->rootItemManager()->dropSnapshotItems();
+      },
+      // this one needs to run last
+      {"root-item-manager", "apps", "shortcuts", "builtin-commands", "extensions"});
+
+  startup.add(
+      "emoji", Stage::Deferred,
+      [registry]() { registry->setEmojiService(std::make_unique<EmojiService>(*registry->omniDb())); },
+      {"omni-db"});
+  startup.add("raycast-store", Stage::Deferred,
+              [registry]() { registry->setRaycastStore(std::make_unique<RaycastStoreService>()); });
+  startup.add(
+      "extension-updates", Stage::Deferred,
+      [registry]() {
+        registry->setExtensionUpdates(std::make_unique<ExtensionUpdateChecker>(
+            *registry->raycastStore(), *registry->extensionRegistry(),
+            Omnicast::dataDir() / "extension-updates"));
+      },
+      {"raycast-store", "extensions"});
+  startup.add("favicon", Stage::Deferred, []() {
+    FaviconService::initialize(new FaviconService(Omnicast::dataDir() / "favicon"));
+  });
+  // for quicklinks not to show up with a placeholder icon the first time they are shown
+  startup.add(
+      "favicon-prefetch", Stage::Deferred,
+      [registry]() {
+        auto shortcuts = registry->shortcuts();
+        auto favicons = FaviconService::instance();
+        auto prefetch = [shortcuts, favicons]() { favicons->prefetch(shortcutFaviconDomains(*shortcuts)); };
+
+        QObject::connect(shortcuts, &ShortcutService::shortcutSaved, favicons, prefetch);
+        QObject::connect(shortcuts, &ShortcutService::shortcutUpdated, favicons, prefetch);
+        prefetch();
+      },
+      {"favicon", "shortcuts"});
+  // Start indexing after registerRepository() so that search paths are configured properly
+  startup.add(
+      "file-indexer", Stage::Deferred, [registry]() { registry->fileService()->indexer()->start(); },
+      {"files", "builtin-commands", "extensions"});
+
+  startup.startCritical();
 
   QApplication::setApplicationName("vicinae");
   QApplication::setQuitOnLastWindowClosed(false);
@@ -186,40 +395,430 @@ int startDaemon() {
   commandServer.setHandler(new IpcCommandHandler(ctx));
   commandServer.start(Omnicast::commandSocketPath());
 
-  QObject::connect(ServiceRegistry::instance()->config(), &ConfigService::configChanged,
-                   [&ctx](const ConfigService::Value &next, const ConfigService::Value &prev) {
-                     auto &theme = ThemeService::instance();
-                     bool themeChangeRequired = next.theme.name.value_or("") != prev.theme.name.value_or("");
+  QObject::connect(
+      ServiceRegistry::instance()->config(), &ConfigService::configChanged,
+      [&ctx](const ConfigService::Value &next, const ConfigService::Value &prev,
+             ConfigService::Sections changed) {
+        auto &theme = ThemeService::instance();
+
+        // rebuilding the theme restyles the whole application, only do it if what it depends on changed
+        if (changed & (ConfigService::ThemeSection | ConfigService::FontSection)) {
+          bool themeChangeRequired = next.theme.name.value_or("") != prev.theme.name.value_or("");
+
+          if (next.font.baseSize != prev.font.baseSize) {
+            theme.setFontBasePointSize(next.font.baseSize);
+
+            if (!themeChangeRequired) { theme.reloadCurrentTheme(); }
+          }
 
-                     if (next.font.baseSize != prev.font.baseSize) {
-                       theme.setFontBasePointSize(next.font.baseSize);
+          if (themeChangeRequired) { theme.setTheme(*next.theme.name); }
+          if (auto icon = next.theme.iconTheme; icon && changed.testFlag(ConfigService::ThemeSection)) {
+            QIcon::setThemeName(icon.value());
+          }
 
-                       if (!themeChangeRequired) { theme.reloadCurrentTheme(); }
-                     }
+          if (next.font.normal && *next.font.normal != prev.font.normal.value_or("")) {
+            theme.setFontFamily(*next.font.normal);
+          }
+        }
 
-                     if (themeChangeRequired) { theme.setTheme(*next.theme.name); }
+        if (changed.testFlag(ConfigService::GeneralSection)) {
+          ctx.navigation->setPopToRootOnClose(next.popToRootOnClose);
+          FaviconService::instance()->setService(next.faviconService);
+        }
 
-                     ctx.navigation->setPopToRootOnClose(next.popToRootOnClose);
+        if (changed.testFlag(ConfigService::MemorySection)) { applyMemoryBudgets(next); }
+      });
 
-                     FaviconService::instance()->setService(next.faviconService);
+  // stalls get dumped to the runtime directory, for reports of the launcher freezing to come with something
+  StallWatchdog watchdog(Omnicast::runtimeDir() / "stalls");
 
-                     if (auto icon = next.theme.iconTheme) { QIcon::setThemeName(icon.value()); }
+  Tracer::instance().setFlightRecorderEnabled(true);
 
-                     if (next.font.normal && *next.font.normal != prev.font.normal.value_or("")) {
-                       QApplication::setFont(*next.font.normal);
-                       qApp->setStyleSheet(qApp->styleSheet());
-                     }
+  QObject::connect(ctx.navigation.get(), &NavigationController::windowVisiblityChanged,
+                   [&watchdog](bool visible) {
+                     MemoryBudget::instance().setWindowVisible(visible);
+                     watchdog.setWatching(visible);
                    });
+  QObject::connect(&MemoryBudget::instance(), &MemoryBudget::idle, [&ctx]() { releaseIdleMemory(ctx); });
 
-  SettingsWindow settings(&ctx);
+  LazySettingsWindow settings(&ctx);
   LauncherWindow launcher(ctx);
 
   qInfo() << "Vicinae server successfully started. Call vicinae without an argument to toggle the window";
 
+  if (StartupBenchmark::instance().isRunning()) {
+    driveStartupBenchmark(ctx, startup);
+  } else {
+    startup.startDeferred();
+  }
+
   return qApp->exec();
 }
 
+static int printIndexerStats(DaemonIpcClient &client) {
+  namespace daemon = proto::ext::daemon;
+
+  auto stats = client.indexerStats();
+
+  if (!stats) {
+    std::cerr << "Failed to get file indexer stats from the server" << std::endl;
+    return 1;
+  }
+
+  auto stateName = [](daemon::IndexerEntrypointState state) {
+    switch (state) {
+    case daemon::Queued:
+      return "queued";
+    case daemon::Scanning:
+      return "scanning";
+    default:
+      return "idle";
+    }
+  };
+
+  std::cout << "Files walked: " << stats->walked_file_count() << " (" << std::fixed << std::setprecision(1)
+            << stats->files_per_second() << " files/s)\n"
+            << "Queued batches: " << stats->queued_batch_count() << "\n"
+            << "Written batches: " << stats->written_batch_count() << "\n"
+            << "Batch write time: last " << stats->last_batch_write_time_us() / 1000.0 << "ms, average "
+            << stats->average_batch_write_time_us() / 1000.0 << "ms, max "
+            << stats->max_batch_write_time_us() / 1000.0 << "ms\n"
+            << "Blocked on backpressure: " << stats->backpressure_wait_time_ms() << "ms\n"
+            << "Database size: " << formatSize(stats->database_size()).toStdString() << "\n";
+
+  if (stats->has_fts_segment_count()) { std::cout << "FTS segments: " << stats->fts_segment_count() << "\n"; }
+
+  for (const auto &entrypoint : stats->entrypoints()) {
+    std::cout << entrypoint.root() << ": " << stateName(entrypoint.state());
+
+    if (entrypoint.state() == daemon::Scanning) {
+      std::cout << ", " << entrypoint.walked_file_count();
+      if (entrypoint.has_expected_file_count()) { std::cout << "/~" << entrypoint.expected_file_count(); }
+      std::cout << " files walked";
+    }
+
+    if (entrypoint.has_last_scanned_at()) {
+      auto date = QDateTime::fromSecsSinceEpoch(entrypoint.last_scanned_at());
+      std::cout << ", last scanned " << date.toString(Qt::ISODate).toStdString();
+    }
+
+    std::cout << "\n";
+  }
+
+  std::cout << std::flush;
+
+  return 0;
+}
+
+static QJsonObject metricsToJson(const proto::ext::daemon::MetricsResponse &metrics) {
+  QJsonObject search;
+  QJsonObject resident;
+  QJsonObject accounted;
+  QJsonArray sql;
+  auto lookups = metrics.image_cache_hits() + metrics.image_cache_misses();
+  auto textLookups = metrics.text_layout_cache_hits() + metrics.text_layout_cache_misses();
+  QJsonObject clipboard{{"databaseSize", qint64(metrics.clipboard_database_size())}};
+
+  for (const auto &latency : metrics.search_latencies()) {
+    search[QString::fromStdString(latency.name())] = QJsonObject{{"count", qint64(latency.count())},
+                                                                 {"meanUs", qint64(latency.mean_us())},
+                                                                 {"p50Us", qint64(latency.p50_us())},
+                                                                 {"p95Us", qint64(latency.p95_us())},
+                                                                 {"p99Us", qint64(latency.p99_us())},
+                                                                 {"maxUs", qint64(latency.max_us())}};
+  }
+
+  for (const auto &latency : metrics.sql_latencies()) {
+    sql.append(QJsonObject{{"sql", QString::fromStdString(latency.name())},
+                           {"count", qint64(latency.count())},
+                           {"meanUs", qint64(latency.mean_us())},
+                           {"p50Us", qint64(latency.p50_us())},
+                           {"p95Us", qint64(latency.p95_us())},
+                           {"p99Us", qint64(latency.p99_us())},
+                           {"maxUs", qint64(latency.max_us())}});
+  }
+
+  for (const auto &memory : metrics.resident_memory()) {
+    resident[QString::fromStdString(memory.subsystem())] = qint64(memory.bytes());
+  }
+
+  for (const auto &memory : metrics.accounted_memory()) {
+    QJsonObject usage{{"size", qint64(memory.size())},
+                      {"unit", memory.counts_widgets() ? "widgets" : "bytes"}};
+
+    if (memory.has_budget()) { usage["budget"] = qint64(memory.budget()); }
+
+    accounted[QString::fromStdString(memory.subsystem())] = usage;
+  }
+
+  if (metrics.has_clipboard_selection_count()) {
+    clipboard["selectionCount"] = qint64(metrics.clipboard_selection_count());
+  }
+
+  return QJsonObject{
+      {"search", search},
+      {"rootItemCount", qint64(metrics.root_item_count())},
+      {"imageCache", QJsonObject{{"hits", qint64(metrics.image_cache_hits())},
+                                 {"misses", qint64(metrics.image_cache_misses())},
+                                 {"hitRate", lookups ? double(metrics.image_cache_hits()) / lookups : 0.0},
+                                 {"count", qint64(metrics.image_cache_count())},
+                                 {"bytes", qint64(metrics.image_cache_bytes())}}},
+      {"textLayoutCache",
+       QJsonObject{{"hits", qint64(metrics.text_layout_cache_hits())},
+                   {"misses", qint64(metrics.text_layout_cache_misses())},
+                   {"hitRate", textLookups ? double(metrics.text_layout_cache_hits()) / textLookups : 0.0},
+                   {"count", qint64(metrics.text_layout_cache_count())}}},
+      {"clipboard", clipboard},
+      {"indexer", QJsonObject{{"filesPerSecond", metrics.indexer_files_per_second()},
+                              {"walkedFileCount", qint64(metrics.indexer_walked_file_count())},
+                              {"databaseSize", qint64(metrics.indexer_database_size())}}},
+      {"extensionWorkerCount", qint64(metrics.extension_worker_count())},
+      {"sql", sql},
+      {"residentMemory", resident},
+      {"accountedMemory", accounted},
+      {"heapInUse", qint64(metrics.heap_in_use())},
+  };
+}
+
+static int printMetrics(DaemonIpcClient &client, const QStringList &args) {
+  if (!args.isEmpty() && args != QStringList{"--json"}) {
+    std::cerr << "Usage: vicinae metrics [--json]" << std::endl;
+    return 1;
+  }
+
+  auto metrics = client.metrics();
+
+  if (!metrics) {
+    std::cerr << "Failed to get metrics from the server" << std::endl;
+    return 1;
+  }
+
+  if (!args.isEmpty()) {
+    std::cout << QJsonDocument(metricsToJson(*metrics)).toJson().toStdString() << std::flush;
+    return 0;
+  }
+
+  auto ms = [](uint64_t us) { return us / 1000.0; };
+  auto lookups = metrics->image_cache_hits() + metrics->image_cache_misses();
+  auto textLookups = metrics->text_layout_cache_hits() + metrics->text_layout_cache_misses();
+
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (const auto &latency : metrics->search_latencies()) {
+    std::cout << "Search " << latency.name() << ": " << latency.count() << " searches, p50 "
+              << ms(latency.p50_us()) << "ms, p95 " << ms(latency.p95_us()) << "ms, p99 "
+              << ms(latency.p99_us()) << "ms, max " << ms(latency.max_us()) << "ms\n";
+  }
+
+  std::cout << "Root items: " << metrics->root_item_count() << "\n"
+            << "Image cache: " << metrics->image_cache_count() << " images, "
+            << formatSize(metrics->image_cache_bytes()).toStdString() << ", "
+            << (lookups ? 100.0 * metrics->image_cache_hits() / lookups : 0.0) << "% hit rate\n"
+            << "Text layout cache: " << metrics->text_layout_cache_count() << " entries, "
+            << (textLookups ? 100.0 * metrics->text_layout_cache_hits() / textLookups : 0.0)
+            << "% hit rate\n"
+            << "Clipboard: ";
+
+  if (metrics->has_clipboard_selection_count()) {
+    std::cout << metrics->clipboard_selection_count() << " selections, ";
+  }
+
+  std::cout << formatSize(metrics->clipboard_database_size()).toStdString() << "\n"
+            << "File indexer: " << metrics->indexer_files_per_second() << " files/s, "
+            << metrics->indexer_walked_file_count() << " files walked, "
+            << formatSize(metrics->indexer_database_size()).toStdString() << "\n"
+            << "Extension workers: " << metrics->extension_worker_count() << "\n"
+            << "SQL statements: " << metrics->sql_latencies_size() << " profiled";
+
+  if (!metrics->sql_latencies().empty()) {
+    std::cout << ", slowest p95 " << ms(metrics->sql_latencies(0).p95_us())
+              << "ms (run 'vicinae sql-stats' for details)";
+  }
+
+  std::cout << "\n";
+
+  for (const auto &memory : metrics->resident_memory()) {
+    std::cout << "Resident memory (" << memory.subsystem()
+              << "): " << formatSize(memory.bytes()).toStdString() << "\n";
+  }
+
+  std::cout << "Heap in use: " << formatSize(metrics->heap_in_use()).toStdString() << "\n";
+
+  for (const auto &memory : metrics->accounted_memory()) {
+    auto size = [&](uint64_t value) {
+      return memory.counts_widgets() ? std::to_string(value) + " widgets" : formatSize(value).toStdString();
+    };
+
+    std::cout << "Accounted memory (" << memory.subsystem() << "): " << size(memory.size());
+    if (memory.has_budget()) { std::cout << ", budget " << size(memory.budget()); }
+    std::cout << "\n";
+  }
+
+  std::cout << std::flush;
+
+  return 0;
+}
+
+static int printSqlStats(DaemonIpcClient &client, const QStringList &args) {
+  static const char *USAGE = "Usage: vicinae sql-stats [count]";
+  int limit = 10;
+
+  if (!args.isEmpty()) {
+    bool ok = false;
+
+    limit = args.at(0).toInt(&ok);
+
+    if (args.size() != 1 || !ok || limit <= 0) {
+      std::cerr << USAGE << std::endl;
+      return 1;
+    }
+  }
+
+  auto metrics = client.metrics();
+
+  if (!metrics) {
+    std::cerr << "Failed to get metrics from the server" << std::endl;
+    return 1;
+  }
+
+  auto ms = [](uint64_t us) { return us / 1000.0; };
+  // the server sends them from the slowest to the fastest
+  auto count = std::min(limit, metrics->sql_latencies_size());
+
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (int i = 0; i != count; ++i) {
+    const auto &latency = metrics->sql_latencies(i);
+
+    std::cout << latency.name() << "\n  " << latency.count() << " executions, p50 " << ms(latency.p50_us())
+              << "ms, p95 " << ms(latency.p95_us()) << "ms, p99 " << ms(latency.p99_us()) << "ms, max "
+              << ms(latency.max_us()) << "ms\n";
+  }
+
+  std::cout << std::flush;
+
+  return 0;
+}
+
+static int trace(DaemonIpcClient &client, const QStringList &args) {
+  namespace daemon = proto::ext::daemon;
+
+  static const char *USAGE = "Usage: vicinae trace start | vicinae trace stop <file>";
+
+  if (args.size() == 1 && args.at(0) == "start") {
+    if (!client.trace(daemon::TraceStart)) {
+      std::cerr << "Failed to start tracing" << std::endl;
+      return 1;
+    }
+
+    std::cout << "Tracing started, run 'vicinae trace stop <file>' to write the trace" << std::endl;
+    return 0;
+  }
+
+  if (args.size() != 2 || args.at(0) != "stop") {
+    std::cerr << USAGE << std::endl;
+    return 1;
+  }
+
+  // the server has a working directory of its own
+  auto path = QFileInfo(args.at(1)).absoluteFilePath().toStdString();
+  auto res = client.trace(daemon::TraceStop, path);
+
+  if (!res || res->has_error()) {
+    std::string error = res ? res->error() : "no response from the server";
+
+    std::cerr << "Failed to stop tracing: " << error << std::endl;
+    return 1;
+  }
+
+  std::cout << res->event_count() << " events written to " << path
+            << ", open it with https://ui.perfetto.dev or chrome://tracing" << std::endl;
+
+  return 0;
+}
+
+static int dmenu(DaemonIpcClient &client, const QStringList &args) {
+  static const char *USAGE = "Usage: vicinae dmenu [-p|--placeholder <text>] < lines";
+  std::string placeholder;
+
+  if (!args.isEmpty()) {
+    if (args.size() != 2 || (args.at(0) != "-p" && args.at(0) != "--placeholder")) {
+      std::cerr << USAGE << std::endl;
+      return 1;
+    }
+
+    placeholder = args.at(1).toStdString();
+  }
+
+  auto res = client.dmenu(placeholder, STDIN_FILENO);
+
+  if (!res) {
+    std::cerr << "Failed to get a response from the server" << std::endl;
+    return 1;
+  }
+
+  // same as dmenu, so that scripts can tell a cancelled selection apart
+  if (!res->has_selection()) return 1;
+
+  std::cout << res->selection() << std::endl;
+
+  return 0;
+}
+
+/**
+ * Start the daemon against the data of `dir`, or of an empty directory if none is given, with its own
+ * runtime directory so that it runs alongside the daemon of the session.
+ */
+static int startupBenchmark(const QString &dir) {
+  std::unique_ptr<QTemporaryDir> tmp;
+  QString root = QFileInfo(dir).absoluteFilePath();
+
+  if (dir.isEmpty()) {
+    tmp = std::make_unique<QTemporaryDir>(QDir::tempPath() + "/vicinae-startup-benchmark-XXXXXX");
+
+    if (!tmp->isValid()) {
+      std::cerr << "Failed to create a data directory for the benchmark: " << tmp->errorString().toStdString()
+                << std::endl;
+      return 1;
+    }
+
+    root = tmp->path();
+  }
+
+  static constexpr std::array<std::pair<const char *, const char *>, 4> DIRS = {{
+      {"XDG_DATA_HOME", "data"},
+      {"XDG_CONFIG_HOME", "config"},
+      {"XDG_CACHE_HOME", "cache"},
+      {"XDG_RUNTIME_DIR", "runtime"},
+  }};
+
+  for (auto [variable, name] : DIRS) {
+    std::filesystem::path path = (root + "/" + name).toStdString();
+
+    std::filesystem::create_directories(path);
+    qputenv(variable, QByteArray(path.c_str()));
+  }
+
+  // not trusted by Qt otherwise
+  std::filesystem::permissions((root + "/runtime").toStdString(), std::filesystem::perms::owner_all);
+  StartupBenchmark::instance().start(root);
+
+  return startDaemon();
+}
+
 int main(int argc, char **argv) {
+  // toggling is bound to a hotkey, it should not wait for a platform plugin and fonts to load
+  if (argc == 1) {
+    PosixIpcClient client;
+
+    if (client.connect() && client.toggle()) return 0;
+  }
+
+  // the benchmark is not meant to show anything, nor to compete with a compositor
+  if (argc == 2 && qstrcmp(argv[1], "list-bench") == 0 && !qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+
   QGuiApplication::setHighDpiScaleFactorRoundingPolicy(Qt::HighDpiScaleFactorRoundingPolicy::PassThrough);
   QApplication qapp(argc, argv);
 
@@ -227,6 +826,28 @@ int main(int argc, char **argv) {
 
   if (qapp.arguments().size() == 2 && qapp.arguments().at(1) == "server") { return startDaemon(); }
 
+  if (qapp.arguments().size() >= 3 && qapp.arguments().at(1) == "server") {
+    auto args = qapp.arguments().sliced(2);
+
+    if (args.at(0) != "--startup-benchmark" || args.size() > 2) {
+      std::cerr << "Usage: vicinae server [--startup-benchmark [data-dir]]" << std::endl;
+      return 1;
+    }
+
+    return startupBenchmark(args.value(1));
+  }
+
+  // measured locally, the server has nothing to do with it
+  if (qapp.arguments().size() == 2 && qapp.arguments().at(1) == "crypto-bench") {
+    Crypto::AES256GCM::benchmark(std::cout);
+    return 0;
+  }
+
+  if (qapp.arguments().size() == 2 && qapp.arguments().at(1) == "list-bench") {
+    std::cout << OmniListBenchmark::run().toJson().toStdString();
+    return 0;
+  }
+
   DaemonIpcClient daemonClient;
 
   if (!daemonClient.connect()) {
@@ -240,6 +861,14 @@ int main(int argc, char **argv) {
     return 0;
   }
 
+  if (qapp.arguments().at(1) == "indexer-stats") { return printIndexerStats(daemonClient); }
+  if (qapp.arguments().at(1) == "metrics") { return printMetrics(daemonClient, qapp.arguments().sliced(2)); }
+  if (qapp.arguments().at(1) == "sql-stats") {
+    return printSqlStats(daemonClient, qapp.arguments().sliced(2));
+  }
+  if (qapp.arguments().at(1) == "trace") { return trace(daemonClient, qapp.arguments().sliced(2)); }
+  if (qapp.arguments().at(1) == "dmenu") { return dmenu(daemonClient, qapp.arguments().sliced(2)); }
+
   QUrl url(argv[1]);
 
   if (url.isValid()) {
@@ -4,6 +4,7 @@
 #include "common.hpp"
 #include "services/shortcut/shortcut-service.hpp"
 #include "extend/metadata-model.hpp"
+#include "lib/search-index.hpp"
 #include "service-registry.hpp"
 #include "services/app-service/app-service.hpp"
 #include "services/shortcut/shortcut.hpp"
@@ -86,30 +87,6 @@ class ShortcutDetailWidget : public DetailWithMetadataWidget {
   TypographyWidget *m_expandedLink = new TypographyWidget(this);
   std::shared_ptr<Shortcut> m_shortcut;
 
-  QString expandLink(const Shortcut &shortcut, const std::vector<QString> &arguments) {
-    auto appDb = ServiceRegistry::instance()->appDb();
-    QString expanded;
-    size_t argumentIndex = 0;
-
-    for (const auto &part : m_shortcut->parts()) {
-      if (auto s = std::get_if<QString>(&part)) {
-        expanded += *s;
-      } else if (auto placeholder = std::get_if<Shortcut::ParsedPlaceholder>(&part)) {
-        if (placeholder->id == "clipboard") {
-          expanded += QApplication::clipboard()->text();
-        } else if (placeholder->id == "selected") {
-          // TODO: selected text
-        } else if (placeholder->id == "uuid") {
-          expanded += QUuid::createUuid().toString(QUuid::StringFormat::WithoutBraces);
-        } else {
-          if (argumentIndex < arguments.size()) { expanded += arguments.at(argumentIndex++); }
-        }
-      }
-    }
-
-    return expanded;
-  }
-
 public:
   void setShortcut(const std::shared_ptr<Shortcut> &shortcut) {
     auto appDb = ServiceRegistry::instance()->appDb();
@@ -148,11 +125,11 @@ public:
     });
 
     setMetadata(meta);
-    m_expandedLink->setText(expandLink(*m_shortcut.get(), {}));
+    m_expandedLink->setText(m_shortcut->expand({}));
   }
 
   void updateArguments(const std::vector<QString> &arguments) {
-    m_expandedLink->setText(expandLink(*m_shortcut.get(), arguments));
+    m_expandedLink->setText(m_shortcut->expand(arguments));
   }
 
   ShortcutDetailWidget(QWidget *parent = nullptr) {
@@ -235,15 +212,25 @@ public:
 };
 
 class ManageShortcutsView : public ListView {
+  // shortcuts by name, then by url
+  SearchIndex<std::shared_ptr<Shortcut>> m_index;
+
+  void indexShortcuts() {
+    auto shortcuts = ServiceRegistry::instance()->shortcuts()->shortcuts();
+
+    m_index.clear();
+    m_index.reserve(shortcuts.size());
+
+    for (const auto &shortcut : shortcuts) {
+      m_index.add(shortcut, {shortcut->name(), shortcut->url()});
+    }
+  }
+
   void renderList(const QString &s, OmniList::SelectionPolicy policy = OmniList::SelectFirst) {
-    auto shortcutService = ServiceRegistry::instance()->shortcuts();
-    auto shortcuts =
-        shortcutService->shortcuts() |
-        std::views::filter([s](auto bk) { return bk->name().contains(s, Qt::CaseInsensitive); }) |
-        std::views::transform([](auto bk) -> std::unique_ptr<OmniList::AbstractVirtualItem> {
-          return std::make_unique<QuicklinkItem>(bk);
-        }) |
-        std::ranges::to<std::vector>();
+    auto makeItem = [](const auto &result) -> std::unique_ptr<OmniList::AbstractVirtualItem> {
+      return std::make_unique<QuicklinkItem>(*result.item);
+    };
+    auto shortcuts = m_index.search(s) | std::views::transform(makeItem) | std::ranges::to<std::vector>();
 
     m_list->updateModel(
         [&]() {
@@ -256,16 +243,22 @@ class ManageShortcutsView : public ListView {
 
   void itemSelected(const OmniList::AbstractVirtualItem *item) override {}
 
-  void onShortcutRemoved() { renderList(searchText(), OmniList::PreserveSelection); }
+  void reloadInPlace() {
+    indexShortcuts();
+    renderList(searchText(), OmniList::PreserveSelection);
+  }
+
+  void onShortcutRemoved() { reloadInPlace(); }
 
-  void onShortcutSaved() { renderList(searchText(), OmniList::PreserveSelection); }
+  void onShortcutSaved() { reloadInPlace(); }
 
-  void onShortcutUpdated() { renderList(searchText(), OmniList::PreserveSelection); }
+  void onShortcutUpdated() { reloadInPlace(); }
 
   void textChanged(const QString &s) override { renderList(s); }
 
   void initialize() override {
     setSearchPlaceholderText("Search shortcuts...");
+    indexShortcuts();
     textChanged("");
   }
 
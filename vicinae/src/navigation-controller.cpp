@@ -140,6 +140,7 @@ void NavigationController::popCurrentView() {
   }
 
   emit currentViewChanged(*next.get());
+  next->sender->resume();
 
   emit searchTextChanged(next->searchText);
   emit searchPlaceholderTextChanged(next->placeholderText);
@@ -291,17 +292,12 @@ AbstractAction *NavigationController::findBoundAction(const QKeyEvent *event) co
   if (!state) return nullptr;
   if (!state->actionPanelState) return nullptr;
 
-  for (const auto &section : state->actionPanelState->sections()) {
-    for (const auto &action : section->actions()) {
-      if (action->isBoundTo(event)) { return action.get(); }
-    }
-  }
-
-  return nullptr;
+  return state->actionPanelState->findBoundAction(event);
 }
 
 void NavigationController::pushView(BaseView *view) {
   auto state = std::make_unique<ViewState>();
+  auto previous = m_views.empty() ? nullptr : m_views.back()->sender;
 
   state->sender = view;
   state->supportsSearch = view->supportsSearch();
@@ -332,6 +328,9 @@ void NavigationController::pushView(BaseView *view) {
   destroyCurrentCompletion();
   emit currentViewChanged(*m_views.back());
   emit viewPushed(view);
+
+  // no longer shown at that point
+  if (previous) previous->suspend();
 }
 
 void NavigationController::setSearchAccessory(QWidget *accessory, const BaseView *caller) {
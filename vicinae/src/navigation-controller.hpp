@@ -47,6 +47,11 @@ public:
 
   AbstractAction *primaryAction() const { return m_primary; }
 
+  /**
+   * The action `event` triggers, if any. Only valid once the state is finalized.
+   */
+  AbstractAction *findBoundAction(const QKeyEvent *event) const { return m_shortcutTable.find(event); }
+
   /**
    * Apply shortcut presets and other things that need to be computed
    * at a given time.
@@ -54,6 +59,7 @@ public:
   void finalize() {
     computePrimaryAction();
     applyShortcuts();
+    buildShortcutTable();
   }
 
   const std::vector<std::unique_ptr<ActionPanelSectionState>> &sections() const { return m_sections; }
@@ -103,13 +109,21 @@ private:
   void applyShortcuts() {
     if (!m_primarySection) return;
 
-    auto actions = m_primarySection->actions();
-
-    for (const auto &[action, shortcut] : std::views::zip(actions, m_defaultShortcuts)) {
+    for (const auto &[action, shortcut] : std::views::zip(m_primarySection->m_actions, m_defaultShortcuts)) {
       action->setShortcut(shortcut);
     }
   }
 
+  void buildShortcutTable() {
+    m_shortcutTable.clear();
+
+    for (const auto &section : m_sections) {
+      for (const auto &action : section->m_actions) {
+        m_shortcutTable.add(action.get());
+      }
+    }
+  }
+
   std::vector<KeyboardShortcutModel> shortcutsForPreset(ShortcutPreset preset) {
     switch (preset) {
     case ShortcutPreset::List:
@@ -129,6 +143,7 @@ private:
   std::vector<KeyboardShortcutModel> m_defaultShortcuts;
   AbstractAction *m_primary = nullptr;
   ActionPanelSectionState *m_primarySection = nullptr;
+  ActionShortcutTable m_shortcutTable;
 };
 
 class ListActionPanelState : public ActionPanelState {
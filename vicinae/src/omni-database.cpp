@@ -0,0 +1,184 @@
+#include "omni-database.hpp"
+#include "crypto.hpp"
+#include "sql-profiler/sql-profiler.hpp"
+#include "trace/trace.hpp"
+#include "utils/migration-manager/migration-manager.hpp"
+#include <QtConcurrent/QtConcurrent>
+#include <qsqlerror.h>
+
+static const std::vector<QString> DB_PRAGMAS = {
+    "PRAGMA foreign_keys = ON",
+    "PRAGMA journal_mode = WAL",
+    "PRAGMA synchronous = normal",
+    "PRAGMA journal_size_limit = 6144000",
+    "PRAGMA temp_store = memory",
+    "PRAGMA mmap_size = 67108864", // 64MB
+    "PRAGMA cache_size = -8000",   // 8MB
+    "PRAGMA busy_timeout = 5000",
+};
+
+// deferred writes are flushed from a pool thread, through a connection of their own
+static const std::vector<QString> DB_WRITER_PRAGMAS = {
+    "PRAGMA foreign_keys = ON",
+    "PRAGMA synchronous = normal",
+    "PRAGMA busy_timeout = 5000",
+};
+
+OmniDatabase::Statement::~Statement() { m_query->finish(); }
+
+QSqlDatabase &OmniDatabase::db() {
+  flushDeferredWrites();
+  return _db;
+}
+
+QSqlQuery OmniDatabase::createQuery() {
+  flushDeferredWrites();
+  return QSqlQuery(_db);
+}
+
+OmniDatabase::Statement OmniDatabase::prepare(const QString &sql) {
+  flushDeferredWrites();
+  return Statement(&statement(sql));
+}
+
+QSqlQuery &OmniDatabase::statement(const QString &sql) {
+  auto &query = m_statements[sql];
+
+  if (!query) {
+    query = std::make_unique<QSqlQuery>(_db);
+
+    if (!query->prepare(sql)) { qCritical() << "Failed to prepare query" << sql << query->lastError(); }
+  }
+
+  return *query;
+}
+
+void OmniDatabase::deferWrite(const QString &sql, const QVariantList &values) {
+  m_deferredWrites.emplace_back(DeferredWrite{.sql = sql, .values = values});
+  if (!m_flushTimer.isActive()) { m_flushTimer.start(); }
+}
+
+bool OmniDatabase::executeWrites(QSqlDatabase &db, const std::vector<DeferredWrite> &writes) {
+  TraceScope trace("sqlite", "omni deferred writes");
+  std::unordered_map<QString, std::unique_ptr<QSqlQuery>> statements;
+
+  if (!db.transaction()) {
+    qCritical() << "Failed to start transaction for deferred writes" << db.lastError();
+    return false;
+  }
+
+  for (const auto &write : writes) {
+    auto &query = statements[write.sql];
+
+    if (!query) {
+      query = std::make_unique<QSqlQuery>(db);
+      query->prepare(write.sql);
+    }
+
+    for (int i = 0; i != write.values.size(); ++i) {
+      query->bindValue(i, write.values[i]);
+    }
+
+    if (!SqlProfiler::exec(*query)) {
+      qCritical() << "Failed to execute deferred write" << write.sql << query->lastError();
+    }
+  }
+
+  statements.clear();
+
+  if (!db.commit()) {
+    qCritical() << "Failed to commit deferred writes" << db.lastError();
+    db.rollback();
+    return false;
+  }
+
+  return true;
+}
+
+void OmniDatabase::flushInBackground() {
+  if (m_deferredWrites.empty()) return;
+
+  // a single writer at a time, the writes queued since are flushed once the current batch is committed
+  if (m_flush.isRunning()) { return m_flushTimer.start(); }
+
+  QString path = _db.databaseName();
+  auto writes = std::move(m_deferredWrites);
+
+  m_deferredWrites.clear();
+  m_flush = QtConcurrent::run(&m_flushPool, [path, writes = std::move(writes)]() {
+    QString connId = QString("omni-writer-%1").arg(Crypto::UUID::v4());
+
+    {
+      auto db = QSqlDatabase::addDatabase("QSQLITE", connId);
+
+      db.setDatabaseName(path);
+
+      if (db.open()) {
+        QSqlQuery query(db);
+
+        for (const auto &pragma : DB_WRITER_PRAGMAS) {
+          SqlProfiler::exec(query, pragma);
+        }
+
+        executeWrites(db, writes);
+      } else {
+        qCritical() << "Failed to open database to flush deferred writes" << db.lastError();
+      }
+
+      db.close();
+    }
+
+    QSqlDatabase::removeDatabase(connId);
+  });
+}
+
+void OmniDatabase::flushDeferredWrites() {
+  m_flush.waitForFinished();
+
+  if (m_deferredWrites.empty()) return;
+
+  auto writes = std::move(m_deferredWrites);
+
+  m_deferredWrites.clear();
+  m_flushTimer.stop();
+  executeWrites(_db, writes);
+}
+
+void OmniDatabase::shrinkMemory() {
+  QSqlQuery query(_db);
+
+  if (!SqlProfiler::exec(query, "PRAGMA shrink_memory")) {
+    qWarning() << "Failed to shrink memory" << query.lastError();
+  }
+}
+
+OmniDatabase::OmniDatabase(const std::filesystem::path &path)
+    : _db(QSqlDatabase::addDatabase("QSQLITE", "omni")) {
+  std::filesystem::create_directories(path.parent_path());
+  _db.setDatabaseName(path.c_str());
+
+  if (!_db.open()) { qFatal() << "Could not open main omnicast SQLite database."; }
+
+  MigrationManager manager(_db, "omnicast");
+
+  manager.runMigrations();
+
+  QSqlQuery query(_db);
+
+  for (const auto &pragma : DB_PRAGMAS) {
+    if (!SqlProfiler::exec(query, pragma)) {
+      qCritical() << "Failed to execute pragma" << pragma << query.lastError();
+    }
+  }
+
+  m_flushPool.setMaxThreadCount(1);
+  m_flushTimer.setSingleShot(true);
+  m_flushTimer.setInterval(DEFERRED_WRITE_FLUSH_MS);
+  QObject::connect(&m_flushTimer, &QTimer::timeout, [this]() { flushInBackground(); });
+}
+
+OmniDatabase::~OmniDatabase() {
+  // writes left when the daemon exits are not worth losing, nor a thread hop
+  flushDeferredWrites();
+  m_statements.clear();
+}
@@ -0,0 +1,230 @@
+#include "process-manager-service.hpp"
+#include "task-scheduler/task-scheduler.hpp"
+#include <charconv>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <format>
+#include <qlogging.h>
+#include <string_view>
+#include <sys/stat.h>
+
+class ProcessManagerService::Sampler {
+  struct Entry {
+    ProcessInfo info;
+    uint64_t startTime = 0;
+    uint64_t cpuTicks = 0;
+    bool seen = false;
+  };
+
+  int m_procFd = -1;
+  DIR *m_procDir = nullptr;
+  std::chrono::steady_clock::time_point m_sampledAt;
+  std::unordered_map<pid_t, Entry> m_entries;
+  std::vector<char> m_buffer = std::vector<char>(4096);
+  long m_ticksPerSecond = sysconf(_SC_CLK_TCK);
+  long m_pageSize = sysconf(_SC_PAGESIZE);
+
+  // the whole `stat` file of `pid` into the buffer, which is grown for the rare long ones
+  std::optional<std::string_view> readStat(std::string_view pid) {
+    char path[32];
+    auto end = std::format_to_n(path, sizeof(path) - 1, "{}/stat", pid).out;
+
+    *end = '\0';
+
+    int fd = openat(m_procFd, path, O_RDONLY | O_CLOEXEC);
+
+    if (fd == -1) return std::nullopt;
+
+    ssize_t size = 0;
+
+    while ((size = pread(fd, m_buffer.data(), m_buffer.size(), 0)) == static_cast<ssize_t>(m_buffer.size())) {
+      m_buffer.resize(m_buffer.size() * 2);
+    }
+
+    close(fd);
+
+    if (size <= 0) return std::nullopt;
+
+    return std::string_view(m_buffer.data(), size);
+  }
+
+public:
+  struct Stat {
+    std::string_view comm;
+    uint64_t cpuTicks = 0;
+    uint64_t startTime = 0;
+    uint64_t rssPages = 0;
+  };
+
+  // see proc_pid_stat(5): the name is between parentheses and can itself contain any of them
+  static std::optional<Stat> parseStat(std::string_view data) {
+    auto nameStart = data.find('(');
+    auto nameEnd = data.rfind(')');
+
+    if (nameStart == std::string_view::npos || nameEnd == std::string_view::npos || nameEnd < nameStart) {
+      return std::nullopt;
+    }
+
+    Stat stat{.comm = data.substr(nameStart + 1, nameEnd - nameStart - 1)};
+    std::string_view fields = data.substr(nameEnd + 1);
+    // fields 14 (utime), 15 (stime), 22 (starttime) and 24 (rss), the state being field 3
+    int field = 2;
+    uint64_t utime = 0;
+
+    while (!fields.empty() && field < 24) {
+      auto start = fields.find_first_not_of(' ');
+
+      if (start == std::string_view::npos) break;
+
+      fields.remove_prefix(start);
+
+      auto end = fields.find(' ');
+      auto value = fields.substr(0, end);
+      uint64_t number = 0;
+
+      ++field;
+
+      if (field == 14 || field == 15 || field == 22 || field == 24) {
+        std::from_chars(value.data(), value.data() + value.size(), number);
+      }
+
+      if (field == 14) utime = number;
+      if (field == 15) stat.cpuTicks = utime + number;
+      if (field == 22) stat.startTime = number;
+      if (field == 24) stat.rssPages = number;
+
+      fields.remove_prefix(end == std::string_view::npos ? fields.size() : end);
+    }
+
+    if (field < 24) return std::nullopt;
+
+    return stat;
+  }
+
+  Sample sample() {
+    Sample result;
+
+    if (!m_procDir) return result;
+
+    auto now = std::chrono::steady_clock::now();
+    double elapsedTicks =
+        std::chrono::duration<double>(now - m_sampledAt).count() * static_cast<double>(m_ticksPerSecond);
+
+    m_sampledAt = now;
+    rewinddir(m_procDir);
+
+    while (auto entry = readdir(m_procDir)) {
+      std::string_view name = entry->d_name;
+      pid_t pid = 0;
+      auto [end, ec] = std::from_chars(name.data(), name.data() + name.size(), pid);
+
+      if (ec != std::errc() || end != name.data() + name.size()) continue;
+
+      auto data = readStat(name);
+      auto stat = data ? parseStat(*data) : std::nullopt;
+
+      if (!stat) continue;
+
+      auto it = m_entries.find(pid);
+      // pids are reused, a process started since is a new one
+      bool isNew = it == m_entries.end() || it->second.startTime != stat->startTime;
+      uint64_t rss = stat->rssPages * m_pageSize;
+
+      if (isNew) {
+        if (it != m_entries.end()) { result.diff.removed.emplace_back(pid); }
+
+        auto &created = m_entries[pid];
+
+        created = Entry{.info = {.pid = pid, .comm = QString::fromUtf8(stat->comm.data(), stat->comm.size())},
+                        .startTime = stat->startTime,
+                        .cpuTicks = stat->cpuTicks};
+        created.info.rss = rss;
+        created.seen = true;
+        result.diff.added.emplace_back(created.info);
+        continue;
+      }
+
+      auto &existing = it->second;
+      auto &info = existing.info;
+      double usedTicks = static_cast<double>(stat->cpuTicks - existing.cpuTicks);
+      double cpuPercent = elapsedTicks > 0 ? 100.0 * usedTicks / elapsedTicks : 0;
+
+      existing.seen = true;
+      existing.cpuTicks = stat->cpuTicks;
+
+      if (cpuPercent == info.cpuPercent && rss == info.rss) continue;
+
+      info.rssDelta = static_cast<int64_t>(rss) - static_cast<int64_t>(info.rss);
+      info.rss = rss;
+      info.cpuPercent = cpuPercent;
+      result.diff.updated.emplace_back(info);
+    }
+
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+      if (!it->second.seen) {
+        result.diff.removed.emplace_back(it->first);
+        it = m_entries.erase(it);
+        continue;
+      }
+
+      it->second.seen = false;
+      result.processes.emplace_back(it->second.info);
+      ++it;
+    }
+
+    return result;
+  }
+
+  Sampler() {
+    m_procFd = open("/proc", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    if (m_procFd == -1) {
+      qCritical() << "Failed to open /proc" << strerror(errno);
+      return;
+    }
+
+    // the directory stream gets a descriptor of its own, the other one is used to open files
+    m_procDir = fdopendir(dup(m_procFd));
+  }
+
+  ~Sampler() {
+    if (m_procDir) closedir(m_procDir);
+    if (m_procFd != -1) close(m_procFd);
+  }
+};
+
+std::vector<ProcessInfo> ProcessManagerService::list() const { return m_processes; }
+
+void ProcessManagerService::startSampling(std::chrono::milliseconds interval) {
+  m_timer->setInterval(interval);
+  m_timer->start();
+  sample();
+}
+
+void ProcessManagerService::stopSampling() { m_timer->stop(); }
+
+void ProcessManagerService::sample() {
+  // a slow sample delays the next one rather than piling up
+  if (m_watcher.isRunning()) return;
+
+  m_watcher.setFuture(TaskScheduler::instance().run(TaskScheduler::Priority::VisibleUi,
+                                                    [sampler = m_sampler]() { return sampler->sample(); }));
+}
+
+ProcessManagerService::ProcessManagerService() : m_sampler(std::make_shared<Sampler>()) {
+  connect(m_timer, &QTimer::timeout, this, &ProcessManagerService::sample);
+  connect(&m_watcher, &QFutureWatcher<Sample>::finished, this, [this]() {
+    if (m_watcher.isCanceled()) return;
+
+    auto sample = m_watcher.result();
+
+    auto &diff = sample.diff;
+
+    m_processes = std::move(sample.processes);
+
+    if (!diff.added.empty() || !diff.updated.empty() || !diff.removed.empty()) { emit sampled(diff); }
+  });
+}
+
+ProcessManagerService::~ProcessManagerService() { m_watcher.waitForFinished(); }
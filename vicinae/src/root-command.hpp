@@ -1,5 +1,6 @@
 #pragma once
 #include "actions/app/app-actions.hpp"
+#include "actions/files/file-actions.hpp"
 #include "ui/views/base-view.hpp"
 #include "services/config/config-service.hpp"
 #include "services/files-service/file-service.hpp"
@@ -10,8 +11,11 @@
 #include "services/calculator-service/abstract-calculator-backend.hpp"
 #include "services/files-service/abstract-file-indexer.hpp"
 #include "services/root-item-manager/root-item-manager.hpp"
+#include "root-search/calculator/calculator-search-source.hpp"
+#include "root-search/files/file-search-source.hpp"
 #include "omni-command-db.hpp"
 #include "service-registry.hpp"
+#include "startup-benchmark.hpp"
 #include "ui/action-pannel/action-item.hpp"
 #include "ui/action-pannel/action.hpp"
 #include "ui/calculator-list-item-widget.hpp"
@@ -84,6 +88,7 @@ protected:
 
 public:
   const RootItem &item() const { return *m_item.get(); }
+  const std::shared_ptr<RootItem> &sharedItem() const { return m_item; }
   RootSearchItem(const std::shared_ptr<RootItem> &item) : m_item(item) {}
 };
 
@@ -165,122 +170,70 @@ public:
       : m_name(name), m_color(color) {}
 };
 
-class BaseCalculatorListItem : public OmniList::AbstractVirtualItem, public ListView::Actionnable {
-protected:
-  const AbstractCalculatorBackend::CalculatorResult item;
-
-  OmniListItemWidget *createWidget() const override {
-    return new CalculatorListItemWidget(CalculatorItem{.expression = item.question, .result = item.answer});
-  }
-
-  int calculateHeight(int width) const override {
-    static CalculatorListItemWidget ruler({});
-
-    return ruler.sizeHint().height();
-  }
-
-  QString generateId() const override { return item.question; }
-
-  std::unique_ptr<ActionPanelState> newActionPanel(ApplicationContext *ctx) const override {
-    auto panel = std::make_unique<ActionPanelState>();
-    auto copyAnswer = new CopyCalculatorAnswerAction(item);
-    auto copyQA = new CopyCalculatorQuestionAndAnswerAction(item);
-    auto putAnswerInSearchBar = new PutCalculatorAnswerInSearchBar(item);
-    auto openHistory = new OpenCalculatorHistoryAction();
-    auto main = panel->createSection();
-
-    copyAnswer->setPrimary(true);
-    main->addAction(copyAnswer);
-    main->addAction(copyQA);
-    main->addAction(putAnswerInSearchBar);
-    main->addAction(openHistory);
-
-    return panel;
-  }
-
-public:
-  BaseCalculatorListItem(const AbstractCalculatorBackend::CalculatorResult &item) : item(item) {}
-};
-
-class RootFileListItem : public AbstractDefaultListItem, public ListView::Actionnable {
-  std::filesystem::path m_path;
-  QMimeDatabase m_mimeDb;
-
-  ImageURL getIcon() const {
-    auto mime = m_mimeDb.mimeTypeForFile(m_path.c_str());
-
-    if (!mime.name().isEmpty()) {
-      if (!QIcon::fromTheme(mime.iconName()).isNull()) { return ImageURL::system(mime.iconName()); }
-
-      return ImageURL::system(mime.genericIconName());
-    }
-
-    return ImageURL::builtin("question-mark-circle");
-  }
-
-  std::unique_ptr<ActionPanelState> newActionPanel(ApplicationContext *ctx) const override {
-    auto panel = std::make_unique<ActionPanelState>();
-    auto appDb = ctx->services->appDb();
-    auto section = panel->createSection();
-    auto openInFolder = new OpenAppAction(appDb->fileBrowser(), "Open in folder", {m_path.c_str()});
-
-    if (auto app = appDb->findBestOpener(m_path.c_str())) {
-      auto open = new OpenAppAction(app, "Open", {m_path.c_str()});
-      open->setPrimary(true);
-      section->addAction(open);
-    } else {
-      openInFolder->setPrimary(true);
-    }
-
-    section->addAction(openInFolder);
-
-    return panel;
-  }
-
-public:
-  QString generateId() const override { return m_path.c_str(); }
+class RootSearchView : public ListView {
+  // search results are ranked and rendered by pages, more are loaded when scrolling down
+  static constexpr size_t RESULT_PAGE_SIZE = 50;
+  // how long an item stays selected before it is prewarmed, moving through the list does not
+  static constexpr std::chrono::milliseconds PREWARM_DELAY{150};
+
+  // visits are registered as items are launched, the window is closed by the time they are rendered
+  QTimer *m_standbyRefresh = new QTimer(this);
+  QTimer *m_prewarmTimer = new QTimer(this);
+  std::shared_ptr<RootItem> m_prewarmItem;
+  // files, calculator and the other sources searched along with the root items
+  FederatedRootSearch *m_federatedSearch = nullptr;
+  QString m_searchText;
+  // queries the current root item results and the rendered list are for
+  QString m_searchResultsQuery;
+  QString m_renderedQuery;
+  size_t m_resultLimit = RESULT_PAGE_SIZE;
+  bool m_hasMoreResults = false;
+  // a larger page of results was asked for and is not in yet, the limit is only raised once per page
+  bool m_pagePending = false;
+  std::vector<std::shared_ptr<RootItem>> m_searchResults;
+  QFutureWatcher<std::vector<std::shared_ptr<RootItem>>> m_pendingSearchResults;
+  QString m_pendingSearchQuery;
+  OmniList::SelectionPolicy m_pendingSelectionPolicy = OmniList::SelectFirst;
+
+  /**
+   * Root search runs off the UI thread: results are rendered once they come back, as long as
+   * they still match the current search text, and once the other sources are settled.
+   */
+  void startSearch(const QString &text, OmniList::SelectionPolicy policy = OmniList::SelectFirst) {
+    auto manager = ServiceRegistry::instance()->rootItemManager();
 
-  ItemData data() const override {
-    return {.iconUrl = getIcon(), .name = m_path.filename().c_str(), .subtitle = compressPath(m_path)};
+    m_pendingSearchQuery = text;
+    m_pendingSelectionPolicy = policy;
+    m_pendingSearchResults.setFuture(manager->prefixSearchAsync(text.trimmed(), {.limit = m_resultLimit}));
   }
 
-  RootFileListItem(const std::filesystem::path &path) : m_path(path) {}
-};
+  void handleSearchResults() {
+    auto future = m_pendingSearchResults.future();
 
-class RootSearchView : public ListView {
-  QTimer *m_calcDebounce = new QTimer(this);
-  QTimer *m_fileSearchDebounce = new QTimer(this);
-  std::optional<AbstractCalculatorBackend::CalculatorResult> m_currentCalculatorEntry;
-  std::vector<IndexerFileResult> m_fileResults;
-  QFutureWatcher<std::vector<IndexerFileResult>> m_pendingFileSearchResults;
-  QString m_lastFileSearchQuery;
-  QString m_searchText;
+    if (future.isCanceled() || future.resultCount() == 0) return;
+    if (m_pendingSearchQuery != m_searchText) return;
 
-  void handleFileResults() {
-    if (!m_pendingFileSearchResults.isFinished()) return;
+    m_searchResults = future.result();
+    m_searchResultsQuery = m_pendingSearchQuery;
+    m_pagePending = false;
+    m_hasMoreResults = m_searchResults.size() >= m_resultLimit;
 
-    auto results = m_pendingFileSearchResults.result();
-
-    if (m_lastFileSearchQuery != m_searchText) return;
-    m_fileResults = results;
-    render(m_searchText);
+    if (m_federatedSearch->settled()) { render(m_searchText, m_pendingSelectionPolicy); }
   }
 
-  void handleFileSearchTimeout() {
-    auto filesService = ServiceRegistry::instance()->fileService();
-    if (m_searchText.size() >= 3) {
-      QString currentQuery = m_searchText;
+  /**
+   * The other sources got settled, which is rendered along with the root items once they are in, or a late
+   * one came back, which is appended to what is shown.
+   */
+  void handleFederatedSearchUpdate() {
+    if (m_searchResultsQuery != m_searchText) return;
 
-      m_pendingFileSearchResults.setFuture(
-          filesService->indexer()->queryAsync(currentQuery.toStdString(), {.pagination = {.limit = 8}}));
-      m_lastFileSearchQuery = currentQuery;
-    }
+    render(m_searchText,
+           m_renderedQuery == m_searchText ? OmniList::PreserveSelection : m_pendingSelectionPolicy);
   }
 
   void renderEmpty() {
-    m_fileResults.clear();
-    m_currentCalculatorEntry.reset();
-
+    m_renderedQuery.clear();
     m_list->beginResetModel();
     auto commandDb = ServiceRegistry::instance()->commandDb();
     auto appDb = ServiceRegistry::instance()->appDb();
@@ -341,9 +294,26 @@ class RootSearchView : public ListView {
     m_list->endResetModel(OmniList::SelectFirst);
   }
 
-  void itemSelected(const OmniList::AbstractVirtualItem *item) override {}
+  void itemSelected(const OmniList::AbstractVirtualItem *item) override {
+    auto rootItem = dynamic_cast<const RootSearchItem *>(item);
+
+    m_prewarmItem = rootItem ? rootItem->sharedItem() : nullptr;
+
+    if (m_prewarmItem) {
+      m_prewarmTimer->start();
+    } else {
+      m_prewarmTimer->stop();
+    }
+  }
+
+  void handlePrewarm() {
+    if (!m_prewarmItem || !context()->navigation->isWindowOpened()) return;
+
+    m_prewarmItem->prewarm(context());
+    m_prewarmItem.reset();
+  }
 
-  void render(const QString &text) {
+  void render(const QString &text, OmniList::SelectionPolicy policy = OmniList::SelectFirst) {
     auto rootItemManager = ServiceRegistry::instance()->rootItemManager();
     auto commandDb = ServiceRegistry::instance()->commandDb();
     auto appDb = ServiceRegistry::instance()->appDb();
@@ -355,9 +325,8 @@ class RootSearchView : public ListView {
 
     auto start = std::chrono::high_resolution_clock::now();
 
-    if (m_currentCalculatorEntry) {
-      m_list->addSection("Calculator")
-          .addItem(std::make_unique<BaseCalculatorListItem>(*m_currentCalculatorEntry));
+    for (const auto &section : m_federatedSearch->sections(RootSearchSource::Placement::BeforeItems)) {
+      m_list->addSection(section.source->title()).addItems(*section.results);
     }
 
     {
@@ -373,18 +342,12 @@ class RootSearchView : public ListView {
 
     auto &results = m_list->addSection("Results");
 
-    auto searchResults = rootItemManager->prefixSearch(text.trimmed());
-
-    for (const auto &item : searchResults) {
+    for (const auto &item : m_searchResults) {
       results.addItem(std::make_unique<RootSearchItem>(item));
     }
 
-    if (!m_fileResults.empty()) {
-      auto &section = m_list->addSection("Files");
-
-      for (const auto &file : m_fileResults) {
-        section.addItem(std::make_unique<RootFileListItem>(file.path));
-      }
+    for (const auto &section : m_federatedSearch->sections(RootSearchSource::Placement::AfterItems)) {
+      m_list->addSection(section.source->title()).addItems(*section.results);
     }
 
     auto &fallbackSection = m_list->addSection(QString("Use \"%1\" with...").arg(text));
@@ -396,78 +359,86 @@ class RootSearchView : public ListView {
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 
-    m_list->endResetModel(OmniList::SelectFirst);
+    m_list->endResetModel(policy);
+    m_renderedQuery = text;
+
+    if (!m_searchResults.empty()) {
+      StartupBenchmark::instance().reach(StartupBenchmark::FIRST_SEARCH_RESULT);
+    }
     // qDebug() << "root searched in " << duration << "ms";
   }
 
   void textChanged(const QString &text) override {
     m_searchText = text;
+    m_resultLimit = RESULT_PAGE_SIZE;
+    m_pagePending = false;
     QString query = text.trimmed();
 
-    if (query.isEmpty()) return renderEmpty();
-
-    m_calcDebounce->start();
-
-    if (context()->services->config()->value().rootSearch.searchFiles) { m_fileSearchDebounce->start(); }
-
-    if (text.size() < 3) { m_fileResults.clear(); }
+    if (query.isEmpty()) {
+      m_federatedSearch->cancel();
+      return renderEmpty();
+    }
 
-    return render(text);
+    m_federatedSearch->start(query);
+    startSearch(text);
   }
 
-  void handleCalculatorTimeout() {
-    auto calculator = ServiceRegistry::instance()->calculatorService();
-    QString expression = searchText().trimmed();
-    bool isComputable = false;
-
-    for (const auto &ch : expression) {
-      if (!ch.isLetterOrNumber() || ch.isSpace()) {
-        isComputable = true;
-        break;
-      }
-    }
+  /**
+   * Whether the view is the one shown next time the window is opened. Changes are rendered right away for
+   * it as well, so that opening the window only has to show what is already laid out.
+   */
+  bool isOnStandby() const {
+    auto navigation = context()->navigation.get();
 
-    if (!isComputable) {
-      m_currentCalculatorEntry.reset();
-      render(searchText());
-      return;
-    }
+    return !navigation->isWindowOpened() && navigation->topView() == this;
+  }
 
-    auto result = calculator->backend()->compute(expression);
+  void handleFavoriteChanged(const QString &itemId, bool value) {
+    if (isVisible() || isOnStandby()) textChanged(searchText());
+  }
 
-    if (result) {
-      m_currentCalculatorEntry = *result;
-    } else {
-      m_currentCalculatorEntry.reset();
-    }
-    render(searchText());
+  void handleStandbyRefresh() {
+    if (isOnStandby()) textChanged(searchText());
   }
 
-  void handleFavoriteChanged(const QString &itemId, bool value) {
-    if (isVisible()) textChanged(searchText());
+  void handleScrolledNearEnd() {
+    if (m_pagePending || !m_hasMoreResults || m_searchText.trimmed().isEmpty()) return;
+
+    m_pagePending = true;
+    m_resultLimit += RESULT_PAGE_SIZE;
+    startSearch(m_searchText, OmniList::PreserveSelection);
   }
 
   void handleItemChange() {
-    if (isVisible()) textChanged(searchText());
+    if (isVisible() || isOnStandby()) textChanged(searchText());
   }
 
   void initialize() override {
     auto manager = context()->services->rootItemManager();
 
-    m_calcDebounce->setInterval(100);
-    m_calcDebounce->setSingleShot(true);
-    m_fileSearchDebounce->setInterval(100);
-    m_fileSearchDebounce->setSingleShot(true);
+    m_federatedSearch = new FederatedRootSearch(*manager, this);
+    m_standbyRefresh->setInterval(100);
+    m_standbyRefresh->setSingleShot(true);
+    m_prewarmTimer->setInterval(PREWARM_DELAY);
+    m_prewarmTimer->setSingleShot(true);
+    m_list->setRowRendering(OmniList::PaintedRows);
 
     setSearchPlaceholderText("Search for anything...");
     textChanged(searchText());
 
     connect(manager, &RootItemManager::itemsChanged, this, &RootSearchView::handleItemChange);
     connect(manager, &RootItemManager::itemFavoriteChanged, this, &RootSearchView::handleFavoriteChanged);
-    connect(m_calcDebounce, &QTimer::timeout, this, &RootSearchView::handleCalculatorTimeout);
-    connect(m_fileSearchDebounce, &QTimer::timeout, this, &RootSearchView::handleFileSearchTimeout);
-    connect(&m_pendingFileSearchResults, &QFutureWatcher<std::vector<IndexerFileResult>>::finished, this,
-            &RootSearchView::handleFileResults);
+    connect(manager, &RootItemManager::itemVisited, m_standbyRefresh, qOverload<>(&QTimer::start));
+    connect(manager, &RootItemManager::itemRankingReset, m_standbyRefresh, qOverload<>(&QTimer::start));
+    connect(m_standbyRefresh, &QTimer::timeout, this, &RootSearchView::handleStandbyRefresh);
+    connect(m_prewarmTimer, &QTimer::timeout, this, &RootSearchView::handlePrewarm);
+    connect(m_federatedSearch, &FederatedRootSearch::updated, this,
+            &RootSearchView::handleFederatedSearchUpdate);
+    // queued, as rendering resets the list model
+    connect(m_list, &OmniList::scrolledNearEnd, this, &RootSearchView::handleScrolledNearEnd,
+            Qt::QueuedConnection);
+    connect(&m_pendingSearchResults, &QFutureWatcher<std::vector<std::shared_ptr<RootItem>>>::finished, this,
+            &RootSearchView::handleSearchResults);
   }
 
 public:
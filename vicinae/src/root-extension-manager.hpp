@@ -14,9 +14,21 @@ class RootExtensionManager : public QObject {
 
 public:
   void start() {
-    connect(&m_commandDb, &OmniCommandDatabase::registryAdded, this, [this](const auto &registry) {
-      m_manager.addProvider(std::make_unique<ExtensionRootProvider>(registry));
-    });
+    // the providers of updated repositories replace the ones of their previous version
+    connect(&m_commandDb, &OmniCommandDatabase::repositoriesRegistered, this,
+            [this](const auto &added, const auto &updated) {
+              std::vector<std::unique_ptr<RootProvider>> providers;
+
+              providers.reserve(added.size() + updated.size());
+              for (const auto &repository : added) {
+                providers.emplace_back(std::make_unique<ExtensionRootProvider>(repository));
+              }
+              for (const auto &repository : updated) {
+                providers.emplace_back(std::make_unique<ExtensionRootProvider>(repository));
+              }
+
+              m_manager.addProviders(std::move(providers));
+            });
     connect(&m_commandDb, &OmniCommandDatabase::repositoryRemoved, this,
             [this](const QString &id) { m_manager.removeProvider(QString("extension.%1").arg(id)); });
   }
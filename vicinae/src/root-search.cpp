@@ -1,44 +1,58 @@
 #include "root-search.hpp"
-#include "rapidfuzz/fuzz.hpp"
 #include "services/root-item-manager/root-item-manager.hpp"
+#include "lib/text-tokenizer.hpp"
+#include "search-profiler/search-profiler.hpp"
 #include <qlogging.h>
+#include <algorithm>
+#include <numeric>
 #include <qnamespace.h>
 
-double RootSearcher::computeExactStringScore(QStringView str, QStringView query) {
-  if (str == query) { return 1; };
-  if (str.startsWith(query, Qt::CaseInsensitive)) { return 0.9; };
-
-  double score = 0;
-  // TODO: we could use more advanced tokenization in the future, for now it's fine
-  auto words = str.split(' ');
+static constexpr size_t CANCELLATION_CHECK_INTERVAL = 256;
 
-  if (words.empty()) return 0;
+/**
+ * Typos are only looked up for the first word of the query that is long enough: it is the one the user
+ * keeps typing until it is done, which keeps the candidates shrinking as the query gets longer.
+ */
+static QString typoWord(QStringView query) {
+  QString text;
+  std::vector<TextSpan> words;
 
-  size_t matchCount = 0;
+  TextTokenizer::tokenize(query, text, words, {.splitCamelCase = false});
 
   for (const auto &word : words) {
-    matchCount += word.startsWith(query, Qt::CaseInsensitive);
+    if (word.length >= TypoIndex::MIN_WORD_LENGTH) { return text.mid(word.offset, word.length); }
   }
 
-  return static_cast<double>(matchCount) / words.size();
+  return {};
 }
 
-double RootSearcher::clampScore(double v) { return std::clamp(v, 0.0, 1.0); }
+bool RootSearcher::toleratesTypos(QStringView query) { return !typoWord(query).isEmpty(); }
 
-RootItemMetadata RootSearcher::metadata(const QString &id) const {
-  if (auto it = m_meta.find(id); it != m_meta.end()) { return it->second; }
+double RootSearcher::computeExactStringScore(const RootSearchIndex::Field &field, QStringView query) const {
+  QStringView str = m_index.text(field.text);
 
-  return {};
+  if (str == query) { return 1; };
+  if (str.startsWith(query)) { return 0.9; };
+  if (field.wordCount == 0) return 0;
+
+  size_t matchCount = 0;
+
+  for (const auto &word : m_index.words(field)) {
+    matchCount += m_index.text(word).startsWith(query);
+  }
+
+  return static_cast<double>(matchCount) / field.wordCount;
 }
 
-double RootSearcher::computeExactScore(const RootItem &item, QStringView query) {
-  auto meta = metadata(item.uniqueId());
-  double nameScore = computeExactStringScore(item.displayName(), query) * 0.8;
-  double aliasScore = computeExactStringScore(meta.alias, query) * 0.8;
-  double subtitleScore = computeExactStringScore(item.subtitle(), query) * 0.5;
+double RootSearcher::clampScore(double v) const { return std::clamp(v, 0.0, 1.0); }
+
+double RootSearcher::computeExactScore(const RootSearchIndex::Entry &entry, QStringView query) const {
+  double nameScore = computeExactStringScore(entry.name, query) * 0.8;
+  double aliasScore = computeExactStringScore(entry.alias, query) * 0.8;
+  double subtitleScore = computeExactStringScore(entry.subtitle, query) * 0.5;
   double keywordScore = 0;
 
-  for (const auto &kw : item.keywords()) {
+  for (const auto &kw : m_index.keywords(entry)) {
     keywordScore += computeExactStringScore(kw, query);
   }
 
@@ -47,35 +61,65 @@ double RootSearcher::computeExactScore(const RootItem &item, QStringView query)
   return clampScore(nameScore + subtitleScore + keywordScore + aliasScore);
 }
 
-double RootSearcher::computeFuzzyScore(const RootItem &item, QStringView query) {
-  namespace fuzz = rapidfuzz::fuzz;
-  double nameScore =
-      fuzz::partial_ratio(item.displayName().toStdString(), query.toString().toStdString(), 70);
+double RootSearcher::computeFuzzyScore(const RootSearchIndex::Entry &entry, const FuzzyScorer &scorer) const {
+  double nameScore = scorer.similarity(m_index.utf8(entry.utf8Name), FUZZY_CUTOFF);
 
   return clampScore(nameScore / 100);
 }
 
-std::vector<RootSearcher::ScoredItem>
-RootSearcher::search(const std::vector<std::shared_ptr<RootItem>> &items, QStringView s) {
+double RootSearcher::computeScore(const RootSearchIndex::Entry &entry, QStringView query,
+                                  const FuzzyScorer &scorer, bool maybeTypo) const {
+  double exactScore = computeExactScore(entry, query);
+
+  // the fuzzy scorer is what is expensive, entries that are neither matched nor a typo away can skip it
+  if (exactScore == 0 && !maybeTypo) return 0;
+
+  double fuzzyScore = computeFuzzyScore(entry, scorer);
+
+  return (exactScore * EXACT_WEIGHT) + (fuzzyScore * FUZZY_WEIGHT);
+}
+
+std::vector<RootSearcher::ScoredItem> RootSearcher::search(QStringView s,
+                                                           const RootItemPrefixSearchOptions &opts) const {
+  std::vector<uint32_t> candidates(m_index.size());
+
+  std::iota(candidates.begin(), candidates.end(), 0);
+
+  return search(s, candidates, opts);
+}
+
+std::vector<RootSearcher::ScoredItem> RootSearcher::search(QStringView s, std::span<const uint32_t> candidates,
+                                                           const RootItemPrefixSearchOptions &opts) const {
+  SearchProfiler::Scope profile("root");
   std::vector<ScoredItem> results;
-  std::string str = s.toString().toStdString();
+  QString query = TextTokenizer::normalize(s);
+  std::string utf8Query = query.toStdString();
+  FuzzyScorer scorer(utf8Query);
+  const auto &entries = m_index.entries();
+  std::vector<uint32_t> typoCandidates = m_index.typos().candidates(typoWord(query));
 
   results.reserve(100);
 
-  double exactWeight = 0.8;
-  double fuzzyWeight = 0.2;
+  for (size_t i = 0; i != candidates.size(); ++i) {
+    uint32_t idx = candidates[i];
+    const auto &entry = entries[idx];
+
+    if (m_isCanceled && i % CANCELLATION_CHECK_INTERVAL == 0 && m_isCanceled()) {
+      profile.discard();
+      return {};
+    }
+
+    if (!opts.includeDisabled && !entry.enabled) continue;
 
-  for (const auto &item : items) {
-    double exactScore = computeExactScore(*item, s);
-    double fuzzyScore = computeFuzzyScore(*item, s);
-    double score = (exactScore * exactWeight) + (fuzzyScore * fuzzyWeight);
+    bool maybeTypo = std::ranges::binary_search(typoCandidates, idx);
+    double score = computeScore(entry, query, scorer, maybeTypo);
 
-    if (score > 0) { results.emplace_back(ScoredItem{.score = score, .item = item}); }
+    if (score > 0) { results.emplace_back(ScoredItem{.score = score, .item = entry.item, .index = idx}); }
   }
 
-  std::ranges::sort(results, [](auto &&a, auto &&b) { return a.score > b.score; });
+  profile.setResultCount(results.size());
 
   return results;
 }
 
-RootSearcher::RootSearcher(const std::unordered_map<QString, RootItemMetadata> &meta) : m_meta(meta) {}
+RootSearcher::RootSearcher(const RootSearchIndex &index) : m_index(index) {}
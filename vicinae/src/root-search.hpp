@@ -1,28 +1,69 @@
 #pragma once
 #include "services/root-item-manager/root-item-manager.hpp"
+#include "services/root-item-manager/root-search-index.hpp"
+#include <functional>
 #include <qstringview.h>
+#include "rapidfuzz/fuzz.hpp"
 
 /**
  * To search root items from a query.
- * This only performs string based fuzzy search, the results are sorted
- * according to frecency rules later on outside this class.
+ * This only performs string based fuzzy search, the results are returned unsorted
+ * and ranked according to frecency rules later on outside this class.
+ *
+ * Scoring is performed against a precomputed `RootSearchIndex`, the query is normalized once
+ * and then compared to the already normalized item text. The fuzzy scorer is built once per query
+ * and reused for every entry, instead of rebuilding the pattern tables for each comparison.
+ *
+ * Only the entries the query matches exactly, or that its first word long enough could be a typo of
+ * according to the typo index, are fuzzily scored.
  */
 class RootSearcher {
-  const std::unordered_map<QString, RootItemMetadata> &m_meta;
+  using FuzzyScorer = rapidfuzz::fuzz::CachedPartialRatio<char>;
 
-  double computeExactStringScore(QStringView str, QStringView query);
-  double computeExactScore(const RootItem &item, QStringView query);
-  double computeFuzzyScore(const RootItem &item, QStringView query);
-  double clampScore(double v);
-  RootItemMetadata metadata(const QString &id) const;
+  // fuzzy scoring is cheap now that the pattern is only processed once per query,
+  // so it can weigh a bit more than it used to.
+  static constexpr double EXACT_WEIGHT = 0.7;
+  static constexpr double FUZZY_WEIGHT = 0.3;
+  static constexpr double FUZZY_CUTOFF = 70;
+
+  const RootSearchIndex &m_index;
+  std::function<bool()> m_isCanceled;
+
+  double computeExactStringScore(const RootSearchIndex::Field &field, QStringView query) const;
+  double computeExactScore(const RootSearchIndex::Entry &entry, QStringView query) const;
+  double computeFuzzyScore(const RootSearchIndex::Entry &entry, const FuzzyScorer &scorer) const;
+  double clampScore(double v) const;
+  double computeScore(const RootSearchIndex::Entry &entry, QStringView query, const FuzzyScorer &scorer,
+                      bool maybeTypo) const;
 
 public:
   struct ScoredItem {
     double score;
     std::shared_ptr<RootItem> item;
+    // position of the matching entry inside the search index
+    uint32_t index = 0;
   };
 
-  std::vector<ScoredItem> search(const std::vector<std::shared_ptr<RootItem>> &items, QStringView s);
+  std::vector<ScoredItem> search(QStringView s, const RootItemPrefixSearchOptions &opts = {}) const;
+
+  /**
+   * Whether typos are looked up for `query`. The results of a query for which they are not can miss
+   * entries that a longer version of it matches, and can't be used to refine it.
+   */
+  static bool toleratesTypos(QStringView query);
+
+  /**
+   * Same as `search`, but only the entries at the provided index positions are considered.
+   * Used to refine the results of a previous query.
+   */
+  std::vector<ScoredItem> search(QStringView s, std::span<const uint32_t> candidates,
+                                 const RootItemPrefixSearchOptions &opts = {}) const;
+
+  /**
+   * Periodically called while searching, if it returns true the search is aborted
+   * and returns no results.
+   */
+  void setCancellationCheck(const std::function<bool()> &fn) { m_isCanceled = fn; }
 
-  RootSearcher(const std::unordered_map<QString, RootItemMetadata> &meta);
+  RootSearcher(const RootSearchIndex &index);
 };
@@ -0,0 +1,17 @@
+#include "root-search/calculator/calculator-search-source.hpp"
+#include "services/calculator-service/calculator-service.hpp"
+
+bool CalculatorSearchSource::accepts(const QString &query) const {
+  // words alone are not worth computing, anything else might be an expression
+  return std::ranges::any_of(query, [](QChar ch) { return !ch.isLetterOrNumber() || ch.isSpace(); });
+}
+
+QFuture<RootSearchSource::Results> CalculatorSearchSource::search(const QString &query) {
+  return m_calculator.computeAsync(query).then([](const AbstractCalculatorBackend::ComputeResult &result) {
+    Results results;
+
+    if (result) { results.emplace_back(std::make_shared<BaseCalculatorListItem>(*result)); }
+
+    return results;
+  });
+}
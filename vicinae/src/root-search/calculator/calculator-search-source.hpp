@@ -0,0 +1,64 @@
+#pragma once
+#include "actions/calculator/calculator-actions.hpp"
+#include "services/calculator-service/abstract-calculator-backend.hpp"
+#include "services/root-item-manager/federated-root-search.hpp"
+#include "ui/calculator-list-item-widget.hpp"
+#include "ui/omni-list/omni-list.hpp"
+#include "ui/views/list-view.hpp"
+
+class CalculatorService;
+
+class BaseCalculatorListItem : public OmniList::AbstractVirtualItem, public ListView::Actionnable {
+protected:
+  const AbstractCalculatorBackend::CalculatorResult item;
+
+  OmniListItemWidget *createWidget() const override {
+    return new CalculatorListItemWidget(CalculatorItem{.expression = item.question, .result = item.answer});
+  }
+
+  int calculateHeight(int width) const override {
+    static CalculatorListItemWidget ruler({});
+
+    return ruler.sizeHint().height();
+  }
+
+  QString generateId() const override { return item.question; }
+
+  std::unique_ptr<ActionPanelState> newActionPanel(ApplicationContext *ctx) const override {
+    auto panel = std::make_unique<ActionPanelState>();
+    auto copyAnswer = new CopyCalculatorAnswerAction(item);
+    auto copyQA = new CopyCalculatorQuestionAndAnswerAction(item);
+    auto putAnswerInSearchBar = new PutCalculatorAnswerInSearchBar(item);
+    auto openHistory = new OpenCalculatorHistoryAction();
+    auto main = panel->createSection();
+
+    copyAnswer->setPrimary(true);
+    main->addAction(copyAnswer);
+    main->addAction(copyQA);
+    main->addAction(putAnswerInSearchBar);
+    main->addAction(openHistory);
+
+    return panel;
+  }
+
+public:
+  BaseCalculatorListItem(const AbstractCalculatorBackend::CalculatorResult &item) : item(item) {}
+};
+
+/**
+ * Answer to the query, when it looks like something to compute. Shown on top of the root items, as long as
+ * it is computed in time.
+ */
+class CalculatorSearchSource : public RootSearchSource {
+  CalculatorService &m_calculator;
+
+public:
+  QString id() const override { return "calculator"; }
+  QString title() const override { return "Calculator"; }
+  Placement placement() const override { return Placement::BeforeItems; }
+  std::chrono::milliseconds budget() const override { return std::chrono::milliseconds(50); }
+  bool accepts(const QString &query) const override;
+  QFuture<Results> search(const QString &query) override;
+
+  CalculatorSearchSource(CalculatorService &calculator) : m_calculator(calculator) {}
+};
@@ -5,7 +5,9 @@
 #include "clipboard-actions.hpp"
 #include "command-actions.hpp"
 #include "extension/extension-command.hpp"
+#include "extension/manager/extension-manager.hpp"
 #include "navigation-controller.hpp"
+#include "service-registry.hpp"
 #include "services/root-item-manager/root-item-manager.hpp"
 
 QString CommandRootItem::displayName() const { return m_command->name(); }
@@ -17,6 +19,15 @@ bool CommandRootItem::isSuitableForFallback() const { return m_command->isFallba
 double CommandRootItem::baseScoreWeight() const { return 1.1; }
 QString CommandRootItem::typeDisplayName() const { return "Command"; }
 
+void CommandRootItem::prewarm(ApplicationContext *ctx) const {
+  if (m_command->type() != CommandType::CommandTypeExtension) return;
+
+  auto cmd = static_cast<const ExtensionCommand *>(m_command.get());
+  auto preferences = ctx->services->rootItemManager()->getPreferenceValues(uniqueId());
+
+  ctx->services->extensionManager()->prewarmCommand(*cmd, preferences);
+}
+
 std::unique_ptr<ActionPanelState> CommandRootItem::newActionPanel(ApplicationContext *ctx,
                                                                   const RootItemMetadata &metadata) {
   auto panel = std::make_unique<ActionPanelState>();
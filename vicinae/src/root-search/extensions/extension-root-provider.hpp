@@ -35,6 +35,8 @@ public:
     m_command->preferenceValuesChanged(values);
   }
 
+  void prewarm(ApplicationContext *ctx) const override;
+
 public:
   auto command() const { return m_command; }
   CommandRootItem(const std::shared_ptr<AbstractCmd> &command) : m_command(command) {}
@@ -0,0 +1,24 @@
+#include "root-search/files/file-search-source.hpp"
+#include "services/config/config-service.hpp"
+#include "services/files-service/file-service.hpp"
+
+bool FileSearchSource::accepts(const QString &query) const {
+  return m_config.value().rootSearch.searchFiles && query.size() >= MIN_QUERY_LENGTH;
+}
+
+QFuture<RootSearchSource::Results> FileSearchSource::search(const QString &query) {
+  auto future = m_files.indexer()->queryAsync(
+      query.toStdString(), {.pagination = {.limit = RESULT_LIMIT}, .consumer = "root-search"});
+
+  return future.then([](const std::vector<IndexerFileResult> &files) {
+    Results results;
+
+    results.reserve(files.size());
+
+    for (const auto &file : files) {
+      results.emplace_back(std::make_shared<RootFileListItem>(file.path));
+    }
+
+    return results;
+  });
+}
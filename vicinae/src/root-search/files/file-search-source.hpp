@@ -0,0 +1,81 @@
+#pragma once
+#include "actions/app/app-actions.hpp"
+#include "actions/files/file-actions.hpp"
+#include "service-registry.hpp"
+#include "services/app-service/app-service.hpp"
+#include "services/root-item-manager/federated-root-search.hpp"
+#include "ui/omni-list/omni-list.hpp"
+#include "ui/views/list-view.hpp"
+#include "utils/utils.hpp"
+#include <filesystem>
+#include <qicon.h>
+#include <qmimedatabase.h>
+
+class ConfigService;
+class FileService;
+
+class RootFileListItem : public AbstractDefaultListItem, public ListView::Actionnable {
+  std::filesystem::path m_path;
+  QMimeDatabase m_mimeDb;
+
+  ImageURL getIcon() const {
+    auto mime = m_mimeDb.mimeTypeForFile(m_path.c_str());
+
+    if (!mime.name().isEmpty()) {
+      if (!QIcon::fromTheme(mime.iconName()).isNull()) { return ImageURL::system(mime.iconName()); }
+
+      return ImageURL::system(mime.genericIconName());
+    }
+
+    return ImageURL::builtin("question-mark-circle");
+  }
+
+  std::unique_ptr<ActionPanelState> newActionPanel(ApplicationContext *ctx) const override {
+    auto panel = std::make_unique<ActionPanelState>();
+    auto appDb = ctx->services->appDb();
+    auto section = panel->createSection();
+    auto openInFolder = new OpenAppAction(appDb->fileBrowser(), "Open in folder", {m_path.c_str()});
+
+    if (auto app = appDb->findBestOpener(m_path.c_str())) {
+      auto open = new OpenFileAction(app, m_path);
+      open->setPrimary(true);
+      section->addAction(open);
+    } else {
+      openInFolder->setPrimary(true);
+    }
+
+    section->addAction(openInFolder);
+
+    return panel;
+  }
+
+public:
+  QString generateId() const override { return m_path.c_str(); }
+
+  ItemData data() const override {
+    return {.iconUrl = getIcon(), .name = m_path.filename().c_str(), .subtitle = compressPath(m_path)};
+  }
+
+  RootFileListItem(const std::filesystem::path &path) : m_path(path) {}
+};
+
+/**
+ * Indexed files matching the query, shown below the root items. Only queries of `MIN_QUERY_LENGTH`
+ * characters or more are searched, shorter ones match too many files for the results to be of any use.
+ */
+class FileSearchSource : public RootSearchSource {
+  static constexpr qsizetype MIN_QUERY_LENGTH = 3;
+  static constexpr int RESULT_LIMIT = 8;
+
+  FileService &m_files;
+  ConfigService &m_config;
+
+public:
+  QString id() const override { return "files"; }
+  QString title() const override { return "Files"; }
+  std::chrono::milliseconds budget() const override { return std::chrono::milliseconds(30); }
+  bool accepts(const QString &query) const override;
+  QFuture<Results> search(const QString &query) override;
+
+  FileSearchSource(FileService &files, ConfigService &config) : m_files(files), m_config(config) {}
+};
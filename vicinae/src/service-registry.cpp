@@ -10,10 +10,12 @@
 #include "services/clipboard/clipboard-service.hpp"
 #include "services/config/config-service.hpp"
 #include "services/emoji-service/emoji-service.hpp"
+#include "services/extension-cache/extension-cache-service.hpp"
 #include "services/extension-registry/extension-registry.hpp"
 #include "services/files-service/file-service.hpp"
 #include "services/local-storage/local-storage-service.hpp"
 #include "services/oauth/oauth-service.hpp"
+#include "services/raycast/extension-update-checker.hpp"
 #include "services/raycast/raycast-store.hpp"
 #include "services/root-item-manager/root-item-manager.hpp"
 #include "services/toast/toast-service.hpp"
@@ -24,19 +26,31 @@ ConfigService *ServiceRegistry::config() const { return m_config.get(); }
 OmniDatabase *ServiceRegistry::omniDb() const { return m_omniDb.get(); }
 CalculatorService *ServiceRegistry::calculatorService() const { return m_calculatorService.get(); }
 WindowManager *ServiceRegistry::windowManager() const { return m_windowManager.get(); }
-EmojiService *ServiceRegistry::emojiService() const { return m_emojiService.get(); }
+EmojiService *ServiceRegistry::emojiService() const {
+  if (!m_emojiService) { m_startup.require("emoji"); }
+  return m_emojiService.get();
+}
 FontService *ServiceRegistry::fontService() const { return m_fontService.get(); }
 OmniCommandDatabase *ServiceRegistry::commandDb() const { return m_omniCommandDb.get(); }
 LocalStorageService *ServiceRegistry::localStorage() const { return m_localStorage.get(); }
+ExtensionCacheService *ServiceRegistry::extensionCache() const { return m_extensionCache.get(); }
 ExtensionManager *ServiceRegistry::extensionManager() const { return m_extensionManager.get(); }
 ClipboardService *ServiceRegistry::clipman() const { return m_clipman.get(); }
 AppService *ServiceRegistry::appDb() const { return m_appDb.get(); }
 ToastService *ServiceRegistry::toastService() const { return m_toastService.get(); }
 ShortcutService *ServiceRegistry::shortcuts() const { return m_shortcutService.get(); }
 FileService *ServiceRegistry::fileService() const { return m_fileService.get(); }
-RaycastStoreService *ServiceRegistry::raycastStore() const { return m_raycastStoreService.get(); }
+RaycastStoreService *ServiceRegistry::raycastStore() const {
+  if (!m_raycastStoreService) { m_startup.require("raycast-store"); }
+  return m_raycastStoreService.get();
+}
+ExtensionUpdateChecker *ServiceRegistry::extensionUpdates() const {
+  if (!m_extensionUpdates) { m_startup.require("extension-updates"); }
+  return m_extensionUpdates.get();
+}
 ExtensionRegistry *ServiceRegistry::extensionRegistry() const { return m_extensionRegistry.get(); }
 OAuthService *ServiceRegistry::oauthService() const { return m_oauthService.get(); }
+StartupScheduler &ServiceRegistry::startup() { return m_startup; }
 
 void ServiceRegistry::setWindowManager(std::unique_ptr<WindowManager> manager) {
   m_windowManager = std::move(manager);
@@ -48,6 +62,9 @@ void ServiceRegistry::ServiceRegistry::setRootItemManager(std::unique_ptr<RootIt
 void ServiceRegistry::ServiceRegistry::setRaycastStore(std::unique_ptr<RaycastStoreService> service) {
   m_raycastStoreService = std::move(service);
 }
+void ServiceRegistry::setExtensionUpdates(std::unique_ptr<ExtensionUpdateChecker> checker) {
+  m_extensionUpdates = std::move(checker);
+}
 void ServiceRegistry::ServiceRegistry::setOAuthService(std::unique_ptr<OAuthService> service) {
   m_oauthService = std::move(service);
 }
@@ -83,6 +100,9 @@ void ServiceRegistry::setCommandDb(std::unique_ptr<OmniCommandDatabase> commandD
 void ServiceRegistry::setLocalStorage(std::unique_ptr<LocalStorageService> service) {
   m_localStorage = std::move(service);
 }
+void ServiceRegistry::setExtensionCache(std::unique_ptr<ExtensionCacheService> service) {
+  m_extensionCache = std::move(service);
+}
 void ServiceRegistry::setExtensionManager(std::unique_ptr<ExtensionManager> service) {
   m_extensionManager = std::move(service);
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "startup-scheduler.hpp"
 #include <memory>
 #include <qobject.h>
 
@@ -8,6 +9,7 @@ class AppService;
 class OmniDatabase;
 class OmniCommandDatabase;
 class LocalStorageService;
+class ExtensionCacheService;
 class ExtensionManager;
 class ClipboardService;
 class FontService;
@@ -20,6 +22,7 @@ class EmojiService;
 class CalculatorService;
 class FileService;
 class RaycastStoreService;
+class ExtensionUpdateChecker;
 class ExtensionRegistry;
 class OAuthService;
 class WindowManager;
@@ -30,6 +33,7 @@ class ServiceRegistry : public QObject {
   std::unique_ptr<OmniDatabase> m_omniDb;
   std::unique_ptr<OmniCommandDatabase> m_omniCommandDb;
   std::unique_ptr<LocalStorageService> m_localStorage;
+  std::unique_ptr<ExtensionCacheService> m_extensionCache;
   std::unique_ptr<ExtensionManager> m_extensionManager;
   std::unique_ptr<ClipboardService> m_clipman;
   std::unique_ptr<FontService> m_fontService;
@@ -42,11 +46,15 @@ class ServiceRegistry : public QObject {
   std::unique_ptr<CalculatorService> m_calculatorService;
   std::unique_ptr<FileService> m_fileService;
   std::unique_ptr<RaycastStoreService> m_raycastStoreService;
+  std::unique_ptr<ExtensionUpdateChecker> m_extensionUpdates;
   std::unique_ptr<ExtensionRegistry> m_extensionRegistry;
   std::unique_ptr<OAuthService> m_oauthService;
+  // deferred services are started on first access if their turn did not come yet
+  mutable StartupScheduler m_startup;
 
 public:
   static ServiceRegistry *instance();
+  StartupScheduler &startup();
   RootItemManager *rootItemManager() const;
   ConfigService *config() const;
   OmniDatabase *omniDb() const;
@@ -56,6 +64,7 @@ public:
   FontService *fontService() const;
   OmniCommandDatabase *commandDb() const;
   LocalStorageService *localStorage() const;
+  ExtensionCacheService *extensionCache() const;
   ExtensionManager *extensionManager() const;
   ClipboardService *clipman() const;
   AppService *appDb() const;
@@ -63,12 +72,14 @@ public:
   ShortcutService *shortcuts() const;
   FileService *fileService() const;
   RaycastStoreService *raycastStore() const;
+  ExtensionUpdateChecker *extensionUpdates() const;
   ExtensionRegistry *extensionRegistry() const;
   OAuthService *oauthService() const;
 
   void setWindowManager(std::unique_ptr<WindowManager> manager);
   void setRootItemManager(std::unique_ptr<RootItemManager> manager);
   void setRaycastStore(std::unique_ptr<RaycastStoreService> service);
+  void setExtensionUpdates(std::unique_ptr<ExtensionUpdateChecker> checker);
   void setOAuthService(std::unique_ptr<OAuthService> service);
   void setConfig(std::unique_ptr<ConfigService> cfg);
   void setShortcutService(std::unique_ptr<ShortcutService> service);
@@ -83,6 +94,7 @@ public:
   void setWindowManager(std::unique_ptr<AbstractWindowManager> service);
   void setCommandDb(std::unique_ptr<OmniCommandDatabase> commandDb);
   void setLocalStorage(std::unique_ptr<LocalStorageService> service);
+  void setExtensionCache(std::unique_ptr<ExtensionCacheService> service);
   void setExtensionManager(std::unique_ptr<ExtensionManager> service);
   void setClipman(std::unique_ptr<ClipboardService> service);
   void setAppDb(std::unique_ptr<AppService> service);
@@ -1,4 +1,5 @@
 #pragma once
+#include <functional>
 #include "../../ui/image/url.hpp"
 #include <QString>
 #include <qmimetype.h>
@@ -46,6 +47,14 @@ public:
 
   virtual bool scan(const std::vector<std::filesystem::path> &paths) = 0;
 
+  /**
+   * Same as `scan`, the slow part of it being done on a worker thread. `done` is called from the thread
+   * of the database once the result of the scan is in use. Scans synchronously by default.
+   */
+  virtual void scanAsync(const std::vector<std::filesystem::path> &paths, std::function<void(bool)> done) {
+    done(scan(paths));
+  }
+
   virtual bool launch(const Application &exec, const std::vector<QString> &args = {}) const = 0;
   /**
    * Returns the best app to open the passed target.
@@ -1,6 +1,8 @@
 #include "app-service.hpp"
+#include "services/app-service/process-launcher.hpp"
 #include "services/app-service/xdg/xdg-app-database.hpp"
 #include "omni-database.hpp"
+#include "vicinae.hpp"
 #include <filesystem>
 #include <qfilesystemwatcher.h>
 #include <ranges>
@@ -48,19 +50,7 @@ std::shared_ptr<Application> AppService::terminalEmulator() const {
 }
 
 bool AppService::launchRaw(const QString &prog, const std::vector<QString> &args) {
-  QProcess process;
-
-  process.setProgram(prog);
-  process.setArguments(args | std::ranges::to<QStringList>());
-  process.setStandardOutputFile(QProcess::nullDevice());
-  process.setStandardErrorFile(QProcess::nullDevice());
-
-  if (!process.startDetached()) {
-    qWarning() << "Failed to start app" << prog << args << process.errorString();
-    return false;
-  }
-
-  return true;
+  return ProcessLauncher::instance().launch(prog, args);
 }
 
 std::shared_ptr<Application> AppService::findById(const QString &id) const {
@@ -97,11 +87,9 @@ std::shared_ptr<Application> AppService::find(const QString &target) const {
 }
 
 void AppService::handleDirectoryChanged(const QString &path) {
-  // This event can fire multiple times for a single change.
-  // Since scanning apps is fast we don't really need to batch events, at least for now.
-
-  qInfo() << "app directory" << path << "changed, launching a new scan";
-  scanSync();
+  // This event can fire multiple times for a single change, only the last one of a burst starts a scan.
+  qInfo() << "app directory" << path << "changed, scheduling a new scan";
+  m_rescanTimer->start();
 }
 
 void AppService::setAdditionalSearchPaths(const std::vector<std::filesystem::path> &paths) {
@@ -117,19 +105,31 @@ bool AppService::reinstallWatches(const std::vector<fs::path> &paths) {
   for (const auto &path : m_watcher->directories()) {
     m_watcher->removePath(path);
   }
+  for (const auto &path : m_watcher->files()) {
+    m_watcher->removePath(path);
+  }
 
   auto isDir = [](auto &&path) { return fs::is_directory(path); };
+  auto isFile = [](auto &&path) { return fs::is_regular_file(path); };
+  auto toMimeApps = [](const fs::path &dir) { return dir / "mimeapps.list"; };
 
   for (const auto &path : paths | std::views::filter(isDir)) {
     m_watcher->addPath(path.c_str());
   }
 
+  // changing a default application only touches these, resolved openers have to be dropped
+  for (const auto &path : Omnicast::xdgConfigDirs() | std::views::transform(toMimeApps) |
+                              std::views::filter(isFile)) {
+    m_watcher->addPath(path.c_str());
+  }
+
   return true;
 }
 
 bool AppService::scanSync() {
   bool result = m_provider->scan(mergedPaths());
 
+  ++m_generation;
   emit appsChanged();
 
   return result;
@@ -138,4 +138,16 @@ bool AppService::scanSync() {
 AppService::AppService(OmniDatabase &db) : m_db(db), m_provider(createLocalProvider()) {
   reinstallWatches(mergedPaths());
   connect(m_watcher, &QFileSystemWatcher::directoryChanged, this, &AppService::handleDirectoryChanged);
+  connect(m_watcher, &QFileSystemWatcher::fileChanged, this, &AppService::handleDirectoryChanged);
+
+  m_rescanTimer->setSingleShot(true);
+  m_rescanTimer->setInterval(500);
+  connect(m_rescanTimer, &QTimer::timeout, this, [this]() {
+    m_provider->scanAsync(mergedPaths(), [this](bool) {
+      // editors replace mimeapps.list rather than writing to it, which drops its watch
+      reinstallWatches(mergedPaths());
+      ++m_generation;
+      emit appsChanged();
+    });
+  });
 }
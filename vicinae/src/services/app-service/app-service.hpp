@@ -7,6 +7,7 @@
 #include <qobject.h>
 #include <qobjectdefs.h>
 #include <qsqlquery.h>
+#include <qtimer.h>
 #include <qtmetamacros.h>
 
 class AppService : public QObject, public NonCopyable {
@@ -17,8 +18,11 @@ public:
 
 private:
   QFileSystemWatcher *m_watcher = new QFileSystemWatcher(this);
+  // package upgrades touch application directories many times in a row
+  QTimer *m_rescanTimer = new QTimer(this);
   OmniDatabase &m_db;
   std::unique_ptr<AbstractAppDatabase> m_provider;
+  uint32_t m_generation = 1;
 
   static std::unique_ptr<AbstractAppDatabase> createLocalProvider();
   std::vector<std::filesystem::path> mergedPaths() const;
@@ -33,6 +37,11 @@ public:
   AbstractAppDatabase *provider() const;
   std::vector<std::shared_ptr<Application>> list() const;
 
+  /**
+   * Bumped every time the applications are scanned again, right before `appsChanged` is emitted.
+   */
+  uint32_t generation() const { return m_generation; }
+
   /**
    * Launch application with the provided set of arguments. If the application
    * runs in a terminal, the default system terminal will be spawned.
@@ -0,0 +1,180 @@
+#include "services/app-service/process-launcher.hpp"
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <qlogging.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char **environ;
+
+ProcessLauncher &ProcessLauncher::instance() {
+  static ProcessLauncher launcher;
+
+  return launcher;
+}
+
+std::string ProcessLauncher::resolve(const QString &program) {
+  if (auto it = m_executables.find(program); it != m_executables.end()) { return it->second; }
+
+  QString path = program.contains('/') ? QFileInfo(program).absoluteFilePath()
+                                       : QStandardPaths::findExecutable(program);
+
+  // programs that can't be found are not remembered, they may be installed later
+  if (path.isEmpty() || !QFileInfo(path).isExecutable()) return {};
+
+  return m_executables.insert({program, path.toStdString()}).first->second;
+}
+
+bool ProcessLauncher::launch(const QString &program, const std::vector<QString> &args) {
+  std::string path = resolve(program);
+
+  if (path.empty()) {
+    qWarning() << "Failed to start" << program << "as it could not be found";
+    return false;
+  }
+
+  Request request;
+
+  if (m_useSystemdScope) {
+    request.path = m_systemdRun;
+    request.argv = {m_systemdRun, "--user", "--scope", "--quiet", "--collect", "--"};
+  } else {
+    request.path = path;
+  }
+
+  request.argv.reserve(request.argv.size() + args.size() + 1);
+  request.argv.emplace_back(path);
+
+  for (const auto &arg : args) {
+    request.argv.emplace_back(arg.toStdString());
+  }
+
+  {
+    std::lock_guard lock(m_mutex);
+    m_queue.emplace_back(std::move(request));
+  }
+
+  m_cv.notify_one();
+
+  return true;
+}
+
+void ProcessLauncher::spawn(const Request &request) {
+  posix_spawn_file_actions_t actions;
+  posix_spawnattr_t attr;
+  sigset_t mask;
+  sigset_t defaults;
+  std::vector<char *> argv;
+  pid_t pid = 0;
+
+  argv.reserve(request.argv.size() + 1);
+  for (const auto &arg : request.argv) {
+    argv.emplace_back(const_cast<char *>(arg.c_str()));
+  }
+  argv.emplace_back(nullptr);
+
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+  posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+  posix_spawn_file_actions_addopen(&actions, STDERR_FILENO, "/dev/null", O_WRONLY, 0);
+
+  // children must not inherit the signals this thread blocks, nor how vicinae handles or ignores others
+  sigemptyset(&mask);
+  sigfillset(&defaults);
+  sigdelset(&defaults, SIGKILL);
+  sigdelset(&defaults, SIGSTOP);
+  posix_spawnattr_init(&attr);
+  posix_spawnattr_setsigmask(&attr, &mask);
+  posix_spawnattr_setsigdefault(&attr, &defaults);
+
+  short flags = POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF;
+#ifdef POSIX_SPAWN_SETSID
+  // for apps not to be killed along with the terminal or session vicinae was started from
+  flags |= POSIX_SPAWN_SETSID;
+#endif
+  posix_spawnattr_setflags(&attr, flags);
+
+  int error = posix_spawn(&pid, request.path.c_str(), &actions, &attr, argv.data(), m_envp.data());
+
+  posix_spawnattr_destroy(&attr);
+  posix_spawn_file_actions_destroy(&actions);
+
+  if (error != 0) {
+    qWarning() << "Failed to start" << request.path.c_str() << strerror(error);
+    return;
+  }
+
+  m_children.emplace_back(pid);
+}
+
+void ProcessLauncher::reap() {
+  std::erase_if(m_children, [](pid_t pid) {
+    int status = 0;
+
+    return waitpid(pid, &status, WNOHANG) != 0;
+  });
+}
+
+void ProcessLauncher::run() {
+  while (true) {
+    std::deque<Request> requests;
+
+    {
+      std::unique_lock lock(m_mutex);
+      auto ready = [this]() { return !m_alive || !m_queue.empty(); };
+
+      if (m_children.empty()) {
+        m_cv.wait(lock, ready);
+      } else {
+        m_cv.wait_for(lock, REAP_INTERVAL, ready);
+      }
+
+      requests.swap(m_queue);
+    }
+
+    for (const auto &request : requests) {
+      spawn(request);
+    }
+
+    reap();
+
+    // programs launched right before quitting are still started
+    std::lock_guard lock(m_mutex);
+    if (!m_alive && m_queue.empty()) return;
+  }
+}
+
+ProcessLauncher::ProcessLauncher() {
+  for (char **var = environ; *var; ++var) {
+    m_environment.emplace_back(*var);
+  }
+
+  m_envp.reserve(m_environment.size() + 1);
+  for (auto &var : m_environment) {
+    m_envp.emplace_back(var.data());
+  }
+  m_envp.emplace_back(nullptr);
+
+  if (qgetenv("VICINAE_LAUNCH_SYSTEMD_SCOPE") == "1") {
+    m_systemdRun = resolve("systemd-run");
+    m_useSystemdScope = !m_systemdRun.empty();
+
+    if (!m_useSystemdScope) { qWarning() << "systemd-run could not be found, apps are started directly"; }
+  }
+
+  m_thread = std::thread([this]() { run(); });
+}
+
+ProcessLauncher::~ProcessLauncher() {
+  {
+    std::lock_guard lock(m_mutex);
+    m_alive = false;
+  }
+
+  m_cv.notify_one();
+  m_thread.join();
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "common.hpp"
+#include <QString>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Starts programs detached from vicinae with posix_spawn, from a thread of its own: launching returns as
+ * soon as the program is known to exist, for the window to close without waiting for the child to start.
+ *
+ * The environment block children are started with is computed once, as are the paths programs resolve to
+ * in `PATH`. Children are put in a session of their own and get null standard streams. They are reaped
+ * once they exit, as spawned processes are not reparented like those of a double fork.
+ *
+ * Setting `VICINAE_LAUNCH_SYSTEMD_SCOPE=1` starts every program in a transient systemd scope of the user
+ * manager (`systemd-run --user --scope`), for them to be tracked and accounted separately from vicinae.
+ */
+class ProcessLauncher : public NonCopyable {
+public:
+  // how often exited children are looked for
+  static constexpr auto REAP_INTERVAL = std::chrono::seconds(2);
+
+  static ProcessLauncher &instance();
+
+  /**
+   * Start `program`, a path or a name looked up in `PATH`, with `args`. Returns false if it can't be found,
+   * failures to spawn it are only logged.
+   */
+  bool launch(const QString &program, const std::vector<QString> &args);
+
+  ~ProcessLauncher();
+
+private:
+  struct Request {
+    std::string path;
+    std::vector<std::string> argv;
+  };
+
+  ProcessLauncher();
+
+  /**
+   * Absolute path of the executable `program` refers to, empty if there is none.
+   */
+  std::string resolve(const QString &program);
+  void run();
+  void spawn(const Request &request);
+  void reap();
+
+  std::vector<std::string> m_environment;
+  std::vector<char *> m_envp;
+  std::unordered_map<QString, std::string> m_executables;
+  bool m_useSystemdScope = false;
+  std::string m_systemdRun;
+
+  // only accessed from the launcher thread
+  std::vector<pid_t> m_children;
+
+  bool m_alive = true;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<Request> m_queue;
+  std::thread m_thread;
+};
@@ -1,4 +1,6 @@
 #include "xdg-app-database.hpp"
+#include "services/app-service/process-launcher.hpp"
+#include "task-scheduler/task-scheduler.hpp"
 #include "vicinae.hpp"
 #include <exception>
 #include <filesystem>
@@ -7,6 +9,7 @@
 #include <ranges>
 #include <set>
 #include <QDir>
+#include <qfuturewatcher.h>
 
 namespace fs = std::filesystem;
 
@@ -24,6 +27,16 @@ std::shared_ptr<Application> XdgAppDatabase::defaultForMime(const QString &mime)
 }
 
 AppPtr XdgAppDatabase::findBestOpenerForMime(const QString &mimeName) const {
+  if (auto it = m_bestOpeners.find(mimeName); it != m_bestOpeners.end()) { return it->second; }
+
+  auto app = resolveBestOpenerForMime(mimeName);
+
+  m_bestOpeners.insert({mimeName, app});
+
+  return app;
+}
+
+AppPtr XdgAppDatabase::resolveBestOpenerForMime(const QString &mimeName) const {
   QMimeType mime = mimeDb.mimeTypeForName(mimeName);
 
   if (auto app = defaultForMime(mimeName)) { return app; }
@@ -32,7 +45,8 @@ AppPtr XdgAppDatabase::findBestOpenerForMime(const QString &mimeName) const {
     if (auto app = defaultForMime(mime)) return app;
   }
 
-  if (auto it = mimeToApps.find(mime.name()); it != mimeToApps.end()) {
+  // scheme handlers are not known to the mime database
+  if (auto it = mimeToApps.find(mime.isValid() ? mime.name() : mimeName); it != mimeToApps.end()) {
     for (const auto id : it->second) {
       if (auto app = findById(id)) return app;
     }
@@ -42,6 +56,16 @@ AppPtr XdgAppDatabase::findBestOpenerForMime(const QString &mimeName) const {
 }
 
 AppPtr XdgAppDatabase::findBestTerminalEmulator() const {
+  if (m_terminalEmulator) { return *m_terminalEmulator; }
+
+  auto emulator = resolveBestTerminalEmulator();
+
+  m_terminalEmulator = emulator;
+
+  return emulator;
+}
+
+AppPtr XdgAppDatabase::resolveBestTerminalEmulator() const {
   if (auto emulator = findBestOpenerForMime("x-scheme-handler/terminal")) { return emulator; }
 
   qWarning()
@@ -60,13 +84,9 @@ AppPtr XdgAppDatabase::findBestTerminalEmulator() const {
   return *result.begin();
 }
 
-bool XdgAppDatabase::scan(const std::vector<std::filesystem::path> &paths) {
-  appMap.clear();
-  mimeToApps.clear();
-  appToMimes.clear();
-  mimeToDefaultApp.clear();
-  apps.clear();
-
+XdgAppDatabase::ScanResult XdgAppDatabase::collect(const std::vector<fs::path> &paths,
+                                                   const ParseCache &cache) {
+  ScanResult result;
   std::vector<fs::path> traversed;
   std::set<QString> processedIds; // Track which .desktop ids we've already processed
 
@@ -84,19 +104,81 @@ bool XdgAppDatabase::scan(const std::vector<std::filesystem::path> &paths) {
       if (ec) continue;
       if (entry.path().extension() != ".desktop") continue;
 
-      try {
-        XdgDesktopEntry desktopEntry(dir, fs::relative(entry.path(), dir));
+      auto relative = fs::relative(entry.path(), dir);
+      auto key = dir.native() + '\0' + relative.native();
+      std::error_code mtimeError;
+      auto mtime = entry.last_write_time(mtimeError);
+      ParsedFile file{.mtime = mtime};
+
+      if (auto it = cache.find(key); !mtimeError && it != cache.end() && it->second.mtime == mtime) {
+        file = it->second;
+      } else {
+        try {
+          file.entry = std::make_shared<XdgDesktopEntry>(dir, relative);
+        } catch (std::exception &except) {
+          qWarning() << "Failed to parse app at" << entry.path() << except.what();
+        }
+      }
+
+      result.cache.insert({key, file});
 
-        if (processedIds.find(desktopEntry.id) != processedIds.end()) continue;
-        processedIds.insert(desktopEntry.id);
+      if (!file.entry || processedIds.contains(file.entry->id)) continue;
 
-        addDesktopFile(entry.path(), desktopEntry);
-      } catch (std::exception &except) {
-        qWarning() << "Failed to parse app at" << entry.path() << except.what();
-      }
+      processedIds.insert(file.entry->id);
+      result.files.emplace_back(entry.path(), file.entry);
     }
   }
 
+  return result;
+}
+
+void XdgAppDatabase::apply(ScanResult result) {
+  appMap.clear();
+  mimeToApps.clear();
+  appToMimes.clear();
+  mimeToDefaultApp.clear();
+  apps.clear();
+
+  for (const auto &[path, entry] : result.files) {
+    addDesktopFile(path, *entry);
+  }
+
+  m_parseCache = std::move(result.cache);
+  m_bestOpeners.clear();
+  m_openers.clear();
+  m_terminalEmulator.reset();
+  loadMimeApps();
+  buildClassIndex();
+}
+
+bool XdgAppDatabase::scan(const std::vector<std::filesystem::path> &paths) {
+  ++m_scanGeneration;
+  apply(collect(paths, m_parseCache));
+
+  return true;
+}
+
+void XdgAppDatabase::scanAsync(const std::vector<std::filesystem::path> &paths,
+                               std::function<void(bool)> done) {
+  auto generation = ++m_scanGeneration;
+  auto watcher = new QFutureWatcher<ScanResult>(this);
+
+  connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, generation, done]() {
+    watcher->deleteLater();
+
+    if (generation != m_scanGeneration) return;
+
+    apply(watcher->result());
+    done(true);
+  });
+
+  // entries are immutable once parsed, the copy of the cache shares them with ours. Apps are what the root
+  // search lists first, they are collected ahead of the other background scans.
+  watcher->setFuture(TaskScheduler::instance().run(
+      TaskScheduler::Priority::Prefetch, [paths, cache = m_parseCache]() { return collect(paths, cache); }));
+}
+
+void XdgAppDatabase::loadMimeApps() {
   auto toMimeApp = [](const fs::path &path) { return path / "mimeapps.list"; };
   auto isFile = [](const fs::path &path) {
     std::error_code ec;
@@ -149,8 +231,6 @@ bool XdgAppDatabase::scan(const std::vector<std::filesystem::path> &paths) {
     }
     ini.endGroup();
   }
-
-  return true;
 }
 
 std::vector<fs::path> XdgAppDatabase::defaultSearchPaths() const {
@@ -188,36 +268,14 @@ XdgAppDatabase::AppPtr XdgAppDatabase::findBestOpener(const QString &target) con
   QUrl url(target);
 
   if (!url.scheme().isEmpty()) {
-    QString mime = "x-scheme-handler/" + url.scheme();
-
-    if (auto it = mimeToDefaultApp.find(mime); it != mimeToDefaultApp.end()) {
-      if (auto it2 = appMap.find(it->second); it2 != appMap.end()) return it2->second;
-    }
-
-    if (auto it = mimeToApps.find(mime); it != mimeToApps.end()) {
-      for (const auto &appId : it->second) {
-        if (auto it2 = appMap.find(appId); it2 != appMap.end()) return it2->second;
-      }
-    }
+    if (auto app = findBestOpenerForMime("x-scheme-handler/" + url.scheme())) { return app; }
   }
 
   QMimeType mime = mimeDb.mimeTypeForFile(target);
 
   if (!mime.isValid()) return nullptr;
 
-  if (auto app = defaultForMime(mime.name())) { return app; }
-
-  for (const auto &mime : mime.parentMimeTypes()) {
-    if (auto app = defaultForMime(mime)) return app;
-  }
-
-  if (auto it = mimeToApps.find(mime.name()); it != mimeToApps.end()) {
-    for (const auto id : it->second) {
-      if (auto app = findById(id)) return app;
-    }
-  }
-
-  return nullptr;
+  return findBestOpenerForMime(mime.name());
 }
 
 AppPtr XdgAppDatabase::findById(const QString &id) const {
@@ -227,29 +285,24 @@ AppPtr XdgAppDatabase::findById(const QString &id) const {
   return nullptr;
 }
 
-std::vector<AppPtr> XdgAppDatabase::findOpeners(const QString &mimeName) const {
-  QUrl url(mimeName);
+std::vector<AppPtr> XdgAppDatabase::findOpeners(const QString &target) const {
+  QUrl url(target);
+  QString mimeName = target;
 
   if (!url.scheme().isEmpty()) {
-    std::vector<AppPtr> apps;
-    QString mime = url.scheme() == "file" ? "inode/directory" : "x-scheme-handler/" + url.scheme();
+    mimeName = url.scheme() == "file" ? "inode/directory" : "x-scheme-handler/" + url.scheme();
+  }
 
-    if (auto it = mimeToDefaultApp.find(mime); it != mimeToDefaultApp.end()) {
-      if (auto it2 = appMap.find(it->second); it2 != appMap.end()) { apps.emplace_back(it2->second); }
-    }
+  if (auto it = m_openers.find(mimeName); it != m_openers.end()) { return it->second; }
 
-    if (auto it = mimeToApps.find(mime); it != mimeToApps.end()) {
-      for (const auto &appId : it->second) {
-        if (auto it2 = appMap.find(appId); it2 != appMap.end()) {
-          bool alreadyIn = std::ranges::any_of(apps, [&](auto &&app) { return app->id() == appId; });
-          if (!alreadyIn) { apps.emplace_back(it2->second); }
-        }
-      }
-    }
+  auto apps = resolveOpeners(mimeName);
 
-    return apps;
-  }
+  m_openers.insert({mimeName, apps});
+
+  return apps;
+}
 
+std::vector<AppPtr> XdgAppDatabase::resolveOpeners(const QString &mimeName) const {
   std::vector<AppPtr> apps;
   std::set<QString> seen;
   std::vector<QString> mimes = {mimeName};
@@ -288,7 +341,7 @@ bool XdgAppDatabase::launch(const Application &app, const std::vector<QString> &
   if (exec.empty()) { return false; }
 
   QString program;
-  QStringList argv;
+  std::vector<QString> argv;
   size_t offset = 0;
 
   if (xdgApp.isTerminalApp()) {
@@ -302,7 +355,7 @@ bool XdgAppDatabase::launch(const Application &app, const std::vector<QString> &
                     "generic 'xterm'";
       program = "xterm";
     }
-    argv << "-e";
+    argv.emplace_back("-e");
   } else {
     program = exec.at(0);
     offset = 1;
@@ -314,7 +367,7 @@ bool XdgAppDatabase::launch(const Application &app, const std::vector<QString> &
     auto &part = exec.at(i);
 
     if (part == "%u" || part == "%f") {
-      if (!args.empty()) argv << args.at(0);
+      if (!args.empty()) argv.emplace_back(args.at(0));
       injected = true;
     } else if (part == "%U" || part == "%F") {
       for (const auto &arg : args) {
@@ -322,39 +375,78 @@ bool XdgAppDatabase::launch(const Application &app, const std::vector<QString> &
       }
       injected = true;
     } else {
-      argv << part;
+      argv.emplace_back(part);
     }
   }
 
   // if no injection was possible, we simply append the args
-  if (!injected) {
-    for (const auto &arg : args) {
-      argv << arg;
+  if (!injected) { argv.insert(argv.end(), args.begin(), args.end()); }
+
+  return ProcessLauncher::instance().launch(program, argv);
+}
+
+/**
+ * Name of the executable `exec` runs, or the id of the app for Flatpak apps, which are run from the flatpak
+ * executable.
+ */
+static QString executableName(const QList<QString> &exec) {
+  auto it = exec.begin();
+
+  // env VAR=value program
+  if (it != exec.end() && QFileInfo(*it).fileName() == "env") {
+    ++it;
+    while (it != exec.end() && it->contains('=')) {
+      ++it;
     }
   }
 
-  QProcess process;
+  if (it == exec.end()) return {};
 
-  process.setProgram(program);
-  process.setArguments(argv);
-  process.setStandardOutputFile(QProcess::nullDevice());
-  process.setStandardErrorFile(QProcess::nullDevice());
+  QString name = QFileInfo(*it).fileName();
 
-  if (!process.startDetached()) {
-    qWarning() << "Failed to start app" << argv << process.errorString();
-    return false;
-  }
+  if (name != "flatpak") return name;
 
-  return true;
+  // flatpak run [options] <app id> [args]
+  it = std::find(it, exec.end(), "run");
+  if (it == exec.end()) return {};
+
+  auto isOption = [](const QString &arg) { return arg.startsWith('-'); };
+  auto appId = std::find_if_not(std::next(it), exec.end(), isOption);
+
+  return appId != exec.end() ? *appId : QString();
 }
 
-AppPtr XdgAppDatabase::findByClass(const QString &name) const {
-  QString normalizedWmClass = name.toLower();
+void XdgAppDatabase::buildClassIndex() {
+  auto index = [&](const QString &wmClass, const AppPtr &app) {
+    if (!wmClass.isEmpty()) { m_classIndex.try_emplace(wmClass.toLower(), app); }
+  };
+
+  m_classIndex.clear();
+  m_classIndex.reserve(apps.size() * 3);
 
   for (const auto &app : apps) {
-    if (app->name().toLower() == normalizedWmClass) return app;
+    index(app->xdgData().startupWMClass, app);
   }
 
+  for (const auto &app : apps) {
+    QString id = app->id();
+
+    if (id.endsWith(".desktop")) { id.chop(8); }
+    index(id, app);
+  }
+
+  for (const auto &app : apps) {
+    index(executableName(app->xdgData().exec), app);
+  }
+
+  for (const auto &app : apps) {
+    index(app->name(), app);
+  }
+}
+
+AppPtr XdgAppDatabase::findByClass(const QString &name) const {
+  if (auto it = m_classIndex.find(name.toLower()); it != m_classIndex.end()) { return it->second; }
+
   return nullptr;
 }
 
@@ -78,7 +78,32 @@ public:
       : _path(path.c_str()), _id(data.id), _data(data) {}
 };
 
+/**
+ * Applications found in the XDG application directories.
+ *
+ * Parsed desktop files are kept along with their modification time, so that a rescan only parses the
+ * files that were added or changed since the last one.
+ */
 class XdgAppDatabase : public AbstractAppDatabase {
+  struct ParsedFile {
+    fs::file_time_type mtime;
+    // null for files that failed to parse, which are not parsed again until they change
+    std::shared_ptr<const XdgDesktopEntry> entry;
+  };
+
+  // keyed by search directory and path relative to it, from which the id of the entry is derived
+  using ParseCache = std::unordered_map<std::string, ParsedFile>;
+
+  struct ScanResult {
+    ParseCache cache;
+    // first entry for each id, in the order of precedence of the search directories
+    std::vector<std::pair<fs::path, std::shared_ptr<const XdgDesktopEntry>>> files;
+  };
+
+  ParseCache m_parseCache;
+  // asynchronous scans superseded by a later scan are discarded
+  size_t m_scanGeneration = 0;
+
   std::vector<QDir> paths;
   std::unordered_map<QString, std::shared_ptr<Application>> appMap;
   std::unordered_map<QString, std::set<QString>> mimeToApps;
@@ -86,14 +111,36 @@ class XdgAppDatabase : public AbstractAppDatabase {
   std::unordered_map<QString, QString> mimeToDefaultApp;
   QMimeDatabase mimeDb;
   std::vector<std::shared_ptr<XdgApplication>> apps;
+  // openers resolved for each mime name, parent types and associations included, until the next scan
+  mutable std::unordered_map<QString, AppPtr> m_bestOpeners;
+  mutable std::unordered_map<QString, std::vector<AppPtr>> m_openers;
+  // resolved on first use, as it may take looking at every app
+  mutable std::optional<AppPtr> m_terminalEmulator;
+  // lower-cased window classes an app may show up with, rebuilt on every scan (see `buildClassIndex`)
+  std::unordered_map<QString, AppPtr> m_classIndex;
 
   std::shared_ptr<Application> defaultForMime(const QString &mime) const;
   void addDesktopFile(const fs::path &path, const XdgDesktopEntry &ent);
 
+  /**
+   * Index apps by the window classes they are likely to use, most reliable first: the StartupWMClass of their
+   * desktop entry, their desktop id, which is also the app id of Flatpak apps, the name of their executable
+   * and finally their name. A class that several apps claim resolves to the first one to claim it.
+   */
+  void buildClassIndex();
+
   AppPtr findBestTerminalEmulator() const;
+  AppPtr resolveBestTerminalEmulator() const;
+  AppPtr resolveBestOpenerForMime(const QString &mimeName) const;
+  std::vector<AppPtr> resolveOpeners(const QString &mimeName) const;
+
+  static ScanResult collect(const std::vector<fs::path> &paths, const ParseCache &cache);
+  void apply(ScanResult result);
+  void loadMimeApps();
 
 public:
   bool scan(const std::vector<std::filesystem::path> &paths) override;
+  void scanAsync(const std::vector<std::filesystem::path> &paths, std::function<void(bool)> done) override;
   std::vector<std::filesystem::path> defaultSearchPaths() const override;
   AppPtr findByClass(const QString &name) const override;
   AppPtr findBestOpener(const QString &target) const override;
@@ -23,8 +23,16 @@ public:
     CalculatorError(const QString &message) : m_message(message) {}
   };
 
+  using ComputeResult = std::expected<CalculatorResult, CalculatorError>;
+
   virtual QString name() const = 0;
-  virtual std::expected<CalculatorResult, CalculatorError> compute(const QString &question) const = 0;
+  virtual ComputeResult compute(const QString &question) const = 0;
+
+  /**
+   * Abort the computation in progress, if any. Called from another thread than the one computing, which
+   * then returns an error.
+   */
+  virtual void abort() const {}
 
   virtual bool supportsCurrencyConversion() const { return false; }
   virtual bool reloadExchangeRates() const { return false; }
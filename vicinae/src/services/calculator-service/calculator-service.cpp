@@ -3,6 +3,8 @@
 #include "omni-database.hpp"
 #include "services/calculator-service/abstract-calculator-backend.hpp"
 #include "services/calculator-service/calculator-service.hpp"
+#include "sql-profiler/sql-profiler.hpp"
+#include <QtConcurrent/QtConcurrent>
 #include <ranges>
 #include <qdatetime.h>
 #include <qlogging.h>
@@ -24,7 +26,7 @@ std::vector<CalculatorService::CalculatorRecord> CalculatorService::loadAll() co
 		ORDER BY pinned_at DESC, created_at DESC
 	)");
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "CalculatorService::loadAll() failed" << query.lastError();
     return {};
   }
@@ -152,7 +154,7 @@ bool CalculatorService::addRecord(const AbstractCalculatorBackend::CalculatorRes
   query.bindValue(":question", result.question);
   query.bindValue(":answer", result.answer);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to add calculator record" << query.lastError();
     return false;
   }
@@ -182,7 +184,7 @@ bool CalculatorService::pinRecord(const QString &id) {
   query.prepare("UPDATE calculator_history SET pinned_at = unixepoch() WHERE id = :id");
   query.addBindValue(id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to pin record with id" << id << query.lastError();
     return false;
   }
@@ -204,7 +206,7 @@ bool CalculatorService::unpinRecord(const QString &id) {
   query.prepare("UPDATE calculator_history SET pinned_at = NULL WHERE id = :id");
   query.addBindValue(id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to unpin record with id" << id << query.lastError();
     return false;
   }
@@ -237,7 +239,7 @@ bool CalculatorService::removeRecord(const QString &id) {
   query.prepare("DELETE FROM calculator_history WHERE id = :id");
   query.addBindValue(id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to remove record with id" << id << query.lastError();
     return false;
   }
@@ -257,6 +259,14 @@ void CalculatorService::setUpdateConversionsAfterRateUpdate(bool value) {
 
 bool CalculatorService::refreshExchangeRates() {
   if (!m_backend->reloadExchangeRates()) { return false; }
+
+  {
+    std::lock_guard lock(m_computeMutex);
+
+    m_memo.clear();
+    ++m_memoGeneration;
+  }
+
   if (m_updateConversionsAfterRateUpdate) { updateConversionRecords(); }
 
   return true;
@@ -265,7 +275,7 @@ bool CalculatorService::refreshExchangeRates() {
 bool CalculatorService::removeAll() {
   QSqlQuery query = m_db.createQuery();
 
-  if (!query.exec("DELETE FROM calculator_history")) {
+  if (!SqlProfiler::exec(query, "DELETE FROM calculator_history")) {
     qCritical() << "removeAll: failed" << query.lastError();
     return false;
   }
@@ -274,6 +284,41 @@ bool CalculatorService::removeAll() {
 }
 
 void CalculatorService::updateConversionRecords() {
+  if (m_conversionUpdate.isRunning()) {
+    m_conversionUpdatePending = true;
+    m_conversionUpdate.cancel();
+    return;
+  }
+
+  auto isConversionRecord = [](const CalculatorRecord &record) {
+    return record.typeHint == AbstractCalculatorBackend::CONVERSION;
+  };
+  auto questions = m_records | std::views::filter(isConversionRecord) |
+                   std::views::transform([](const CalculatorRecord &record) {
+                     return std::pair{record.id, record.question};
+                   }) |
+                   std::ranges::to<std::vector>();
+
+  auto update = [this, questions](QPromise<ConversionUpdate> &promise) {
+    promise.setProgressRange(0, static_cast<int>(questions.size()));
+
+    for (size_t i = 0; i != questions.size(); ++i) {
+      if (promise.isCanceled()) return;
+
+      auto &[id, question] = questions[i];
+
+      if (auto result = m_backend->compute(question)) {
+        promise.addResult(ConversionUpdate{.id = id, .result = *result});
+      }
+
+      promise.setProgressValue(static_cast<int>(i + 1));
+    }
+  };
+
+  m_conversionUpdate.setFuture(QtConcurrent::run(&m_conversionPool, update));
+}
+
+void CalculatorService::applyConversionUpdates(const QList<ConversionUpdate> &updates) {
   if (!m_db.db().transaction()) {
     qCritical() << "updateConversionRecords: failed to start transaction";
     return;
@@ -283,23 +328,22 @@ void CalculatorService::updateConversionRecords() {
 
   query.prepare("UPDATE calculator_history SET answer = :answer, type_hint = :type WHERE id = :id");
 
-  auto isConversionRecord = [](const CalculatorRecord &record) {
-    return record.typeHint == AbstractCalculatorBackend::CONVERSION;
-  };
+  for (const auto &update : updates) {
+    auto it = std::ranges::find(m_records, update.id, &CalculatorRecord::id);
 
-  for (auto &record : m_records | std::views::filter(isConversionRecord)) {
-    auto result = m_backend->compute(record.question);
+    // removed while it was being recomputed
+    if (it == m_records.end()) continue;
 
-    if (!result) continue;
+    query.bindValue(":answer", update.result.answer);
+    query.bindValue(":type", update.result.type);
+    query.bindValue(":id", update.id);
 
-    query.bindValue(":answer", result->answer);
-    query.bindValue(":type", result->type);
-    query.bindValue(":id", record.id);
-
-    if (!query.exec()) { qCritical() << "Failed to update conversion record" << query.lastError(); }
+    if (!SqlProfiler::exec(query)) {
+      qCritical() << "Failed to update conversion record" << query.lastError();
+    }
 
-    record.answer = result->answer;
-    record.typeHint = result->type;
+    it->answer = update.result.answer;
+    it->typeHint = update.result.type;
   }
 
   if (!m_db.db().commit()) {
@@ -310,7 +354,92 @@ void CalculatorService::updateConversionRecords() {
   emit conversionRecordsUpdated();
 }
 
+QString CalculatorService::normalizeQuestion(const QString &question) { return question.simplified(); }
+
+QFuture<AbstractCalculatorBackend::ComputeResult> CalculatorService::computeAsync(const QString &question) {
+  auto promise = std::make_shared<QPromise<AbstractCalculatorBackend::ComputeResult>>();
+  std::lock_guard lock(m_computeMutex);
+
+  promise->start();
+
+  if (m_nextComputation) {
+    m_nextComputation->promise->future().cancel();
+    m_nextComputation->promise->finish();
+    m_nextComputation.reset();
+  }
+
+  if (auto memoized = m_memo.object(normalizeQuestion(question))) {
+    auto result = *memoized;
+
+    result.question = question;
+    if (m_computing) { m_backend->abort(); }
+    promise->addResult(result);
+    promise->finish();
+
+    return promise->future();
+  }
+
+  m_nextComputation = Computation{.question = question, .promise = promise};
+
+  if (m_computing) {
+    m_backend->abort();
+  } else {
+    m_computing = true;
+    QtConcurrent::run(&m_computePool, [this]() { runComputations(); });
+  }
+
+  return promise->future();
+}
+
+void CalculatorService::runComputations() {
+  while (true) {
+    Computation computation;
+    int generation = 0;
+
+    {
+      std::lock_guard lock(m_computeMutex);
+
+      if (!m_nextComputation) {
+        m_computing = false;
+        return;
+      }
+
+      computation = std::move(*m_nextComputation);
+      generation = m_memoGeneration;
+      m_nextComputation.reset();
+    }
+
+    auto result = m_backend->compute(computation.question);
+
+    // errors are not memoized, an aborted computation is one of them
+    if (result) {
+      std::lock_guard lock(m_computeMutex);
+
+      if (generation == m_memoGeneration) {
+        m_memo.insert(normalizeQuestion(computation.question),
+                      new AbstractCalculatorBackend::CalculatorResult(*result));
+      }
+    }
+
+    computation.promise->addResult(std::move(result));
+    computation.promise->finish();
+  }
+}
+
 CalculatorService::CalculatorService(OmniDatabase &db) : m_db(db) {
+  m_computePool.setMaxThreadCount(1);
+  m_conversionPool.setMaxThreadCount(1);
+
+  connect(&m_conversionUpdate, &QFutureWatcher<ConversionUpdate>::progressValueChanged, this,
+          [this](int value) { emit conversionRecordsProgress(value, m_conversionUpdate.progressMaximum()); });
+  connect(&m_conversionUpdate, &QFutureWatcher<ConversionUpdate>::finished, this, [this]() {
+    if (!m_conversionUpdate.isCanceled()) { applyConversionUpdates(m_conversionUpdate.future().results()); }
+    if (m_conversionUpdatePending) {
+      m_conversionUpdatePending = false;
+      updateConversionRecords();
+    }
+  });
+
   m_records = loadAll();
   /**
    * We are doing proper backend abstraction, but for now it is not planned to add alternative backends.
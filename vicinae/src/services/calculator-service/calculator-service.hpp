@@ -1,7 +1,13 @@
 #pragma once
 #include "omni-database.hpp"
 #include "services/calculator-service/abstract-calculator-backend.hpp"
+#include <mutex>
+#include <qcache.h>
 #include <qdatetime.h>
+#include <qfuture.h>
+#include <qfuturewatcher.h>
+#include <qpromise.h>
+#include <qthreadpool.h>
 #include <qobject.h>
 #include <qtmetamacros.h>
 
@@ -36,15 +42,58 @@ public:
   };
 
 private:
+  static constexpr int MEMO_CAPACITY = 256;
+
+  struct Computation {
+    QString question;
+    std::shared_ptr<QPromise<AbstractCalculatorBackend::ComputeResult>> promise;
+  };
+
+  struct ConversionUpdate {
+    QString id;
+    AbstractCalculatorBackend::CalculatorResult result;
+  };
+
+  /**
+   * Questions only differing by their whitespace share their answer in the memo.
+   */
+  static QString normalizeQuestion(const QString &question);
+
   OmniDatabase &m_db;
   std::vector<CalculatorRecord> m_records;
   std::unique_ptr<AbstractCalculatorBackend> m_backend;
   std::vector<CalculatorRecord> loadAll() const;
   bool m_updateConversionsAfterRateUpdate = true;
 
+  std::mutex m_computeMutex;
+  // guarded by m_computeMutex
+  std::optional<Computation> m_nextComputation;
+  bool m_computing = false;
+  // answers to the latest questions, forgotten as soon as exchange rates may have changed
+  QCache<QString, AbstractCalculatorBackend::CalculatorResult> m_memo{MEMO_CAPACITY};
+  // bumped when the memo is cleared, so that computations started before do not fill it back
+  int m_memoGeneration = 0;
+
+  // the calculator thread, destroyed before the backend it computes with
+  QThreadPool m_computePool;
+  // conversion records are recomputed in a batch of their own, so that typing does not wait for them
+  QThreadPool m_conversionPool;
+  QFutureWatcher<ConversionUpdate> m_conversionUpdate;
+  bool m_conversionUpdatePending = false;
+
+  void runComputations();
+  void applyConversionUpdates(const QList<ConversionUpdate> &updates);
+
 public:
   AbstractCalculatorBackend *backend() const;
 
+  /**
+   * Compute `question` on the calculator thread, for callers that compute as the user types.
+   * Only the latest question is worth an answer: a computation that did not start yet is cancelled when
+   * another one is requested, and the one in progress is aborted.
+   */
+  QFuture<AbstractCalculatorBackend::ComputeResult> computeAsync(const QString &question);
+
   void setUpdateConversionsAfterRateUpdate(bool value);
   std::vector<CalculatorRecord> records() const;
   std::vector<std::pair<QString, std::vector<CalculatorRecord>>>
@@ -56,6 +105,11 @@ public:
   bool unpinRecord(const QString &id);
   bool removeAll();
 
+  /**
+   * Recompute the records with a type hint of CONVERSION in the background. Progress is reported
+   * by conversionRecordsProgress and conversionRecordsUpdated is emitted once the records are updated.
+   * An update requested while another one is running restarts it.
+   */
   void updateConversionRecords();
 
   /**
@@ -69,6 +123,7 @@ public:
 
 signals:
   void conversionRecordsUpdated();
+  void conversionRecordsProgress(int done, int total) const;
   void allRecordsRemoved() const;
   void recordAdded(const QString &id) const;
   void recordRemoved(const QString &id) const;
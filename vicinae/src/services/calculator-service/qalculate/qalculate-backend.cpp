@@ -8,7 +8,8 @@
 using CalculatorResult = QalculateBackend::CalculatorResult;
 using CalculatorError = QalculateBackend::CalculatorError;
 
-std::expected<CalculatorResult, CalculatorError> QalculateBackend::compute(const QString &question) const {
+QalculateBackend::ComputeResult QalculateBackend::compute(const QString &question) const {
+  std::lock_guard lock(m_mutex);
   EvaluationOptions evalOpts;
 
   evalOpts.auto_post_conversion = POST_CONVERSION_BEST;
@@ -18,7 +19,15 @@ std::expected<CalculatorResult, CalculatorError> QalculateBackend::compute(const
   evalOpts.parse_options.units_enabled = true;
   evalOpts.parse_options.unknowns_enabled = false;
 
-  MathStructure result = CALCULATOR->calculate(question.toStdString(), evalOpts);
+  MathStructure result;
+
+  // runs on the calculator thread of libqalculate, which gives up once the timeout is reached or it is
+  // aborted
+  if (!CALCULATOR->calculate(&result, question.toStdString(), COMPUTE_TIMEOUT_MS, evalOpts)) {
+    // messages are left by an aborted computation as well
+    CALCULATOR->clearMessages();
+    return std::unexpected(CalculatorError("Calculation aborted"));
+  }
 
   if (result.containsUnknowns()) { return std::unexpected(CalculatorError("Unknown component in question")); }
 
@@ -52,9 +61,13 @@ std::expected<CalculatorResult, CalculatorError> QalculateBackend::compute(const
   return calcRes;
 }
 
+void QalculateBackend::abort() const { CALCULATOR->abort(); }
+
 QString QalculateBackend::name() const { return "qalculate"; }
 
 bool QalculateBackend::reloadExchangeRates() const {
+  // conversions may be computing on another thread
+  std::lock_guard lock(m_mutex);
   CALCULATOR->fetchExchangeRates();
   return false;
 }
@@ -1,14 +1,21 @@
 #pragma once
 #include "services/calculator-service/abstract-calculator-backend.hpp"
 #include <libqalculate/Calculator.h>
+#include <mutex>
 
 class QalculateBackend : public AbstractCalculatorBackend {
+  // computations taking longer are most likely huge powers or factorials nobody wants the result of
+  static constexpr int COMPUTE_TIMEOUT_MS = 2000;
+
   Calculator m_calc;
+  // libqalculate is not reentrant, computations can be made from the calculator thread and the GUI thread
+  mutable std::mutex m_mutex;
 
   QString name() const override;
   bool supportsCurrencyConversion() const override;
   bool reloadExchangeRates() const override;
-  std::expected<CalculatorResult, CalculatorError> compute(const QString &question) const override;
+  ComputeResult compute(const QString &question) const override;
+  void abort() const override;
 
 public:
   QalculateBackend();
@@ -1,146 +1,294 @@
 #include "clipboard-db.hpp"
 #include "crypto.hpp"
+#include "sql-profiler/sql-profiler.hpp"
+#include "trace/trace.hpp"
 #include "utils/migration-manager/migration-manager.hpp"
 #include "vicinae.hpp"
 #include <qlogging.h>
+#include <qstringlist.h>
 #include <qsqldatabase.h>
 #include <qsqlquery.h>
 #include <qsqlerror.h>
+#include <qcoreapplication.h>
+#include <qthread.h>
 #include <qtimer.h>
 
-static const std::vector<QString> DB_PRAGMAS = {"PRAGMA journal_mode = WAL", "PRAGMA synchronous = normal",
-                                                "PRAGMA journal_size_limit = 6144000",
-                                                "PRAGMA foreign_keys = ON"};
+static const std::vector<QString> DB_PRAGMAS = {
+    "PRAGMA journal_mode = WAL", "PRAGMA synchronous = normal", "PRAGMA journal_size_limit = 6144000",
+    "PRAGMA foreign_keys = ON",  "PRAGMA temp_store = memory",  "PRAGMA mmap_size = 268435456", // 256MB
+};
+
+// the history view lists from its own connection, off the main thread
+static const std::vector<QString> DB_READ_ONLY_PRAGMAS = {
+    "PRAGMA query_only = true",
+    "PRAGMA temp_store = memory",
+    "PRAGMA mmap_size = 268435456", // 256MB
+    "PRAGMA cache_size = -16000",   // 16MB
+};
+
+// the substring index is optional, and therefore not created by the migrations
+static const std::vector<QString> SUBSTRING_INDEX_STATEMENTS = {
+    R"(CREATE VIRTUAL TABLE IF NOT EXISTS selection_trigram_fts USING fts5(
+	content, selection_id UNINDEXED, tokenize='trigram'
+))",
+    "INSERT INTO selection_trigram_fts (selection_id, content) "
+    "SELECT selection_id, content FROM selection_fts",
+    // must stay in sync with the triggers of selection_fts
+    R"(CREATE TRIGGER IF NOT EXISTS selection_trigram_ad AFTER DELETE ON selection BEGIN
+  DELETE FROM selection_trigram_fts WHERE selection_id = old.id;END)",
+    R"(CREATE TRIGGER IF NOT EXISTS selection_trigram_auk AFTER UPDATE OF keywords ON selection BEGIN
+  DELETE FROM selection_trigram_fts WHERE selection_id = old.id AND content = old.keywords;
+  INSERT INTO selection_trigram_fts (selection_id, content) VALUES (new.id, new.keywords);END)",
+};
+
+static const std::vector<QString> DROP_SUBSTRING_INDEX_STATEMENTS = {
+    "DROP TRIGGER IF EXISTS selection_trigram_ad",
+    "DROP TRIGGER IF EXISTS selection_trigram_auk",
+    "DROP TABLE IF EXISTS selection_trigram_fts",
+};
+
+// shorter queries cannot be looked up in a trigram index
+static constexpr int MIN_SUBSTRING_QUERY_LENGTH = 3;
+
+// selections of the listed kind past which a query is looked up in the full text index first
+static constexpr size_t MAX_QUERY_INDEX_SCAN = 10000;
+
+ClipboardDatabase::Statement::~Statement() { m_query->finish(); }
+
+ClipboardDatabase::Statement ClipboardDatabase::prepare(const QString &sql) const {
+  auto &query = m_statements[sql];
+
+  if (!query) {
+    query = std::make_unique<QSqlQuery>(m_db);
+
+    if (!query->prepare(sql)) { qCritical() << "Failed to prepare clipboard query" << query->lastError(); }
+  }
+
+  return Statement(query.get());
+}
 
 std::optional<ClipboardSelectionRecord> ClipboardDatabase::findSelection(const QString &id) {
   ClipboardSelectionRecord selection;
-  QSqlQuery query(m_db);
+  auto query =
+      prepare("SELECT id, mime_type, encryption_type, blob_id, compression_type from data_offer where "
+              "selection_id = :id");
 
-  query.prepare("SELECT id, mime_type, encryption_type from data_offer where selection_id = :id");
-  query.addBindValue(id);
+  query->bindValue(":id", id);
 
-  if (!query.exec()) {
-    qCritical() << "Failed to retrieve selection for id" << id << query.lastError();
+  if (!SqlProfiler::exec(*query)) {
+    qCritical() << "Failed to retrieve selection for id" << id << query->lastError();
     return std::nullopt;
   }
 
-  while (query.next()) {
+  while (query->next()) {
     ClipboardSelectionOfferRecord record;
 
-    record.id = query.value(0).toString();
-    record.mimeType = query.value(1).toString();
-    record.encryption = static_cast<ClipboardEncryptionType>(query.value(2).toUInt());
+    record.id = query->value(0).toString();
+    record.mimeType = query->value(1).toString();
+    record.encryption = static_cast<ClipboardEncryptionType>(query->value(2).toUInt());
+    record.blobId = query->value(3).toString();
+    record.compression = static_cast<ClipboardCompressionType>(query->value(4).toUInt());
     selection.offers.emplace_back(record);
   }
 
   return selection;
 }
 
-PaginatedResponse<ClipboardHistoryEntry> ClipboardDatabase::listAll(int limit, int offset,
-                                                                    const ClipboardListSettings &opts) const {
+ClipboardHistoryPage ClipboardDatabase::listAll(int limit, const std::optional<ClipboardHistoryCursor> &after,
+                                                const ClipboardListSettings &opts,
+                                                const std::function<bool()> &shouldStop) const {
+  TraceScope trace("sqlite", "clipboard list");
+  ClipboardHistoryPage page;
+  // one more entry than requested, to know whether there is a next page
+  size_t fetchCount = limit + 1;
 
-  QSqlQuery query(m_db);
+  page.data.reserve(fetchCount);
 
-  if (!query.exec("SELECT COUNT(*) FROM selection;") || !query.next()) { return {}; }
+  QString index = historyIndex(opts);
 
-  PaginatedResponse<ClipboardHistoryEntry> response;
+  // unpinned selections have no pin time to order by, so that both parts of the history are listed
+  // separately, each one following its own range of the history index.
+  if (!after || after->pinnedAt) {
+    if (!listHistorySegment(page.data, true, after, fetchCount, opts, index, shouldStop)) { return {}; }
+  }
 
-  response.totalCount = query.value(0).toInt();
-  response.totalPages = ceil(static_cast<double>(response.totalCount) / limit);
-  response.currentPage = ceil(static_cast<double>(offset) / limit);
-  response.data.reserve(limit);
+  if (page.data.size() < fetchCount && !(shouldStop && shouldStop())) {
+    auto unpinnedAfter = after && !after->pinnedAt ? after : std::nullopt;
 
-  QString queryString = R"(
-	  	SELECT
-			selection.id, o.mime_type, o.text_preview, pinned_at, o.content_hash_md5, updated_at, o.size, selection.kind, o.url_host
-		FROM
-			selection
-		JOIN
-			data_offer o
-		ON 
-			o.selection_id = selection.id
-		AND
-			o.mime_type = selection.preferred_mime_type
+    if (!listHistorySegment(page.data, false, unpinnedAfter, fetchCount - page.data.size(), opts, index,
+                            shouldStop)) {
+      return {};
+    }
+  }
 
-	)";
+  if (page.data.size() > static_cast<size_t>(limit)) {
+    page.data.resize(limit);
 
-  if (!opts.query.isEmpty()) {
-    queryString += " JOIN selection_fts ON selection_fts.selection_id = selection.id ";
+    auto &last = page.data.back();
+
+    page.next = ClipboardHistoryCursor{
+        .pinnedAt = last.pinnedAt ? std::optional(last.pinnedAt) : std::nullopt,
+        .updatedAt = last.updatedAt,
+        .id = last.id,
+    };
   }
 
-  if (!opts.query.isEmpty()) { queryString += " WHERE selection_fts MATCH '\"" + opts.query + "\"*' "; }
+  return page;
+}
+
+QString ClipboardDatabase::historyIndex(const ClipboardListSettings &opts) const {
+  QString index = opts.kind ? "idx_selection_kind_history" : "idx_selection_history";
+
+  if (opts.query.isEmpty()) return index;
+
+  auto counts = countSelectionsByKind();
+
+  if (!counts) return index;
+
+  size_t count = 0;
 
   if (opts.kind) {
-    if (opts.query.isEmpty()) {
-      queryString += " WHERE selection.kind = :kind";
-    } else {
-      queryString += " AND selection.kind = :kind";
+    if (auto it = counts->find(*opts.kind); it != counts->end()) { count = it->second; }
+  } else {
+    for (const auto &[kind, kindCount] : *counts) {
+      count += kindCount;
     }
   }
 
-  if (!opts.query.isEmpty()) {}
-  queryString += " GROUP BY selection.id ";
+  return count > MAX_QUERY_INDEX_SCAN ? QString() : index;
+}
 
-  queryString += "ORDER BY pinned_at DESC, updated_at DESC LIMIT :limit OFFSET :offset";
+bool ClipboardDatabase::listHistorySegment(std::vector<ClipboardHistoryEntry> &entries, bool pinned,
+                                           const std::optional<ClipboardHistoryCursor> &after, int limit,
+                                           const ClipboardListSettings &opts, const QString &index,
+                                           const std::function<bool()> &shouldStop) const {
+  QStringList filters;
+  bool substring = opts.query.size() >= MIN_SUBSTRING_QUERY_LENGTH && hasSubstringIndex();
 
-  query.prepare(queryString);
-  query.bindValue(":limit", limit);
-  query.bindValue(":offset", offset);
+  if (pinned) {
+    filters << "pinned_at IS NOT NULL";
+    if (after) { filters << "(pinned_at, updated_at, id) < (:pinned_at, :updated_at, :id)"; }
+  } else {
+    filters << "pinned_at IS NULL";
+    if (after) { filters << "(updated_at, id) < (:updated_at, :id)"; }
+  }
 
-  if (opts.kind) { query.bindValue(":kind", static_cast<quint8>(*opts.kind)); }
+  if (substring) {
+    filters << "id IN (SELECT selection_id FROM selection_fts WHERE selection_fts MATCH :query UNION "
+               "SELECT selection_id FROM selection_trigram_fts WHERE selection_trigram_fts MATCH :substring)";
+  } else if (!opts.query.isEmpty()) {
+    filters << "id IN (SELECT selection_id FROM selection_fts WHERE selection_fts MATCH :query)";
+  }
 
-  if (!query.exec()) {
-    qWarning() << "Failed to list all clipboard items" << query.lastError();
-    return {};
+  if (opts.kind) { filters << "kind = :kind"; }
+
+  QString order = pinned ? "pinned_at DESC, updated_at DESC, id DESC" : "updated_at DESC, id DESC";
+
+  // the page of selections is taken first, following the history index, and only then joined with its
+  // offers: ordering the whole joined history would have to sort all of it. Every index is a statement of
+  // its own, for the slow query log to show the plan of each one.
+  QString queryString = QString(R"(
+		WITH page AS MATERIALIZED (
+			SELECT id, pinned_at, updated_at, kind, preferred_mime_type FROM selection %4
+			WHERE %1
+			ORDER BY %2
+			LIMIT :limit
+		)
+		SELECT
+			page.id, o.mime_type, o.text_preview, page.pinned_at, o.content_hash_md5, page.updated_at, o.size, page.kind, o.url_host,
+			o.thumbnail, o.encryption_type
+		FROM
+			page
+		JOIN
+			data_offer o
+		ON
+			o.selection_id = page.id
+		AND
+			o.mime_type = page.preferred_mime_type
+		GROUP BY page.id
+		ORDER BY %3
+	)")
+                            .arg(filters.join(" AND "))
+                            .arg(order)
+                            .arg(pinned ? "page.pinned_at DESC, page.updated_at DESC, page.id DESC"
+                                        : "page.updated_at DESC, page.id DESC")
+                            .arg(index.isEmpty() ? QString() : "INDEXED BY " + index);
+
+  // only a handful of variants, each one prepared once
+  auto query = prepare(queryString);
+
+  query->bindValue(":limit", limit);
+
+  if (after) {
+    if (pinned) { query->bindValue(":pinned_at", static_cast<quint64>(*after->pinnedAt)); }
+    query->bindValue(":updated_at", static_cast<quint64>(after->updatedAt));
+    query->bindValue(":id", after->id);
+  }
+
+  if (!opts.query.isEmpty()) {
+    // bound as a single quoted term, so that the query can't be interpreted as FTS syntax
+    QString term = QString("\"%1\"").arg(QString(opts.query).replace("\"", "\"\""));
+
+    query->bindValue(":query", term + '*');
+    if (substring) { query->bindValue(":substring", term); }
   }
 
-  while (query.next()) {
-    auto sum = query.value(4).toString();
+  if (opts.kind) { query->bindValue(":kind", static_cast<quint8>(*opts.kind)); }
+
+  if (!SqlProfiler::exec(*query)) {
+    qWarning() << "Failed to list clipboard history" << query->lastError();
+    return false;
+  }
+
+  while (query->next()) {
+    if (shouldStop && shouldStop()) break;
+
+    auto sum = query->value(4).toString();
     ClipboardHistoryEntry dto{
-        .id = query.value(0).toString(),
-        .mimeType = query.value(1).toString(),
-        .textPreview = query.value(2).toString(),
-        .pinnedAt = query.value(3).toULongLong(),
+        .id = query->value(0).toString(),
+        .mimeType = query->value(1).toString(),
+        .textPreview = query->value(2).toString(),
+        .pinnedAt = query->value(3).toULongLong(),
         .md5sum = sum,
-        .updatedAt = query.value(5).toULongLong(),
-        .size = query.value(6).toULongLong(),
-        .kind = static_cast<ClipboardOfferKind>(query.value(7).toUInt()),
+        .updatedAt = query->value(5).toULongLong(),
+        .size = query->value(6).toULongLong(),
+        .kind = static_cast<ClipboardOfferKind>(query->value(7).toUInt()),
     };
 
-    if (auto val = query.value(8); !val.isNull()) { dto.urlHost = val.toString(); }
+    if (auto val = query->value(8); !val.isNull()) { dto.urlHost = val.toString(); }
+    if (auto val = query->value(9); !val.isNull()) { dto.thumbnail = val.toByteArray(); }
 
-    response.data.push_back(dto);
+    dto.thumbnailEncryption = static_cast<ClipboardEncryptionType>(query->value(10).toUInt());
+    entries.push_back(dto);
   }
 
-  return response;
+  return true;
 }
 
 std::optional<QString> ClipboardDatabase::retrieveKeywords(const QString &id) {
-  QSqlQuery query(m_db);
+  auto query = prepare("SELECT keywords FROM selection WHERE id = :id");
 
-  query.prepare("SELECT keywords FROM selection WHERE id = :id");
-  query.bindValue(":id", id);
+  query->bindValue(":id", id);
 
-  if (!query.exec()) {
-    qWarning() << "Failed to get keywords for selection" << id << query.lastError();
+  if (!SqlProfiler::exec(*query)) {
+    qWarning() << "Failed to get keywords for selection" << id << query->lastError();
     return std::nullopt;
   }
 
-  if (!query.next()) return std::nullopt;
+  if (!query->next()) return std::nullopt;
 
-  return query.value(0).toString();
+  return query->value(0).toString();
 }
 
 bool ClipboardDatabase::setKeywords(const QString &id, const QString &keywords) {
-  return transaction([&](auto db) {
-    QSqlQuery query(m_db);
+  return transaction([&](ClipboardDatabase &db) {
+    auto query = prepare("UPDATE selection SET keywords = :keywords WHERE id = :id");
 
-    query.prepare("UPDATE selection SET keywords = :keywords WHERE id = :id");
-    query.bindValue(":id", id);
-    query.bindValue(":keywords", keywords);
+    query->bindValue(":id", id);
+    query->bindValue(":keywords", keywords);
 
-    if (!query.exec()) {
-      qWarning() << "Failed to set keywords for id" << id << query.lastError();
+    if (!SqlProfiler::exec(*query)) {
+      qWarning() << "Failed to set keywords for id" << id << query->lastError();
       return false;
     }
 
@@ -149,111 +297,236 @@ bool ClipboardDatabase::setKeywords(const QString &id, const QString &keywords)
 }
 
 bool ClipboardDatabase::removeAll() {
-  QSqlQuery query(m_db);
+  return transaction([](ClipboardDatabase &db) {
+    // the data directory is removed as a whole
+    for (const auto &statement : {"DELETE FROM selection", "DELETE FROM blob"}) {
+      if (auto query = db.prepare(statement); !SqlProfiler::exec(*query)) {
+        qCritical() << "Failed to clear clipboard history" << query->lastError();
+        return false;
+      }
+    }
 
-  return query.exec("DELETE FROM selection");
+    return true;
+  });
 }
 
-std::vector<QString> ClipboardDatabase::removeSelection(const QString &selectionId) {
-  if (!m_db.transaction()) { return {}; }
+bool ClipboardDatabase::removeSelection(const QString &selectionId) {
+  // offers are deleted with their selection
+  auto query = prepare("DELETE FROM selection WHERE id = :selection_id");
 
-  QSqlQuery query(m_db);
+  query->bindValue(":selection_id", selectionId);
 
-  query.prepare(R"(
-  	DELETE FROM 
-		data_offer
-	WHERE 
-		selection_id = :selection_id
-	RETURNING id
-  )");
-  query.bindValue(":selection_id", selectionId);
+  if (!SqlProfiler::exec(*query)) {
+    qDebug() << "failed to execute selecton deletion" << query->lastError();
+    return false;
+  }
 
-  if (!query.exec()) {
-    qDebug() << "failed to execute data_offer deletion" << query.lastError();
-    m_db.rollback();
-    return {};
+  return true;
+}
+
+bool ClipboardDatabase::hasBlob(const QString &id) {
+  auto query = prepare("SELECT 1 FROM blob WHERE id = :id");
+
+  query->bindValue(":id", id);
+
+  if (!SqlProfiler::exec(*query)) {
+    qCritical() << "Failed to look up clipboard blob" << id << query->lastError();
+    return false;
+  }
+
+  return query->next();
+}
+
+bool ClipboardDatabase::removeUnusedBlobs(const std::function<void(const QString &id)> &removeFile) {
+  return transaction([&](ClipboardDatabase &db) {
+    // deleting first takes the write lock, so that no offer can reference these blobs until files are removed
+    auto query = db.prepare("DELETE FROM blob WHERE ref_count <= 0 RETURNING id");
+
+    if (!SqlProfiler::exec(*query)) {
+      qCritical() << "Failed to delete unused clipboard blobs" << query->lastError();
+      return false;
+    }
+
+    while (query->next()) {
+      removeFile(query->value(0).toString());
+    }
+
+    return true;
+  });
+}
+
+std::vector<QString> ClipboardDatabase::findExpiredSelections(const ClipboardRetentionPolicy &policy,
+                                                             int limit) {
+  std::vector<QString> ids;
+
+  auto collect = [&](Statement &query) {
+    if (!SqlProfiler::exec(*query)) {
+      qCritical() << "Failed to find expired clipboard selections" << query->lastError();
+      return;
+    }
+
+    while (query->next()) {
+      ids.emplace_back(query->value(0).toString());
+    }
+  };
+
+  for (const auto &[kind, maxAge] : policy.maxAge) {
+    if (ids.size() >= static_cast<size_t>(limit)) return ids;
+
+    auto query = prepare(R"(
+		SELECT id FROM selection
+		WHERE pinned_at IS NULL AND updated_at < unixepoch() - :max_age AND kind = :kind
+		LIMIT :limit
+	)");
+
+    query->bindValue(":max_age", static_cast<qint64>(maxAge.count()));
+    query->bindValue(":kind", static_cast<quint8>(kind));
+    query->bindValue(":limit", static_cast<int>(limit - ids.size()));
+    collect(query);
   }
 
-  std::vector<QString> deletedOffers;
+  // whatever is left over is removed with the next batch
+  if (!ids.empty()) return ids;
+
+  if (policy.maxEntries) {
+    auto query = prepare(R"(
+		SELECT id FROM selection
+		WHERE pinned_at IS NULL
+		ORDER BY updated_at DESC, id DESC
+		LIMIT :limit OFFSET :max_entries
+	)");
 
-  while (query.next()) {
-    deletedOffers.emplace_back(query.value(0).toString());
+    query->bindValue(":limit", limit);
+    query->bindValue(":max_entries", static_cast<qint64>(*policy.maxEntries));
+    collect(query);
+
+    if (!ids.empty()) return ids;
   }
 
-  query.prepare("DELETE FROM selection WHERE id = :selection_id");
-  query.bindValue(":selection_id", selectionId);
+  if (!policy.maxTotalSize) return ids;
 
-  if (!query.exec()) {
-    qDebug() << "failed to execute selecton deletion" << query.lastError();
-    m_db.rollback();
-    return {};
+  uint64_t totalSize = 0;
+
+  {
+    auto query = prepare("SELECT ifnull(SUM(size), 0) FROM blob WHERE ref_count > 0");
+
+    if (!SqlProfiler::exec(*query) || !query->next()) {
+      qCritical() << "Failed to compute clipboard history size" << query->lastError();
+      return ids;
+    }
+
+    totalSize = query->value(0).toULongLong();
+  }
+
+  if (totalSize <= *policy.maxTotalSize) return ids;
+
+  // offers sharing their blob with other selections are counted as freed even though they are not, which
+  // only leaves more to remove on the next call.
+  auto query = prepare(R"(
+		SELECT s.id, (SELECT ifnull(SUM(o.size), 0) FROM data_offer o WHERE o.selection_id = s.id)
+		FROM selection s
+		WHERE s.pinned_at IS NULL
+		ORDER BY s.updated_at ASC, s.id ASC
+		LIMIT :limit
+	)");
+
+  query->bindValue(":limit", limit);
+
+  if (!SqlProfiler::exec(*query)) {
+    qCritical() << "Failed to find expired clipboard selections" << query->lastError();
+    return ids;
   }
 
-  m_db.commit();
+  uint64_t excess = totalSize - *policy.maxTotalSize;
+  uint64_t freed = 0;
+
+  while (freed < excess && query->next()) {
+    ids.emplace_back(query->value(0).toString());
+    freed += query->value(1).toULongLong();
+  }
 
-  return deletedOffers;
+  return ids;
 }
 
-std::optional<PreferredClipboardOfferRecord>
-ClipboardDatabase::findPreferredOffer(const QString &selectionId) {
+bool ClipboardDatabase::optimize() {
   QSqlQuery query(m_db);
+  std::vector<QString> statements = {"INSERT INTO selection_fts(selection_fts) VALUES('optimize')"};
+
+  if (hasSubstringIndex()) {
+    statements.emplace_back("INSERT INTO selection_trigram_fts(selection_trigram_fts) VALUES('optimize')");
+  }
+
+  // can't run from a transaction, or while statements of this connection are running
+  statements.emplace_back("VACUUM");
+
+  for (const auto &statement : statements) {
+    if (!SqlProfiler::exec(query, statement)) {
+      qWarning() << "Failed to optimize clipboard database" << statement << query.lastError();
+      return false;
+    }
+  }
 
-  query.prepare(R"(
-		SELECT o.id, o.encryption_type FROM data_offer o
+  return true;
+}
+
+std::optional<PreferredClipboardOfferRecord>
+ClipboardDatabase::findPreferredOffer(const QString &selectionId) {
+  auto query = prepare(R"(
+		SELECT o.id, o.encryption_type, o.blob_id, o.compression_type FROM data_offer o
 		JOIN selection s ON s.id = o.selection_id
 		WHERE o.mime_type = s.preferred_mime_type
 		AND selection_id = :selection
 	)");
-  query.addBindValue(selectionId);
 
-  if (!query.exec()) {
-    qCritical() << "Failed to decrypt main selection offer" << query.lastError();
+  query->bindValue(":selection", selectionId);
+
+  if (!SqlProfiler::exec(*query)) {
+    qCritical() << "Failed to decrypt main selection offer" << query->lastError();
     return {};
   }
 
-  if (!query.next()) {
-    qCritical() << "No match for default mime type" << query.lastError();
+  if (!query->next()) {
+    qCritical() << "No match for default mime type" << query->lastError();
     return {};
   }
 
-  QString id = query.value(0).toString();
-  auto encryption = static_cast<ClipboardEncryptionType>(query.value(1).toUInt());
+  QString id = query->value(0).toString();
+  auto encryption = static_cast<ClipboardEncryptionType>(query->value(1).toUInt());
 
-  return PreferredClipboardOfferRecord{.id = id, .encryption = encryption};
+  QString blobId = query->value(2).toString();
+  auto compression = static_cast<ClipboardCompressionType>(query->value(3).toUInt());
+
+  return PreferredClipboardOfferRecord{
+      .id = id, .blobId = blobId, .encryption = encryption, .compression = compression};
 }
 
 bool ClipboardDatabase::setPinned(const QString &id, bool pinned) {
-  QSqlQuery query(m_db);
-
-  if (pinned) {
-    query.prepare("UPDATE selection SET pinned_at = unixepoch() WHERE id = :id");
-  } else {
-    query.prepare("UPDATE selection SET pinned_at = NULL WHERE id = :id");
-  }
+  auto query = prepare(pinned ? "UPDATE selection SET pinned_at = unixepoch() WHERE id = :id"
+                              : "UPDATE selection SET pinned_at = NULL WHERE id = :id");
 
-  query.bindValue(":id", id);
+  query->bindValue(":id", id);
 
-  return query.exec();
+  return SqlProfiler::exec(*query);
 }
 
 bool ClipboardDatabase::insertSelection(const InsertSelectionPayload &payload) {
-  QSqlQuery query(m_db);
-
-  query.prepare(R"(
+  TraceScope trace("sqlite", "clipboard insert selection");
+  auto query = prepare(R"(
   	INSERT INTO selection (id, kind, offer_count, hash_md5, preferred_mime_type, source)
 	VALUES (:id, :kind, :offer_count, :hash_md5, :preferred_mime_type, :source)
 	RETURNING id, created_at;
   )");
-  query.bindValue(":id", payload.id);
-  query.bindValue(":kind", static_cast<quint8>(payload.kind));
-  query.bindValue(":offer_count", static_cast<uint>(payload.offerCount));
-  query.bindValue(":hash_md5", payload.hash);
-  query.bindValue(":preferred_mime_type", payload.preferredMimeType);
 
-  if (payload.source) { query.bindValue(":source", *payload.source); }
+  query->bindValue(":id", payload.id);
+  query->bindValue(":kind", static_cast<quint8>(payload.kind));
+  query->bindValue(":offer_count", static_cast<uint>(payload.offerCount));
+  query->bindValue(":hash_md5", payload.hash);
+  query->bindValue(":preferred_mime_type", payload.preferredMimeType);
+  // cached statements keep their bindings, optional values have to be cleared explicitly
+  query->bindValue(":source", payload.source ? QVariant(*payload.source) : QVariant());
 
-  if (!query.exec()) {
-    qCritical() << "Failed to insert selection" << query.lastError();
+  if (!SqlProfiler::exec(*query)) {
+    qCritical() << "Failed to insert selection" << query->lastError();
     return false;
   }
 
@@ -272,33 +545,139 @@ bool ClipboardDatabase::transaction(const TxHandle &handle) {
 }
 
 bool ClipboardDatabase::tryBubbleUpSelection(const QString &selectionHash) {
-  QSqlQuery query(m_db);
+  auto query = prepare("UPDATE selection SET updated_at = unixepoch() WHERE hash_md5 = :hash");
 
-  query.prepare("UPDATE selection SET updated_at = unixepoch() WHERE hash_md5 = :hash");
-  query.addBindValue(selectionHash);
+  query->bindValue(":hash", selectionHash);
 
-  if (!query.exec()) { qCritical() << "Failed to execute clipboard update"; }
+  if (!SqlProfiler::exec(*query)) { qCritical() << "Failed to execute clipboard update"; }
 
-  return query.numRowsAffected() > 0;
+  return query->numRowsAffected() > 0;
 }
 
 bool ClipboardDatabase::indexSelectionContent(const QString &selectionId, const QString &content) {
-  QSqlQuery query(m_db);
-
-  query.prepare(R"(
+  auto query = prepare(R"(
 		INSERT INTO selection_fts (selection_id, content) VALUES (:selection_id, :content);
 	)");
-  query.bindValue(":selection_id", selectionId);
-  query.bindValue(":content", content);
 
-  if (!query.exec()) {
-    qCritical() << "failed to index text" << query.lastError();
+  query->bindValue(":selection_id", selectionId);
+  query->bindValue(":content", content);
+
+  if (!SqlProfiler::exec(*query)) {
+    qCritical() << "failed to index text" << query->lastError();
+    return false;
+  }
+
+  if (!hasSubstringIndex()) return true;
+
+  auto substringQuery = prepare(R"(
+		INSERT INTO selection_trigram_fts (selection_id, content) VALUES (:selection_id, :content);
+	)");
+
+  substringQuery->bindValue(":selection_id", selectionId);
+  substringQuery->bindValue(":content", content);
+
+  if (!SqlProfiler::exec(*substringQuery)) {
+    qCritical() << "failed to index text for substring search" << substringQuery->lastError();
     return false;
   }
 
   return true;
 }
 
+bool ClipboardDatabase::hasSubstringIndex() const {
+  auto query = prepare("SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = 'selection_trigram_fts'");
+
+  if (!SqlProfiler::exec(*query)) {
+    qWarning() << "Failed to check for clipboard substring index" << query->lastError();
+    return false;
+  }
+
+  return query->next();
+}
+
+void ClipboardDatabase::shrinkMemory() {
+  QSqlQuery query(m_db);
+
+  if (!SqlProfiler::exec(query, "PRAGMA shrink_memory")) {
+    qWarning() << "Failed to shrink clipboard database memory" << query.lastError();
+  }
+}
+
+std::optional<size_t> ClipboardDatabase::countSelections() const {
+  auto query = prepare("SELECT COUNT(*) FROM selection");
+
+  if (!SqlProfiler::exec(*query) || !query->next()) {
+    qWarning() << "Failed to count clipboard selections" << query->lastError();
+    return std::nullopt;
+  }
+
+  return query->value(0).toULongLong();
+}
+
+std::optional<std::map<ClipboardOfferKind, size_t>> ClipboardDatabase::countSelectionsByKind() const {
+  auto query = prepare("SELECT kind, count FROM selection_kind_count");
+
+  if (!SqlProfiler::exec(*query)) {
+    qWarning() << "Failed to count clipboard selections by kind" << query->lastError();
+    return std::nullopt;
+  }
+
+  std::map<ClipboardOfferKind, size_t> counts;
+
+  while (query->next()) {
+    counts[static_cast<ClipboardOfferKind>(query->value(0).toUInt())] = query->value(1).toULongLong();
+  }
+
+  return counts;
+}
+
+size_t ClipboardDatabase::getDatabaseSize() {
+  std::filesystem::path path = Omnicast::dataDir() / "clipboard.db";
+  size_t size = 0;
+
+  for (const std::filesystem::path &file : {path, std::filesystem::path(path.native() + "-wal")}) {
+    std::error_code ec;
+    auto fileSize = std::filesystem::file_size(file, ec);
+
+    if (!ec) size += fileSize;
+  }
+
+  return size;
+}
+
+bool ClipboardDatabase::createSubstringIndex() {
+  if (hasSubstringIndex()) return true;
+
+  return transaction([](ClipboardDatabase &db) {
+    QSqlQuery query(db.m_db);
+
+    // the trigram tokenizer requires sqlite 3.34
+    for (const auto &statement : SUBSTRING_INDEX_STATEMENTS) {
+      if (!SqlProfiler::exec(query, statement)) {
+        qCritical() << "Failed to create clipboard substring index" << query.lastError();
+        return false;
+      }
+    }
+
+    return true;
+  });
+}
+
+bool ClipboardDatabase::dropSubstringIndex() {
+  return transaction([](ClipboardDatabase &db) {
+    QSqlQuery query(db.m_db);
+
+    for (const auto &statement : DROP_SUBSTRING_INDEX_STATEMENTS) {
+      if (!SqlProfiler::exec(query, statement)) {
+        qCritical() << "Failed to drop clipboard substring index" << query.lastError();
+        return false;
+      }
+    }
+
+    return true;
+  });
+}
+
 void ClipboardDatabase::runMigrations() {
   MigrationManager manager(m_db, "clipboard");
 
@@ -306,45 +685,64 @@ void ClipboardDatabase::runMigrations() {
 }
 
 bool ClipboardDatabase::insertOffer(const InsertClipboardOfferPayload &payload) {
-  QSqlQuery query(m_db);
-
-  query.prepare(R"(
-		INSERT INTO data_offer (id, selection_id, mime_type, text_preview, content_hash_md5, encryption_type, size, kind, url_host)
-		VALUES (:id, :selection_id, :mime_type, :text_preview, :content_hash_md5, :encryption, :size, :kind, :url_host)
+  TraceScope trace("sqlite", "clipboard insert offer");
+  auto query = prepare(R"(
+		INSERT INTO data_offer (id, selection_id, mime_type, text_preview, content_hash_md5, blob_id, encryption_type, compression_type, size, kind, url_host, thumbnail)
+		VALUES (:id, :selection_id, :mime_type, :text_preview, :content_hash_md5, :blob_id, :encryption, :compression, :size, :kind, :url_host, :thumbnail)
   	)");
-  query.bindValue(":id", payload.id);
-  query.bindValue(":selection_id", payload.selectionId);
-  query.bindValue(":mime_type", payload.mimeType);
-  query.bindValue(":text_preview", payload.textPreview);
-  query.bindValue(":content_hash_md5", payload.md5sum);
-  query.bindValue(":encryption", static_cast<quint8>(payload.encryption));
-  query.bindValue(":size", payload.size);
-  query.bindValue(":kind", static_cast<quint8>(payload.kind));
-
-  if (payload.urlHost) { query.bindValue(":url_host", *payload.urlHost); }
-
-  if (!query.exec()) {
-    qCritical() << "Failed to inset offer" << query.lastError();
+
+  query->bindValue(":id", payload.id);
+  query->bindValue(":selection_id", payload.selectionId);
+  query->bindValue(":mime_type", payload.mimeType);
+  query->bindValue(":text_preview", payload.textPreview);
+  query->bindValue(":content_hash_md5", payload.md5sum);
+  query->bindValue(":blob_id", payload.blobId);
+  query->bindValue(":encryption", static_cast<quint8>(payload.encryption));
+  query->bindValue(":compression", static_cast<quint8>(payload.compression));
+  query->bindValue(":size", payload.size);
+  query->bindValue(":kind", static_cast<quint8>(payload.kind));
+  query->bindValue(":url_host", payload.urlHost ? QVariant(*payload.urlHost) : QVariant());
+  query->bindValue(":thumbnail", payload.thumbnail ? QVariant(*payload.thumbnail) : QVariant());
+
+  if (!SqlProfiler::exec(*query)) {
+    qCritical() << "Failed to inset offer" << query->lastError();
     return false;
   }
 
   return true;
 }
 
-ClipboardDatabase::ClipboardDatabase() {
+ClipboardDatabase::ClipboardDatabase(OpenMode mode) {
   QString connId = QString("%1-%2").arg("clipboard").arg(Crypto::UUID::v4());
   m_db = QSqlDatabase::addDatabase("QSQLITE", connId);
   m_db.setDatabaseName((Omnicast::dataDir() / "clipboard.db").c_str());
 
+  if (mode == OpenMode::ReadOnly) { m_db.setConnectOptions("QSQLITE_OPEN_READONLY"); }
+
   if (!m_db.open()) { qCritical() << "Failed to open database"; }
 
   QSqlQuery query(m_db);
 
-  for (const auto &pragma : DB_PRAGMAS) {
-    if (!query.exec(pragma)) { qCritical() << "Failed to execute pragma" << pragma << query.lastError(); }
+  for (const auto &pragma : mode == OpenMode::ReadOnly ? DB_READ_ONLY_PRAGMAS : DB_PRAGMAS) {
+    if (!SqlProfiler::exec(query, pragma)) {
+      qCritical() << "Failed to execute pragma" << pragma << query.lastError();
+    }
   }
 }
 
 ClipboardDatabase::~ClipboardDatabase() {
-  QTimer::singleShot(0, [conn = m_db.connectionName()]() { QSqlDatabase::removeDatabase(conn); });
+  QString conn = m_db.connectionName();
+
+  m_statements.clear();
+
+  // connections owned by worker threads are destroyed when these threads exit, at which point there is no
+  // event loop left to process a deferred removal.
+  if (auto app = QCoreApplication::instance(); !app || QThread::currentThread() != app->thread()) {
+    m_db.close();
+    m_db = QSqlDatabase();
+    QSqlDatabase::removeDatabase(conn);
+    return;
+  }
+
+  QTimer::singleShot(0, [conn]() { QSqlDatabase::removeDatabase(conn); });
 }
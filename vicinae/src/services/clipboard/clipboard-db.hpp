@@ -1,16 +1,31 @@
 #pragma once
 #include "common.hpp"
+#include <chrono>
+#include <map>
+#include <memory>
 #include <qsqldatabase.h>
+#include <qsqlquery.h>
 #include <qvariant.h>
+#include <unordered_map>
 
 enum class ClipboardEncryptionType {
   None,
   Local,
 };
 
+/**
+ * Compressed offers are compressed before being encrypted.
+ */
+enum class ClipboardCompressionType {
+  None,
+  Zstd,
+};
+
 struct PreferredClipboardOfferRecord {
   QString id;
+  QString blobId;
   ClipboardEncryptionType encryption;
+  ClipboardCompressionType compression = ClipboardCompressionType::None;
 };
 
 enum class ClipboardOfferKind {
@@ -35,10 +50,16 @@ struct InsertClipboardOfferPayload {
   QString mimeType;
   QString textPreview;
   QString md5sum;
+  // see `ClipboardDatabase::hasBlob`
+  QString blobId;
   ClipboardEncryptionType encryption;
+  ClipboardCompressionType compression = ClipboardCompressionType::None;
   ClipboardOfferKind kind;
+  // of the data, whether it is compressed or not
   quint64 size;
   std::optional<QString> urlHost;
+  // encrypted like the offer
+  std::optional<QByteArray> thumbnail;
 };
 
 struct InsertClipboardHistoryLine {
@@ -57,6 +78,25 @@ struct ClipboardHistoryEntry {
   uint64_t size;
   ClipboardOfferKind kind;
   std::optional<QString> urlHost;
+  // preview of image offers, still encrypted when returned by the database
+  std::optional<QByteArray> thumbnail;
+  ClipboardEncryptionType thumbnailEncryption = ClipboardEncryptionType::None;
+};
+
+/**
+ * Position in the history right after the last entry of a page, where the next one starts.
+ */
+struct ClipboardHistoryCursor {
+  // not set for selections that are not pinned, which are all listed after the pinned ones
+  std::optional<uint64_t> pinnedAt;
+  uint64_t updatedAt;
+  QString id;
+};
+
+struct ClipboardHistoryPage {
+  std::vector<ClipboardHistoryEntry> data;
+  // not set if this is the last page
+  std::optional<ClipboardHistoryCursor> next;
 };
 
 struct ClipboardListSettings {
@@ -64,10 +104,26 @@ struct ClipboardListSettings {
   std::optional<ClipboardOfferKind> kind;
 };
 
+/**
+ * Limits the history is trimmed to, by removing its oldest selections. Pinned selections are never removed,
+ * and don't count towards `maxEntries`.
+ */
+struct ClipboardRetentionPolicy {
+  std::optional<size_t> maxEntries;
+  // total size of the stored offer data, in bytes
+  std::optional<uint64_t> maxTotalSize;
+  // by kind of preferred offer
+  std::unordered_map<ClipboardOfferKind, std::chrono::seconds> maxAge;
+
+  bool isUnlimited() const { return !maxEntries && !maxTotalSize && maxAge.empty(); }
+};
+
 struct ClipboardSelectionOfferRecord {
   QString id;
+  QString blobId;
   QString mimeType;
   ClipboardEncryptionType encryption;
+  ClipboardCompressionType compression = ClipboardCompressionType::None;
 };
 
 struct ClipboardSelectionRecord {
@@ -75,7 +131,53 @@ struct ClipboardSelectionRecord {
 };
 
 class ClipboardDatabase {
+public:
+  enum class OpenMode { ReadWrite, ReadOnly };
+
+private:
+  /**
+   * A cached statement, reset once it goes out of scope: an active statement keeps its read transaction
+   * open, and the connection would not see changes made by other connections until it is reset.
+   */
+  class Statement {
+    QSqlQuery *m_query;
+
+  public:
+    QSqlQuery *operator->() const { return m_query; }
+    QSqlQuery &operator*() const { return *m_query; }
+
+    Statement(QSqlQuery *query) : m_query(query) {}
+    ~Statement();
+  };
+
   QSqlDatabase m_db;
+  // statements of this connection, by SQL
+  mutable std::unordered_map<QString, std::unique_ptr<QSqlQuery>> m_statements;
+
+  /**
+   * Statement for `sql`, prepared the first time it is requested on this connection. Bound values are kept
+   * from the previous execution.
+   */
+  Statement prepare(const QString &sql) const;
+
+  /**
+   * Append up to `limit` entries of the pinned or unpinned part of the history to `entries`, starting after
+   * `after` if set.
+   */
+  bool listHistorySegment(std::vector<ClipboardHistoryEntry> &entries, bool pinned,
+                          const std::optional<ClipboardHistoryCursor> &after, int limit,
+                          const ClipboardListSettings &opts, const QString &index,
+                          const std::function<bool()> &shouldStop) const;
+
+  /**
+   * The history index to list selections matching `opts` from, or an empty string to let SQLite start from
+   * the full text index.
+   *
+   * Following the history index stops as soon as a page is filled, but goes through all of the selections
+   * of the listed kind when few of them match the query: past `MAX_QUERY_INDEX_SCAN` of them, the matches
+   * are looked up first and only those are sorted.
+   */
+  QString historyIndex(const ClipboardListSettings &opts) const;
 
 public:
   using TxHandle = std::function<bool(ClipboardDatabase &db)>;
@@ -84,11 +186,44 @@ public:
 
   std::optional<ClipboardSelectionRecord> findSelection(const QString &id);
 
-  PaginatedResponse<ClipboardHistoryEntry> listAll(int limit = 100, int offset = 0,
-                                                   const ClipboardListSettings &opts = {}) const;
+  /**
+   * List the history, pinned selections first, by pages of `limit` entries starting after `after`.
+   * Pages are found from the history index rather than skipped over, so that listing the next page costs
+   * the same however far in the history it is.
+   *
+   * Queries match the start of words, and anywhere in the content if there is a substring index.
+   * `shouldStop` is polled while entries are collected, in which case a partial page is returned.
+   */
+  ClipboardHistoryPage listAll(int limit = 100, const std::optional<ClipboardHistoryCursor> &after = {},
+                               const ClipboardListSettings &opts = {},
+                               const std::function<bool()> &shouldStop = {}) const;
+
+  /**
+   * Optional trigram index of the indexed content, which lets queries of at least 3 characters match
+   * anywhere in it ("board" matches "clipboard") instead of only at the start of its words. It is several
+   * times larger than the prefix index.
+   *
+   * Creating the index reads all of the indexed content.
+   */
+  bool hasSubstringIndex() const;
+  bool createSubstringIndex();
+  bool dropSubstringIndex();
 
   bool removeAll();
 
+  std::optional<size_t> countSelections() const;
+
+  /**
+   * Number of selections of each kind, which is kept up to date as selections are added and removed and
+   * costs nothing to look up.
+   */
+  std::optional<std::map<ClipboardOfferKind, size_t>> countSelectionsByKind() const;
+
+  /**
+   * Size of the database file and its write-ahead log, which does not include the blobs.
+   */
+  static size_t getDatabaseSize();
+
   bool setKeywords(const QString &id, const QString &keywords);
   std::optional<QString> retrieveKeywords(const QString &id);
 
@@ -102,11 +237,38 @@ public:
   bool insertSelection(const InsertSelectionPayload &payload);
   bool insertOffer(const InsertClipboardOfferPayload &payload);
   bool indexSelectionContent(const QString &selectionId, const QString &content);
+  bool removeSelection(const QString &selectionId);
+
   /**
-   * Remove the selection from the database and return the list of offers
-   * that were deleted with it.
+   * Offer data is stored in blobs, named after a hash of their content and shared by all the offers with
+   * the same content. Blobs are reference counted by the offers, and stay in the database once they are no
+   * longer referenced until `removeUnusedBlobs` is called.
    */
-  std::vector<QString> removeSelection(const QString &selectionId);
+  bool hasBlob(const QString &id);
+  /**
+   * Delete the blobs no longer referenced by any offer, calling `removeFile` for each of them before the
+   * deletion is committed. An offer inserted afterwards with the same content does not find the blob, and
+   * writes its file again.
+   */
+  bool removeUnusedBlobs(const std::function<void(const QString &id)> &removeFile);
+
+  /**
+   * Up to `limit` selections to remove for the history to fit in `policy`, expired ones first. Selections
+   * left over by the size budget are only accounted for once they are removed, which may take more than
+   * one call.
+   */
+  std::vector<QString> findExpiredSelections(const ClipboardRetentionPolicy &policy, int limit);
+
+  /**
+   * Merge the full text index segments and rebuild the database file, reclaiming the space left by
+   * removed selections. Locks the database for the duration.
+   */
+  bool optimize();
+
+  /**
+   * Release the page cache of the connection, which fills up again as it is used.
+   */
+  void shrinkMemory();
   std::optional<PreferredClipboardOfferRecord> findPreferredOffer(const QString &selectionId);
 
   /**
@@ -114,6 +276,9 @@ public:
    */
   void runMigrations();
 
-  ClipboardDatabase();
+  /**
+   * Connections are long lived, and must only be used from the thread that created them.
+   */
+  ClipboardDatabase(OpenMode mode = OpenMode::ReadWrite);
   ~ClipboardDatabase();
 };
@@ -0,0 +1,111 @@
+#include "services/clipboard/clipboard-ingestion-worker.hpp"
+#include <qlogging.h>
+
+void ClipboardIngestionWorker::enqueue(PendingSelection pending) {
+  {
+    std::lock_guard lock(m_mutex);
+    auto now = Clock::now();
+
+    if (!m_queue.empty()) {
+      auto &last = m_queue.back();
+
+      if (now - last.lastQueuedAt < COALESCE_WINDOW && now - last.firstQueuedAt < MAX_COALESCE_TIME) {
+        last.pending = std::move(pending);
+        last.lastQueuedAt = now;
+        return;
+      }
+    }
+
+    m_queue.push_back({.pending = std::move(pending), .firstQueuedAt = now, .lastQueuedAt = now});
+
+    if (m_queue.size() > MAX_PENDING_SELECTIONS) {
+      qWarning() << "Clipboard selections are coming in faster than they can be saved, dropping the oldest";
+      m_queue.pop_front();
+    }
+  }
+
+  m_cv.notify_one();
+}
+
+void ClipboardIngestionWorker::discardPending() {
+  std::unique_lock lock(m_mutex);
+
+  m_queue.clear();
+  ++m_discardCount;
+  m_persisted.wait(lock, [&]() { return !m_persisting; });
+}
+
+ClipboardIngestionWorker::Clock::time_point ClipboardIngestionWorker::readyAt() const {
+  const auto &first = m_queue.front();
+
+  // only the last selection can still be replaced
+  if (m_queue.size() > 1) return first.lastQueuedAt;
+
+  return std::min(first.lastQueuedAt + COALESCE_WINDOW, first.firstQueuedAt + MAX_COALESCE_TIME);
+}
+
+bool ClipboardIngestionWorker::transfer(PendingSelection &pending) {
+  bool hasData = false;
+
+  for (auto &offer : pending.selection.offers) {
+    if (offer.transfer) {
+      offer.data = offer.transfer();
+      offer.transfer = nullptr;
+    }
+
+    hasData = hasData || !offer.data.isEmpty();
+  }
+
+  if (!hasData) { qWarning() << "Ignoring clipboard selection whose content could not be transferred"; }
+
+  return hasData;
+}
+
+void ClipboardIngestionWorker::run() {
+  ClipboardDatabase db;
+  std::unique_lock lock(m_mutex);
+
+  for (;;) {
+    m_cv.wait(lock, [&]() { return !m_alive || !m_queue.empty(); });
+
+    // pending selections are still persisted when stopping, without waiting for them to be replaced
+    if (m_queue.empty()) break;
+
+    if (auto at = readyAt(); m_alive && Clock::now() < at) {
+      m_cv.wait_until(lock, at);
+      continue;
+    }
+
+    PendingSelection pending = std::move(m_queue.front().pending);
+    size_t discardCount = m_discardCount;
+
+    m_queue.pop_front();
+    lock.unlock();
+    bool hasData = transfer(pending);
+    lock.lock();
+
+    // discarded while it was being transferred
+    if (!hasData || discardCount != m_discardCount) continue;
+
+    m_persisting = true;
+    lock.unlock();
+    m_handler(db, pending);
+    lock.lock();
+    m_persisting = false;
+    m_persisted.notify_all();
+  }
+}
+
+ClipboardIngestionWorker::ClipboardIngestionWorker(Handler handler) : m_handler(std::move(handler)) {
+  m_thread = std::thread([this]() { run(); });
+}
+
+ClipboardIngestionWorker::~ClipboardIngestionWorker() {
+  {
+    std::lock_guard lock(m_mutex);
+    m_alive = false;
+  }
+
+  m_cv.notify_one();
+  m_thread.join();
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "common.hpp"
+#include "services/clipboard/clipboard-db.hpp"
+#include "services/clipboard/clipboard-server.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+/**
+ * Persists clipboard selections from a dedicated thread, which owns its own database connection: hashing,
+ * encrypting and writing large selections would otherwise block the UI thread.
+ *
+ * Selections received in quick succession are coalesced, only the last one being persisted: some sources
+ * update their selection continuously (e.g. terminals while text is being selected). A selection is only
+ * replaced for up to `MAX_COALESCE_TIME`, so that a source that never stops still gets persisted.
+ */
+class ClipboardIngestionWorker : public NonCopyable {
+public:
+  struct PendingSelection {
+    ClipboardSelection selection;
+    // key to encrypt the selection with, if any
+    std::optional<QByteArray> encryptionKey;
+  };
+
+  /**
+   * Called from the worker thread for every selection to persist.
+   */
+  using Handler = std::function<void(ClipboardDatabase &db, const PendingSelection &pending)>;
+
+  // a selection replaced by another one within this delay is never persisted
+  static constexpr auto COALESCE_WINDOW = std::chrono::milliseconds(150);
+  static constexpr auto MAX_COALESCE_TIME = std::chrono::seconds(1);
+  // the oldest selections are dropped past this, if they can't be persisted fast enough
+  static constexpr size_t MAX_PENDING_SELECTIONS = 16;
+
+  void enqueue(PendingSelection pending);
+
+  /**
+   * Drop the selections that were not persisted yet. A selection that is being persisted is waited for, so
+   * that nothing gets written past this: a selection still being transferred is dropped as well.
+   */
+  void discardPending();
+
+  ClipboardIngestionWorker(Handler handler);
+  /**
+   * Persists the pending selections before returning.
+   */
+  ~ClipboardIngestionWorker();
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct QueuedSelection {
+    PendingSelection pending;
+    Clock::time_point firstQueuedAt;
+    Clock::time_point lastQueuedAt;
+  };
+
+  Handler m_handler;
+  bool m_alive = true;
+  // whether the handler is running, and how many times the pending selections were discarded
+  bool m_persisting = false;
+  size_t m_discardCount = 0;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::condition_variable m_persisted;
+  std::deque<QueuedSelection> m_queue;
+  std::thread m_thread;
+
+  /**
+   * Time at which the first queued selection can no longer be replaced, and can be persisted.
+   */
+  Clock::time_point readyAt() const;
+  void run();
+
+  /**
+   * Get the data of the offers that have to be transferred, returning whether the selection still has any
+   * data at all.
+   */
+  static bool transfer(PendingSelection &pending);
+};
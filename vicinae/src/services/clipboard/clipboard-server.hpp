@@ -1,6 +1,8 @@
 #pragma once
+#include <functional>
 #include <qobject.h>
 #include <qstringview.h>
+#include <memory>
 #include <qtmetamacros.h>
 #include <vector>
 
@@ -12,6 +14,19 @@ struct ClipboardDataOffer {
    * If the offer is an image, this is the entire image data.
    */
   QByteArray data;
+
+  /**
+   * Keeps the memory `data` points to alive, if `data` does not own it (see `QByteArray::fromRawData`).
+   * Servers receiving large selections can use this to avoid copying them.
+   */
+  std::shared_ptr<const void> storage;
+
+  /**
+   * Set instead of `data` by servers that have to transfer or decode the content of the offer, which can
+   * take a while for large ones. Called from the clipboard ingestion worker to get `data`, right before the
+   * selection is persisted.
+   */
+  std::function<QByteArray()> transfer;
 };
 
 /**
@@ -8,13 +8,17 @@
 #include <qt6keychain/keychain.h>
 #include <QtConcurrent/QtConcurrent>
 #include <QFutureWatcher>
+#include <QThreadStorage>
 #include <QBuffer>
 #include <QImage>
+#include <QMessageAuthenticationCode>
 #include "clipboard-server-factory.hpp"
 #include "crypto.hpp"
+#include "search-profiler/search-profiler.hpp"
 #include "services/app-service/app-service.hpp"
 #include "services/clipboard/clipboard-db.hpp"
 #include "wlr/wlr-clipboard-server.hpp"
+#include "zstd/zstd.hpp"
 #include "gnome/gnome-clipboard-server.hpp"
 #include "services/window-manager/abstract-window-manager.hpp"
 #include "services/window-manager/window-manager.hpp"
@@ -23,8 +27,45 @@ namespace fs = std::filesystem;
 
 static const QString KEYCHAIN_ENCRYPTION_KEY_NAME = "clipboard-data-key";
 
+// the history is trimmed once the clipboard is idle for a while
+static constexpr auto RETENTION_IDLE_DELAY = std::chrono::seconds(30);
+// for selections to expire even if nothing is copied
+static constexpr auto RETENTION_INTERVAL = std::chrono::hours(1);
+// selections removed per transaction, so that trimming a large history doesn't block other writers
+static constexpr int RETENTION_BATCH_SIZE = 100;
+// selections removed after which the full text index and the database file are compacted
+static constexpr size_t OPTIMIZE_THRESHOLD = 1000;
+
+/**
+ * The first `size` bytes of `data` at most, short of the UTF-8 sequence they would cut through.
+ */
+static QByteArrayView utf8Prefix(const QByteArray &data, qsizetype size) {
+  if (data.size() <= size) return data;
+
+  // continuation bytes are 10xxxxxx, the excluded byte must start a sequence
+  while (size > 0 && (static_cast<uchar>(data.at(size)) & 0xC0) == 0x80) {
+    --size;
+  }
+
+  return QByteArrayView(data).first(size);
+}
+
+/**
+ * Read only connection of the calling thread, used to list the history from the history thread.
+ */
+static ClipboardDatabase &historyConnection() {
+  // deletes the connection when the thread exits, while Qt's own thread data is still alive
+  static QThreadStorage<ClipboardDatabase *> connections;
+
+  if (!connections.hasLocalData()) {
+    connections.setLocalData(new ClipboardDatabase(ClipboardDatabase::OpenMode::ReadOnly));
+  }
+
+  return *connections.localData();
+}
+
 bool ClipboardService::setPinned(const QString id, bool pinned) {
-  if (!ClipboardDatabase().setPinned(id, pinned)) { return false; }
+  if (!m_db->setPinned(id, pinned)) { return false; }
 
   emit selectionPinStatusChanged(id, pinned);
 
@@ -141,6 +182,74 @@ bool ClipboardService::copyFile(const std::filesystem::path &path, const Clipboa
 
 void ClipboardService::setRecordAllOffers(bool value) { m_recordAllOffers = value; }
 
+void ClipboardService::setSubstringSearch(bool enabled) {
+  // creating the index reads all of the indexed content
+  m_maintenanceQueue.start([enabled]() {
+    ClipboardDatabase db;
+
+    if (enabled) {
+      db.createSubstringIndex();
+    } else {
+      db.dropSubstringIndex();
+    }
+  });
+}
+
+void ClipboardService::setRetentionPolicy(const ClipboardRetentionPolicy &policy) {
+  m_retentionPolicy = policy;
+  scheduleRetention(RETENTION_IDLE_DELAY);
+}
+
+void ClipboardService::scheduleRetention(std::chrono::milliseconds delay) {
+  if (m_retentionPolicy.isUnlimited()) {
+    m_retentionTimer->stop();
+    return;
+  }
+
+  m_retentionTimer->start(delay);
+}
+
+void ClipboardService::applyRetentionPolicy() {
+  m_maintenanceQueue.start([this, policy = m_retentionPolicy]() { trimHistory(policy); });
+  scheduleRetention(RETENTION_INTERVAL);
+}
+
+void ClipboardService::trimHistory(const ClipboardRetentionPolicy &policy) {
+  ClipboardDatabase cdb;
+  std::vector<QString> removed;
+
+  for (;;) {
+    auto ids = cdb.findExpiredSelections(policy, RETENTION_BATCH_SIZE);
+
+    if (ids.empty()) break;
+
+    bool ok = cdb.transaction([&](ClipboardDatabase &db) {
+      return std::ranges::all_of(ids, [&](const QString &id) { return db.removeSelection(id); });
+    });
+
+    if (!ok) break;
+
+    cdb.removeUnusedBlobs([&](const QString &blobId) { fs::remove(m_dataDir / blobId.toStdString()); });
+    removed.insert(removed.end(), ids.begin(), ids.end());
+  }
+
+  if (removed.empty()) return;
+
+  qInfo() << "Removed" << removed.size() << "clipboard selections past the retention policy";
+  m_removedSinceOptimize += removed.size();
+
+  if (m_removedSinceOptimize >= OPTIMIZE_THRESHOLD && cdb.optimize()) { m_removedSinceOptimize = 0; }
+
+  QMetaObject::invokeMethod(
+      this,
+      [this, removed = std::move(removed)]() {
+        for (const auto &id : removed) {
+          emit selectionRemoved(id);
+        }
+      },
+      Qt::QueuedConnection);
+}
+
 void ClipboardService::setMonitoring(bool value) {
   m_monitoring = value;
   emit monitoringChanged(value);
@@ -150,6 +259,20 @@ bool ClipboardService::isServerRunning() const { return m_clipboardServer->isAli
 
 bool ClipboardService::monitoring() const { return m_monitoring; }
 
+void ClipboardService::shrinkMemory() {
+  m_db->shrinkMemory();
+  // the connection of the history thread can only be used from it
+  m_historyPool.start([]() { historyConnection().shrinkMemory(); });
+}
+
+ClipboardStats ClipboardService::stats() const {
+  return {.selectionCount = m_db->countSelections(), .databaseSize = ClipboardDatabase::getDatabaseSize()};
+}
+
+std::optional<std::map<ClipboardOfferKind, size_t>> ClipboardService::countSelectionsByKind() const {
+  return m_db->countSelectionsByKind();
+}
+
 bool ClipboardService::copyHtml(const Clipboard::Html &data, const Clipboard::CopyOptions &options) {
   auto mimeData = new QMimeData;
 
@@ -173,16 +296,61 @@ bool ClipboardService::copyText(const QString &text, const Clipboard::CopyOption
   return true;
 }
 
-QFuture<PaginatedResponse<ClipboardHistoryEntry>>
-ClipboardService::listAll(int limit, int offset, const ClipboardListSettings &opts) const {
-  return QtConcurrent::run(
-      [opts, limit, offset]() { return ClipboardDatabase().listAll(limit, offset, opts); });
+QFuture<ClipboardHistoryPage>
+ClipboardService::listAll(int limit, const std::optional<ClipboardHistoryCursor> &after,
+                          const ClipboardListSettings &opts) const {
+  QPromise<ClipboardHistoryPage> promise;
+  auto future = promise.future();
+  uint64_t generation = ++m_historyGeneration;
+
+  m_historyPool.start([this, generation, limit, after, opts, key = m_localEncryptionKey,
+                       promise = std::move(promise)]() mutable {
+    auto isCanceled = [&]() { return promise.isCanceled() || m_historyGeneration != generation; };
+    SearchProfiler::Scope profile("clipboard");
+
+    // a newer request was made while this one was waiting for the history thread
+    if (isCanceled()) {
+      profile.discard();
+      promise.future().cancel();
+      promise.finish();
+      return;
+    }
+
+    auto page = historyConnection().listAll(limit, after, opts, isCanceled);
+
+    for (auto &entry : page.data) {
+      if (!entry.thumbnail || entry.thumbnailEncryption == ClipboardEncryptionType::None) continue;
+
+      if (entry.thumbnailEncryption == ClipboardEncryptionType::Local && key) {
+        entry.thumbnail = Crypto::AES256GCM::decrypt(*entry.thumbnail, *key);
+      } else {
+        entry.thumbnail.reset();
+      }
+
+      entry.thumbnailEncryption = ClipboardEncryptionType::None;
+    }
+
+    if (isCanceled()) {
+      profile.discard();
+      promise.future().cancel();
+      promise.finish();
+      return;
+    }
+
+    profile.setResultCount(page.data.size());
+    promise.addResult(std::move(page));
+    promise.finish();
+  });
+
+  return future;
 }
 
 ClipboardOfferKind ClipboardService::getKind(const ClipboardDataOffer &offer) {
   if (offer.mimeType.startsWith("image/")) return ClipboardOfferKind::Image;
   if (offer.mimeType.startsWith("text/")) {
     if (offer.mimeType == "text/html") { return ClipboardOfferKind::Text; }
+    // not a link someone would copy, and not worth parsing
+    if (offer.data.size() > PREVIEW_SCAN_SIZE) { return ClipboardOfferKind::Text; }
     auto url = QUrl::fromEncoded(offer.data, QUrl::StrictMode);
     if (url.isValid() && !url.scheme().isEmpty()) { return ClipboardOfferKind::Link; }
 
@@ -237,50 +405,73 @@ QString ClipboardService::getSelectionPreferredMimeType(const ClipboardSelection
 }
 
 bool ClipboardService::removeSelection(const QString &selectionId) {
-  ClipboardDatabase cdb;
+  if (!m_db->removeSelection(selectionId)) return false;
 
-  for (const auto &offer : cdb.removeSelection(selectionId)) {
-    fs::remove(m_dataDir / offer.toStdString());
-  }
+  m_db->removeUnusedBlobs([&](const QString &blobId) { fs::remove(m_dataDir / blobId.toStdString()); });
 
   emit selectionRemoved(selectionId);
 
   return true;
 }
 
-QByteArray ClipboardService::decryptOffer(const QByteArray &data, ClipboardEncryptionType enc) const {
+QByteArray ClipboardService::readOffer(QIODevice &file, ClipboardEncryptionType enc,
+                                       ClipboardCompressionType compression, qsizetype maxSize) const {
+  bool compressed = compression == ClipboardCompressionType::Zstd;
+  QByteArray data;
+
   switch (enc) {
   case ClipboardEncryptionType::None:
-    return data;
+    if (compressed) return Zstd::decompressFrom(file, maxSize);
+    return maxSize < 0 ? file.readAll() : file.read(maxSize);
   case ClipboardEncryptionType::Local: {
     if (!m_localEncryptionKey) {
       qWarning() << "No local encryption key available for decryption";
       return {};
     }
 
-    return Crypto::AES256GCM::decrypt(data, *m_localEncryptionKey);
+    // authenticated as a whole, the ciphertext can't be decrypted in part
+    data = Crypto::AES256GCM::decryptFrom(file, *m_localEncryptionKey);
+    break;
   }
   default:
-    break;
+    qWarning() << "unknown encryption kind" << static_cast<int>(enc);
+    return {};
   }
 
-  qWarning() << "unknown encryption kind" << static_cast<int>(enc);
+  if (compressed) {
+    QBuffer buffer(&data);
 
-  return {};
-}
+    buffer.open(QIODevice::ReadOnly);
 
-QByteArray ClipboardService::decryptMainSelectionOffer(const QString &selectionId) const {
-  ClipboardDatabase cdb;
+    return Zstd::decompressFrom(buffer, maxSize);
+  }
+
+  if (maxSize >= 0 && data.size() > maxSize) { data.truncate(maxSize); }
+
+  return data;
+}
 
-  auto offer = cdb.findPreferredOffer(selectionId);
+QByteArray ClipboardService::decryptMainSelectionOffer(const QString &selectionId, qsizetype maxSize) const {
+  auto offer = m_db->findPreferredOffer(selectionId);
 
   if (!offer) {
     qWarning() << "Can't find preferred offer for selection" << selectionId;
     return {};
   };
 
-  fs::path path = m_dataDir / offer->id.toStdString();
+  return loadOffer(selectionId, offer->id, offer->blobId, offer->encryption, offer->compression, maxSize);
+}
+
+QByteArray ClipboardService::loadOffer(const QString &selectionId, const QString &offerId,
+                                       const QString &blobId, ClipboardEncryptionType enc,
+                                       ClipboardCompressionType compression, qsizetype maxSize) const {
+  bool encrypted = enc != ClipboardEncryptionType::None;
+
+  if (encrypted) {
+    if (auto data = m_offerCache->get(offerId)) return maxSize < 0 ? *data : data->left(maxSize);
+  }
 
+  fs::path path = m_dataDir / blobId.toStdString();
   QFile file(path);
 
   if (!file.open(QIODevice::ReadOnly)) {
@@ -288,28 +479,82 @@ QByteArray ClipboardService::decryptMainSelectionOffer(const QString &selectionI
     return {};
   }
 
-  auto data = file.readAll();
+  QByteArray data = readOffer(file, enc, compression, maxSize);
 
-  return decryptOffer(data, offer->encryption);
+  if (encrypted && maxSize < 0) { m_offerCache->insert(selectionId, offerId, data); }
+
+  return data;
+}
+
+QString ClipboardService::computeBlobId(const QByteArray &data, const std::optional<QByteArray> &key,
+                                       ClipboardCompressionType compression) {
+  // encrypted blobs are named by a keyed hash: a plain hash of their content would tell whether some known
+  // content was copied, without having to decrypt anything.
+  QByteArray hash = key ? QMessageAuthenticationCode::hash(data, *key, QCryptographicHash::Sha256)
+                        : QCryptographicHash::hash(data, QCryptographicHash::Sha256);
+  QString id = QString::fromUtf8(hash.toHex());
+
+  if (compression == ClipboardCompressionType::Zstd) { id += ".zst"; }
+
+  return id;
 }
 
-QByteArray ClipboardService::computeSelectionHash(const ClipboardSelection &selection) const {
+QByteArray ClipboardService::computeSelectionHash(const std::vector<QByteArray> &offerHashes) const {
   QCryptographicHash hash(QCryptographicHash::Md5);
 
-  for (const auto &offer : selection.offers) {
-    hash.addData(QCryptographicHash::hash(offer.data, QCryptographicHash::Md5));
+  for (const auto &offerHash : offerHashes) {
+    hash.addData(offerHash);
   }
 
   return hash.result();
 }
 
 bool ClipboardService::isClearSelection(const ClipboardSelection &selection) const {
-  return std::ranges::fold_left(selection.offers, 0,
-                                [](size_t acc, auto &&item) { return acc + item.data.size(); }) == 0;
+  return std::ranges::none_of(selection.offers,
+                              [](auto &&offer) { return !offer.data.isEmpty() || offer.transfer; });
+}
+
+QByteArray ClipboardService::createThumbnail(const QByteArray &data) {
+  QBuffer buffer;
+  QImageReader reader(&buffer);
+
+  buffer.setData(data);
+
+  // formats that support it decode at the reduced size directly, instead of decoding the whole image first
+  if (auto size = reader.size(); size.isValid()) {
+    if (size.width() > THUMBNAIL_SIZE || size.height() > THUMBNAIL_SIZE) {
+      reader.setScaledSize(size.scaled(THUMBNAIL_SIZE, THUMBNAIL_SIZE, Qt::KeepAspectRatio));
+    }
+  }
+
+  QImage image = reader.read();
+
+  if (image.isNull()) { return {}; }
+
+  if (image.width() > THUMBNAIL_SIZE || image.height() > THUMBNAIL_SIZE) {
+    image = image.scaled(THUMBNAIL_SIZE, THUMBNAIL_SIZE, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+  }
+
+  QByteArray thumbnail;
+  QBuffer output(&thumbnail);
+
+  output.open(QIODevice::WriteOnly);
+
+  // the webp plugin is optional
+  if (image.save(&output, "WEBP", 80)) { return thumbnail; }
+
+  thumbnail.clear();
+  output.seek(0);
+
+  if (!image.save(&output, "PNG")) { return {}; }
+
+  return thumbnail;
 }
 
 QString ClipboardService::getOfferTextPreview(const ClipboardDataOffer &offer) {
-  if (offer.mimeType.startsWith("text/")) { return offer.data.simplified().mid(0, 50); }
+  if (offer.mimeType.startsWith("text/")) {
+    return QString::fromUtf8(utf8Prefix(offer.data, PREVIEW_SCAN_SIZE)).simplified().mid(0, 50);
+  }
 
   if (offer.mimeType.startsWith("image/")) {
     QBuffer buffer;
@@ -328,11 +573,11 @@ QString ClipboardService::getOfferTextPreview(const ClipboardDataOffer &offer) {
 }
 
 std::optional<QString> ClipboardService::retrieveKeywords(const QString &id) {
-  return ClipboardDatabase().retrieveKeywords(id);
+  return m_db->retrieveKeywords(id);
 }
 
 bool ClipboardService::setKeywords(const QString &id, const QString &keywords) {
-  return ClipboardDatabase().setKeywords(id, keywords);
+  return m_db->setKeywords(id, keywords);
 }
 
 void ClipboardService::saveSelection(ClipboardSelection selection) {
@@ -350,11 +595,27 @@ void ClipboardService::saveSelection(ClipboardSelection selection) {
     return;
   }
 
-  auto selectionHash = QString::fromUtf8(computeSelectionHash(selection).toHex());
+  m_ingestionWorker->enqueue({.selection = std::move(selection), .encryptionKey = m_localEncryptionKey});
+}
+
+void ClipboardService::persistSelection(ClipboardDatabase &cdb,
+                                        const ClipboardIngestionWorker::PendingSelection &pending) {
+  const auto &selection = pending.selection;
+  const auto &encryptionKey = pending.encryptionKey;
+
+  // offers are only hashed once, large ones taking a while
+  std::vector<QByteArray> offerHashes;
+
+  offerHashes.reserve(selection.offers.size());
+
+  for (const auto &offer : selection.offers) {
+    offerHashes.emplace_back(QCryptographicHash::hash(offer.data, QCryptographicHash::Md5));
+  }
+
+  auto selectionHash = QString::fromUtf8(computeSelectionHash(offerHashes).toHex());
   QString preferredMimeType = getSelectionPreferredMimeType(selection);
 
   ClipboardHistoryEntry insertedEntry;
-  ClipboardDatabase cdb;
 
   auto preferredOfferIt =
       std::ranges::find_if(selection.offers, [&](auto &&o) { return o.mimeType == preferredMimeType; });
@@ -376,20 +637,27 @@ void ClipboardService::saveSelection(ClipboardSelection selection) {
     }
 
     // Index all offers, including empty ones
-    for (const auto &offer : selection.offers) {
+    for (size_t i = 0; i < selection.offers.size(); ++i) {
+      const auto &offer = selection.offers[i];
       ClipboardOfferKind kind = getKind(offer);
       bool isIndexableText = kind == ClipboardOfferKind::Text || kind == ClipboardOfferKind::Link;
       QString textPreview = getOfferTextPreview(offer);
 
       if (isIndexableText && !offer.data.isEmpty()) {
-        if (!db.indexSelectionContent(selectionId, offer.data)) return false;
+        // tokenizing all of a large text takes a while, and makes for a large index
+        auto content = QString::fromUtf8(utf8Prefix(offer.data, MAX_INDEXED_TEXT_SIZE));
+
+        if (!db.indexSelectionContent(selectionId, content)) return false;
       }
 
-      auto md5sum = QCryptographicHash::hash(offer.data, QCryptographicHash::Md5).toHex();
+      bool compressed = isIndexableText && offer.data.size() >= COMPRESSION_THRESHOLD;
+      auto compression = compressed ? ClipboardCompressionType::Zstd : ClipboardCompressionType::None;
+      auto md5sum = offerHashes[i].toHex();
       auto offerId = Crypto::UUID::v4();
+      QString blobId = computeBlobId(offer.data, encryptionKey, compression);
       ClipboardEncryptionType encryption = ClipboardEncryptionType::None;
 
-      if (m_localEncryptionKey) encryption = ClipboardEncryptionType::Local;
+      if (encryptionKey) encryption = ClipboardEncryptionType::Local;
 
       InsertClipboardOfferPayload dto{
           .id = offerId,
@@ -397,7 +665,9 @@ void ClipboardService::saveSelection(ClipboardSelection selection) {
           .mimeType = offer.mimeType,
           .textPreview = textPreview,
           .md5sum = md5sum,
+          .blobId = blobId,
           .encryption = encryption,
+          .compression = compression,
           .size = static_cast<quint64>(offer.data.size()),
       };
 
@@ -406,17 +676,51 @@ void ClipboardService::saveSelection(ClipboardSelection selection) {
         if (url.scheme().startsWith("http")) { dto.urlHost = url.host(); }
       }
 
-      db.insertOffer(dto);
+      // only the preferred offer is shown in the history
+      if (kind == ClipboardOfferKind::Image && offer.mimeType == preferredMimeType) {
+        if (auto thumbnail = createThumbnail(offer.data); !thumbnail.isEmpty()) {
+          dto.thumbnail = encryptionKey ? Crypto::AES256GCM::encrypt(thumbnail, *encryptionKey) : thumbnail;
+        }
+      }
 
-      fs::path targetPath = m_dataDir / offerId.toStdString();
-      QFile targetFile(targetPath);
+      // the same content is only stored once, whatever the selection it was copied with
+      bool isNewBlob = !db.hasBlob(blobId);
 
-      if (!targetFile.open(QIODevice::WriteOnly)) { continue; }
+      if (!db.insertOffer(dto)) return false;
 
-      if (m_localEncryptionKey) {
-        targetFile.write(Crypto::AES256GCM::encrypt(offer.data, *m_localEncryptionKey));
-      } else {
-        targetFile.write(offer.data);
+      if (isNewBlob) {
+        fs::path targetPath = m_dataDir / blobId.toStdString();
+        QFile targetFile(targetPath);
+
+        // the blob would be missing for every later copy of the same content
+        if (!targetFile.open(QIODevice::WriteOnly)) {
+          qWarning() << "Failed to open clipboard blob" << targetPath << targetFile.errorString();
+          return false;
+        }
+
+        QByteArray compressedData;
+
+        if (compressed) {
+          compressedData = Zstd::compress(offer.data);
+
+          if (compressedData.isEmpty()) {
+            qWarning() << "Failed to compress clipboard offer" << targetPath;
+            return false;
+          }
+        }
+
+        const QByteArray &data = compressed ? compressedData : offer.data;
+
+        if (encryptionKey) {
+          // written as it gets encrypted, large offers would otherwise be held twice in memory
+          if (!Crypto::AES256GCM::encryptTo(targetFile, data, *encryptionKey)) {
+            qWarning() << "Failed to write encrypted clipboard offer to" << targetPath;
+            return false;
+          }
+        } else if (targetFile.write(data) != data.size()) {
+          qWarning() << "Failed to write clipboard offer to" << targetPath << targetFile.errorString();
+          return false;
+        }
       }
 
       // Set the insertedEntry for the preferred offer
@@ -433,24 +737,22 @@ void ClipboardService::saveSelection(ClipboardSelection selection) {
     return true;
   });
 
-  emit itemInserted(insertedEntry);
+  QMetaObject::invokeMethod(
+      this, [this, insertedEntry]() { emit itemInserted(insertedEntry); }, Qt::QueuedConnection);
 }
 
 std::optional<ClipboardSelection> ClipboardService::retrieveSelectionById(const QString &id) {
-  ClipboardDatabase cdb;
   ClipboardSelection populatedSelection;
-  const auto selection = cdb.findSelection(id);
+  const auto selection = m_db->findSelection(id);
 
   if (!selection) return std::nullopt;
 
   for (const auto &offer : selection->offers) {
     ClipboardDataOffer populatedOffer;
-    fs::path path = m_dataDir / offer.id.toStdString();
-    QFile file(path);
 
-    if (!file.open(QIODevice::ReadOnly)) { continue; }
+    if (!fs::exists(m_dataDir / offer.blobId.toStdString())) { continue; }
 
-    populatedOffer.data = decryptOffer(file.readAll(), offer.encryption);
+    populatedOffer.data = loadOffer(id, offer.id, offer.blobId, offer.encryption, offer.compression);
     populatedOffer.mimeType = offer.mimeType;
     populatedSelection.offers.emplace_back(populatedOffer);
   }
@@ -507,14 +809,15 @@ bool ClipboardService::copySelection(const ClipboardSelection &selection,
 }
 
 bool ClipboardService::removeAllSelections() {
-  ClipboardDatabase db;
+  m_ingestionWorker->discardPending();
 
-  if (!db.removeAll()) return false;
+  if (!m_db->removeAll()) return false;
 
   fs::remove_all(m_dataDir);
   fs::create_directories(m_dataDir);
 
-  emit allSelectionsRemoved();
+  // queued after the insertions of the selections persisted until now, which no longer exist
+  QMetaObject::invokeMethod(this, [this]() { emit allSelectionsRemoved(); }, Qt::QueuedConnection);
 
   return true;
 }
@@ -541,7 +844,18 @@ ClipboardService::ClipboardService(const std::filesystem::path &path, WindowMana
     qCritical() << "Failed to start clipboard server, clipboard monitoring will not work";
   }
 
-  ClipboardDatabase().runMigrations();
+  m_db = std::make_unique<ClipboardDatabase>();
+  m_db->runMigrations();
+
+  m_historyPool.setMaxThreadCount(1);
+  // the thread keeps its connection for as long as it lives
+  m_historyPool.setExpiryTimeout(-1);
+  m_retentionTimer->setSingleShot(true);
+
+  m_ingestionWorker = std::make_unique<ClipboardIngestionWorker>(
+      [this](ClipboardDatabase &db, const ClipboardIngestionWorker::PendingSelection &pending) {
+        persistSelection(db, pending);
+      });
 
   auto watcher = new QFutureWatcher<GetLocalEncryptionKeyResponse>;
 
@@ -558,4 +872,9 @@ ClipboardService::ClipboardService(const std::filesystem::path &path, WindowMana
 
   connect(m_clipboardServer.get(), &AbstractClipboardServer::selectionAdded, this,
           &ClipboardService::saveSelection);
+  connect(m_retentionTimer, &QTimer::timeout, this, &ClipboardService::applyRetentionPolicy);
+  // covers the selections removed by the retention policy too
+  connect(this, &ClipboardService::selectionRemoved, m_offerCache, &SecureOfferCache::removeSelection);
+  connect(this, &ClipboardService::allSelectionsRemoved, m_offerCache, &SecureOfferCache::clear);
+  connect(this, &ClipboardService::itemInserted, this, [this]() { scheduleRetention(RETENTION_IDLE_DELAY); });
 }
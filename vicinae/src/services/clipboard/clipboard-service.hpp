@@ -3,10 +3,15 @@
 #include "extensions/wm/wm-extension.hpp"
 #include "services/app-service/app-service.hpp"
 #include "services/clipboard/clipboard-db.hpp"
+#include "services/clipboard/clipboard-ingestion-worker.hpp"
 #include "services/clipboard/clipboard-server.hpp"
+#include "services/clipboard/secure-offer-cache.hpp"
 #include "services/window-manager/abstract-window-manager.hpp"
 #include "services/window-manager/window-manager.hpp"
+#include "task-scheduler/task-scheduler.hpp"
 #include <QString>
+#include <atomic>
+#include <chrono>
 #include <expected>
 #include <filesystem>
 #include <QJsonObject>
@@ -18,6 +23,8 @@
 #include <qsqldatabase.h>
 #include <qsqlquery.h>
 #include <qstringview.h>
+#include <qthreadpool.h>
+#include <qtimer.h>
 #include <qt6keychain/keychain.h>
 
 namespace Clipboard {
@@ -58,6 +65,11 @@ static Content fromJson(const QJsonObject &obj) {
 
 }; // namespace Clipboard
 
+struct ClipboardStats {
+  std::optional<size_t> selectionCount;
+  size_t databaseSize = 0;
+};
+
 class ClipboardService : public QObject, public NonCopyable {
 public:
   using GetLocalEncryptionKeyResponse = std::expected<QByteArray, QKeychain::Error>;
@@ -76,9 +88,44 @@ private:
   QMimeDatabase _mimeDb;
   std::filesystem::path m_dataDir;
   std::unique_ptr<AbstractClipboardServer> m_clipboardServer;
+  // connection of the main thread
+  std::unique_ptr<ClipboardDatabase> m_db;
+  // one thread, listing the history from the same connection. Requests superseded by a newer one are
+  // dropped, or stopped early if they are already running.
+  mutable std::atomic<uint64_t> m_historyGeneration = 0;
+  mutable QThreadPool m_historyPool;
+  // maintenance tasks open connections of their own, and run in the order they were requested
+  TaskQueue m_maintenanceQueue{TaskScheduler::Priority::Background};
+
+  ClipboardRetentionPolicy m_retentionPolicy;
+  QTimer *m_retentionTimer = new QTimer(this);
+  // decrypted data of the encrypted offers that were recently read
+  SecureOfferCache *m_offerCache = new SecureOfferCache(SecureOfferCache::DEFAULT_BUDGET, this);
+  // only accessed from the maintenance thread
+  size_t m_removedSinceOptimize = 0;
+  // last, so that pending selections are persisted before anything they need is destroyed
+  std::unique_ptr<ClipboardIngestionWorker> m_ingestionWorker;
+
+  static constexpr int THUMBNAIL_SIZE = 256;
+  // the kind and preview of an offer are found from the start of its data, however large it is
+  static constexpr qsizetype PREVIEW_SCAN_SIZE = 4096;
+  // only the start of larger texts can be searched for
+  static constexpr qsizetype MAX_INDEXED_TEXT_SIZE = 256 * 1024;
+  // texts from this size on are stored compressed
+  static constexpr qsizetype COMPRESSION_THRESHOLD = 64 * 1024;
 
   static QString getSelectionPreferredMimeType(const ClipboardSelection &selection);
+  /**
+   * Name of the blob storing `data`, see `ClipboardDatabase::hasBlob`. Blobs encrypted with `key` or
+   * compressed are named differently than plain ones, a blob being stored in a single way.
+   */
+  static QString computeBlobId(const QByteArray &data, const std::optional<QByteArray> &key,
+                               ClipboardCompressionType compression);
   static QString getOfferTextPreview(const ClipboardDataOffer &offer);
+  /**
+   * Preview of an image offer, fitting in `THUMBNAIL_SIZE`. Empty if the image can't be decoded.
+   */
+  static QByteArray createThumbnail(const QByteArray &data);
 
   QFuture<GetLocalEncryptionKeyResponse> getLocalEncryptionKey();
 
@@ -86,13 +133,41 @@ private:
    * Unique selection hash obtained by hashing all the data offer hashes together.
    * This is used to prevent reinserting the exact same selection multiple times.
    */
-  QByteArray computeSelectionHash(const ClipboardSelection &selection) const;
+  QByteArray computeSelectionHash(const std::vector<QByteArray> &offerHashes) const;
   bool isClearSelection(const ClipboardSelection &selection) const;
 
-  QByteArray decryptOffer(const QByteArray &data, ClipboardEncryptionType enc) const;
+  /**
+   * The data of the offer stored in `file`, decrypted and decompressed as it is read. Only the first
+   * `maxSize` bytes are returned if set, compressed offers being only decompressed that far.
+   */
+  QByteArray readOffer(QIODevice &file, ClipboardEncryptionType enc, ClipboardCompressionType compression,
+                       qsizetype maxSize = -1) const;
+
+  /**
+   * The data of `offerId`, stored in `blobId`, up to `maxSize` bytes if set. Decrypted offers are served from
+   * `m_offerCache`, and added to it if they were read whole.
+   */
+  QByteArray loadOffer(const QString &selectionId, const QString &offerId, const QString &blobId,
+                       ClipboardEncryptionType enc, ClipboardCompressionType compression,
+                       qsizetype maxSize = -1) const;
+
+  /**
+   * Called from the ingestion worker thread.
+   */
+  void persistSelection(ClipboardDatabase &db, const ClipboardIngestionWorker::PendingSelection &pending);
 
   static ClipboardOfferKind getKind(const ClipboardDataOffer &offer);
 
+  /**
+   * Enforce the retention policy from the maintenance thread.
+   */
+  void scheduleRetention(std::chrono::milliseconds delay);
+  void applyRetentionPolicy();
+  /**
+   * Called from the maintenance thread.
+   */
+  void trimHistory(const ClipboardRetentionPolicy &policy);
+
 public:
   ClipboardService(const std::filesystem::path &path, WindowManager &wm, AppService &app);
 
@@ -101,12 +176,17 @@ public:
   std::optional<QString> retrieveKeywords(const QString &id);
   bool setKeywords(const QString &id, const QString &keywords);
 
-  QByteArray decryptMainSelectionOffer(const QString &selectionId) const;
+  /**
+   * Data of the preferred offer of `selectionId`, up to `maxSize` bytes if set: large texts only have to be
+   * shown in part.
+   */
+  QByteArray decryptMainSelectionOffer(const QString &selectionId, qsizetype maxSize = -1) const;
   AbstractClipboardServer *clipboardServer() const;
   bool removeSelection(const QString &id);
   bool setPinned(const QString id, bool pinned);
-  QFuture<PaginatedResponse<ClipboardHistoryEntry>> listAll(int limit = 100, int offset = 0,
-                                                            const ClipboardListSettings &opts = {}) const;
+  QFuture<ClipboardHistoryPage> listAll(int limit = 100,
+                                        const std::optional<ClipboardHistoryCursor> &after = {},
+                                        const ClipboardListSettings &opts = {}) const;
   bool copyText(const QString &text, const Clipboard::CopyOptions &options = {.concealed = true});
   bool copyHtml(const Clipboard::Html &data, const Clipboard::CopyOptions &options = {.concealed = false});
   bool copyFile(const std::filesystem::path &path,
@@ -116,6 +196,16 @@ public:
   bool pasteContent(const Clipboard::Content &content,
                     const Clipboard::CopyOptions options = {.concealed = false});
   void setRecordAllOffers(bool value);
+  /**
+   * Maintain a trigram index of the indexed content, so that queries of at least 3 characters also match
+   * inside words. See `ClipboardDatabase::createSubstringIndex`, the setting is persisted by the database.
+   */
+  void setSubstringSearch(bool enabled);
+  /**
+   * The history is trimmed in the background, shortly after the policy changes or selections are copied,
+   * and periodically for selections to expire.
+   */
+  void setRetentionPolicy(const ClipboardRetentionPolicy &policy);
   bool clear();
   void saveSelection(ClipboardSelection selection);
   ClipboardSelection retrieveSelection(int offset = 0);
@@ -125,6 +215,13 @@ public:
 
   bool isServerRunning() const;
   bool monitoring() const;
+  ClipboardStats stats() const;
+  std::optional<std::map<ClipboardOfferKind, size_t>> countSelectionsByKind() const;
+
+  /**
+   * Release the page caches of the connections to the history, see `ClipboardDatabase::shrinkMemory`.
+   */
+  void shrinkMemory();
   void setMonitoring(bool value);
 
 signals:
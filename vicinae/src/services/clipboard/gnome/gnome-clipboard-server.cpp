@@ -7,6 +7,11 @@
 #include <QDebug>
 #include <QTimer>
 #include <QMetaObject>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
 
 GnomeClipboardServer::GnomeClipboardServer() : m_bus(QDBusConnection::sessionBus()) {
   using namespace std::chrono_literals;
@@ -134,8 +139,14 @@ bool GnomeClipboardServer::setupDBusConnection() {
     return false;
   }
 
+  // extensions able to write large contents to a file descriptor only send their size in the signal
+  bool canPassFds = m_bus.connectionCapabilities().testFlag(QDBusConnection::UnixFileDescriptorPassing);
+  bool hasTransferMethod = m_interface->metaObject()->indexOfMethod(TRANSFER_METHOD_SIGNATURE) != -1;
+
+  m_supportsFdTransfer = canPassFds && hasTransferMethod;
   m_isConnected = true;
-  qInfo() << "GnomeClipboardServer: D-Bus connection established successfully";
+  qInfo() << "GnomeClipboardServer: D-Bus connection established successfully, fd transfers"
+          << (m_supportsFdTransfer ? "supported" : "unsupported");
 
   return true;
 }
@@ -159,6 +170,89 @@ void GnomeClipboardServer::cleanupDBusConnection() {
   m_isConnected = false;
 }
 
+QByteArray GnomeClipboardServer::decodeContent(const QString &content, const QString &mimeType) {
+  if (!mimeType.startsWith("image/") && !mimeType.startsWith("application/")) { return content.toUtf8(); }
+
+  // images and binary data come as base64, possibly as a data URL: data:image/png;base64,iVBORw0KG...
+  QStringView base64String = content;
+
+  if (content.startsWith("data:")) {
+    if (auto commaIndex = content.indexOf(','); commaIndex != -1) {
+      base64String = base64String.sliced(commaIndex + 1);
+    } else {
+      qWarning() << "GnomeClipboardServer: Invalid data URL format for" << mimeType;
+    }
+  }
+
+  QByteArray base64Content = base64String.toUtf8();
+  QByteArray data = QByteArray::fromBase64(base64Content);
+
+  if (data.isEmpty() && !base64Content.isEmpty()) {
+    qWarning() << "GnomeClipboardServer: Failed to decode base64 data for" << mimeType;
+    // Fall back to treating as text
+    return base64Content;
+  }
+
+  return data;
+}
+
+std::function<QByteArray()> GnomeClipboardServer::requestContent(const QString &mimeType) {
+  int fds[2];
+
+  if (pipe2(fds, O_CLOEXEC) != 0) {
+    qWarning() << "GnomeClipboardServer: Failed to create transfer pipe:" << strerror(errno);
+    return nullptr;
+  }
+
+  // the write end is duplicated into the message, the extension closes it once it wrote everything
+  QDBusUnixFileDescriptor writeEnd(fds[1]);
+  auto readEnd = std::shared_ptr<int>(new int(fds[0]), [](int *fd) {
+    close(*fd);
+    delete fd;
+  });
+
+  close(fds[1]);
+
+  auto call = m_interface->asyncCall(TRANSFER_METHOD, mimeType, QVariant::fromValue(writeEnd));
+  auto watcher = new QDBusPendingCallWatcher(call, this);
+
+  connect(watcher, &QDBusPendingCallWatcher::finished, this, [mimeType](QDBusPendingCallWatcher *watcher) {
+    if (watcher->isError()) {
+      qWarning() << "GnomeClipboardServer: Failed to transfer" << mimeType << watcher->error().message();
+    }
+    watcher->deleteLater();
+  });
+
+  return [readEnd, mimeType]() {
+    QByteArray data;
+    char buf[64 * 1024];
+    pollfd pfd{.fd = *readEnd, .events = POLLIN};
+
+    for (;;) {
+      int ready = poll(&pfd, 1, TRANSFER_TIMEOUT_MS);
+
+      if (ready < 0 && errno == EINTR) continue;
+      if (ready <= 0) {
+        qWarning() << "GnomeClipboardServer: Timed out transferring" << mimeType;
+        return QByteArray();
+      }
+
+      ssize_t n = read(*readEnd, buf, sizeof(buf));
+
+      if (n < 0 && errno == EINTR) continue;
+      if (n < 0) {
+        qWarning() << "GnomeClipboardServer: Failed to read" << mimeType << strerror(errno);
+        return QByteArray();
+      }
+      if (n == 0) break;
+
+      data.append(buf, n);
+    }
+
+    return data;
+  };
+}
+
 void GnomeClipboardServer::handleClipboardChanged(const QString &content, qulonglong timestamp,
                                                   const QString &source, const QString &mimeType,
                                                   const QString &contentType, const QString &contentHash,
@@ -166,78 +260,36 @@ void GnomeClipboardServer::handleClipboardChanged(const QString &content, qulong
   qDebug() << "GnomeClipboardServer: Received clipboard change from" << sourceApp << "with mime type"
            << mimeType << "and size" << size;
 
-  try {
-    // Create ClipboardSelection from D-Bus signal data
-    ClipboardSelection selection;
-
-    // Create the main data offer
-    ClipboardDataOffer offer;
-    offer.mimeType = mimeType;
-
-    // Handle different content types appropriately
-    if (mimeType.startsWith("image/") || mimeType.startsWith("application/")) {
-      // For images and binary data, handle both data URLs and plain base64
-      QString base64String;
-
-      if (content.startsWith("data:")) {
-        // Handle data URL format: data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAA...
-        int commaIndex = content.indexOf(',');
-        if (commaIndex != -1) {
-          base64String = content.mid(commaIndex + 1);
-          qDebug() << "GnomeClipboardServer: Extracted base64 from data URL";
-        } else {
-          qWarning() << "GnomeClipboardServer: Invalid data URL format for" << mimeType;
-          base64String = content; // Fallback to treating as plain base64
-        }
-      } else {
-        // Plain base64 data
-        base64String = content;
-        qDebug() << "GnomeClipboardServer: Processing plain base64 data";
-      }
+  ClipboardSelection selection;
+  ClipboardDataOffer offer;
 
-      QByteArray base64Content = base64String.toUtf8();
-      offer.data = QByteArray::fromBase64(base64Content);
-
-      if (offer.data.isEmpty() && !base64Content.isEmpty()) {
-        qWarning() << "GnomeClipboardServer: Failed to decode base64 data for" << mimeType;
-        qWarning() << "GnomeClipboardServer: First 100 chars:" << base64String.left(100);
-        // Fall back to treating as text
-        offer.data = base64Content;
-      } else {
-        qDebug() << "GnomeClipboardServer: Successfully decoded" << mimeType
-                 << "data, original size:" << base64Content.size() << "decoded size:" << offer.data.size()
-                 << "bytes";
-      }
-    } else {
-      // For text data, use as-is
-      offer.data = content.toUtf8();
-      qDebug() << "GnomeClipboardServer: Processing text data (" << mimeType
-               << "), size:" << offer.data.size() << "bytes";
-    }
+  offer.mimeType = mimeType;
 
-    selection.offers.push_back(offer);
-    selection.sourceApp = sourceApp.isEmpty() ? std::nullopt : std::optional<QString>(sourceApp);
-
-    // Handle additional common MIME types based on content type
-    if (contentType == "text" && mimeType == "text/plain") {
-      // For plain text, we might also want to offer text/html if it contains markup
-      // This is a simple heuristic - in practice, the extension should provide multiple offers
-      if (content.contains("<") && content.contains(">")) {
-        ClipboardDataOffer htmlOffer;
-        htmlOffer.mimeType = "text/html";
-        htmlOffer.data = content.toUtf8();
-        selection.offers.push_back(htmlOffer);
-      }
-    }
+  // decoding and transferring large contents is left to the ingestion worker, off the GUI thread
+  if (content.isEmpty() && size > 0 && m_supportsFdTransfer) {
+    offer.transfer = requestContent(mimeType);
+  } else {
+    offer.transfer = [content, mimeType]() { return decodeContent(content, mimeType); };
+  }
+
+  if (!offer.transfer) return;
 
-    // Emit the selection to the clipboard service
-    emit selectionAdded(selection);
+  selection.offers.push_back(offer);
+  selection.sourceApp = sourceApp.isEmpty() ? std::nullopt : std::optional<QString>(sourceApp);
 
-    qDebug() << "GnomeClipboardServer: Successfully processed clipboard change from" << sourceApp;
+  // Handle additional common MIME types based on content type
+  if (contentType == "text" && mimeType == "text/plain") {
+    // For plain text, we might also want to offer text/html if it contains markup
+    // This is a simple heuristic - in practice, the extension should provide multiple offers
+    if (content.contains("<") && content.contains(">")) {
+      ClipboardDataOffer htmlOffer;
+      htmlOffer.mimeType = "text/html";
+      htmlOffer.transfer = [content]() { return content.toUtf8(); };
+      selection.offers.push_back(htmlOffer);
+    }
+  }
 
-  } catch (const std::exception &e) {
-    qWarning() << "GnomeClipboardServer: Error processing clipboard change:" << e.what();
-  } catch (...) { qWarning() << "GnomeClipboardServer: Unknown error processing clipboard change"; }
+  emit selectionAdded(selection);
 }
 
 void GnomeClipboardServer::handleDBusDisconnection() {
@@ -14,11 +14,17 @@ private:
   QDBusInterface *m_interface = nullptr;
   QTimer *m_reconnectTimer = nullptr;
   bool m_isConnected = false;
+  bool m_supportsFdTransfer = false;
 
   // D-Bus interface details
   static constexpr const char *DBUS_SERVICE = "org.gnome.Shell";
   static constexpr const char *DBUS_PATH = "/org/gnome/Shell/Extensions/Clipboard";
   static constexpr const char *DBUS_INTERFACE = "org.gnome.Shell.Extensions.Clipboard";
+  // (s mimeType, h fd): write the content of the current selection for mimeType to fd, then close it
+  static constexpr const char *TRANSFER_METHOD = "WriteClipboardContent";
+  static constexpr const char *TRANSFER_METHOD_SIGNATURE =
+      "WriteClipboardContent(QString,QDBusUnixFileDescriptor)";
+  static constexpr int TRANSFER_TIMEOUT_MS = 5000;
 
   // Helper methods
   bool setupDBusConnection();
@@ -26,6 +32,14 @@ private:
   bool testExtensionAvailability() const;
   void attemptReconnection();
 
+  static QByteArray decodeContent(const QString &content, const QString &mimeType);
+
+  /**
+   * Ask the extension to write the content of the current selection for `mimeType` to a pipe, returning
+   * the function reading it, to be called from the ingestion worker. Null if no pipe could be created.
+   */
+  std::function<QByteArray()> requestContent(const QString &mimeType);
+
 private slots:
   void handleClipboardChanged(const QString &content, qulonglong timestamp, const QString &source,
                               const QString &mimeType, const QString &contentType, const QString &contentHash,
@@ -0,0 +1,148 @@
+#include "services/clipboard/secure-offer-cache.hpp"
+#include "memory-budget/memory-budget.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <openssl/crypto.h>
+#include <qlogging.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+std::optional<QByteArray> SecureOfferCache::get(const QString &offerId) {
+  auto it = m_entries.find(offerId);
+
+  if (it == m_entries.end()) return std::nullopt;
+
+  auto &entry = it->second;
+
+  entry.lastUse = Clock::now();
+  m_uses.splice(m_uses.begin(), m_uses, entry.use);
+
+  return QByteArray(static_cast<const char *>(entry.memory), entry.size);
+}
+
+void SecureOfferCache::insert(const QString &selectionId, const QString &offerId, const QByteArray &data) {
+  size_t size = data.size();
+
+  if (size == 0 || size > m_budget) return;
+
+  if (auto it = m_entries.find(offerId); it != m_entries.end()) { erase(it); }
+
+  while (m_size + size > m_budget && !m_uses.empty()) {
+    erase(m_entries.find(m_uses.back()));
+  }
+
+  size_t mappedSize = 0;
+  void *memory = allocate(size, mappedSize);
+
+  if (!memory) return;
+
+  memcpy(memory, data.constData(), size);
+  m_uses.push_front(offerId);
+  m_entries[offerId] = Entry{.selectionId = selectionId,
+                             .memory = memory,
+                             .mappedSize = mappedSize,
+                             .size = size,
+                             .lastUse = Clock::now(),
+                             .use = m_uses.begin()};
+  m_size += size;
+  scheduleExpiry();
+}
+
+void SecureOfferCache::removeSelection(const QString &selectionId) {
+  for (auto it = m_entries.begin(); it != m_entries.end();) {
+    it = it->second.selectionId == selectionId ? erase(it) : std::next(it);
+  }
+
+  scheduleExpiry();
+}
+
+void SecureOfferCache::clear() {
+  for (auto &[id, entry] : m_entries) {
+    release(entry);
+  }
+
+  m_entries.clear();
+  m_uses.clear();
+  m_size = 0;
+  m_expiryTimer->stop();
+}
+
+void *SecureOfferCache::allocate(size_t size, size_t &mappedSize) {
+  static const size_t pageSize = sysconf(_SC_PAGESIZE);
+
+  mappedSize = (size + pageSize - 1) / pageSize * pageSize;
+
+  void *memory = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+  if (memory == MAP_FAILED) return nullptr;
+
+  if (mlock(memory, mappedSize) != 0) {
+    if (!m_lockFailureLogged) {
+      qDebug() << "SecureOfferCache: failed to lock memory, decrypted offers are not cached:"
+               << strerror(errno);
+      m_lockFailureLogged = true;
+    }
+
+    munmap(memory, mappedSize);
+    return nullptr;
+  }
+
+#ifdef MADV_DONTDUMP
+  madvise(memory, mappedSize, MADV_DONTDUMP);
+#endif
+
+  return memory;
+}
+
+void SecureOfferCache::release(Entry &entry) {
+  OPENSSL_cleanse(entry.memory, entry.mappedSize);
+  munlock(entry.memory, entry.mappedSize);
+  munmap(entry.memory, entry.mappedSize);
+  entry.memory = nullptr;
+}
+
+SecureOfferCache::EntryMap::iterator SecureOfferCache::erase(EntryMap::iterator it) {
+  auto &entry = it->second;
+
+  release(entry);
+  m_size -= entry.size;
+  m_uses.erase(entry.use);
+
+  return m_entries.erase(it);
+}
+
+void SecureOfferCache::evictExpired() {
+  auto now = Clock::now();
+
+  // the least recently used offers expire first
+  while (!m_uses.empty()) {
+    auto it = m_entries.find(m_uses.back());
+
+    if (now - it->second.lastUse < TTL) break;
+
+    erase(it);
+  }
+
+  scheduleExpiry();
+}
+
+void SecureOfferCache::scheduleExpiry() {
+  if (m_uses.empty()) {
+    m_expiryTimer->stop();
+    return;
+  }
+
+  auto expiresAt = m_entries.find(m_uses.back())->second.lastUse + TTL;
+  auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(expiresAt - Clock::now());
+
+  m_expiryTimer->start(std::max(delay, std::chrono::milliseconds(0)));
+}
+
+SecureOfferCache::SecureOfferCache(size_t budget, QObject *parent) : QObject(parent), m_budget(budget) {
+  m_expiryTimer->setSingleShot(true);
+  connect(m_expiryTimer, &QTimer::timeout, this, &SecureOfferCache::evictExpired);
+  connect(&MemoryBudget::instance(), &MemoryBudget::idle, this, &SecureOfferCache::clear);
+}
+
+SecureOfferCache::~SecureOfferCache() { clear(); }
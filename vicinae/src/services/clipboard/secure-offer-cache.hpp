@@ -0,0 +1,77 @@
+#pragma once
+#include <QByteArray>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <chrono>
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+/**
+ * Decrypted data of the clipboard offers that were recently read, so that going back and forth in the
+ * history does not decrypt the same offers over and over.
+ *
+ * Plaintext is only ever kept in memory locked with `mlock`, excluded from core dumps, and it is wiped
+ * before being released: when an offer is evicted to stay within `budget`, when it was not used for `TTL`,
+ * when the selection it belongs to is removed, or when the launcher has been hidden for a while. Offers that
+ * can't be locked, usually because of `RLIMIT_MEMLOCK`, are simply not cached.
+ *
+ * To be used from the GUI thread only.
+ */
+class SecureOfferCache : public QObject {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  // well below the default RLIMIT_MEMLOCK of 8MB
+  static constexpr size_t DEFAULT_BUDGET = 4 * 1024 * 1024;
+  static constexpr auto TTL = std::chrono::seconds(60);
+
+  /**
+   * A copy of the data of `offerId`, if it is cached.
+   */
+  std::optional<QByteArray> get(const QString &offerId);
+
+  /**
+   * Cache `data` as the data of `offerId`, which belongs to `selectionId`. Offers larger than the budget are
+   * not cached.
+   */
+  void insert(const QString &selectionId, const QString &offerId, const QByteArray &data);
+
+  void removeSelection(const QString &selectionId);
+  void clear();
+
+  size_t size() const { return m_size; }
+
+  SecureOfferCache(size_t budget = DEFAULT_BUDGET, QObject *parent = nullptr);
+  ~SecureOfferCache() override;
+
+private:
+  struct Entry {
+    QString selectionId;
+    void *memory = nullptr;
+    size_t mappedSize = 0;
+    size_t size = 0;
+    Clock::time_point lastUse;
+    std::list<QString>::iterator use;
+  };
+
+  using EntryMap = std::unordered_map<QString, Entry>;
+
+  /**
+   * Locked memory of at least `size` bytes, or nullptr if it can't be locked.
+   */
+  void *allocate(size_t size, size_t &mappedSize);
+  static void release(Entry &entry);
+  EntryMap::iterator erase(EntryMap::iterator it);
+  void evictExpired();
+  void scheduleExpiry();
+
+  size_t m_budget;
+  size_t m_size = 0;
+  EntryMap m_entries;
+  // most recently used first
+  std::list<QString> m_uses;
+  QTimer *m_expiryTimer = new QTimer(this);
+  bool m_lockFailureLogged = false;
+};
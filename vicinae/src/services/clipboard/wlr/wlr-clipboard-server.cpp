@@ -6,8 +6,12 @@
 #include "vicinae.hpp"
 #include <QtCore>
 #include <QApplication>
+#include <fcntl.h>
 #include <filesystem>
-#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <qlogging.h>
 #include <qprocess.h>
 #include <qdebug.h>
@@ -28,13 +32,92 @@ bool WlrClipboardServer::isActivatable() const {
   return true;
 }
 
-void WlrClipboardServer::handleMessage(const proto::ext::wlrclip::Selection &sel) {
+namespace {
+
+/**
+ * Read only mapping of the data of an offer.
+ */
+class SharedOfferData {
+  void *m_data = nullptr;
+  size_t m_size = 0;
+
+public:
+  /**
+   * Map `fd`, which has to be sealed against writes and shrinking: otherwise the sender could change the
+   * data after it is hashed, or truncate the file and crash us on access.
+   */
+  static std::shared_ptr<SharedOfferData> map(int fd) {
+    int seals = fcntl(fd, F_GET_SEALS);
+    int requiredSeals = F_SEAL_SHRINK | F_SEAL_WRITE;
+
+    if (seals == -1 || (seals & requiredSeals) != requiredSeals) {
+      qWarning() << "Ignoring clipboard offer: data is not sealed";
+      return nullptr;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) == -1) {
+      qWarning() << "Failed to stat clipboard offer data:" << strerror(errno);
+      return nullptr;
+    }
+
+    auto data = std::make_shared<SharedOfferData>();
+
+    if (st.st_size == 0) return data;
+
+    void *ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (ptr == MAP_FAILED) {
+      qWarning() << "Failed to map clipboard offer data:" << strerror(errno);
+      return nullptr;
+    }
+
+    data->m_data = ptr;
+    data->m_size = st.st_size;
+
+    return data;
+  }
+
+  QByteArray view() const { return QByteArray::fromRawData(static_cast<const char *>(m_data), m_size); }
+
+  ~SharedOfferData() {
+    if (m_data) munmap(m_data, m_size);
+  }
+};
+
+} // namespace
+
+void WlrClipboardServer::handleMessage(const proto::ext::wlrclip::Selection &sel,
+                                       const std::vector<int> &fds) {
   ClipboardSelection cs;
 
   cs.offers.reserve(sel.offers().size());
 
-  for (const auto &offer : sel.offers()) {
-    cs.offers.push_back({offer.mime_type().c_str(), QByteArray::fromStdString(offer.data())});
+  if (sel.coalesced_selections() != m_coalescedSelections ||
+      sel.dropped_selections() != m_droppedSelections) {
+    m_coalescedSelections = sel.coalesced_selections();
+    m_droppedSelections = sel.dropped_selections();
+    qDebug() << "wlr-clip coalesced" << m_coalescedSelections << "selections and dropped"
+             << m_droppedSelections << "while they were being read";
+  }
+
+  for (const auto &skipped : sel.skipped()) {
+    qDebug() << "Clipboard offer" << skipped.mime_type().c_str() << "was skipped by wlr-clip:"
+             << proto::ext::wlrclip::SkipReason_Name(skipped.reason()).c_str();
+  }
+
+  for (int i = 0; i < sel.offers().size(); ++i) {
+    auto data = SharedOfferData::map(fds[i]);
+
+    if (!data) continue;
+    if (sel.offers(i).truncated()) {
+      qWarning() << "Clipboard offer" << sel.offers(i).mime_type().c_str() << "was truncated to"
+                 << data->view().size() << "bytes";
+    }
+
+    cs.offers.push_back(
+        {.mimeType = sel.offers(i).mime_type().c_str(), .data = data->view(), .storage = std::move(data)});
   }
 
   emit selectionAdded(cs);
@@ -55,9 +138,23 @@ bool WlrClipboardServer::start() {
 
   if (pidFile.exists() && pidFile.kill()) { qInfo() << "Killed existing wlr-clip instance"; }
 
-  process = new QProcess;
+  int fds[2];
+
+  // message boundaries are preserved, each message being a selection
+  if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds) == -1) {
+    qCritical() << "Failed to create wlr-clip socket:" << strerror(errno);
+    return false;
+  }
 
-  process->start(WLR_CLIP_BIN, {});
+  int childSocket = fds[1];
+
+  m_socket = fds[0];
+  process = new QProcess;
+  // only the child end is inherited, the rest of our file descriptors being close on exec
+  process->setChildProcessModifier([childSocket]() { fcntl(childSocket, F_SETFD, 0); });
+  process->start(WLR_CLIP_BIN, {"--socket-fd", QString::number(childSocket), "--coalesce-ms",
+                                QString::number(COALESCE_WINDOW_MS)});
+  close(childSocket);
 
   if (!process->waitForStarted(maxWaitForStart)) {
     qCritical() << "Failed to start:" << WLR_CLIP_BIN << process->errorString();
@@ -66,7 +163,9 @@ bool WlrClipboardServer::start() {
 
   pidFile.write(process->processId());
 
-  connect(process, &QProcess::readyReadStandardOutput, this, &WlrClipboardServer::handleRead);
+  m_messageBuffer.resize(MAX_MESSAGE_SIZE);
+  m_notifier = new QSocketNotifier(m_socket, QSocketNotifier::Read, this);
+  connect(m_notifier, &QSocketNotifier::activated, this, &WlrClipboardServer::handleRead);
   connect(process, &QProcess::readyReadStandardError, this, &WlrClipboardServer::handleReadError);
   connect(process, &QProcess::finished, this, &WlrClipboardServer::handleExit);
 
@@ -76,29 +175,61 @@ bool WlrClipboardServer::start() {
 void WlrClipboardServer::handleReadError() { QTextStream(stderr) << process->readAllStandardError(); }
 
 void WlrClipboardServer::handleRead() {
-  auto array = process->readAllStandardOutput();
-  auto _buf = array.constData();
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * MAX_SHARED_OFFERS)];
+  iovec iov{.iov_base = m_messageBuffer.data(), .iov_len = m_messageBuffer.size()};
+  msghdr msg{};
+
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
 
-  _message.insert(_message.end(), _buf, _buf + array.size());
+  ssize_t size = recvmsg(m_socket, &msg, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
 
-  if (_messageLength == 0 && _message.size() > sizeof(uint32_t)) {
-    _messageLength = ntohl(*reinterpret_cast<uint32_t *>(_message.data()));
-    _message.erase(_message.begin(), _message.begin() + sizeof(uint32_t));
+  if (size == -1) {
+    if (errno != EAGAIN && errno != EINTR) qWarning() << "Failed to read from wlr-clip:" << strerror(errno);
+    return;
   }
 
-  if (_message.size() >= _messageLength) {
-    std::string data(_message.begin(), _message.begin() + _messageLength);
-    proto::ext::wlrclip::Selection selection;
+  if (size == 0) {
+    qWarning() << "wlr-clip closed its socket";
+    m_notifier->setEnabled(false);
+    return;
+  }
 
-    if (!selection.ParseFromString(data)) {
-      qWarning() << "Failed to parse selection";
-    } else {
-      handleMessage(selection);
-    }
+  std::vector<int> fds;
+
+  for (cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) continue;
+
+    size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    size_t offset = fds.size();
+
+    fds.resize(offset + count);
+    memcpy(fds.data() + offset, CMSG_DATA(cmsg), count * sizeof(int));
+  }
+
+  proto::ext::wlrclip::Selection selection;
+
+  if (msg.msg_flags & (MSG_TRUNC | MSG_CTRUNC)) {
+    qWarning() << "Ignoring truncated selection";
+  } else if (!selection.ParseFromArray(m_messageBuffer.data(), size)) {
+    qWarning() << "Failed to parse selection";
+  } else if (selection.offers().size() != static_cast<int>(fds.size())) {
+    qWarning() << "Ignoring selection: got" << fds.size() << "file descriptors for"
+               << selection.offers().size() << "offers";
+  } else {
+    handleMessage(selection, fds);
+  }
 
-    _message.erase(_message.begin(), _message.begin() + _messageLength);
-    _messageLength = 0;
+  // mappings remain valid after the file descriptors are closed
+  for (int fd : fds) {
+    close(fd);
   }
 }
 
+WlrClipboardServer::~WlrClipboardServer() {
+  if (m_socket != -1) close(m_socket);
+}
+
 WlrClipboardServer::WlrClipboardServer() {}
@@ -2,15 +2,31 @@
 #include "proto/wlr-clipboard.pb.h"
 #include "services/clipboard/clipboard-server.hpp"
 #include <qprocess.h>
+#include <qsocketnotifier.h>
 
+/**
+ * Receives selections from the wlr-clip process over a unix socket. The data of every offer is passed as a
+ * sealed memfd, which gets mapped in place of being read: large selections (screenshots...) are hashed and
+ * stored without ever being copied.
+ */
 class WlrClipboardServer : public AbstractClipboardServer {
-  std::vector<uint8_t> _message;
-  uint32_t _messageLength = 0;
+  // maximum number of file descriptors that can be passed in a single message (SCM_MAX_FD)
+  static constexpr size_t MAX_SHARED_OFFERS = 253;
+  // only offer metadata goes through the socket
+  static constexpr size_t MAX_MESSAGE_SIZE = 1 << 16;
+  // selections replaced within this window of each other are only read once, by wlr-clip
+  static constexpr int COALESCE_WINDOW_MS = 50;
+
   QProcess *process = nullptr;
+  int m_socket = -1;
+  QSocketNotifier *m_notifier = nullptr;
+  std::vector<char> m_messageBuffer;
+  uint64_t m_coalescedSelections = 0;
+  uint64_t m_droppedSelections = 0;
 
   bool isAlive() const override;
 
-  void handleMessage(const proto::ext::wlrclip::Selection &selection);
+  void handleMessage(const proto::ext::wlrclip::Selection &selection, const std::vector<int> &fds);
   void handleRead();
   void handleReadError();
   void handleExit(int code, QProcess::ExitStatus status);
@@ -22,4 +38,5 @@ public:
   int activationPriority() const override;
 
   WlrClipboardServer();
+  ~WlrClipboardServer() override;
 };
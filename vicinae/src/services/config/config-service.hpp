@@ -23,39 +23,93 @@ public:
   struct Value {
     QString faviconService = Omnicast::DEFAULT_FAVICON_SERVICE;
     bool popToRootOnClose = false;
-    struct {
+    struct Theme {
       std::optional<QString> name;
       std::optional<QString> iconTheme;
+      bool operator==(const Theme &) const = default;
     } theme;
-    struct {
+    struct Window {
       int rounding = 10;
       double opacity = 0.95;
       bool csd = true;
+      bool operator==(const Window &) const = default;
     } window;
-    struct {
-      bool searchFiles;
+    struct RootSearch {
+      bool searchFiles = true;
+      bool operator==(const RootSearch &) const = default;
     } rootSearch;
-    struct {
+    struct Font {
       std::optional<QString> normal;
       double baseSize = 10.0;
+      bool operator==(const Font &) const = default;
     } font;
+    // budgets the caches are trimmed down to once the window has been hidden for `trimDelay` seconds,
+    // negative ones are never trimmed
+    struct Memory {
+      int trimDelay = 60;
+      int imageCacheBudget = 16;    // MB
+      int faviconCacheBudget = 2;   // MB
+      int listWidgetPoolBudget = 0; // widgets
+      // close the views left open when the window was hidden, releasing what the commands shown in them hold
+      bool popToRootWhenIdle = true;
+      bool operator==(const Memory &) const = default;
+    } memory;
   };
 
+  /**
+   * Sections of the config, for subscribers to only act on the ones they depend on.
+   */
+  enum Section {
+    // settings that are not part of a section, such as the favicon service
+    GeneralSection = 1 << 0,
+    ThemeSection = 1 << 1,
+    WindowSection = 1 << 2,
+    RootSearchSection = 1 << 3,
+    FontSection = 1 << 4,
+    MemorySection = 1 << 5,
+    AllSections = (1 << 6) - 1,
+  };
+  Q_DECLARE_FLAGS(Sections, Section)
+
+  static Sections diff(const Value &next, const Value &prev) {
+    Sections changed;
+
+    changed.setFlag(GeneralSection, next.faviconService != prev.faviconService ||
+                                        next.popToRootOnClose != prev.popToRootOnClose);
+    changed.setFlag(ThemeSection, next.theme != prev.theme);
+    changed.setFlag(WindowSection, next.window != prev.window);
+    changed.setFlag(RootSearchSection, next.rootSearch != prev.rootSearch);
+    changed.setFlag(FontSection, next.font != prev.font);
+    changed.setFlag(MemorySection, next.memory != prev.memory);
+
+    return changed;
+  }
+
+  // editors tend to save with several writes in a row, only the last one gets reloaded
+  static constexpr int RELOAD_DEBOUNCE_MS = 100;
+
 private:
   QFileSystemWatcher m_watcher;
   Value m_config;
   std::filesystem::path m_configFile = Omnicast::configDir() / "vicinae.json";
+  QTimer *m_reloadTimer = new QTimer(this);
+  // content of the file when it was last loaded, saves parsing it again if a write did not change it
+  QByteArray m_loadedContent;
 
-  QJsonObject loadAsJson() const {
+  QByteArray readFile() const {
     QFile file(m_configFile);
 
     if (!file.open(QIODevice::ReadOnly)) { return {}; }
 
-    return QJsonDocument::fromJson(file.readAll()).object();
+    return file.readAll();
+  }
+
+  Value load() {
+    m_loadedContent = readFile();
+    return parse(QJsonDocument::fromJson(m_loadedContent).object());
   }
 
-  Value load() const {
-    QJsonObject obj = loadAsJson();
+  static Value parse(const QJsonObject &obj) {
     Value cfg;
 
     cfg.faviconService = obj.value("faviconService").toString("google");
@@ -90,19 +144,42 @@ private:
       cfg.window.csd = window.value("csd").toBool(true);
     }
 
+    {
+      auto memory = obj.value("memory").toObject();
+
+      cfg.memory.trimDelay = memory.value("trimDelay").toInt(60);
+      cfg.memory.imageCacheBudget = memory.value("imageCacheBudget").toInt(16);
+      cfg.memory.faviconCacheBudget = memory.value("faviconCacheBudget").toInt(2);
+      cfg.memory.listWidgetPoolBudget = memory.value("listWidgetPoolBudget").toInt(0);
+      cfg.memory.popToRootWhenIdle = memory.value("popToRootWhenIdle").toBool(true);
+    }
+
     return cfg;
   }
 
-  void handleDirectoryChanged(const QString &path) {}
+  void handleDirectoryChanged(const QString &path) {
+    // editors saving by replacing the file get it unwatched, it is watched again once it is back
+    if (!m_watcher.files().contains(m_configFile.c_str()) && std::filesystem::exists(m_configFile)) {
+      m_watcher.addPath(m_configFile.c_str());
+      m_reloadTimer->start();
+    }
+  }
 
   void handleFileChanged(const QString &path) {
     if (path != m_configFile.c_str()) return;
 
+    if (std::filesystem::exists(m_configFile)) { m_watcher.addPath(path); }
+    m_reloadTimer->start();
+  }
+
+  void reloadFromDisk() {
+    if (readFile() == m_loadedContent) return;
+
     auto prev = m_config;
 
     m_config = load();
-    emit configChanged(m_config, prev);
-    m_watcher.addPath(path);
+
+    if (auto changed = diff(m_config, prev)) { emit configChanged(m_config, prev, changed); }
   }
 
 public:
@@ -113,7 +190,9 @@ public:
   /**
    * Simulates a config change without persisting it, useful for live previewing config changes.
    */
-  void previewConfig(const Value &config) { emit configChanged(config, m_config); }
+  void previewConfig(const Value &config) {
+    if (auto changed = diff(config, m_config)) { emit configChanged(config, m_config, changed); }
+  }
 
   void updatePreviewConfig(const std::function<void(Value &value)> &updater) {
     Value newValue = m_config;
@@ -170,15 +249,30 @@ public:
       obj["window"] = window;
     }
 
+    {
+      QJsonObject memory;
+
+      memory["trimDelay"] = value.memory.trimDelay;
+      memory["imageCacheBudget"] = value.memory.imageCacheBudget;
+      memory["faviconCacheBudget"] = value.memory.faviconCacheBudget;
+      memory["listWidgetPoolBudget"] = value.memory.listWidgetPoolBudget;
+      memory["popToRootWhenIdle"] = value.memory.popToRootWhenIdle;
+      obj["memory"] = memory;
+    }
+
     QFile file(m_configFile);
 
     if (!file.open(QIODevice::WriteOnly)) { return; }
 
     doc.setObject(obj);
-    file.write(doc.toJson());
+    m_loadedContent = doc.toJson();
+    file.write(m_loadedContent);
+
+    auto changed = diff(value, m_config);
+    auto prev = m_config;
 
-    emit configChanged(value, m_config);
     m_config = value;
+    if (changed) { emit configChanged(value, prev, changed); }
   }
 
   ConfigService() {
@@ -203,9 +297,19 @@ public:
     connect(&m_watcher, &QFileSystemWatcher::directoryChanged, this, &ConfigService::handleDirectoryChanged);
     connect(&m_watcher, &QFileSystemWatcher::fileChanged, this, &ConfigService::handleFileChanged);
 
-    QTimer::singleShot(0, [this]() { emit configChanged(m_config, {}); });
+    m_reloadTimer->setSingleShot(true);
+    m_reloadTimer->setInterval(RELOAD_DEBOUNCE_MS);
+    connect(m_reloadTimer, &QTimer::timeout, this, &ConfigService::reloadFromDisk);
+
+    QTimer::singleShot(0, [this]() { emit configChanged(m_config, {}, AllSections); });
   }
 
 signals:
-  void configChanged(const Value &next, const Value &prev) const;
+  /**
+   * Only emitted if something changed, `changed` being the sections that did. Every section is flagged for
+   * the initial emission, for subscribers to apply the whole config once.
+   */
+  void configChanged(const Value &next, const Value &prev, ConfigService::Sections changed) const;
 };
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(ConfigService::Sections)
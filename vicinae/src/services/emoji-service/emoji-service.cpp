@@ -1,32 +1,115 @@
 #include "emoji-service.hpp"
 #include "omni-database.hpp"
 #include "services/emoji-service/emoji.hpp"
+#include <algorithm>
+#include <bitset>
 #include <cstdlib>
 #include <qcontainerfwd.h>
 #include <qlogging.h>
 #include "utils/utils.hpp"
+#include "lib/text-tokenizer.hpp"
+#include "memory-budget/memory-budget.hpp"
+#include "search-profiler/search-profiler.hpp"
+#include "startup-benchmark.hpp"
+#include "sql-profiler/sql-profiler.hpp"
 #include <qsqlquery.h>
 
 void EmojiService::buildIndex() {
-  std::unordered_map<std::string_view, QString> keywordMap;
+  StartupBenchmark::Scope benchmark("emoji-index");
 
-  for (const auto &visited : getVisited()) {
-    if (!visited.keywords.isEmpty()) { keywordMap.insert({visited.data->emoji, visited.keywords}); }
+  for (const auto &[data, metadata] : m_metadata) {
+    if (!metadata.keywords.isEmpty()) { m_customIndex.indexLatinText(metadata.keywords.toStdString(), data); }
   }
+}
 
-  for (const auto &emoji : StaticEmojiDatabase::orderedList()) {
-    if (auto it = keywordMap.find(emoji.emoji); it != keywordMap.end()) {
-      m_index.indexLatinText(it->second.toStdString(), &emoji);
-    }
+void EmojiService::loadMetadata() {
+  QSqlQuery query = m_db.createQuery();
+
+  bool ok = SqlProfiler::exec(query, R"(
+	SELECT emoji, visit_count, pinned_at, last_visited_at, custom_keywords FROM visited_emoji
+  )");
+
+  if (!ok) {
+    qCritical() << "Failed to load emoji metadata" << query.lastError();
+    return;
+  }
+
+  auto toDateTime = [](const QVariant &value) -> std::optional<QDateTime> {
+    if (value.isNull()) return std::nullopt;
+    return QDateTime::fromSecsSinceEpoch(value.toLongLong());
+  };
+
+  m_metadata.clear();
+
+  while (query.next()) {
+    auto emoji = query.value(0).toString();
+    auto data = findEmoji(emoji.toStdString());
 
-    for (const auto &keyword : emoji.keywords) {
-      m_index.indexLatinText(keyword, &emoji);
+    if (!data) {
+      qWarning() << "Emoji is not in the mapping" << emoji;
+      continue;
     }
+
+    m_metadata[data] = Metadata{.visitCount = query.value(1).toUInt(),
+                                .pinnedAt = toDateTime(query.value(2)),
+                                .lastVisitedAt = toDateTime(query.value(3)),
+                                .keywords = query.value(4).toString()};
   }
 }
 
+const EmojiData *EmojiService::findEmoji(std::string_view emoji) {
+  const auto &mapping = StaticEmojiDatabase::mapping();
+
+  if (auto it = mapping.find(emoji); it != mapping.end()) return it->second;
+
+  return nullptr;
+}
+
+EmojiWithMetadata EmojiService::withMetadata(const EmojiData *data) const {
+  auto it = m_metadata.find(data);
+
+  if (it == m_metadata.end()) return {.data = data};
+
+  const auto &metadata = it->second;
+
+  return {.data = data,
+          .visitCount = metadata.visitCount,
+          .pinnedAt = metadata.pinnedAt,
+          .keywords = metadata.keywords};
+}
+
 std::vector<const EmojiData *> EmojiService::search(std::string_view query) const {
-  return m_index.prefixSearch(query);
+  SearchProfiler::Scope profile("emoji");
+  const auto &list = StaticEmojiDatabase::orderedList();
+  std::string prefix = TextTokenizer::normalize(query);
+  std::vector<const EmojiData *> results = m_customIndex.prefixSearch(prefix, SEARCH_LIMIT);
+  std::bitset<std::tuple_size_v<std::decay_t<decltype(list)>>> seen;
+
+  for (const auto *data : results) {
+    seen.set(data - list.data());
+  }
+
+  auto tokens = StaticEmojiDatabase::searchTokens();
+  auto postings = StaticEmojiDatabase::searchPostings();
+  auto it = std::ranges::lower_bound(tokens, std::string_view(prefix), {}, &EmojiSearchToken::token);
+
+  for (; it != tokens.end() && it->token.starts_with(prefix); ++it) {
+    for (uint16_t idx : postings.subspan(it->postingOffset, it->postingCount)) {
+      if (seen.test(idx)) continue;
+
+      seen.set(idx);
+      results.emplace_back(&list[idx]);
+
+      if (results.size() >= SEARCH_LIMIT) {
+        profile.setResultCount(results.size());
+        return results;
+      }
+    }
+  }
+
+  profile.setResultCount(results.size());
+
+  return results;
 }
 
 void EmojiService::createDbEntry(std::string_view emoji) {
@@ -35,25 +118,29 @@ void EmojiService::createDbEntry(std::string_view emoji) {
   query.prepare("INSERT INTO visited_emoji (emoji) VALUES (:emoji) ON CONFLICT(emoji) DO NOTHING");
   query.addBindValue(QString::fromUtf8(emoji.data(), emoji.size()));
 
-  if (!query.exec()) { qCritical() << "Failed to create database entry for emoji" << query.lastError(); }
+  if (!SqlProfiler::exec(query)) {
+    qCritical() << "Failed to create database entry for emoji" << query.lastError();
+  }
 }
 
 bool EmojiService::registerVisit(std::string_view emoji) {
-  QSqlQuery query = m_db.createQuery();
-
-  query.prepare(R"(
+  static const QString sql = R"(
   	INSERT INTO visited_emoji (emoji, visit_count, last_visited_at)
-	VALUES (:emoji, 1, (unixepoch()))
+	VALUES (?, 1, (unixepoch()))
 	ON CONFLICT(emoji) DO UPDATE 
 	SET 
 		visit_count = visit_count + 1, 
 		last_visited_at = unixepoch()
-	)");
-  query.addBindValue(QString::fromUtf8(emoji.data(), emoji.size()));
+	)";
 
-  if (!query.exec()) {
-    qCritical() << "Failed to register visit for emoji" << emoji << query.lastError();
-    return false;
+  // visits are only read back at startup, by which point deferred writes are flushed
+  m_db.deferWrite(sql, {QString::fromUtf8(emoji.data(), emoji.size())});
+
+  if (auto data = findEmoji(emoji)) {
+    auto &metadata = m_metadata[data];
+
+    metadata.visitCount += 1;
+    metadata.lastVisitedAt = QDateTime::fromSecsSinceEpoch(QDateTime::currentSecsSinceEpoch());
   }
 
   emit visited(emoji);
@@ -61,115 +148,62 @@ bool EmojiService::registerVisit(std::string_view emoji) {
   return true;
 }
 
-std::vector<std::pair<std::string_view, std::vector<const EmojiData *>>> EmojiService::grouped() {
-  std::unordered_map<std::string_view, std::vector<const EmojiData *>> map;
-
-  for (const auto &emoji : StaticEmojiDatabase::orderedList()) {
-    map[emoji.group].emplace_back(&emoji);
-  }
-
-  std::vector<std::pair<std::string_view, std::vector<const EmojiData *>>> grouped;
-  auto &groups = StaticEmojiDatabase::groups();
-
-  grouped.reserve(groups.size());
-
-  for (auto group : groups) {
-    grouped.push_back({group, std::move(map[group])});
-  }
-
-  return grouped;
-}
+std::span<const EmojiGroup> EmojiService::grouped() const { return StaticEmojiDatabase::groupedList(); }
 
 std::vector<EmojiWithMetadata> EmojiService::getVisited() const {
-  QSqlQuery query = m_db.createQuery();
+  // same order as `ORDER BY pinned_at DESC, visit_count DESC, last_visited_at DESC` would give
+  auto isBefore = [](const std::optional<QDateTime> &lhs, const std::optional<QDateTime> &rhs) {
+    return lhs && (!rhs || *lhs > *rhs);
+  };
+  std::vector<std::pair<const EmojiData *, const Metadata *>> entries;
 
-  bool ok = query.exec(R"(
-	SELECT emoji, visit_count, pinned_at, custom_keywords FROM visited_emoji ORDER BY pinned_at DESC, visit_count DESC, last_visited_at DESC
-  )");
+  entries.reserve(m_metadata.size());
 
-  if (!ok) {
-    qCritical() << "Failed to getVisited()" << query.lastError();
-    return {};
+  for (const auto &[data, metadata] : m_metadata) {
+    entries.emplace_back(data, &metadata);
   }
 
-  std::vector<EmojiWithMetadata> results;
-  const auto &mapping = StaticEmojiDatabase::mapping();
+  std::ranges::sort(entries, [&](const auto &lhs, const auto &rhs) {
+    auto &a = *lhs.second;
+    auto &b = *rhs.second;
 
-  while (query.next()) {
-    EmojiWithMetadata result;
-    auto emoji = query.value(0).toString();
-    auto it = mapping.find(emoji.toStdString());
+    if (a.pinnedAt != b.pinnedAt) return isBefore(a.pinnedAt, b.pinnedAt);
+    if (a.visitCount != b.visitCount) return a.visitCount > b.visitCount;
+    if (a.lastVisitedAt != b.lastVisitedAt) return isBefore(a.lastVisitedAt, b.lastVisitedAt);
 
-    if (it == mapping.end()) {
-      qWarning() << "Emoji is not in the mapping" << emoji;
-      continue;
-    }
+    return lhs.first < rhs.first;
+  });
 
-    result.data = it->second;
-    result.visitCount = query.value(1).toUInt();
-    result.keywords = query.value(3).toString();
+  std::vector<EmojiWithMetadata> results;
 
-    if (auto value = query.value(2); !value.isNull()) {
-      result.pinnedAt = QDateTime::fromSecsSinceEpoch(value.toULongLong());
-    }
+  results.reserve(entries.size());
 
-    results.emplace_back(result);
+  for (const auto &[data, metadata] : entries) {
+    results.emplace_back(EmojiWithMetadata{.data = data,
+                                           .visitCount = metadata->visitCount,
+                                           .pinnedAt = metadata->pinnedAt,
+                                           .keywords = metadata->keywords});
   }
 
   return results;
 }
 
 std::vector<EmojiWithMetadata> EmojiService::mapMetadata(const std::vector<const EmojiData *> &items) {
-  if (items.empty()) return {};
-
-  std::unordered_map<std::string_view, EmojiWithMetadata> visitMap;
-
-  for (const auto &visited : getVisited()) {
-    visitMap.insert({visited.data->emoji, visited});
-  }
-
   std::vector<EmojiWithMetadata> metadatas;
 
   metadatas.reserve(items.size());
 
   for (const auto &item : items) {
-    if (auto it = visitMap.find(item->emoji); it != visitMap.end()) {
-      metadatas.emplace_back(it->second);
-    } else {
-      metadatas.emplace_back(EmojiWithMetadata{.data = item});
-    }
+    metadatas.emplace_back(withMetadata(item));
   }
 
   return metadatas;
 }
 
 EmojiWithMetadata EmojiService::mapMetadata(std::string_view emoji) {
-  QSqlQuery query = m_db.createQuery();
-  auto it = StaticEmojiDatabase::mapping().find(emoji);
-
-  if (it == StaticEmojiDatabase::mapping().end()) { return {}; }
-
-  query.prepare("SELECT visit_count, pinned_at, custom_keywords FROM visited_emoji WHERE emoji = :emoji");
-  query.addBindValue(qStringFromStdView(emoji));
-
-  if (!query.exec()) {
-    qCritical() << "Failed to map metadata for" << emoji << query.lastError();
-    return {.data = it->second};
-  }
-
-  if (!query.next()) { return EmojiWithMetadata{.data = it->second}; }
-
-  EmojiWithMetadata result;
-
-  result.data = it->second;
-  result.visitCount = query.value(0).toUInt();
-  result.keywords = query.value(2).toString();
+  if (auto data = findEmoji(emoji)) return withMetadata(data);
 
-  if (auto value = query.value(1); !value.isNull()) {
-    result.pinnedAt = QDateTime::fromSecsSinceEpoch(value.toULongLong());
-  }
-
-  return result;
+  return {};
 }
 
 bool EmojiService::setCustomKeywords(std::string_view emoji, const QString &keywords) {
@@ -182,18 +216,22 @@ bool EmojiService::setCustomKeywords(std::string_view emoji, const QString &keyw
   query.addBindValue(keywords);
   query.addBindValue(qStringFromStdView(emoji));
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to setCustomKeywords for emoji" << emoji << query.lastError();
     return false;
   }
 
+  if (!oldMetadata.data) return true;
+
+  m_metadata[oldMetadata.data].keywords = keywords;
+
   // hot reload index
 
-  if (oldMetadata.data && !oldMetadata.keywords.isEmpty()) {
-    m_index.removeLatinTextItem(oldMetadata.keywords.toStdString(), oldMetadata.data);
+  if (!oldMetadata.keywords.isEmpty()) {
+    m_customIndex.removeLatinTextItem(oldMetadata.keywords.toStdString(), oldMetadata.data);
   }
 
-  m_index.indexLatinText(keywords.toStdString(), oldMetadata.data);
+  m_customIndex.indexLatinText(keywords.toStdString(), oldMetadata.data);
 
   return true;
 }
@@ -206,11 +244,18 @@ bool EmojiService::resetRanking(std::string_view emoji) {
   query.prepare("UPDATE visited_emoji SET visit_count = 0, last_visited_at = NULL WHERE emoji = :emoji");
   query.addBindValue(qStringFromStdView(emoji));
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to reset ranking" << query.lastError();
     return false;
   }
 
+  if (auto data = findEmoji(emoji)) {
+    auto &metadata = m_metadata[data];
+
+    metadata.visitCount = 0;
+    metadata.lastVisitedAt.reset();
+  }
+
   emit rankingReset(emoji);
 
   return true;
@@ -224,11 +269,13 @@ bool EmojiService::unpin(std::string_view emoji) {
   query.prepare("UPDATE visited_emoji SET pinned_at = NULL WHERE emoji = :emoji");
   query.addBindValue(QString::fromUtf8(emoji.data(), emoji.size()));
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to pin emoji" << emoji;
     return false;
   }
 
+  if (auto data = findEmoji(emoji)) { m_metadata[data].pinnedAt.reset(); }
+
   emit unpinned(emoji);
 
   return true;
@@ -242,14 +289,24 @@ bool EmojiService::pin(std::string_view emoji) {
   query.prepare("UPDATE visited_emoji SET pinned_at = unixepoch() WHERE emoji = :emoji");
   query.addBindValue(QString::fromUtf8(emoji.data(), emoji.size()));
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to pin emoji" << emoji;
     return false;
   }
 
+  if (auto data = findEmoji(emoji)) {
+    m_metadata[data].pinnedAt = QDateTime::fromSecsSinceEpoch(QDateTime::currentSecsSinceEpoch());
+  }
+
   emit pinned(emoji);
 
   return true;
 }
 
-EmojiService::EmojiService(OmniDatabase &db) : m_db(db) { buildIndex(); }
+EmojiService::EmojiService(OmniDatabase &db) : m_db(db) {
+  loadMetadata();
+  buildIndex();
+  // the static index is part of the binary, only the one of the custom keywords takes heap memory
+  MemoryBudget::instance().add({.subsystem = MemoryBudget::Subsystem::EmojiIndex,
+                                .usage = [this]() { return m_customIndex.memUsage(); }});
+}
@@ -5,11 +5,13 @@
 #include <qobject.h>
 #include <qtmetamacros.h>
 #include <string_view>
+#include <unordered_map>
 
 /**
  * Provides all emoji-related services. Also integrates with the local sqlite database to provide
  * 'frequently used' metrics and all that.
- * The list of emojis is statically generated by a build script and is stored inside `emoji.cpp`.
+ * The list of emojis is statically generated by a build script and is stored inside `emoji.cpp`,
+ * along with a sorted keyword index that is searched in place, so that nothing has to be built at startup.
  */
 
 struct EmojiDataHash {
@@ -26,22 +28,40 @@ struct EmojiWithMetadata {
 class EmojiService : public QObject {
   Q_OBJECT
 
-  Trie<const EmojiData *, EmojiDataHash> m_index;
+  static constexpr size_t SEARCH_LIMIT = 1000;
+
+  struct Metadata {
+    uint32_t visitCount = 0;
+    std::optional<QDateTime> pinnedAt;
+    std::optional<QDateTime> lastVisitedAt;
+    QString keywords;
+  };
+
+  // user defined keywords, searched on top of the static index
+  Trie<const EmojiData *, EmojiDataHash> m_customIndex;
+  /**
+   * Content of the `visited_emoji` table, loaded once and written through by every method changing it, so
+   * that mapping metadata never has to query the database.
+   */
+  std::unordered_map<const EmojiData *, Metadata> m_metadata;
   OmniDatabase &m_db;
 
   void createDbEntry(std::string_view emoji);
+  void loadMetadata();
+  static const EmojiData *findEmoji(std::string_view emoji);
+  EmojiWithMetadata withMetadata(const EmojiData *data) const;
 
 public:
   /**
-   * Synchronously build search index.
+   * Synchronously index the custom keywords set by the user.
    */
   void buildIndex();
   std::vector<const EmojiData *> search(std::string_view query) const;
 
   /**
-   * List of emojis, ordered and grouped.
+   * List of emojis, ordered and grouped. The groups are static, this does not allocate.
    */
-  std::vector<std::pair<std::string_view, std::vector<const EmojiData *>>> grouped();
+  std::span<const EmojiGroup> grouped() const;
 
   /**
    * Map metadata to the provided list of emojis.
@@ -49,6 +69,9 @@ public:
   std::vector<EmojiWithMetadata> mapMetadata(const std::vector<const EmojiData *> &items);
   EmojiWithMetadata mapMetadata(std::string_view emoji);
 
+  /**
+   * Emojis with metadata, pinned ones first, then the most visited.
+   */
   std::vector<EmojiWithMetadata> getVisited() const;
   bool pin(std::string_view emoji);
   bool unpin(std::string_view emoji);
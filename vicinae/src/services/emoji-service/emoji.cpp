@@ -3836,4 +3836,5055 @@ const std::unordered_map<std::string_view, const EmojiData*> MAPPING = {
 };
  const std::unordered_map<std::string_view, const EmojiData*>& StaticEmojiDatabase::mapping() { return MAPPING; }
 
-const std::array<std::string_view, 9>& StaticEmojiDatabase::groups() { return GROUPS; }
\ No newline at end of file
+const std::array<std::string_view, 9>& StaticEmojiDatabase::groups() { return GROUPS; }
+
+static constexpr std::array<EmojiGroup, 9> GROUPED_LIST = {{
+{ GRP(0), 0, 169 },
+{ GRP(1), 169, 386 },
+{ GRP(2), 555, 159 },
+{ GRP(3), 714, 131 },
+{ GRP(4), 845, 218 },
+{ GRP(5), 1063, 85 },
+{ GRP(6), 1148, 264 },
+{ GRP(7), 1412, 224 },
+{ GRP(8), 1636, 270 }
+}};
+
+std::span<const EmojiData> EmojiGroup::emojis() const { return std::span(EMOJI_LIST).subspan(offset, count); }
+
+std::span<const EmojiGroup> StaticEmojiDatabase::groupedList() { return GROUPED_LIST; }
+
+static constexpr std::array<EmojiSearchToken, 5024> SEARCH_TOKENS = {{
+{ "+1", 0, 1 },
+{ "-1", 1, 1 },
+{ "-_-", 2, 1 },
+{ "0", 3, 1 },
+{ "00", 4, 13 },
+{ "0000", 17, 1 },
+{ "0030", 18, 1 },
+{ "1", 19, 6 },
+{ "10", 25, 3 },
+{ "100", 28, 2 },
+{ "1000", 30, 1 },
+{ "101", 31, 1 },
+{ "1030", 32, 1 },
+{ "11", 33, 2 },
+{ "1100", 35, 1 },
+{ "1130", 36, 1 },
+{ "12", 37, 2 },
+{ "1200", 39, 1 },
+{ "1230", 40, 1 },
+{ "1234", 41, 1 },
+{ "13", 42, 2 },
+{ "130", 44, 1 },
+{ "1300", 45, 1 },
+{ "1330", 46, 1 },
+{ "14", 47, 2 },
+{ "1400", 49, 1 },
+{ "1430", 50, 1 },
+{ "15", 51, 2 },
+{ "1500", 53, 1 },
+{ "1530", 54, 1 },
+{ "16", 55, 2 },
+{ "1600", 57, 1 },
+{ "1630", 58, 1 },
+{ "17", 59, 2 },
+{ "1700", 61, 1 },
+{ "1730", 62, 1 },
+{ "18", 63, 3 },
+{ "1800", 66, 1 },
+{ "1830", 67, 1 },
+{ "19", 68, 2 },
+{ "1900", 70, 1 },
+{ "1930", 71, 1 },
+{ "1st", 72, 1 },
+{ "2", 73, 4 },
+{ "20", 77, 2 },
+{ "200", 79, 1 },
+{ "2000", 80, 1 },
+{ "2030", 81, 1 },
+{ "21", 82, 2 },
+{ "2100", 84, 1 },
+{ "2130", 85, 1 },
+{ "22", 86, 2 },
+{ "2200", 88, 1 },
+{ "2230", 89, 1 },
+{ "23", 90, 2 },
+{ "230", 92, 1 },
+{ "2300", 93, 1 },
+{ "2330", 94, 1 },
+{ "2nd", 95, 1 },
+{ "3", 96, 5 },
+{ "30", 101, 12 },
+{ "300", 113, 1 },
+{ "330", 114, 1 },
+{ "3rd", 115, 1 },
+{ "4", 116, 4 },
+{ "400", 120, 1 },
+{ "430", 121, 1 },
+{ "5", 122, 3 },
+{ "500", 125, 1 },
+{ "530", 126, 1 },
+{ "55b6", 127, 1 },
+{ "6", 128, 3 },
+{ "600", 131, 1 },
+{ "630", 132, 1 },
+{ "6e80", 133, 1 },
+{ "7", 134, 3 },
+{ "700", 137, 1 },
+{ "730", 138, 1 },
+{ "7a7a", 139, 1 },
+{ "8", 140, 4 },
+{ "800", 144, 1 },
+{ "80s", 145, 2 },
+{ "830", 147, 1 },
+{ "8ball", 148, 1 },
+{ "9", 149, 3 },
+{ "900", 152, 1 },
+{ "90s", 153, 5 },
+{ "911", 158, 6 },
+{ "930", 164, 1 },
+{ ":'(", 165, 1 },
+{ ":(", 166, 2 },
+{ ":)", 168, 2 },
+{ ":/", 170, 1 },
+{ ":d", 171, 3 },
+{ ":o", 174, 1 },
+{ ":s", 175, 1 },
+{ ":|", 176, 1 },
+{ ";)", 177, 1 },
+{ "^^", 178, 1 },
+{ "a", 179, 3 },
+{ "aa", 182, 1 },
+{ "ab", 183, 1 },
+{ "abacus", 184, 1 },
+{ "abandon", 185, 1 },
+{ "abandoned", 186, 1 },
+{ "abc", 187, 1 },
+{ "abcd", 188, 2 },
+{ "above", 190, 8 },
+{ "absentminded", 198, 1 },
+{ "absorbing", 199, 1 },
+{ "ac", 200, 1 },
+{ "academic", 201, 1 },
+{ "accept", 202, 2 },
+{ "acceptable", 204, 1 },
+{ "access", 205, 1 },
+{ "accessibility", 206, 29 },
+{ "accessible", 235, 1 },
+{ "accessories", 236, 7 },
+{ "accessory", 243, 1 },
+{ "accommodation", 244, 2 },
+{ "accomodation", 246, 1 },
+{ "accordian", 247, 1 },
+{ "accordion", 248, 1 },
+{ "accountant", 249, 3 },
+{ "accounting", 252, 1 },
+{ "achoo", 253, 1 },
+{ "acidic", 254, 1 },
+{ "acorn", 255, 1 },
+{ "acoustic", 256, 1 },
+{ "acquire", 257, 1 },
+{ "acting", 258, 1 },
+{ "activity", 259, 47 },
+{ "actor", 306, 3 },
+{ "ad", 309, 1 },
+{ "adaptor", 310, 1 },
+{ "add", 311, 2 },
+{ "addition", 313, 1 },
+{ "address", 314, 1 },
+{ "adhesive", 315, 1 },
+{ "admiralty", 316, 1 },
+{ "admission", 317, 2 },
+{ "adore", 319, 1 },
+{ "adult", 320, 22 },
+{ "advantage", 342, 1 },
+{ "adviser", 343, 3 },
+{ "aerial", 346, 1 },
+{ "aeroplane", 347, 5 },
+{ "aesculapius", 352, 1 },
+{ "af", 353, 1 },
+{ "affection", 354, 25 },
+{ "afghan", 379, 1 },
+{ "afghanistan", 380, 1 },
+{ "africa", 381, 2 },
+{ "african", 383, 3 },
+{ "afro", 386, 1 },
+{ "afternoon", 387, 1 },
+{ "age", 388, 1 },
+{ "agree", 389, 6 },
+{ "agreement", 395, 2 },
+{ "agriculture", 397, 1 },
+{ "ai", 398, 1 },
+{ "aid", 399, 4 },
+{ "air", 403, 5 },
+{ "airing", 408, 1 },
+{ "airplane", 409, 8 },
+{ "airport", 417, 3 },
+{ "al", 420, 1 },
+{ "aladdin", 421, 1 },
+{ "aland", 422, 1 },
+{ "alarm", 423, 3 },
+{ "albania", 426, 1 },
+{ "albanian", 427, 1 },
+{ "alcohol", 428, 8 },
+{ "alembic", 436, 1 },
+{ "alert", 437, 2 },
+{ "algeria", 439, 1 },
+{ "algerian", 440, 1 },
+{ "alien", 441, 3 },
+{ "allergy", 444, 1 },
+{ "alligator", 445, 1 },
+{ "alone", 446, 1 },
+{ "alpaca", 447, 1 },
+{ "alphabet", 448, 12 },
+{ "alternation", 460, 1 },
+{ "am", 461, 2 },
+{ "amazed", 463, 1 },
+{ "amazement", 464, 1 },
+{ "ambulance", 465, 2 },
+{ "america", 467, 3 },
+{ "american", 470, 5 },
+{ "americas", 475, 1 },
+{ "amex", 476, 1 },
+{ "amoeba", 477, 1 },
+{ "amount", 478, 2 },
+{ "ampersand", 480, 1 },
+{ "amphora", 481, 1 },
+{ "amulet", 482, 2 },
+{ "amusement", 484, 3 },
+{ "an", 487, 1 },
+{ "analyst", 488, 3 },
+{ "analytics", 491, 1 },
+{ "anatomical", 492, 1 },
+{ "anchor", 493, 2 },
+{ "ancient", 495, 1 },
+{ "and", 496, 13 },
+{ "andorra", 509, 1 },
+{ "andorran", 510, 1 },
+{ "andrew", 511, 1 },
+{ "ang", 512, 1 },
+{ "angel", 513, 3 },
+{ "anger", 516, 3 },
+{ "angola", 519, 1 },
+{ "angolan", 520, 1 },
+{ "angry", 521, 7 },
+{ "anguilla", 528, 1 },
+{ "anguillan", 529, 1 },
+{ "anguished", 530, 1 },
+{ "animal", 531, 126 },
+{ "animations", 657, 1 },
+{ "annelid", 658, 1 },
+{ "announcement", 659, 2 },
+{ "annoyed", 661, 1 },
+{ "answer", 662, 2 },
+{ "answering", 664, 1 },
+{ "ant", 665, 1 },
+{ "antarctic", 666, 2 },
+{ "antarctica", 668, 1 },
+{ "antenna", 669, 2 },
+{ "anticlockwise", 671, 1 },
+{ "antigua", 672, 1 },
+{ "antilles", 673, 1 },
+{ "anxious", 674, 2 },
+{ "ao", 676, 1 },
+{ "ape", 677, 1 },
+{ "apology", 678, 3 },
+{ "appetizer", 681, 1 },
+{ "applause", 682, 1 },
+{ "apple", 683, 4 },
+{ "application", 687, 1 },
+{ "apply", 688, 1 },
+{ "appreciate", 689, 1 },
+{ "appreciation", 690, 1 },
+{ "approve", 691, 1 },
+{ "aq", 692, 1 },
+{ "aquarius", 693, 2 },
+{ "ar", 695, 1 },
+{ "arab", 696, 3 },
+{ "arabia", 699, 1 },
+{ "arabian", 700, 2 },
+{ "arabs", 702, 2 },
+{ "arachnid", 704, 3 },
+{ "arcade", 707, 1 },
+{ "archer", 708, 2 },
+{ "archery", 710, 2 },
+{ "architect", 712, 5 },
+{ "architectural", 717, 1 },
+{ "arctic", 718, 1 },
+{ "arepa", 719, 1 },
+{ "argentina", 720, 1 },
+{ "argentinian", 721, 1 },
+{ "ariel", 722, 1 },
+{ "aries", 723, 2 },
+{ "arm", 725, 3 },
+{ "armenia", 728, 1 },
+{ "armenian", 729, 1 },
+{ "arms", 730, 2 },
+{ "army", 732, 2 },
+{ "arrest", 734, 3 },
+{ "arrival", 737, 1 },
+{ "arrivals", 738, 1 },
+{ "arriving", 739, 1 },
+{ "arrow", 740, 40 },
+{ "arrows", 780, 7 },
+{ "art", 787, 8 },
+{ "articulated", 795, 1 },
+{ "artificial", 796, 1 },
+{ "artist", 797, 6 },
+{ "arts", 803, 2 },
+{ "aruba", 805, 1 },
+{ "aruban", 806, 1 },
+{ "as", 807, 1 },
+{ "ascension", 808, 2 },
+{ "asclepius", 810, 1 },
+{ "ashes", 811, 1 },
+{ "asia", 812, 3 },
+{ "asian", 815, 4 },
+{ "ask", 819, 1 },
+{ "asklepios", 820, 1 },
+{ "assembly", 821, 3 },
+{ "assets", 824, 1 },
+{ "assist", 825, 1 },
+{ "assistance", 826, 1 },
+{ "asterisk", 827, 2 },
+{ "astonished", 829, 1 },
+{ "astrology", 830, 13 },
+{ "astronaut", 843, 3 },
+{ "astronomy", 846, 1 },
+{ "at", 847, 4 },
+{ "atheist", 851, 1 },
+{ "athlete", 852, 2 },
+{ "athletic", 854, 1 },
+{ "athletics", 855, 1 },
+{ "atm", 856, 1 },
+{ "atom", 857, 1 },
+{ "attack", 858, 1 },
+{ "attendant", 859, 1 },
+{ "attraction", 860, 1 },
+{ "au", 861, 1 },
+{ "aubergine", 862, 1 },
+{ "aumkara", 863, 1 },
+{ "aussie", 864, 1 },
+{ "australia", 865, 4 },
+{ "australian", 869, 1 },
+{ "austria", 870, 1 },
+{ "austrian", 871, 1 },
+{ "authorization", 872, 1 },
+{ "auto", 873, 1 },
+{ "automated", 874, 1 },
+{ "automobile", 875, 2 },
+{ "autumn", 877, 3 },
+{ "available", 880, 1 },
+{ "aviation", 881, 3 },
+{ "aviator", 884, 3 },
+{ "avocado", 887, 1 },
+{ "aw", 888, 2 },
+{ "award", 890, 6 },
+{ "awareness", 896, 1 },
+{ "away", 897, 1 },
+{ "awe", 898, 1 },
+{ "awesome", 899, 4 },
+{ "awkward", 903, 1 },
+{ "axe", 904, 1 },
+{ "az", 905, 1 },
+{ "azerbaijan", 906, 1 },
+{ "azerbaijani", 907, 1 },
+{ "b", 908, 1 },
+{ "baby", 909, 15 },
+{ "back", 924, 5 },
+{ "backhand", 929, 5 },
+{ "backpack", 934, 1 },
+{ "backpacking", 935, 1 },
+{ "backslash", 936, 1 },
+{ "backward", 937, 2 },
+{ "bacon", 939, 1 },
+{ "bacteria", 940, 2 },
+{ "bactrian", 942, 1 },
+{ "bad", 943, 8 },
+{ "badge", 951, 2 },
+{ "badger", 953, 1 },
+{ "badminton", 954, 1 },
+{ "bag", 955, 6 },
+{ "bagel", 961, 1 },
+{ "baggage", 962, 2 },
+{ "bags", 964, 3 },
+{ "baguette", 967, 1 },
+{ "bahamas", 968, 1 },
+{ "bahamian", 969, 1 },
+{ "bahrain", 970, 1 },
+{ "bahrainian", 971, 1 },
+{ "bahrani", 972, 1 },
+{ "bait", 973, 1 },
+{ "bajan", 974, 1 },
+{ "baked", 975, 1 },
+{ "bakery", 976, 6 },
+{ "bakkureru", 982, 1 },
+{ "balance", 983, 6 },
+{ "bald", 989, 4 },
+{ "ball", 993, 28 },
+{ "ballerina", 1021, 1 },
+{ "ballet", 1022, 2 },
+{ "balloon", 1024, 4 },
+{ "ballot", 1028, 2 },
+{ "ballpoint", 1030, 2 },
+{ "balls", 1032, 7 },
+{ "bamboo", 1039, 3 },
+{ "ban", 1042, 1 },
+{ "banana", 1043, 2 },
+{ "band", 1045, 1 },
+{ "bandage", 1046, 3 },
+{ "bandaged", 1049, 2 },
+{ "baner", 1051, 1 },
+{ "bang", 1052, 2 },
+{ "bangbang", 1054, 1 },
+{ "bangladesh", 1055, 1 },
+{ "bangladeshi", 1056, 1 },
+{ "banjo", 1057, 1 },
+{ "bank", 1058, 10 },
+{ "banker", 1068, 3 },
+{ "banknote", 1071, 5 },
+{ "banknotes", 1076, 4 },
+{ "banned", 1080, 1 },
+{ "banner", 1081, 252 },
+{ "banzai", 1333, 1 },
+{ "bar", 1334, 17 },
+{ "barbadian", 1351, 1 },
+{ "barbados", 1352, 1 },
+{ "barbecue", 1353, 2 },
+{ "barber", 1355, 4 },
+{ "barbuda", 1359, 1 },
+{ "barf", 1360, 2 },
+{ "bargain", 1362, 2 },
+{ "barrell", 1364, 1 },
+{ "barrier", 1365, 1 },
+{ "bars", 1366, 1 },
+{ "bart", 1367, 1 },
+{ "barthelemy", 1368, 1 },
+{ "baseball", 1369, 2 },
+{ "basket", 1371, 2 },
+{ "basketball", 1373, 4 },
+{ "basotho", 1377, 1 },
+{ "bass", 1378, 1 },
+{ "bat", 1379, 3 },
+{ "bath", 1382, 4 },
+{ "bathers", 1386, 1 },
+{ "bathing", 1387, 5 },
+{ "bathroom", 1392, 7 },
+{ "bathtub", 1399, 2 },
+{ "batman", 1401, 1 },
+{ "batswana", 1402, 1 },
+{ "battery", 1403, 2 },
+{ "bawling", 1405, 1 },
+{ "bb", 1406, 1 },
+{ "bbcall", 1407, 1 },
+{ "bbq", 1408, 1 },
+{ "bd", 1409, 1 },
+{ "be", 1410, 1 },
+{ "beach", 1411, 19 },
+{ "beacon", 1430, 1 },
+{ "bead", 1431, 1 },
+{ "beads", 1432, 1 },
+{ "beamed", 1433, 1 },
+{ "beaming", 1434, 1 },
+{ "beans", 1435, 1 },
+{ "bear", 1436, 4 },
+{ "beard", 1440, 3 },
+{ "bearded", 1443, 3 },
+{ "bearer", 1446, 3 },
+{ "beat", 1449, 1 },
+{ "beating", 1450, 1 },
+{ "beauty", 1451, 4 },
+{ "beaver", 1455, 1 },
+{ "beckon", 1456, 1 },
+{ "bed", 1457, 2 },
+{ "bedroom", 1459, 1 },
+{ "bedtime", 1460, 1 },
+{ "bee", 1461, 1 },
+{ "beef", 1462, 4 },
+{ "beeper", 1466, 1 },
+{ "beer", 1467, 2 },
+{ "beers", 1469, 1 },
+{ "bees", 1470, 1 },
+{ "beetle", 1471, 2 },
+{ "begging", 1473, 1 },
+{ "beginner", 1474, 1 },
+{ "behind", 1475, 4 },
+{ "belarus", 1479, 1 },
+{ "belarusian", 1480, 1 },
+{ "belgian", 1481, 1 },
+{ "belgium", 1482, 1 },
+{ "belize", 1483, 1 },
+{ "belizean", 1484, 1 },
+{ "bell", 1485, 5 },
+{ "bellhop", 1490, 2 },
+{ "belly", 1492, 2 },
+{ "bengal", 1494, 1 },
+{ "benin", 1495, 1 },
+{ "beninese", 1496, 1 },
+{ "bento", 1497, 1 },
+{ "bermuda", 1498, 1 },
+{ "bermudan", 1499, 1 },
+{ "berries", 1500, 1 },
+{ "berry", 1501, 2 },
+{ "best", 1503, 1 },
+{ "bet", 1504, 1 },
+{ "betting", 1505, 1 },
+{ "between", 1506, 1 },
+{ "beverage", 1507, 13 },
+{ "bewhiskered", 1520, 3 },
+{ "bf", 1523, 1 },
+{ "bg", 1524, 1 },
+{ "bh", 1525, 1 },
+{ "bhutan", 1526, 1 },
+{ "bhutanese", 1527, 1 },
+{ "bi", 1528, 1 },
+{ "bicep", 1529, 1 },
+{ "biceps", 1530, 1 },
+{ "bicycle", 1531, 8 },
+{ "bicycles", 1539, 1 },
+{ "bicyclist", 1540, 6 },
+{ "big", 1546, 4 },
+{ "bike", 1550, 9 },
+{ "biker", 1559, 3 },
+{ "bikes", 1562, 1 },
+{ "biking", 1563, 6 },
+{ "bikini", 1569, 1 },
+{ "bilberry", 1570, 1 },
+{ "bill", 1571, 6 },
+{ "billed", 1577, 1 },
+{ "billiard", 1578, 1 },
+{ "billiards", 1579, 1 },
+{ "bills", 1580, 2 },
+{ "bin", 1582, 3 },
+{ "binder", 1585, 1 },
+{ "biohazard", 1586, 1 },
+{ "biologist", 1587, 5 },
+{ "biology", 1592, 1 },
+{ "bird", 1593, 23 },
+{ "birdie", 1616, 1 },
+{ "birds", 1617, 1 },
+{ "birth", 1618, 3 },
+{ "birthday", 1621, 6 },
+{ "biscuit", 1627, 1 },
+{ "bisexual", 1628, 1 },
+{ "bison", 1629, 1 },
+{ "bisque", 1630, 1 },
+{ "bissau", 1631, 1 },
+{ "biting", 1632, 1 },
+{ "bj", 1633, 1 },
+{ "bk", 1634, 1 },
+{ "black", 1635, 42 },
+{ "blade", 1677, 1 },
+{ "blank", 1678, 2 },
+{ "bleed", 1680, 1 },
+{ "bleeper", 1681, 1 },
+{ "blind", 1682, 11 },
+{ "bloated", 1693, 2 },
+{ "block", 1695, 1 },
+{ "blogger", 1696, 2 },
+{ "blond", 1698, 4 },
+{ "blonde", 1702, 4 },
+{ "blood", 1706, 7 },
+{ "blooper", 1713, 1 },
+{ "blossom", 1714, 3 },
+{ "blossoming", 1717, 1 },
+{ "blouse", 1718, 1 },
+{ "blow", 1719, 4 },
+{ "blowfish", 1723, 1 },
+{ "blowing", 1724, 3 },
+{ "blown", 1727, 2 },
+{ "blue", 1729, 92 },
+{ "blueberries", 1821, 1 },
+{ "blueberry", 1822, 1 },
+{ "blues", 1823, 1 },
+{ "bluetooth", 1824, 1 },
+{ "blurry", 1825, 1 },
+{ "blush", 1826, 3 },
+{ "blushing", 1829, 2 },
+{ "bm", 1831, 1 },
+{ "bn", 1832, 1 },
+{ "bo", 1833, 1 },
+{ "boar", 1834, 1 },
+{ "board", 1835, 3 },
+{ "boarding", 1838, 1 },
+{ "boat", 1839, 10 },
+{ "boba", 1849, 1 },
+{ "body", 1850, 49 },
+{ "bodybuilder", 1899, 1 },
+{ "boiled", 1900, 1 },
+{ "bok", 1901, 1 },
+{ "bolivarian", 1902, 1 },
+{ "bolivia", 1903, 1 },
+{ "bolivian", 1904, 1 },
+{ "bolt", 1905, 2 },
+{ "bomb", 1907, 2 },
+{ "bombilla", 1909, 1 },
+{ "bonaire", 1910, 1 },
+{ "boncugu", 1911, 1 },
+{ "bone", 1912, 3 },
+{ "bones", 1915, 1 },
+{ "book", 1916, 9 },
+{ "bookkeeping", 1925, 1 },
+{ "books", 1926, 1 },
+{ "boom", 1927, 3 },
+{ "boomerang", 1930, 1 },
+{ "boot", 1931, 3 },
+{ "boots", 1934, 1 },
+{ "booze", 1935, 7 },
+{ "border", 1942, 3 },
+{ "bored", 1945, 2 },
+{ "boring", 1947, 2 },
+{ "born", 1949, 1 },
+{ "bosnia", 1950, 1 },
+{ "bot", 1951, 1 },
+{ "both", 1952, 1 },
+{ "botswana", 1953, 1 },
+{ "bottle", 1954, 7 },
+{ "bottom", 1961, 6 },
+{ "boulder", 1967, 1 },
+{ "bouldering", 1968, 3 },
+{ "bouncing", 1971, 3 },
+{ "bound", 1974, 1 },
+{ "bouquet", 1975, 1 },
+{ "bourbon", 1976, 1 },
+{ "bouvet", 1977, 2 },
+{ "bow", 1979, 7 },
+{ "bowie", 1986, 1 },
+{ "bowing", 1987, 3 },
+{ "bowl", 1990, 6 },
+{ "bowling", 1996, 1 },
+{ "bowtie", 1997, 1 },
+{ "box", 1998, 13 },
+{ "boxing", 2011, 1 },
+{ "boy", 2012, 38 },
+{ "boys", 2050, 1 },
+{ "br", 2051, 1 },
+{ "brachiosaurus", 2052, 1 },
+{ "brain", 2053, 2 },
+{ "branch", 2055, 2 },
+{ "branches", 2057, 1 },
+{ "brand", 2058, 2 },
+{ "brasil", 2060, 1 },
+{ "brass", 2061, 1 },
+{ "brazil", 2062, 1 },
+{ "brazilian", 2063, 1 },
+{ "brazzaville", 2064, 1 },
+{ "bread", 2065, 7 },
+{ "break", 2072, 3 },
+{ "breakfast", 2075, 11 },
+{ "breaking", 2086, 1 },
+{ "breast", 2087, 1 },
+{ "breastfeeding", 2088, 1 },
+{ "breath", 2089, 1 },
+{ "breathe", 2090, 1 },
+{ "brick", 2091, 1 },
+{ "bricks", 2092, 1 },
+{ "bride", 2093, 4 },
+{ "bridge", 2097, 2 },
+{ "brief", 2099, 1 },
+{ "briefcase", 2100, 1 },
+{ "briefs", 2101, 1 },
+{ "bright", 2102, 5 },
+{ "brightness", 2107, 3 },
+{ "britain", 2110, 1 },
+{ "british", 2111, 8 },
+{ "bro", 2119, 1 },
+{ "broadcast", 2120, 3 },
+{ "broccoli", 2123, 1 },
+{ "brofist", 2124, 1 },
+{ "broken", 2125, 4 },
+{ "brokenhearted", 2129, 1 },
+{ "bromance", 2130, 1 },
+{ "brontosaurus", 2131, 1 },
+{ "bronze", 2132, 1 },
+{ "broom", 2133, 1 },
+{ "brown", 2134, 7 },
+{ "brows", 2141, 1 },
+{ "brunch", 2142, 3 },
+{ "brunei", 2145, 1 },
+{ "bruneian", 2146, 1 },
+{ "brush", 2147, 3 },
+{ "bs", 2150, 1 },
+{ "bt", 2151, 1 },
+{ "bts", 2152, 1 },
+{ "bubble", 2153, 8 },
+{ "bubbles", 2161, 1 },
+{ "bubbly", 2162, 1 },
+{ "buck", 2163, 2 },
+{ "bucket", 2165, 1 },
+{ "buddhism", 2166, 3 },
+{ "buddhist", 2169, 1 },
+{ "buffalo", 2170, 2 },
+{ "bug", 2172, 5 },
+{ "bugle", 2177, 1 },
+{ "build", 2178, 7 },
+{ "builder", 2185, 1 },
+{ "building", 2186, 24 },
+{ "buildings", 2210, 3 },
+{ "bulb", 2213, 1 },
+{ "bulgaria", 2214, 1 },
+{ "bulgarian", 2215, 1 },
+{ "bull", 2216, 3 },
+{ "bullet", 2219, 1 },
+{ "bullettrain", 2220, 2 },
+{ "bullhorn", 2222, 2 },
+{ "bullock", 2224, 1 },
+{ "bullseye", 2225, 1 },
+{ "bumblebee", 2226, 1 },
+{ "bump", 2227, 5 },
+{ "bunny", 2232, 5 },
+{ "buoy", 2237, 1 },
+{ "bureau", 2238, 1 },
+{ "burger", 2239, 1 },
+{ "burkina", 2240, 1 },
+{ "burkinabe", 2241, 1 },
+{ "burma", 2242, 1 },
+{ "burmese", 2243, 1 },
+{ "burn", 2244, 2 },
+{ "burp", 2246, 1 },
+{ "burrito", 2247, 1 },
+{ "burundi", 2248, 1 },
+{ "burundian", 2249, 1 },
+{ "bury", 2250, 1 },
+{ "bus", 2251, 6 },
+{ "business", 2257, 18 },
+{ "businessman", 2275, 1 },
+{ "businesswoman", 2276, 1 },
+{ "busstop", 2277, 1 },
+{ "bust", 2278, 2 },
+{ "busts", 2280, 1 },
+{ "but", 2281, 1 },
+{ "butchers", 2282, 1 },
+{ "butt", 2283, 1 },
+{ "butter", 2284, 1 },
+{ "butterfly", 2285, 2 },
+{ "button", 2287, 66 },
+{ "buy", 2353, 1 },
+{ "bvi", 2354, 1 },
+{ "bw", 2355, 1 },
+{ "by", 2356, 1 },
+{ "bz", 2357, 1 },
+{ "c", 2358, 1 },
+{ "ca", 2359, 2 },
+{ "cabbage", 2361, 2 },
+{ "cabinet", 2363, 1 },
+{ "cable", 2364, 3 },
+{ "cableway", 2367, 1 },
+{ "cabo", 2368, 1 },
+{ "cactus", 2369, 1 },
+{ "cafe", 2370, 1 },
+{ "caffeine", 2371, 1 },
+{ "caicos", 2372, 1 },
+{ "cake", 2373, 5 },
+{ "calculate", 2378, 1 },
+{ "calculation", 2379, 5 },
+{ "caledonia", 2384, 1 },
+{ "caledonian", 2385, 1 },
+{ "calendar", 2386, 3 },
+{ "call", 2389, 3 },
+{ "calling", 2392, 1 },
+{ "calm", 2393, 1 },
+{ "cambodia", 2394, 1 },
+{ "cambodian", 2395, 1 },
+{ "camcorder", 2396, 1 },
+{ "camel", 2397, 2 },
+{ "camera", 2399, 6 },
+{ "cameroon", 2405, 1 },
+{ "cameroonian", 2406, 1 },
+{ "campervan", 2407, 1 },
+{ "camping", 2408, 4 },
+{ "campsite", 2412, 1 },
+{ "can", 2413, 2 },
+{ "canada", 2415, 3 },
+{ "canadian", 2418, 2 },
+{ "canary", 2420, 1 },
+{ "cancel", 2421, 2 },
+{ "cancellation", 2423, 2 },
+{ "cancer", 2425, 2 },
+{ "candelabrum", 2427, 1 },
+{ "candle", 2428, 1 },
+{ "candles", 2429, 2 },
+{ "candlestick", 2431, 1 },
+{ "candy", 2432, 4 },
+{ "cane", 2436, 8 },
+{ "canned", 2444, 1 },
+{ "canoe", 2445, 1 },
+{ "cantaloupe", 2446, 1 },
+{ "cap", 2447, 3 },
+{ "cape", 2450, 1 },
+{ "capital", 2451, 6 },
+{ "capped", 2457, 2 },
+{ "capricorn", 2459, 2 },
+{ "capsicum", 2461, 1 },
+{ "capsule", 2462, 1 },
+{ "caption", 2463, 1 },
+{ "captivated", 2464, 1 },
+{ "car", 2465, 16 },
+{ "caramel", 2481, 1 },
+{ "carbonation", 2482, 1 },
+{ "card", 2483, 13 },
+{ "cardboard", 2496, 1 },
+{ "cardinal", 2497, 4 },
+{ "cardiology", 2501, 1 },
+{ "cards", 2502, 6 },
+{ "care", 2508, 3 },
+{ "career", 2511, 1 },
+{ "caribbean", 2512, 1 },
+{ "carnival", 2513, 5 },
+{ "carousel", 2518, 1 },
+{ "carp", 2519, 1 },
+{ "carpenter", 2520, 1 },
+{ "carpentry", 2521, 1 },
+{ "carriage", 2522, 2 },
+{ "carrot", 2524, 1 },
+{ "cars", 2525, 8 },
+{ "cart", 2533, 1 },
+{ "cartwheel", 2534, 3 },
+{ "cartwheeling", 2537, 3 },
+{ "carving", 2540, 1 },
+{ "cash", 2541, 2 },
+{ "casino", 2543, 1 },
+{ "cask", 2544, 1 },
+{ "casket", 2545, 1 },
+{ "casserole", 2546, 1 },
+{ "cassette", 2547, 1 },
+{ "castle", 2548, 2 },
+{ "casual", 2550, 1 },
+{ "cat", 2551, 14 },
+{ "cat2", 2565, 1 },
+{ "catch", 2566, 3 },
+{ "caterpillar", 2569, 2 },
+{ "cats", 2571, 10 },
+{ "cause", 2581, 1 },
+{ "caution", 2582, 1 },
+{ "cayman", 2583, 1 },
+{ "caymanian", 2584, 1 },
+{ "cd", 2585, 2 },
+{ "celebrate", 2587, 1 },
+{ "celebration", 2588, 28 },
+{ "cell", 2616, 7 },
+{ "cellular", 2623, 1 },
+{ "cemetery", 2624, 2 },
+{ "center", 2626, 1 },
+{ "central", 2627, 1 },
+{ "century", 2628, 1 },
+{ "ceo", 2629, 2 },
+{ "cereal", 2631, 1 },
+{ "ceremony", 2632, 2 },
+{ "ceuta", 2634, 2 },
+{ "ch", 2636, 1 },
+{ "chad", 2637, 1 },
+{ "chadder", 2638, 1 },
+{ "chadian", 2639, 1 },
+{ "chagos", 2640, 1 },
+{ "chain", 2641, 3 },
+{ "chains", 2644, 1 },
+{ "chair", 2645, 2 },
+{ "chamorro", 2647, 1 },
+{ "champagne", 2648, 2 },
+{ "championship", 2650, 1 },
+{ "change", 2651, 1 },
+{ "changing", 2652, 1 },
+{ "chanukiah", 2653, 1 },
+{ "chapel", 2654, 1 },
+{ "characters", 2655, 1 },
+{ "charge", 2656, 3 },
+{ "charger", 2659, 1 },
+{ "charm", 2660, 1 },
+{ "chart", 2661, 4 },
+{ "chat", 2665, 1 },
+{ "chatting", 2666, 2 },
+{ "che", 2668, 1 },
+{ "check", 2669, 3 },
+{ "checkbox", 2672, 1 },
+{ "checkered", 2673, 1 },
+{ "checkin", 2674, 1 },
+{ "cheeky", 2675, 2 },
+{ "cheering", 2677, 1 },
+{ "cheers", 2678, 2 },
+{ "cheese", 2680, 7 },
+{ "cheeseburger", 2687, 1 },
+{ "chef", 2688, 3 },
+{ "chemist", 2691, 5 },
+{ "chemistry", 2696, 4 },
+{ "chequered", 2700, 1 },
+{ "cherries", 2701, 1 },
+{ "cherry", 2702, 3 },
+{ "cherub", 2705, 1 },
+{ "chess", 2706, 1 },
+{ "chest", 2707, 1 },
+{ "chestnut", 2708, 1 },
+{ "chevron", 2709, 1 },
+{ "chick", 2710, 3 },
+{ "chicken", 2713, 7 },
+{ "chickpea", 2720, 1 },
+{ "child", 2721, 39 },
+{ "childish", 2760, 2 },
+{ "children", 2762, 22 },
+{ "chile", 2784, 1 },
+{ "chilean", 2785, 1 },
+{ "chili", 2786, 1 },
+{ "chill", 2787, 1 },
+{ "chilli", 2788, 1 },
+{ "chimarrao", 2789, 1 },
+{ "chime", 2790, 2 },
+{ "chin", 2792, 1 },
+{ "china", 2793, 4 },
+{ "chinese", 2797, 23 },
+{ "chip", 2820, 1 },
+{ "chipmunk", 2821, 1 },
+{ "chips", 2822, 1 },
+{ "chirp", 2823, 1 },
+{ "chocolate", 2824, 5 },
+{ "chocolates", 2829, 1 },
+{ "chop", 2830, 4 },
+{ "chopsticks", 2834, 2 },
+{ "choy", 2836, 1 },
+{ "christ", 2837, 1 },
+{ "christian", 2838, 3 },
+{ "christianity", 2841, 1 },
+{ "christmas", 2842, 10 },
+{ "church", 2852, 3 },
+{ "ci", 2855, 1 },
+{ "cigarette", 2856, 2 },
+{ "cimarron", 2858, 1 },
+{ "cinema", 2859, 4 },
+{ "circle", 2863, 33 },
+{ "circled", 2896, 6 },
+{ "circus", 2902, 10 },
+{ "citric", 2912, 1 },
+{ "citrus", 2913, 1 },
+{ "city", 2914, 7 },
+{ "cityscape", 2921, 2 },
+{ "cjk", 2923, 11 },
+{ "cl", 2934, 1 },
+{ "claim", 2935, 1 },
+{ "clairvoyant", 2936, 1 },
+{ "clamp", 2937, 1 },
+{ "clap", 2938, 1 },
+{ "clapboard", 2939, 1 },
+{ "clapper", 2940, 1 },
+{ "clapping", 2941, 1 },
+{ "classical", 2942, 1 },
+{ "classroom", 2943, 1 },
+{ "classy", 2944, 2 },
+{ "claus", 2946, 3 },
+{ "claw", 2949, 1 },
+{ "claws", 2950, 1 },
+{ "clay", 2951, 1 },
+{ "clean", 2952, 5 },
+{ "cleaning", 2957, 4 },
+{ "clear", 2961, 1 },
+{ "clef", 2962, 1 },
+{ "clenched", 2963, 2 },
+{ "clerk", 2965, 3 },
+{ "click", 2968, 1 },
+{ "climb", 2969, 1 },
+{ "climber", 2970, 3 },
+{ "climbing", 2973, 3 },
+{ "clink", 2976, 2 },
+{ "clinking", 2978, 2 },
+{ "clipboard", 2980, 1 },
+{ "clipperton", 2981, 2 },
+{ "clippy", 2983, 1 },
+{ "clock", 2984, 31 },
+{ "clock1", 3015, 1 },
+{ "clock10", 3016, 1 },
+{ "clock1030", 3017, 1 },
+{ "clock11", 3018, 1 },
+{ "clock1130", 3019, 1 },
+{ "clock12", 3020, 1 },
+{ "clock1230", 3021, 1 },
+{ "clock130", 3022, 1 },
+{ "clock2", 3023, 1 },
+{ "clock230", 3024, 1 },
+{ "clock3", 3025, 1 },
+{ "clock330", 3026, 1 },
+{ "clock4", 3027, 1 },
+{ "clock430", 3028, 1 },
+{ "clock5", 3029, 1 },
+{ "clock530", 3030, 1 },
+{ "clock6", 3031, 1 },
+{ "clock630", 3032, 1 },
+{ "clock7", 3033, 1 },
+{ "clock730", 3034, 1 },
+{ "clock8", 3035, 1 },
+{ "clock830", 3036, 1 },
+{ "clock9", 3037, 1 },
+{ "clock930", 3038, 1 },
+{ "clockwise", 3039, 3 },
+{ "closed", 3042, 13 },
+{ "closet", 3055, 1 },
+{ "cloth", 3056, 2 },
+{ "clothes", 3058, 5 },
+{ "clothing", 3063, 39 },
+{ "cloud", 3102, 14 },
+{ "clouds", 3116, 1 },
+{ "cloudy", 3117, 2 },
+{ "clover", 3119, 2 },
+{ "clown", 3121, 1 },
+{ "club", 3122, 3 },
+{ "clubs", 3125, 1 },
+{ "cluck", 3126, 1 },
+{ "clue", 3127, 2 },
+{ "clumsy", 3129, 1 },
+{ "clutch", 3130, 1 },
+{ "cm", 3131, 1 },
+{ "cn", 3132, 1 },
+{ "co", 3133, 1 },
+{ "coast", 3134, 1 },
+{ "coaster", 3135, 1 },
+{ "coat", 3136, 2 },
+{ "cob", 3138, 1 },
+{ "cobweb", 3139, 1 },
+{ "cock", 3140, 1 },
+{ "cockerel", 3141, 1 },
+{ "cockroach", 3142, 1 },
+{ "cocktail", 3143, 2 },
+{ "cocoanut", 3145, 1 },
+{ "coconut", 3146, 2 },
+{ "cocos", 3148, 1 },
+{ "coder", 3149, 3 },
+{ "coffee", 3152, 2 },
+{ "coffin", 3154, 1 },
+{ "cog", 3155, 1 },
+{ "cogwheel", 3156, 1 },
+{ "coin", 3157, 2 },
+{ "coins", 3159, 1 },
+{ "colada", 3160, 1 },
+{ "colbert", 3161, 1 },
+{ "cold", 3162, 15 },
+{ "collapsed", 3177, 1 },
+{ "college", 3178, 1 },
+{ "collision", 3179, 1 },
+{ "colombia", 3180, 1 },
+{ "colombian", 3181, 1 },
+{ "colors", 3182, 1 },
+{ "comb", 3183, 1 },
+{ "come", 3184, 1 },
+{ "comedy", 3185, 1 },
+{ "comet", 3186, 1 },
+{ "comic", 3187, 14 },
+{ "comment", 3201, 1 },
+{ "communication", 3202, 36 },
+{ "comoran", 3238, 1 },
+{ "comoros", 3239, 1 },
+{ "compact", 3240, 1 },
+{ "compass", 3241, 1 },
+{ "competition", 3242, 1 },
+{ "compose", 3243, 4 },
+{ "composition", 3247, 1 },
+{ "compress", 3248, 1 },
+{ "compression", 3249, 1 },
+{ "computer", 3250, 14 },
+{ "computing", 3264, 1 },
+{ "concern", 3265, 1 },
+{ "concerned", 3266, 1 },
+{ "concert", 3267, 3 },
+{ "concertina", 3270, 1 },
+{ "concierge", 3271, 1 },
+{ "condiment", 3272, 2 },
+{ "cone", 3274, 1 },
+{ "confetti", 3275, 1 },
+{ "confirm", 3276, 1 },
+{ "confounded", 3277, 1 },
+{ "confuse", 3278, 1 },
+{ "confused", 3279, 8 },
+{ "conga", 3287, 1 },
+{ "congee", 3288, 1 },
+{ "congo", 3289, 2 },
+{ "congrats", 3291, 1 },
+{ "congratulate", 3292, 1 },
+{ "congratulation", 3293, 1 },
+{ "congratulations", 3294, 3 },
+{ "connection", 3297, 1 },
+{ "consider", 3298, 1 },
+{ "console", 3299, 1 },
+{ "constellation", 3300, 1 },
+{ "constraint", 3301, 1 },
+{ "construction", 3302, 9 },
+{ "contactless", 3311, 1 },
+{ "container", 3312, 5 },
+{ "content", 3317, 1 },
+{ "contest", 3318, 2 },
+{ "continue", 3320, 2 },
+{ "contributors", 3322, 1 },
+{ "control", 3323, 2 },
+{ "controller", 3325, 1 },
+{ "convenience", 3326, 1 },
+{ "cook", 3327, 8 },
+{ "cooked", 3335, 1 },
+{ "cookie", 3336, 2 },
+{ "cooking", 3338, 10 },
+{ "cool", 3348, 6 },
+{ "cop", 3354, 5 },
+{ "copyright", 3359, 1 },
+{ "coral", 3360, 1 },
+{ "cork", 3361, 1 },
+{ "corn", 3362, 2 },
+{ "corner", 3364, 1 },
+{ "cornwall", 3365, 1 },
+{ "coronavirus", 3366, 2 },
+{ "correct", 3368, 1 },
+{ "cos", 3369, 1 },
+{ "cosmetics", 3370, 2 },
+{ "cosmonaut", 3372, 2 },
+{ "costa", 3374, 1 },
+{ "costume", 3375, 1 },
+{ "cote", 3376, 1 },
+{ "couch", 3377, 1 },
+{ "count", 3378, 1 },
+{ "countdown", 3379, 1 },
+{ "counterclockwise", 3380, 1 },
+{ "counting", 3381, 1 },
+{ "country", 3382, 248 },
+{ "couple", 3630, 15 },
+{ "couplekiss", 3645, 4 },
+{ "court", 3649, 3 },
+{ "cover", 3652, 1 },
+{ "covering", 3653, 6 },
+{ "covid", 3659, 3 },
+{ "cow", 3662, 6 },
+{ "cow2", 3668, 1 },
+{ "cowboy", 3669, 1 },
+{ "cowgirl", 3670, 2 },
+{ "cozy", 3672, 1 },
+{ "cq", 3673, 1 },
+{ "crab", 3674, 2 },
+{ "cracker", 3676, 1 },
+{ "crafts", 3677, 2 },
+{ "crane", 3679, 1 },
+{ "crap", 3680, 1 },
+{ "crayon", 3681, 1 },
+{ "crazy", 3682, 2 },
+{ "cream", 3684, 4 },
+{ "create", 3688, 3 },
+{ "creativity", 3691, 3 },
+{ "creature", 3694, 7 },
+{ "credentials", 3701, 1 },
+{ "credit", 3702, 1 },
+{ "creepy", 3703, 5 },
+{ "creme", 3708, 1 },
+{ "crepe", 3709, 1 },
+{ "crepes", 3710, 1 },
+{ "crescent", 3711, 5 },
+{ "cricket", 3716, 2 },
+{ "crime", 3718, 1 },
+{ "criminal", 3719, 3 },
+{ "croak", 3722, 1 },
+{ "croatia", 3723, 1 },
+{ "croatian", 3724, 1 },
+{ "croc", 3725, 1 },
+{ "crochet", 3726, 1 },
+{ "crocodile", 3727, 1 },
+{ "croissant", 3728, 1 },
+{ "crook", 3729, 1 },
+{ "crop", 3730, 2 },
+{ "crops", 3732, 1 },
+{ "cross", 3733, 13 },
+{ "crossbones", 3746, 2 },
+{ "crossed", 3748, 7 },
+{ "crossing", 3755, 2 },
+{ "crow", 3757, 1 },
+{ "crown", 3758, 4 },
+{ "cruise", 3762, 2 },
+{ "crush", 3764, 3 },
+{ "crustacean", 3767, 1 },
+{ "crutch", 3768, 1 },
+{ "cry", 3769, 7 },
+{ "crying", 3776, 4 },
+{ "crystal", 3780, 2 },
+{ "cu", 3782, 1 },
+{ "cuba", 3783, 1 },
+{ "cuban", 3784, 1 },
+{ "cube", 3785, 1 },
+{ "cucumber", 3786, 1 },
+{ "cue", 3787, 1 },
+{ "culinary", 3788, 1 },
+{ "culture", 3789, 2 },
+{ "cunha", 3791, 2 },
+{ "cup", 3793, 5 },
+{ "cupcake", 3798, 1 },
+{ "cupertino", 3799, 1 },
+{ "cupid", 3800, 2 },
+{ "cupped", 3802, 1 },
+{ "curacao", 3803, 1 },
+{ "curacaoan", 3804, 1 },
+{ "curious", 3805, 1 },
+{ "curl", 3806, 3 },
+{ "curled", 3809, 1 },
+{ "curling", 3810, 3 },
+{ "curly", 3813, 6 },
+{ "currency", 3819, 8 },
+{ "curry", 3827, 2 },
+{ "cursing", 3829, 1 },
+{ "curtain", 3830, 1 },
+{ "curve", 3831, 1 },
+{ "curved", 3832, 3 },
+{ "curving", 3835, 4 },
+{ "cussing", 3839, 1 },
+{ "custard", 3840, 1 },
+{ "custom", 3841, 1 },
+{ "customs", 3842, 1 },
+{ "cut", 3843, 7 },
+{ "cute", 3850, 3 },
+{ "cuteness", 3853, 1 },
+{ "cutlery", 3854, 4 },
+{ "cutting", 3858, 2 },
+{ "cy", 3860, 1 },
+{ "cycle", 3861, 3 },
+{ "cyclist", 3864, 7 },
+{ "cyclone", 3871, 2 },
+{ "cygnet", 3873, 1 },
+{ "cymru", 3874, 1 },
+{ "cypriot", 3875, 1 },
+{ "cyprus", 3876, 1 },
+{ "cz", 3877, 1 },
+{ "czech", 3878, 1 },
+{ "czechia", 3879, 1 },
+{ "d", 3880, 4 },
+{ "da", 3884, 1 },
+{ "dad", 3885, 2 },
+{ "dagger", 3887, 1 },
+{ "dairy", 3888, 2 },
+{ "daisy", 3890, 1 },
+{ "dam", 3891, 1 },
+{ "dance", 3892, 4 },
+{ "dancer", 3896, 5 },
+{ "dancing", 3901, 5 },
+{ "danger", 3906, 9 },
+{ "dango", 3915, 1 },
+{ "danish", 3916, 1 },
+{ "dark", 3917, 5 },
+{ "dart", 3922, 1 },
+{ "darts", 3923, 1 },
+{ "darussalam", 3924, 1 },
+{ "dash", 3925, 2 },
+{ "dashing", 3927, 1 },
+{ "data", 3928, 1 },
+{ "database", 3929, 1 },
+{ "date", 3930, 7 },
+{ "dating", 3937, 8 },
+{ "daughter", 3945, 10 },
+{ "daughters", 3955, 5 },
+{ "david", 3960, 1 },
+{ "dawn", 3961, 2 },
+{ "day", 3963, 2 },
+{ "dazed", 3965, 1 },
+{ "ddraig", 3966, 1 },
+{ "de", 3967, 2 },
+{ "dead", 3969, 9 },
+{ "deadline", 3978, 1 },
+{ "deadly", 3979, 1 },
+{ "deadpan", 3980, 2 },
+{ "deaf", 3982, 4 },
+{ "deal", 3986, 2 },
+{ "death", 3988, 5 },
+{ "december", 3993, 1 },
+{ "deciduous", 3994, 1 },
+{ "deck", 3995, 1 },
+{ "decline", 3996, 1 },
+{ "decorated", 3997, 1 },
+{ "decoration", 3998, 6 },
+{ "decorative", 4004, 2 },
+{ "decrease", 4006, 1 },
+{ "decreasing", 4007, 1 },
+{ "deeply", 4008, 3 },
+{ "deer", 4011, 1 },
+{ "degree", 4012, 2 },
+{ "dejected", 4014, 1 },
+{ "delete", 4015, 1 },
+{ "deli", 4016, 1 },
+{ "delicious", 4017, 3 },
+{ "delivery", 4020, 2 },
+{ "demand", 4022, 1 },
+{ "democratic", 4023, 2 },
+{ "demon", 4025, 2 },
+{ "demonstration", 4027, 1 },
+{ "denied", 4028, 5 },
+{ "denim", 4033, 1 },
+{ "denmark", 4034, 1 },
+{ "dental", 4035, 1 },
+{ "dentist", 4036, 4 },
+{ "deny", 4040, 1 },
+{ "department", 4041, 2 },
+{ "departure", 4043, 1 },
+{ "departures", 4044, 1 },
+{ "deploy", 4045, 2 },
+{ "depressed", 4047, 7 },
+{ "depression", 4054, 1 },
+{ "derby", 4055, 1 },
+{ "derelict", 4056, 1 },
+{ "desert", 4057, 5 },
+{ "design", 4062, 3 },
+{ "desk", 4065, 4 },
+{ "desktop", 4069, 2 },
+{ "despise", 4071, 1 },
+{ "dessert", 4072, 16 },
+{ "destination", 4088, 1 },
+{ "detective", 4089, 5 },
+{ "deutsch", 4094, 1 },
+{ "developer", 4095, 3 },
+{ "devil", 4098, 4 },
+{ "dharma", 4102, 1 },
+{ "dhikr", 4103, 1 },
+{ "diagonal", 4104, 5 },
+{ "dial", 4109, 4 },
+{ "dialog", 4113, 2 },
+{ "diamond", 4115, 9 },
+{ "diamonds", 4124, 1 },
+{ "diaper", 4125, 1 },
+{ "dice", 4126, 1 },
+{ "die", 4127, 3 },
+{ "diego", 4130, 2 },
+{ "diesel", 4132, 2 },
+{ "dig", 4134, 2 },
+{ "digit", 4136, 10 },
+{ "digital", 4146, 2 },
+{ "dim", 4148, 1 },
+{ "diners", 4149, 1 },
+{ "ding", 4150, 1 },
+{ "dinghy", 4151, 1 },
+{ "dining", 4152, 1 },
+{ "dinner", 4153, 1 },
+{ "dinosaur", 4154, 2 },
+{ "diplodocus", 4156, 1 },
+{ "direct", 4157, 1 },
+{ "direction", 4158, 27 },
+{ "director", 4185, 1 },
+{ "directory", 4186, 1 },
+{ "dirt", 4187, 1 },
+{ "disability", 4188, 13 },
+{ "disabled", 4201, 2 },
+{ "disallow", 4203, 1 },
+{ "disappear", 4204, 3 },
+{ "disappointed", 4207, 5 },
+{ "disapproval", 4212, 1 },
+{ "disapprove", 4213, 2 },
+{ "disaster", 4215, 2 },
+{ "disbelief", 4217, 5 },
+{ "disc", 4222, 3 },
+{ "disco", 4225, 3 },
+{ "discount", 4228, 1 },
+{ "discouraged", 4229, 2 },
+{ "disease", 4231, 3 },
+{ "disguise", 4234, 1 },
+{ "disguised", 4235, 1 },
+{ "disgust", 4236, 1 },
+{ "disgusted", 4237, 1 },
+{ "dish", 4238, 2 },
+{ "disk", 4240, 4 },
+{ "dislike", 4244, 1 },
+{ "dismiss", 4245, 1 },
+{ "display", 4246, 1 },
+{ "dissatisfied", 4247, 1 },
+{ "dissolve", 4248, 1 },
+{ "distilling", 4249, 1 },
+{ "distraught", 4250, 2 },
+{ "distress", 4252, 1 },
+{ "distrust", 4253, 1 },
+{ "dito", 4254, 1 },
+{ "divide", 4255, 2 },
+{ "dividers", 4257, 1 },
+{ "diving", 4258, 2 },
+{ "division", 4260, 1 },
+{ "divoire", 4261, 1 },
+{ "diy", 4262, 2 },
+{ "diya", 4264, 1 },
+{ "dizzy", 4265, 6 },
+{ "dj", 4271, 1 },
+{ "djembe", 4272, 1 },
+{ "djibouti", 4273, 1 },
+{ "djiboutian", 4274, 1 },
+{ "djinn", 4275, 3 },
+{ "djinni", 4278, 1 },
+{ "dk", 4279, 1 },
+{ "dm", 4280, 1 },
+{ "dna", 4281, 1 },
+{ "do", 4282, 1 },
+{ "doctor", 4283, 13 },
+{ "document", 4296, 5 },
+{ "documentation", 4301, 1 },
+{ "documents", 4302, 11 },
+{ "dodo", 4313, 1 },
+{ "dog", 4314, 8 },
+{ "dog2", 4322, 1 },
+{ "doge", 4323, 1 },
+{ "dogeza", 4324, 1 },
+{ "doggo", 4325, 1 },
+{ "doily", 4326, 1 },
+{ "doing", 4327, 3 },
+{ "doll", 4330, 2 },
+{ "dollar", 4332, 9 },
+{ "dolls", 4341, 2 },
+{ "dolphin", 4343, 1 },
+{ "dom", 4344, 1 },
+{ "domed", 4345, 1 },
+{ "domestic", 4346, 2 },
+{ "dominica", 4348, 1 },
+{ "dominican", 4349, 1 },
+{ "donation", 4350, 1 },
+{ "done", 4351, 3 },
+{ "doner", 4354, 1 },
+{ "donkey", 4355, 1 },
+{ "donut", 4356, 1 },
+{ "door", 4357, 3 },
+{ "doorway", 4360, 1 },
+{ "dork", 4361, 2 },
+{ "dormouse", 4363, 1 },
+{ "dot", 4364, 3 },
+{ "dotted", 4367, 2 },
+{ "double", 4369, 11 },
+{ "doubt", 4380, 4 },
+{ "doubts", 4384, 1 },
+{ "doughnut", 4385, 1 },
+{ "dove", 4386, 1 },
+{ "down", 4387, 15 },
+{ "downcast", 4402, 1 },
+{ "downgrade", 4403, 1 },
+{ "downtown", 4404, 1 },
+{ "downwards", 4405, 7 },
+{ "dracula", 4412, 3 },
+{ "dragon", 4415, 4 },
+{ "drained", 4419, 1 },
+{ "drama", 4420, 2 },
+{ "draw", 4422, 4 },
+{ "drawing", 4426, 3 },
+{ "drc", 4429, 1 },
+{ "dread", 4430, 1 },
+{ "dream", 4431, 3 },
+{ "dress", 4434, 5 },
+{ "dressing", 4439, 1 },
+{ "drink", 4440, 22 },
+{ "drinking", 4462, 2 },
+{ "drinks", 4464, 1 },
+{ "drip", 4465, 2 },
+{ "driving", 4467, 2 },
+{ "drizzle", 4469, 1 },
+{ "dromedary", 4470, 1 },
+{ "drool", 4471, 1 },
+{ "drooling", 4472, 1 },
+{ "drooping", 4473, 1 },
+{ "drop", 4474, 4 },
+{ "droplet", 4478, 1 },
+{ "droplets", 4479, 1 },
+{ "dropped", 4480, 1 },
+{ "drops", 4481, 2 },
+{ "drug", 4483, 1 },
+{ "drugs", 4484, 2 },
+{ "drum", 4486, 3 },
+{ "drumstick", 4489, 2 },
+{ "drumsticks", 4491, 1 },
+{ "drunk", 4492, 8 },
+{ "dua", 4500, 1 },
+{ "dubious", 4501, 1 },
+{ "duck", 4502, 2 },
+{ "duckling", 4504, 1 },
+{ "dumpling", 4505, 1 },
+{ "dumplings", 4506, 1 },
+{ "dung", 4507, 1 },
+{ "dupe", 4508, 1 },
+{ "dusk", 4509, 3 },
+{ "dutch", 4512, 2 },
+{ "dvd", 4514, 2 },
+{ "dynamite", 4516, 1 },
+{ "dz", 4517, 1 },
+{ "e", 4518, 2 },
+{ "eagle", 4520, 1 },
+{ "ear", 4521, 8 },
+{ "earbud", 4529, 1 },
+{ "early", 4530, 24 },
+{ "earphone", 4554, 1 },
+{ "earphones", 4555, 1 },
+{ "ears", 4556, 8 },
+{ "earth", 4564, 4 },
+{ "earthquake", 4568, 1 },
+{ "earthworm", 4569, 1 },
+{ "east", 4570, 5 },
+{ "easter", 4575, 3 },
+{ "eat", 4578, 1 },
+{ "ec", 4579, 1 },
+{ "eclipse", 4580, 1 },
+{ "economics", 4581, 3 },
+{ "ecuador", 4584, 1 },
+{ "ecuadorian", 4585, 1 },
+{ "edge", 4586, 1 },
+{ "education", 4587, 9 },
+{ "educator", 4596, 3 },
+{ "ee", 4599, 1 },
+{ "eek", 4600, 1 },
+{ "eeyore", 4601, 1 },
+{ "eg", 4602, 1 },
+{ "egg", 4603, 3 },
+{ "eggplant", 4606, 1 },
+{ "eggs", 4607, 1 },
+{ "egypt", 4608, 1 },
+{ "egyptian", 4609, 1 },
+{ "eiffel", 4610, 1 },
+{ "eight", 4611, 6 },
+{ "eighteen", 4617, 1 },
+{ "eighth", 4618, 1 },
+{ "eject", 4619, 1 },
+{ "el", 4620, 1 },
+{ "elder", 4621, 6 },
+{ "elderly", 4627, 2 },
+{ "election", 4629, 3 },
+{ "electric", 4632, 8 },
+{ "electrician", 4640, 3 },
+{ "electricity", 4643, 3 },
+{ "electronic", 4646, 1 },
+{ "elementary", 4647, 1 },
+{ "elephant", 4648, 2 },
+{ "elevator", 4650, 1 },
+{ "eleven", 4651, 3 },
+{ "elf", 4654, 3 },
+{ "email", 4657, 15 },
+{ "embarrass", 4672, 1 },
+{ "embarrassed", 4673, 2 },
+{ "embarrassing", 4675, 2 },
+{ "emblem", 4677, 1 },
+{ "embroidery", 4678, 1 },
+{ "emergency", 4679, 4 },
+{ "emirates", 4683, 1 },
+{ "emirati", 4684, 1 },
+{ "emoji", 4685, 2 },
+{ "empanada", 4687, 1 },
+{ "empty", 4688, 4 },
+{ "end", 4692, 1 },
+{ "energy", 4693, 2 },
+{ "enforcement", 4695, 4 },
+{ "engaged", 4699, 1 },
+{ "engagement", 4700, 1 },
+{ "engine", 4701, 2 },
+{ "engineer", 4703, 6 },
+{ "england", 4709, 3 },
+{ "english", 4712, 2 },
+{ "enraged", 4714, 1 },
+{ "ensnare", 4715, 1 },
+{ "enter", 4716, 1 },
+{ "enterprise", 4717, 1 },
+{ "entertainer", 4718, 3 },
+{ "entertainment", 4721, 55 },
+{ "enthusiastic", 4776, 1 },
+{ "entrance", 4777, 1 },
+{ "entry", 4778, 3 },
+{ "envelope", 4781, 7 },
+{ "environment", 4788, 4 },
+{ "equality", 4792, 1 },
+{ "equals", 4793, 1 },
+{ "equatoguinean", 4794, 1 },
+{ "equatorial", 4795, 1 },
+{ "equestrian", 4796, 1 },
+{ "er", 4797, 1 },
+{ "eritrea", 4798, 1 },
+{ "eritrean", 4799, 1 },
+{ "error", 4800, 3 },
+{ "eruption", 4803, 1 },
+{ "es", 4804, 1 },
+{ "espresso", 4805, 1 },
+{ "estonia", 4806, 1 },
+{ "estonian", 4807, 1 },
+{ "eswatini", 4808, 1 },
+{ "et", 4809, 2 },
+{ "ethiopia", 4811, 1 },
+{ "ethiopian", 4812, 1 },
+{ "eu", 4813, 1 },
+{ "euro", 4814, 1 },
+{ "europe", 4815, 1 },
+{ "european", 4816, 3 },
+{ "eustatius", 4819, 1 },
+{ "evening", 4820, 15 },
+{ "event", 4835, 1 },
+{ "evergreen", 4836, 1 },
+{ "evict", 4837, 1 },
+{ "evidence", 4838, 1 },
+{ "evil", 4839, 14 },
+{ "evolution", 4853, 1 },
+{ "ewe", 4854, 1 },
+{ "exam", 4855, 3 },
+{ "exasperation", 4858, 3 },
+{ "exchange", 4861, 2 },
+{ "excited", 4863, 4 },
+{ "exclamation", 4867, 8 },
+{ "exercise", 4875, 18 },
+{ "exhalation", 4893, 1 },
+{ "exhale", 4894, 1 },
+{ "exhaling", 4895, 1 },
+{ "exhausted", 4896, 2 },
+{ "exist", 4898, 1 },
+{ "exit", 4899, 1 },
+{ "expendable", 4900, 1 },
+{ "expenses", 4901, 1 },
+{ "expensive", 4902, 1 },
+{ "experience", 4903, 1 },
+{ "experiment", 4904, 4 },
+{ "expletive", 4908, 1 },
+{ "explode", 4909, 3 },
+{ "exploding", 4912, 1 },
+{ "exploration", 4913, 1 },
+{ "explosion", 4914, 5 },
+{ "explosive", 4919, 1 },
+{ "express", 4920, 1 },
+{ "expressionless", 4921, 1 },
+{ "extended", 4922, 1 },
+{ "external", 4923, 1 },
+{ "extinct", 4924, 4 },
+{ "extinction", 4928, 2 },
+{ "extinguish", 4930, 1 },
+{ "extinguisher", 4931, 1 },
+{ "extraterrestrial", 4932, 3 },
+{ "eye", 4935, 28 },
+{ "eyeballs", 4963, 1 },
+{ "eyebrow", 4964, 2 },
+{ "eyed", 4966, 1 },
+{ "eyeglasses", 4967, 1 },
+{ "eyeroll", 4968, 1 },
+{ "eyes", 4969, 29 },
+{ "eyesight", 4998, 1 },
+{ "eyewear", 4999, 3 },
+{ "f1", 5002, 1 },
+{ "face", 5003, 204 },
+{ "faced", 5207, 1 },
+{ "facepalm", 5208, 3 },
+{ "facepalming", 5211, 3 },
+{ "facepunch", 5214, 1 },
+{ "facial", 5215, 2 },
+{ "facing", 5217, 23 },
+{ "facsimile", 5240, 1 },
+{ "factory", 5241, 4 },
+{ "fail", 5245, 2 },
+{ "failure", 5247, 1 },
+{ "fairground", 5248, 2 },
+{ "fairness", 5250, 1 },
+{ "fairy", 5251, 20 },
+{ "faithful", 5271, 2 },
+{ "falafel", 5273, 2 },
+{ "falfel", 5275, 1 },
+{ "falkland", 5276, 1 },
+{ "falklander", 5277, 1 },
+{ "falklands", 5278, 1 },
+{ "fall", 5279, 5 },
+{ "fallen", 5284, 1 },
+{ "falling", 5285, 3 },
+{ "family", 5288, 30 },
+{ "fan", 5318, 1 },
+{ "fancy", 5319, 1 },
+{ "fantasy", 5320, 41 },
+{ "farewell", 5361, 1 },
+{ "farm", 5362, 4 },
+{ "farmer", 5366, 3 },
+{ "farming", 5369, 6 },
+{ "faroe", 5375, 1 },
+{ "fart", 5376, 1 },
+{ "fashion", 5377, 21 },
+{ "faso", 5398, 1 },
+{ "fast", 5399, 12 },
+{ "father", 5411, 18 },
+{ "fathers", 5429, 5 },
+{ "fatima", 5434, 1 },
+{ "faucet", 5435, 3 },
+{ "favor", 5438, 2 },
+{ "favorite", 5440, 2 },
+{ "fax", 5442, 1 },
+{ "fear", 5443, 4 },
+{ "fearful", 5447, 2 },
+{ "feather", 5449, 1 },
+{ "feats", 5450, 1 },
+{ "feature", 5451, 1 },
+{ "fed", 5452, 2 },
+{ "federated", 5454, 1 },
+{ "federation", 5455, 1 },
+{ "feeding", 5456, 5 },
+{ "feet", 5461, 4 },
+{ "feline", 5465, 1 },
+{ "female", 5466, 122 },
+{ "fencer", 5588, 1 },
+{ "fencing", 5589, 1 },
+{ "ferris", 5590, 1 },
+{ "ferry", 5591, 3 },
+{ "festival", 5594, 9 },
+{ "festivus", 5603, 1 },
+{ "fever", 5604, 2 },
+{ "feverish", 5606, 1 },
+{ "fi", 5607, 1 },
+{ "field", 5608, 2 },
+{ "fighter", 5610, 1 },
+{ "fighting", 5611, 1 },
+{ "fiji", 5612, 1 },
+{ "fijian", 5613, 1 },
+{ "file", 5614, 4 },
+{ "filing", 5618, 1 },
+{ "filling", 5619, 1 },
+{ "film", 5620, 6 },
+{ "films", 5626, 1 },
+{ "find", 5627, 2 },
+{ "fine", 5629, 1 },
+{ "finger", 5630, 15 },
+{ "fingerprint", 5645, 1 },
+{ "fingers", 5646, 19 },
+{ "finish", 5665, 1 },
+{ "finishline", 5666, 1 },
+{ "finland", 5667, 1 },
+{ "finnish", 5668, 1 },
+{ "fins", 5669, 2 },
+{ "fir", 5671, 1 },
+{ "fire", 5672, 9 },
+{ "firecracker", 5681, 1 },
+{ "firefighter", 5682, 3 },
+{ "fireman", 5685, 2 },
+{ "firetruck", 5687, 3 },
+{ "firework", 5690, 1 },
+{ "fireworks", 5691, 4 },
+{ "first", 5695, 3 },
+{ "fish", 5698, 10 },
+{ "fishcake", 5708, 1 },
+{ "fisherman", 5709, 1 },
+{ "fishing", 5710, 3 },
+{ "fist", 5713, 4 },
+{ "fistbump", 5717, 2 },
+{ "fisted", 5719, 1 },
+{ "five", 5720, 6 },
+{ "fix", 5726, 3 },
+{ "fj", 5729, 1 },
+{ "flag", 5730, 276 },
+{ "flags", 6006, 2 },
+{ "flamboyant", 6008, 1 },
+{ "flame", 6009, 1 },
+{ "flamenco", 6010, 1 },
+{ "flamingo", 6011, 1 },
+{ "flan", 6012, 1 },
+{ "flapjacks", 6013, 1 },
+{ "flash", 6014, 1 },
+{ "flashing", 6015, 1 },
+{ "flashlight", 6016, 1 },
+{ "flat", 6017, 2 },
+{ "flatbread", 6019, 2 },
+{ "flattered", 6021, 1 },
+{ "flavoring", 6022, 2 },
+{ "fleur", 6024, 1 },
+{ "flex", 6025, 1 },
+{ "flexed", 6026, 1 },
+{ "flexing", 6027, 1 },
+{ "flick", 6028, 1 },
+{ "flight", 6029, 6 },
+{ "flip", 6035, 2 },
+{ "flipped", 6037, 1 },
+{ "flipper", 6038, 1 },
+{ "flipping", 6039, 1 },
+{ "flirt", 6040, 3 },
+{ "flirting", 6043, 2 },
+{ "float", 6045, 1 },
+{ "floor", 6046, 1 },
+{ "floppy", 6047, 1 },
+{ "flops", 6048, 2 },
+{ "flour", 6050, 1 },
+{ "flower", 6051, 14 },
+{ "flowers", 6065, 5 },
+{ "flowing", 6070, 1 },
+{ "fluctuate", 6071, 1 },
+{ "flushed", 6072, 2 },
+{ "flute", 6074, 1 },
+{ "flutter", 6075, 1 },
+{ "fluttering", 6076, 1 },
+{ "fly", 6077, 14 },
+{ "flying", 6091, 4 },
+{ "fog", 6095, 3 },
+{ "foggy", 6098, 1 },
+{ "folded", 6099, 1 },
+{ "folder", 6100, 2 },
+{ "folding", 6102, 1 },
+{ "fondue", 6103, 1 },
+{ "food", 6104, 106 },
+{ "foot", 6210, 1 },
+{ "football", 6211, 3 },
+{ "footprint", 6214, 1 },
+{ "footprints", 6215, 2 },
+{ "footsteps", 6217, 1 },
+{ "footwear", 6218, 2 },
+{ "for", 6220, 11 },
+{ "forbid", 6231, 3 },
+{ "forbidden", 6234, 17 },
+{ "force", 6251, 1 },
+{ "forever", 6252, 1 },
+{ "forgetful", 6253, 1 },
+{ "fork", 6254, 2 },
+{ "form", 6256, 1 },
+{ "formal", 6257, 4 },
+{ "formula", 6261, 1 },
+{ "fortress", 6262, 1 },
+{ "fortune", 6263, 3 },
+{ "forward", 6266, 5 },
+{ "foul", 6271, 1 },
+{ "fountain", 6272, 4 },
+{ "four", 6276, 4 },
+{ "fox", 6280, 1 },
+{ "fr", 6281, 1 },
+{ "frame", 6282, 4 },
+{ "framed", 6286, 1 },
+{ "frames", 6287, 1 },
+{ "france", 6288, 2 },
+{ "frankfurter", 6290, 1 },
+{ "free", 6291, 3 },
+{ "freezing", 6294, 1 },
+{ "french", 6295, 8 },
+{ "fresh", 6303, 3 },
+{ "freshwater", 6306, 1 },
+{ "fried", 6307, 2 },
+{ "friend", 6309, 2 },
+{ "friends", 6311, 1 },
+{ "friendship", 6312, 3 },
+{ "fries", 6315, 1 },
+{ "frightening", 6316, 1 },
+{ "frisbee", 6317, 1 },
+{ "frog", 6318, 1 },
+{ "from", 6319, 1 },
+{ "front", 6320, 7 },
+{ "frostbite", 6327, 1 },
+{ "frosty", 6328, 1 },
+{ "frown", 6329, 6 },
+{ "frowning", 6335, 6 },
+{ "frozen", 6341, 3 },
+{ "fruit", 6344, 26 },
+{ "frustrated", 6370, 6 },
+{ "frying", 6376, 1 },
+{ "ftw", 6377, 1 },
+{ "fu", 6378, 1 },
+{ "fuel", 6379, 1 },
+{ "fuelpump", 6380, 1 },
+{ "fugu", 6381, 1 },
+{ "fuji", 6382, 1 },
+{ "full", 6383, 6 },
+{ "fullness", 6389, 1 },
+{ "fun", 6390, 6 },
+{ "funeral", 6396, 2 },
+{ "fungus", 6398, 2 },
+{ "funicular", 6400, 1 },
+{ "funny", 6401, 2 },
+{ "furin", 6403, 1 },
+{ "furniture", 6404, 1 },
+{ "futuna", 6405, 1 },
+{ "future", 6406, 1 },
+{ "ga", 6407, 1 },
+{ "gabon", 6408, 1 },
+{ "gabonese", 6409, 1 },
+{ "gadgets", 6410, 4 },
+{ "galaxy", 6414, 1 },
+{ "galloping", 6415, 1 },
+{ "gambia", 6416, 1 },
+{ "gambian", 6417, 1 },
+{ "gamble", 6418, 2 },
+{ "gambling", 6420, 3 },
+{ "game", 6423, 26 },
+{ "gamepad", 6449, 1 },
+{ "garbage", 6450, 3 },
+{ "garcia", 6453, 2 },
+{ "garden", 6455, 2 },
+{ "gardener", 6457, 3 },
+{ "garlic", 6460, 1 },
+{ "gas", 6461, 2 },
+{ "gasp", 6463, 3 },
+{ "gasping", 6466, 1 },
+{ "gate", 6467, 1 },
+{ "gay", 6468, 10 },
+{ "gb", 6478, 3 },
+{ "gd", 6481, 1 },
+{ "ge", 6482, 1 },
+{ "gear", 6483, 1 },
+{ "gecko", 6484, 1 },
+{ "geek", 6485, 2 },
+{ "gem", 6487, 7 },
+{ "gemini", 6494, 1 },
+{ "gemstone", 6495, 1 },
+{ "gender", 6496, 13 },
+{ "gene", 6509, 1 },
+{ "genetics", 6510, 1 },
+{ "genie", 6511, 3 },
+{ "gentleman", 6514, 1 },
+{ "geometric", 6515, 34 },
+{ "george", 6549, 1 },
+{ "georgia", 6550, 2 },
+{ "georgian", 6552, 1 },
+{ "germ", 6553, 1 },
+{ "german", 6554, 1 },
+{ "germany", 6555, 2 },
+{ "germs", 6557, 1 },
+{ "gesture", 6558, 28 },
+{ "gesturing", 6586, 6 },
+{ "gesundheit", 6592, 1 },
+{ "get", 6593, 1 },
+{ "getting", 6594, 6 },
+{ "gg", 6600, 1 },
+{ "gh", 6601, 1 },
+{ "ghana", 6602, 1 },
+{ "ghanaian", 6603, 1 },
+{ "gherkin", 6604, 1 },
+{ "ghost", 6605, 1 },
+{ "ghoul", 6606, 1 },
+{ "gi", 6607, 1 },
+{ "gibbous", 6608, 2 },
+{ "gibraltar", 6610, 1 },
+{ "gibraltarian", 6611, 1 },
+{ "gift", 6612, 4 },
+{ "ginger", 6616, 3 },
+{ "gingerbread", 6619, 1 },
+{ "giraffe", 6620, 1 },
+{ "girl", 6621, 38 },
+{ "girls", 6659, 2 },
+{ "give", 6661, 1 },
+{ "gl", 6662, 1 },
+{ "glad", 6663, 1 },
+{ "glass", 6664, 9 },
+{ "glasses", 6673, 6 },
+{ "glide", 6679, 1 },
+{ "glitter", 6680, 2 },
+{ "glittery", 6682, 1 },
+{ "global", 6683, 1 },
+{ "globe", 6684, 4 },
+{ "gloss", 6688, 1 },
+{ "glossy", 6689, 1 },
+{ "glove", 6690, 2 },
+{ "gloves", 6692, 1 },
+{ "glow", 6693, 1 },
+{ "glowing", 6694, 1 },
+{ "glyphs", 6695, 1 },
+{ "gm", 6696, 1 },
+{ "gn", 6697, 2 },
+{ "go", 6699, 2 },
+{ "goal", 6701, 2 },
+{ "goat", 6703, 2 },
+{ "goblin", 6705, 2 },
+{ "goch", 6707, 1 },
+{ "goggles", 6708, 1 },
+{ "goguma", 6709, 1 },
+{ "gokart", 6710, 1 },
+{ "gold", 6711, 6 },
+{ "golden", 6717, 2 },
+{ "golf", 6719, 6 },
+{ "golfer", 6725, 3 },
+{ "golfing", 6728, 3 },
+{ "gondola", 6731, 2 },
+{ "good", 6733, 18 },
+{ "goodbye", 6751, 2 },
+{ "goofy", 6753, 2 },
+{ "goose", 6755, 1 },
+{ "gooseberry", 6756, 1 },
+{ "goosebumps", 6757, 1 },
+{ "gorilla", 6758, 1 },
+{ "gourd", 6759, 1 },
+{ "gown", 6760, 2 },
+{ "gp", 6762, 1 },
+{ "gps", 6763, 1 },
+{ "gr", 6764, 1 },
+{ "grade", 6765, 1 },
+{ "graduate", 6766, 4 },
+{ "graduation", 6770, 3 },
+{ "grain", 6773, 1 },
+{ "grandma", 6774, 1 },
+{ "grandpa", 6775, 1 },
+{ "grandstand", 6776, 1 },
+{ "granny", 6777, 1 },
+{ "grape", 6778, 1 },
+{ "grapes", 6779, 1 },
+{ "graph", 6780, 5 },
+{ "grasp", 6785, 1 },
+{ "grass", 6786, 4 },
+{ "grasshopper", 6790, 1 },
+{ "grateful", 6791, 1 },
+{ "gratitude", 6792, 1 },
+{ "grave", 6793, 1 },
+{ "graveyard", 6794, 2 },
+{ "grawlix", 6796, 1 },
+{ "gray", 6797, 3 },
+{ "great", 6800, 2 },
+{ "greece", 6802, 1 },
+{ "greek", 6803, 2 },
+{ "green", 6805, 24 },
+{ "greenery", 6829, 1 },
+{ "greenland", 6830, 1 },
+{ "greenlandic", 6831, 1 },
+{ "greens", 6832, 1 },
+{ "grenada", 6833, 1 },
+{ "grenadian", 6834, 1 },
+{ "grenadines", 6835, 1 },
+{ "grey", 6836, 4 },
+{ "grid", 6840, 1 },
+{ "gridiron", 6841, 1 },
+{ "grievance", 6842, 1 },
+{ "grievances", 6843, 1 },
+{ "grimace", 6844, 1 },
+{ "grimacing", 6845, 1 },
+{ "grin", 6846, 5 },
+{ "grinning", 6851, 10 },
+{ "groan", 6861, 1 },
+{ "groceries", 6862, 1 },
+{ "groggy", 6863, 1 },
+{ "groom", 6864, 4 },
+{ "gross", 6868, 1 },
+{ "ground", 6869, 1 },
+{ "group", 6870, 2 },
+{ "grow", 6872, 1 },
+{ "growing", 6873, 1 },
+{ "growth", 6874, 2 },
+{ "grumpy", 6876, 3 },
+{ "gt", 6879, 1 },
+{ "gu", 6880, 1 },
+{ "gua", 6881, 1 },
+{ "guadeloupe", 6882, 1 },
+{ "guadeloupean", 6883, 1 },
+{ "guam", 6884, 1 },
+{ "guamanian", 6885, 1 },
+{ "guanaco", 6886, 1 },
+{ "guard", 6887, 3 },
+{ "guardsman", 6890, 3 },
+{ "guardswoman", 6893, 1 },
+{ "guatemala", 6894, 1 },
+{ "guatemalan", 6895, 1 },
+{ "guernsey", 6896, 1 },
+{ "guiana", 6897, 1 },
+{ "guide", 6898, 1 },
+{ "guinea", 6899, 4 },
+{ "guinean", 6903, 4 },
+{ "guitar", 6907, 1 },
+{ "gun", 6908, 1 },
+{ "gust", 6909, 2 },
+{ "guy", 6911, 5 },
+{ "guyana", 6916, 1 },
+{ "guyanese", 6917, 1 },
+{ "gw", 6918, 1 },
+{ "gy", 6919, 1 },
+{ "gym", 6920, 3 },
+{ "gymnast", 6923, 1 },
+{ "gymnastic", 6924, 1 },
+{ "gymnastics", 6925, 3 },
+{ "gyoza", 6928, 1 },
+{ "gyro", 6929, 1 },
+{ "h", 6930, 1 },
+{ "haha", 6931, 7 },
+{ "hair", 6938, 21 },
+{ "haircut", 6959, 4 },
+{ "hairdresser", 6963, 2 },
+{ "haired", 6965, 12 },
+{ "hairless", 6977, 3 },
+{ "hairstyle", 6980, 8 },
+{ "haiti", 6988, 1 },
+{ "haitian", 6989, 1 },
+{ "hallelujah", 6990, 1 },
+{ "halloween", 6991, 8 },
+{ "halo", 6999, 2 },
+{ "halt", 7001, 3 },
+{ "hamam", 7004, 3 },
+{ "hamburger", 7007, 1 },
+{ "hammer", 7008, 3 },
+{ "hamsa", 7011, 1 },
+{ "hamster", 7012, 1 },
+{ "hanabi", 7013, 1 },
+{ "hanafuda", 7014, 1 },
+{ "hand", 7015, 62 },
+{ "handbag", 7077, 1 },
+{ "handball", 7078, 3 },
+{ "handgun", 7081, 1 },
+{ "handle", 7082, 1 },
+{ "hands", 7083, 16 },
+{ "handset", 7099, 1 },
+{ "handshake", 7100, 1 },
+{ "handy", 7101, 1 },
+{ "handyman", 7102, 1 },
+{ "hang", 7103, 1 },
+{ "hankey", 7104, 1 },
+{ "hanukkah", 7105, 1 },
+{ "happiness", 7106, 2 },
+{ "happy", 7108, 22 },
+{ "happytears", 7130, 1 },
+{ "hard", 7131, 3 },
+{ "harm", 7134, 1 },
+{ "harp", 7135, 1 },
+{ "harvest", 7136, 1 },
+{ "hash", 7137, 1 },
+{ "hashi", 7138, 1 },
+{ "hashtag", 7139, 1 },
+{ "hat", 7140, 10 },
+{ "hatched", 7150, 1 },
+{ "hatchet", 7151, 1 },
+{ "hatching", 7152, 1 },
+{ "hate", 7153, 1 },
+{ "haunted", 7154, 1 },
+{ "have", 7155, 1 },
+{ "haze", 7156, 1 },
+{ "head", 7157, 16 },
+{ "headdress", 7173, 1 },
+{ "heading", 7174, 2 },
+{ "headline", 7176, 2 },
+{ "headphone", 7178, 1 },
+{ "headphones", 7179, 1 },
+{ "headscarf", 7180, 1 },
+{ "headstone", 7181, 1 },
+{ "heal", 7182, 1 },
+{ "healing", 7183, 1 },
+{ "health", 7184, 10 },
+{ "healthcare", 7194, 3 },
+{ "healthcheck", 7197, 1 },
+{ "healthier", 7198, 1 },
+{ "healthy", 7199, 1 },
+{ "hear", 7200, 3 },
+{ "heard", 7203, 2 },
+{ "hearing", 7205, 2 },
+{ "heart", 7207, 45 },
+{ "heartbeat", 7252, 2 },
+{ "heartbreak", 7254, 1 },
+{ "heartpulse", 7255, 1 },
+{ "hearts", 7256, 4 },
+{ "heat", 7260, 2 },
+{ "heaven", 7262, 2 },
+{ "heavy", 7264, 14 },
+{ "hedgehog", 7278, 1 },
+{ "heel", 7279, 1 },
+{ "heeled", 7280, 3 },
+{ "heels", 7283, 1 },
+{ "helena", 7284, 1 },
+{ "helicopter", 7285, 1 },
+{ "helix", 7286, 1 },
+{ "hello", 7287, 2 },
+{ "helm", 7289, 1 },
+{ "helmet", 7290, 5 },
+{ "help", 7295, 4 },
+{ "helpless", 7299, 1 },
+{ "hen", 7300, 1 },
+{ "herb", 7301, 1 },
+{ "herd", 7302, 1 },
+{ "here", 7303, 3 },
+{ "hero", 7306, 4 },
+{ "heroine", 7310, 3 },
+{ "herzegovina", 7313, 1 },
+{ "heterosexual", 7314, 1 },
+{ "hexagram", 7315, 1 },
+{ "hi", 7316, 1 },
+{ "hibiscus", 7317, 1 },
+{ "hidden", 7318, 1 },
+{ "hide", 7319, 1 },
+{ "high", 7320, 12 },
+{ "highfive", 7332, 4 },
+{ "highway", 7336, 1 },
+{ "hijab", 7337, 1 },
+{ "hike", 7338, 3 },
+{ "hiking", 7341, 1 },
+{ "hinamatsuri", 7342, 1 },
+{ "hindu", 7343, 2 },
+{ "hinduism", 7345, 5 },
+{ "hippie", 7350, 1 },
+{ "hippo", 7351, 1 },
+{ "hippopotamus", 7352, 1 },
+{ "hipster", 7353, 3 },
+{ "hiss", 7356, 1 },
+{ "history", 7357, 3 },
+{ "hit", 7360, 2 },
+{ "hitting", 7362, 1 },
+{ "hmmm", 7363, 2 },
+{ "hn", 7365, 1 },
+{ "hobby", 7366, 6 },
+{ "hocho", 7372, 1 },
+{ "hockey", 7373, 2 },
+{ "hog", 7375, 1 },
+{ "hoist", 7376, 1 },
+{ "hold", 7377, 4 },
+{ "holding", 7381, 5 },
+{ "hole", 7386, 2 },
+{ "hollow", 7388, 1 },
+{ "hollywood", 7389, 1 },
+{ "home", 7390, 28 },
+{ "homosexual", 7418, 1 },
+{ "honduran", 7419, 1 },
+{ "honduras", 7420, 1 },
+{ "honey", 7421, 3 },
+{ "honeybee", 7424, 1 },
+{ "honeydew", 7425, 1 },
+{ "honeypot", 7426, 1 },
+{ "hong", 7427, 1 },
+{ "hongbao", 7428, 1 },
+{ "honk", 7429, 1 },
+{ "hook", 7430, 3 },
+{ "hoop", 7433, 1 },
+{ "hooray", 7434, 2 },
+{ "hoot", 7436, 1 },
+{ "hop", 7437, 1 },
+{ "hope", 7438, 1 },
+{ "hopeful", 7439, 1 },
+{ "horizontal", 7440, 2 },
+{ "horizontally", 7442, 1 },
+{ "horn", 7443, 4 },
+{ "horns", 7447, 4 },
+{ "horrible", 7451, 1 },
+{ "horror", 7452, 2 },
+{ "horse", 7454, 4 },
+{ "horseshoe", 7458, 1 },
+{ "hospital", 7459, 6 },
+{ "hot", 7465, 20 },
+{ "hotcake", 7485, 1 },
+{ "hotcakes", 7486, 1 },
+{ "hotdog", 7487, 1 },
+{ "hotel", 7488, 7 },
+{ "hotsprings", 7495, 1 },
+{ "hour", 7496, 1 },
+{ "hourglass", 7497, 2 },
+{ "hours", 7499, 1 },
+{ "house", 7500, 7 },
+{ "housecat", 7507, 1 },
+{ "houseplant", 7508, 1 },
+{ "houses", 7509, 1 },
+{ "hover", 7510, 1 },
+{ "hovering", 7511, 1 },
+{ "hr", 7512, 1 },
+{ "ht", 7513, 1 },
+{ "hu", 7514, 1 },
+{ "hug", 7515, 3 },
+{ "hugging", 7518, 2 },
+{ "hugs", 7520, 1 },
+{ "huh", 7521, 2 },
+{ "human", 7523, 87 },
+{ "hump", 7610, 2 },
+{ "hundred", 7612, 1 },
+{ "hungarian", 7613, 1 },
+{ "hungary", 7614, 1 },
+{ "hungry", 7615, 1 },
+{ "hurricane", 7616, 1 },
+{ "hurt", 7617, 3 },
+{ "hush", 7620, 3 },
+{ "hushed", 7623, 1 },
+{ "hut", 7624, 1 },
+{ "hwatu", 7625, 1 },
+{ "hyacinth", 7626, 1 },
+{ "hygiene", 7627, 1 },
+{ "hyperlink", 7628, 1 },
+{ "hypnotized", 7629, 1 },
+{ "i", 7630, 4 },
+{ "i18n", 7634, 1 },
+{ "ice", 7635, 8 },
+{ "iceberg", 7643, 1 },
+{ "icecream", 7644, 1 },
+{ "iceland", 7645, 1 },
+{ "icelandic", 7646, 1 },
+{ "icicles", 7647, 1 },
+{ "icon", 7648, 12 },
+{ "id", 7660, 2 },
+{ "idaho", 7662, 1 },
+{ "idea", 7663, 1 },
+{ "identification", 7664, 2 },
+{ "identity", 7666, 1 },
+{ "ideograph", 7667, 15 },
+{ "ie", 7682, 1 },
+{ "ignorance", 7683, 3 },
+{ "ignore", 7686, 2 },
+{ "ikea", 7688, 1 },
+{ "il", 7689, 1 },
+{ "ill", 7690, 5 },
+{ "ily", 7695, 1 },
+{ "imac", 7696, 1 },
+{ "immortal", 7697, 1 },
+{ "imp", 7698, 2 },
+{ "impact", 7700, 1 },
+{ "impaired", 7701, 3 },
+{ "imperial", 7704, 1 },
+{ "impractical", 7705, 1 },
+{ "impressed", 7706, 1 },
+{ "improve", 7707, 1 },
+{ "improvement", 7708, 1 },
+{ "improving", 7709, 1 },
+{ "in", 7710, 33 },
+{ "inbox", 7743, 9 },
+{ "inclusive", 7752, 3 },
+{ "incognito", 7755, 1 },
+{ "incoming", 7756, 2 },
+{ "increase", 7758, 3 },
+{ "increasing", 7761, 2 },
+{ "indecisive", 7763, 1 },
+{ "index", 7764, 10 },
+{ "india", 7774, 2 },
+{ "indian", 7776, 5 },
+{ "indicator", 7781, 9 },
+{ "indifference", 7790, 6 },
+{ "indifferent", 7796, 4 },
+{ "indiffernt", 7800, 1 },
+{ "indonesia", 7801, 1 },
+{ "indonesian", 7802, 1 },
+{ "industrial", 7803, 4 },
+{ "industry", 7807, 1 },
+{ "inexpressive", 7808, 1 },
+{ "infant", 7809, 4 },
+{ "infatuation", 7813, 6 },
+{ "infinity", 7819, 1 },
+{ "info", 7820, 3 },
+{ "information", 7823, 5 },
+{ "infrastructure", 7828, 1 },
+{ "inhalation", 7829, 1 },
+{ "injured", 7830, 1 },
+{ "injury", 7831, 2 },
+{ "ink", 7833, 2 },
+{ "inline", 7835, 1 },
+{ "innocent", 7836, 1 },
+{ "input", 7837, 9 },
+{ "insect", 7846, 12 },
+{ "insert", 7858, 1 },
+{ "inside", 7859, 1 },
+{ "inspection", 7860, 1 },
+{ "instructment", 7861, 1 },
+{ "instructor", 7862, 3 },
+{ "instrument", 7865, 11 },
+{ "intelligent", 7876, 1 },
+{ "intercardinal", 7877, 5 },
+{ "interlocking", 7882, 1 },
+{ "international", 7883, 5 },
+{ "internationalization", 7888, 1 },
+{ "internet", 7889, 3 },
+{ "interrobang", 7892, 1 },
+{ "interrogation", 7893, 1 },
+{ "interstate", 7894, 1 },
+{ "interweb", 7895, 1 },
+{ "intoxicated", 7896, 1 },
+{ "introvert", 7897, 1 },
+{ "invader", 7898, 1 },
+{ "investigate", 7899, 1 },
+{ "invisible", 7900, 1 },
+{ "ip", 7901, 1 },
+{ "iphone", 7902, 3 },
+{ "ipod", 7905, 1 },
+{ "iq", 7906, 1 },
+{ "iran", 7907, 1 },
+{ "iranian", 7908, 1 },
+{ "iraq", 7909, 1 },
+{ "iraqi", 7910, 1 },
+{ "ireland", 7911, 3 },
+{ "irish", 7914, 3 },
+{ "iron", 7917, 1 },
+{ "ironic", 7918, 1 },
+{ "is", 7919, 1 },
+{ "islam", 7920, 3 },
+{ "islamic", 7923, 1 },
+{ "island", 7924, 23 },
+{ "islander", 7947, 5 },
+{ "islands", 7952, 18 },
+{ "islas", 7970, 1 },
+{ "isle", 7971, 1 },
+{ "isolation", 7972, 1 },
+{ "israel", 7973, 1 },
+{ "israeli", 7974, 1 },
+{ "iss", 7975, 1 },
+{ "issue", 7976, 1 },
+{ "italian", 7977, 2 },
+{ "italy", 7979, 2 },
+{ "its", 7981, 1 },
+{ "ivoire", 7982, 1 },
+{ "ivory", 7983, 1 },
+{ "iwazaru", 7984, 1 },
+{ "izakaya", 7985, 1 },
+{ "ja", 7986, 1 },
+{ "jabsco", 7987, 1 },
+{ "jack", 7988, 2 },
+{ "jacket", 7990, 1 },
+{ "jaguar", 7991, 1 },
+{ "jainism", 7992, 2 },
+{ "jamaica", 7994, 1 },
+{ "jamaican", 7995, 1 },
+{ "jan", 7996, 2 },
+{ "jandals", 7998, 1 },
+{ "japan", 7999, 6 },
+{ "japanese", 8005, 45 },
+{ "jar", 8050, 2 },
+{ "jaws", 8052, 1 },
+{ "jazz", 8053, 3 },
+{ "je", 8056, 1 },
+{ "jeans", 8057, 1 },
+{ "jellyfish", 8058, 2 },
+{ "jemima", 8060, 1 },
+{ "jeotgarak", 8061, 1 },
+{ "jersey", 8062, 1 },
+{ "jew", 8063, 2 },
+{ "jewel", 8065, 6 },
+{ "jewelry", 8071, 2 },
+{ "jewish", 8073, 5 },
+{ "jiaozi", 8078, 1 },
+{ "jigsaw", 8079, 1 },
+{ "jinni", 8080, 1 },
+{ "jm", 8081, 1 },
+{ "jo", 8082, 1 },
+{ "job", 8083, 1 },
+{ "jockey", 8084, 1 },
+{ "joey", 8085, 1 },
+{ "jog", 8086, 3 },
+{ "jogging", 8089, 1 },
+{ "join", 8090, 1 },
+{ "joint", 8091, 1 },
+{ "joke", 8092, 1 },
+{ "joker", 8093, 1 },
+{ "jolly", 8094, 1 },
+{ "jordan", 8095, 1 },
+{ "jordanian", 8096, 1 },
+{ "joy", 8097, 9 },
+{ "joystick", 8106, 1 },
+{ "jp", 8107, 1 },
+{ "judaism", 8108, 2 },
+{ "judge", 8110, 3 },
+{ "judo", 8113, 1 },
+{ "jug", 8114, 1 },
+{ "juggle", 8115, 3 },
+{ "juggler", 8118, 3 },
+{ "juggling", 8121, 3 },
+{ "juice", 8124, 2 },
+{ "july", 8126, 1 },
+{ "jump", 8127, 2 },
+{ "justice", 8129, 5 },
+{ "kaaba", 8134, 1 },
+{ "kadomatsu", 8135, 1 },
+{ "kale", 8136, 1 },
+{ "kamaboko", 8137, 1 },
+{ "kami", 8138, 1 },
+{ "kangaroo", 8139, 1 },
+{ "kanji", 8140, 15 },
+{ "karaoke", 8155, 1 },
+{ "karate", 8156, 1 },
+{ "karl", 8157, 1 },
+{ "katakana", 8158, 2 },
+{ "kawaii", 8160, 2 },
+{ "kazakh", 8162, 1 },
+{ "kazakhstan", 8163, 1 },
+{ "kazakhstani", 8164, 1 },
+{ "ke", 8165, 1 },
+{ "kebab", 8166, 2 },
+{ "keeling", 8168, 1 },
+{ "keep", 8169, 1 },
+{ "kenya", 8170, 1 },
+{ "kenyan", 8171, 1 },
+{ "kettle", 8172, 1 },
+{ "key", 8173, 5 },
+{ "keyboard", 8178, 2 },
+{ "keycap", 8180, 13 },
+{ "kg", 8193, 1 },
+{ "kh", 8194, 1 },
+{ "khanda", 8195, 1 },
+{ "ki", 8196, 1 },
+{ "kick", 8197, 3 },
+{ "kid", 8200, 2 },
+{ "kidney", 8202, 1 },
+{ "kids", 8203, 1 },
+{ "kikazaru", 8204, 1 },
+{ "kills", 8205, 1 },
+{ "kimono", 8206, 2 },
+{ "king", 8208, 3 },
+{ "kingdom", 8211, 1 },
+{ "kinshasa", 8212, 1 },
+{ "kiribati", 8213, 1 },
+{ "kiss", 8214, 11 },
+{ "kissing", 8225, 11 },
+{ "kissy", 8236, 3 },
+{ "kitchen", 8239, 6 },
+{ "kite", 8245, 1 },
+{ "kitten", 8246, 2 },
+{ "kitts", 8248, 1 },
+{ "kitty", 8249, 1 },
+{ "kiwi", 8250, 2 },
+{ "kiwifruit", 8252, 1 },
+{ "km", 8253, 1 },
+{ "knee", 8254, 1 },
+{ "kneel", 8255, 3 },
+{ "kneeling", 8258, 6 },
+{ "knife", 8264, 4 },
+{ "knit", 8268, 1 },
+{ "knobs", 8269, 1 },
+{ "knocked", 8270, 1 },
+{ "knot", 8271, 1 },
+{ "knowledge", 8272, 5 },
+{ "koala", 8277, 1 },
+{ "kod", 8278, 1 },
+{ "koinobori", 8279, 1 },
+{ "koko", 8280, 1 },
+{ "kong", 8281, 1 },
+{ "korea", 8282, 2 },
+{ "korean", 8284, 2 },
+{ "kosovar", 8286, 1 },
+{ "kosovo", 8287, 1 },
+{ "kr", 8288, 1 },
+{ "kuaizi", 8289, 1 },
+{ "kuwait", 8290, 1 },
+{ "kuwaiti", 8291, 1 },
+{ "kw", 8292, 1 },
+{ "kwik", 8293, 1 },
+{ "kyoto", 8294, 1 },
+{ "kyrgyzstan", 8295, 1 },
+{ "kyrgyzstani", 8296, 1 },
+{ "kz", 8297, 1 },
+{ "lab", 8298, 6 },
+{ "label", 8304, 2 },
+{ "labor", 8306, 4 },
+{ "laboratory", 8310, 1 },
+{ "lacking", 8311, 1 },
+{ "lacrosse", 8312, 1 },
+{ "ladder", 8313, 1 },
+{ "ladies", 8314, 1 },
+{ "lady", 8315, 6 },
+{ "ladybird", 8321, 1 },
+{ "ladybug", 8322, 1 },
+{ "lai", 8323, 1 },
+{ "lamb", 8324, 1 },
+{ "lambchop", 8325, 1 },
+{ "lamp", 8326, 2 },
+{ "landing", 8328, 2 },
+{ "lands", 8330, 1 },
+{ "landscape", 8331, 1 },
+{ "lanka", 8332, 1 },
+{ "lankan", 8333, 1 },
+{ "lantern", 8334, 2 },
+{ "lao", 8336, 1 },
+{ "laos", 8337, 1 },
+{ "laotian", 8338, 1 },
+{ "laptop", 8339, 4 },
+{ "large", 8343, 23 },
+{ "last", 8366, 3 },
+{ "late", 8369, 24 },
+{ "lather", 8393, 1 },
+{ "latin", 8394, 9 },
+{ "latte", 8403, 1 },
+{ "latvia", 8404, 1 },
+{ "latvian", 8405, 1 },
+{ "laugh", 8406, 5 },
+{ "laughing", 8411, 4 },
+{ "launch", 8415, 1 },
+{ "laundry", 8416, 1 },
+{ "lavash", 8417, 1 },
+{ "lavatory", 8418, 4 },
+{ "lavender", 8422, 1 },
+{ "law", 8423, 13 },
+{ "lawn", 8436, 4 },
+{ "lazy", 8440, 1 },
+{ "lb", 8441, 1 },
+{ "lead", 8442, 1 },
+{ "leader", 8443, 1 },
+{ "leaf", 8444, 6 },
+{ "leafless", 8450, 1 },
+{ "leafy", 8451, 1 },
+{ "league", 8452, 1 },
+{ "learn", 8453, 6 },
+{ "leaves", 8459, 2 },
+{ "lebanese", 8461, 1 },
+{ "lebanon", 8462, 1 },
+{ "ledger", 8463, 1 },
+{ "left", 8464, 23 },
+{ "leftovers", 8487, 1 },
+{ "leftward", 8488, 1 },
+{ "leftwards", 8489, 9 },
+{ "leg", 8498, 3 },
+{ "legal", 8501, 10 },
+{ "legolas", 8511, 1 },
+{ "legume", 8512, 1 },
+{ "lemon", 8513, 1 },
+{ "lemonade", 8514, 1 },
+{ "length", 8515, 1 },
+{ "leo", 8516, 2 },
+{ "leone", 8518, 1 },
+{ "leonean", 8519, 1 },
+{ "leopard", 8520, 1 },
+{ "lesbian", 8521, 9 },
+{ "lesotho", 8530, 1 },
+{ "less", 8531, 1 },
+{ "leste", 8532, 1 },
+{ "letter", 8533, 14 },
+{ "letters", 8547, 12 },
+{ "lettuce", 8559, 2 },
+{ "level", 8561, 2 },
+{ "levitate", 8563, 1 },
+{ "levitating", 8564, 1 },
+{ "lgbt", 8565, 20 },
+{ "lgbtq", 8585, 2 },
+{ "li", 8587, 1 },
+{ "liar", 8588, 1 },
+{ "liberia", 8589, 1 },
+{ "liberian", 8590, 1 },
+{ "liberty", 8591, 2 },
+{ "libra", 8593, 2 },
+{ "library", 8595, 6 },
+{ "libya", 8601, 1 },
+{ "libyan", 8602, 1 },
+{ "license", 8603, 3 },
+{ "lick", 8606, 1 },
+{ "licking", 8607, 1 },
+{ "lie", 8608, 1 },
+{ "liechtenstein", 8609, 1 },
+{ "liechtensteiner", 8610, 1 },
+{ "life", 8611, 3 },
+{ "lift", 8614, 2 },
+{ "lifter", 8616, 3 },
+{ "lifting", 8619, 3 },
+{ "light", 8622, 13 },
+{ "lighting", 8635, 1 },
+{ "lightning", 8636, 3 },
+{ "like", 8639, 34 },
+{ "limb", 8673, 1 },
+{ "limbs", 8674, 1 },
+{ "lime", 8675, 1 },
+{ "limit", 8676, 4 },
+{ "line", 8680, 2 },
+{ "lines", 8682, 1 },
+{ "link", 8683, 2 },
+{ "linked", 8685, 2 },
+{ "lion", 8687, 3 },
+{ "lip", 8690, 2 },
+{ "lips", 8692, 5 },
+{ "lipstick", 8697, 2 },
+{ "liquid", 8699, 3 },
+{ "liquor", 8702, 1 },
+{ "lis", 8703, 1 },
+{ "listen", 8704, 1 },
+{ "listening", 8705, 1 },
+{ "lit", 8706, 1 },
+{ "literals", 8707, 1 },
+{ "literature", 8708, 2 },
+{ "lithuania", 8710, 1 },
+{ "lithuanian", 8711, 1 },
+{ "litter", 8712, 3 },
+{ "litterbox", 8715, 1 },
+{ "littering", 8716, 1 },
+{ "little", 8717, 1 },
+{ "lizard", 8718, 2 },
+{ "llama", 8720, 1 },
+{ "load", 8721, 1 },
+{ "loaf", 8722, 1 },
+{ "lobster", 8723, 1 },
+{ "localization", 8724, 1 },
+{ "location", 8725, 3 },
+{ "lock", 8728, 7 },
+{ "locked", 8735, 4 },
+{ "locker", 8739, 1 },
+{ "locomotive", 8740, 1 },
+{ "log", 8741, 1 },
+{ "logo", 8742, 2 },
+{ "lol", 8744, 3 },
+{ "lollipop", 8747, 1 },
+{ "lolly", 8748, 1 },
+{ "lollypop", 8749, 1 },
+{ "londoneye", 8750, 1 },
+{ "lonely", 8751, 1 },
+{ "long", 8752, 3 },
+{ "loo", 8755, 2 },
+{ "look", 8757, 4 },
+{ "loop", 8761, 4 },
+{ "lord", 8765, 1 },
+{ "lorry", 8766, 1 },
+{ "loser", 8767, 1 },
+{ "losing", 8768, 2 },
+{ "lost", 8770, 1 },
+{ "lotion", 8771, 1 },
+{ "lotus", 8772, 4 },
+{ "loud", 8776, 2 },
+{ "loudly", 8778, 1 },
+{ "loudspeaker", 8779, 1 },
+{ "lounge", 8780, 1 },
+{ "love", 8781, 42 },
+{ "lovestruck", 8823, 1 },
+{ "loving", 8824, 2 },
+{ "low", 8826, 4 },
+{ "lower", 8830, 7 },
+{ "lowercase", 8837, 2 },
+{ "lowered", 8839, 2 },
+{ "lr", 8841, 1 },
+{ "ls", 8842, 1 },
+{ "lt", 8843, 1 },
+{ "lu", 8844, 1 },
+{ "lucia", 8845, 1 },
+{ "luck", 8846, 9 },
+{ "lucky", 8855, 2 },
+{ "luge", 8857, 1 },
+{ "luggage", 8858, 2 },
+{ "lumber", 8860, 2 },
+{ "lunch", 8862, 3 },
+{ "lungs", 8865, 1 },
+{ "lust", 8866, 1 },
+{ "luxembourg", 8867, 1 },
+{ "luxembourger", 8868, 1 },
+{ "lv", 8869, 1 },
+{ "ly", 8870, 1 },
+{ "lying", 8871, 1 },
+{ "m", 8872, 2 },
+{ "ma", 8874, 2 },
+{ "maarten", 8876, 1 },
+{ "mac", 8877, 1 },
+{ "macanese", 8878, 1 },
+{ "macao", 8879, 1 },
+{ "macau", 8880, 1 },
+{ "macedonia", 8881, 1 },
+{ "macedonian", 8882, 1 },
+{ "machine", 8883, 4 },
+{ "mad", 8887, 6 },
+{ "madagascan", 8893, 1 },
+{ "madagascar", 8894, 1 },
+{ "mag", 8895, 2 },
+{ "mage", 8897, 3 },
+{ "magen", 8900, 1 },
+{ "maggot", 8901, 1 },
+{ "magic", 8902, 17 },
+{ "magical", 8919, 5 },
+{ "magnet", 8924, 1 },
+{ "magnetic", 8925, 2 },
+{ "magnifier", 8927, 2 },
+{ "magnify", 8929, 1 },
+{ "magnifying", 8930, 2 },
+{ "mahjong", 8932, 1 },
+{ "maiden", 8933, 2 },
+{ "mail", 8935, 12 },
+{ "mailbox", 8947, 5 },
+{ "maintainer", 8952, 2 },
+{ "maize", 8954, 1 },
+{ "makeup", 8955, 1 },
+{ "malaria", 8956, 1 },
+{ "malawi", 8957, 1 },
+{ "malawian", 8958, 1 },
+{ "malaysia", 8959, 1 },
+{ "malaysian", 8960, 1 },
+{ "maldives", 8961, 1 },
+{ "maldivian", 8962, 1 },
+{ "male", 8963, 115 },
+{ "mali", 9078, 1 },
+{ "malian", 9079, 1 },
+{ "mall", 9080, 2 },
+{ "mallard", 9082, 1 },
+{ "malt", 9083, 1 },
+{ "malta", 9084, 1 },
+{ "maltese", 9085, 1 },
+{ "malvinas", 9086, 1 },
+{ "mammoth", 9087, 1 },
+{ "man", 9088, 125 },
+{ "manager", 9213, 3 },
+{ "mandarin", 9216, 1 },
+{ "manga", 9217, 1 },
+{ "mango", 9218, 1 },
+{ "manicure", 9219, 1 },
+{ "manilla", 9220, 1 },
+{ "mans", 9221, 1 },
+{ "mansplaining", 9222, 1 },
+{ "mantelpiece", 9223, 1 },
+{ "mantilla", 9224, 1 },
+{ "manual", 9225, 7 },
+{ "manx", 9232, 1 },
+{ "mao", 9233, 1 },
+{ "map", 9234, 3 },
+{ "maple", 9237, 1 },
+{ "maracas", 9238, 1 },
+{ "marathon", 9239, 4 },
+{ "mariana", 9243, 1 },
+{ "marino", 9244, 1 },
+{ "mark", 9245, 24 },
+{ "marker", 9269, 1 },
+{ "market", 9270, 1 },
+{ "marriage", 9271, 13 },
+{ "mars", 9284, 1 },
+{ "marshall", 9285, 1 },
+{ "marshallese", 9286, 1 },
+{ "marsupial", 9287, 2 },
+{ "mart", 9289, 1 },
+{ "martial", 9290, 1 },
+{ "martin", 9291, 2 },
+{ "martini", 9293, 1 },
+{ "martiniquais", 9294, 1 },
+{ "martinique", 9295, 1 },
+{ "marvel", 9296, 2 },
+{ "mary", 9298, 1 },
+{ "masa", 9299, 1 },
+{ "mask", 9300, 5 },
+{ "masks", 9305, 1 },
+{ "massage", 9306, 6 },
+{ "massaging", 9312, 1 },
+{ "mastercard", 9313, 1 },
+{ "matcha", 9314, 1 },
+{ "mate", 9315, 1 },
+{ "math", 9316, 8 },
+{ "mathematician", 9324, 3 },
+{ "matryoshka", 9327, 1 },
+{ "mauritania", 9328, 1 },
+{ "mauritanian", 9329, 1 },
+{ "mauritian", 9330, 1 },
+{ "mauritius", 9331, 2 },
+{ "mayen", 9333, 2 },
+{ "mayotte", 9335, 1 },
+{ "maze", 9336, 1 },
+{ "mc", 9337, 1 },
+{ "mcdonald", 9338, 4 },
+{ "mcdonalds", 9342, 1 },
+{ "md", 9343, 3 },
+{ "me", 9346, 2 },
+{ "meal", 9348, 1 },
+{ "mean", 9349, 1 },
+{ "meaning", 9350, 17 },
+{ "meat", 9367, 8 },
+{ "meatball", 9375, 1 },
+{ "mecca", 9376, 1 },
+{ "mechanic", 9377, 4 },
+{ "mechanical", 9381, 2 },
+{ "medal", 9383, 5 },
+{ "medallion", 9388, 1 },
+{ "medical", 9389, 4 },
+{ "medicine", 9393, 10 },
+{ "medio", 9403, 1 },
+{ "meditate", 9404, 1 },
+{ "meditation", 9405, 4 },
+{ "mediterranean", 9409, 2 },
+{ "medium", 9411, 8 },
+{ "meeting", 9419, 1 },
+{ "mega", 9420, 1 },
+{ "megafrown", 9421, 1 },
+{ "megaphone", 9422, 2 },
+{ "meh", 9424, 5 },
+{ "melilla", 9429, 2 },
+{ "melon", 9431, 1 },
+{ "melt", 9432, 1 },
+{ "melted", 9433, 1 },
+{ "melting", 9434, 1 },
+{ "memo", 9435, 2 },
+{ "memorandum", 9437, 1 },
+{ "men", 9438, 107 },
+{ "mending", 9545, 1 },
+{ "menorah", 9546, 1 },
+{ "mens", 9547, 1 },
+{ "menstruation", 9548, 1 },
+{ "meow", 9549, 2 },
+{ "merboy", 9551, 1 },
+{ "mercy", 9552, 1 },
+{ "merge", 9553, 1 },
+{ "mergirl", 9554, 1 },
+{ "meridians", 9555, 1 },
+{ "mermaid", 9556, 3 },
+{ "merman", 9559, 2 },
+{ "merperson", 9561, 1 },
+{ "merry", 9562, 1 },
+{ "merwoman", 9563, 2 },
+{ "message", 9565, 2 },
+{ "metal", 9567, 2 },
+{ "meteoroid", 9569, 1 },
+{ "metrics", 9570, 3 },
+{ "metro", 9573, 2 },
+{ "mexican", 9575, 4 },
+{ "mexico", 9579, 2 },
+{ "mg", 9581, 1 },
+{ "mic", 9582, 2 },
+{ "mice", 9584, 1 },
+{ "michi", 9585, 1 },
+{ "microbe", 9586, 1 },
+{ "micronesia", 9587, 1 },
+{ "micronesian", 9588, 2 },
+{ "microorganism", 9590, 1 },
+{ "microphone", 9591, 2 },
+{ "microscope", 9593, 1 },
+{ "mid", 9594, 1 },
+{ "midday", 9595, 1 },
+{ "middle", 9596, 6 },
+{ "midnight", 9602, 1 },
+{ "mild", 9603, 1 },
+{ "milestone", 9604, 2 },
+{ "military", 9606, 3 },
+{ "milk", 9609, 9 },
+{ "milkshake", 9618, 1 },
+{ "milky", 9619, 1 },
+{ "minaret", 9620, 1 },
+{ "mind", 9621, 1 },
+{ "mindfulness", 9622, 2 },
+{ "miniature", 9624, 1 },
+{ "minibus", 9625, 1 },
+{ "minidisc", 9626, 1 },
+{ "minidisk", 9627, 1 },
+{ "mining", 9628, 1 },
+{ "minivan", 9629, 1 },
+{ "minor", 9630, 1 },
+{ "minus", 9631, 1 },
+{ "miquelon", 9632, 1 },
+{ "miracle", 9633, 1 },
+{ "miriam", 9634, 1 },
+{ "mirror", 9635, 2 },
+{ "mischievous", 9637, 4 },
+{ "mizaru", 9641, 1 },
+{ "ml", 9642, 1 },
+{ "mm", 9643, 1 },
+{ "mn", 9644, 1 },
+{ "moai", 9645, 1 },
+{ "mobile", 9646, 6 },
+{ "mobility", 9652, 6 },
+{ "mock", 9658, 1 },
+{ "mode", 9659, 1 },
+{ "moisturizer", 9660, 1 },
+{ "mojito", 9661, 5 },
+{ "moldova", 9666, 1 },
+{ "moldovan", 9667, 1 },
+{ "molester", 9668, 1 },
+{ "molusc", 9669, 1 },
+{ "mom", 9670, 1 },
+{ "momi", 9671, 1 },
+{ "monaco", 9672, 1 },
+{ "monarch", 9673, 1 },
+{ "monegasque", 9674, 1 },
+{ "money", 9675, 19 },
+{ "moneybag", 9694, 1 },
+{ "moneybags", 9695, 1 },
+{ "mongolia", 9696, 1 },
+{ "mongolian", 9697, 1 },
+{ "monitor", 9698, 1 },
+{ "monkey", 9699, 7 },
+{ "monochrome", 9706, 1 },
+{ "monocle", 9707, 1 },
+{ "monorail", 9708, 1 },
+{ "monster", 9709, 10 },
+{ "montenegrin", 9719, 1 },
+{ "montenegro", 9720, 1 },
+{ "month", 9721, 1 },
+{ "monthly", 9722, 1 },
+{ "montserrat", 9723, 1 },
+{ "montserratian", 9724, 1 },
+{ "moo", 9725, 2 },
+{ "moon", 9727, 19 },
+{ "mooncake", 9746, 1 },
+{ "moonface", 9747, 1 },
+{ "moose", 9748, 1 },
+{ "more", 9749, 1 },
+{ "morning", 9750, 6 },
+{ "moroccan", 9756, 1 },
+{ "morocco", 9757, 1 },
+{ "mortar", 9758, 2 },
+{ "mosque", 9760, 2 },
+{ "mosquito", 9762, 1 },
+{ "mother", 9763, 19 },
+{ "mothers", 9782, 5 },
+{ "motor", 9787, 2 },
+{ "motorbike", 9789, 1 },
+{ "motorboat", 9790, 2 },
+{ "motorcycle", 9792, 1 },
+{ "motorhome", 9793, 1 },
+{ "motorized", 9794, 7 },
+{ "motorway", 9801, 1 },
+{ "mount", 9802, 1 },
+{ "mountain", 9803, 11 },
+{ "mountains", 9814, 1 },
+{ "mouse", 9815, 5 },
+{ "mouse2", 9820, 1 },
+{ "mousetrap", 9821, 1 },
+{ "moustache", 9822, 3 },
+{ "mouth", 9825, 23 },
+{ "mouthless", 9848, 1 },
+{ "move", 9849, 6 },
+{ "mover", 9855, 1 },
+{ "movie", 9856, 6 },
+{ "movies", 9862, 1 },
+{ "moving", 9863, 1 },
+{ "moyai", 9864, 1 },
+{ "mozambican", 9865, 1 },
+{ "mozambique", 9866, 1 },
+{ "mq", 9867, 1 },
+{ "mr", 9868, 2 },
+{ "mrs", 9870, 1 },
+{ "mrt", 9871, 1 },
+{ "ms", 9872, 1 },
+{ "mt", 9873, 1 },
+{ "mu", 9874, 1 },
+{ "mug", 9875, 3 },
+{ "mugs", 9878, 1 },
+{ "mule", 9879, 1 },
+{ "multiple", 9880, 2 },
+{ "multiplication", 9882, 2 },
+{ "multiply", 9884, 2 },
+{ "multitask", 9886, 3 },
+{ "munch", 9889, 2 },
+{ "muscle", 9891, 1 },
+{ "muscles", 9892, 1 },
+{ "museum", 9893, 2 },
+{ "mushroom", 9895, 2 },
+{ "music", 9897, 28 },
+{ "musical", 9925, 4 },
+{ "musician", 9929, 3 },
+{ "muskmelon", 9932, 1 },
+{ "muslim", 9933, 4 },
+{ "mustache", 9937, 2 },
+{ "mute", 9939, 6 },
+{ "muted", 9945, 2 },
+{ "mutual", 9947, 1 },
+{ "mv", 9948, 1 },
+{ "mw", 9949, 1 },
+{ "mx", 9950, 2 },
+{ "my", 9952, 1 },
+{ "myanmar", 9953, 1 },
+{ "myanmarese", 9954, 1 },
+{ "mystical", 9955, 2 },
+{ "myth", 9957, 2 },
+{ "mythtical", 9959, 1 },
+{ "mz", 9960, 1 },
+{ "na", 9961, 1 },
+{ "naan", 9962, 1 },
+{ "nail", 9963, 1 },
+{ "nam", 9964, 1 },
+{ "namaste", 9965, 1 },
+{ "name", 9966, 1 },
+{ "namibia", 9967, 1 },
+{ "namibian", 9968, 1 },
+{ "nanna", 9969, 1 },
+{ "nap", 9970, 1 },
+{ "narutomaki", 9971, 1 },
+{ "nasa", 9972, 2 },
+{ "nation", 9974, 248 },
+{ "national", 10222, 1 },
+{ "nations", 10223, 1 },
+{ "nature", 10224, 142 },
+{ "nauru", 10366, 1 },
+{ "nauruan", 10367, 1 },
+{ "nausea", 10368, 1 },
+{ "nauseated", 10369, 1 },
+{ "nauseous", 10370, 1 },
+{ "navigation", 10371, 1 },
+{ "nazar", 10372, 1 },
+{ "nba", 10373, 1 },
+{ "nct", 10374, 1 },
+{ "ne", 10375, 1 },
+{ "neck", 10376, 1 },
+{ "necklace", 10377, 1 },
+{ "necktie", 10378, 1 },
+{ "needle", 10379, 3 },
+{ "needs", 10382, 1 },
+{ "negation", 10383, 1 },
+{ "negative", 10384, 7 },
+{ "nemo", 10391, 1 },
+{ "nepal", 10392, 1 },
+{ "nepalese", 10393, 1 },
+{ "nerd", 10394, 1 },
+{ "nerdy", 10395, 2 },
+{ "nervous", 10397, 8 },
+{ "nest", 10405, 2 },
+{ "nesting", 10407, 3 },
+{ "net", 10410, 1 },
+{ "netherlands", 10411, 2 },
+{ "neutral", 10413, 8 },
+{ "nevis", 10421, 1 },
+{ "new", 10422, 10 },
+{ "newborn", 10432, 1 },
+{ "news", 10433, 2 },
+{ "newspaper", 10435, 2 },
+{ "newyork", 10437, 1 },
+{ "next", 10438, 2 },
+{ "nfl", 10440, 1 },
+{ "ng", 10441, 3 },
+{ "ni", 10444, 2 },
+{ "nib", 10446, 2 },
+{ "nicaragua", 10448, 1 },
+{ "nicaraguan", 10449, 1 },
+{ "nicholas", 10450, 1 },
+{ "niger", 10451, 1 },
+{ "nigeria", 10452, 1 },
+{ "nigerian", 10453, 1 },
+{ "nigerien", 10454, 1 },
+{ "night", 10455, 24 },
+{ "nike", 10479, 1 },
+{ "nine", 10480, 4 },
+{ "ninja", 10484, 1 },
+{ "ninjutsu", 10485, 1 },
+{ "niue", 10486, 1 },
+{ "niuean", 10487, 1 },
+{ "nl", 10488, 1 },
+{ "no", 10489, 30 },
+{ "noble", 10519, 1 },
+{ "nod", 10520, 1 },
+{ "noise", 10521, 1 },
+{ "noisy", 10522, 1 },
+{ "nom", 10523, 1 },
+{ "non", 10524, 1 },
+{ "nonchalant", 10525, 1 },
+{ "nonconforming", 10526, 1 },
+{ "nonplussed", 10527, 1 },
+{ "noodle", 10528, 2 },
+{ "noodles", 10530, 1 },
+{ "noon", 10531, 1 },
+{ "nope", 10532, 2 },
+{ "norfolk", 10534, 1 },
+{ "north", 10535, 6 },
+{ "northeast", 10541, 1 },
+{ "northern", 10542, 2 },
+{ "northwest", 10544, 2 },
+{ "norway", 10546, 2 },
+{ "norwegian", 10548, 1 },
+{ "nose", 10549, 9 },
+{ "not", 10558, 18 },
+{ "note", 10576, 11 },
+{ "notebook", 10587, 4 },
+{ "notepad", 10591, 1 },
+{ "notes", 10592, 5 },
+{ "nothing", 10597, 1 },
+{ "notification", 10598, 1 },
+{ "notifications", 10599, 1 },
+{ "novel", 10600, 1 },
+{ "np", 10601, 1 },
+{ "nr", 10602, 1 },
+{ "nsfw", 10603, 1 },
+{ "nu", 10604, 1 },
+{ "nuclear", 10605, 1 },
+{ "null", 10606, 1 },
+{ "number", 10607, 3 },
+{ "numbers", 10610, 13 },
+{ "numeric", 10623, 1 },
+{ "nurse", 10624, 4 },
+{ "nursery", 10628, 1 },
+{ "nursing", 10629, 4 },
+{ "nurturing", 10633, 1 },
+{ "nut", 10634, 3 },
+{ "nuts", 10637, 1 },
+{ "o", 10638, 16 },
+{ "o2", 10654, 1 },
+{ "oatmeal", 10655, 1 },
+{ "oberon", 10656, 2 },
+{ "observation", 10658, 1 },
+{ "obsolete", 10659, 1 },
+{ "obtain", 10660, 1 },
+{ "ocean", 10661, 15 },
+{ "oclock", 10676, 12 },
+{ "octagonal", 10688, 1 },
+{ "octopus", 10689, 1 },
+{ "octothorpe", 10690, 1 },
+{ "oden", 10691, 1 },
+{ "of", 10692, 24 },
+{ "off", 10716, 5 },
+{ "offer", 10721, 3 },
+{ "office", 10724, 9 },
+{ "officer", 10733, 3 },
+{ "ogre", 10736, 1 },
+{ "oh", 10737, 1 },
+{ "ohyeah", 10738, 1 },
+{ "oil", 10739, 2 },
+{ "oink", 10741, 2 },
+{ "ok", 10743, 14 },
+{ "okay", 10757, 2 },
+{ "olaf", 10759, 1 },
+{ "old", 10760, 9 },
+{ "older", 10769, 3 },
+{ "oldschool", 10772, 6 },
+{ "olive", 10778, 1 },
+{ "olives", 10779, 1 },
+{ "om", 10780, 2 },
+{ "oman", 10782, 1 },
+{ "omani", 10783, 1 },
+{ "omg", 10784, 2 },
+{ "omkara", 10786, 1 },
+{ "omusubi", 10787, 1 },
+{ "on", 10788, 8 },
+{ "once", 10796, 1 },
+{ "oncoming", 10797, 5 },
+{ "one", 10802, 14 },
+{ "oni", 10816, 1 },
+{ "onigiri", 10817, 1 },
+{ "onion", 10818, 1 },
+{ "onsen", 10819, 1 },
+{ "oops", 10820, 4 },
+{ "open", 10824, 24 },
+{ "opening", 10848, 2 },
+{ "operating", 10850, 1 },
+{ "ophiuchus", 10851, 2 },
+{ "optical", 10853, 3 },
+{ "or", 10856, 3 },
+{ "orange", 10859, 21 },
+{ "orangutan", 10880, 1 },
+{ "orbit", 10881, 1 },
+{ "orchestra", 10882, 1 },
+{ "order", 10883, 1 },
+{ "oreo", 10884, 1 },
+{ "organ", 10885, 3 },
+{ "organizing", 10888, 2 },
+{ "orienteering", 10890, 1 },
+{ "orleans", 10891, 1 },
+{ "ornament", 10892, 4 },
+{ "orthodox", 10896, 1 },
+{ "orthoptera", 10897, 1 },
+{ "ostentatious", 10898, 1 },
+{ "otter", 10899, 1 },
+{ "out", 10900, 6 },
+{ "outbox", 10906, 1 },
+{ "outdoors", 10907, 2 },
+{ "outer", 10909, 2 },
+{ "outerspace", 10911, 2 },
+{ "outgoing", 10913, 1 },
+{ "outlined", 10914, 4 },
+{ "outlying", 10918, 2 },
+{ "over", 10920, 5 },
+{ "overcast", 10925, 1 },
+{ "overheated", 10926, 1 },
+{ "overlay", 10927, 1 },
+{ "owl", 10928, 1 },
+{ "own", 10929, 1 },
+{ "ox", 10930, 6 },
+{ "oxen", 10936, 1 },
+{ "oyster", 10937, 2 },
+{ "p", 10939, 1 },
+{ "pa", 10940, 3 },
+{ "package", 10943, 1 },
+{ "packet", 10944, 1 },
+{ "packing", 10945, 1 },
+{ "pad", 10946, 2 },
+{ "paddle", 10948, 2 },
+{ "paddles", 10950, 1 },
+{ "padlock", 10951, 2 },
+{ "paella", 10953, 1 },
+{ "page", 10954, 2 },
+{ "pageant", 10956, 1 },
+{ "pager", 10957, 1 },
+{ "pail", 10958, 2 },
+{ "pain", 10960, 1 },
+{ "pained", 10961, 1 },
+{ "paint", 10962, 4 },
+{ "paintbrush", 10966, 1 },
+{ "painter", 10967, 3 },
+{ "painting", 10970, 4 },
+{ "pair", 10974, 11 },
+{ "pakistan", 10985, 1 },
+{ "pakistani", 10986, 1 },
+{ "palau", 10987, 1 },
+{ "palauan", 10988, 1 },
+{ "palestine", 10989, 1 },
+{ "palestinian", 10990, 1 },
+{ "palette", 10991, 4 },
+{ "palm", 10995, 12 },
+{ "palms", 11007, 1 },
+{ "pan", 11008, 2 },
+{ "panama", 11010, 1 },
+{ "panamanian", 11011, 1 },
+{ "pancake", 11012, 1 },
+{ "pancakes", 11013, 1 },
+{ "panda", 11014, 2 },
+{ "pants", 11016, 2 },
+{ "pao", 11018, 1 },
+{ "paper", 11019, 15 },
+{ "paperclip", 11034, 2 },
+{ "paperclips", 11036, 1 },
+{ "papua", 11037, 1 },
+{ "parachute", 11038, 1 },
+{ "paraguay", 11039, 1 },
+{ "paraguayan", 11040, 1 },
+{ "parasail", 11041, 1 },
+{ "parasite", 11042, 1 },
+{ "parasol", 11043, 1 },
+{ "parcel", 11044, 1 },
+{ "parchment", 11045, 1 },
+{ "parent", 11046, 12 },
+{ "parents", 11058, 17 },
+{ "park", 11075, 5 },
+{ "parking", 11080, 1 },
+{ "parlor", 11081, 3 },
+{ "parrot", 11084, 1 },
+{ "part", 11085, 2 },
+{ "partly", 11087, 1 },
+{ "party", 11088, 14 },
+{ "partying", 11102, 4 },
+{ "pass", 11106, 3 },
+{ "passenger", 11109, 4 },
+{ "passing", 11113, 1 },
+{ "passionate", 11114, 1 },
+{ "passport", 11115, 2 },
+{ "password", 11117, 3 },
+{ "pasta", 11120, 1 },
+{ "pastry", 11121, 5 },
+{ "patrol", 11126, 1 },
+{ "pattern", 11127, 1 },
+{ "paul", 11128, 1 },
+{ "pause", 11129, 2 },
+{ "paw", 11131, 1 },
+{ "pawn", 11132, 1 },
+{ "payment", 11133, 5 },
+{ "pc", 11138, 1 },
+{ "pe", 11139, 1 },
+{ "pea", 11140, 1 },
+{ "peace", 11141, 3 },
+{ "peach", 11144, 1 },
+{ "peacock", 11145, 1 },
+{ "peahen", 11146, 1 },
+{ "peanut", 11147, 1 },
+{ "peanuts", 11148, 1 },
+{ "pear", 11149, 1 },
+{ "pearl", 11150, 2 },
+{ "pedestrian", 11152, 5 },
+{ "pedestrians", 11157, 1 },
+{ "peek", 11158, 1 },
+{ "peeking", 11159, 1 },
+{ "peep", 11160, 1 },
+{ "peerson", 11161, 1 },
+{ "pen", 11162, 5 },
+{ "pencil", 11167, 2 },
+{ "pencil2", 11169, 1 },
+{ "penguin", 11170, 1 },
+{ "pensive", 11171, 1 },
+{ "people", 11172, 36 },
+{ "pepper", 11208, 2 },
+{ "pepperoni", 11210, 1 },
+{ "percent", 11211, 1 },
+{ "percussion", 11212, 1 },
+{ "perfect", 11213, 2 },
+{ "perform", 11215, 1 },
+{ "performance", 11216, 1 },
+{ "performer", 11217, 1 },
+{ "performing", 11218, 1 },
+{ "period", 11219, 1 },
+{ "permanent", 11220, 1 },
+{ "permissions", 11221, 1 },
+{ "persevere", 11222, 1 },
+{ "persevering", 11223, 1 },
+{ "person", 11224, 74 },
+{ "personal", 11298, 1 },
+{ "peru", 11299, 1 },
+{ "peruvian", 11300, 1 },
+{ "pest", 11301, 3 },
+{ "pester", 11304, 1 },
+{ "pests", 11305, 1 },
+{ "pet", 11306, 10 },
+{ "petri", 11316, 1 },
+{ "petrol", 11317, 1 },
+{ "petroleum", 11318, 1 },
+{ "ph", 11319, 1 },
+{ "phallic", 11320, 1 },
+{ "pharmacy", 11321, 1 },
+{ "phew", 11322, 3 },
+{ "philippines", 11325, 1 },
+{ "phoenix", 11326, 1 },
+{ "phone", 11327, 11 },
+{ "phones", 11338, 1 },
+{ "photo", 11339, 31 },
+{ "photography", 11370, 3 },
+{ "physician", 11373, 3 },
+{ "physicist", 11376, 3 },
+{ "physics", 11379, 1 },
+{ "pi", 11380, 1 },
+{ "piano", 11381, 1 },
+{ "picard", 11382, 1 },
+{ "pick", 11383, 3 },
+{ "pickaxe", 11386, 1 },
+{ "picket", 11387, 1 },
+{ "pickle", 11388, 1 },
+{ "pickup", 11389, 1 },
+{ "picnic", 11390, 2 },
+{ "picture", 11392, 1 },
+{ "pie", 11393, 1 },
+{ "piece", 11394, 4 },
+{ "pied", 11398, 1 },
+{ "pierogi", 11399, 1 },
+{ "pierre", 11400, 1 },
+{ "pig", 11401, 5 },
+{ "pig2", 11406, 1 },
+{ "pile", 11407, 2 },
+{ "pill", 11409, 1 },
+{ "pilot", 11410, 3 },
+{ "pin", 11413, 4 },
+{ "pina", 11417, 1 },
+{ "pinata", 11418, 1 },
+{ "pinched", 11419, 1 },
+{ "pinching", 11420, 1 },
+{ "pine", 11421, 2 },
+{ "pineapple", 11423, 1 },
+{ "ping", 11424, 1 },
+{ "pinged", 11425, 1 },
+{ "pingpong", 11426, 1 },
+{ "pink", 11427, 13 },
+{ "pinocchio", 11440, 1 },
+{ "pins", 11441, 1 },
+{ "piper", 11442, 1 },
+{ "pirate", 11443, 4 },
+{ "pisces", 11447, 2 },
+{ "pistol", 11449, 1 },
+{ "pita", 11450, 2 },
+{ "pitcairn", 11452, 1 },
+{ "pitchfork", 11453, 1 },
+{ "pizza", 11454, 1 },
+{ "pk", 11455, 1 },
+{ "pl", 11456, 1 },
+{ "placard", 11457, 1 },
+{ "place", 11458, 8 },
+{ "plane", 11466, 7 },
+{ "planet", 11473, 16 },
+{ "planets", 11489, 4 },
+{ "planning", 11493, 2 },
+{ "plant", 11495, 49 },
+{ "plantain", 11544, 1 },
+{ "plaster", 11545, 1 },
+{ "plate", 11546, 1 },
+{ "platform", 11547, 1 },
+{ "play", 11548, 14 },
+{ "player", 11562, 3 },
+{ "playful", 11565, 5 },
+{ "playground", 11570, 2 },
+{ "playing", 11572, 8 },
+{ "playstation", 11580, 1 },
+{ "plaything", 11581, 1 },
+{ "pleading", 11582, 1 },
+{ "please", 11583, 1 },
+{ "pleased", 11584, 3 },
+{ "plewds", 11587, 1 },
+{ "plug", 11588, 1 },
+{ "plumage", 11589, 1 },
+{ "plumber", 11590, 4 },
+{ "plunder", 11594, 1 },
+{ "plunger", 11595, 1 },
+{ "plus", 11596, 1 },
+{ "plush", 11597, 1 },
+{ "png", 11598, 1 },
+{ "pod", 11599, 1 },
+{ "podcast", 11600, 2 },
+{ "point", 11602, 11 },
+{ "pointe", 11613, 1 },
+{ "pointed", 11614, 7 },
+{ "pointing", 11621, 30 },
+{ "points", 11651, 1 },
+{ "poison", 11652, 2 },
+{ "poisoned", 11654, 1 },
+{ "poker", 11655, 6 },
+{ "poland", 11661, 1 },
+{ "polar", 11662, 1 },
+{ "pole", 11663, 3 },
+{ "police", 11666, 6 },
+{ "policeman", 11672, 2 },
+{ "policewoman", 11674, 2 },
+{ "polish", 11676, 2 },
+{ "pollution", 11678, 1 },
+{ "polo", 11679, 4 },
+{ "polygon", 11683, 1 },
+{ "polynesia", 11684, 1 },
+{ "polynesian", 11685, 1 },
+{ "pong", 11686, 1 },
+{ "poo", 11687, 1 },
+{ "poodle", 11688, 1 },
+{ "pool", 11689, 4 },
+{ "poop", 11693, 1 },
+{ "pop", 11694, 2 },
+{ "popcorn", 11696, 1 },
+{ "popper", 11697, 1 },
+{ "popping", 11698, 2 },
+{ "pork", 11700, 1 },
+{ "porkchop", 11701, 1 },
+{ "porous", 11702, 1 },
+{ "porridge", 11703, 1 },
+{ "portugal", 11704, 1 },
+{ "portugese", 11705, 1 },
+{ "position", 11706, 3 },
+{ "positive", 11709, 1 },
+{ "post", 11710, 5 },
+{ "postal", 11715, 3 },
+{ "postbox", 11718, 5 },
+{ "pot", 11723, 4 },
+{ "potable", 11727, 2 },
+{ "potato", 11729, 3 },
+{ "potsticker", 11732, 1 },
+{ "potted", 11733, 1 },
+{ "potty", 11734, 1 },
+{ "pouch", 11735, 1 },
+{ "poultry", 11736, 1 },
+{ "pound", 11737, 2 },
+{ "pouring", 11739, 1 },
+{ "pout", 11740, 1 },
+{ "pouting", 11741, 5 },
+{ "power", 11746, 5 },
+{ "powerboat", 11751, 1 },
+{ "praise", 11752, 2 },
+{ "pranava", 11754, 1 },
+{ "prank", 11755, 4 },
+{ "prawn", 11759, 2 },
+{ "pray", 11761, 7 },
+{ "prayer", 11768, 4 },
+{ "prc", 11772, 1 },
+{ "pregnancy", 11773, 1 },
+{ "pregnant", 11774, 3 },
+{ "present", 11777, 1 },
+{ "presentation", 11778, 5 },
+{ "preserve", 11783, 1 },
+{ "preserver", 11784, 1 },
+{ "press", 11785, 2 },
+{ "pressed", 11787, 1 },
+{ "pressing", 11788, 2 },
+{ "pretend", 11790, 1 },
+{ "pretent", 11791, 1 },
+{ "pretty", 11792, 1 },
+{ "pretzel", 11793, 1 },
+{ "previous", 11794, 2 },
+{ "price", 11796, 1 },
+{ "pride", 11797, 21 },
+{ "primary", 11818, 1 },
+{ "prime", 11819, 4 },
+{ "prince", 11823, 1 },
+{ "princess", 11824, 1 },
+{ "principe", 11825, 1 },
+{ "print", 11826, 2 },
+{ "printed", 11828, 1 },
+{ "printer", 11829, 1 },
+{ "prints", 11830, 1 },
+{ "privacy", 11831, 6 },
+{ "private", 11837, 2 },
+{ "prize", 11839, 1 },
+{ "probing", 11840, 4 },
+{ "problem", 11844, 1 },
+{ "profanity", 11845, 1 },
+{ "professional", 11846, 3 },
+{ "professor", 11849, 3 },
+{ "program", 11852, 2 },
+{ "programmer", 11854, 2 },
+{ "progress", 11856, 2 },
+{ "prohibit", 11858, 1 },
+{ "prohibited", 11859, 17 },
+{ "projector", 11876, 1 },
+{ "proof", 11877, 1 },
+{ "prophecy", 11878, 1 },
+{ "propose", 11879, 1 },
+{ "prosper", 11880, 1 },
+{ "prosthetic", 11881, 2 },
+{ "protect", 11883, 1 },
+{ "protection", 11884, 5 },
+{ "protest", 11889, 1 },
+{ "proud", 11890, 5 },
+{ "ps4", 11895, 1 },
+{ "psychic", 11896, 1 },
+{ "pt", 11897, 1 },
+{ "pub", 11898, 3 },
+{ "public", 11901, 4 },
+{ "puck", 11905, 3 },
+{ "pudding", 11908, 1 },
+{ "puerto", 11909, 1 },
+{ "puff", 11910, 1 },
+{ "pufferfish", 11911, 1 },
+{ "puke", 11912, 1 },
+{ "pulsating", 11913, 1 },
+{ "pulse", 11914, 2 },
+{ "pump", 11916, 2 },
+{ "pumpkin", 11918, 1 },
+{ "pumps", 11919, 1 },
+{ "punch", 11920, 3 },
+{ "punctuation", 11923, 8 },
+{ "punk", 11931, 1 },
+{ "pupil", 11932, 3 },
+{ "puppy", 11935, 3 },
+{ "purchase", 11938, 1 },
+{ "pure", 11939, 1 },
+{ "purity", 11940, 1 },
+{ "purple", 11941, 24 },
+{ "purse", 11965, 3 },
+{ "push", 11968, 1 },
+{ "pushing", 11969, 2 },
+{ "pushpin", 11971, 2 },
+{ "put", 11973, 1 },
+{ "putto", 11974, 1 },
+{ "puzzle", 11975, 1 },
+{ "puzzled", 11976, 1 },
+{ "pw", 11977, 1 },
+{ "py", 11978, 1 },
+{ "python", 11979, 1 },
+{ "qa", 11980, 1 },
+{ "qatar", 11981, 1 },
+{ "qatari", 11982, 1 },
+{ "quarter", 11983, 4 },
+{ "quartet", 11987, 1 },
+{ "quavers", 11988, 1 },
+{ "queen", 11989, 2 },
+{ "queer", 11991, 1 },
+{ "quench", 11992, 1 },
+{ "question", 11993, 4 },
+{ "quid", 11997, 1 },
+{ "quiet", 11998, 6 },
+{ "quivering", 12004, 1 },
+{ "quiz", 12005, 3 },
+{ "quotes", 12008, 1 },
+{ "r", 12009, 1 },
+{ "rabbit", 12010, 2 },
+{ "rabbit2", 12012, 1 },
+{ "raccoon", 12013, 1 },
+{ "race", 12014, 8 },
+{ "racehorse", 12022, 2 },
+{ "racing", 12024, 7 },
+{ "racket", 12031, 1 },
+{ "racquet", 12032, 2 },
+{ "radiation", 12034, 1 },
+{ "radical", 12035, 1 },
+{ "radio", 12036, 3 },
+{ "radioactive", 12039, 1 },
+{ "radish", 12040, 1 },
+{ "rage", 12041, 1 },
+{ "rail", 12042, 1 },
+{ "railcar", 12043, 1 },
+{ "railroad", 12044, 1 },
+{ "railway", 12045, 10 },
+{ "rain", 12055, 8 },
+{ "rainbow", 12063, 2 },
+{ "raining", 12065, 1 },
+{ "rainy", 12066, 1 },
+{ "raised", 12067, 12 },
+{ "raising", 12079, 4 },
+{ "ram", 12083, 2 },
+{ "ramen", 12085, 2 },
+{ "rancher", 12087, 3 },
+{ "random", 12090, 2 },
+{ "rashers", 12092, 1 },
+{ "rat", 12093, 1 },
+{ "rate", 12094, 1 },
+{ "ray", 12095, 1 },
+{ "rays", 12096, 1 },
+{ "razor", 12097, 2 },
+{ "read", 12099, 6 },
+{ "reborn", 12105, 1 },
+{ "rebound", 12106, 1 },
+{ "receipt", 12107, 1 },
+{ "receive", 12108, 3 },
+{ "receiver", 12111, 1 },
+{ "reception", 12112, 1 },
+{ "recession", 12113, 1 },
+{ "record", 12114, 11 },
+{ "recorder", 12125, 1 },
+{ "recording", 12126, 1 },
+{ "recovering", 12127, 1 },
+{ "recovery", 12128, 1 },
+{ "recreational", 12129, 1 },
+{ "recruit", 12130, 1 },
+{ "recuperating", 12131, 1 },
+{ "recycle", 12132, 1 },
+{ "recycling", 12133, 1 },
+{ "red", 12134, 54 },
+{ "redhead", 12188, 2 },
+{ "redhot", 12190, 1 },
+{ "reduce", 12191, 1 },
+{ "reef", 12192, 1 },
+{ "reflection", 12193, 1 },
+{ "reflector", 12194, 1 },
+{ "refresh", 12195, 2 },
+{ "regal", 12197, 1 },
+{ "regardless", 12198, 1 },
+{ "regional", 12199, 9 },
+{ "registered", 12208, 1 },
+{ "regular", 12209, 1 },
+{ "reindeer", 12210, 1 },
+{ "relax", 12211, 5 },
+{ "relaxed", 12216, 2 },
+{ "relief", 12218, 2 },
+{ "relieve", 12220, 1 },
+{ "relieved", 12221, 3 },
+{ "religion", 12224, 19 },
+{ "religious", 12243, 2 },
+{ "reload", 12245, 1 },
+{ "reminder", 12246, 1 },
+{ "remove", 12247, 4 },
+{ "rep", 12251, 1 },
+{ "repair", 12252, 3 },
+{ "repeat", 12255, 3 },
+{ "repercussion", 12258, 1 },
+{ "reply", 12259, 1 },
+{ "reptile", 12260, 2 },
+{ "republic", 12262, 11 },
+{ "request", 12273, 1 },
+{ "rescue", 12274, 2 },
+{ "research", 12276, 2 },
+{ "reserved", 12278, 1 },
+{ "resist", 12279, 1 },
+{ "resort", 12280, 1 },
+{ "resources", 12281, 1 },
+{ "respect", 12282, 4 },
+{ "respectful", 12286, 3 },
+{ "respectiful", 12289, 1 },
+{ "respiration", 12290, 1 },
+{ "responsive", 12291, 1 },
+{ "rest", 12292, 3 },
+{ "restaurant", 12295, 1 },
+{ "restricted", 12296, 2 },
+{ "restriction", 12298, 1 },
+{ "restroom", 12299, 6 },
+{ "retro", 12305, 1 },
+{ "return", 12306, 3 },
+{ "retweet", 12309, 1 },
+{ "reunion", 12310, 1 },
+{ "reunionnais", 12311, 1 },
+{ "reuse", 12312, 1 },
+{ "reverse", 12313, 2 },
+{ "reversed", 12315, 1 },
+{ "revert", 12316, 1 },
+{ "revolver", 12317, 1 },
+{ "revolving", 12318, 2 },
+{ "rewind", 12320, 1 },
+{ "rex", 12321, 1 },
+{ "rhino", 12322, 1 },
+{ "rhinoceros", 12323, 1 },
+{ "rhythm", 12324, 1 },
+{ "ribbon", 12325, 3 },
+{ "rica", 12328, 1 },
+{ "rican", 12329, 2 },
+{ "rice", 12331, 8 },
+{ "rich", 12339, 3 },
+{ "rickshaw", 12342, 1 },
+{ "rico", 12343, 1 },
+{ "right", 12344, 36 },
+{ "rightward", 12380, 1 },
+{ "rightwards", 12381, 12 },
+{ "ring", 12393, 3 },
+{ "ringed", 12396, 1 },
+{ "ringer", 12397, 2 },
+{ "rings", 12399, 1 },
+{ "rip", 12400, 3 },
+{ "rise", 12403, 2 },
+{ "ro", 12405, 1 },
+{ "roach", 12406, 1 },
+{ "road", 12407, 1 },
+{ "roadwork", 12408, 1 },
+{ "roar", 12409, 2 },
+{ "roasted", 12411, 1 },
+{ "robot", 12412, 1 },
+{ "rock", 12413, 13 },
+{ "rocker", 12426, 3 },
+{ "rocket", 12429, 4 },
+{ "rockstar", 12433, 3 },
+{ "rod", 12436, 2 },
+{ "rodent", 12438, 6 },
+{ "rofl", 12444, 1 },
+{ "roger", 12445, 1 },
+{ "roles", 12446, 1 },
+{ "roll", 12447, 4 },
+{ "rolled", 12451, 1 },
+{ "roller", 12452, 2 },
+{ "rollercoaster", 12454, 1 },
+{ "rolling", 12455, 2 },
+{ "rolodex", 12457, 1 },
+{ "rom", 12458, 2 },
+{ "romaine", 12460, 1 },
+{ "romance", 12461, 15 },
+{ "romania", 12476, 1 },
+{ "romanian", 12477, 1 },
+{ "roo", 12478, 1 },
+{ "roof", 12479, 1 },
+{ "room", 12480, 6 },
+{ "rooster", 12486, 1 },
+{ "root", 12487, 2 },
+{ "rope", 12489, 1 },
+{ "ropeway", 12490, 1 },
+{ "rosary", 12491, 1 },
+{ "rose", 12492, 2 },
+{ "rosette", 12494, 1 },
+{ "rotary", 12495, 1 },
+{ "rotate", 12496, 2 },
+{ "rotating", 12498, 1 },
+{ "rotfl", 12499, 1 },
+{ "rotting", 12500, 1 },
+{ "round", 12501, 12 },
+{ "rounded", 12513, 1 },
+{ "roundhouse", 12514, 1 },
+{ "rowboat", 12515, 3 },
+{ "rowing", 12518, 3 },
+{ "royal", 12521, 5 },
+{ "royalty", 12526, 3 },
+{ "rs", 12529, 1 },
+{ "ru", 12530, 1 },
+{ "rubbish", 12531, 1 },
+{ "ruby", 12532, 1 },
+{ "rucksack", 12533, 1 },
+{ "rude", 12534, 2 },
+{ "rugby", 12536, 1 },
+{ "ruler", 12537, 2 },
+{ "rules", 12539, 1 },
+{ "rum", 12540, 1 },
+{ "run", 12541, 1 },
+{ "rung", 12542, 1 },
+{ "runner", 12543, 4 },
+{ "running", 12547, 9 },
+{ "rushed", 12556, 1 },
+{ "russia", 12557, 2 },
+{ "russian", 12559, 2 },
+{ "rv", 12561, 1 },
+{ "rw", 12562, 1 },
+{ "rwanda", 12563, 1 },
+{ "rwandan", 12564, 1 },
+{ "s", 12565, 21 },
+{ "sa", 12586, 1 },
+{ "saba", 12587, 1 },
+{ "sacred", 12588, 1 },
+{ "sad", 12589, 19 },
+{ "sadface", 12608, 3 },
+{ "safari", 12611, 2 },
+{ "safety", 12613, 5 },
+{ "sagittarius", 12618, 2 },
+{ "sahara", 12620, 1 },
+{ "saharah", 12621, 1 },
+{ "saharan", 12622, 1 },
+{ "sailboat", 12623, 1 },
+{ "sailing", 12624, 1 },
+{ "saint", 12625, 8 },
+{ "saints", 12633, 1 },
+{ "sake", 12634, 1 },
+{ "sakura", 12635, 1 },
+{ "salad", 12636, 1 },
+{ "sale", 12637, 4 },
+{ "sales", 12641, 12 },
+{ "salon", 12653, 4 },
+{ "salsa", 12657, 1 },
+{ "salt", 12658, 1 },
+{ "saltire", 12659, 1 },
+{ "salute", 12660, 2 },
+{ "saluting", 12662, 1 },
+{ "salvador", 12663, 1 },
+{ "salvadoran", 12664, 1 },
+{ "sammarinese", 12665, 1 },
+{ "samoa", 12666, 2 },
+{ "samoan", 12668, 2 },
+{ "san", 12670, 2 },
+{ "sand", 12672, 3 },
+{ "sandal", 12675, 2 },
+{ "sandals", 12677, 2 },
+{ "sandwich", 12679, 3 },
+{ "sane", 12682, 1 },
+{ "sanfrancisco", 12683, 1 },
+{ "santa", 12684, 3 },
+{ "sao", 12687, 1 },
+{ "sar", 12688, 2 },
+{ "sarcasm", 12690, 4 },
+{ "sarcastic", 12694, 1 },
+{ "saree", 12695, 1 },
+{ "sari", 12696, 1 },
+{ "sark", 12697, 1 },
+{ "sash", 12698, 1 },
+{ "sasha", 12699, 1 },
+{ "sashimi", 12700, 1 },
+{ "sassy", 12701, 3 },
+{ "satchel", 12704, 1 },
+{ "satellite", 12705, 2 },
+{ "satisfied", 12707, 1 },
+{ "saturn", 12708, 1 },
+{ "saturnine", 12709, 1 },
+{ "sauce", 12710, 1 },
+{ "saucer", 12711, 1 },
+{ "saudi", 12712, 1 },
+{ "sauna", 12713, 3 },
+{ "sauropod", 12716, 1 },
+{ "sausage", 12717, 1 },
+{ "save", 12718, 3 },
+{ "saver", 12721, 1 },
+{ "savoring", 12722, 1 },
+{ "savouring", 12723, 1 },
+{ "saw", 12724, 1 },
+{ "sax", 12725, 1 },
+{ "saxophone", 12726, 1 },
+{ "say", 12727, 1 },
+{ "sc", 12728, 1 },
+{ "scale", 12729, 2 },
+{ "scales", 12731, 5 },
+{ "scared", 12736, 5 },
+{ "scarf", 12741, 1 },
+{ "scary", 12742, 4 },
+{ "scene", 12746, 3 },
+{ "scenery", 12749, 1 },
+{ "scepticism", 12750, 1 },
+{ "schedule", 12751, 27 },
+{ "schmear", 12778, 1 },
+{ "school", 12779, 13 },
+{ "science", 12792, 5 },
+{ "scientist", 12797, 4 },
+{ "scissors", 12801, 1 },
+{ "scooter", 12802, 2 },
+{ "score", 12804, 5 },
+{ "scorpio", 12809, 2 },
+{ "scorpion", 12811, 2 },
+{ "scorpius", 12813, 2 },
+{ "scotch", 12815, 1 },
+{ "scotland", 12816, 2 },
+{ "scottish", 12818, 1 },
+{ "scout", 12819, 2 },
+{ "scouts", 12821, 1 },
+{ "scream", 12822, 2 },
+{ "screaming", 12824, 2 },
+{ "screen", 12826, 3 },
+{ "screw", 12829, 2 },
+{ "screwdriver", 12831, 1 },
+{ "scribble", 12832, 2 },
+{ "scroll", 12834, 1 },
+{ "scrunched", 12835, 2 },
+{ "scuba", 12837, 1 },
+{ "sd", 12838, 2 },
+{ "se", 12840, 1 },
+{ "sea", 12841, 18 },
+{ "seafood", 12859, 4 },
+{ "seal", 12863, 1 },
+{ "sealed", 12864, 1 },
+{ "search", 12865, 2 },
+{ "seashell", 12867, 1 },
+{ "season", 12868, 3 },
+{ "seat", 12871, 2 },
+{ "second", 12873, 1 },
+{ "secret", 12874, 7 },
+{ "secure", 12881, 1 },
+{ "security", 12882, 7 },
+{ "see", 12889, 4 },
+{ "seed", 12893, 1 },
+{ "seedling", 12894, 1 },
+{ "seeing", 12895, 1 },
+{ "selfie", 12896, 1 },
+{ "selling", 12897, 1 },
+{ "semaphore", 12898, 1 },
+{ "semi", 12899, 1 },
+{ "senbei", 12900, 1 },
+{ "senegal", 12901, 1 },
+{ "sengalese", 12902, 1 },
+{ "senior", 12903, 3 },
+{ "senko", 12906, 1 },
+{ "sensu", 12907, 1 },
+{ "sent", 12908, 2 },
+{ "seo", 12910, 1 },
+{ "serbia", 12911, 1 },
+{ "serbian", 12912, 1 },
+{ "serenity", 12913, 3 },
+{ "serious", 12916, 2 },
+{ "serpent", 12918, 2 },
+{ "serve", 12920, 1 },
+{ "service", 12921, 6 },
+{ "set", 12927, 1 },
+{ "settee", 12928, 1 },
+{ "seven", 12929, 3 },
+{ "sewing", 12932, 2 },
+{ "sexual", 12934, 1 },
+{ "sexy", 12935, 1 },
+{ "seychelles", 12936, 1 },
+{ "seychellois", 12937, 1 },
+{ "sg", 12938, 1 },
+{ "shade", 12939, 1 },
+{ "shadow", 12940, 2 },
+{ "shadows", 12942, 1 },
+{ "shaka", 12943, 1 },
+{ "shake", 12944, 1 },
+{ "shaker", 12945, 2 },
+{ "shaking", 12947, 4 },
+{ "shallow", 12951, 1 },
+{ "shame", 12952, 1 },
+{ "shampoo", 12953, 1 },
+{ "shamrock", 12954, 1 },
+{ "shape", 12955, 25 },
+{ "shaped", 12980, 2 },
+{ "shari", 12982, 1 },
+{ "shark", 12983, 1 },
+{ "sharp", 12984, 1 },
+{ "shave", 12985, 1 },
+{ "shaved", 12986, 1 },
+{ "shawarma", 12987, 1 },
+{ "sheaf", 12988, 1 },
+{ "shedding", 12989, 1 },
+{ "sheep", 12990, 2 },
+{ "sheet", 12992, 1 },
+{ "shell", 12993, 2 },
+{ "shellfish", 12995, 1 },
+{ "shh", 12996, 2 },
+{ "shhh", 12998, 1 },
+{ "shield", 12999, 2 },
+{ "shifty", 13001, 1 },
+{ "shine", 13002, 2 },
+{ "shining", 13004, 1 },
+{ "shinkansen", 13005, 2 },
+{ "shinto", 13007, 1 },
+{ "shiny", 13008, 1 },
+{ "ship", 13009, 12 },
+{ "shipit", 13021, 1 },
+{ "shipping", 13022, 1 },
+{ "shirt", 13023, 4 },
+{ "shit", 13027, 1 },
+{ "shitface", 13028, 1 },
+{ "shock", 13029, 3 },
+{ "shocked", 13032, 4 },
+{ "shoe", 13036, 7 },
+{ "shoes", 13043, 5 },
+{ "shoo", 13048, 2 },
+{ "shoot", 13050, 2 },
+{ "shooting", 13052, 1 },
+{ "shop", 13053, 2 },
+{ "shopping", 13055, 11 },
+{ "shops", 13066, 1 },
+{ "shortcake", 13067, 1 },
+{ "shortcut", 13068, 2 },
+{ "shorts", 13070, 1 },
+{ "shoshinsha", 13071, 1 },
+{ "shot", 13072, 2 },
+{ "shout", 13074, 1 },
+{ "shouting", 13075, 1 },
+{ "shovel", 13076, 1 },
+{ "show", 13077, 1 },
+{ "shower", 13078, 4 },
+{ "showing", 13082, 3 },
+{ "shrek", 13085, 2 },
+{ "shrimp", 13087, 2 },
+{ "shrine", 13089, 1 },
+{ "shroom", 13090, 1 },
+{ "shrug", 13091, 3 },
+{ "shruggie", 13094, 1 },
+{ "shrugging", 13095, 3 },
+{ "shuffle", 13098, 1 },
+{ "shush", 13099, 1 },
+{ "shushing", 13100, 1 },
+{ "shuttle", 13101, 1 },
+{ "shuttlecock", 13102, 1 },
+{ "shy", 13103, 3 },
+{ "si", 13106, 1 },
+{ "sick", 13107, 11 },
+{ "side", 13118, 6 },
+{ "sideways", 13124, 1 },
+{ "sierra", 13125, 1 },
+{ "sigh", 13126, 1 },
+{ "sight", 13127, 1 },
+{ "sign", 13128, 88 },
+{ "signal", 13216, 6 },
+{ "sikh", 13222, 1 },
+{ "sikhism", 13223, 3 },
+{ "silence", 13226, 8 },
+{ "silent", 13234, 4 },
+{ "silhouette", 13238, 4 },
+{ "silhouettes", 13242, 1 },
+{ "silk", 13243, 1 },
+{ "silly", 13244, 4 },
+{ "silver", 13248, 3 },
+{ "silverware", 13251, 1 },
+{ "simp", 13252, 1 },
+{ "sing", 13253, 3 },
+{ "singapore", 13256, 1 },
+{ "singaporean", 13257, 1 },
+{ "singer", 13258, 3 },
+{ "singing", 13261, 2 },
+{ "single", 13263, 2 },
+{ "singlet", 13265, 1 },
+{ "sint", 13266, 2 },
+{ "sinterklaas", 13268, 1 },
+{ "sir", 13269, 1 },
+{ "siren", 13270, 1 },
+{ "sit", 13271, 2 },
+{ "six", 13273, 4 },
+{ "size", 13277, 2 },
+{ "sk", 13279, 1 },
+{ "skate", 13280, 3 },
+{ "skateboard", 13283, 1 },
+{ "skating", 13284, 1 },
+{ "skeleton", 13285, 3 },
+{ "skeptic", 13288, 2 },
+{ "skeptical", 13290, 2 },
+{ "sketch", 13292, 2 },
+{ "skewer", 13294, 2 },
+{ "ski", 13296, 5 },
+{ "skier", 13301, 1 },
+{ "skiing", 13302, 1 },
+{ "skill", 13303, 3 },
+{ "skillet", 13306, 2 },
+{ "skills", 13308, 1 },
+{ "skip", 13309, 2 },
+{ "skirt", 13311, 1 },
+{ "skis", 13312, 1 },
+{ "skittles", 13313, 1 },
+{ "skull", 13314, 3 },
+{ "skullcap", 13317, 1 },
+{ "skunk", 13318, 1 },
+{ "sky", 13319, 8 },
+{ "skydive", 13327, 1 },
+{ "skyline", 13328, 1 },
+{ "slash", 13329, 1 },
+{ "slate", 13330, 1 },
+{ "slay", 13331, 1 },
+{ "sled", 13332, 1 },
+{ "sledge", 13333, 1 },
+{ "sleep", 13334, 18 },
+{ "sleeping", 13352, 3 },
+{ "sleepy", 13355, 6 },
+{ "sleigh", 13361, 1 },
+{ "sleuth", 13362, 3 },
+{ "slice", 13365, 2 },
+{ "slide", 13367, 1 },
+{ "slider", 13368, 1 },
+{ "slightly", 13369, 2 },
+{ "slip", 13371, 1 },
+{ "slipper", 13372, 1 },
+{ "slot", 13373, 1 },
+{ "sloth", 13374, 1 },
+{ "slovak", 13375, 1 },
+{ "slovakia", 13376, 1 },
+{ "slovakian", 13377, 1 },
+{ "slovenia", 13378, 1 },
+{ "slovenian", 13379, 1 },
+{ "slow", 13380, 3 },
+{ "slug", 13383, 1 },
+{ "sly", 13384, 1 },
+{ "small", 13385, 19 },
+{ "smallest", 13404, 1 },
+{ "smart", 13405, 1 },
+{ "smartphone", 13406, 1 },
+{ "smartphones", 13407, 1 },
+{ "smell", 13408, 2 },
+{ "smelling", 13410, 1 },
+{ "smelly", 13411, 1 },
+{ "smh", 13412, 1 },
+{ "smile", 13413, 28 },
+{ "smiley", 13441, 8 },
+{ "smiling", 13449, 25 },
+{ "smirk", 13474, 2 },
+{ "smirking", 13476, 2 },
+{ "smith", 13478, 1 },
+{ "smog", 13479, 1 },
+{ "smoke", 13480, 4 },
+{ "smoking", 13484, 2 },
+{ "smoothie", 13486, 1 },
+{ "smug", 13487, 2 },
+{ "sn", 13489, 1 },
+{ "snack", 13490, 8 },
+{ "snail", 13498, 1 },
+{ "snake", 13499, 4 },
+{ "snap", 13503, 1 },
+{ "snapchat", 13504, 2 },
+{ "snapshots", 13506, 1 },
+{ "snapstreak", 13507, 1 },
+{ "snare", 13508, 2 },
+{ "sneaker", 13510, 1 },
+{ "sneakers", 13511, 1 },
+{ "sneeze", 13512, 1 },
+{ "sneezing", 13513, 1 },
+{ "sniff", 13514, 1 },
+{ "sniffing", 13515, 1 },
+{ "snooker", 13516, 1 },
+{ "snoring", 13517, 1 },
+{ "snorkeling", 13518, 1 },
+{ "snot", 13519, 1 },
+{ "snout", 13520, 1 },
+{ "snow", 13521, 10 },
+{ "snowboard", 13531, 1 },
+{ "snowboarder", 13532, 1 },
+{ "snowboarding", 13533, 1 },
+{ "snowflake", 13534, 1 },
+{ "snowflakes", 13535, 1 },
+{ "snowing", 13536, 2 },
+{ "snowman", 13538, 2 },
+{ "so", 13540, 1 },
+{ "soap", 13541, 2 },
+{ "soapdish", 13543, 1 },
+{ "soar", 13544, 1 },
+{ "sob", 13545, 1 },
+{ "sobbing", 13546, 1 },
+{ "soccer", 13547, 1 },
+{ "socks", 13548, 2 },
+{ "soda", 13550, 1 },
+{ "sofa", 13551, 1 },
+{ "soft", 13552, 4 },
+{ "softball", 13556, 2 },
+{ "software", 13558, 3 },
+{ "solar", 13561, 1 },
+{ "soldier", 13562, 1 },
+{ "solid", 13563, 1 },
+{ "solomon", 13564, 1 },
+{ "solong", 13565, 1 },
+{ "somalia", 13566, 1 },
+{ "somalian", 13567, 1 },
+{ "son", 13568, 10 },
+{ "song", 13578, 1 },
+{ "sons", 13579, 5 },
+{ "soon", 13584, 1 },
+{ "sorcerer", 13585, 2 },
+{ "sorceress", 13587, 2 },
+{ "sorrowful", 13589, 1 },
+{ "sorry", 13590, 4 },
+{ "sos", 13594, 1 },
+{ "sound", 13595, 11 },
+{ "soup", 13606, 3 },
+{ "source", 13609, 1 },
+{ "south", 13610, 7 },
+{ "southeast", 13617, 1 },
+{ "southern", 13618, 1 },
+{ "southwest", 13619, 1 },
+{ "sow", 13620, 1 },
+{ "spa", 13621, 6 },
+{ "space", 13627, 29 },
+{ "spaceflight", 13656, 1 },
+{ "spade", 13657, 1 },
+{ "spades", 13658, 1 },
+{ "spaghetti", 13659, 1 },
+{ "spain", 13660, 1 },
+{ "spanish", 13661, 1 },
+{ "spanner", 13662, 2 },
+{ "spark", 13664, 1 },
+{ "sparkle", 13665, 7 },
+{ "sparkler", 13672, 1 },
+{ "sparkles", 13673, 1 },
+{ "sparkling", 13674, 3 },
+{ "sparkly", 13677, 1 },
+{ "speak", 13678, 2 },
+{ "speaker", 13680, 5 },
+{ "speaking", 13685, 2 },
+{ "spear", 13687, 1 },
+{ "speculum", 13688, 1 },
+{ "speech", 13689, 5 },
+{ "speechless", 13694, 1 },
+{ "speed", 13695, 5 },
+{ "speedboat", 13700, 1 },
+{ "spent", 13701, 1 },
+{ "spew", 13702, 1 },
+{ "spice", 13703, 3 },
+{ "spicy", 13706, 2 },
+{ "spider", 13708, 2 },
+{ "spiderweb", 13710, 1 },
+{ "spill", 13711, 1 },
+{ "spin", 13712, 1 },
+{ "spiny", 13713, 1 },
+{ "spiral", 13714, 7 },
+{ "splashing", 13721, 1 },
+{ "splatter", 13722, 1 },
+{ "splayed", 13723, 1 },
+{ "split", 13724, 2 },
+{ "spock", 13726, 1 },
+{ "spoked", 13727, 1 },
+{ "sponge", 13728, 1 },
+{ "spooky", 13729, 2 },
+{ "spool", 13731, 1 },
+{ "spoon", 13732, 2 },
+{ "sport", 13734, 20 },
+{ "sports", 13754, 59 },
+{ "spots", 13813, 1 },
+{ "spouting", 13814, 1 },
+{ "spring", 13815, 19 },
+{ "springs", 13834, 1 },
+{ "sprout", 13835, 1 },
+{ "sprouting", 13836, 1 },
+{ "spy", 13837, 3 },
+{ "square", 13840, 136 },
+{ "squared", 13976, 29 },
+{ "squeeze", 14005, 1 },
+{ "squid", 14006, 1 },
+{ "squiggle", 14007, 2 },
+{ "squinting", 14009, 2 },
+{ "squirrel", 14011, 2 },
+{ "squirt", 14013, 1 },
+{ "sr", 14014, 1 },
+{ "sri", 14015, 1 },
+{ "sshh", 14016, 1 },
+{ "st", 14017, 10 },
+{ "stack", 14027, 1 },
+{ "stadium", 14028, 1 },
+{ "staff", 14029, 1 },
+{ "staffmode", 14030, 1 },
+{ "stag", 14031, 1 },
+{ "stage", 14032, 1 },
+{ "stairs", 14033, 1 },
+{ "stalk", 14034, 1 },
+{ "stamp", 14035, 1 },
+{ "stand", 14036, 3 },
+{ "standard", 14039, 1 },
+{ "standing", 14040, 4 },
+{ "star", 14044, 18 },
+{ "star2", 14062, 1 },
+{ "starch", 14063, 1 },
+{ "stare", 14064, 2 },
+{ "stargazing", 14066, 1 },
+{ "starry", 14067, 2 },
+{ "stars", 14069, 11 },
+{ "start", 14080, 1 },
+{ "states", 14081, 3 },
+{ "station", 14084, 3 },
+{ "stationery", 14087, 19 },
+{ "stats", 14106, 5 },
+{ "statue", 14111, 2 },
+{ "steak", 14113, 1 },
+{ "stealth", 14114, 1 },
+{ "steam", 14115, 8 },
+{ "steambath", 14123, 3 },
+{ "steamed", 14126, 1 },
+{ "steaming", 14127, 4 },
+{ "steamroom", 14131, 2 },
+{ "steamy", 14133, 3 },
+{ "steer", 14136, 1 },
+{ "stein", 14137, 1 },
+{ "step", 14138, 1 },
+{ "steps", 14139, 2 },
+{ "sterling", 14141, 1 },
+{ "stethoscope", 14142, 1 },
+{ "stew", 14143, 1 },
+{ "stick", 14144, 8 },
+{ "stiletto", 14152, 1 },
+{ "still", 14153, 3 },
+{ "sting", 14156, 1 },
+{ "stink", 14157, 1 },
+{ "stinky", 14158, 1 },
+{ "stitches", 14159, 1 },
+{ "stocking", 14160, 1 },
+{ "stockings", 14161, 1 },
+{ "stomp", 14162, 1 },
+{ "stone", 14163, 7 },
+{ "stop", 14170, 11 },
+{ "stopwatch", 14181, 1 },
+{ "store", 14182, 3 },
+{ "straight", 14185, 5 },
+{ "straw", 14190, 3 },
+{ "strawberry", 14193, 2 },
+{ "streamer", 14195, 1 },
+{ "strength", 14196, 2 },
+{ "string", 14198, 2 },
+{ "stringed", 14200, 1 },
+{ "strip", 14201, 1 },
+{ "stripe", 14202, 1 },
+{ "striped", 14203, 1 },
+{ "stripes", 14204, 2 },
+{ "stroke", 14206, 4 },
+{ "strong", 14210, 1 },
+{ "struck", 14211, 1 },
+{ "structure", 14212, 1 },
+{ "struggling", 14213, 1 },
+{ "stub", 14214, 1 },
+{ "stuck", 14215, 3 },
+{ "student", 14218, 5 },
+{ "studio", 14223, 1 },
+{ "study", 14224, 10 },
+{ "stuffed", 14234, 2 },
+{ "stuffy", 14236, 1 },
+{ "stunned", 14237, 2 },
+{ "style", 14239, 2 },
+{ "subscription", 14241, 1 },
+{ "subtract", 14242, 1 },
+{ "subway", 14243, 1 },
+{ "success", 14244, 1 },
+{ "sucker", 14245, 1 },
+{ "suction", 14246, 1 },
+{ "sudan", 14247, 2 },
+{ "sudanese", 14249, 2 },
+{ "suggestive", 14251, 1 },
+{ "suit", 14252, 10 },
+{ "suitcase", 14262, 3 },
+{ "suits", 14265, 4 },
+{ "suitup", 14269, 1 },
+{ "summer", 14270, 28 },
+{ "sun", 14298, 15 },
+{ "sunface", 14313, 1 },
+{ "sunflower", 14314, 1 },
+{ "sunglass", 14315, 1 },
+{ "sunglasses", 14316, 2 },
+{ "sunny", 14318, 4 },
+{ "sunrise", 14322, 3 },
+{ "sunscreen", 14325, 1 },
+{ "sunset", 14326, 4 },
+{ "sunshine", 14330, 1 },
+{ "superbowl", 14331, 1 },
+{ "superhero", 14332, 3 },
+{ "supernature", 14335, 1 },
+{ "superpower", 14336, 6 },
+{ "superpowers", 14342, 6 },
+{ "superstition", 14348, 1 },
+{ "supervillain", 14349, 3 },
+{ "suppedaneum", 14352, 1 },
+{ "support", 14353, 2 },
+{ "surf", 14355, 1 },
+{ "surfer", 14356, 3 },
+{ "surfing", 14359, 3 },
+{ "surgery", 14362, 1 },
+{ "surgical", 14363, 1 },
+{ "surimi", 14364, 1 },
+{ "suriname", 14365, 1 },
+{ "surinamer", 14366, 1 },
+{ "surprise", 14367, 9 },
+{ "surprised", 14376, 5 },
+{ "surrender", 14381, 1 },
+{ "sushi", 14382, 1 },
+{ "suspension", 14383, 1 },
+{ "suspicious", 14384, 1 },
+{ "sustain", 14385, 1 },
+{ "sutures", 14386, 1 },
+{ "svalbard", 14387, 2 },
+{ "sven", 14389, 1 },
+{ "swan", 14390, 1 },
+{ "swaziland", 14391, 1 },
+{ "swearing", 14392, 1 },
+{ "sweat", 14393, 6 },
+{ "sweating", 14399, 1 },
+{ "sweden", 14400, 2 },
+{ "swedish", 14402, 1 },
+{ "sweep", 14403, 1 },
+{ "sweeping", 14404, 1 },
+{ "sweet", 14405, 17 },
+{ "swim", 14422, 8 },
+{ "swimmer", 14430, 3 },
+{ "swimming", 14433, 5 },
+{ "swimsuit", 14438, 4 },
+{ "swirl", 14442, 2 },
+{ "swiss", 14444, 3 },
+{ "switch", 14447, 1 },
+{ "switzerland", 14448, 1 },
+{ "sword", 14449, 1 },
+{ "swords", 14450, 1 },
+{ "symbol", 14451, 76 },
+{ "symbols", 14527, 2 },
+{ "sympathy", 14529, 1 },
+{ "symphony", 14530, 1 },
+{ "synagog", 14531, 1 },
+{ "synagogue", 14532, 1 },
+{ "sync", 14533, 2 },
+{ "syria", 14535, 1 },
+{ "syrian", 14536, 1 },
+{ "syringe", 14537, 1 },
+{ "system", 14538, 2 },
+{ "sz", 14540, 1 },
+{ "t", 14541, 2 },
+{ "table", 14543, 2 },
+{ "tablet", 14545, 1 },
+{ "tabletop", 14546, 1 },
+{ "tableware", 14547, 5 },
+{ "tabs", 14552, 1 },
+{ "tack", 14553, 1 },
+{ "taco", 14554, 1 },
+{ "tada", 14555, 1 },
+{ "taekwondo", 14556, 1 },
+{ "tag", 14557, 3 },
+{ "tailoring", 14560, 1 },
+{ "taiwan", 14561, 2 },
+{ "taiwanese", 14563, 1 },
+{ "tajik", 14564, 1 },
+{ "tajikistan", 14565, 1 },
+{ "take", 14566, 1 },
+{ "takeout", 14567, 1 },
+{ "taking", 14568, 2 },
+{ "tale", 14570, 16 },
+{ "talisman", 14586, 1 },
+{ "talk", 14587, 4 },
+{ "talkshow", 14591, 2 },
+{ "tamal", 14593, 1 },
+{ "tamale", 14594, 1 },
+{ "tanabata", 14595, 1 },
+{ "tangerine", 14596, 1 },
+{ "tangled", 14597, 1 },
+{ "tanzaku", 14598, 1 },
+{ "tanzania", 14599, 1 },
+{ "tanzanian", 14600, 1 },
+{ "tao", 14601, 1 },
+{ "taoist", 14602, 1 },
+{ "tap", 14603, 2 },
+{ "tape", 14605, 3 },
+{ "tapioca", 14608, 1 },
+{ "target", 14609, 1 },
+{ "taste", 14610, 2 },
+{ "taurus", 14612, 2 },
+{ "taxi", 14614, 2 },
+{ "taxicab", 14616, 2 },
+{ "td", 14618, 1 },
+{ "tea", 14619, 5 },
+{ "teach", 14624, 1 },
+{ "teacher", 14625, 3 },
+{ "teacup", 14628, 1 },
+{ "team", 14629, 2 },
+{ "teapot", 14631, 1 },
+{ "tear", 14632, 8 },
+{ "tears", 14640, 7 },
+{ "technician", 14647, 4 },
+{ "technologist", 14651, 3 },
+{ "technology", 14654, 15 },
+{ "teddy", 14669, 2 },
+{ "tee", 14671, 1 },
+{ "teenager", 14672, 2 },
+{ "teeth", 14674, 3 },
+{ "telephone", 14677, 8 },
+{ "telescope", 14685, 1 },
+{ "television", 14686, 1 },
+{ "teller", 14687, 2 },
+{ "temperature", 14689, 2 },
+{ "temple", 14691, 4 },
+{ "tempura", 14695, 1 },
+{ "ten", 14696, 4 },
+{ "tengu", 14700, 1 },
+{ "tennis", 14701, 3 },
+{ "tent", 14704, 3 },
+{ "tentacles", 14707, 1 },
+{ "terrapin", 14708, 1 },
+{ "terrified", 14709, 1 },
+{ "territories", 14710, 2 },
+{ "territory", 14712, 1 },
+{ "terrorism", 14713, 1 },
+{ "test", 14714, 4 },
+{ "tests", 14718, 1 },
+{ "text", 14719, 2 },
+{ "textbook", 14721, 4 },
+{ "tg", 14725, 1 },
+{ "th", 14726, 2 },
+{ "thai", 14728, 1 },
+{ "thailand", 14729, 1 },
+{ "thank", 14730, 1 },
+{ "thanks", 14731, 5 },
+{ "thanksgiving", 14736, 1 },
+{ "the", 14737, 3 },
+{ "theater", 14740, 3 },
+{ "theatre", 14743, 1 },
+{ "theme", 14744, 1 },
+{ "then", 14745, 2 },
+{ "therapist", 14747, 3 },
+{ "thermometer", 14750, 2 },
+{ "think", 14752, 1 },
+{ "thinker", 14753, 1 },
+{ "thinking", 14754, 3 },
+{ "third", 14757, 1 },
+{ "thirst", 14758, 1 },
+{ "thirsty", 14759, 1 },
+{ "thirty", 14760, 12 },
+{ "this", 14772, 1 },
+{ "thong", 14773, 1 },
+{ "thongs", 14774, 1 },
+{ "thought", 14775, 1 },
+{ "thread", 14776, 1 },
+{ "three", 14777, 6 },
+{ "throw", 14783, 1 },
+{ "throwing", 14784, 3 },
+{ "thumb", 14787, 5 },
+{ "thumbs", 14792, 2 },
+{ "thumbsdown", 14794, 1 },
+{ "thumbsup", 14795, 1 },
+{ "thunder", 14796, 3 },
+{ "thunderbolt", 14799, 1 },
+{ "tiara", 14800, 1 },
+{ "tichel", 14801, 1 },
+{ "tick", 14802, 3 },
+{ "ticket", 14805, 2 },
+{ "tickets", 14807, 1 },
+{ "tidy", 14808, 1 },
+{ "tie", 14809, 2 },
+{ "tiger", 14811, 2 },
+{ "tiger2", 14813, 1 },
+{ "tightly", 14814, 2 },
+{ "tiki", 14816, 1 },
+{ "tile", 14817, 1 },
+{ "tilted", 14818, 2 },
+{ "timber", 14820, 1 },
+{ "time", 14821, 30 },
+{ "timepiece", 14851, 1 },
+{ "timer", 14852, 3 },
+{ "timor", 14855, 1 },
+{ "timorese", 14856, 1 },
+{ "tin", 14857, 1 },
+{ "tinned", 14858, 1 },
+{ "tiny", 14859, 2 },
+{ "tipping", 14861, 3 },
+{ "tipsy", 14864, 1 },
+{ "tire", 14865, 1 },
+{ "tired", 14866, 9 },
+{ "titania", 14875, 2 },
+{ "titanic", 14877, 1 },
+{ "tj", 14878, 1 },
+{ "tk", 14879, 1 },
+{ "tm", 14880, 1 },
+{ "tn", 14881, 1 },
+{ "to", 14882, 1 },
+{ "toad", 14883, 1 },
+{ "toadstool", 14884, 2 },
+{ "toast", 14886, 3 },
+{ "tobacco", 14889, 1 },
+{ "tobago", 14890, 1 },
+{ "toboggan", 14891, 1 },
+{ "toddler", 14892, 1 },
+{ "tofu", 14893, 1 },
+{ "together", 14894, 3 },
+{ "togo", 14897, 1 },
+{ "togolese", 14898, 1 },
+{ "toilet", 14899, 7 },
+{ "tokelau", 14906, 1 },
+{ "tokelauan", 14907, 1 },
+{ "tokyo", 14908, 1 },
+{ "tomato", 14909, 1 },
+{ "tomatoes", 14910, 1 },
+{ "tombstone", 14911, 1 },
+{ "tome", 14912, 1 },
+{ "tone", 14913, 1 },
+{ "tonga", 14914, 1 },
+{ "tongan", 14915, 1 },
+{ "tongue", 14916, 5 },
+{ "tool", 14921, 33 },
+{ "toolbox", 14954, 1 },
+{ "tools", 14955, 10 },
+{ "tooth", 14965, 1 },
+{ "toothbrush", 14966, 1 },
+{ "top", 14967, 8 },
+{ "tophat", 14975, 1 },
+{ "torch", 14976, 1 },
+{ "tornado", 14977, 2 },
+{ "tortoise", 14979, 1 },
+{ "toss", 14980, 1 },
+{ "totally", 14981, 1 },
+{ "touched", 14982, 2 },
+{ "tour", 14984, 1 },
+{ "tourist", 14985, 1 },
+{ "towels", 14986, 1 },
+{ "tower", 14987, 2 },
+{ "toy", 14989, 6 },
+{ "tr", 14995, 1 },
+{ "track", 14996, 4 },
+{ "trackball", 15000, 1 },
+{ "tracking", 15001, 2 },
+{ "trackpad", 15003, 1 },
+{ "tracks", 15004, 2 },
+{ "tractor", 15006, 1 },
+{ "trade", 15007, 1 },
+{ "trademark", 15008, 1 },
+{ "tradesperson", 15009, 3 },
+{ "traffic", 15012, 4 },
+{ "tragedy", 15016, 1 },
+{ "train", 15017, 11 },
+{ "train2", 15028, 1 },
+{ "trainer", 15029, 1 },
+{ "training", 15030, 2 },
+{ "tram", 15032, 4 },
+{ "tramway", 15036, 1 },
+{ "trans", 15037, 1 },
+{ "transgender", 15038, 2 },
+{ "transitions", 15040, 1 },
+{ "transparent", 15041, 1 },
+{ "transport", 15042, 3 },
+{ "transportation", 15045, 42 },
+{ "trap", 15087, 1 },
+{ "trash", 15088, 4 },
+{ "travel", 15092, 6 },
+{ "tray", 15098, 2 },
+{ "treasure", 15100, 2 },
+{ "treble", 15102, 1 },
+{ "tree", 15103, 8 },
+{ "trefoil", 15111, 1 },
+{ "trek", 15112, 1 },
+{ "trend", 15113, 3 },
+{ "trex", 15116, 1 },
+{ "triangle", 15117, 14 },
+{ "triangular", 15131, 2 },
+{ "trident", 15133, 1 },
+{ "trinidad", 15134, 1 },
+{ "triple", 15135, 1 },
+{ "tristan", 15136, 2 },
+{ "triton", 15138, 1 },
+{ "triumph", 15139, 1 },
+{ "troll", 15140, 1 },
+{ "trolley", 15141, 2 },
+{ "trolleybus", 15143, 4 },
+{ "troops", 15147, 1 },
+{ "trophy", 15148, 1 },
+{ "tropical", 15149, 6 },
+{ "trouble", 15155, 1 },
+{ "trousers", 15156, 1 },
+{ "truck", 15157, 4 },
+{ "trumpet", 15161, 1 },
+{ "trunk", 15162, 1 },
+{ "tshirt", 15163, 1 },
+{ "tsukimi", 15164, 1 },
+{ "tsunami", 15165, 1 },
+{ "tube", 15166, 2 },
+{ "tuber", 15168, 1 },
+{ "tuk", 15169, 1 },
+{ "tulip", 15170, 1 },
+{ "tumbler", 15171, 1 },
+{ "tunisia", 15172, 1 },
+{ "tunisian", 15173, 1 },
+{ "turban", 15174, 3 },
+{ "turd", 15177, 1 },
+{ "turkey", 15178, 3 },
+{ "turkish", 15181, 1 },
+{ "turkiye", 15182, 1 },
+{ "turkmen", 15183, 1 },
+{ "turkmenistan", 15184, 1 },
+{ "turks", 15185, 1 },
+{ "turn", 15186, 1 },
+{ "turrets", 15187, 1 },
+{ "turtle", 15188, 1 },
+{ "tusk", 15189, 1 },
+{ "tusks", 15190, 1 },
+{ "tuvalu", 15191, 1 },
+{ "tuvaluan", 15192, 1 },
+{ "tuxedo", 15193, 3 },
+{ "tv", 15196, 1 },
+{ "tw", 15197, 1 },
+{ "tweet", 15198, 1 },
+{ "twelve", 15199, 2 },
+{ "twenty", 15201, 1 },
+{ "twilight", 15202, 13 },
+{ "twine", 15215, 1 },
+{ "twins", 15216, 1 },
+{ "twist", 15217, 2 },
+{ "twisted", 15219, 2 },
+{ "twister", 15221, 2 },
+{ "twitter", 15223, 1 },
+{ "two", 15224, 32 },
+{ "type", 15256, 5 },
+{ "typhoon", 15261, 1 },
+{ "typos", 15262, 1 },
+{ "tyrannosaurus", 15263, 1 },
+{ "u", 15264, 3 },
+{ "u5272", 15267, 1 },
+{ "u5408", 15268, 1 },
+{ "u55b6", 15269, 1 },
+{ "u6307", 15270, 1 },
+{ "u6708", 15271, 1 },
+{ "u6709", 15272, 1 },
+{ "u6e80", 15273, 1 },
+{ "u7121", 15274, 1 },
+{ "u7533", 15275, 1 },
+{ "u7981", 15276, 1 },
+{ "u7a7a", 15277, 1 },
+{ "ua", 15278, 1 },
+{ "uae", 15279, 1 },
+{ "uber", 15280, 2 },
+{ "ufo", 15282, 3 },
+{ "ug", 15285, 1 },
+{ "uganda", 15286, 1 },
+{ "ugandan", 15287, 1 },
+{ "ugh", 15288, 1 },
+{ "ugly", 15289, 1 },
+{ "uk", 15290, 4 },
+{ "ukraine", 15294, 1 },
+{ "ukrainian", 15295, 1 },
+{ "ultimate", 15296, 1 },
+{ "um", 15297, 1 },
+{ "umbrella", 15298, 5 },
+{ "un", 15303, 1 },
+{ "unamused", 15304, 1 },
+{ "unbounded", 15305, 1 },
+{ "unbroken", 15306, 1 },
+{ "uncomfortable", 15307, 1 },
+{ "unconscious", 15308, 1 },
+{ "undead", 15309, 6 },
+{ "unded", 15315, 1 },
+{ "under", 15316, 3 },
+{ "underage", 15319, 1 },
+{ "underarm", 15320, 1 },
+{ "underground", 15321, 1 },
+{ "underwater", 15322, 1 },
+{ "underwear", 15323, 2 },
+{ "undo", 15325, 1 },
+{ "uneven", 15326, 1 },
+{ "unexpressive", 15327, 1 },
+{ "unhappy", 15328, 5 },
+{ "unicorn", 15333, 2 },
+{ "unified", 15335, 11 },
+{ "uniform", 15346, 1 },
+{ "unimpressed", 15347, 1 },
+{ "union", 15348, 3 },
+{ "united", 15351, 6 },
+{ "universal", 15357, 2 },
+{ "universe", 15359, 1 },
+{ "university", 15360, 1 },
+{ "unlock", 15361, 1 },
+{ "unlocked", 15362, 1 },
+{ "unlucky", 15363, 1 },
+{ "unrealistic", 15364, 1 },
+{ "unspecified", 15365, 7 },
+{ "unsure", 15372, 1 },
+{ "unwell", 15373, 1 },
+{ "up", 15374, 24 },
+{ "update", 15398, 1 },
+{ "upgrade", 15399, 1 },
+{ "upon", 15400, 1 },
+{ "upper", 15401, 2 },
+{ "uppercase", 15403, 1 },
+{ "upset", 15404, 11 },
+{ "upside", 15415, 1 },
+{ "upward", 15416, 2 },
+{ "upwards", 15418, 8 },
+{ "urban", 15426, 1 },
+{ "url", 15427, 1 },
+{ "urn", 15428, 1 },
+{ "uruguay", 15429, 1 },
+{ "uruguayan", 15430, 1 },
+{ "us", 15431, 3 },
+{ "usa", 15434, 3 },
+{ "usability", 15437, 1 },
+{ "useless", 15438, 1 },
+{ "user", 15439, 3 },
+{ "users", 15442, 1 },
+{ "utility", 15443, 1 },
+{ "uy", 15444, 1 },
+{ "uz", 15445, 1 },
+{ "uzbek", 15446, 1 },
+{ "uzbekistan", 15447, 1 },
+{ "uzbekistani", 15448, 1 },
+{ "v", 15449, 1 },
+{ "vacancy", 15450, 2 },
+{ "vacation", 15452, 4 },
+{ "vaccination", 15456, 1 },
+{ "vaccine", 15457, 1 },
+{ "valentine", 15458, 1 },
+{ "valentines", 15459, 32 },
+{ "vampire", 15491, 5 },
+{ "vanticanien", 15496, 1 },
+{ "vanuatu", 15497, 1 },
+{ "vaping", 15498, 1 },
+{ "vase", 15499, 2 },
+{ "vat", 15501, 1 },
+{ "vatican", 15502, 1 },
+{ "vcr", 15503, 1 },
+{ "ve", 15504, 1 },
+{ "vegas", 15505, 1 },
+{ "vegatable", 15506, 1 },
+{ "vegetable", 15507, 25 },
+{ "vegetables", 15532, 1 },
+{ "vehicle", 15533, 53 },
+{ "veil", 15586, 3 },
+{ "vein", 15589, 1 },
+{ "venezuela", 15590, 1 },
+{ "venezuelan", 15591, 1 },
+{ "venison", 15592, 1 },
+{ "venue", 15593, 1 },
+{ "venus", 15594, 1 },
+{ "verde", 15595, 1 },
+{ "verdian", 15596, 1 },
+{ "versus", 15597, 1 },
+{ "vertical", 15598, 7 },
+{ "vertically", 15605, 1 },
+{ "vespa", 15606, 1 },
+{ "vest", 15607, 1 },
+{ "vhs", 15608, 1 },
+{ "vibration", 15609, 1 },
+{ "vice", 15610, 1 },
+{ "victory", 15611, 1 },
+{ "vicuna", 15612, 1 },
+{ "video", 15613, 12 },
+{ "videocassette", 15625, 1 },
+{ "viet", 15626, 1 },
+{ "vietnam", 15627, 2 },
+{ "vietnamese", 15629, 1 },
+{ "view", 15630, 3 },
+{ "viewer", 15633, 1 },
+{ "viewing", 15634, 1 },
+{ "villain", 15635, 3 },
+{ "vincent", 15638, 1 },
+{ "violence", 15639, 2 },
+{ "violin", 15641, 1 },
+{ "virgin", 15642, 4 },
+{ "virgo", 15646, 2 },
+{ "virus", 15648, 2 },
+{ "visa", 15650, 1 },
+{ "visually", 15651, 3 },
+{ "voicemail", 15654, 1 },
+{ "volcano", 15655, 1 },
+{ "volleyball", 15656, 1 },
+{ "voltage", 15657, 1 },
+{ "volume", 15658, 7 },
+{ "vomit", 15665, 2 },
+{ "vomiting", 15667, 1 },
+{ "vortex", 15668, 1 },
+{ "vote", 15669, 3 },
+{ "voting", 15672, 1 },
+{ "vs", 15673, 1 },
+{ "vu", 15674, 1 },
+{ "vulcan", 15675, 1 },
+{ "vuoi", 15676, 1 },
+{ "wacky", 15677, 1 },
+{ "waffle", 15678, 1 },
+{ "wagon", 15679, 1 },
+{ "wailing", 15680, 1 },
+{ "wait", 15681, 1 },
+{ "wake", 15682, 1 },
+{ "wales", 15683, 2 },
+{ "walk", 15685, 5 },
+{ "walker", 15690, 1 },
+{ "walking", 15691, 13 },
+{ "wall", 15704, 1 },
+{ "wallet", 15705, 1 },
+{ "wallis", 15706, 1 },
+{ "walt", 15707, 1 },
+{ "wand", 15708, 1 },
+{ "waning", 15709, 2 },
+{ "warm", 15711, 3 },
+{ "warning", 15714, 6 },
+{ "warrior", 15720, 1 },
+{ "warthog", 15721, 1 },
+{ "washroom", 15722, 1 },
+{ "wastebasket", 15723, 1 },
+{ "wastepaper", 15724, 1 },
+{ "wat", 15725, 1 },
+{ "watch", 15726, 3 },
+{ "water", 15729, 24 },
+{ "watermelon", 15753, 1 },
+{ "wave", 15754, 4 },
+{ "waves", 15758, 2 },
+{ "waving", 15760, 3 },
+{ "wavy", 15763, 2 },
+{ "wax", 15765, 1 },
+{ "waxing", 15766, 3 },
+{ "way", 15769, 2 },
+{ "wc", 15771, 5 },
+{ "wealthy", 15776, 1 },
+{ "weapon", 15777, 7 },
+{ "wear", 15784, 1 },
+{ "wearing", 15785, 6 },
+{ "weary", 15791, 2 },
+{ "weather", 15793, 51 },
+{ "web", 15844, 2 },
+{ "wedding", 15846, 9 },
+{ "wedge", 15855, 2 },
+{ "weed", 15857, 1 },
+{ "weep", 15858, 2 },
+{ "weight", 15860, 4 },
+{ "weightlifter", 15864, 3 },
+{ "weights", 15867, 3 },
+{ "weird", 15870, 2 },
+{ "welder", 15872, 3 },
+{ "welding", 15875, 1 },
+{ "well", 15876, 2 },
+{ "welsh", 15878, 1 },
+{ "west", 15879, 4 },
+{ "western", 15883, 1 },
+{ "whale", 15884, 2 },
+{ "whale2", 15886, 1 },
+{ "what", 15887, 1 },
+{ "wheat", 15888, 2 },
+{ "wheel", 15890, 3 },
+{ "wheelchair", 15893, 15 },
+{ "when", 15908, 1 },
+{ "whew", 15909, 2 },
+{ "whine", 15911, 1 },
+{ "whippy", 15912, 1 },
+{ "whirlpool", 15913, 1 },
+{ "whirlwind", 15914, 1 },
+{ "whiskey", 15915, 1 },
+{ "whisky", 15916, 1 },
+{ "whisper", 15917, 1 },
+{ "whistle", 15918, 2 },
+{ "whistling", 15920, 2 },
+{ "white", 15922, 39 },
+{ "whoa", 15961, 2 },
+{ "whoops", 15963, 1 },
+{ "wicked", 15964, 1 },
+{ "wide", 15965, 3 },
+{ "wiener", 15968, 1 },
+{ "wifi", 15969, 3 },
+{ "wii", 15972, 1 },
+{ "wild", 15973, 8 },
+{ "wildcard", 15981, 1 },
+{ "wilted", 15982, 1 },
+{ "win", 15983, 1 },
+{ "wind", 15984, 6 },
+{ "window", 15990, 1 },
+{ "wine", 15991, 5 },
+{ "wing", 15996, 1 },
+{ "wings", 15997, 4 },
+{ "wink", 16001, 2 },
+{ "winking", 16003, 2 },
+{ "winky", 16005, 1 },
+{ "winner", 16006, 2 },
+{ "winners", 16008, 1 },
+{ "winning", 16009, 3 },
+{ "winter", 16012, 9 },
+{ "winzip", 16021, 1 },
+{ "wip", 16022, 5 },
+{ "wireless", 16027, 2 },
+{ "wise", 16029, 1 },
+{ "wisent", 16030, 1 },
+{ "wish", 16031, 3 },
+{ "wishes", 16034, 1 },
+{ "witch", 16035, 4 },
+{ "with", 16039, 98 },
+{ "withershins", 16137, 1 },
+{ "without", 16138, 3 },
+{ "witness", 16141, 1 },
+{ "wizard", 16142, 4 },
+{ "wolf", 16146, 1 },
+{ "woman", 16147, 128 },
+{ "womans", 16275, 4 },
+{ "women", 16279, 112 },
+{ "womens", 16391, 1 },
+{ "won", 16392, 1 },
+{ "woo", 16393, 1 },
+{ "wood", 16394, 4 },
+{ "woof", 16398, 1 },
+{ "woohoo", 16399, 1 },
+{ "wool", 16400, 2 },
+{ "woolly", 16402, 1 },
+{ "woozy", 16403, 1 },
+{ "word", 16404, 1 },
+{ "words", 16405, 16 },
+{ "work", 16421, 5 },
+{ "worker", 16426, 17 },
+{ "working", 16443, 1 },
+{ "workout", 16444, 8 },
+{ "world", 16452, 8 },
+{ "worm", 16460, 2 },
+{ "worried", 16462, 3 },
+{ "worry", 16465, 1 },
+{ "worship", 16466, 5 },
+{ "wound", 16471, 1 },
+{ "wounded", 16472, 1 },
+{ "wow", 16473, 4 },
+{ "wrap", 16477, 1 },
+{ "wrapped", 16478, 2 },
+{ "wrench", 16480, 4 },
+{ "wrestle", 16484, 3 },
+{ "wrestler", 16487, 3 },
+{ "wrestlers", 16490, 3 },
+{ "wrestling", 16493, 3 },
+{ "wrist", 16496, 1 },
+{ "wristwatch", 16497, 1 },
+{ "write", 16498, 6 },
+{ "writing", 16504, 6 },
+{ "wry", 16510, 1 },
+{ "ws", 16511, 2 },
+{ "www", 16513, 1 },
+{ "x", 16514, 5 },
+{ "xbox", 16519, 1 },
+{ "xd", 16520, 1 },
+{ "xk", 16521, 1 },
+{ "xmas", 16522, 8 },
+{ "xox", 16530, 2 },
+{ "y", 16532, 1 },
+{ "yacht", 16533, 3 },
+{ "yam", 16536, 1 },
+{ "yang", 16537, 1 },
+{ "yarn", 16538, 1 },
+{ "yawn", 16539, 1 },
+{ "yawning", 16540, 2 },
+{ "yay", 16542, 1 },
+{ "ye", 16543, 1 },
+{ "yea", 16544, 1 },
+{ "year", 16545, 1 },
+{ "years", 16546, 1 },
+{ "yellow", 16547, 15 },
+{ "yemen", 16562, 1 },
+{ "yemeni", 16563, 1 },
+{ "yen", 16564, 2 },
+{ "yerba", 16566, 1 },
+{ "yes", 16567, 6 },
+{ "yin", 16573, 1 },
+{ "yo", 16574, 1 },
+{ "yoga", 16575, 3 },
+{ "york", 16578, 2 },
+{ "you", 16580, 4 },
+{ "young", 16584, 5 },
+{ "yoyo", 16589, 1 },
+{ "yt", 16590, 1 },
+{ "yuebing", 16591, 1 },
+{ "yum", 16592, 1 },
+{ "yummy", 16593, 1 },
+{ "yurt", 16594, 1 },
+{ "zag", 16595, 1 },
+{ "zambia", 16596, 1 },
+{ "zambian", 16597, 1 },
+{ "zany", 16598, 1 },
+{ "zap", 16599, 1 },
+{ "zealand", 16600, 1 },
+{ "zebra", 16601, 1 },
+{ "zen", 16602, 2 },
+{ "zero", 16604, 1 },
+{ "zig", 16605, 1 },
+{ "zim", 16606, 1 },
+{ "zimbabwe", 16607, 1 },
+{ "zimbabwean", 16608, 1 },
+{ "zip", 16609, 1 },
+{ "zipper", 16610, 1 },
+{ "zm", 16611, 1 },
+{ "zodiac", 16612, 25 },
+{ "zombie", 16637, 3 },
+{ "zoom", 16640, 3 },
+{ "zoomin", 16643, 1 },
+{ "zori", 16644, 1 },
+{ "zw", 16645, 1 },
+{ "zzz", 16646, 2 },
+{ "“acceptable”", 16648, 1 },
+{ "“application”", 16649, 1 },
+{ "“bargain”", 16650, 1 },
+{ "“congratulations”", 16651, 1 },
+{ "“discount”", 16652, 1 },
+{ "“free", 16653, 1 },
+{ "“full;", 16654, 1 },
+{ "“here”", 16655, 1 },
+{ "“monthly", 16656, 1 },
+{ "“no", 16657, 1 },
+{ "“not", 16658, 1 },
+{ "“open", 16659, 1 },
+{ "“passing", 16660, 1 },
+{ "“prohibited”", 16661, 1 },
+{ "“reserved”", 16662, 1 },
+{ "“secret”", 16663, 1 },
+{ "“service", 16664, 1 },
+{ "“service”", 16665, 1 },
+{ "“vacancy”", 16666, 1 },
+{ "✉ letter", 16667, 1 },
+{ "✒ fountain", 16668, 1 },
+{ "🚓 cop", 16669, 1 }
+}};
+
+static constexpr std::array<uint16_t, 16670> SEARCH_POSTINGS = {
+196,197,39,1552,992,993,994,996,998,1000,1002,1004,1006,1008,1010,1012,1014,992,993,196,197,994,995,1553,1565,1012,1013,1562,156,994,1012,563,1013,1014,1015,1014,1015,992,993,992,993,1565,994,995,995,994,995,996,997,996,997,998,999,998,999,1000,1001,1000,1001,1002,1003,1002,1003,1004,1005,1435,1004,1005,1006,1007,1006,1007,1087,996,997,1554,1565,1008,1009,996,1008,1009,1010,1011,1010,1011,1012,1013,1012,1013,1014,1015,997,1014,1015,1088,18,998,999,1555,1565,993,995,997,999,1001,1003,1005,1007,1009,1011,1013,1015,998,999,1089,1000,1001,1556,1565,1000,1001,1002,1003,1557,1002,1003,1600,1004,1005,1558,1004,1005,1601,1006,1007,1559,1006,1007,1597,1008,1009,1121,1560,1008,1241,1253,1009,1121,1010,1011,1561,1010,1229,1240,1241,1242,1253,337,338,927,930,956,1582,1011,92,78,97,1,2,76,0,1,2,81,95,38,11,12,17,1568,1632,1231,1569,1244,869,869,1567,1563,1564,139,1291,1454,1455,1456,1457,1458,1583,42,1400,1233,1187,196,1594,1594,1415,213,214,218,276,277,278,423,425,427,429,430,431,432,433,434,435,436,437,438,439,440,561,562,943,944,1355,1375,1379,1415,1415,987,1148,1149,1169,1170,1171,1185,1170,506,877,877,1214,1214,312,313,314,1286,63,719,748,1215,1590,1141,371,372,373,885,905,907,908,910,1035,1063,1064,1065,1066,1069,1070,1071,1072,1073,1074,1075,1076,1077,1083,1117,1126,1140,1141,1143,1173,1186,1187,1204,1205,1206,1210,1211,1213,1215,1216,1217,1218,1219,1245,1248,1403,1503,1638,321,322,323,1645,1233,346,1514,1514,1199,1374,961,1082,1083,14,234,236,240,241,242,243,244,245,246,247,248,249,250,251,252,255,256,257,549,550,551,552,1590,312,313,314,979,970,971,972,973,975,1528,1647,14,15,17,20,21,121,130,131,133,134,135,136,137,145,146,147,148,150,155,509,515,517,518,878,885,1647,1647,845,1900,573,1685,1900,1183,1504,1435,196,267,1535,1536,1580,1594,207,1596,939,1649,218,1190,1374,1375,161,183,203,1048,1381,102,327,328,329,970,971,972,973,975,972,973,1423,1650,322,1659,135,988,990,1650,1650,823,825,826,827,828,829,830,831,1364,956,1425,1709,1709,115,116,982,63,644,94,595,1547,1563,1564,1567,1568,1569,1570,1571,1574,1576,1579,1581,1542,164,1651,83,31,927,956,769,1885,1892,887,1095,1281,1655,1885,846,1285,684,182,1587,1566,844,1407,1408,906,907,908,139,312,313,314,1317,221,961,1531,1271,31,109,185,509,839,840,1039,1340,1341,1346,1351,1383,1467,1645,1645,1904,1078,13,370,639,104,157,166,1652,1652,86,103,104,107,157,166,199,1649,1649,88,118,119,120,121,122,123,124,125,126,127,128,129,460,555,556,557,558,559,560,561,562,563,564,565,566,567,568,570,571,572,573,574,577,578,579,580,582,583,584,585,586,587,588,589,590,591,592,593,594,595,596,597,599,600,601,602,603,604,605,606,607,608,609,610,611,612,613,614,615,616,617,618,619,620,621,622,623,624,625,626,627,628,629,630,631,632,633,634,636,637,638,643,644,645,646,647,648,649,650,651,652,653,654,655,656,657,658,659,660,664,665,666,667,669,670,671,672,673,675,676,678,679,680,681,683,797,159,683,1199,1410,104,1535,1537,273,672,1653,1867,1653,1370,1506,1453,1648,1699,90,229,1652,558,279,280,281,797,202,723,724,987,1225,1595,1595,208,204,196,1653,844,1482,1654,352,1646,1862,1843,593,1843,353,354,678,679,680,116,1346,1480,1117,1346,312,313,314,1325,1326,863,612,756,1654,1654,391,590,1472,211,212,213,1651,1651,203,264,1084,1189,337,338,1358,973,973,973,131,1226,1291,1346,1438,1439,1440,1441,1442,1443,1444,1445,1446,1447,1448,1449,1450,1451,1452,1453,1454,1455,1456,1457,1458,1485,1486,1487,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1529,1446,1447,1452,1453,1485,1486,1487,324,325,326,862,1141,1142,1143,1305,938,980,321,324,325,326,1143,1207,1107,1141,1658,1658,139,1644,1849,1528,1406,847,850,1077,355,594,790,1259,208,1528,309,310,311,787,1375,562,1543,1551,83,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,330,331,332,1369,195,901,903,1656,1460,473,474,1176,1113,1412,1460,199,270,1361,1657,735,1461,1657,618,847,1345,1657,1657,1656,1656,1421,945,1412,933,934,708,799,1077,1597,327,328,329,327,328,329,734,87,1658,1084,1085,1086,1087,1088,1089,1081,161,31,196,1034,1068,1545,46,1338,1660,1660,1660,1570,149,230,363,364,365,366,367,368,369,370,624,625,626,818,1419,86,170,1444,1448,1454,170,189,190,191,193,1173,1177,1428,1492,1494,765,684,1366,594,110,197,377,378,379,1318,1427,1542,1532,1533,619,1105,1170,1171,1172,1173,1278,1424,758,1423,1424,57,1167,1172,755,1676,1676,1667,1667,1667,1389,1662,736,755,756,757,758,770,811,876,499,500,501,1354,1464,1478,243,251,252,630,463,464,465,475,476,477,496,497,498,789,1071,1090,1091,1092,1093,1094,1095,1096,1097,1099,1100,1101,1103,1104,1121,1122,1131,1146,267,1178,1181,163,166,167,1069,1300,1536,209,1304,800,1091,1092,1093,1094,1095,1097,1072,1073,1223,172,556,720,1374,60,142,1374,60,142,1905,158,1524,1519,1663,1663,1219,876,1280,1281,1282,1283,1284,1285,1287,1412,1526,312,313,314,1280,1281,1282,1283,1284,1280,1281,1282,1283,1428,1072,1075,1643,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1675,1676,1677,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,1689,1690,1691,1692,1693,1695,1696,1697,1698,1699,1700,1701,1702,1703,1705,1706,1707,1708,1709,1711,1712,1713,1714,1715,1716,1717,1718,1719,1720,1721,1722,1723,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,1742,1743,1744,1746,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1757,1758,1759,1760,1761,1762,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,1817,1818,1819,1820,1821,1822,1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,1881,1882,1884,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,1897,1898,1899,1900,1901,1902,203,813,823,824,825,826,827,828,829,1117,1259,1319,1397,1490,1491,1494,1499,1506,1662,1662,762,800,405,406,407,909,1648,61,62,1590,1591,953,960,1506,925,1670,1091,1188,1330,1394,475,476,477,1093,1782,1215,610,1100,1104,505,904,1387,1388,1166,505,1163,1164,1165,1397,505,1385,1387,1388,1399,1415,1418,505,1388,610,1679,1231,1232,93,1662,1229,762,1663,1664,73,467,468,553,654,657,659,660,661,692,701,798,827,857,1029,1054,1062,1166,1174,956,1407,1191,1205,3,747,611,612,613,1129,237,238,239,237,238,239,647,1482,1484,1221,135,210,405,406,407,608,177,506,1382,1382,168,673,582,583,585,766,1229,828,829,829,817,674,675,85,1533,1038,1040,1041,1042,1680,1680,1664,1664,1681,1681,740,983,1076,1202,1203,270,983,364,365,572,1669,1669,787,1671,1671,727,728,729,73,1126,460,173,819,820,822,823,825,826,827,828,829,830,831,835,836,237,238,239,146,1666,1667,1677,1677,1668,212,212,481,482,483,484,485,486,946,1429,1429,481,482,483,484,485,486,1,4,907,910,481,482,483,484,485,486,942,946,1429,484,485,486,1429,481,482,483,484,485,486,1166,729,1280,1281,1282,1283,1284,1285,1188,1121,1121,1283,1284,1330,1413,1431,1269,1437,315,316,317,1366,1367,1366,192,621,622,623,624,625,626,627,628,629,630,631,632,633,634,635,637,638,640,642,710,711,763,1105,639,367,368,369,71,809,1069,1070,1071,1080,808,1641,581,665,1742,229,1669,876,143,152,569,640,960,1029,1133,1134,1135,1136,1137,1138,1227,1268,1302,1327,1438,1440,1442,1444,1488,1489,1490,1491,1492,1493,1494,1496,1498,1500,1501,1521,1529,1536,1544,1609,1618,1620,1622,1624,1635,1639,842,40,261,1372,1229,127,423,424,425,426,427,428,561,562,610,1355,364,365,1428,319,320,235,253,254,351,235,253,254,351,386,1371,1372,1568,1569,1570,1579,1578,686,687,694,694,1167,17,161,709,1048,658,17,69,1048,69,158,65,90,148,149,268,657,729,916,935,1049,1194,1265,1412,1413,1414,1415,1416,1418,1420,1421,1422,1423,1424,1430,1438,1439,1440,1441,1442,1443,1444,1445,1446,1448,1449,1450,1451,1453,1458,1485,1487,1488,1489,1490,1491,1492,1493,1495,1496,1497,1498,1499,1500,1501,1502,1503,1506,1550,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1562,1563,1564,1565,1566,1567,1572,1573,1574,1576,1577,1578,1580,1581,1583,1585,1586,1597,1606,1615,1627,1629,1632,1642,729,729,1213,1506,49,12,19,84,30,84,1671,1672,1673,588,948,1187,1248,973,469,470,471,961,963,964,965,967,968,969,834,108,109,169,170,171,172,173,180,182,183,184,186,187,188,189,190,191,192,193,194,196,197,198,199,200,201,202,203,205,206,208,209,210,212,213,214,215,216,217,218,219,220,223,224,225,226,227,228,553,478,790,742,1890,1673,1673,1055,1351,158,1344,836,1674,1407,224,762,763,1377,1261,1262,1263,1264,1265,1266,1267,1268,1269,1286,1267,158,1067,1344,1345,1114,1177,1182,1182,823,825,826,827,828,829,831,1421,1422,1638,44,101,168,698,624,1661,117,203,1679,367,368,369,818,823,824,1391,726,1442,1451,1497,1498,1631,865,456,457,458,475,476,477,1269,685,831,1678,1817,208,279,280,281,1079,1185,1346,322,279,280,281,779,781,790,792,806,822,1099,1079,132,787,803,835,1080,1214,1292,1293,1294,1300,1328,1404,1536,1106,230,231,232,254,259,262,265,268,271,274,279,280,283,286,350,355,403,406,443,448,449,519,521,522,524,526,527,529,531,532,534,535,537,539,540,542,548,1511,451,1675,650,42,220,876,1072,1469,148,1548,1675,1217,1675,1675,1686,753,754,755,756,757,758,770,140,158,1357,753,754,758,759,760,765,776,777,781,807,822,140,366,366,222,222,864,864,360,361,362,885,896,903,1164,1308,1164,73,1029,1030,1031,1505,1029,1504,1505,1726,342,343,344,822,1283,1726,1756,1891,199,1196,1197,1198,743,199,140,142,869,1357,140,510,650,1089,1393,151,574,708,751,1175,1608,1617,72,759,760,765,1672,1672,1305,1393,1399,1676,1677,150,54,163,164,165,166,167,834,1388,1398,824,580,1527,1396,688,1461,1463,1463,581,584,671,672,673,674,675,1201,346,347,348,1190,1337,1340,1341,346,862,863,868,869,870,871,872,873,874,875,876,877,878,879,880,881,882,883,884,888,898,901,902,1459,868,901,902,1257,1666,1666,583,1117,1473,914,913,914,1199,1200,583,1117,673,199,200,201,593,594,450,451,452,605,606,962,872,766,1665,1665,1796,1796,141,1060,1398,772,1668,1668,197,923,924,925,926,950,975,312,313,314,449,463,465,876,1109,1153,1308,1309,1311,1316,1317,1318,1328,1542,1600,313,314,950,545,546,546,91,842,726,784,205,670,1238,1453,1485,1486,1487,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1499,1500,1501,1502,1504,1505,1535,1539,1568,1569,1570,1571,1572,1573,1575,1577,1578,1579,1580,1581,1582,1583,1584,1585,1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,1606,1609,1618,1619,1620,1622,1623,1633,1634,1635,1172,1891,1679,1680,1681,1546,707,1682,742,743,1329,978,979,1233,978,1698,702,820,820,1865,798,799,809,810,811,1325,1244,1513,1514,1515,1516,1811,1811,1312,1313,1315,188,1226,1228,1226,688,1767,1767,1252,593,594,211,1245,1250,1251,1252,1503,1691,1691,935,856,895,1177,1258,856,786,1330,575,707,1682,707,1682,1750,1513,1538,1195,1203,664,1475,1469,1256,809,1469,1469,813,814,815,1130,423,424,425,426,427,428,1355,1375,786,964,715,355,1187,1188,1698,1563,1568,1570,1576,1579,1581,852,855,592,1481,740,1373,166,32,912,921,922,923,926,929,930,933,934,935,936,939,940,955,956,979,816,1398,1133,1134,1135,1136,1138,1140,1285,1311,1316,1328,1411,1611,1613,1294,1438,1440,1442,1444,221,1133,1134,1135,1136,1138,1140,210,547,1528,1308,1674,905,907,908,910,1065,905,1075,1348,1348,912,922,737,928,929,931,932,937,938,956,1581,1402,487,488,489,487,488,489,1409,876,1412,1126,1396,1404,778,1541,883,884,1154,118,119,120,121,122,123,124,125,126,567,568,569,571,620,568,177,1108,1359,670,671,118,119,120,121,122,123,124,125,126,568,1081,960,1774,1774,1242,1243,830,71,203,371,372,373,809,824,830,1063,1064,1065,1066,1069,1070,1071,1072,1073,1074,1075,1076,1077,1079,1080,1081,1084,1130,1187,1638,684,1225,1226,1434,1506,1508,1509,1506,1404,1405,881,1685,156,313,314,781,1077,1085,1710,1716,1687,1866,761,1866,1756,1356,1357,1358,1358,975,1384,1741,824,830,1085,1419,1419,1469,885,1566,1586,1588,1592,1233,1407,1287,1317,1318,1319,163,163,165,181,1535,1536,1537,1536,1636,877,24,556,1200,829,830,601,758,761,768,770,780,1389,766,303,304,305,315,316,317,1151,1365,315,1364,1365,1460,1636,727,686,687,727,370,1137,1360,748,1533,624,625,626,622,623,624,625,626,763,776,775,230,231,232,233,366,367,368,369,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,548,549,550,551,552,1419,1426,24,25,521,522,523,524,525,526,527,528,529,530,531,532,533,535,537,538,540,542,543,550,552,1426,1690,1690,739,1383,739,836,1076,1202,34,1692,1744,1798,1879,355,648,649,730,742,803,1139,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,1692,808,607,767,676,132,780,808,813,820,132,764,842,1338,1348,792,838,742,888,888,1465,1466,1465,371,372,373,1056,1057,1058,1064,1080,1202,1700,885,888,1459,346,1403,1430,836,1245,1246,1247,1503,159,955,1427,1428,1429,1431,1432,1433,1434,1435,1452,1453,1486,1487,1501,1534,1546,1547,1576,1590,1594,1598,1599,1602,1603,1604,1605,1606,1607,1608,1609,1610,1633,1487,1576,1590,1594,1598,1599,555,556,557,597,910,1069,1070,1071,1122,1186,719,718,872,896,897,898,901,902,1888,898,901,1587,1588,1589,1591,1592,1593,1595,1596,1597,1600,1601,1571,1423,1122,1353,202,1248,1248,202,862,1261,236,1186,371,372,373,1337,665,864,505,1387,1388,1398,1399,1393,1397,1400,1414,1571,1204,198,199,312,313,314,1238,1362,456,457,458,456,457,458,829,830,829,830,1320,1694,1724,1323,880,985,987,988,989,990,991,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,994,1012,1013,1014,1015,992,993,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1452,1486,1487,4,20,27,33,123,199,1051,1262,1295,1296,1309,1331,1334,1420,1153,1154,1156,1157,1159,1160,1167,553,1051,1052,1053,1148,1150,1151,1153,1154,1155,1156,1157,1158,1159,1160,1161,1162,1163,1164,1165,1166,1167,1169,1170,1171,1175,1176,1177,1178,1179,1180,1181,1182,1184,1185,1186,1187,1188,1191,167,1037,1038,1039,1040,1041,1042,1043,1044,1045,1046,1047,1048,1049,42,1037,1038,705,706,111,463,1136,1285,1136,622,1128,1336,60,1171,1691,1692,1693,1688,908,1151,1158,738,679,623,623,677,826,827,733,701,733,1683,318,319,320,151,820,1404,1352,1352,1169,1279,1278,733,37,5,58,59,65,90,98,837,852,1028,1044,1056,1057,1058,1061,1114,1051,1187,158,1693,1693,1143,1183,177,1141,1059,110,157,158,159,160,161,163,167,168,212,1061,1257,1344,1632,163,873,980,1199,1200,1201,1212,1225,1226,1227,1228,1229,1230,1273,1288,1289,1290,1291,1292,1293,1294,1295,1296,1297,1298,1299,1303,1304,1305,1306,1307,1324,1370,1434,1506,1508,1509,1769,1769,1242,851,460,209,1204,1216,1307,1268,1353,1353,117,318,319,320,1234,1235,1236,1237,1238,1239,1240,1241,1242,1243,1235,78,90,861,1082,1083,1214,270,785,843,805,1071,1536,95,77,68,76,77,95,286,287,1521,1522,1221,781,1684,1686,202,1598,1598,1065,1070,1598,1506,34,1124,1484,1357,346,347,348,863,864,865,866,960,1190,1507,803,818,843,1294,1396,52,1085,1636,1438,1489,546,1209,1421,1124,879,303,304,305,744,745,784,1060,1689,790,802,808,303,304,305,749,777,778,839,840,842,844,73,196,575,1068,1149,1572,336,337,338,929,930,1546,662,824,738,783,879,1726,58,684,1534,742,210,1192,331,332,1696,450,1688,1383,1244,986,1453,1244,850,1638,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1675,1676,1677,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,1689,1690,1691,1692,1693,1696,1697,1698,1699,1700,1701,1702,1703,1705,1706,1707,1708,1709,1711,1712,1713,1714,1715,1716,1717,1719,1720,1721,1722,1723,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,1742,1743,1744,1746,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1757,1758,1759,1760,1761,1762,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,1817,1818,1819,1820,1821,1822,1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,1881,1882,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,1897,1898,1899,1900,1901,1902,357,360,507,508,509,510,511,512,513,514,515,516,517,518,885,511,512,513,514,297,298,299,1261,30,33,105,127,128,129,58,59,684,582,583,584,585,764,819,585,70,70,1182,750,1695,664,1475,788,1144,1146,863,110,1306,25,26,758,804,806,1278,1337,1340,1341,324,1305,1306,112,113,114,115,116,655,660,1411,1285,108,112,113,1025,1063,816,759,759,754,1017,1023,1024,1467,676,1100,340,377,378,379,643,1747,1747,644,1146,644,754,1359,703,704,300,67,184,875,888,1190,1465,1466,1538,1539,1638,1687,1903,1904,109,1643,67,184,185,1343,1428,1485,1638,1426,1433,640,349,350,351,1184,966,969,12,14,15,664,1375,7,22,85,86,92,93,125,7,92,93,125,1122,1632,1697,1697,1697,837,741,1121,303,862,1366,1849,1864,822,823,832,833,1386,811,951,131,370,206,1699,1699,566,1270,1540,1541,1270,1116,1540,1541,241,247,248,1270,1540,1541,1279,1280,1281,1282,1283,1287,1526,1527,778,791,105,1503,1359,1448,1449,1451,1448,1449,1450,1451,105,816,1421,1422,764,842,1327,1338,1348,1390,1591,279,571,652,1632,839,840,841,842,405,1327,1701,942,1452,1453,481,482,483,484,485,486,1429,1046,1049,632,1905,1701,1701,1702,1702,1702,0,1,2,1688,1864,236,548,1342,585,784,694,608,447,448,1131,1181,447,448,450,451,452,447,448,450,451,452,108,109,571,1055,1426,1436,1437,1524,1602,800,1706,152,1016,1025,1149,1258,1117,1117,1672,161,1525,161,1240,1328,507,508,509,510,1312,1313,1315,509,511,513,514,515,517,518,878,520,521,525,526,530,531,536,537,541,542,523,528,533,538,543,1462,902,1004,1312,1313,84,1905,1530,1703,67,108,398,399,400,691,1232,1404,1406,989,109,38,39,128,276,277,278,207,264,108,109,1404,1405,1406,1064,700,1140,264,1261,138,139,689,1073,1079,1084,1261,1530,1504,1318,279,280,281,580,1187,1271,53,1538,770,23,723,724,937,1274,177,1684,1776,107,112,1410,264,265,266,1427,1428,1155,1706,1399,223,288,289,290,1539,881,928,972,972,969,981,41,53,92,93,97,259,260,41,949,869,593,594,702,858,859,798,1143,1225,270,271,272,1313,1234,1235,103,799,800,802,804,805,806,807,808,809,810,811,812,813,814,815,816,1585,339,340,341,1254,1255,1703,318,319,320,106,107,112,187,1463,1191,77,1439,1441,1443,1445,1209,1225,1227,1228,163,165,1135,1193,1194,1426,1626,1627,1628,1629,1632,1135,1392,1127,1127,1404,1406,1704,1756,915,954,1339,1363,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1212,1250,1504,1285,1076,963,839,839,650,651,650,1117,189,190,191,193,194,849,1438,1439,1440,1441,1442,1443,1444,1445,1446,1447,1449,1450,1451,1488,1492,1495,1496,1497,1498,1630,1631,1248,1309,110,429,430,431,432,433,434,435,436,437,438,439,440,1375,1203,1415,1428,10,41,114,77,79,91,97,282,37,50,197,854,1062,31,37,282,283,284,1098,1242,1243,448,1122,1131,1591,259,260,58,681,682,72,72,61,61,1366,1370,1240,1241,1242,1243,197,176,1234,44,10,1364,99,100,1582,37,192,1516,1591,1311,668,1112,1516,1688,1349,1360,1260,49,66,67,68,159,1049,1705,1221,1705,1705,395,396,397,395,1706,1707,1367,1431,58,288,289,290,875,1151,1371,1372,1373,1374,1376,1377,1528,1270,1271,1272,1307,1411,1307,1270,1271,1272,1293,1307,1308,1309,1310,1320,1323,1324,634,110,559,560,561,562,563,620,769,560,560,279,560,687,487,488,489,1074,1132,28,1278,1280,1281,1282,1284,1285,1526,1527,1074,1132,654,1708,889,568,584,1707,1708,1372,687,985,986,774,576,807,1335,1336,1378,1378,74,1148,602,139,1470,1632,41,1470,1367,1489,1490,1491,1493,1494,1496,1498,1499,1519,1541,285,286,287,1521,1522,807,629,9,51,176,193,197,1291,1318,1441,1442,1443,1446,1451,1497,1498,1631,98,1442,897,1291,1318,1442,1451,1452,1453,1497,386,387,399,648,649,1139,1905,1232,783,1141,324,1143,1525,1540,1305,1306,1325,1684,10,42,167,168,447,1160,1161,1162,1175,1161,818,819,820,821,822,823,824,825,826,827,828,829,830,831,832,833,835,836,844,1414,1432,1435,1414,1432,829,160,1061,958,1426,1051,593,55,55,691,176,1053,1061,1372,1061,160,1322,160,1053,1373,1371,1373,953,1220,1221,762,763,1220,66,83,823,825,826,828,829,831,206,44,18,631,632,801,1077,110,1137,901,902,1004,1816,1861,1242,1243,1067,1709,879,1289,630,217,218,276,450,451,452,703,738,1211,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1211,1211,128,217,392,393,394,450,451,452,845,846,847,848,49,683,847,1439,1440,1441,1872,605,776,1409,839,1711,1016,1317,1318,1542,1711,1711,1325,291,292,293,294,295,296,880,1173,1187,294,295,296,1712,46,576,1713,624,776,777,735,711,1713,1713,886,1008,1009,1121,1543,1544,1560,1435,1205,1502,1860,242,249,250,255,256,257,256,257,1300,1535,1536,912,915,925,1055,1215,1233,1257,1258,306,307,308,1055,1233,1257,1232,880,597,598,1379,879,1014,1015,392,393,394,130,874,1288,1289,1290,1291,1292,1293,1295,1296,1297,1298,1299,1448,1449,31,12,84,32,162,1531,1145,875,956,1152,1582,1646,1646,150,1312,801,710,832,843,1597,1455,1231,1232,337,338,929,930,1193,1193,911,928,315,316,317,318,319,320,1283,1726,1903,1726,1903,103,1359,1448,876,321,322,323,905,907,908,910,1063,1064,1065,1066,1068,1069,1070,1071,1072,1074,1075,1076,1077,1080,1082,1083,1111,1117,1124,1125,1127,1138,1140,1141,1143,1186,1198,1201,1204,1205,1206,1210,1211,1212,1213,1215,1216,1217,1218,1219,1240,1243,1245,1246,1247,1248,1249,1250,1252,1253,1503,141,1082,1378,1427,1428,130,873,1078,1288,1290,1291,1299,852,853,860,1529,1517,1517,1737,1737,577,1715,1715,1715,956,1425,1602,854,1716,820,1712,1712,1863,115,1717,1717,1717,1718,1282,845,874,884,1718,1674,897,901,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1030,1083,699,869,1286,106,107,109,113,127,128,129,152,187,377,378,379,647,1407,1367,591,156,985,1307,282,283,284,1287,1526,16,26,133,134,139,1425,1456,1519,1520,1523,1524,1583,5,98,411,412,413,441,442,443,444,445,446,473,474,478,480,482,483,946,222,47,47,57,100,1588,1378,1137,1286,185,1426,1151,1364,1365,1368,105,158,1067,1344,69,75,69,158,1065,1067,1344,1067,938,39,192,115,598,634,650,651,598,634,1401,1401,115,116,982,2,3,11,12,15,20,21,25,26,27,32,44,45,73,119,121,123,164,187,225,226,339,561,1117,1148,1149,1150,1407,225,37,91,16,1148,45,1,2,3,4,12,14,15,16,20,21,26,27,28,30,31,45,57,66,67,68,84,85,96,119,121,123,127,225,1150,1148,73,1148,1149,940,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,155,217,225,226,261,264,267,282,283,284,346,370,402,403,404,544,555,559,564,565,566,567,570,571,574,578,579,582,586,589,596,601,604,605,609,611,612,613,614,643,648,652,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1025,1026,1027,1030,1031,1048,1050,1149,1190,1409,38,282,283,284,282,283,284,199,238,239,200,201,206,411,412,413,420,421,422,424,426,428,430,432,434,436,438,440,444,445,446,626,1272,1230,309,310,311,882,110,1640,1318,905,907,1354,13,106,107,108,112,113,114,115,116,350,351,370,383,384,385,401,648,649,811,1122,559,560,774,775,775,1721,1721,1721,693,707,708,1038,1063,708,707,708,1035,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,548,549,550,551,552,1168,1632,13,106,107,112,113,114,115,116,350,351,370,374,375,376,377,378,379,380,381,382,383,384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,982,1122,169,300,301,302,939,300,301,302,300,301,302,703,939,1394,1723,161,210,358,359,1148,1153,1154,1155,1160,1161,1163,1166,1167,1169,1170,1175,1179,1180,1182,1185,1192,1193,1665,161,766,767,914,940,941,1055,1290,1489,1493,1496,1498,236,371,519,520,521,522,523,524,525,526,527,528,534,535,536,537,538,548,524,525,526,527,528,1408,1061,1414,1432,280,281,1275,1276,1230,89,94,124,229,89,94,635,212,894,100,261,1722,1841,366,367,368,369,818,409,410,553,620,568,233,234,239,244,245,247,249,251,253,255,257,260,263,266,269,270,272,275,278,281,284,287,290,293,296,299,302,305,308,311,314,317,320,323,326,329,332,335,338,341,344,348,351,354,356,359,362,363,366,367,372,376,379,382,385,388,391,394,397,400,404,407,410,416,419,427,433,439,443,447,452,455,458,465,468,471,474,477,480,483,486,489,492,495,498,501,504,508,509,511,512,514,515,516,518,520,521,522,523,529,530,531,532,533,536,538,539,540,541,542,543,548,591,1161,1166,1167,1179,1185,1192,1417,1510,1512,459,459,907,961,966,967,371,799,910,1064,1065,1071,1072,1074,1077,203,59,681,64,1719,1100,1101,345,1106,1720,1720,1309,1310,1328,1329,1329,812,1245,1246,1247,1248,1252,1503,783,1254,1255,8,33,171,173,181,184,185,187,189,190,191,192,193,194,210,1589,554,170,171,172,173,180,181,183,184,186,187,189,190,191,192,193,194,198,205,210,1636,1636,1719,1719,654,659,699,141,333,334,335,928,1060,1256,1401,1532,1067,333,334,335,334,335,333,334,335,1066,1065,1066,1067,1545,1018,1026,1087,654,656,657,658,659,796,798,1075,1111,1483,798,961,616,1111,1359,198,199,200,201,200,201,199,171,172,208,1002,1003,1557,1349,1351,1360,1720,1075,1109,1295,1296,1297,1298,1636,1637,1638,1639,1640,1641,1642,1643,1644,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1675,1676,1677,1678,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,1689,1690,1691,1692,1693,1694,1695,1696,1697,1698,1699,1700,1701,1702,1703,1704,1705,1706,1707,1708,1709,1710,1711,1712,1713,1714,1715,1716,1717,1718,1719,1720,1721,1722,1723,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,1742,1743,1744,1745,1746,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1757,1758,1759,1760,1761,1762,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,1791,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,1817,1818,1819,1820,1821,1822,1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1851,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1864,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,1881,1882,1883,1884,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,1897,1898,1899,1900,1901,1902,1903,1904,1905,1075,1638,636,1060,1168,636,816,759,1251,956,1258,756,1178,756,774,84,744,745,1530,212,212,212,270,635,970,971,972,973,975,1174,1180,9,654,192,11,17,229,43,229,962,6,1241,1174,1180,756,685,686,687,688,689,690,691,692,693,694,695,696,1140,1632,685,690,692,694,695,986,1118,12,84,1223,709,709,327,627,629,635,639,682,970,971,974,975,976,981,1119,1284,639,982,1098,1284,42,896,1047,896,208,1309,1310,1168,780,23,303,304,305,367,368,369,656,658,666,667,668,714,715,716,717,720,721,722,725,726,727,728,730,731,732,733,734,735,736,737,738,739,741,742,743,744,745,746,747,748,753,754,755,756,757,758,759,760,761,762,763,764,765,766,767,768,769,770,771,772,773,774,775,776,777,778,779,780,781,782,783,784,786,787,788,789,790,791,792,793,794,795,796,797,798,799,800,801,802,803,804,806,807,808,809,810,811,812,813,815,816,818,838,839,1111,216,1090,1095,1096,553,553,620,553,949,1174,1500,1501,1533,1563,1564,1565,1566,1567,1600,1675,1796,1428,1532,1593,127,128,129,264,265,266,1203,1427,1428,1429,1430,1431,1432,1433,1434,1435,1593,1386,1518,42,839,840,1595,358,359,1153,1186,940,883,802,1122,1470,1449,1488,1489,1490,1495,105,894,1302,1303,1333,706,1000,1001,1556,565,1724,1142,1244,1381,1635,1142,1246,755,1724,769,1573,1588,1592,65,754,755,767,1201,1724,1729,1825,1867,894,1381,1577,656,777,797,559,560,73,507,508,510,767,32,1098,643,102,626,914,924,930,932,934,1378,65,1058,79,80,87,258,259,260,79,80,87,258,259,260,65,1057,1058,714,715,716,717,718,719,720,721,722,723,724,725,726,727,728,729,730,731,732,733,734,740,741,743,827,1126,45,77,99,100,102,104,777,1085,192,954,954,658,855,156,364,365,1020,1030,1601,1601,447,448,906,908,1099,1398,1404,1406,712,751,921,1,2,1076,1384,1895,1370,1725,1725,1725,1211,1225,1250,1251,1036,577,1734,1734,577,1126,460,1126,1127,116,1092,1094,1098,1099,1100,1101,1102,1103,1104,1105,1116,1117,1121,1124,1125,1126,1127,1133,1134,1135,1136,1137,1138,1139,1140,1124,1330,1431,1529,1704,1756,669,871,300,301,302,744,102,954,31,47,83,83,903,510,513,517,524,525,526,527,528,1050,1641,343,344,1726,1727,1728,1352,646,74,1148,1193,1194,1626,1627,1628,1629,1632,1474,1194,231,234,246,248,250,252,255,507,511,515,1416,1417,1418,1367,1367,395,396,397,1186,1602,1603,1604,1605,1606,1607,1608,1609,1610,1611,1612,1613,1614,1615,1616,1617,1618,1619,1620,1621,1622,1623,1624,1625,1626,1627,1628,1629,1630,1631,1632,1633,1634,1635,1903,1728,1739,1728,684,1703,757,1703,684,127,128,129,169,181,186,188,203,206,208,258,259,260,261,262,263,264,265,266,267,268,269,273,274,275,279,280,281,264,265,266,267,268,269,63,1590,402,403,404,405,406,407,1730,1731,1731,1731,741,114,114,1732,1019,1021,1732,1732,132,1078,1080,1294,240,245,749,749,596,230,231,233,253,260,263,266,269,270,272,275,281,284,287,351,404,407,447,520,521,523,525,526,528,530,531,533,536,537,538,541,542,543,1079,1166,1192,1510,1636,244,452,1640,1733,4,819,825,826,830,831,832,1254,1255,1381,72,73,74,830,1148,1149,974,1068,1131,1034,848,845,846,847,848,1192,85,1092,1106,1157,1034,1034,1566,1734,1735,1737,833,905,1103,1108,592,1481,107,113,1905,1150,794,1636,146,1033,1086,1087,1279,1335,724,903,202,463,464,465,1098,1109,463,464,465,463,464,465,978,979,184,196,264,265,266,374,375,376,762,902,1034,1068,1078,1317,1545,1578,1580,1594,169,547,23,26,641,730,641,557,1063,1160,1161,1736,980,1738,1596,291,292,293,1187,292,293,1187,703,257,256,861,724,714,714,1287,1317,1318,1319,1542,198,697,704,709,1077,676,22,86,1405,1404,1405,105,1019,1522,1523,659,1726,1738,1141,1738,61,147,648,649,709,724,742,750,782,800,822,938,1097,1264,1287,1529,1533,1535,1539,1543,1545,1589,1605,1614,698,1733,1733,742,1727,1727,1889,108,153,1522,1523,1636,1095,85,102,46,46,0,2,3,4,119,0,1,2,3,4,5,16,26,118,119,47,879,66,357,358,885,1186,61,1054,546,868,698,134,1287,1317,103,104,126,1740,1741,355,1736,1736,1741,1741,595,342,343,344,342,343,344,344,1740,1740,1730,1729,561,1735,1737,1742,1826,1729,1735,1737,1826,1215,1120,161,1048,232,236,254,343,347,1743,1743,1742,1743,478,479,480,487,487,487,488,489,801,774,877,1,2,4,6,7,120,127,235,238,239,240,241,242,243,245,246,247,248,249,250,251,252,253,254,270,405,909,1183,405,406,407,909,405,909,235,240,241,242,245,246,247,248,249,250,253,254,243,251,252,235,240,241,245,246,247,248,405,1748,1748,203,108,109,112,114,569,1063,1259,1405,13,370,264,265,266,453,454,455,766,1337,1340,1341,1408,604,1066,1140,30,31,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,196,197,198,199,200,201,202,203,205,207,208,209,211,212,264,265,266,267,268,269,270,271,272,273,274,275,507,508,509,510,1157,1168,1348,1408,1170,496,497,498,1120,822,29,169,188,202,203,204,205,206,207,208,267,507,508,509,510,1157,1228,207,1351,1337,974,110,1469,19,52,0,1,2,3,4,5,7,8,11,12,19,22,23,106,118,119,120,273,274,275,582,1050,7,98,218,346,1372,1224,1077,1550,838,1550,70,71,346,355,1070,1185,1186,1187,1188,1190,626,1338,624,103,869,1588,42,42,50,51,60,69,267,282,402,403,404,544,555,574,586,648,1387,352,1450,1451,1273,1274,1211,1211,356,1405,1374,142,221,288,289,290,875,927,1371,1373,1376,1528,288,289,290,1376,142,782,128,217,276,1657,1745,217,218,15,17,121,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,185,204,221,511,512,513,514,515,516,517,518,878,885,1134,1376,1508,135,221,140,134,14,136,137,1134,10,64,13,370,139,143,187,865,1513,1514,1515,1516,1517,1524,1527,1534,1535,1537,609,1179,1179,1180,1182,1179,1849,976,1367,169,547,1463,346,347,348,1189,1190,270,271,272,1582,96,622,704,581,1321,1322,1585,374,375,376,378,374,376,379,1661,509,1470,169,692,345,41,172,208,872,880,913,914,1055,1179,1182,1198,1505,1583,172,178,179,208,951,356,408,409,410,1177,1074,890,1461,353,354,688,1461,1463,1468,600,600,482,483,946,647,862,884,1271,199,1117,282,34,76,1746,457,458,470,471,1111,1121,842,1101,1102,587,1379,507,508,509,510,86,507,508,509,510,162,1109,1534,1245,94,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,548,870,871,1641,1746,1746,619,673,817,673,715,817,1744,1078,641,1359,1448,1449,1093,203,1070,633,618,208,184,957,1447,50,71,599,1201,1217,106,107,187,580,27,94,124,460,574,577,905,1361,288,875,878,927,1371,1528,5,10,64,98,505,593,594,739,769,779,791,804,805,806,820,821,904,1028,1060,1168,759,759,769,506,877,878,983,1172,1382,1383,904,879,985,986,1600,698,867,868,869,870,871,1378,568,698,868,449,449,1747,1748,1749,29,205,547,29,547,29,76,1522,255,256,257,268,269,271,272,289,290,292,293,295,296,298,299,301,302,304,305,307,308,310,311,313,314,316,317,319,320,322,323,325,326,328,329,331,332,334,335,339,341,347,348,409,410,473,474,475,477,485,486,508,509,510,515,517,518,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,548,1409,1413,593,594,156,1749,1749,23,1049,60,1372,1375,33,36,129,82,867,1140,696,1399,1356,68,164,186,1574,1768,848,65,149,804,805,806,837,1102,1110,837,804,1759,1759,65,1254,1255,1578,1606,1618,1619,1620,1621,1622,1623,1624,1625,1411,1575,736,1257,1411,1575,1575,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,1752,285,286,287,127,129,1349,1753,58,59,61,62,68,186,1235,642,106,107,158,424,426,428,1074,42,81,1143,110,142,42,94,164,357,358,359,429,430,431,432,433,434,435,436,437,438,439,440,449,453,454,455,502,503,504,506,545,546,709,960,1109,1413,1755,1288,1289,1290,1292,1293,1295,1296,1297,1298,231,234,507,72,1226,1290,1198,1505,1514,1287,1317,760,184,185,189,190,191,193,194,195,1311,1316,688,1755,353,354,791,1755,1756,1692,1703,1716,1724,1760,1764,1772,1841,1885,38,44,76,285,286,287,39,77,286,287,50,1751,1751,309,310,311,882,882,39,366,367,368,369,14,15,17,18,20,21,1518,164,1413,1574,270,271,272,1272,1574,864,222,60,60,1372,1236,1333,949,13,1237,1563,1564,1565,1566,1567,1633,1634,1635,670,671,672,673,674,675,676,677,678,679,681,682,1291,1632,75,1219,294,295,296,1201,1213,1215,1216,1217,1218,1219,1220,1222,1223,1224,220,1439,1441,1443,1445,1446,1128,845,846,847,848,1436,848,848,1506,1507,1520,181,951,848,66,41,116,1368,41,1546,1225,1226,1434,1211,1757,1758,1758,1757,1757,706,1726,1752,705,706,1752,760,122,1759,889,893,1467,1758,859,1409,1644,1678,1683,1689,1694,1700,1721,1723,1724,1739,1750,1756,1774,1793,1799,1813,1831,1844,1865,1891,1892,1689,1723,1844,1891,1892,1659,1683,1689,1721,1723,1739,1745,1750,1774,1793,1799,1831,1844,1865,1883,1885,1891,1892,1721,1754,41,1753,1753,980,1425,793,1760,768,1760,1413,1688,1688,129,1259,1764,449,1063,1726,1158,573,1461,1463,1762,1762,1817,1851,1174,798,850,873,892,1077,1764,112,113,345,687,787,788,789,792,795,796,800,823,850,855,873,883,886,1072,1073,1074,1075,1140,1161,1259,1280,1533,1585,1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,1638,1764,843,844,659,205,1213,1217,1761,1155,663,1076,641,838,1761,891,1462,1194,1626,1627,1628,1629,1632,1193,1194,758,891,1462,1469,1470,801,1128,395,1762,1763,1308,460,618,444,445,446,441,1596,1403,25,1138,1643,1763,1763,0,1,2,3,4,7,12,23,120,1125,1764,891,1462,297,298,299,1107,844,499,500,501,499,500,501,499,500,501,833,835,1312,449,618,297,298,299,1354,1478,893,1073,742,798,892,618,1139,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1601,1210,1107,896,1585,1586,3,1632,1775,1775,1775,1765,774,795,1683,156,1765,1765,821,1334,1335,1336,1424,1550,1216,1237,1550,1551,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1562,1766,1767,1471,1768,215,216,947,549,551,747,1426,128,1403,1074,1161,350,766,1184,1726,1684,1768,17,18,20,21,123,155,228,511,512,513,514,17,18,20,21,123,155,228,511,512,513,514,18,20,21,303,777,817,840,841,842,1119,567,620,1770,567,730,1821,730,1769,1182,417,418,419,417,418,419,420,421,422,839,840,842,1342,1146,1209,67,1147,1262,1263,1264,1265,1266,613,1184,1075,1585,1744,1771,1772,1771,1772,1897,1897,1772,838,1773,1773,1773,879,892,1766,1766,1775,315,316,317,1151,1365,1366,1276,1277,309,346,347,348,1368,1592,1103,1362,1185,244,257,363,675,1185,1510,675,675,1078,591,764,1260,1383,972,973,1867,901,1780,1780,1063,1259,1776,1776,1776,318,319,320,1234,26,598,634,1041,1534,1602,1603,1604,1605,1606,1607,1608,1611,1612,1613,1614,1615,1616,1617,1618,1619,1626,1627,1022,1027,1494,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1397,1465,1563,1564,1567,1568,1570,1576,1579,1581,820,1785,1785,2,4,5,6,7,4,6,7,120,981,1394,756,1416,1417,1418,1420,696,297,298,299,336,337,338,929,930,956,1308,1354,1546,1548,697,704,709,1410,615,1777,1301,1184,704,706,707,708,709,1533,713,742,1096,291,880,1187,1262,1263,1265,708,709,1777,1777,1269,50,165,175,189,200,209,1226,1254,1303,1304,1305,1306,1424,1443,1444,1445,1447,1448,1449,1456,1492,1493,1494,803,175,175,178,200,1444,1448,1454,1455,1486,1487,214,215,763,337,338,929,930,956,1187,1307,1308,1546,1548,392,747,718,718,1325,570,1476,1853,1853,573,508,514,518,529,530,531,532,533,1641,1782,1515,1872,130,1288,1289,1290,1291,1292,1293,1299,1568,1570,1574,1576,1579,1581,1563,1564,1567,1692,1703,1716,1724,1760,1764,1772,1841,1885,742,782,1208,1583,449,449,508,510,513,514,517,518,524,525,526,527,528,529,530,531,532,533,1050,1512,1641,1642,1512,1642,1779,48,1781,1781,887,1202,1354,1478,1262,1263,1264,1265,1266,1267,1786,1786,1270,1411,1546,23,23,48,1779,1779,898,962,1367,177,1379,478,479,480,478,479,480,149,635,917,956,957,958,1063,1256,1257,1258,1259,1505,1642,1260,1039,1045,1055,2,14,15,17,18,20,121,130,131,133,134,135,136,137,138,143,145,146,147,148,150,155,196,508,509,510,511,513,514,515,517,518,878,885,215,180,719,985,1427,1428,1593,41,1525,1290,1324,1356,1324,1356,570,655,1476,229,1192,23,33,36,155,228,155,1192,10,832,1414,831,1530,217,217,1060,163,1263,1267,1783,1783,1330,1413,1431,1413,1431,182,644,646,595,1310,753,665,848,849,1321,1322,1331,1332,1333,1334,1335,1336,1358,1331,1333,1334,1424,1424,911,866,1141,1529,4,6,7,815,814,815,907,41,48,113,1221,1385,1417,102,225,226,261,1486,1487,1540,1541,1184,938,1640,1284,1640,1640,1391,502,503,504,688,1198,1199,93,1199,1383,14,15,17,18,20,121,130,131,132,133,134,135,136,137,138,139,141,143,145,146,147,148,150,155,185,186,204,508,509,510,511,512,513,514,515,516,517,518,519,690,878,885,131,121,515,1196,1197,1232,1504,209,1303,1304,1305,1306,1441,1443,1564,1574,1296,1298,1781,1782,1783,1784,1778,184,460,569,577,706,1078,1121,1126,1127,184,706,1115,984,1424,866,1348,770,787,839,222,141,1784,1784,1785,1786,48,1542,1576,181,1787,1861,723,1798,1798,1798,1794,1794,117,1126,1230,1412,69,102,103,104,157,166,1792,1792,1254,1255,380,381,382,1462,682,159,380,605,606,1024,1034,1068,1070,1121,1122,1123,1133,1134,1135,1136,1138,1186,383,392,393,394,395,1361,851,1361,1254,1255,1368,1254,1255,1139,233,1477,130,1289,1290,1291,1292,1293,1294,1295,1296,1297,1298,1299,1295,1296,1297,1298,1299,1349,1360,738,1192,681,1806,1806,1808,1808,1805,1805,232,234,236,238,240,241,242,243,254,255,256,259,262,265,268,271,274,277,280,283,286,289,292,295,298,301,304,307,310,313,316,319,322,325,328,331,334,337,340,343,347,350,353,355,357,358,361,368,371,375,378,381,384,387,390,393,396,399,403,406,409,415,418,425,431,437,442,448,449,451,454,457,464,467,470,473,476,479,482,485,488,491,494,497,500,503,509,510,511,512,513,515,516,517,520,521,522,523,524,525,526,527,528,534,535,536,537,538,542,548,590,1175,1416,1511,1512,1795,1795,881,1172,631,833,1803,1803,1721,598,232,234,235,236,237,238,240,241,242,243,254,255,256,259,262,265,268,271,274,277,279,280,283,286,289,292,295,298,301,304,307,310,313,316,319,322,325,328,331,334,337,340,343,347,350,352,353,355,357,358,361,364,368,371,375,378,381,384,387,390,393,396,399,403,406,409,413,415,418,422,425,426,431,432,437,438,442,446,448,449,451,454,457,464,467,470,473,476,479,482,485,488,491,494,497,500,503,509,510,511,512,513,515,516,517,519,520,521,522,523,524,525,526,527,528,534,535,536,537,538,548,1175,1416,1511,1754,312,313,314,717,762,722,210,1309,1175,544,991,356,435,436,437,438,439,440,943,1754,355,849,850,1322,707,1222,441,442,443,1113,1799,1854,139,155,873,1275,1276,1321,1456,1519,1520,1521,1522,1523,1524,1533,1534,1535,1536,1537,1538,1539,1542,1548,1583,1637,1275,1287,357,360,361,362,509,511,513,514,515,517,518,885,1193,1511,1793,1793,613,618,879,1107,1724,1791,826,1800,1800,374,377,1408,773,58,112,113,1112,1141,1141,19,52,279,402,403,404,402,1285,822,836,1244,1325,1326,1513,1514,1515,1516,1517,315,316,317,1132,1801,1801,1804,634,1804,1817,1851,1899,738,1788,767,1542,1657,1745,766,288,289,290,188,1790,839,43,1585,1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,762,763,764,765,766,770,779,800,775,893,306,307,308,1360,213,214,1084,1086,1087,1088,1089,1084,58,875,1377,1528,58,704,875,1371,1372,1373,1374,1376,1377,1528,192,502,502,503,504,688,774,775,1033,1197,1609,1610,1620,1621,1622,1623,207,1200,80,1199,1200,38,39,44,76,77,1710,1716,715,10,780,10,1307,1314,1307,234,236,238,240,241,242,243,254,255,256,259,262,265,268,271,274,277,280,283,286,289,292,295,298,301,304,307,310,313,316,319,322,325,328,331,334,337,340,343,347,350,353,357,358,361,368,371,375,378,381,384,387,390,393,396,399,403,406,409,415,418,425,431,437,442,448,449,451,454,457,464,467,470,473,476,479,482,485,488,491,494,497,500,503,509,510,511,512,513,515,516,517,520,521,522,523,524,525,526,527,528,534,535,537,548,1416,1511,142,1469,1416,1372,567,568,389,85,1485,389,848,389,390,391,389,390,389,905,389,391,163,165,187,1279,1035,1317,1318,1319,916,1576,771,772,773,1807,1130,1807,1792,1207,1210,602,892,684,1722,1722,1799,684,1207,1210,1368,1077,992,173,184,191,192,880,1470,992,37,1636,1637,689,1084,1189,366,367,368,369,582,585,818,819,834,833,1036,889,69,503,504,563,926,1240,1240,1339,926,1435,1515,1830,203,1408,1131,1380,11,24,25,27,127,1795,1796,1797,1409,1225,1226,1434,1506,1508,1509,432,434,436,438,440,1375,111,1508,1391,701,826,827,857,859,1789,1789,1025,667,548,834,1788,349,1788,28,185,876,1078,1169,1278,1279,1280,1281,1282,1283,1284,1285,1287,1317,1318,1412,1526,1527,1278,1278,1797,1797,1234,127,128,129,555,556,720,1595,153,75,920,108,109,110,112,113,114,115,116,117,401,1790,1790,1587,1587,1802,1802,582,585,330,331,332,799,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1030,1077,1587,799,1030,575,1514,899,900,902,988,1031,1038,1787,1787,864,1187,889,893,681,366,372,519,520,521,522,523,529,530,531,532,533,539,540,541,542,543,548,1048,529,530,531,532,533,942,968,941,965,968,941,935,429,430,431,432,433,434,944,951,855,484,485,486,852,853,854,855,896,899,921,978,899,601,602,603,1238,1389,602,1389,72,236,1525,1,2,4,5,28,30,31,36,38,39,40,62,66,77,81,87,90,95,105,118,129,227,228,40,408,441,469,481,484,945,926,783,1245,1246,1247,1248,1503,1503,1294,1409,1809,1809,1800,804,1801,372,916,1802,1803,1804,820,828,829,829,576,134,1206,1513,1538,1513,1538,499,500,501,94,124,212,212,1142,1143,712,751,321,322,323,1201,1204,1205,1206,1207,1208,1209,1210,1211,1212,1213,1214,1215,1216,1217,1218,1219,1220,1221,1222,1223,1224,1485,1566,1633,1204,1205,1206,1216,321,322,323,715,352,889,893,1467,236,1525,40,129,1195,1203,1434,1509,1195,1203,73,1805,1806,373,1807,1808,1796,1796,401,578,648,649,642,1809,1810,756,210,1893,208,1532,1810,1810,257,54,798,980,981,850,1638,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1675,1676,1677,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,1689,1690,1691,1692,1693,1696,1697,1698,1699,1700,1701,1702,1703,1705,1706,1707,1708,1709,1711,1712,1713,1714,1715,1716,1717,1719,1720,1721,1722,1723,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,1742,1743,1744,1746,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1757,1758,1759,1760,1761,1762,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,1817,1818,1819,1820,1821,1822,1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,1881,1882,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,1897,1898,1899,1900,1901,1902,860,1884,127,128,129,555,556,557,559,560,563,564,565,566,567,570,571,572,573,574,578,579,580,582,584,585,586,587,588,590,591,592,594,595,596,597,599,600,601,602,604,605,606,607,609,610,611,613,614,618,619,622,623,627,628,630,631,632,633,637,638,643,644,645,646,647,648,649,650,651,652,653,654,656,658,659,660,661,665,666,667,670,671,672,673,675,681,685,686,691,693,694,695,697,699,700,701,702,703,705,706,707,708,709,715,717,718,721,724,725,726,728,731,733,735,794,852,853,854,855,860,866,871,1016,1017,1018,1019,1020,1021,1022,1023,1025,1026,1027,1029,1030,1031,1038,1048,1050,1062,1072,1073,1076,1819,1819,68,61,68,851,1407,1093,147,1812,1156,1191,1153,1144,1145,1371,110,1592,1318,1539,1568,1569,1570,1579,1581,657,1818,1818,74,74,1148,46,78,88,89,90,91,134,229,710,711,710,711,1132,1108,1674,1816,38,148,231,234,255,507,511,515,1770,887,931,1016,1025,1073,1530,1577,1811,1821,1826,230,1273,1274,1273,1274,887,1440,1490,1095,265,266,1578,1815,1894,1302,1333,1815,1815,371,1812,1814,1814,1812,56,897,898,903,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1030,1033,1034,1035,1036,1066,1258,1435,1537,1010,1011,1469,1561,345,345,1820,1820,1816,40,96,127,128,129,197,243,251,252,264,265,266,892,1203,1232,1298,1427,1428,1429,1430,1431,1432,1433,1434,1435,1538,1539,1578,1601,1817,349,51,1198,1198,23,1432,210,507,76,792,793,792,992,265,266,1813,1438,1439,1445,1771,1794,1799,1439,1726,1799,1445,1446,1678,1817,1817,48,72,102,113,217,219,589,597,914,127,128,129,264,265,266,986,1203,1427,1428,1429,1430,1431,1432,1433,1434,1435,1588,130,1205,1206,1280,1281,1282,1283,1284,1307,1314,1566,1234,1261,1268,1269,1314,1205,1206,1261,1268,1269,1592,1202,1203,1263,1818,1819,1435,1820,1436,1552,1487,1550,1562,156,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1562,1565,1565,288,289,290,1371,1419,366,367,368,369,698,746,748,1351,746,81,992,994,996,998,1000,1002,1004,1006,1008,1010,1012,1014,1063,1534,1579,1579,781,383,384,907,634,1590,467,468,652,653,654,657,658,659,660,662,666,667,1062,1112,1756,992,994,996,998,1000,1002,1004,1006,1008,1010,1012,1014,959,660,1550,795,7,110,120,170,187,703,738,764,778,779,819,850,887,930,1140,1372,1395,1459,1462,1463,1588,1592,1754,1800,972,1195,1203,1313,1509,174,175,177,312,313,314,872,873,874,1270,1272,1309,336,337,338,112,124,183,953,1260,586,589,35,180,196,264,265,266,267,268,269,1535,1536,1537,1580,1594,180,1580,1058,242,249,250,255,256,257,869,1336,1633,255,256,257,985,986,1229,1241,1249,1253,732,732,1461,1822,1822,1822,94,129,1461,789,6,105,141,187,762,1054,1178,1456,1487,199,924,930,932,934,26,37,273,274,275,593,940,994,995,1163,1197,1435,1487,1553,112,789,745,904,89,95,96,160,1,2,4,5,29,31,62,81,84,87,90,118,205,1052,1263,1297,1298,1310,1332,1452,1453,1486,1487,1600,1381,1600,1600,647,1484,1240,1242,1243,339,1491,1586,145,717,737,901,1093,1266,1419,1508,1509,1544,1584,1587,1588,1592,1594,1595,1600,1603,1612,1626,1628,558,980,1218,1275,808,220,221,222,1311,1329,851,1530,139,1521,1522,1523,1466,676,637,616,24,25,27,67,227,803,1292,856,895,115,981,330,1032,1291,19,1522,1523,1634,1883,1885,30,31,105,899,902,1037,64,1487,633,1588,581,582,583,584,585,1473,583,668,803,1581,1199,1210,1823,1294,1078,984,1314,1315,964,1104,469,1331,1332,778,1270,1272,1113,1229,803,1396,229,88,324,325,326,1143,1305,324,325,326,324,1142,1143,1305,508,509,510,511,513,514,515,517,518,1159,1205,1828,1828,1835,1835,1833,1833,324,325,326,1143,169,171,172,174,175,176,177,282,283,284,701,733,206,777,778,1823,1823,759,759,614,1073,1155,1165,1078,687,1236,1259,1261,1268,1269,1270,1271,1272,1273,1274,1301,1307,1395,1518,1323,1324,1324,1826,974,1836,1836,974,683,1054,1294,1271,534,535,536,537,538,539,540,541,542,543,551,552,520,521,522,523,524,525,526,527,528,529,530,531,532,533,548,549,550,860,894,906,907,908,1581,405,406,407,638,173,1542,1038,71,768,809,824,828,829,830,910,1069,1070,1071,1122,1130,1131,71,450,451,452,156,1083,1535,915,966,967,969,1596,141,1421,1422,1331,1335,1336,793,798,809,810,811,812,929,961,115,1491,1499,620,1137,1278,1284,1285,1412,1527,1234,1824,750,183,629,1468,726,637,637,746,746,725,668,834,408,409,410,1426,1433,1433,225,32,32,411,209,1302,1303,1304,1333,1301,1307,1301,628,53,450,452,490,507,508,509,510,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,546,547,548,926,1433,739,740,768,1566,1222,156,180,450,499,321,1141,1372,1518,1421,96,96,203,208,231,234,235,237,246,248,250,252,253,254,255,258,261,264,267,270,273,276,279,282,285,306,307,308,349,352,355,357,358,360,365,369,402,405,408,411,412,413,414,417,420,423,424,429,430,435,436,441,444,449,453,456,459,463,466,469,472,475,478,481,484,487,493,496,499,502,505,506,544,545,546,1413,1234,1824,1824,677,681,682,619,677,559,560,563,567,568,569,604,605,606,620,1366,954,954,1827,735,1373,52,91,102,1827,642,188,211,1225,1226,1227,1228,1231,1434,1506,1508,1509,1434,852,853,854,855,856,858,859,860,861,868,883,886,894,895,896,898,899,900,901,902,903,905,907,908,1035,1036,1050,1065,1077,1250,1251,1142,1250,1251,288,289,290,315,316,317,1460,355,1216,282,1183,1339,1340,1339,1410,741,936,716,1394,1142,812,810,1128,1137,1163,1223,801,1830,586,587,588,589,765,587,110,1267,1373,327,328,329,1099,1321,1322,1392,733,1130,181,182,699,1073,721,1104,956,1104,134,135,137,144,269,686,798,800,1051,1079,1167,1591,1642,48,1099,1223,109,638,1639,1643,656,1483,1120,756,774,1831,1531,768,1828,1829,1410,861,1085,1087,1088,1089,1413,1459,1637,327,328,329,970,971,972,973,845,846,847,1016,1017,1018,1019,1020,1021,1022,1023,1025,1026,1027,1030,1032,330,331,332,1032,1313,1315,685,686,689,690,691,692,693,694,695,697,698,699,700,701,702,703,704,705,706,707,708,709,712,714,715,716,717,718,720,721,723,724,725,726,727,728,731,735,738,739,740,742,744,745,748,794,871,1072,1073,720,1374,839,918,116,906,1099,1113,1117,1124,1125,1127,1138,1139,1488,1489,1491,1493,475,476,477,24,25,27,227,616,906,908,493,494,495,496,497,498,1138,1140,1124,1129,85,208,2,19,52,160,1233,635,306,307,308,1386,1643,1386,1514,1129,1826,750,1207,1212,189,190,191,193,194,195,1359,1439,1445,1495,1589,1181,392,393,394,1470,1544,1630,1631,189,190,191,193,194,195,1226,1254,1255,1317,1318,1438,1440,1442,1444,1450,1451,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1630,1631,156,108,109,83,1126,1133,1134,1135,1136,1138,1829,612,909,1111,1637,336,337,338,929,930,956,336,337,336,338,210,1829,882,493,494,495,1154,1544,1825,1825,1104,110,563,472,494,495,1121,110,157,833,783,1070,783,824,765,764,1400,781,1834,1834,502,503,504,1317,873,874,1201,1410,1637,873,1201,1288,1295,1296,1297,1298,1299,779,780,817,821,1414,1432,736,767,794,801,698,1385,1171,763,1283,1550,832,103,103,126,261,262,263,198,349,1123,1231,1233,965,202,203,1461,24,25,27,43,666,797,208,417,418,419,420,421,422,206,208,1191,1459,1692,363,363,364,365,1080,1287,1317,1318,1319,1542,786,962,1273,1274,208,178,179,22,72,670,757,1444,1494,1276,102,508,510,513,514,517,518,524,525,526,527,528,529,530,531,532,533,1050,1512,1641,1642,1050,1554,1555,1557,1559,350,351,1859,553,620,1272,1236,620,1331,1332,1333,1334,1427,1599,339,1331,1085,423,425,427,1355,1425,105,288,289,290,294,295,296,1212,1249,319,320,863,960,1593,127,128,129,264,265,266,1203,1427,1428,1429,1430,1431,1432,1433,1434,1435,1593,1247,1286,802,1193,173,213,214,342,1150,1152,1189,1347,1408,1410,12,22,86,102,637,1124,1122,1834,828,829,1435,914,918,922,1199,383,384,1102,816,1832,161,658,62,135,134,221,198,954,1063,1179,198,199,827,139,1519,1520,1521,1522,1523,1524,1525,1392,291,292,293,85,559,620,1172,154,688,106,107,138,150,735,1122,1417,1470,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1575,1607,1616,181,1169,1170,946,178,179,1321,1322,1413,370,1128,76,1835,1836,647,1837,1837,1837,1018,1022,1026,1027,1218,1205,351,1184,1641,1401,273,1520,1521,1522,1283,30,33,40,1195,1203,1509,95,156,985,1307,183,1547,605,606,606,566,442,443,460,485,486,940,941,1636,460,577,442,443,460,577,940,941,1636,1097,1097,1105,1436,1587,1212,1370,1633,1436,752,103,917,912,912,911,912,913,914,915,917,918,921,952,977,1039,1042,1043,1050,1051,1052,1053,1054,1050,1641,1053,1053,37,170,171,172,173,198,203,273,274,275,1295,1297,203,273,274,275,590,1472,792,798,300,301,302,1127,1485,765,603,1287,1377,1029,947,1390,1262,1263,1264,1265,1266,1383,642,1345,1286,1226,1290,1293,1228,1506,1318,1240,1245,1247,1248,1252,1253,1261,1268,1486,1501,1503,1223,1207,142,1317,935,195,142,1529,1529,64,103,106,112,113,139,143,158,240,245,246,447,690,723,727,825,875,886,933,1069,1078,1139,1140,1232,1259,1262,1322,1428,1495,1497,1519,1520,1521,1524,1534,1538,1568,1569,1570,1571,1579,1582,1593,1596,1598,1599,1601,1602,1611,1630,1631,1637,1687,1905,240,245,769,1197,662,1380,1380,1418,1453,349,285,1692,1703,1716,1724,1760,1764,1772,1841,1885,1547,915,580,402,453,828,829,904,19,52,5,47,47,22,52,91,888,889,890,891,892,893,1191,1408,1459,1461,1462,1463,1464,1465,1466,1467,1469,1470,1471,1191,1459,1452,1081,1060,1404,1515,1538,1708,306,307,308,1452,1486,1487,1345,1448,644,646,1684,1685,1686,1702,1708,1758,1776,1789,1862,1880,1890,1595,962,1190,316,317,1589,86,963,937,35,279,280,281,417,418,419,279,222,1225,54,506,1382,839,1428,1593,1435,1385,1414,1416,1417,1418,1420,116,1448,1449,1454,1486,1838,1838,1529,1492,1493,192,1493,1120,136,956,1493,651,599,599,1221,132,1079,1081,1696,1696,1832,703,788,789,790,791,796,823,1077,28,75,1278,945,1832,166,174,190,201,411,412,413,420,421,422,424,426,428,430,432,434,436,438,440,444,445,446,1255,1439,1440,1441,1447,1448,1449,1450,1451,1456,1488,1489,1490,1491,174,174,179,201,1226,1440,1449,1450,1451,1457,1485,1486,1487,173,962,1193,1032,1202,1203,1356,1404,1405,1406,872,1287,1839,677,951,960,571,572,794,117,37,187,321,322,323,456,457,458,865,1116,1215,1392,1409,321,322,323,330,331,332,981,321,322,323,1111,1528,601,602,603,607,608,1389,6,1643,1421,45,754,1274,1395,1274,908,949,908,6,45,1316,1242,1243,742,130,131,155,511,512,513,514,515,516,517,518,685,885,1193,1194,1839,1839,618,889,453,454,455,875,1416,1417,623,749,752,1147,979,1191,690,691,689,1227,1449,1453,956,6,682,202,905,1322,1452,1534,1603,1604,1605,1607,1608,1609,1610,700,867,469,470,471,469,470,471,343,344,350,351,1184,349,884,1184,1840,1841,1330,1194,1173,192,449,1096,1325,1326,1433,831,441,1362,441,442,443,1176,161,441,442,443,444,445,446,1113,1176,90,1132,1841,1132,1841,935,1842,1842,1842,76,95,767,909,956,1167,1170,1175,1178,1180,1182,1185,1190,1218,1416,1417,1542,1883,1892,1903,1904,1586,1674,141,22,53,78,79,80,85,86,91,92,93,97,98,99,107,125,140,258,259,260,53,78,97,579,596,346,962,1150,1152,1392,1346,1480,1714,858,1714,963,963,371,1670,1724,1770,1778,1830,1849,1889,1530,823,686,782,1277,1278,1284,1591,876,1169,1280,1281,1282,1283,1285,1317,1318,1412,1526,1527,402,403,404,909,447,785,1904,35,173,35,1860,1860,1854,1655,1896,1655,1896,855,1854,857,985,986,1174,1180,1174,1180,770,774,1739,322,903,371,372,373,1859,1744,1798,9,10,43,44,181,1162,1162,1695,1113,942,796,270,271,272,1173,980,1370,4,1032,1032,843,982,1843,453,454,455,650,769,1241,1275,1276,962,23,23,1348,1213,1213,544,1845,1208,1354,297,298,299,1354,1478,31,32,89,94,124,1156,109,112,113,114,1077,1490,1494,1381,37,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1312,1313,1315,758,291,292,293,295,296,723,880,923,1173,1187,1301,1325,1426,1364,1365,1368,1369,1460,315,316,317,1151,1327,942,947,156,1204,1205,1206,1211,680,1479,680,1479,680,1479,831,1726,1904,1904,1147,1530,1530,94,124,94,124,1234,1235,1503,1350,1351,1350,1525,1540,1271,95,96,1112,1846,1858,1847,389,466,467,468,652,653,654,655,658,659,660,661,662,667,798,961,963,1062,665,666,795,796,655,36,1254,1255,661,1056,1057,1058,975,1384,1088,11,31,36,194,1333,1334,1599,1334,1331,1332,1333,1334,1347,1411,1427,127,225,226,1078,697,697,561,211,1359,958,938,788,1855,1855,255,256,257,1066,1168,1291,1292,1255,1840,1840,502,503,504,44,105,647,1484,804,303,304,305,562,983,1586,1326,1383,1006,1007,1559,1144,1145,43,229,1845,1845,1848,34,545,1016,546,188,207,785,1222,49,50,51,207,778,84,1391,705,1447,1540,1544,1578,1602,1606,1609,1610,1618,1619,1620,1621,1622,1623,1624,1625,1626,1627,1628,1629,1630,1631,1632,1634,1635,15,121,1162,659,1390,1390,805,774,703,700,590,591,1204,661,669,666,33,82,33,1347,1533,225,1066,1068,1034,913,914,892,1068,470,471,961,963,964,965,966,967,968,969,981,1531,591,1294,1113,1153,1154,1167,110,110,30,31,49,69,83,89,94,1175,1176,1178,1179,1180,1181,1182,1176,1179,1180,1181,1182,161,176,159,1120,1035,879,909,879,881,1155,1160,1167,1169,1170,1171,1172,1285,1402,881,810,1275,1276,1165,1533,831,1371,544,544,1363,1249,42,505,1387,1388,845,846,847,112,401,666,797,892,712,285,286,287,285,285,286,287,1485,33,33,981,1105,12,32,84,1850,58,59,61,62,63,68,95,96,100,1371,1373,44,54,913,929,931,933,1447,1853,47,1258,28,157,168,169,180,183,186,187,188,196,197,199,202,205,959,960,1055,1280,1281,1282,1283,1287,1410,1412,1413,1418,1425,1426,1428,1429,1430,1436,1437,1468,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1510,1511,1512,1513,1514,1515,1516,1517,1518,1527,1546,1547,1548,1550,1571,1572,1573,1575,1577,1578,1580,1581,1582,1583,1585,1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,957,958,1370,1506,1507,1582,352,1461,1463,1471,31,33,36,40,82,1195,1196,1509,40,1195,1203,1508,544,545,546,850,546,679,9,23,25,641,153,1088,1279,840,85,544,1207,1210,1848,1848,321,322,323,1206,1210,226,1487,1113,1674,1861,371,236,956,975,1384,1004,1005,1470,1558,181,182,1852,948,949,1110,948,1110,108,224,1377,37,77,44,77,1325,1326,795,800,461,462,978,979,1114,461,1114,499,500,501,777,778,345,1490,1494,1160,1114,1099,108,109,1643,355,617,901,1019,1024,1031,1036,1037,1050,1597,974,898,1203,1248,210,1115,1115,54,56,168,506,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1030,1382,56,168,506,54,56,57,99,101,168,1115,339,340,341,768,810,906,1208,8,79,1178,1178,1126,615,1852,1852,1852,1850,1850,615,645,669,669,566,26,137,181,182,666,971,1040,1171,1495,1497,1564,1622,1623,1624,1625,1628,1629,1630,1631,1218,220,1225,1434,219,1430,219,617,282,0,1,2,3,4,5,8,9,11,12,13,15,16,19,21,22,23,24,25,27,29,43,73,106,118,119,121,122,0,1,2,12,19,118,1030,1031,1,2,3,4,5,8,12,13,14,15,19,21,22,23,29,30,73,74,106,110,118,119,121,1030,1031,43,122,43,122,724,882,161,882,1403,1430,1403,1430,833,43,102,1855,767,783,788,807,808,813,814,815,669,647,1484,1528,1800,185,73,146,1251,1060,1220,1389,1176,1176,63,63,219,219,1121,56,1112,54,589,461,462,805,852,855,1044,1056,1057,1058,1114,462,462,462,1056,1057,1056,1057,1057,1058,1856,1397,1398,1397,1119,93,93,1090,1075,1159,833,1383,757,804,833,1196,1091,1092,318,319,320,1016,1189,865,1844,169,1856,1856,519,521,524,526,529,531,534,537,539,542,321,522,527,532,535,540,1457,380,381,380,382,53,140,279,280,281,1582,217,1195,1196,1197,1198,1199,1200,1202,1203,1205,1210,779,786,792,1574,1441,1442,1443,1739,1772,1858,1900,1441,1867,1443,587,402,403,404,453,454,455,115,116,330,331,332,980,981,982,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1029,1030,1031,1032,1035,1036,1059,1369,1370,980,1133,1133,793,1716,1716,1341,1349,158,133,159,1034,1066,1068,1543,1545,1066,1068,133,824,1398,133,129,544,1195,1196,1197,1198,1200,129,544,1531,1380,163,164,165,166,167,82,577,913,914,1055,1489,965,67,62,744,745,749,739,791,678,679,679,832,1049,609,67,68,661,1049,1269,1314,1315,160,1549,171,173,1338,173,1543,1400,114,1259,1144,781,841,456,464,466,469,472,476,479,481,484,487,490,493,496,861,935,1092,1098,1103,1112,1176,457,458,459,461,462,463,465,467,468,470,471,473,474,475,477,478,480,482,483,485,486,491,492,494,495,497,498,861,940,941,946,949,1081,1082,1086,1090,1091,1092,1093,1094,1095,1096,1097,1098,1099,1100,1101,1102,1103,1104,1105,1106,1108,1109,1110,1114,1116,1176,1346,596,652,605,606,627,673,685,686,687,690,695,697,709,1029,1038,1050,1052,1053,1061,1076,1185,904,697,697,339,340,341,138,916,1187,1287,1412,1413,1414,1415,1416,1417,1418,1419,1420,1421,1422,1423,1424,1430,1438,1439,1440,1441,1442,1443,1444,1445,1446,1448,1449,1450,1451,1453,1458,1470,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1485,1487,1488,1489,1490,1491,1492,1493,1495,1496,1497,1498,1499,1500,1501,1502,1503,1506,1508,1509,1535,1536,1539,1543,1544,1545,1550,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1562,1563,1564,1565,1566,1567,1568,1569,1570,1571,1572,1573,1574,1575,1577,1578,1579,1580,1581,1582,1583,1584,1585,1586,1587,1588,1589,1591,1592,1593,1595,1596,1597,1600,1601,1611,1612,1613,1614,1615,1616,1617,1618,1619,1620,1621,1622,1623,1624,1625,1634,1635,1539,1568,1569,1570,1571,1572,1573,1575,1577,1578,1579,1580,1581,1582,1583,1584,1585,1586,1587,1588,1589,1591,1592,1593,1595,1596,1597,1600,1601,1214,667,1525,1540,4,27,607,748,1120,1857,1780,1599,1670,1724,1770,1778,1791,1830,1849,1889,1903,1904,1267,861,1528,981,580,1503,1506,225,687,414,415,416,563,414,415,416,626,16,159,173,321,322,323,897,1033,1034,1035,1068,1072,1462,1467,1470,1543,1544,1551,1034,736,32,226,1369,16,897,133,330,331,332,897,1035,1036,1066,1068,1369,1545,1577,1722,1885,1892,918,954,1419,209,1268,1301,1302,1303,1304,1307,1311,1314,1316,1320,1321,1322,1323,1324,1325,1326,1327,1328,1287,1317,1318,1319,1542,887,1409,764,345,42,102,161,453,454,455,904,911,453,454,455,790,102,792,820,904,454,455,453,454,455,583,828,1362,409,410,1283,1376,779,426,428,795,800,1101,1102,1103,1375,1179,414,415,416,663,617,219,1145,1159,1159,216,865,1116,1194,1409,1619,1621,1623,172,178,179,264,265,266,950,959,1427,1428,1500,989,843,879,881,38,39,44,509,1325,833,834,835,728,810,1075,212,1506,1144,1218,1219,1246,579,960,579,909,64,1195,1203,1512,212,16,867,96,1083,24,25,27,291,292,293,880,1173,1207,1261,1263,1264,1265,1266,1267,1268,1301,1307,1368,774,1129,75,82,88,909,1192,1285,1515,916,1317,815,1386,1846,1858,1846,1858,43,357,358,449,1133,1134,1135,1136,1163,1164,1165,984,1308,1424,1133,1134,1135,1136,1153,73,212,467,468,473,474,695,701,716,797,804,805,827,828,829,857,894,963,965,1029,1031,1054,1072,1109,1111,1166,1174,1504,73,693,899,900,901,902,1029,1031,1038,1040,1041,1042,1054,1504,1505,1031,693,73,73,1149,35,857,1029,1038,899,900,902,1391,900,901,902,1140,1029,1095,374,375,376,1123,374,375,376,377,378,379,374,375,376,377,378,379,569,377,378,379,1466,204,1081,466,466,467,468,466,467,468,875,58,798,1857,1857,30,31,37,81,82,1519,1520,1523,1524,81,82,83,89,124,1640,796,977,37,1231,1145,1817,1851,575,632,1863,105,5,90,91,98,160,1061,64,575,1847,1847,1393,1393,794,800,804,805,806,807,808,809,810,811,812,813,814,815,816,817,835,472,473,474,657,1163,1164,1165,1166,472,473,474,472,473,474,1150,1166,1163,1164,1165,1166,798,1049,761,780,1687,1453,1687,459,1343,156,157,158,159,160,161,168,1016,1017,1018,1019,1020,1021,1022,1023,1289,1356,1403,1413,1414,1415,1416,1417,1419,1425,1430,1431,1432,1435,1436,1460,1461,1468,1485,1486,1487,1489,1490,1491,1493,1494,1499,1500,1501,1502,1503,1504,1505,1510,1511,1512,1513,1514,1515,1516,1524,1528,1529,1533,1535,1550,1563,1564,1565,1566,1567,1692,1703,1716,1724,1760,1764,1772,1822,1841,1885,105,1566,81,1218,891,891,1452,1453,1862,1862,1371,1199,1316,1863,651,1154,1104,1353,1373,1127,781,833,839,840,841,1275,1321,771,1070,1107,1276,1277,1532,1145,834,1879,1879,1870,1870,803,803,505,972,13,106,107,108,112,113,114,115,116,350,351,370,401,648,649,1122,1407,163,165,544,638,1207,1210,773,773,1072,717,1147,1072,1880,1880,1464,1464,1414,1432,1247,1253,1541,834,1117,27,227,583,1473,931,932,931,932,1866,820,821,822,834,836,880,294,295,296,822,546,1096,821,7,22,54,92,93,120,125,1313,7,85,86,92,93,120,125,306,315,316,317,318,319,320,318,319,320,1225,1227,1228,1230,1234,1235,1237,1239,1240,1241,1242,1249,611,1129,1154,232,233,46,223,1399,1225,1226,1227,1228,1434,1506,1508,1509,1369,1249,1122,1412,59,1028,890,891,892,1459,797,1012,1013,1099,1562,113,1097,1104,1176,856,895,910,663,645,89,1833,1867,1756,1344,156,985,1307,1365,1535,163,1237,1262,1264,1265,1266,1868,597,1869,1869,1869,208,208,279,280,281,547,621,6,187,195,783,1141,1503,1141,908,1450,1451,288,289,290,59,1028,34,34,34,166,167,1089,1414,1414,993,995,997,999,1001,1003,1005,1007,1009,1011,1013,1015,8,1174,1174,167,1144,14,998,999,1198,1238,1555,61,17,34,62,34,185,196,197,1321,196,197,197,196,1039,1045,1055,1055,351,356,1535,1536,1537,1082,1083,1082,1275,1147,1153,571,572,572,4,27,827,1139,1254,1255,866,985,986,987,988,989,991,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,987,985,986,990,1872,1872,786,786,181,182,270,271,272,66,955,47,54,56,57,98,99,100,101,168,383,385,969,1870,1871,1548,1874,1875,643,712,751,753,770,830,1403,1877,1115,230,1532,206,208,1596,1868,1868,1385,1386,1395,1416,1417,1418,1420,1871,1871,886,731,786,1405,1859,1205,1875,1875,23,24,25,27,227,842,844,961,1060,1120,1122,1254,1255,1258,1327,1337,1338,1339,1340,1341,1346,1348,1349,1350,1351,1352,1353,1354,1359,1360,1362,1363,1364,1368,1369,1371,1531,1533,1360,1337,1339,1340,1341,1349,1350,1351,1359,1360,1362,223,1399,910,1186,1438,1450,1458,1495,1496,1630,1186,1258,1046,1049,645,1330,83,22,86,1083,1574,1395,880,886,563,1074,1118,1119,1129,1132,1876,952,1487,1490,1494,1239,553,620,1239,553,1485,939,1548,1548,306,307,308,957,958,1426,1427,1141,911,912,913,914,915,916,918,921,922,952,975,915,1176,478,480,912,919,922,925,979,1642,1512,1642,159,1381,955,975,1423,485,486,911,912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,928,929,931,933,934,935,936,937,938,945,950,952,957,958,963,965,969,970,971,976,977,978,979,982,1389,1330,1413,1431,1529,849,914,922,984,1424,1526,1292,1293,1279,1643,1204,699,700,701,709,713,871,1064,1072,705,173,1287,1317,1318,651,1326,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1630,1631,1326,1637,1531,1877,134,1849,1864,390,102,401,925,1402,912,919,922,925,35,1085,636,657,701,722,827,859,68,1155,928,936,937,938,1217,866,1154,1077,1062,916,1365,736,945,695,831,1874,1874,352,353,354,110,621,763,1876,1876,1876,1873,1873,1865,955,884,645,598,598,1878,1878,357,358,359,1249,1879,627,992,993,1283,386,1016,1017,1018,1019,1020,1021,1022,1023,1025,1026,1027,1030,1147,1474,757,1147,757,1485,1046,1049,1550,136,137,183,203,508,510,513,514,517,518,522,523,524,525,526,527,528,529,530,531,532,533,535,538,540,543,546,594,996,997,1554,1638,1237,1568,1569,1570,1579,1049,1301,651,1124,1883,1892,1591,1596,1600,1589,1587,1588,1601,1592,1595,1593,1597,1881,1646,931,932,115,116,982,1882,1882,1882,44,632,343,344,1283,1726,1881,1881,1098,23,857,1051,1052,1053,1054,1884,44,1518,142,229,67,386,387,388,398,399,400,388,57,896,1435,1435,1092,916,1398,1164,1165,1448,66,39,44,79,80,259,260,578,1050,1587,1588,1589,1591,1592,1593,1595,1596,1597,1600,1601,1107,44,1096,1718,1726,1646,1726,1880,1884,1885,1892,1518,1529,1036,1187,1332,1332,569,42,231,234,246,248,250,252,255,77,95,61,62,100,177,191,194,196,206,261,273,1272,1274,1317,1438,1439,1445,1446,1450,1458,1495,1496,1583,1630,1640,346,1438,1035,1439,1445,1563,53,79,80,92,93,96,97,99,100,125,261,9,1287,1317,1287,1317,1438,1450,1452,1453,1458,1495,898,1356,1406,1886,1886,1883,1885,1892,846,1885,1892,1426,698,544,545,546,546,935,1886,1887,1887,1887,1887,183,1597,1601,827,899,900,1064,1371,1371,132,14,15,17,18,20,21,121,130,131,132,133,134,135,136,137,143,144,145,146,147,148,150,155,509,511,513,514,515,517,518,690,1193,386,387,388,610,1404,1888,1894,161,844,1406,1396,1888,1253,1890,1126,736,692,701,702,704,705,706,707,708,709,712,731,735,736,737,738,740,741,742,743,744,745,746,752,782,1073,770,469,470,471,911,912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,928,929,930,931,932,933,934,935,936,937,938,939,942,946,947,956,963,965,966,968,969,970,971,972,973,976,977,978,979,980,981,982,1429,360,361,362,157,1890,1890,580,861,1510,1698,1698,1584,958,1446,1452,1490,1491,1494,1499,51,942,1152,1253,1508,1353,183,595,116,1124,1125,1212,1243,1245,1247,1249,1250,1251,1252,1253,1253,1893,688,1893,1893,899,900,1381,195,1077,377,378,379,1889,199,1120,1218,233,1477,1891,1892,233,1477,681,684,1285,424,426,428,1541,854,1094,1055,1195,1196,1197,1198,1199,1200,1203,61,62,62,1049,1300,1535,1536,1300,1584,1894,173,181,26,760,912,99,950,988,1726,1905,408,409,410,424,426,408,398,399,400,408,409,410,411,412,413,442,443,553,1433,864,1169,1895,449,1123,1021,1023,858,904,1504,956,960,1425,1426,1523,1524,1189,588,1385,1330,1330,1520,225,226,987,160,470,471,473,474,493,494,495,584,832,833,837,894,963,964,1061,1062,1120,1387,1396,1414,1420,1432,1482,716,169,1062,1197,1525,1062,1198,169,1639,1640,66,1525,1256,1017,1019,1021,1036,1446,1385,1416,1417,1418,1420,75,842,1120,1342,1343,1345,1347,1531,1186,352,353,354,450,451,452,99,124,73,854,857,896,897,899,900,901,902,903,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1028,1029,1030,1031,1036,1037,1038,1039,1040,1041,1042,1043,1044,1045,1046,1047,1048,1049,1050,1051,1052,1053,1054,1055,1056,1057,1058,1061,1062,679,848,357,358,359,360,361,362,885,1193,1202,601,761,704,7,125,478,479,480,1354,478,479,480,478,479,480,76,115,309,310,311,1150,142,687,1905,1443,1444,1445,1714,1714,652,653,653,87,703,753,907,955,1463,429,430,431,432,433,434,435,436,437,438,439,440,943,944,1415,1035,52,91,100,804,1049,1046,831,831,47,21,47,18,21,19,80,154,189,190,191,193,194,242,249,250,423,424,425,426,427,428,612,659,687,800,1033,1040,1041,1042,1190,1268,1355,1522,1523,1535,1610,1619,1621,1623,1625,1634,1640,1642,68,81,30,152,84,225,848,769,135,1506,1507,1124,26,564,571,588,611,621,727,743,1138,691,1085,161,709,1048,1075,1076,1119,1381,714,823,824,825,830,639,370,383,385,1284,11,25,11,25,11,1085,1086,1085,1084,1086,1087,461,462,852,1056,1057,1058,1114,1156,1157,1353,347,348,863,960,1425,1212,1507,633,581,208,1035,1072,395,380,382,1123,1393,1,2,3,5,7,12,13,14,15,20,21,22,24,25,27,30,31,32,37,45,57,58,59,60,68,73,75,77,81,87,90,98,102,105,106,107,119,120,121,122,131,132,171,185,218,349,355,356,360,361,362,423,424,425,426,427,428,450,451,452,515,516,517,518,711,781,798,824,833,839,848,857,871,897,1031,1039,1043,1044,1045,1053,1203,1226,1251,1261,1270,1284,1287,1291,1295,1296,1297,1298,1300,1333,1334,1424,1536,1632,1453,40,822,1058,164,380,381,382,1123,564,233,234,239,244,245,247,249,251,253,255,257,258,260,263,266,269,270,272,275,278,281,284,287,290,293,296,299,302,305,308,311,314,317,320,323,326,329,332,335,338,341,344,348,351,354,356,359,360,362,363,366,367,372,376,379,382,385,388,391,394,397,400,404,407,410,412,416,419,421,427,428,433,434,439,440,443,445,447,455,458,465,468,471,474,477,480,483,486,489,492,495,498,501,504,508,509,511,512,514,515,516,518,519,520,521,522,523,529,530,531,532,533,539,540,541,542,543,548,1166,1167,1178,1179,1180,1182,1185,1192,1417,1510,1167,1180,1182,1185,234,239,244,245,247,249,251,253,255,257,260,263,266,269,270,272,275,278,281,284,287,290,293,296,299,302,305,308,311,314,317,320,323,326,329,332,335,338,341,344,348,351,354,359,362,363,366,367,372,376,379,382,385,388,391,394,397,400,404,407,410,416,419,427,433,439,443,447,450,452,455,458,465,468,471,474,477,480,483,486,489,492,495,498,501,504,508,509,511,512,514,515,516,518,520,521,522,523,529,530,531,532,533,539,540,541,543,548,1161,1170,1417,1510,1417,102,82,699,700,866,1338,559,71,591,595,598,66,1585,163,165,1454,1455,1456,1457,1458,1563,1571,1572,1573,1575,1577,1578,1582,1584,98,872,960,1308,1600,288,289,290,300,301,302,306,309,310,311,312,313,314,346,347,348,1190,863,160,212,441,442,443,478,479,480,845,846,847,848,849,1083,1218,1312,671,683,78,229,258,229,421,422,889,891,1459,1372,142,16,81,1523,1524,772,773,1080,307,308,1341,1349,490,491,492,490,491,492,490,491,492,490,491,492,987,987,209,1301,1302,1303,1304,1307,209,1301,1302,1303,1304,1307,122,1655,1896,848,264,1377,1513,1538,1539,1124,4,1897,371,372,1056,1057,1058,1064,1080,1202,67,83,1905,963,966,967,794,1464,1146,101,87,101,202,1898,203,1073,1073,146,244,625,657,693,694,749,960,1020,1033,1269,1426,1533,1604,1613,1898,1898,1280,1287,836,35,196,1536,1537,1580,1594,1464,1118,502,503,504,887,931,186,195,208,1035,230,231,232,233,697,1118,1899,799,23,23,867,166,1901,1901,26,1055,1821,579,503,504,1552,166,1902,1902,1902,36,36,1901,233,570,583,590,592,647,656,664,680,844,1346,1354,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,398,399,400,1254,1255,1369,1368,1174,1902,56,168,1594,1595,1590,1598,1591,1592,1601,1585,1587,1601,1588,1600,1596,1593,1589,1599,1586,1586,1597,1288,1302,930
+};
+
+std::span<const EmojiSearchToken> StaticEmojiDatabase::searchTokens() { return SEARCH_TOKENS; }
+
+std::span<const uint16_t> StaticEmojiDatabase::searchPostings() { return SEARCH_POSTINGS; }
\ No newline at end of file
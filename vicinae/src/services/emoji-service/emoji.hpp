@@ -1,5 +1,7 @@
 #pragma once
+#include <cstdint>
 #include <vector>
+#include <span>
 #include <string_view>
 #include <array>
 #include <unordered_map>
@@ -12,10 +14,40 @@ struct EmojiData {
   bool skinToneSupport = false;
 };
 
+/**
+ * Entry of the precomputed keyword search index. `token` is a keyword normalized with `TextTokenizer`,
+ * matching the emojis whose index in `orderedList` are stored in
+ * `searchPostings()[postingOffset, postingOffset + postingCount)`.
+ */
+struct EmojiSearchToken {
+  std::string_view token;
+  uint32_t postingOffset;
+  uint32_t postingCount;
+};
+
+/**
+ * Emojis of a group, which are contiguous in `orderedList`.
+ */
+struct EmojiGroup {
+  std::string_view name;
+  uint32_t offset;
+  uint32_t count;
+
+  std::span<const EmojiData> emojis() const;
+};
+
 class StaticEmojiDatabase {
 public:
   StaticEmojiDatabase() = delete;
   static const std::array<EmojiData, 1906> &orderedList();
   static const std::unordered_map<std::string_view, const EmojiData *> &mapping();
   static const std::array<std::string_view, 9> &groups();
+  // groups in order, as they are listed before any search
+  static std::span<const EmojiGroup> groupedList();
+
+  /**
+   * Search tokens, sorted by their UTF-8 representation.
+   */
+  static std::span<const EmojiSearchToken> searchTokens();
+  static std::span<const uint16_t> searchPostings();
 };
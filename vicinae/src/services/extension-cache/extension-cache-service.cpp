@@ -0,0 +1,237 @@
+#include "extension-cache-service.hpp"
+#include <QSaveFile>
+#include <arpa/inet.h>
+#include <cstring>
+#include <qlogging.h>
+
+namespace {
+
+uint32_t readSize(const char *data) {
+  uint32_t size;
+
+  std::memcpy(&size, data, sizeof(size));
+
+  return ntohl(size);
+}
+
+void writeSize(char *data, uint32_t size) {
+  size = htonl(size);
+  std::memcpy(data, &size, sizeof(size));
+}
+
+} // namespace
+
+ExtensionCacheService::Log *ExtensionCacheService::open(const std::filesystem::path &path) {
+  if (auto it = m_logs.find(path.string()); it != m_logs.end()) return it->second.get();
+
+  std::error_code ec;
+  auto log = std::make_unique<Log>();
+
+  std::filesystem::create_directories(path.parent_path(), ec);
+  log->file.setFileName(path.c_str());
+
+  if (!replay(*log)) return nullptr;
+
+  if (!log->file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+    qWarning() << "Failed to open extension cache" << path.c_str() << log->file.errorString();
+    return nullptr;
+  }
+
+  return m_logs.emplace(path.string(), std::move(log)).first->second.get();
+}
+
+bool ExtensionCacheService::replay(Log &log) {
+  QFile reader(log.file.fileName());
+
+  if (!reader.exists()) return true;
+
+  if (!reader.open(QIODevice::ReadOnly)) {
+    qWarning() << "Failed to read extension cache" << reader.fileName() << reader.errorString();
+    return false;
+  }
+
+  QByteArray records = reader.readAll();
+  size_t size = records.size();
+  size_t offset = 0;
+
+  while (offset + RECORD_HEADER_SIZE <= size) {
+    const char *record = records.constData() + offset;
+    uint32_t keySize = readSize(record + 1);
+    uint32_t dataSize = readSize(record + 5);
+    size_t end = offset + RECORD_HEADER_SIZE + keySize + dataSize;
+
+    if (end > size) break;
+
+    std::string key(record + RECORD_HEADER_SIZE, keySize);
+    auto op = static_cast<Op>(record[0]);
+
+    if (op == Op::Set) {
+      put(log, key, offset, dataSize);
+    } else if (op == Op::Remove) {
+      if (auto it = log.entries.find(key); it != log.entries.end()) { drop(log, it); }
+    } else if (op == Op::Clear) {
+      log.entries.clear();
+      log.uses.clear();
+      log.liveSize = 0;
+    } else {
+      break;
+    }
+
+    offset = end;
+  }
+
+  // what follows the last complete record was cut short by a crash, or is not something we wrote
+  if (offset != size) {
+    qWarning() << "Discarding the last" << size - offset << "bytes of extension cache" << reader.fileName();
+    reader.close();
+    QFile::resize(log.file.fileName(), offset);
+  }
+
+  return true;
+}
+
+std::optional<uint64_t> ExtensionCacheService::append(Log &log, Op op, const std::string &key,
+                                                      const std::string &data) {
+  QByteArray record(RECORD_HEADER_SIZE + key.size() + data.size(), Qt::Uninitialized);
+  uint64_t offset = log.file.size();
+
+  record[0] = static_cast<char>(op);
+  writeSize(record.data() + 1, key.size());
+  writeSize(record.data() + 5, data.size());
+  std::memcpy(record.data() + RECORD_HEADER_SIZE, key.data(), key.size());
+  std::memcpy(record.data() + RECORD_HEADER_SIZE + key.size(), data.data(), data.size());
+
+  // workers read the log on their own, records have to reach it whole
+  if (log.file.write(record) != record.size() || !log.file.flush()) {
+    qWarning() << "Failed to write to extension cache" << log.file.fileName() << log.file.errorString();
+    return std::nullopt;
+  }
+
+  return offset;
+}
+
+void ExtensionCacheService::put(Log &log, const std::string &key, uint64_t offset, uint32_t dataSize) {
+  if (auto it = log.entries.find(key); it != log.entries.end()) { drop(log, it); }
+
+  log.uses.push_back(key);
+  log.entries.insert({key, Entry{.offset = offset, .dataSize = dataSize, .use = std::prev(log.uses.end())}});
+  log.liveSize += key.size() + dataSize;
+}
+
+void ExtensionCacheService::drop(Log &log, std::unordered_map<std::string, Entry>::iterator it) {
+  log.liveSize -= it->first.size() + it->second.dataSize;
+  log.uses.erase(it->second.use);
+  log.entries.erase(it);
+}
+
+bool ExtensionCacheService::compact(Log &log) {
+  QFile reader(log.file.fileName());
+
+  if (!reader.open(QIODevice::ReadOnly)) return false;
+
+  QByteArray records = reader.readAll();
+  QByteArray live;
+  std::vector<uint64_t> offsets;
+
+  live.reserve(log.liveSize + log.entries.size() * RECORD_HEADER_SIZE);
+  offsets.reserve(log.entries.size());
+
+  // in order of use, which replaying the log restores
+  for (const auto &key : log.uses) {
+    const auto &entry = log.entries.at(key);
+    size_t recordSize = RECORD_HEADER_SIZE + key.size() + entry.dataSize;
+
+    if (entry.offset + recordSize > static_cast<size_t>(records.size())) return false;
+
+    offsets.emplace_back(live.size());
+    live.append(records.constData() + entry.offset, recordSize);
+  }
+
+  QSaveFile out(log.file.fileName());
+
+  if (!out.open(QIODevice::WriteOnly) || out.write(live) != live.size() || !out.commit()) {
+    qWarning() << "Failed to compact extension cache" << log.file.fileName() << out.errorString();
+    return false;
+  }
+
+  size_t n = 0;
+
+  for (const auto &key : log.uses) {
+    log.entries.at(key).offset = offsets[n++];
+  }
+
+  // the log was replaced, appending has to go to the new one
+  log.file.close();
+
+  return log.file.open(QIODevice::WriteOnly | QIODevice::Append);
+}
+
+void ExtensionCacheService::compactIfNeeded(Log &log) {
+  size_t size = log.file.size();
+  size_t liveRecordsSize = log.liveSize + log.entries.size() * RECORD_HEADER_SIZE;
+
+  if (size < MIN_COMPACTION_SIZE || size < 2 * liveRecordsSize) return;
+
+  compact(log);
+}
+
+bool ExtensionCacheService::set(const std::filesystem::path &path, const std::string &key,
+                                const std::string &data, size_t capacity,
+                                std::span<const std::string> touched) {
+  auto log = open(path);
+
+  if (!log) return false;
+
+  for (const auto &used : touched) {
+    if (auto it = log->entries.find(used); it != log->entries.end()) {
+      log->uses.splice(log->uses.end(), log->uses, it->second.use);
+    }
+  }
+
+  auto offset = append(*log, Op::Set, key, data);
+
+  if (!offset) return false;
+
+  put(*log, key, *offset, data.size());
+
+  // the entry just written is kept even if it does not fit on its own
+  while (log->liveSize > capacity && log->uses.front() != key) {
+    auto victim = log->uses.front();
+
+    if (!append(*log, Op::Remove, victim)) break;
+
+    drop(*log, log->entries.find(victim));
+  }
+
+  compactIfNeeded(*log);
+
+  return true;
+}
+
+bool ExtensionCacheService::remove(const std::filesystem::path &path, const std::string &key) {
+  auto log = open(path);
+
+  if (!log) return false;
+
+  auto it = log->entries.find(key);
+
+  if (it == log->entries.end() || !append(*log, Op::Remove, key)) return false;
+
+  drop(*log, it);
+  compactIfNeeded(*log);
+
+  return true;
+}
+
+bool ExtensionCacheService::clear(const std::filesystem::path &path) {
+  auto log = open(path);
+
+  if (!log || !append(*log, Op::Clear, {})) return false;
+
+  log->entries.clear();
+  log->uses.clear();
+  log->liveSize = 0;
+  compactIfNeeded(*log);
+
+  return true;
+}
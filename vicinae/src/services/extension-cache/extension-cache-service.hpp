@@ -0,0 +1,73 @@
+#pragma once
+#include <QFile>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Storage of the `Cache` of the extension API, which survives the workers commands run in.
+ *
+ * Every namespace of an extension is an append-only log of the writes made to it, which workers read once
+ * as a whole to serve reads on their own: only writes are sent to vicinae, which is the only writer of the
+ * logs. Records are, in big endian:
+ *
+ *   u8 op (see `Op`), u32 key size, u32 data size, key, data
+ *
+ * Namespaces are bounded by the capacity their writer asks for, the least recently used entries being
+ * evicted first, with the keys the writer read since its previous write counting as used. A log is
+ * rewritten with only the live entries once most of it is dead.
+ */
+class ExtensionCacheService {
+public:
+  enum class Op : uint8_t { Set = 1, Remove = 2, Clear = 3 };
+
+  static constexpr size_t RECORD_HEADER_SIZE = 9;
+
+  /**
+   * Write `data` at `key` of the namespace logged at `log`, evicting entries to stay within `capacity`.
+   */
+  bool set(const std::filesystem::path &log, const std::string &key, const std::string &data, size_t capacity,
+           std::span<const std::string> touched);
+  bool remove(const std::filesystem::path &log, const std::string &key);
+  bool clear(const std::filesystem::path &log);
+
+private:
+  // dead records are only compacted away past that size, rewriting small logs is not worth it
+  static constexpr size_t MIN_COMPACTION_SIZE = 256 * 1024;
+
+  struct Entry {
+    // of the record in the log
+    uint64_t offset = 0;
+    uint32_t dataSize = 0;
+    std::list<std::string>::iterator use;
+  };
+
+  struct Log {
+    QFile file;
+    std::unordered_map<std::string, Entry> entries;
+    // least recently used first
+    std::list<std::string> uses;
+    // keys and data of the live entries
+    size_t liveSize = 0;
+  };
+
+  std::unordered_map<std::string, std::unique_ptr<Log>> m_logs;
+
+  Log *open(const std::filesystem::path &path);
+  bool replay(Log &log);
+
+  /**
+   * Offset of the appended record.
+   */
+  std::optional<uint64_t> append(Log &log, Op op, const std::string &key, const std::string &data = {});
+  void put(Log &log, const std::string &key, uint64_t offset, uint32_t dataSize);
+  void drop(Log &log, std::unordered_map<std::string, Entry>::iterator it);
+  bool compact(Log &log);
+  void compactIfNeeded(Log &log);
+};
@@ -1,15 +1,18 @@
 #include "extension-registry.hpp"
 #include "common.hpp"
 #include "services/local-storage/local-storage-service.hpp"
+#include "startup-benchmark.hpp"
 #include "vicinae.hpp"
 #include <QJsonArray>
 #include "services/extension-registry/extension-registry.hpp"
 #include "utils/utils.hpp"
 #include "zip/unzip.hpp"
+#include <fcntl.h>
 #include <filesystem>
 #include <qfilesystemwatcher.h>
 #include <qjsonparseerror.h>
 #include <qlogging.h>
+#include <stdio.h>
 
 namespace fs = std::filesystem;
 
@@ -25,6 +28,8 @@ ExtensionRegistry::ExtensionRegistry(OmniCommandDatabase &commandDb, LocalStorag
 
 fs::path ExtensionRegistry::extensionDir() const { return Omnicast::dataDir() / "extensions"; }
 
+fs::path ExtensionRegistry::stagingDir() const { return Omnicast::dataDir() / "extension-staging"; }
+
 CommandArgument ExtensionRegistry::parseArgumentFromObject(const QJsonObject &obj) {
   CommandArgument arg;
   QString type = obj.value("type").toString();
@@ -56,7 +61,9 @@ CommandArgument ExtensionRegistry::parseArgumentFromObject(const QJsonObject &ob
 }
 
 bool ExtensionRegistry::installFromZip(const QString &id, std::string_view data) {
-  fs::path extractDir = extensionDir() / id.toStdString();
+  fs::path bundle = extensionDir() / id.toStdString();
+  fs::path staging = stagingDir() / id.toStdString();
+  std::error_code ec;
   Unzipper unzip(data);
 
   if (!unzip) {
@@ -64,9 +71,33 @@ bool ExtensionRegistry::installFromZip(const QString &id, std::string_view data)
     return false;
   }
 
-  unzip.extract(extractDir, {.stripComponents = 1});
+  // left over by an install that was interrupted
+  fs::remove_all(staging, ec);
+
+  if (!unzip.extract(staging, {.stripComponents = 1})) {
+    qCritical() << "Failed to extract extension" << id;
+    fs::remove_all(staging, ec);
+    return false;
+  }
+
+  fs::create_directories(extensionDir(), ec);
+
+  // the installed version ends up in the staging directory, and is removed from there
+  if (fs::exists(bundle)) {
+    if (renameat2(AT_FDCWD, staging.c_str(), AT_FDCWD, bundle.c_str(), RENAME_EXCHANGE) != 0) {
+      qCritical() << "Failed to swap in extension" << id << strerror(errno);
+      fs::remove_all(staging, ec);
+      return false;
+    }
+  } else if (fs::rename(staging, bundle, ec); ec) {
+    qCritical() << "Failed to move extension" << id << "in place" << ec.message().c_str();
+    fs::remove_all(staging, ec);
+    return false;
+  }
+
+  fs::remove_all(staging, ec);
   emit extensionAdded(id);
-  emit extensionsChanged();
+  requestScan();
 
   return true;
 }
@@ -80,7 +111,7 @@ bool ExtensionRegistry::uninstall(const QString &id) {
   m_storage.clearNamespace(id);
 
   emit extensionUninstalled(id);
-  emit extensionsChanged();
+  requestScan();
 
   return true;
 }
@@ -157,26 +188,80 @@ ExtensionManifest::Command ExtensionRegistry::parseCommandFromObject(const QJson
   return command;
 }
 
-std::vector<ExtensionManifest> ExtensionRegistry::scanAll() {
+ExtensionRegistry::ManifestChanges ExtensionRegistry::updateManifests() {
   std::error_code ec;
-  std::vector<ExtensionManifest> manifests;
+  ManifestChanges changes;
+  std::unordered_map<std::string, CachedManifest> manifests;
 
   for (const auto &entry : fs::directory_iterator(extensionDir(), ec)) {
     if (!entry.is_directory()) continue;
 
+    std::error_code timeError;
+    auto modifiedAt = fs::last_write_time(entry.path() / "package.json", timeError);
+    auto it = m_manifests.find(entry.path().native());
+    bool known = it != m_manifests.end();
+
+    if (!timeError && known && it->second.modifiedAt == modifiedAt) {
+      manifests.insert(m_manifests.extract(it));
+      continue;
+    }
+
     auto manifest = scanBundle(entry.path());
 
+    // a bundle that can no longer be loaded is reported as removed
     if (!manifest) {
       qCritical() << "Failed to load bundle at" << entry.path().c_str() << manifest.error().m_message;
       continue;
     }
 
-    manifests.emplace_back(manifest.value());
+    if (known) {
+      m_manifests.erase(it);
+      changes.updated.emplace_back(*manifest);
+    } else {
+      changes.added.emplace_back(*manifest);
+    }
+
+    manifests.emplace(entry.path().native(), CachedManifest{.modifiedAt = modifiedAt, .manifest = *manifest});
+  }
+
+  // what is left is no longer installed
+  for (const auto &[path, cached] : m_manifests) {
+    changes.removed.emplace_back(cached.manifest.id);
+  }
+
+  m_manifests = std::move(manifests);
+
+  return changes;
+}
+
+std::vector<ExtensionManifest> ExtensionRegistry::manifests() const {
+  std::vector<ExtensionManifest> manifests;
+
+  manifests.reserve(m_manifests.size());
+
+  for (const auto &[path, cached] : m_manifests) {
+    manifests.emplace_back(cached.manifest);
   }
 
   return manifests;
 }
 
+std::vector<ExtensionManifest> ExtensionRegistry::scanAll() {
+  StartupBenchmark::Scope benchmark("extension-scan");
+
+  updateManifests();
+
+  return manifests();
+}
+
+void ExtensionRegistry::requestScan() {
+  auto changes = updateManifests();
+
+  if (changes.empty()) return;
+
+  emit extensionsChanged(changes.added, changes.removed, changes.updated);
+}
+
 bool ExtensionRegistry::isInstalled(const QString &id) const {
   return fs::is_directory(extensionDir() / id.toStdString());
 }
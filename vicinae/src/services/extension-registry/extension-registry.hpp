@@ -9,6 +9,7 @@
 #include <qjsonobject.h>
 #include <qobject.h>
 #include <qtmetamacros.h>
+#include <unordered_map>
 #include <vector>
 #include <QString>
 
@@ -46,33 +47,78 @@ struct ExtensionManifest {
 class ExtensionRegistry : public QObject {
   Q_OBJECT
 
+  struct CachedManifest {
+    std::filesystem::file_time_type modifiedAt;
+    ExtensionManifest manifest;
+  };
+
+  struct ManifestChanges {
+    std::vector<ExtensionManifest> added;
+    std::vector<QString> removed;
+    std::vector<ExtensionManifest> updated;
+
+    bool empty() const { return added.empty() && removed.empty() && updated.empty(); }
+  };
+
   OmniCommandDatabase &m_db;
   LocalStorageService &m_storage;
   QFileSystemWatcher *m_watcher = new QFileSystemWatcher(this);
+  // manifests of the installed bundles as of the last scan, by bundle path
+  std::unordered_map<std::string, CachedManifest> m_manifests;
 
   CommandArgument parseArgumentFromObject(const QJsonObject &obj);
   Preference parsePreferenceFromObject(const QJsonObject &obj);
   ExtensionManifest::Command parseCommandFromObject(const QJsonObject &obj);
 
   std::filesystem::path extensionDir() const;
+  // where archives are extracted before being swapped in, out of the watched extension directory
+  std::filesystem::path stagingDir() const;
+
+  /**
+   * Bring the cached manifests in line with the extension directory. Only the bundles whose manifest was
+   * modified since the last scan are parsed again.
+   */
+  ManifestChanges updateManifests();
 
 public:
+  /**
+   * Install the extension `id` from the zip archive `data`, replacing the installed version if there is
+   * one. The archive is extracted next to the extension directory, which is then swapped with the installed
+   * one in a single rename: commands never see an extension that is partially extracted, and an archive that
+   * fails to be extracted leaves the installed version untouched.
+   */
   bool installFromZip(const QString &id, std::string_view data);
 
   std::expected<ExtensionManifest, ManifestError> scanBundle(const std::filesystem::path &path);
+
+  /**
+   * The manifests of all the installed extensions, through the manifest cache.
+   */
   std::vector<ExtensionManifest> scanAll();
+
+  /**
+   * The manifests of the installed extensions as of the last scan, without scanning.
+   */
+  std::vector<ExtensionManifest> manifests() const;
   void rescanBundle();
   bool isInstalled(const QString &id) const;
   bool uninstall(const QString &id);
 
   ExtensionRegistry(OmniCommandDatabase &commandDb, LocalStorageService &storage);
 
-  void requestScan() { emit extensionsChanged(); }
+  /**
+   * Scan the extension directory, and emit `extensionsChanged` if anything changed since the last scan.
+   */
+  void requestScan();
 
 signals:
   void extensionAdded(const QString &id);
   void extensionUninstalled(const QString &id);
 
-  // used to notify subscribers that they should rescan
-  void extensionsChanged() const;
+  /**
+   * What changed in the extension directory since the last scan. Extensions are removed by id, and the
+   * manifest of an updated extension is the one it has now.
+   */
+  void extensionsChanged(const std::vector<ExtensionManifest> &added, const std::vector<QString> &removed,
+                         const std::vector<ExtensionManifest> &updated) const;
 };
@@ -1,8 +1,12 @@
 #pragma once
+#include <chrono>
 #include <filesystem>
+#include <optional>
+#include <qdatetime.h>
 #include <qfuture.h>
 #include <qobject.h>
 #include <qtmetamacros.h>
+#include <string>
 #include <vector>
 
 /**
@@ -33,6 +37,40 @@ signals:
   void finished(const std::vector<IndexerFileResult> &results) const;
 };
 
+/**
+ * Snapshot of what the indexer is currently doing, meant to be used to tune it and to tell whether it is
+ * limited by the filesystem (walk rate) or by the database (write latency, backpressure).
+ */
+struct IndexerStats {
+  struct Entrypoint {
+    enum class State { Idle, Queued, Scanning };
+
+    std::filesystem::path root;
+    State state = State::Idle;
+    // entries walked by the scan in progress
+    size_t walkedFileCount = 0;
+    // entries walked by the last finished full scan, to estimate how far along the current one is
+    std::optional<size_t> expectedFileCount;
+    std::optional<QDateTime> lastScannedAt;
+  };
+
+  // walk rate of the scan in progress, or of the last scan if none is
+  double filesPerSecond = 0;
+  // since startup
+  size_t walkedFileCount = 0;
+  size_t queuedBatchCount = 0;
+  size_t writtenBatchCount = 0;
+  std::chrono::microseconds lastBatchWriteTime{0};
+  std::chrono::microseconds averageBatchWriteTime{0};
+  std::chrono::microseconds maxBatchWriteTime{0};
+  // time walkers spent waiting for the writer to catch up
+  std::chrono::milliseconds backpressureWaitTime{0};
+  // including the write ahead log
+  size_t databaseSize = 0;
+  std::optional<size_t> ftsSegmentCount;
+  std::vector<Entrypoint> entrypoints;
+};
+
 struct Pagination {
   int offset = 0;
   int limit = 50;
@@ -45,18 +83,58 @@ public:
    */
   struct Entrypoint {
     std::filesystem::path root;
+    // index the text content of the files below `root` as well, not only their names
+    bool indexContent = false;
   };
 
   struct QueryParams {
     Pagination pagination;
+    /**
+     * Stop collecting results once this much time has elapsed since the query was submitted,
+     * returning the ones gathered so far. Combined with a small pagination limit, this allows
+     * to get a fast first page and to request the next ones later.
+     */
+    std::optional<std::chrono::milliseconds> timeout;
+    /**
+     * Queries only cancel the pending ones of the same consumer, so that one searching as the user types
+     * does not cancel another one shown at the same time.
+     */
+    std::string consumer;
   };
 
 public:
   virtual void start() = 0;
   virtual void rebuildIndex() = 0;
   virtual void setEntrypoints(const std::vector<Entrypoint> &entrypoints) = 0;
+  virtual IndexerStats stats() const = 0;
+  /**
+   * Release the memory held by the database connections of the indexer, which fills up again as they are
+   * used.
+   */
+  virtual void shrinkMemory() {}
+  /**
+   * Record that the user opened `path` from the search results, so that frequently and recently opened
+   * files rank higher.
+   */
+  virtual void recordFileOpen(const std::filesystem::path &path) = 0;
+  /**
+   * Queries are coalesced: submitting a new query cancels the pending ones of the same consumer (see
+   * `QueryParams::consumer`), whose futures end up canceled without results.
+   */
   virtual QFuture<std::vector<IndexerFileResult>> queryAsync(std::string_view view,
                                                              const QueryParams &params = {}) const = 0;
 
+  /**
+   * Same as `queryAsync`, except that results are reported in chunks as they are collected: every result of
+   * the future is a chunk, in rank order, the first one coming as soon as the first few files are found.
+   * The future always has at least one (possibly empty) chunk once it is finished without being canceled.
+   *
+   * Indexers that cannot report partial results report all of them in a single chunk.
+   */
+  virtual QFuture<std::vector<IndexerFileResult>> queryStreamAsync(std::string_view view,
+                                                                   const QueryParams &params = {}) const {
+    return queryAsync(view, params);
+  }
+
   virtual ~AbstractFileIndexer() = default;
 };
@@ -0,0 +1,129 @@
+#include "content-extractor.hpp"
+#include <algorithm>
+#include <fcntl.h>
+#include <qstringconverter.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_set>
+
+namespace fs = std::filesystem;
+
+// clang-format off
+static const std::unordered_set<std::string> TEXT_EXTENSIONS = {
+	// plain text and markup
+	".txt", ".text", ".md", ".markdown", ".rst", ".org", ".adoc", ".tex", ".csv", ".tsv", ".log",
+
+	// configuration
+	".json", ".yaml", ".yml", ".toml", ".ini", ".conf", ".cfg", ".xml", ".nix",
+
+	// source code
+	".c", ".h", ".cc", ".cpp", ".cxx", ".hh", ".hpp", ".hxx", ".rs", ".go", ".py", ".rb", ".js", ".jsx",
+	".ts", ".tsx", ".java", ".kt", ".swift", ".cs", ".php", ".pl", ".lua", ".zig", ".hs", ".ml", ".ex",
+	".exs", ".el", ".clj", ".scala", ".dart", ".r", ".jl", ".sql", ".sh", ".bash", ".zsh", ".fish",
+	".html", ".htm", ".css", ".scss", ".vue", ".svelte", ".cmake",
+};
+
+// extensionless files that are text more often than not
+static const std::unordered_set<std::string> TEXT_FILENAMES = {
+	"README", "LICENSE", "COPYING", "AUTHORS", "CHANGELOG", "TODO", "Makefile", "Dockerfile",
+};
+// clang-format on
+
+bool ContentExtractor::isCandidate(const fs::path &path) {
+  std::string extension = path.extension().string();
+
+  if (extension.empty()) return TEXT_FILENAMES.contains(path.filename().string());
+
+  std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+  return TEXT_EXTENSIONS.contains(extension);
+}
+
+QString ContentExtractor::decode(std::string_view data) {
+  QByteArrayView bytes(data.data(), data.size());
+  auto encoding = QStringConverter::encodingForData(bytes);
+
+  // UTF-16 has NUL bytes for every ASCII character, it can only be told apart from binary by its BOM
+  if (encoding && *encoding != QStringConverter::Utf8) {
+    QStringDecoder decoder(*encoding);
+    return decoder(bytes);
+  }
+
+  auto sniffed = data.substr(0, BINARY_SNIFF_SIZE);
+
+  if (sniffed.find('\0') != std::string_view::npos) return {};
+
+  QStringDecoder utf8(QStringConverter::Utf8, QStringConverter::Flag::Stateless);
+  QString text = utf8(bytes);
+
+  if (!utf8.hasError()) return text;
+
+  // Latin-1 decodes anything, and is what legacy text files are most likely to be in
+  QStringDecoder latin1(QStringConverter::Latin1);
+
+  return latin1(bytes);
+}
+
+std::vector<QString> ContentExtractor::splitChunks(QStringView text) {
+  std::vector<QString> chunks;
+
+  while (!text.isEmpty()) {
+    qsizetype size = text.size();
+
+    if (size > CHUNK_SIZE) {
+      // the last line break of the chunk, or else its last space, or else a hard cut
+      QStringView window = text.first(CHUNK_SIZE);
+      qsizetype cut = window.lastIndexOf('\n');
+
+      if (cut <= 0) cut = window.lastIndexOf(' ');
+      size = cut > 0 ? cut + 1 : CHUNK_SIZE;
+
+      // never split a surrogate pair
+      if (text.at(size - 1).isHighSurrogate()) --size;
+    }
+
+    QStringView chunk = text.first(size).trimmed();
+
+    if (!chunk.isEmpty()) chunks.emplace_back(chunk.toString());
+    text = text.sliced(size);
+  }
+
+  return chunks;
+}
+
+std::optional<ContentExtractor::Content> ContentExtractor::extract(const fs::path &path) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | O_NOFOLLOW);
+
+  if (fd == -1) return std::nullopt;
+
+  struct stat st;
+
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return std::nullopt;
+  }
+
+  Content content{.lastModifiedAt = st.st_mtim.tv_sec};
+  size_t size = st.st_size;
+
+  if (!S_ISREG(st.st_mode) || size == 0 || size > MAX_FILE_SIZE) {
+    close(fd);
+    return content;
+  }
+
+  // files are small and read right away, most editors replace them rather than truncating them in place
+  void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  close(fd);
+
+  if (data == MAP_FAILED) return std::nullopt;
+
+  // the file is read once from start to end
+  madvise(data, size, MADV_SEQUENTIAL);
+  content.chunks = splitChunks(decode({static_cast<const char *>(data), size}));
+  munmap(data, size);
+
+  return content;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <qstring.h>
+#include <string_view>
+#include <vector>
+
+/**
+ * Reads the text content of files for the content index, see `ContentIndexer`.
+ *
+ * Only plain text, markdown and source code files are read, as told by their name, up to `MAX_FILE_SIZE`.
+ * Files are memory mapped rather than copied into a buffer. Their encoding is told by their byte order mark,
+ * if any, or else they are decoded as UTF-8, falling back to Latin-1 when they are not valid UTF-8. Files
+ * with NUL bytes in their first `BINARY_SNIFF_SIZE` bytes are binary, and have no text content.
+ *
+ * Text is split into chunks of at most `CHUNK_SIZE` characters, at line breaks when possible, so that a match
+ * is ranked by the part of a file it is in rather than by the whole file.
+ */
+class ContentExtractor {
+public:
+  static constexpr size_t MAX_FILE_SIZE = 1024 * 1024;
+  static constexpr size_t BINARY_SNIFF_SIZE = 4096;
+  static constexpr qsizetype CHUNK_SIZE = 4096;
+
+  struct Content {
+    // modification time of the file when it was read, in seconds, as the file index stores it
+    int64_t lastModifiedAt = 0;
+    // empty if the file has no text content
+    std::vector<QString> chunks;
+  };
+
+  static bool isCandidate(const std::filesystem::path &path);
+
+  /**
+   * Nothing is returned if the file could not be read. Files that are too large, binary or not regular files
+   * have no chunks.
+   */
+  static std::optional<Content> extract(const std::filesystem::path &path);
+
+  static std::vector<QString> splitChunks(QStringView text);
+
+private:
+  // empty if the data is binary
+  static QString decode(std::string_view data);
+};
@@ -0,0 +1,173 @@
+#include "content-indexer.hpp"
+#include "services/files-service/file-indexer/content-extractor.hpp"
+#include "services/files-service/file-indexer/indexer-scanner.hpp"
+#include "trace/trace.hpp"
+#include <algorithm>
+#include <qlogging.h>
+#include <ranges>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+static bool isBelow(const fs::path &path, const fs::path &root) {
+  const std::string &p = path.native();
+  const std::string &r = root.native();
+
+  if (!p.starts_with(r)) return false;
+
+  return p.size() == r.size() || r.ends_with('/') || p[r.size()] == '/';
+}
+
+void ContentIndexer::setRoots(std::vector<fs::path> roots) {
+  std::lock_guard lock(m_mutex);
+  m_roots = std::move(roots);
+}
+
+void ContentIndexer::setThreadCount(size_t count) { m_threadCount = std::max<size_t>(1, count); }
+
+bool ContentIndexer::isBelowRoot(const fs::path &path) const {
+  return std::ranges::any_of(m_roots, [&](const fs::path &root) { return isBelow(path, root); });
+}
+
+std::vector<fs::path> ContentIndexer::treesToRefresh(const fs::path &path) const {
+  std::lock_guard lock(m_mutex);
+
+  if (isBelowRoot(path)) return {path};
+
+  return m_roots | std::views::filter([&](const fs::path &root) { return isBelow(root, path); }) |
+         std::ranges::to<std::vector>();
+}
+
+void ContentIndexer::refreshTree(const fs::path &path) { enqueue({.tree = path}); }
+
+void ContentIndexer::refreshFiles(const std::vector<FileSystemEntry> &entries) {
+  Request request;
+
+  {
+    std::lock_guard lock(m_mutex);
+
+    if (m_roots.empty()) return;
+
+    for (const auto &entry : entries) {
+      if (entry.isDirectory || !ContentExtractor::isCandidate(entry.path) || !isBelowRoot(entry.path)) {
+        continue;
+      }
+
+      request.files.emplace_back(entry.path);
+    }
+  }
+
+  if (!request.files.empty()) enqueue(std::move(request));
+}
+
+void ContentIndexer::enqueue(Request request) {
+  {
+    std::lock_guard lock(m_mutex);
+    m_requests.emplace_back(std::move(request));
+  }
+
+  m_cv.notify_one();
+}
+
+bool ContentIndexer::waitWhilePaused() {
+  std::unique_lock lock(m_mutex);
+
+  while (m_alive && m_scheduler.shouldPause()) {
+    m_cv.wait_for(lock, PAUSE_POLL_INTERVAL);
+  }
+
+  return m_alive;
+}
+
+void ContentIndexer::extract(const std::vector<fs::path> &paths) {
+  TraceScope trace("indexer", "extract contents");
+  std::vector<std::optional<ContentExtractor::Content>> contents(paths.size());
+  std::vector<std::thread> workers;
+  std::atomic<size_t> next = 0;
+  size_t threadCount = std::min<size_t>(m_threadCount, paths.size());
+
+  // workers inherit the scheduling classes of this thread
+  for (size_t i = 0; i != threadCount; ++i) {
+    workers.emplace_back([&]() {
+      for (size_t n = next++; n < paths.size(); n = next++) {
+        contents[n] = ContentExtractor::extract(paths[n]);
+      }
+    });
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  std::vector<FileIndexerDatabase::FileContent> batch;
+
+  batch.reserve(paths.size());
+
+  // files that could not be read are tried again with the next refresh
+  for (size_t i = 0; i != paths.size(); ++i) {
+    if (!contents[i]) continue;
+
+    batch.emplace_back(FileIndexerDatabase::FileContent{.path = paths[i],
+                                                        .lastModifiedAt = contents[i]->lastModifiedAt,
+                                                        .chunks = std::move(contents[i]->chunks)});
+  }
+
+  m_scanner.enqueueContents(std::move(batch));
+}
+
+void ContentIndexer::process(const Request &request) {
+  std::vector<fs::path> paths = request.files;
+
+  if (request.tree) {
+    paths = m_db->listStaleContentFiles(*request.tree, ContentExtractor::isCandidate);
+
+    std::lock_guard lock(m_mutex);
+    // the tree may be larger than the roots below it
+    std::erase_if(paths, [&](const fs::path &path) { return !isBelowRoot(path); });
+  }
+
+  if (request.tree && !paths.empty()) {
+    qInfo() << "Indexing the content of" << paths.size() << "files below" << request.tree->c_str();
+  }
+
+  for (size_t i = 0; i < paths.size(); i += BATCH_SIZE) {
+    if (!waitWhilePaused()) return;
+
+    auto end = paths.begin() + std::min(i + BATCH_SIZE, paths.size());
+
+    extract(std::vector<fs::path>(paths.begin() + i, end));
+  }
+}
+
+void ContentIndexer::run() {
+  m_db = std::make_unique<FileIndexerDatabase>(FileIndexerDatabase::OpenMode::ReadOnly);
+
+  while (true) {
+    Request request;
+
+    {
+      std::unique_lock lock(m_mutex);
+
+      m_cv.wait(lock, [&]() { return !m_alive || !m_requests.empty(); });
+      if (!m_alive) break;
+      request = std::move(m_requests.front());
+      m_requests.pop_front();
+    }
+
+    process(request);
+  }
+
+  m_db.reset();
+}
+
+void ContentIndexer::stop() {
+  {
+    std::lock_guard lock(m_mutex);
+    m_alive = false;
+  }
+
+  m_cv.notify_all();
+}
+
+ContentIndexer::ContentIndexer(IndexerScanner &scanner, IndexerScheduler &scheduler)
+    : m_scanner(scanner), m_scheduler(scheduler) {}
@@ -0,0 +1,87 @@
+#pragma once
+#include "common.hpp"
+#include "services/files-service/file-indexer/file-indexer-db.hpp"
+#include "services/files-service/file-indexer/filesystem-walker.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <vector>
+
+class IndexerScanner;
+class IndexerScheduler;
+
+/**
+ * Keeps the index of the text content of files up to date, below the roots that have it enabled (see
+ * `AbstractFileIndexer::Entrypoint::indexContent`).
+ *
+ * The content index follows the file index. Once a scan has been written, the files below it whose content
+ * was never read, or was read before they last changed, are read again (see
+ * `FileIndexerDatabase::listStaleContentFiles`). Files reported as changed by the filesystem are read again
+ * as soon as they are indexed.
+ *
+ * Files are read by a pool of threads (see `ContentExtractor`) and the writer of the file index writes their
+ * content, `BATCH_SIZE` files at a time. Reading happens on a thread of its own, so that it never holds up
+ * the indexing of file names, and it gets paused along with scans (see `IndexerScheduler`). All of its
+ * threads inherit the scheduling classes of the scanner thread.
+ */
+class ContentIndexer : public NonCopyable {
+public:
+  static constexpr size_t BATCH_SIZE = 256;
+
+  void setRoots(std::vector<std::filesystem::path> roots);
+  void setThreadCount(size_t count);
+
+  /**
+   * Paths that have to be refreshed with `refreshTree` once a scan of `path` has been written: `path` itself
+   * if it is below a root, or the roots below it.
+   */
+  std::vector<std::filesystem::path> treesToRefresh(const std::filesystem::path &path) const;
+
+  /**
+   * Read the stale files below `path` again, as they are in the index. To be called by the writer.
+   */
+  void refreshTree(const std::filesystem::path &path);
+
+  /**
+   * Read the files of `entries` that are below a root again. To be called by the writer, once they have
+   * been indexed. Returns right away if no root has content indexing enabled.
+   */
+  void refreshFiles(const std::vector<FileSystemEntry> &entries);
+
+  void run();
+  void stop();
+
+  ContentIndexer(IndexerScanner &scanner, IndexerScheduler &scheduler);
+
+private:
+  static constexpr auto PAUSE_POLL_INTERVAL = std::chrono::seconds(5);
+
+  struct Request {
+    // a tree to refresh, or else the files to read again
+    std::optional<std::filesystem::path> tree;
+    std::vector<std::filesystem::path> files;
+  };
+
+  IndexerScanner &m_scanner;
+  IndexerScheduler &m_scheduler;
+  std::unique_ptr<FileIndexerDatabase> m_db;
+  std::atomic<size_t> m_threadCount = 1;
+  std::atomic<bool> m_alive = true;
+
+  // guards everything below
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::vector<std::filesystem::path> m_roots;
+  std::deque<Request> m_requests;
+
+  // called with m_mutex held
+  bool isBelowRoot(const std::filesystem::path &path) const;
+  void enqueue(Request request);
+  void process(const Request &request);
+  // read `paths` on the worker pool, and hand their content over to the writer
+  void extract(const std::vector<std::filesystem::path> &paths);
+  // returns false if stopped in the meantime
+  bool waitWhilePaused();
+};
@@ -1,6 +1,8 @@
 #include "file-indexer-db.hpp"
 #include "vicinae.hpp"
 #include "services/files-service/file-indexer/relevancy-scorer.hpp"
+#include "sql-profiler/sql-profiler.hpp"
+#include "trace/trace.hpp"
 #include "utils/migration-manager/migration-manager.hpp"
 #include "utils/utils.hpp"
 #include <qlogging.h>
@@ -19,24 +21,146 @@ static const std::vector<std::string> SQLITE_PRAGMAS = {
 	"PRAGMA temp_store = memory",
 	// "PRAGMA mmap_size = 30000000000"
 };
+
+static const std::vector<std::string> SQLITE_READ_ONLY_PRAGMAS = {
+	"PRAGMA query_only = true",
+	"PRAGMA temp_store = memory",
+	"PRAGMA mmap_size = 268435456", // 256MB
+	"PRAGMA cache_size = -16000", // 16MB
+};
+
+static const std::vector<std::string> SQLITE_BULK_LOAD_PRAGMAS = {
+	"PRAGMA synchronous = off",
+	"PRAGMA cache_size = -65536", // 64MB
+	// let the WAL grow larger before it gets checkpointed into the database
+	"PRAGMA wal_autocheckpoint = 16384",
+};
+
+static const std::vector<std::string> SQLITE_DEFAULT_WRITE_PRAGMAS = {
+	"PRAGMA cache_size = -2000",
+	"PRAGMA wal_autocheckpoint = 1000",
+	"PRAGMA wal_checkpoint(PASSIVE)",
+};
+
+// must stay in sync with the file-indexer migrations
+static const std::vector<std::string> FTS_TRIGGERS = {
+	R"(CREATE TRIGGER IF NOT EXISTS unicode_idx_ai AFTER INSERT ON indexed_file BEGIN
+  INSERT INTO unicode_idx(rowid, name) VALUES (new.id, new.name);END)",
+	R"(CREATE TRIGGER IF NOT EXISTS unicode_idx_ad AFTER DELETE ON indexed_file BEGIN
+  INSERT INTO unicode_idx(unicode_idx, rowid, name) VALUES('delete', old.id, old.name);END)",
+};
+
+// the substring index is optional, and therefore not created by the migrations
+static const std::string SUBSTRING_INDEX_TABLE = R"(CREATE VIRTUAL TABLE IF NOT EXISTS trigram_idx USING fts5(
+	name, content=indexed_file, tokenize='trigram'
+))";
+
+static const std::vector<std::string> SUBSTRING_INDEX_TRIGGERS = {
+	R"(CREATE TRIGGER IF NOT EXISTS trigram_idx_ai AFTER INSERT ON indexed_file BEGIN
+  INSERT INTO trigram_idx(rowid, name) VALUES (new.id, new.name);END)",
+	R"(CREATE TRIGGER IF NOT EXISTS trigram_idx_ad AFTER DELETE ON indexed_file BEGIN
+  INSERT INTO trigram_idx(trigram_idx, rowid, name) VALUES('delete', old.id, old.name);END)",
+};
+
+// the deletion log is only needed by the filename index, which is optional as well
+static const std::vector<std::string> DELETION_LOG_STATEMENTS = {
+	R"(CREATE TABLE IF NOT EXISTS deleted_file (
+	seq INTEGER PRIMARY KEY AUTOINCREMENT,
+	file_id INT NOT NULL
+))",
+	R"(CREATE TRIGGER IF NOT EXISTS indexed_file_deletion_log AFTER DELETE ON indexed_file BEGIN
+  INSERT INTO deleted_file(file_id) VALUES (old.id);END)",
+};
 // clang-format on
 
+// names matching the prefix expression of a substring search are ranked this much higher
+static constexpr double WORD_PREFIX_MATCH_BOOST = 2.0;
+// the full text rank of content matches is weighed down by this much, names being more telling
+static constexpr double CONTENT_MATCH_WEIGHT = 0.5;
+
+static constexpr int INSERT_COLUMN_COUNT = 4;
+// well below the minimum bound parameter limit of sqlite (999)
+static constexpr int INSERT_ROWS_PER_STATEMENT = 128;
+
+static QString buildInsertStatement(int rowCount) {
+  QString statement =
+      "INSERT INTO indexed_file (dir_id, name, last_modified_at, relevancy_score) VALUES ";
+
+  for (int i = 0; i != rowCount; ++i) {
+    if (i > 0) statement += ", ";
+    statement += "(?, ?, ?, ?)";
+  }
+
+  // the score is refreshed as well, so that files indexed by older versions get up to date scores over time
+  statement += " ON CONFLICT (dir_id, name) DO UPDATE SET last_modified_at = excluded.last_modified_at, "
+               "relevancy_score = excluded.relevancy_score";
+
+  return statement;
+}
+
 namespace fs = std::filesystem;
 
+struct SplitPath {
+  // ends with a separator, as the paths of the `directory` table do
+  std::string_view directory;
+  std::string_view name;
+};
+
+static SplitPath splitPath(std::string_view path) {
+  size_t sep = path.rfind('/');
+
+  return {.directory = path.substr(0, sep + 1), .name = path.substr(sep + 1)};
+}
+
+static QString toQString(std::string_view str) { return QString::fromUtf8(str.data(), str.size()); }
+
+/**
+ * Bounds of the paths of the `directory` table at or below `root`, see `deleteIndexedFiles`.
+ */
+static std::pair<QString, QString> directoryRange(const fs::path &root) {
+  std::string prefix = root.native();
+
+  if (!prefix.ends_with('/')) prefix += '/';
+
+  std::string upper = prefix;
+
+  upper.back() = '0';
+
+  return {QString::fromStdString(prefix), QString::fromStdString(upper)};
+}
+
 QString FileIndexerDatabase::createRandomConnectionId() {
   return QString("file-indexer-%1").arg(QUuid::createUuid().toString(QUuid::WithoutBraces));
 }
 
 fs::path FileIndexerDatabase::getDatabasePath() { return Omnicast::dataDir() / "file-indexer.db"; }
 
+size_t FileIndexerDatabase::getDatabaseSize() {
+  fs::path path = getDatabasePath();
+  size_t size = 0;
+
+  for (const fs::path &file : {path, fs::path(path.native() + "-wal")}) {
+    std::error_code ec;
+    auto fileSize = fs::file_size(file, ec);
+
+    if (!ec) size += fileSize;
+  }
+
+  return size;
+}
+
 std::optional<QDateTime>
 FileIndexerDatabase::retrieveIndexedLastModified(const std::filesystem::path &path) const {
   QSqlQuery query(m_db);
 
-  query.prepare("SELECT last_modified_at FROM indexed_file WHERE path = :path");
-  query.addBindValue(path.c_str());
+  auto [directory, name] = splitPath(path.native());
+
+  query.prepare("SELECT f.last_modified_at FROM indexed_file f JOIN directory d ON d.id = f.dir_id "
+                "WHERE d.path = :directory AND f.name = :name");
+  query.addBindValue(toQString(directory));
+  query.addBindValue(toQString(name));
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qWarning() << "Failed to retriveIndexedLastModified" << query.lastError();
     return std::nullopt;
   }
@@ -50,10 +174,15 @@ std::vector<std::filesystem::path>
 FileIndexerDatabase::listIndexedDirectoryFiles(const std::filesystem::path &path) const {
   QSqlQuery query(m_db);
 
-  query.prepare("SELECT path, last_modified_at FROM indexed_file WHERE parent_path = :path");
-  query.addBindValue(path.c_str());
+  std::string directory = path.native();
+
+  if (!directory.ends_with('/')) directory += '/';
 
-  if (!query.exec()) {
+  query.prepare("SELECT d.path || f.name FROM directory d JOIN indexed_file f ON f.dir_id = d.id "
+                "WHERE d.path = :path");
+  query.addBindValue(QString::fromStdString(directory));
+
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "listIndexedDirectoryFiles failed:" << query.lastError();
     return {};
   }
@@ -67,23 +196,91 @@ FileIndexerDatabase::listIndexedDirectoryFiles(const std::filesystem::path &path
   return paths;
 }
 
+std::optional<FileTimes> FileIndexerDatabase::retrieveDirectoryTimes(const fs::path &path) const {
+  QSqlQuery query(m_db);
+
+  query.prepare("SELECT last_modified_ns, last_changed_ns FROM indexed_directory WHERE path = :path");
+  query.addBindValue(path.c_str());
+
+  if (!SqlProfiler::exec(query)) {
+    qWarning() << "Failed to retrieveDirectoryTimes" << query.lastError();
+    return std::nullopt;
+  }
+
+  if (!query.next() || query.value(0).isNull()) { return std::nullopt; }
+
+  return FileTimes{.modified = query.value(0).toLongLong(), .changed = query.value(1).toLongLong()};
+}
+
+std::vector<FileIndexerDatabase::IndexedDirectory>
+FileIndexerDatabase::listIndexedSubdirectories(const fs::path &path) const {
+  QSqlQuery query(m_db);
+
+  query.prepare(
+      "SELECT path, last_modified_ns, last_changed_ns FROM indexed_directory WHERE parent_path = :path");
+  query.addBindValue(path.c_str());
+
+  if (!SqlProfiler::exec(query)) {
+    qCritical() << "listIndexedSubdirectories failed:" << query.lastError();
+    return {};
+  }
+
+  std::vector<IndexedDirectory> directories;
+
+  while (query.next()) {
+    IndexedDirectory directory{.path = query.value(0).toString().toStdString()};
+
+    if (!query.value(1).isNull()) {
+      directory.times =
+          FileTimes{.modified = query.value(1).toLongLong(), .changed = query.value(2).toLongLong()};
+    }
+
+    directories.emplace_back(std::move(directory));
+  }
+
+  return directories;
+}
+
 void FileIndexerDatabase::deleteIndexedFiles(const std::vector<fs::path> &paths) {
+  TraceScope trace("sqlite", "files delete");
+
   if (!m_db.transaction()) {
     qCritical() << "Failed to start transaction";
     return;
   }
 
   QSqlQuery query(m_db);
-
-  query.prepare("DELETE FROM indexed_file WHERE path = :path");
+  QSqlQuery subtreeQuery(m_db);
+  QSqlQuery directoryQuery(m_db);
+
+  // every path below `dir` sorts between "dir/" and "dir0", as '0' comes right after '/'.
+  // Rows of the `directory` table are left alone, see `m_directoryIds`.
+  query.prepare("DELETE FROM indexed_file WHERE name = :name AND dir_id = "
+                "(SELECT id FROM directory WHERE path = :directory)");
+  subtreeQuery.prepare("DELETE FROM indexed_file WHERE dir_id IN "
+                       "(SELECT id FROM directory WHERE path >= :prefix AND path < :upper)");
+  directoryQuery.prepare(
+      "DELETE FROM indexed_directory WHERE path = :path OR (path > :prefix AND path < :upper)");
 
   for (const auto &path : paths) {
-    query.addBindValue(path.c_str());
-
-    if (!query.exec()) {
-      qCritical() << "Failed to delete indexed file" << path.c_str();
-      m_db.rollback();
-      return;
+    auto [directory, name] = splitPath(path.native());
+    QString prefix = QString::fromStdString(path.native() + '/');
+    QString upper = QString::fromStdString(path.native() + '0');
+
+    query.addBindValue(toQString(name));
+    query.addBindValue(toQString(directory));
+    subtreeQuery.addBindValue(prefix);
+    subtreeQuery.addBindValue(upper);
+    directoryQuery.addBindValue(path.c_str());
+    directoryQuery.addBindValue(prefix);
+    directoryQuery.addBindValue(upper);
+
+    for (auto *q : {&query, &subtreeQuery, &directoryQuery}) {
+      if (!SqlProfiler::exec(*q)) {
+        qCritical() << "Failed to delete indexed file" << path.c_str() << q->lastError();
+        m_db.rollback();
+        return;
+      }
     }
   }
 
@@ -105,7 +302,7 @@ bool FileIndexerDatabase::setScanError(int scanId, const QString &error) {
   query.bindValue(":status", static_cast<quint8>(ScanStatus::Failed));
   query.bindValue(":error", error);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qWarning() << "Failed to update scan status" << query.lastError();
     return false;
   }
@@ -113,6 +310,21 @@ bool FileIndexerDatabase::setScanError(int scanId, const QString &error) {
   return true;
 }
 
+bool FileIndexerDatabase::setScanIndexedFileCount(int scanId, size_t count) {
+  QSqlQuery query(m_db);
+
+  query.prepare("UPDATE scan_history SET indexed_file_count = :count WHERE id = :id");
+  query.bindValue(":id", scanId);
+  query.bindValue(":count", static_cast<qulonglong>(count));
+
+  if (!SqlProfiler::exec(query)) {
+    qWarning() << "Failed to update scan file count" << query.lastError();
+    return false;
+  }
+
+  return true;
+}
+
 bool FileIndexerDatabase::updateScanStatus(int scanId, ScanStatus status) {
   QSqlQuery query(m_db);
 
@@ -120,7 +332,7 @@ bool FileIndexerDatabase::updateScanStatus(int scanId, ScanStatus status) {
   query.bindValue(":id", scanId);
   query.bindValue(":status", static_cast<quint8>(status));
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qWarning() << "Failed to update scan status" << query.lastError();
     return false;
   }
@@ -139,7 +351,7 @@ FileIndexerDatabase::createScan(const std::filesystem::path &path, ScanType type
   query.bindValue(":status", static_cast<quint8>(ScanStatus::Pending));
   query.bindValue(":type", static_cast<quint8>(type));
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qWarning() << "Failed to create scan history" << query.lastError();
     return std::unexpected("Failed to create scan history");
   }
@@ -167,15 +379,40 @@ FileIndexerDatabase::ScanRecord FileIndexerDatabase::mapScan(const QSqlQuery &qu
   record.createdAt = QDateTime::fromSecsSinceEpoch(query.value(2).toULongLong());
   record.path = query.value(3).toString().toStdString();
   record.type = static_cast<ScanType>(query.value(4).toUInt());
+  record.indexedFileCount = query.value(5).toULongLong();
 
   return record;
 }
 
+std::optional<FileIndexerDatabase::ScanRecord>
+FileIndexerDatabase::getLastFinishedScan(const fs::path &entrypoint, std::optional<ScanType> type) const {
+  QSqlQuery query(m_db);
+
+  query.prepare("SELECT id, status, created_at, entrypoint, type, indexed_file_count FROM scan_history "
+                "WHERE entrypoint = ? AND status = ? AND (? IS NULL OR type = ?) ORDER BY id DESC LIMIT 1");
+  query.addBindValue(entrypoint.c_str());
+  query.addBindValue(static_cast<quint8>(ScanStatus::Finished));
+
+  QVariant scanType = type ? QVariant(static_cast<quint8>(*type)) : QVariant();
+
+  query.addBindValue(scanType);
+  query.addBindValue(scanType);
+
+  if (!SqlProfiler::exec(query)) {
+    qCritical() << "Failed to get last finished scan" << query.lastError();
+    return std::nullopt;
+  }
+
+  if (!query.next()) return std::nullopt;
+
+  return mapScan(query);
+}
+
 std::optional<FileIndexerDatabase::ScanRecord> FileIndexerDatabase::getLastScan() const {
   QSqlQuery query(m_db);
 
-  if (!query.exec("SELECT id, status, created_at, entrypoint, type FROM scan_history ORDER BY created_at "
-                  "DESC LIMIT 1")) {
+  if (!SqlProfiler::exec(query, "SELECT id, status, created_at, entrypoint, type, indexed_file_count "
+                                "FROM scan_history ORDER BY created_at DESC LIMIT 1")) {
     qCritical() << "Failed to list scan records" << query.lastError();
     return {};
   }
@@ -188,7 +425,8 @@ std::optional<FileIndexerDatabase::ScanRecord> FileIndexerDatabase::getLastScan(
 std::vector<FileIndexerDatabase::ScanRecord> FileIndexerDatabase::listScans() {
   QSqlQuery query(m_db);
 
-  if (!query.exec("SELECT id, status, created_at, entrypoint, type FROM scan_history")) {
+  if (!SqlProfiler::exec(query, "SELECT id, status, created_at, entrypoint, type, indexed_file_count "
+                                "FROM scan_history")) {
     qCritical() << "Failed to list scan records" << query.lastError();
     return {};
   }
@@ -207,10 +445,11 @@ std::vector<FileIndexerDatabase::ScanRecord> FileIndexerDatabase::listScans() {
 std::vector<FileIndexerDatabase::ScanRecord> FileIndexerDatabase::listStartedScans() {
   QSqlQuery query(m_db);
 
-  query.prepare("SELECT id, status, created_at, entrypoint, type FROM scan_history WHERE status = :status");
+  query.prepare("SELECT id, status, created_at, entrypoint, type, indexed_file_count FROM scan_history "
+                "WHERE status = :status");
   query.bindValue(":status", static_cast<quint8>(ScanStatus::Started));
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to list started scan records" << query.lastError();
     return {};
   }
@@ -228,106 +467,1028 @@ std::vector<FileIndexerDatabase::ScanRecord> FileIndexerDatabase::listStartedSca
 
 QSqlDatabase *FileIndexerDatabase::database() { return &m_db; }
 
-std::vector<fs::path> FileIndexerDatabase::search(std::string_view searchQuery,
-                                                  const AbstractFileIndexer::QueryParams &params) {
-  auto queryString = QString(R"(
-  	SELECT path, rank FROM indexed_file f 
-	JOIN unicode_idx ON unicode_idx.rowid = f.id 
-	WHERE 
-	    unicode_idx MATCH '%1'
-	ORDER BY f.relevancy_score DESC, unicode_idx.rank 
+bool FileIndexerDatabase::prepareSearchQuery() {
+  QSqlQuery query(m_db);
+
+  query.setForwardOnly(true);
+
+  /**
+   * Sqlite keeps the best `limit + offset` rows in a bounded sorter when a query has both an ORDER BY and a
+   * LIMIT, so the rank is computed for every match without the matches ever being materialized.
+   * The current time is computed once for the whole query.
+   */
+  QString statement = QString(R"(
+	WITH clock(now) AS MATERIALIZED (SELECT unixepoch())
+	SELECT d.path || f.name, %1 AS score FROM clock
+	CROSS JOIN unicode_idx
+	JOIN indexed_file f ON f.id = unicode_idx.rowid
+	JOIN directory d ON d.id = f.dir_id
+	LEFT JOIN file_open o ON o.path = d.path || f.name
+	WHERE
+	    unicode_idx MATCH :query
+	ORDER BY score DESC
+	LIMIT :limit
+	OFFSET :offset
+  )")
+                          .arg(RelevancyScorer::rankExpression("unicode_idx"));
+  bool ok = query.prepare(statement);
+
+  if (!ok) {
+    qWarning() << "Failed to prepare search query" << query.lastError();
+    return false;
+  }
+
+  m_searchQuery = std::move(query);
+
+  return true;
+}
+
+bool FileIndexerDatabase::prepareSubstringSearchQuery() {
+  QSqlQuery query(m_db);
+
+  query.setForwardOnly(true);
+
+  // the prefix matches are collected once by sqlite, as the subquery is not correlated
+  QString statement = QString(R"(
+	WITH clock(now) AS MATERIALIZED (SELECT unixepoch())
+	SELECT d.path || f.name, %1
+	    * (CASE WHEN f.id IN (SELECT rowid FROM unicode_idx WHERE unicode_idx MATCH :prefix)
+	        THEN %2 ELSE 1.0 END)
+	    AS score FROM clock
+	CROSS JOIN trigram_idx
+	JOIN indexed_file f ON f.id = trigram_idx.rowid
+	JOIN directory d ON d.id = f.dir_id
+	LEFT JOIN file_open o ON o.path = d.path || f.name
+	WHERE
+	    trigram_idx MATCH :query
+	ORDER BY score DESC
 	LIMIT :limit
 	OFFSET :offset
   )")
-                         .arg(qStringFromStdView(searchQuery));
+                          .arg(RelevancyScorer::rankExpression("trigram_idx"))
+                          .arg(WORD_PREFIX_MATCH_BOOST, 0, 'f', 1);
+  bool ok = query.prepare(statement);
+
+  if (!ok) {
+    qWarning() << "Failed to prepare substring search query" << query.lastError();
+    return false;
+  }
+
+  m_substringSearchQuery = std::move(query);
+
+  return true;
+}
 
+bool FileIndexerDatabase::prepareContentSearchQuery() {
   QSqlQuery query(m_db);
 
-  query.prepare(queryString);
+  query.setForwardOnly(true);
+
+  // files matched by name and by content get the best of both ranks
+  QString statement = QString(R"(
+	WITH clock(now) AS MATERIALIZED (SELECT unixepoch()),
+	matched(id, match_score) AS (
+	    SELECT rowid, -bm25(unicode_idx) FROM unicode_idx WHERE unicode_idx MATCH :names
+	    UNION ALL
+	    SELECT c.file_id, -bm25(content_idx) * %1 FROM content_idx
+	    JOIN file_chunk c ON c.id = content_idx.rowid
+	    WHERE content_idx MATCH :contents
+	),
+	best(id, match_score) AS (SELECT id, MAX(match_score) FROM matched GROUP BY id)
+	SELECT d.path || f.name, b.match_score * %2 AS score FROM clock
+	CROSS JOIN best b
+	JOIN indexed_file f ON f.id = b.id
+	JOIN directory d ON d.id = f.dir_id
+	LEFT JOIN file_open o ON o.path = d.path || f.name
+	ORDER BY score DESC
+	LIMIT :limit
+	OFFSET :offset
+  )")
+                          .arg(CONTENT_MATCH_WEIGHT, 0, 'f', 1)
+                          .arg(RelevancyScorer::metadataRankExpression());
+  bool ok = query.prepare(statement);
+
+  if (!ok) {
+    qWarning() << "Failed to prepare content search query" << query.lastError();
+    return false;
+  }
+
+  m_contentSearchQuery = std::move(query);
+
+  return true;
+}
+
+std::vector<fs::path> FileIndexerDatabase::search(const SearchQuery &searchQuery,
+                                                  const AbstractFileIndexer::QueryParams &params,
+                                                  const std::function<bool()> &shouldStop,
+                                                  const ChunkHandler &onChunk) {
+  TraceScope trace("sqlite", "files search");
+  bool substring = !searchQuery.substring.isEmpty() && hasSubstringIndex();
+  bool content = !substring && hasFileContents();
+
+  if (substring) {
+    if (!m_substringSearchQuery && !prepareSubstringSearchQuery()) return {};
+  } else if (content) {
+    if (!m_contentSearchQuery && !prepareContentSearchQuery()) return {};
+  } else if (!m_searchQuery && !prepareSearchQuery()) {
+    return {};
+  }
+
+  QSqlQuery &query = substring ? *m_substringSearchQuery : content ? *m_contentSearchQuery : *m_searchQuery;
+
+  if (substring) {
+    query.bindValue(":query", searchQuery.substring);
+    query.bindValue(":prefix", searchQuery.prefix);
+  } else if (content) {
+    query.bindValue(":names", searchQuery.prefix);
+    query.bindValue(":contents", searchQuery.prefix);
+  } else {
+    query.bindValue(":query", searchQuery.prefix);
+  }
+
   query.bindValue(":limit", params.pagination.limit);
   query.bindValue(":offset", params.pagination.offset);
 
-  if (!query.exec()) { qWarning() << "Search query failed" << query.lastError(); }
+  if (!SqlProfiler::exec(query)) {
+    qWarning() << "Search query failed" << query.lastError();
+    return {};
+  }
 
   std::vector<fs::path> results;
+  size_t chunkSize = onChunk ? FIRST_SEARCH_CHUNK_SIZE : params.pagination.limit;
 
-  results.reserve(params.pagination.limit);
+  results.reserve(chunkSize);
 
   while (query.next()) {
+    if (shouldStop && shouldStop()) break;
+
     fs::path path = query.value(0).toString().toStdString();
 
-    if (fs::exists(path)) { results.emplace_back(path); }
+    if (!fs::exists(path)) continue;
+
+    results.emplace_back(path);
+
+    if (onChunk && results.size() == chunkSize) {
+      onChunk(std::move(results));
+      chunkSize = SEARCH_CHUNK_SIZE;
+      results.clear();
+      results.reserve(chunkSize);
+    }
+  }
+
+  // reset the statement so that it does not hold on to a read snapshot between searches
+  query.finish();
+
+  if (onChunk) {
+    if (!results.empty()) onChunk(std::move(results));
+    return {};
   }
 
   return results;
 }
 
-void FileIndexerDatabase::indexFiles(const std::vector<std::filesystem::path> &paths) {
+bool FileIndexerDatabase::prepareInsertQuery() {
+  if (m_insertQuery) return true;
+
+  QSqlQuery query(m_db);
+
+  if (!query.prepare(buildInsertStatement(INSERT_ROWS_PER_STATEMENT))) {
+    qCritical() << "Failed to prepare insert query" << query.lastError();
+    return false;
+  }
+
+  m_insertQuery = std::move(query);
+
+  return true;
+}
+
+std::optional<int64_t> FileIndexerDatabase::resolveDirectoryId(std::string_view path) {
+  std::string key(path);
+
+  if (auto it = m_directoryIds.find(key); it != m_directoryIds.end()) return it->second;
+
+  QVariant parentId;
+  // the root has no parent
+  size_t sep = path.size() > 1 ? path.rfind('/', path.size() - 2) : std::string_view::npos;
+
+  if (sep != std::string_view::npos) {
+    auto parent = resolveDirectoryId(path.substr(0, sep + 1));
+
+    if (!parent) return std::nullopt;
+    parentId = static_cast<qlonglong>(*parent);
+  }
+
+  if (!m_directoryQuery) {
+    QSqlQuery query(m_db);
+
+    // the no-op update makes the id of an existing row returned as well
+    if (!query.prepare("INSERT INTO directory (parent_id, path) VALUES (?, ?) "
+                       "ON CONFLICT (path) DO UPDATE SET parent_id = excluded.parent_id RETURNING id")) {
+      qCritical() << "Failed to prepare directory query" << query.lastError();
+      return std::nullopt;
+    }
+
+    m_directoryQuery = std::move(query);
+  }
+
+  m_directoryQuery->addBindValue(parentId);
+  m_directoryQuery->addBindValue(toQString(path));
+
+  if (!SqlProfiler::exec(*m_directoryQuery) || !m_directoryQuery->next()) {
+    qCritical() << "Failed to insert directory" << key.c_str() << m_directoryQuery->lastError();
+    return std::nullopt;
+  }
+
+  int64_t id = m_directoryQuery->value(0).toLongLong();
+
+  m_directoryQuery->finish();
+  m_directoryIds.emplace(std::move(key), id);
+
+  return id;
+}
+
+void FileIndexerDatabase::indexFiles(const std::vector<FileSystemEntry> &entries, bool recordDirectoryTimes) {
+  TraceScope trace("sqlite", "files index");
   QSqlQuery query(m_db);
+  QSqlQuery directoryQuery(m_db);
+
+  if (!prepareInsertQuery()) return;
 
   if (!m_db.transaction()) {
     qWarning() << "Failed to start batch insert transaction" << m_db.lastError();
     return;
   }
 
-  query.prepare(R"(
-    INSERT INTO 
-	  	indexed_file (path, parent_path, name, last_modified_at, relevancy_score) 
-	VALUES 
-		(:path, :parent_path, :name, :last_modified_at, :relevancy_score) 
-	ON CONFLICT (path) DO UPDATE SET last_modified_at = :last_modified_at
-  )");
+  query.prepare(buildInsertStatement(1));
+
+  // directories that have not been listed keep their previous times, if any
+  if (recordDirectoryTimes) {
+    directoryQuery.prepare(R"(
+      INSERT INTO
+        indexed_directory (path, parent_path, last_modified_ns, last_changed_ns)
+      VALUES
+        (:path, :parent_path, :last_modified_ns, :last_changed_ns)
+      ON CONFLICT (path) DO UPDATE SET
+        last_modified_ns = excluded.last_modified_ns,
+        last_changed_ns = excluded.last_changed_ns
+    )");
+  } else {
+    directoryQuery.prepare(R"(
+      INSERT INTO indexed_directory (path, parent_path) VALUES (:path, :parent_path)
+      ON CONFLICT (path) DO NOTHING
+    )");
+  }
 
-  std::error_code ec;
   RelevancyScorer scorer;
-  double score = 1.0;
 
-  for (const auto &path : paths) {
-    if (auto lastModified = fs::last_write_time(path, ec); !ec) {
-      using namespace std::chrono;
-      auto sctp = clock_cast<system_clock>(lastModified);
-      long long epoch = duration_cast<seconds>(sctp.time_since_epoch()).count();
-
-      query.bindValue(":last_modified_at", epoch);
-      score = scorer.computeScore(path, lastModified);
-    } else {
-      query.bindValue(":last_modified_at", QVariant());
-      score = scorer.computeScore(path, std::nullopt);
+  // directories inserted by the transaction are no longer there once it is rolled back
+  auto rollback = [&]() {
+    m_db.rollback();
+    m_directoryIds.clear();
+  };
+
+  auto bindRow = [&](QSqlQuery &q, int row, const FileSystemEntry &entry) {
+    auto [directory, name] = splitPath(entry.path.native());
+    auto directoryId = resolveDirectoryId(directory);
+    QVariant lastModifiedAt;
+    int base = row * INSERT_COLUMN_COUNT;
+
+    if (!directoryId) return false;
+    if (entry.times) { lastModifiedAt = static_cast<qlonglong>(entry.times->modified / 1'000'000'000); }
+
+    q.bindValue(base, static_cast<qlonglong>(*directoryId));
+    q.bindValue(base + 1, toQString(name));
+    q.bindValue(base + 2, lastModifiedAt);
+    q.bindValue(base + 3, scorer.computeScore(entry.path));
+
+    return true;
+  };
+
+  size_t i = 0;
+
+  // one statement per chunk of rows, the remaining rows being inserted one by one
+  for (; i + INSERT_ROWS_PER_STATEMENT <= entries.size(); i += INSERT_ROWS_PER_STATEMENT) {
+    for (int row = 0; row != INSERT_ROWS_PER_STATEMENT; ++row) {
+      if (!bindRow(*m_insertQuery, row, entries[i + row])) {
+        rollback();
+        return;
+      }
     }
 
-    query.bindValue(":path", path.c_str());
-    query.bindValue(":parent_path", path.parent_path().c_str());
-    query.bindValue(":name", path.filename().c_str());
-    query.bindValue(":relevancy_score", score);
+    if (!SqlProfiler::exec(*m_insertQuery)) {
+      qCritical() << "Failed to insert files in index" << m_insertQuery->lastError();
+      rollback();
+      return;
+    }
+  }
 
-    if (!query.exec()) {
-      qCritical() << "Failed to insert file in index" << path << query.lastError();
-      m_db.rollback();
+  for (; i < entries.size(); ++i) {
+    if (!bindRow(query, 0, entries[i])) {
+      rollback();
+      return;
+    }
+
+    if (!SqlProfiler::exec(query)) {
+      qCritical() << "Failed to insert file in index" << entries[i].path << query.lastError();
+      rollback();
+      return;
+    }
+  }
+
+  for (const auto &entry : entries) {
+    if (!entry.isDirectory) continue;
+
+    const auto &path = entry.path;
+
+    directoryQuery.bindValue(":path", path.c_str());
+    directoryQuery.bindValue(":parent_path", path.parent_path().c_str());
+
+    if (recordDirectoryTimes && entry.times) {
+      directoryQuery.bindValue(":last_modified_ns", static_cast<qlonglong>(entry.times->modified));
+      directoryQuery.bindValue(":last_changed_ns", static_cast<qlonglong>(entry.times->changed));
+    } else if (recordDirectoryTimes) {
+      directoryQuery.bindValue(":last_modified_ns", QVariant());
+      directoryQuery.bindValue(":last_changed_ns", QVariant());
+    }
+
+    if (!SqlProfiler::exec(directoryQuery)) {
+      qCritical() << "Failed to insert directory in index" << path << directoryQuery.lastError();
+      rollback();
       return;
     }
   }
 
-  if (!m_db.commit()) { qCritical() << "Failed to commit batchIndex" << m_db.lastError(); }
+  if (!m_db.commit()) {
+    qCritical() << "Failed to commit batchIndex" << m_db.lastError();
+    m_directoryIds.clear();
+  }
 }
 
-FileIndexerDatabase::FileIndexerDatabase() : m_connectionId(createRandomConnectionId()) {
-  m_db = QSqlDatabase::addDatabase("QSQLITE", m_connectionId);
-  m_db.setDatabaseName(getDatabasePath().c_str());
+void FileIndexerDatabase::recordFileOpens(const std::vector<fs::path> &paths) {
+  QSqlQuery query(m_db);
 
-  if (!m_db.open()) {
-    qCritical() << "Failed to open datbase at" << getDatabasePath();
-    return;
+  query.prepare(R"(
+    INSERT INTO file_open (path, open_count, last_opened_at) VALUES (:path, 1, unixepoch())
+    ON CONFLICT (path) DO UPDATE SET open_count = open_count + 1, last_opened_at = excluded.last_opened_at
+  )");
+
+  for (const auto &path : paths) {
+    query.bindValue(":path", path.c_str());
+
+    if (!SqlProfiler::exec(query)) {
+      qWarning() << "Failed to record file open for" << path.c_str() << query.lastError();
+    }
   }
+}
 
+bool FileIndexerDatabase::hasIndexedFiles() const {
   QSqlQuery query(m_db);
 
-  for (const auto &pragma : SQLITE_PRAGMAS) {
-    if (!query.exec(pragma.c_str())) { qCritical() << "Failed to run file-indexer pragma" << pragma; }
+  if (!SqlProfiler::exec(query, "SELECT 1 FROM indexed_file LIMIT 1")) {
+    qWarning() << "Failed to check for indexed files" << query.lastError();
+    return true;
   }
+
+  return query.next();
 }
 
-FileIndexerDatabase::~FileIndexerDatabase() {
-  QString id = m_connectionId;
+std::vector<fs::path>
+FileIndexerDatabase::listStaleContentFiles(const fs::path &root,
+                                           const std::function<bool(const fs::path &)> &filter) const {
+  QSqlQuery query(m_db);
+  auto [prefix, upper] = directoryRange(root);
+
+  query.setForwardOnly(true);
+  query.prepare(R"(
+    SELECT d.path || f.name FROM directory d
+    JOIN indexed_file f ON f.dir_id = d.id
+    LEFT JOIN file_content c ON c.file_id = f.id
+    WHERE d.path >= :prefix AND d.path < :upper
+    AND (c.file_id IS NULL OR c.last_modified_at IS NOT f.last_modified_at)
+  )");
+  query.addBindValue(prefix);
+  query.addBindValue(upper);
+
+  if (!SqlProfiler::exec(query)) {
+    qCritical() << "listStaleContentFiles failed:" << query.lastError();
+    return {};
+  }
+
+  std::vector<fs::path> paths;
+
+  // most files have no content worth indexing, they are filtered out as they are read
+  while (query.next()) {
+    fs::path path = query.value(0).toString().toStdString();
+
+    if (filter(path)) paths.emplace_back(std::move(path));
+  }
+
+  return paths;
+}
+
+void FileIndexerDatabase::indexFileContents(const std::vector<FileContent> &contents) {
+  TraceScope trace("sqlite", "contents index");
+  QSqlQuery fileQuery(m_db);
+  QSqlQuery deleteQuery(m_db);
+  QSqlQuery chunkQuery(m_db);
+  QSqlQuery contentQuery(m_db);
+
+  if (!m_db.transaction()) {
+    qWarning() << "Failed to start content insert transaction" << m_db.lastError();
+    return;
+  }
+
+  fileQuery.prepare("SELECT f.id FROM indexed_file f JOIN directory d ON d.id = f.dir_id "
+                    "WHERE d.path = :directory AND f.name = :name");
+  deleteQuery.prepare("DELETE FROM file_chunk WHERE file_id = :id");
+  chunkQuery.prepare("INSERT INTO file_chunk (file_id, body) VALUES (:id, :body)");
+  contentQuery.prepare(R"(
+    INSERT INTO file_content (file_id, last_modified_at) VALUES (:id, :last_modified_at)
+    ON CONFLICT (file_id) DO UPDATE SET last_modified_at = excluded.last_modified_at
+  )");
+
+  auto exec = [&](QSqlQuery &query, const fs::path &path) {
+    if (SqlProfiler::exec(query)) return true;
+
+    qCritical() << "Failed to index content of" << path.c_str() << query.lastError();
+    m_db.rollback();
+
+    return false;
+  };
+
+  for (const auto &content : contents) {
+    auto [directory, name] = splitPath(content.path.native());
+
+    fileQuery.addBindValue(toQString(directory));
+    fileQuery.addBindValue(toQString(name));
+
+    if (!exec(fileQuery, content.path)) return;
+    // removed from the index while it was being read
+    if (!fileQuery.next()) continue;
+
+    qlonglong id = fileQuery.value(0).toLongLong();
+
+    deleteQuery.addBindValue(id);
+    if (!exec(deleteQuery, content.path)) return;
+
+    for (const auto &chunk : content.chunks) {
+      chunkQuery.addBindValue(id);
+      chunkQuery.addBindValue(chunk);
+      if (!exec(chunkQuery, content.path)) return;
+    }
+
+    contentQuery.addBindValue(id);
+    contentQuery.addBindValue(static_cast<qlonglong>(content.lastModifiedAt));
+    if (!exec(contentQuery, content.path)) return;
+  }
+
+  if (!m_db.commit()) { qCritical() << "Failed to commit file contents" << m_db.lastError(); }
+}
+
+void FileIndexerDatabase::pruneFileContents(const std::vector<fs::path> &roots) {
+  QSqlQuery query(m_db);
+  QStringList conditions;
+
+  for (size_t i = 0; i != roots.size(); ++i) {
+    conditions << "(d.path >= ? AND d.path < ?)";
+  }
+
+  QString statement = "SELECT c.file_id FROM file_content c JOIN indexed_file f ON f.id = c.file_id "
+                      "JOIN directory d ON d.id = f.dir_id";
+
+  if (!conditions.isEmpty()) { statement += QString(" WHERE NOT (%1)").arg(conditions.join(" OR ")); }
+
+  query.setForwardOnly(true);
+  query.prepare(statement);
+
+  for (const auto &root : roots) {
+    auto [prefix, upper] = directoryRange(root);
+
+    query.addBindValue(prefix);
+    query.addBindValue(upper);
+  }
+
+  if (!SqlProfiler::exec(query)) {
+    qCritical() << "Failed to list pruned file contents" << query.lastError();
+    return;
+  }
+
+  std::vector<qlonglong> ids;
+
+  while (query.next()) {
+    ids.emplace_back(query.value(0).toLongLong());
+  }
+
+  query.finish();
+
+  if (ids.empty()) return;
+
+  if (!m_db.transaction()) {
+    qCritical() << "Failed to start transaction" << m_db.lastError();
+    return;
+  }
+
+  QSqlQuery chunkQuery(m_db);
+
+  query.prepare("DELETE FROM file_content WHERE file_id = :id");
+  chunkQuery.prepare("DELETE FROM file_chunk WHERE file_id = :id");
+
+  for (qlonglong id : ids) {
+    for (auto *q : {&query, &chunkQuery}) {
+      q->addBindValue(id);
+
+      if (!SqlProfiler::exec(*q)) {
+        qCritical() << "Failed to prune file content" << q->lastError();
+        m_db.rollback();
+        return;
+      }
+    }
+  }
+
+  if (!m_db.commit()) { qCritical() << "Failed to commit file content pruning" << m_db.lastError(); }
+}
+
+bool FileIndexerDatabase::hasFileContents() const {
+  QSqlQuery query(m_db);
+
+  if (!SqlProfiler::exec(query, "SELECT 1 FROM file_chunk LIMIT 1")) {
+    qWarning() << "Failed to check for file contents" << query.lastError();
+    return false;
+  }
+
+  return query.next();
+}
+
+/**
+ * Read a sqlite varint at `pos`, advancing it past the varint.
+ * Values in the FTS structure record are small enough to never need the 9 byte form.
+ */
+static std::optional<uint64_t> readSqliteVarint(const QByteArray &data, qsizetype &pos) {
+  uint64_t value = 0;
+
+  for (int i = 0; i != 8 && pos < data.size(); ++i) {
+    auto byte = static_cast<uint8_t>(data.at(pos++));
+
+    value = (value << 7) | (byte & 0x7F);
+    if (!(byte & 0x80)) return value;
+  }
+
+  return std::nullopt;
+}
+
+void FileIndexerDatabase::shrinkMemory() {
+  QSqlQuery query(m_db);
+
+  if (!SqlProfiler::exec(query, "PRAGMA shrink_memory")) {
+    qWarning() << "Failed to shrink file index memory" << query.lastError();
+  }
+}
+
+std::optional<size_t> FileIndexerDatabase::retrieveFtsSegmentCount() const {
+  QSqlQuery query(m_db);
+
+  // the structure record of a FTS5 index always has id 10
+  if (!SqlProfiler::exec(query, "SELECT block FROM unicode_idx_data WHERE id = 10")) {
+    qWarning() << "Failed to retrieve FTS structure" << query.lastError();
+    return std::nullopt;
+  }
+
+  if (!query.next()) return 0;
+
+  // 4 byte cookie, optional 4 byte version marker, then the level and segment counts as varints
+  static const QByteArray STRUCTURE_V2_MARKER("\xFF\x00\x00\x01", 4);
+  QByteArray structure = query.value(0).toByteArray();
+  qsizetype pos = 4;
+
+  if (structure.mid(pos).startsWith(STRUCTURE_V2_MARKER)) {
+    pos += STRUCTURE_V2_MARKER.size();
+  }
+
+  if (!readSqliteVarint(structure, pos)) return std::nullopt;
+
+  return readSqliteVarint(structure, pos);
+}
+
+bool FileIndexerDatabase::execPragmas(const std::vector<std::string> &pragmas) {
+  QSqlQuery query(m_db);
+  bool ok = true;
+
+  for (const auto &pragma : pragmas) {
+    if (!SqlProfiler::exec(query, pragma.c_str())) {
+      qCritical() << "Failed to run file-indexer pragma" << pragma << query.lastError();
+      ok = false;
+    }
+  }
+
+  return ok;
+}
+
+bool FileIndexerDatabase::beginBulkLoad() {
+  QSqlQuery query(m_db);
+
+  // journal_mode is left alone, as it cannot be changed while search connections are open
+  execPragmas(SQLITE_BULK_LOAD_PRAGMAS);
+
+  for (const auto *trigger : {"unicode_idx_ai", "unicode_idx_ad", "trigram_idx_ai", "trigram_idx_ad"}) {
+    if (!SqlProfiler::exec(query, QString("DROP TRIGGER IF EXISTS %1").arg(trigger))) {
+      qCritical() << "Failed to drop trigger" << trigger << query.lastError();
+      return false;
+    }
+  }
+
+  m_bulkLoading = true;
+
+  return true;
+}
+
+/**
+ * Rebuild the full text index `table` from the content table, and create the triggers maintaining it.
+ * Expected to run inside a transaction.
+ */
+static bool rebuildFtsIndex(QSqlQuery &query, const QString &table,
+                            const std::vector<std::string> &triggers) {
+  // FTS5 reads the whole content table at once, which is much faster than row by row insertions
+  if (!SqlProfiler::exec(query, QString("INSERT INTO %1(%1) VALUES('rebuild')").arg(table))) {
+    qCritical() << "Failed to rebuild full text index" << table << query.lastError();
+    return false;
+  }
+
+  for (const auto &trigger : triggers) {
+    if (!SqlProfiler::exec(query, trigger.c_str())) {
+      qCritical() << "Failed to create trigger" << query.lastError();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool FileIndexerDatabase::endBulkLoad() {
+  QSqlQuery query(m_db);
+  bool substringIndex = hasSubstringIndex();
+
+  if (!m_db.transaction()) {
+    qCritical() << "Failed to start transaction" << m_db.lastError();
+    return false;
+  }
+
+  if (!rebuildFtsIndex(query, "unicode_idx", FTS_TRIGGERS) ||
+      (substringIndex && !rebuildFtsIndex(query, "trigram_idx", SUBSTRING_INDEX_TRIGGERS))) {
+    m_db.rollback();
+    return false;
+  }
+
+  if (!m_db.commit()) {
+    qCritical() << "Failed to commit bulk load" << m_db.lastError();
+    return false;
+  }
+
+  m_bulkLoading = false;
+
+  return execPragmas(SQLITE_PRAGMAS) && execPragmas(SQLITE_DEFAULT_WRITE_PRAGMAS);
+}
+
+void FileIndexerDatabase::recoverBulkLoad() {
+  QSqlQuery query(m_db);
+
+  query.prepare(R"(
+    SELECT COUNT(*) FROM sqlite_master
+    WHERE type = 'trigger'
+    AND name IN ('unicode_idx_ai', 'unicode_idx_ad', 'trigram_idx_ai', 'trigram_idx_ad')
+  )");
+
+  if (!SqlProfiler::exec(query)) {
+    qWarning() << "Failed to list file-indexer triggers" << query.lastError();
+    return;
+  }
+
+  size_t expectedCount = FTS_TRIGGERS.size() + (hasSubstringIndex() ? SUBSTRING_INDEX_TRIGGERS.size() : 0);
+
+  if (query.next() && query.value(0).toULongLong() == expectedCount) return;
+
+  qWarning() << "A bulk load of the file index was interrupted, rebuilding full text index...";
+  endBulkLoad();
+}
+
+bool FileIndexerDatabase::hasSubstringIndex() const {
+  QSqlQuery query(m_db);
+
+  if (!SqlProfiler::exec(query,
+                         "SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = 'trigram_idx'")) {
+    qWarning() << "Failed to check for substring index" << query.lastError();
+    return false;
+  }
+
+  return query.next();
+}
+
+bool FileIndexerDatabase::createSubstringIndex() {
+  QSqlQuery query(m_db);
+
+  if (hasSubstringIndex()) return true;
+
+  if (!m_db.transaction()) {
+    qCritical() << "Failed to start transaction" << m_db.lastError();
+    return false;
+  }
+
+  // the trigram tokenizer requires sqlite 3.34
+  if (!SqlProfiler::exec(query, SUBSTRING_INDEX_TABLE.c_str())) {
+    qCritical() << "Failed to create substring index" << query.lastError();
+    m_db.rollback();
+    return false;
+  }
+
+  // a running bulk load populates the index when it ends
+  if (!m_bulkLoading && !rebuildFtsIndex(query, "trigram_idx", SUBSTRING_INDEX_TRIGGERS)) {
+    m_db.rollback();
+    return false;
+  }
+
+  if (!m_db.commit()) {
+    qCritical() << "Failed to commit substring index creation" << m_db.lastError();
+    return false;
+  }
+
+  return true;
+}
+
+bool FileIndexerDatabase::dropSubstringIndex() {
+  QSqlQuery query(m_db);
+
+  if (!m_db.transaction()) {
+    qCritical() << "Failed to start transaction" << m_db.lastError();
+    return false;
+  }
+
+  for (const auto *statement :
+       {"DROP TRIGGER IF EXISTS trigram_idx_ai", "DROP TRIGGER IF EXISTS trigram_idx_ad",
+        "DROP TABLE IF EXISTS trigram_idx"}) {
+    if (!SqlProfiler::exec(query, statement)) {
+      qCritical() << "Failed to drop substring index" << query.lastError();
+      m_db.rollback();
+      return false;
+    }
+  }
+
+  if (!m_db.commit()) {
+    qCritical() << "Failed to commit substring index removal" << m_db.lastError();
+    return false;
+  }
+
+  return true;
+}
+
+bool FileIndexerDatabase::hasDeletionLog() const {
+  QSqlQuery query(m_db);
+
+  if (!SqlProfiler::exec(query,
+                         "SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = 'deleted_file'")) {
+    qWarning() << "Failed to check for deletion log" << query.lastError();
+    return false;
+  }
+
+  return query.next();
+}
+
+bool FileIndexerDatabase::createDeletionLog() {
+  QSqlQuery query(m_db);
+
+  if (!m_db.transaction()) {
+    qCritical() << "Failed to start transaction" << m_db.lastError();
+    return false;
+  }
+
+  for (const auto &statement : DELETION_LOG_STATEMENTS) {
+    if (!SqlProfiler::exec(query, statement.c_str())) {
+      qCritical() << "Failed to create deletion log" << query.lastError();
+      m_db.rollback();
+      return false;
+    }
+  }
+
+  if (!m_db.commit()) {
+    qCritical() << "Failed to commit deletion log creation" << m_db.lastError();
+    return false;
+  }
+
+  return true;
+}
+
+bool FileIndexerDatabase::dropDeletionLog() {
+  QSqlQuery query(m_db);
+
+  if (!m_db.transaction()) {
+    qCritical() << "Failed to start transaction" << m_db.lastError();
+    return false;
+  }
+
+  for (const auto *statement :
+       {"DROP TRIGGER IF EXISTS indexed_file_deletion_log", "DROP TABLE IF EXISTS deleted_file"}) {
+    if (!SqlProfiler::exec(query, statement)) {
+      qCritical() << "Failed to drop deletion log" << query.lastError();
+      m_db.rollback();
+      return false;
+    }
+  }
+
+  if (!m_db.commit()) {
+    qCritical() << "Failed to commit deletion log removal" << m_db.lastError();
+    return false;
+  }
+
+  return true;
+}
+
+void FileIndexerDatabase::pruneDeletionLog(int64_t seq) {
+  QSqlQuery query(m_db);
+
+  query.prepare("DELETE FROM deleted_file WHERE seq <= :seq");
+  query.bindValue(":seq", static_cast<qlonglong>(seq));
+
+  if (!SqlProfiler::exec(query)) { qWarning() << "Failed to prune deletion log" << query.lastError(); }
+}
+
+static FileIndexerDatabase::IndexedName mapIndexedName(const QSqlQuery &query) {
+  return {.id = query.value(0).toLongLong(),
+          .name = query.value(1).toString().toStdString(),
+          .relevancyScore = query.value(2).toFloat()};
+}
+
+std::optional<FileIndexerDatabase::NameListing> FileIndexerDatabase::listIndexedNames() {
+  QSqlQuery query(m_db);
+  NameListing listing;
+
+  query.setForwardOnly(true);
+
+  // both reads have to see the same state of the database
+  if (!m_db.transaction()) {
+    qCritical() << "Failed to start transaction" << m_db.lastError();
+    return std::nullopt;
+  }
+
+  if (!SqlProfiler::exec(query, "SELECT COALESCE(MAX(seq), 0) FROM deleted_file") || !query.next()) {
+    qCritical() << "Failed to read deletion log" << query.lastError();
+    m_db.rollback();
+    return std::nullopt;
+  }
+
+  listing.lastDeletionSeq = query.value(0).toLongLong();
+
+  if (!SqlProfiler::exec(query, "SELECT id, name, relevancy_score FROM indexed_file")) {
+    qCritical() << "Failed to list indexed names" << query.lastError();
+    m_db.rollback();
+    return std::nullopt;
+  }
+
+  while (query.next()) {
+    IndexedName name = mapIndexedName(query);
+
+    listing.lastFileId = std::max(listing.lastFileId, name.id);
+    listing.files.emplace_back(std::move(name));
+  }
+
+  query.finish();
+  m_db.commit();
+
+  return listing;
+}
+
+std::optional<FileIndexerDatabase::FileChanges>
+FileIndexerDatabase::retrieveFileChanges(int64_t afterFileId, int64_t afterDeletionSeq,
+                                         size_t maxCount) const {
+  QSqlQuery query(m_db);
+  FileChanges changes{.lastFileId = afterFileId, .lastDeletionSeq = afterDeletionSeq};
+
+  query.setForwardOnly(true);
+
+  // additions first: a file added and deleted in between is seen as deleted, never as added only
+  query.prepare("SELECT id, name, relevancy_score FROM indexed_file WHERE id > :id ORDER BY id LIMIT :limit");
+  query.bindValue(":id", static_cast<qlonglong>(afterFileId));
+  query.bindValue(":limit", static_cast<qulonglong>(maxCount + 1));
+
+  if (!SqlProfiler::exec(query)) {
+    qWarning() << "Failed to retrieve added files" << query.lastError();
+    return std::nullopt;
+  }
+
+  while (query.next()) {
+    changes.added.emplace_back(mapIndexedName(query));
+    changes.lastFileId = changes.added.back().id;
+  }
+
+  query.prepare("SELECT seq, file_id FROM deleted_file WHERE seq > :seq ORDER BY seq LIMIT :limit");
+  query.bindValue(":seq", static_cast<qlonglong>(afterDeletionSeq));
+  query.bindValue(":limit", static_cast<qulonglong>(maxCount + 1));
+
+  if (!SqlProfiler::exec(query)) {
+    qWarning() << "Failed to retrieve deleted files" << query.lastError();
+    return std::nullopt;
+  }
+
+  while (query.next()) {
+    changes.lastDeletionSeq = query.value(0).toLongLong();
+    changes.deleted.emplace_back(query.value(1).toLongLong());
+  }
+
+  return changes;
+}
+
+std::vector<fs::path> FileIndexerDatabase::rankFiles(const std::vector<RankCandidate> &candidates,
+                                                     const Pagination &pagination,
+                                                     const std::function<bool()> &shouldStop) {
+  if (candidates.empty()) return {};
+
+  QSqlQuery query(m_db);
+  QString values;
+
+  query.setForwardOnly(true);
+
+  for (size_t i = 0; i != candidates.size(); ++i) {
+    if (i > 0) values += ", ";
+    values += "(?, ?)";
+  }
+
+  QString statement = QString(R"(
+	WITH clock(now) AS MATERIALIZED (SELECT unixepoch()),
+	candidate(id, match_score) AS (VALUES %1)
+	SELECT d.path || f.name, c.match_score * %2 AS score FROM clock
+	CROSS JOIN candidate c
+	JOIN indexed_file f ON f.id = c.id
+	JOIN directory d ON d.id = f.dir_id
+	LEFT JOIN file_open o ON o.path = d.path || f.name
+	ORDER BY score DESC
+	LIMIT ?
+	OFFSET ?
+  )")
+                          .arg(values)
+                          .arg(RelevancyScorer::metadataRankExpression());
+
+  if (!query.prepare(statement)) {
+    qWarning() << "Failed to prepare rank query" << query.lastError();
+    return {};
+  }
+
+  for (const auto &candidate : candidates) {
+    query.addBindValue(static_cast<qlonglong>(candidate.id));
+    query.addBindValue(candidate.matchScore);
+  }
+
+  query.addBindValue(pagination.limit);
+  query.addBindValue(pagination.offset);
+
+  if (!SqlProfiler::exec(query)) {
+    qWarning() << "Rank query failed" << query.lastError();
+    return {};
+  }
+
+  std::vector<fs::path> results;
+
+  results.reserve(pagination.limit);
+
+  while (query.next()) {
+    if (shouldStop && shouldStop()) break;
+
+    fs::path path = query.value(0).toString().toStdString();
+
+    if (fs::exists(path)) { results.emplace_back(path); }
+  }
+
+  return results;
+}
+
+FileIndexerDatabase::FileIndexerDatabase(OpenMode mode)
+    : m_connectionId(createRandomConnectionId()), m_mode(mode) {
+  m_db = QSqlDatabase::addDatabase("QSQLITE", m_connectionId);
+  m_db.setDatabaseName(getDatabasePath().c_str());
+
+  if (mode == OpenMode::ReadOnly) { m_db.setConnectOptions("QSQLITE_OPEN_READONLY"); }
+
+  if (!m_db.open()) {
+    qCritical() << "Failed to open datbase at" << getDatabasePath();
+    return;
+  }
+
+  execPragmas(mode == OpenMode::ReadOnly ? SQLITE_READ_ONLY_PRAGMAS : SQLITE_PRAGMAS);
+}
+
+FileIndexerDatabase::~FileIndexerDatabase() {
+  QString id = m_connectionId;
+
+  // read only connections are owned by search threads and destroyed when these threads exit,
+  // at which point there is no event loop left to process a deferred removal.
+  if (m_mode == OpenMode::ReadOnly) {
+    m_searchQuery.reset();
+    m_substringSearchQuery.reset();
+    m_contentSearchQuery.reset();
+    m_insertQuery.reset();
+    m_directoryQuery.reset();
+    m_db.close();
+    m_db = QSqlDatabase();
+    QSqlDatabase::removeDatabase(id);
+    return;
+  }
+
   // we need this to prevent a warning, although weirdly enough we don't have
   // any pending QSQLQuery by that point.
   QTimer::singleShot(0, [id]() { QSqlDatabase::removeDatabase(id); });
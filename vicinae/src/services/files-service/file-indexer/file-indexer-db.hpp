@@ -1,21 +1,62 @@
 #pragma once
 #include "services/files-service/abstract-file-indexer.hpp"
+#include "services/files-service/file-indexer/filesystem-walker.hpp"
 #include <expected>
 #include <qdatetime.h>
 #include <qobject.h>
 #include <qrandom.h>
 #include <qsqldatabase.h>
+#include <qsqlquery.h>
 #include <filesystem>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
 
 /**
  * File indexer sqlite database operations.
  * Note that each instance owns its own database connection, as a single
  * connection is not thread safe.
+ *
+ * Read only instances are meant to be long lived search connections: they are tuned for reads
+ * (memory mapped I/O, larger page cache) and keep their search statement prepared across queries.
  */
 
 class FileIndexerDatabase : public QObject {
+public:
+  enum class OpenMode { ReadWrite, ReadOnly };
+
+private:
   QSqlDatabase m_db;
   QString m_connectionId;
+  OpenMode m_mode;
+  std::optional<QSqlQuery> m_searchQuery;
+  std::optional<QSqlQuery> m_substringSearchQuery;
+  std::optional<QSqlQuery> m_contentSearchQuery;
+  // inserts `INSERT_ROWS_PER_STATEMENT` files at once
+  std::optional<QSqlQuery> m_insertQuery;
+  std::optional<QSqlQuery> m_directoryQuery;
+
+  /**
+   * Ids of the rows of the `directory` table, by path. Rows are never deleted, so that the ids cached by
+   * every connection remain valid: only a rolled back transaction makes the cache go out of date.
+   */
+  std::unordered_map<std::string, int64_t> m_directoryIds;
+
+  // whether a bulk load is in progress on this connection
+  bool m_bulkLoading = false;
+
+  bool prepareSearchQuery();
+  bool prepareSubstringSearchQuery();
+  bool prepareContentSearchQuery();
+  bool prepareInsertQuery();
+
+  /**
+   * Id of the directory at `path`, which ends with a separator, inserting it with all of its ancestors if
+   * it is not known yet.
+   */
+  std::optional<int64_t> resolveDirectoryId(std::string_view path);
+  bool execPragmas(const std::vector<std::string> &pragmas);
 
 public:
   enum class ScanType { Full, Incremental };
@@ -32,34 +73,217 @@ public:
     QDateTime createdAt;
     std::filesystem::path path;
     ScanType type;
+    // number of entries walked, set once the scan has finished
+    size_t indexedFileCount = 0;
   };
 
   ScanRecord mapScan(const QSqlQuery &query) const;
   static QString createRandomConnectionId();
   static std::filesystem::path getDatabasePath();
+  // size of the database file and of its write ahead log, in bytes
+  static size_t getDatabaseSize();
 
   std::vector<ScanRecord> listScans();
   std::optional<ScanRecord> getLastScan() const;
 
   std::vector<ScanRecord> listStartedScans();
+  std::optional<ScanRecord> getLastFinishedScan(const std::filesystem::path &entrypoint,
+                                                std::optional<ScanType> type = std::nullopt) const;
 
   bool updateScanStatus(int scanId, ScanStatus status);
   std::expected<ScanRecord, QString> createScan(const std::filesystem::path &path, ScanType type);
 
   bool setScanError(int scanId, const QString &error);
+  bool setScanIndexedFileCount(int scanId, size_t count);
+
+  struct IndexedDirectory {
+    std::filesystem::path path;
+    // not set if the directory has never been listed
+    std::optional<FileTimes> times;
+  };
 
   std::optional<QDateTime> retrieveIndexedLastModified(const std::filesystem::path &path) const;
   std::vector<std::filesystem::path> listIndexedDirectoryFiles(const std::filesystem::path &path) const;
 
+  std::optional<FileTimes> retrieveDirectoryTimes(const std::filesystem::path &path) const;
+  std::vector<IndexedDirectory> listIndexedSubdirectories(const std::filesystem::path &path) const;
+
+  /**
+   * Delete the indexed files at `paths`. Paths pointing to directories also have all the files below them
+   * deleted.
+   */
   void deleteIndexedFiles(const std::vector<std::filesystem::path> &paths);
-  void indexFiles(const std::vector<std::filesystem::path> &paths);
-  std::vector<std::filesystem::path> search(std::string_view searchQuery,
-                                            const AbstractFileIndexer::QueryParams &params);
+  /**
+   * Index `entries`, using the file times collected when they were walked.
+   * Directories are recorded as such. If `recordDirectoryTimes` is true, their times are stored as well,
+   * meaning that their content has been (or is about to be) indexed too.
+   */
+  void indexFiles(const std::vector<FileSystemEntry> &entries, bool recordDirectoryTimes = false);
+
+  /**
+   * Record that the files at `paths` have been opened by the user, which ranks them higher in searches.
+   */
+  void recordFileOpens(const std::vector<std::filesystem::path> &paths);
+
+  bool hasIndexedFiles() const;
+
+  /**
+   * Text content of a file, split into chunks, see `ContentExtractor`. Files without text content have no
+   * chunks, which still records that they were read.
+   */
+  struct FileContent {
+    std::filesystem::path path;
+    // modification time of the file when it was read, in seconds
+    int64_t lastModifiedAt = 0;
+    std::vector<QString> chunks;
+  };
+
+  /**
+   * Indexed files below `root` whose content was never read, or was read before they last changed, among the
+   * ones `filter` accepts.
+   */
+  std::vector<std::filesystem::path>
+  listStaleContentFiles(const std::filesystem::path &root,
+                        const std::function<bool(const std::filesystem::path &)> &filter) const;
+
+  /**
+   * Replace the content of the files in `contents`. Files that are no longer indexed are ignored.
+   */
+  void indexFileContents(const std::vector<FileContent> &contents);
+
+  /**
+   * Drop the content of the files that are not below any of `roots`.
+   */
+  void pruneFileContents(const std::vector<std::filesystem::path> &roots);
+
+  /**
+   * Whether the content of any file is indexed, in which case searches match file contents as well.
+   */
+  bool hasFileContents() const;
+
+  /**
+   * Number of segments the full text index is currently made of. Every write adds segments that are only
+   * merged over time, and queries get slower as they have to go through more of them.
+   */
+  std::optional<size_t> retrieveFtsSegmentCount() const;
+
+  /**
+   * Release the page cache of the connection, which fills up again as it is used.
+   */
+  void shrinkMemory();
+
+  /**
+   * Bulk load mode, meant to populate an empty index as fast as possible.
+   *
+   * The full text index is no longer maintained on every write, and gets rebuilt in one go when the
+   * bulk load ends. Durability is relaxed for the duration of the load on this connection: an interrupted
+   * load is restarted anyway. Searches keep working but can miss files until the load has ended.
+   *
+   * If the process exits during a bulk load, `recoverBulkLoad` ends it on next startup.
+   */
+  bool beginBulkLoad();
+  bool endBulkLoad();
+  void recoverBulkLoad();
+
+  /**
+   * Optional trigram index of the file names, which lets queries match anywhere in a name ("shot" matches
+   * "screenshot.png") instead of only at the start of its words. It is about a fifth of the size of the
+   * rest of the database, and substring queries are a few times slower than prefix ones.
+   *
+   * Creating the index reads the whole content table, which can take a few seconds on large indexes.
+   */
+  bool hasSubstringIndex() const;
+  bool createSubstringIndex();
+  bool dropSubstringIndex();
+
+  struct IndexedName {
+    int64_t id;
+    std::string name;
+    float relevancyScore;
+  };
+
+  /**
+   * Log of the ids of deleted files, maintained by a trigger, which lets `FilenameIndex` find out which of
+   * the files it knows about have been deleted since it last looked. Only exists while the filename index
+   * is enabled.
+   */
+  bool hasDeletionLog() const;
+  bool createDeletionLog();
+  bool dropDeletionLog();
+  // forget about the deletions up to `seq` included
+  void pruneDeletionLog(int64_t seq);
+
+  struct NameListing {
+    std::vector<IndexedName> files;
+    // the listing includes every file up to this id, and every deletion up to this log position
+    int64_t lastFileId = 0;
+    int64_t lastDeletionSeq = 0;
+  };
+
+  std::optional<NameListing> listIndexedNames();
+
+  struct FileChanges {
+    std::vector<IndexedName> added;
+    std::vector<int64_t> deleted;
+    int64_t lastFileId = 0;
+    int64_t lastDeletionSeq = 0;
+  };
+
+  /**
+   * Files added after `afterFileId` and deleted after `afterDeletionSeq`, up to `maxCount + 1` of each,
+   * so that callers can tell when there are more than they want.
+   */
+  std::optional<FileChanges> retrieveFileChanges(int64_t afterFileId, int64_t afterDeletionSeq,
+                                                 size_t maxCount) const;
+
+  struct RankCandidate {
+    int64_t id;
+    // rank of the match itself, higher being better
+    double matchScore;
+  };
+
+  /**
+   * Rank files that were already matched, as `search` does, without going through the full text index.
+   * Returns the paths of the files in the requested page.
+   */
+  std::vector<std::filesystem::path> rankFiles(const std::vector<RankCandidate> &candidates,
+                                               const Pagination &pagination,
+                                               const std::function<bool()> &shouldStop = {});
+
+  /**
+   * FTS5 expressions of a single search.
+   *
+   * `substring` is matched against the substring index when it is not empty and the index exists, names
+   * that also match `prefix` being ranked first. Otherwise, `prefix` is matched against the prefix index,
+   * and against the content index if file contents are indexed.
+   */
+  struct SearchQuery {
+    QString prefix;
+    QString substring;
+  };
+
+  using ChunkHandler = std::function<void(std::vector<std::filesystem::path> chunk)>;
+
+  // the first chunk is what the user sees first, it is kept small so that it comes quickly
+  static constexpr size_t FIRST_SEARCH_CHUNK_SIZE = 20;
+  static constexpr size_t SEARCH_CHUNK_SIZE = 100;
+
+  /**
+   * `shouldStop` is polled while results are collected, in which case the ones collected so far
+   * are returned.
+   *
+   * If `onChunk` is set, results are passed to it in chunks as they are read from the database instead of
+   * being returned: a first one of `FIRST_SEARCH_CHUNK_SIZE` results, then ones of `SEARCH_CHUNK_SIZE`.
+   */
+  std::vector<std::filesystem::path> search(const SearchQuery &searchQuery,
+                                            const AbstractFileIndexer::QueryParams &params,
+                                            const std::function<bool()> &shouldStop = {},
+                                            const ChunkHandler &onChunk = {});
 
   void runMigrations();
 
   QSqlDatabase *database();
 
-  FileIndexerDatabase();
+  FileIndexerDatabase(OpenMode mode = OpenMode::ReadWrite);
   ~FileIndexerDatabase();
 };
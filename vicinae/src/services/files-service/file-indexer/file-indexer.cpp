@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstdlib>
 #include <filesystem>
 #include <mutex>
@@ -6,6 +7,9 @@
 #include "file-indexer-db.hpp"
 #include "file-indexer.hpp"
 #include "utils/utils.hpp"
+#include "lib/text-tokenizer.hpp"
+#include "search-profiler/search-profiler.hpp"
+#include "trace/trace.hpp"
 #include <QDebug>
 #include <qcryptographichash.h>
 #include <qfilesystemwatcher.h>
@@ -15,6 +19,8 @@
 #include <qsqlquery.h>
 #include <QSqlError>
 #include <qthreadpool.h>
+#include <qthreadstorage.h>
+#include <latch>
 #include <ranges>
 #include <thread>
 #include <unistd.h>
@@ -38,8 +44,12 @@ void WriterWorker::stop() {
 void WriterWorker::run() {
   db = std::make_unique<FileIndexerDatabase>();
 
+  IndexerScheduler::Mode mode = m_scheduler.mode();
+
+  m_scheduler.applyToCurrentThread();
+
   while (m_alive) {
-    std::deque<std::vector<std::filesystem::path>> batch;
+    std::deque<IndexerScanner::WriteBatch> batch;
 
     {
       std::unique_lock<std::mutex> lock(batchMutex);
@@ -49,20 +59,123 @@ void WriterWorker::run() {
       batchQueue.clear();
     }
 
-    for (const auto &paths : batch) {
-      batchWrite(paths);
+    m_drainCv.notify_all();
+
+    if (m_scheduler.mode() != mode) {
+      mode = m_scheduler.mode();
+      m_scheduler.applyToCurrentThread();
+    }
+
+    for (const auto &write : batch) {
+      batchWrite(write);
     }
   }
 }
 
-void WriterWorker::batchWrite(const std::vector<fs::path> &paths) {
+void WriterWorker::batchWrite(const IndexerScanner::WriteBatch &batch) {
+  using namespace std::chrono;
+
+  TraceScope trace("indexer", "write batch");
+
+  auto startedAt = steady_clock::now();
+  auto elapsed = [&]() { return duration_cast<microseconds>(steady_clock::now() - startedAt); };
+
   // Writing is happening in the writerThread
-  db->indexFiles(paths);
+  switch (batch.kind) {
+  case IndexerScanner::WriteBatch::Kind::Index: {
+    db->indexFiles(batch.entries, batch.recordDirectoryTimes);
+
+    auto duration = elapsed();
+
+    m_metrics.recordWrite(duration);
+    m_scheduler.recordWrite(batch.entries.size(), duration);
+    syncFilenameIndex();
+    // scans have the content of their whole tree refreshed once they are written
+    if (!batch.recordDirectoryTimes) m_contentIndexer.refreshFiles(batch.entries);
+    break;
+  }
+  case IndexerScanner::WriteBatch::Kind::Delete:
+    db->deleteIndexedFiles(batch.paths);
+    m_metrics.recordWrite(elapsed());
+    syncFilenameIndex();
+    break;
+  case IndexerScanner::WriteBatch::Kind::RecordOpen:
+    db->recordFileOpens(batch.paths);
+    break;
+  case IndexerScanner::WriteBatch::Kind::IndexContent:
+    db->indexFileContents(batch.contents);
+    m_metrics.recordWrite(elapsed());
+    break;
+  case IndexerScanner::WriteBatch::Kind::RefreshContent:
+    for (const auto &path : batch.paths) {
+      m_contentIndexer.refreshTree(path);
+    }
+    break;
+  case IndexerScanner::WriteBatch::Kind::PruneContent:
+    db->pruneFileContents(batch.paths);
+    break;
+  case IndexerScanner::WriteBatch::Kind::BeginBulkLoad:
+    m_bulkLoading = db->beginBulkLoad();
+    break;
+  case IndexerScanner::WriteBatch::Kind::EndBulkLoad:
+    db->endBulkLoad();
+    m_bulkLoading = false;
+    // the whole index changed, there is no point in pulling the changes one by one
+    if (m_filenameIndex.enabled()) m_filenameIndex.rewrite(*db);
+    break;
+  case IndexerScanner::WriteBatch::Kind::CreateSubstringIndex:
+    db->createSubstringIndex();
+    break;
+  case IndexerScanner::WriteBatch::Kind::DropSubstringIndex:
+    db->dropSubstringIndex();
+    break;
+  case IndexerScanner::WriteBatch::Kind::RewriteFilenameIndex:
+    // written once the bulk load ends
+    if (!m_bulkLoading) m_filenameIndex.rewrite(*db);
+    break;
+  case IndexerScanner::WriteBatch::Kind::DropFilenameIndex:
+    m_filenameIndex.drop(*db);
+    break;
+  case IndexerScanner::WriteBatch::Kind::ShrinkMemory:
+    // the larger cache of a bulk load is still needed
+    if (!m_bulkLoading) db->shrinkMemory();
+    break;
+  }
 }
 
-WriterWorker::WriterWorker(std::mutex &batchMutex, std::deque<std::vector<std::filesystem::path>> &batchQueue,
-                           std::condition_variable &batchCv)
-    : batchMutex(batchMutex), batchQueue(batchQueue), m_batchCv(batchCv) {}
+void WriterWorker::syncFilenameIndex() {
+  if (m_bulkLoading || !m_filenameIndex.enabled()) return;
+
+  auto deltaSize = m_filenameIndex.sync(*db);
+  bool tooLarge = deltaSize && *deltaSize >= FilenameIndex::SNAPSHOT_REWRITE_THRESHOLD;
+
+  if (tooLarge || m_filenameIndex.needsRewrite()) {
+    m_filenameIndex.rewrite(*db);
+  }
+}
+
+WriterWorker::WriterWorker(std::mutex &batchMutex, std::deque<IndexerScanner::WriteBatch> &batchQueue,
+                           std::condition_variable &batchCv, std::condition_variable &drainCv,
+                           IndexerMetrics &metrics, IndexerScheduler &scheduler, FilenameIndex &filenameIndex,
+                           ContentIndexer &contentIndexer)
+    : batchMutex(batchMutex), batchQueue(batchQueue), m_batchCv(batchCv), m_drainCv(drainCv),
+      m_metrics(metrics), m_scheduler(scheduler), m_filenameIndex(filenameIndex),
+      m_contentIndexer(contentIndexer) {}
+
+/**
+ * Read only connection owned by the calling search thread, created on first use.
+ * Search threads never expire, so the connection lives as long as the indexer does.
+ */
+static FileIndexerDatabase &searchConnection() {
+  // deletes the connection when the thread exits, while Qt's own thread data is still alive
+  static QThreadStorage<FileIndexerDatabase *> connections;
+
+  if (!connections.hasLocalData()) {
+    connections.setLocalData(new FileIndexerDatabase(FileIndexerDatabase::OpenMode::ReadOnly));
+  }
+
+  return *connections.localData();
+}
 
 void FileIndexer::startFullscan() {
   for (const auto &entrypoint : m_entrypoints) {
@@ -72,9 +185,25 @@ void FileIndexer::startFullscan() {
 
 void FileIndexer::rebuildIndex() { startFullscan(); }
 
+void FileIndexer::setScanThreadCount(size_t count) { m_scanner->setScanThreadCount(count); }
+
+void FileIndexer::setSchedulingMode(IndexerScheduler::Mode mode) { m_scanner->setSchedulingMode(mode); }
+
+void FileIndexer::setMaxWatchCount(size_t count) { m_eventWatcher->setMaxWatchCount(count); }
+
+void FileIndexer::setSubstringSearch(bool enabled) { m_scanner->enqueueSubstringIndex(enabled); }
+
+void FileIndexer::setFilenameIndex(bool enabled) { m_scanner->setFilenameIndexEnabled(enabled); }
+
 void FileIndexer::start() {
   auto lastScan = m_db.getLastScan();
 
+  m_started = true;
+
+  // changes made while we were not running are picked up by the scans below
+  m_eventWatcher->start(m_entrypoints | std::views::transform([](auto &&e) { return e.root; }) |
+                        std::ranges::to<std::vector>());
+
   // this is our first scan
   if (!lastScan) {
     qInfo() << "This is our first startup, enqueuing a full scan...";
@@ -101,55 +230,261 @@ void FileIndexer::start() {
   }
 }
 
-void FileIndexer::setEntrypoints(const std::vector<Entrypoint> &entrypoints) { m_entrypoints = entrypoints; }
+void FileIndexer::recordFileOpen(const fs::path &path) { m_scanner->enqueueFileOpen(path); }
+
+void FileIndexer::setEntrypoints(const std::vector<Entrypoint> &entrypoints) {
+  auto contentRoots = [](const std::vector<Entrypoint> &entrypoints) {
+    return entrypoints | std::views::filter([](auto &&e) { return e.indexContent; }) |
+           std::views::transform([](auto &&e) { return e.root; }) | std::ranges::to<std::vector>();
+  };
+  auto previousRoots = contentRoots(m_entrypoints);
+  auto roots = contentRoots(entrypoints);
+
+  m_entrypoints = entrypoints;
+  m_scanner->setContentRoots(roots);
+
+  // the scans made on startup take care of the content roots known by then
+  if (!m_started) return;
+
+  for (const auto &root : roots) {
+    if (!std::ranges::contains(previousRoots, root)) m_scanner->enqueueContentRefresh(root);
+  }
+}
+
+IndexerStats FileIndexer::stats() const {
+  using namespace std::chrono;
+
+  const IndexerMetrics &metrics = m_scanner->metrics();
+  IndexerScanner::Progress progress = m_scanner->progress();
+  IndexerStats stats;
+
+  stats.filesPerSecond = progress.filesPerSecond;
+  stats.walkedFileCount = metrics.walkedFileCount;
+  stats.queuedBatchCount = progress.queuedBatchCount;
+  stats.writtenBatchCount = metrics.writtenBatchCount;
+  stats.lastBatchWriteTime = microseconds(metrics.lastWriteTimeUs.load());
+  stats.maxBatchWriteTime = microseconds(metrics.maxWriteTimeUs.load());
+  stats.backpressureWaitTime = milliseconds(metrics.backpressureWaitTimeMs.load());
+  stats.databaseSize = FileIndexerDatabase::getDatabaseSize();
+  stats.ftsSegmentCount = m_db.retrieveFtsSegmentCount();
+
+  if (stats.writtenBatchCount > 0) {
+    int64_t batchCount = stats.writtenBatchCount;
+    stats.averageBatchWriteTime = microseconds(metrics.totalWriteTimeUs.load() / batchCount);
+  }
+
+  for (const auto &entrypoint : m_entrypoints) {
+    IndexerStats::Entrypoint ep{.root = entrypoint.root};
+    auto isEntrypoint = [&](const IndexerScanner::EnqueuedScan &scan) { return scan.path == ep.root; };
+    std::optional<FileIndexerDatabase::ScanType> type;
+
+    if (progress.current && isEntrypoint(*progress.current)) {
+      ep.state = IndexerStats::Entrypoint::State::Scanning;
+      ep.walkedFileCount = progress.walkedFileCount;
+      type = progress.current->type;
+    } else if (auto it = std::ranges::find_if(progress.pending, isEntrypoint); it != progress.pending.end()) {
+      ep.state = IndexerStats::Entrypoint::State::Queued;
+      type = it->type;
+    }
+
+    if (auto scan = m_db.getLastFinishedScan(ep.root)) { ep.lastScannedAt = scan->createdAt; }
+
+    // incremental scans skip the content of unchanged directories, only compare scans of the same kind
+    if (auto scan = type ? m_db.getLastFinishedScan(ep.root, *type) : std::nullopt) {
+      ep.expectedFileCount = scan->indexedFileCount;
+    }
+
+    stats.entrypoints.emplace_back(std::move(ep));
+  }
+
+  return stats;
+}
 
 QString FileIndexer::preparePrefixSearchQuery(std::string_view query) const {
+  QString normalized;
+  std::vector<TextSpan> tokens;
   QString finalQuery;
 
-  for (const auto &word : std::views::split(query, std::string_view(" "))) {
-    std::string_view view(word);
+  // the FTS table is tokenized by unicode61, which does not split on case changes
+  TextTokenizer::tokenize(qStringFromStdView(query), normalized, tokens, {.splitCamelCase = false});
 
+  for (const auto &token : tokens) {
     if (!finalQuery.isEmpty()) { finalQuery += ' '; }
 
-    finalQuery += QString("\"%1\"").arg(qStringFromStdView(view));
+    finalQuery += '"';
+    finalQuery += QStringView(normalized).mid(token.offset, token.length);
+    finalQuery += '"';
   }
 
-  finalQuery += '*';
+  if (!finalQuery.isEmpty()) { finalQuery += '*'; }
+
+  return finalQuery;
+}
+
+QString FileIndexer::prepareSubstringSearchQuery(std::string_view query) const {
+  static constexpr uint32_t MIN_TRIGRAM_TOKEN_LENGTH = 3;
+  QString text = qStringFromStdView(query);
+  QString normalized;
+  std::vector<TextSpan> tokens;
+  QString finalQuery;
+
+  // the trigram tokenizer does not strip diacritics, unlike the query normalization
+  if (std::ranges::any_of(text, [](QChar c) { return c.unicode() > 0x7F; })) return {};
+
+  TextTokenizer::tokenize(text, normalized, tokens, {.splitCamelCase = false});
+
+  for (const auto &token : tokens) {
+    // shorter tokens cannot be looked up in a trigram index
+    if (token.length < MIN_TRIGRAM_TOKEN_LENGTH) return {};
+    if (!finalQuery.isEmpty()) { finalQuery += ' '; }
+
+    finalQuery += '"';
+    finalQuery += QStringView(normalized).mid(token.offset, token.length);
+    finalQuery += '"';
+  }
 
   return finalQuery;
 }
 
 QFuture<std::vector<IndexerFileResult>> FileIndexer::queryAsync(std::string_view view,
                                                                 const QueryParams &params) const {
-  auto searchQuery = qStringFromStdView(view);
-  QString finalQuery = preparePrefixSearchQuery(view);
+  return submitQuery(view, params, false);
+}
+
+QFuture<std::vector<IndexerFileResult>> FileIndexer::queryStreamAsync(std::string_view view,
+                                                                      const QueryParams &params) const {
+  return submitQuery(view, params, true);
+}
+
+std::shared_ptr<std::atomic<uint64_t>> FileIndexer::searchGeneration(const std::string &consumer) const {
+  std::lock_guard lock(m_searchGenerationMutex);
+  auto &generation = m_searchGenerations[consumer];
+
+  if (!generation) { generation = std::make_shared<std::atomic<uint64_t>>(0); }
+
+  return generation;
+}
+
+QFuture<std::vector<IndexerFileResult>> FileIndexer::submitQuery(std::string_view view,
+                                                                 const QueryParams &params,
+                                                                 bool stream) const {
+  FileIndexerDatabase::SearchQuery searchQuery{.prefix = preparePrefixSearchQuery(view),
+                                                .substring = prepareSubstringSearchQuery(view)};
   QPromise<std::vector<IndexerFileResult>> promise;
   auto future = promise.future();
+  auto latestGeneration = searchGeneration(params.consumer);
+  uint64_t generation = ++*latestGeneration;
 
-  QThreadPool::globalInstance()->start([params, finalQuery, promise = std::move(promise)]() mutable {
-    std::vector<fs::path> paths;
-    {
-      FileIndexerDatabase db;
-      paths = db.search(finalQuery.toStdString(), params);
+  // nothing searchable in the query (only punctuation or whitespace)
+  if (searchQuery.prefix.isEmpty()) {
+    promise.addResult(std::vector<IndexerFileResult>{});
+    promise.finish();
+    return future;
+  }
+
+  std::optional<std::chrono::steady_clock::time_point> deadline;
+
+  if (params.timeout) { deadline = std::chrono::steady_clock::now() + *params.timeout; }
+
+  m_searchPool.start([this, latestGeneration, generation, deadline, params, searchQuery, stream, query = std::string(view),
+                      promise = std::move(promise)]() mutable {
+    auto isCanceled = [&]() { return promise.isCanceled() || *latestGeneration != generation; };
+    SearchProfiler::Scope profile("files");
+
+    // a newer query was submitted while this one was waiting for a search thread
+    if (isCanceled()) {
+      profile.discard();
+      promise.future().cancel();
+      promise.finish();
+      return;
+    }
+
+    auto shouldStop = [&]() {
+      return isCanceled() || (deadline && std::chrono::steady_clock::now() >= *deadline);
+    };
+    auto toResults = [](const std::vector<fs::path> &paths) {
+      return paths | std::views::transform([](auto &&path) { return IndexerFileResult{.path = path}; }) |
+             std::ranges::to<std::vector>();
+    };
+    size_t resultCount = 0;
+    size_t chunkCount = 0;
+    FileIndexerDatabase::ChunkHandler onChunk;
+
+    // chunks of a stale query are not worth reporting, the view has moved on
+    if (stream) {
+      onChunk = [&](std::vector<fs::path> chunk) {
+        if (isCanceled()) return;
+        resultCount += chunk.size();
+        ++chunkCount;
+        promise.addResult(toResults(chunk));
+      };
+    }
+
+    FileIndexerDatabase &db = searchConnection();
+    FilenameIndex &filenameIndex = m_scanner->filenameIndex();
+    // matches come from memory all at once, they are only ranked by the database
+    std::optional<std::vector<fs::path>> paths;
+
+    // the filename index knows nothing about the content of files
+    if (!db.hasFileContents()) paths = filenameIndex.search(db, query, params, shouldStop);
+
+    if (!paths) {
+      if (filenameIndex.needsRewrite()) m_scanner->requestFilenameIndexRewrite();
+      paths = db.search(searchQuery, params, shouldStop, onChunk);
     }
-    std::vector<IndexerFileResult> results =
-        paths | std::views::transform([](auto &&path) { return IndexerFileResult{.path = path}; }) |
-        std::ranges::to<std::vector>();
 
-    promise.addResult(results);
+    if (isCanceled()) {
+      profile.discard();
+      promise.future().cancel();
+      promise.finish();
+      return;
+    }
+
+    resultCount += paths->size();
+    profile.setResultCount(resultCount);
+
+    if (!paths->empty() || chunkCount == 0) promise.addResult(toResults(*paths));
+
     promise.finish();
   });
 
   return future;
 }
 
+void FileIndexer::shrinkMemory() {
+  m_db.shrinkMemory();
+  m_scanner->enqueueShrinkMemory();
+
+  // connections are owned by the search threads, every one of them has to run a task for its connection.
+  // The tasks wait for each other so that none of the threads runs two of them.
+  auto started = std::make_shared<std::latch>(SEARCH_CONNECTION_COUNT);
+
+  for (int i = 0; i != SEARCH_CONNECTION_COUNT; ++i) {
+    m_searchPool.start([started]() {
+      searchConnection().shrinkMemory();
+      started->arrive_and_wait();
+    });
+  }
+}
+
 FileIndexer::FileIndexer() {
+  m_searchPool.setMaxThreadCount(SEARCH_CONNECTION_COUNT);
+  m_searchPool.setExpiryTimeout(-1);
   m_db.runMigrations();
+  m_db.recoverBulkLoad();
+
+  // enabled by a previous run, which left a snapshot that cannot be used
+  if (!m_scanner->filenameIndex().load(m_db) && m_scanner->filenameIndex().enabled()) {
+    m_scanner->requestFilenameIndexRewrite();
+  }
+
   // m_homeWatcher = std::make_unique<HomeDirectoryWatcher>(*m_scanner.get());
   m_scannerThread = std::thread([&]() { m_scanner->run(); });
 }
 
 FileIndexer::~FileIndexer() {
+  // the watcher writes through the scanner, so it has to go first
+  m_eventWatcher->stop();
   m_scanner->stop();
   m_scannerThread.join();
 }
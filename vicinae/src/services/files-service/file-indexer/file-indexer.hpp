@@ -3,36 +3,50 @@
 #include <condition_variable>
 #include <cstdlib>
 #include <filesystem>
+#include <memory>
 #include <mutex>
 #include <qfilesystemwatcher.h>
 #include <qobject.h>
 #include <qsqlquery.h>
 #include <qthread.h>
+#include <qthreadpool.h>
 #include "common.hpp"
 #include "services/files-service/abstract-file-indexer.hpp"
 #include "services/files-service/file-indexer/indexer-scanner.hpp"
 #include "services/files-service/file-indexer/home-directory-watcher.hpp"
+#include "services/files-service/file-indexer/filesystem-event-watcher.hpp"
 #include "services/files-service/file-indexer/file-indexer-db.hpp"
 #include <malloc.h>
 #include <qdatetime.h>
 #include <qsqldatabase.h>
 #include <qtmetamacros.h>
+#include <string>
+#include <unordered_map>
 
 class WriterWorker : public NonCopyable {
   std::unique_ptr<FileIndexerDatabase> db;
   std::mutex &batchMutex;
-  std::deque<std::vector<std::filesystem::path>> &batchQueue;
+  std::deque<IndexerScanner::WriteBatch> &batchQueue;
   std::condition_variable &m_batchCv;
+  std::condition_variable &m_drainCv;
+  IndexerMetrics &m_metrics;
+  IndexerScheduler &m_scheduler;
+  FilenameIndex &m_filenameIndex;
+  ContentIndexer &m_contentIndexer;
   std::atomic<bool> m_alive = true;
+  bool m_bulkLoading = false;
 
-  void batchWrite(const std::vector<std::filesystem::path> &paths);
+  void batchWrite(const IndexerScanner::WriteBatch &batch);
+  // pull the changes that were just written into the filename index, writing a new snapshot if needed
+  void syncFilenameIndex();
 
 public:
   void run();
   void stop();
 
-  WriterWorker(std::mutex &batchMutex, std::deque<std::vector<std::filesystem::path>> &batchQueue,
-               std::condition_variable &batchCv);
+  WriterWorker(std::mutex &batchMutex, std::deque<IndexerScanner::WriteBatch> &batchQueue,
+               std::condition_variable &batchCv, std::condition_variable &drainCv, IndexerMetrics &metrics,
+               IndexerScheduler &scheduler, FilenameIndex &filenameIndex, ContentIndexer &contentIndexer);
 };
 
 /**
@@ -41,25 +55,69 @@ public:
  * filesystem if necessary.
  * Queries usually remain very fast (<100ms), although not fast enough to perform them in the UI thread
  * without introducing slowdowns.
+ *
+ * Queries run on a dedicated pool of search threads that never expire, each of them owning a long lived
+ * read only connection (see `FileIndexerDatabase::OpenMode::ReadOnly`). Qt SQL connections can only be
+ * used from the thread that created them, so tying connections to threads is what makes them reusable.
+ *
+ * When the filename index is enabled, queries are answered from memory first, the database only being
+ * used to rank the best matches with the metadata it has. Files whose content is indexed (see
+ * `ContentIndexer`) can only be matched by the database, which then answers all queries.
  */
 class FileIndexer : public AbstractFileIndexer {
   Q_OBJECT
 
   std::vector<Entrypoint> m_entrypoints;
+  bool m_started = false;
   FileIndexerDatabase m_db;
   std::shared_ptr<IndexerScanner> m_scanner = std::make_shared<IndexerScanner>();
   std::thread m_scannerThread;
   std::unique_ptr<HomeDirectoryWatcher> m_homeWatcher;
+  // applies changes as they are reported by the kernel, which makes periodic rescans unnecessary
+  std::unique_ptr<FileSystemEventWatcher> m_eventWatcher =
+      std::make_unique<FileSystemEventWatcher>(*m_scanner);
+
+  static constexpr int SEARCH_CONNECTION_COUNT = 2;
+  // bumped for every query submitted by a consumer, so that its stale ones can bail out
+  mutable std::mutex m_searchGenerationMutex;
+  mutable std::unordered_map<std::string, std::shared_ptr<std::atomic<uint64_t>>> m_searchGenerations;
+  mutable QThreadPool m_searchPool;
+
+  std::shared_ptr<std::atomic<uint64_t>> searchGeneration(const std::string &consumer) const;
 
   // move that somewhere else later
   QString preparePrefixSearchQuery(std::string_view query) const;
+  // empty if the query cannot be matched as a substring
+  QString prepareSubstringSearchQuery(std::string_view query) const;
+  // results are reported in chunks if `stream` is set, see `queryStreamAsync`
+  QFuture<std::vector<IndexerFileResult>> submitQuery(std::string_view view, const QueryParams &params,
+                                                      bool stream) const;
 
 public:
   void startFullscan();
   void rebuildIndex() override;
+  void setScanThreadCount(size_t count);
+  void setSchedulingMode(IndexerScheduler::Mode mode);
+  void setMaxWatchCount(size_t count);
+  /**
+   * Maintain a trigram index of the file names, so that queries made of tokens of at least 3 characters
+   * match anywhere in names instead of only at the start of words. See
+   * `FileIndexerDatabase::createSubstringIndex`. The setting is persisted by the database itself.
+   */
+  void setSubstringSearch(bool enabled);
+  /**
+   * Answer queries from an in-memory index of the file names when possible, see `FilenameIndex`.
+   * The setting is persisted by the index snapshot.
+   */
+  void setFilenameIndex(bool enabled);
   void setEntrypoints(const std::vector<Entrypoint> &entrypoints) override;
+  IndexerStats stats() const override;
+  void shrinkMemory() override;
+  void recordFileOpen(const std::filesystem::path &path) override;
   QFuture<std::vector<IndexerFileResult>> queryAsync(std::string_view view,
                                                      const QueryParams &params = {}) const override;
+  QFuture<std::vector<IndexerFileResult>> queryStreamAsync(std::string_view view,
+                                                           const QueryParams &params = {}) const override;
   void start() override;
 
   FileIndexer();
@@ -0,0 +1,756 @@
+#include "services/files-service/file-indexer/filename-index.hpp"
+#include "lib/text-tokenizer.hpp"
+#include "vicinae.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <qlogging.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+
+struct FilenameSnapshot::Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t nameCount;
+  uint32_t fileCount;
+  uint32_t gramCount;
+  int64_t lastFileId;
+  int64_t lastDeletionSeq;
+  uint64_t poolSize;
+  uint64_t postingsSize;
+};
+
+struct FilenameSnapshot::Gram {
+  uint32_t key;
+  // number of names containing the trigram
+  uint32_t count;
+  uint64_t offset;
+};
+
+static constexpr char SNAPSHOT_MAGIC[8] = {'V', 'C', 'N', 'F', 'I', 'D', 'X', '\0'};
+// names where a query token starts a word rank this much higher, per token
+static constexpr double WORD_START_MATCH_BOOST = 2.0;
+// rank penalty per character of the name that is not part of a token, so that closer matches rank higher
+static constexpr double UNMATCHED_CHARACTER_PENALTY = 0.05;
+static constexpr size_t MIN_CANDIDATE_COUNT = 400;
+static constexpr size_t TRIGRAM_SIZE = 3;
+// size of a trigram entry in a snapshot
+static constexpr size_t GRAM_SIZE = 16;
+static constexpr auto REWRITE_RETRY_DELAY = std::chrono::minutes(5);
+
+/**
+ * Offsets of the sections of a snapshot, each of them aligned on 8 bytes:
+ * header, bucket offsets, name pool, trigrams, postings, name files, file ids, file scores.
+ */
+struct SnapshotLayout {
+  size_t bucketOffsets;
+  size_t pool;
+  size_t grams;
+  size_t postings;
+  size_t nameFiles;
+  size_t fileIds;
+  size_t fileScores;
+  size_t size;
+};
+
+static size_t align8(size_t offset) { return (offset + 7) & ~size_t(7); }
+
+static uint32_t bucketCount(uint32_t nameCount) {
+  return (nameCount + FilenameSnapshot::NAME_BUCKET_SIZE - 1) / FilenameSnapshot::NAME_BUCKET_SIZE;
+}
+
+static SnapshotLayout computeLayout(uint32_t nameCount, uint32_t fileCount, uint32_t gramCount,
+                                    uint64_t poolSize, uint64_t postingsSize, size_t headerSize) {
+  SnapshotLayout layout;
+
+  layout.bucketOffsets = align8(headerSize);
+  layout.pool = align8(layout.bucketOffsets + bucketCount(nameCount) * sizeof(uint32_t));
+  layout.grams = align8(layout.pool + poolSize);
+  layout.postings = layout.grams + static_cast<size_t>(gramCount) * GRAM_SIZE;
+  layout.nameFiles = align8(layout.postings + postingsSize);
+  layout.fileIds = align8(layout.nameFiles + (static_cast<size_t>(nameCount) + 1) * sizeof(uint32_t));
+  layout.fileScores = layout.fileIds + static_cast<size_t>(fileCount) * sizeof(int64_t);
+  layout.size = layout.fileScores + static_cast<size_t>(fileCount) * sizeof(float);
+
+  return layout;
+}
+
+static void appendVarint(std::string &out, uint64_t value) {
+  while (value >= 0x80) {
+    out += static_cast<char>((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+
+  out += static_cast<char>(value);
+}
+
+static std::optional<uint64_t> readVarint(const uint8_t *&p, const uint8_t *end) {
+  uint64_t value = 0;
+
+  for (int shift = 0; shift < 64 && p < end; shift += 7) {
+    uint8_t byte = *p++;
+
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return value;
+  }
+
+  return std::nullopt;
+}
+
+static uint32_t gramKey(const char *s) {
+  auto byte = [&](int i) { return static_cast<uint32_t>(static_cast<uint8_t>(s[i])); };
+
+  return (byte(0) << 16) | (byte(1) << 8) | byte(2);
+}
+
+template <typename T>
+static void writeSection(std::ofstream &ofs, size_t offset, const T *data, size_t count) {
+  // pad up to the aligned section start
+  static const char PADDING[8] = {};
+  auto position = static_cast<size_t>(ofs.tellp());
+
+  if (offset > position) ofs.write(PADDING, offset - position);
+  if (count > 0) ofs.write(reinterpret_cast<const char *>(data), count * sizeof(T));
+}
+
+bool FilenameSnapshot::write(const fs::path &path, std::vector<File> files, int64_t lastFileId,
+                             int64_t lastDeletionSeq) {
+  static_assert(sizeof(Gram) == GRAM_SIZE && sizeof(Header) % 8 == 0);
+
+  // files of the same name are sorted by decreasing score, which lets searches skip the worst ones
+  std::ranges::sort(files, [](const File &a, const File &b) {
+    if (a.name != b.name) return a.name < b.name;
+    return a.score > b.score;
+  });
+
+  std::vector<std::string_view> names;
+  std::vector<uint32_t> nameFiles;
+
+  for (size_t i = 0; i != files.size(); ++i) {
+    if (names.empty() || names.back() != files[i].name) {
+      names.emplace_back(files[i].name);
+      nameFiles.emplace_back(i);
+    }
+  }
+
+  nameFiles.emplace_back(files.size());
+
+  std::string pool;
+  std::vector<uint32_t> bucketOffsets;
+
+  for (size_t i = 0; i != names.size(); ++i) {
+    std::string_view name = names[i];
+
+    if (i % NAME_BUCKET_SIZE == 0) {
+      bucketOffsets.emplace_back(pool.size());
+      appendVarint(pool, name.size());
+      pool += name;
+      continue;
+    }
+
+    std::string_view previous = names[i - 1];
+    size_t shared = std::ranges::mismatch(name, previous).in1 - name.begin();
+
+    appendVarint(pool, shared);
+    appendVarint(pool, name.size() - shared);
+    pool += name.substr(shared);
+  }
+
+  if (pool.size() > UINT32_MAX) {
+    qWarning() << "Too many file names to write a filename index snapshot";
+    return false;
+  }
+
+  // names are visited in order, which keeps every posting list sorted
+  std::unordered_map<uint32_t, std::vector<uint32_t>> postingLists;
+
+  for (uint32_t i = 0; i != names.size(); ++i) {
+    std::string_view name = names[i];
+
+    for (size_t j = 0; j + TRIGRAM_SIZE <= name.size(); ++j) {
+      auto &list = postingLists[gramKey(name.data() + j)];
+
+      if (list.empty() || list.back() != i) list.emplace_back(i);
+    }
+  }
+
+  std::vector<uint32_t> keys;
+
+  keys.reserve(postingLists.size());
+  for (const auto &[key, list] : postingLists) {
+    keys.emplace_back(key);
+  }
+  std::ranges::sort(keys);
+
+  std::string postings;
+  std::vector<Gram> grams;
+
+  grams.reserve(keys.size());
+
+  for (uint32_t key : keys) {
+    const auto &list = postingLists[key];
+    uint32_t previous = 0;
+
+    grams.push_back({.key = key, .count = static_cast<uint32_t>(list.size()), .offset = postings.size()});
+
+    for (uint32_t nameIndex : list) {
+      appendVarint(postings, nameIndex - previous);
+      previous = nameIndex;
+    }
+  }
+
+  postingLists.clear();
+
+  Header header{.version = VERSION,
+                .nameCount = static_cast<uint32_t>(names.size()),
+                .fileCount = static_cast<uint32_t>(files.size()),
+                .gramCount = static_cast<uint32_t>(grams.size()),
+                .lastFileId = lastFileId,
+                .lastDeletionSeq = lastDeletionSeq,
+                .poolSize = pool.size(),
+                .postingsSize = postings.size()};
+
+  std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+
+  SnapshotLayout layout = computeLayout(header.nameCount, header.fileCount, header.gramCount, header.poolSize,
+                                        header.postingsSize, sizeof(Header));
+  std::vector<int64_t> fileIds;
+  std::vector<float> fileScores;
+
+  fileIds.reserve(files.size());
+  fileScores.reserve(files.size());
+
+  for (const auto &file : files) {
+    fileIds.emplace_back(file.id);
+    fileScores.emplace_back(file.score);
+  }
+
+  // written next to the current snapshot, which is replaced once the new one is complete
+  fs::path tmpPath = path;
+  tmpPath += ".tmp";
+
+  {
+    std::ofstream ofs(tmpPath, std::ios::binary | std::ios::trunc);
+
+    writeSection(ofs, 0, &header, 1);
+    writeSection(ofs, layout.bucketOffsets, bucketOffsets.data(), bucketOffsets.size());
+    writeSection(ofs, layout.pool, pool.data(), pool.size());
+    writeSection(ofs, layout.grams, grams.data(), grams.size());
+    writeSection(ofs, layout.postings, postings.data(), postings.size());
+    writeSection(ofs, layout.nameFiles, nameFiles.data(), nameFiles.size());
+    writeSection(ofs, layout.fileIds, fileIds.data(), fileIds.size());
+    writeSection(ofs, layout.fileScores, fileScores.data(), fileScores.size());
+
+    if (!ofs.good()) {
+      qWarning() << "Failed to write filename index snapshot to" << tmpPath.c_str();
+      return false;
+    }
+  }
+
+  std::error_code ec;
+
+  fs::rename(tmpPath, path, ec);
+
+  if (ec) {
+    qWarning() << "Failed to replace filename index snapshot" << ec.message();
+    return false;
+  }
+
+  return true;
+}
+
+std::unique_ptr<FilenameSnapshot> FilenameSnapshot::open(const fs::path &path) {
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+  if (fd == -1) return nullptr;
+
+  struct stat st;
+  std::unique_ptr<FilenameSnapshot> snapshot(new FilenameSnapshot);
+  bool ok = fstat(fd, &st) == 0 && snapshot->map(fd, st.st_size);
+
+  close(fd);
+
+  if (!ok) {
+    qWarning() << "Ignoring invalid filename index snapshot at" << path.c_str();
+    return nullptr;
+  }
+
+  return snapshot;
+}
+
+bool FilenameSnapshot::map(int fd, size_t size) {
+  if (size < sizeof(Header)) return false;
+
+  void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+  if (data == MAP_FAILED) return false;
+
+  m_data = data;
+  m_size = size;
+  m_header = static_cast<const Header *>(data);
+
+  const Header &h = *m_header;
+
+  if (std::memcmp(h.magic, SNAPSHOT_MAGIC, sizeof(h.magic)) != 0 || h.version != VERSION) return false;
+  if (h.poolSize > size || h.postingsSize > size) return false;
+
+  SnapshotLayout layout =
+      computeLayout(h.nameCount, h.fileCount, h.gramCount, h.poolSize, h.postingsSize, sizeof(Header));
+
+  if (layout.size != size) return false;
+
+  auto *bytes = static_cast<const uint8_t *>(data);
+
+  m_bucketOffsets = reinterpret_cast<const uint32_t *>(bytes + layout.bucketOffsets);
+  m_pool = bytes + layout.pool;
+  m_grams = reinterpret_cast<const Gram *>(bytes + layout.grams);
+  m_postings = bytes + layout.postings;
+  m_nameFiles = reinterpret_cast<const uint32_t *>(bytes + layout.nameFiles);
+  m_fileIds = reinterpret_cast<const int64_t *>(bytes + layout.fileIds);
+  m_fileScores = reinterpret_cast<const float *>(bytes + layout.fileScores);
+
+  // everything else is bounds checked as it is decoded
+  for (uint32_t i = 0; i != h.nameCount; ++i) {
+    if (m_nameFiles[i] > m_nameFiles[i + 1]) return false;
+  }
+
+  return m_nameFiles[h.nameCount] == h.fileCount;
+}
+
+FilenameSnapshot::~FilenameSnapshot() {
+  if (m_data) munmap(m_data, m_size);
+}
+
+int64_t FilenameSnapshot::lastFileId() const { return m_header->lastFileId; }
+
+int64_t FilenameSnapshot::lastDeletionSeq() const { return m_header->lastDeletionSeq; }
+
+size_t FilenameSnapshot::fileCount() const { return m_header->fileCount; }
+
+const FilenameSnapshot::Gram *FilenameSnapshot::findGram(uint32_t key) const {
+  const Gram *end = m_grams + m_header->gramCount;
+  const Gram *it = std::lower_bound(m_grams, end, key, [](const Gram &g, uint32_t k) { return g.key < k; });
+
+  if (it == end || it->key != key) return nullptr;
+
+  return it;
+}
+
+std::vector<uint32_t> FilenameSnapshot::decodePostings(const Gram &gram) const {
+  std::vector<uint32_t> names;
+  const uint8_t *end = m_postings + m_header->postingsSize;
+  const uint8_t *p = m_postings + std::min<uint64_t>(gram.offset, m_header->postingsSize);
+  uint64_t value = 0;
+
+  uint32_t count = std::min(gram.count, m_header->nameCount);
+
+  names.reserve(count);
+
+  for (uint32_t i = 0; i != count; ++i) {
+    auto delta = readVarint(p, end);
+
+    if (!delta) break;
+    value += *delta;
+    if (value >= m_header->nameCount) break;
+    names.emplace_back(value);
+  }
+
+  return names;
+}
+
+void FilenameSnapshot::decodeBucket(uint32_t bucket, std::string &buffer, std::vector<uint32_t> &ends) const {
+  buffer.clear();
+  ends.clear();
+
+  const uint8_t *end = m_pool + m_header->poolSize;
+  const uint8_t *p = m_pool + std::min<uint64_t>(m_bucketOffsets[bucket], m_header->poolSize);
+  uint32_t count = std::min(NAME_BUCKET_SIZE, m_header->nameCount - bucket * NAME_BUCKET_SIZE);
+
+  for (uint32_t i = 0; i != count; ++i) {
+    uint64_t shared = 0;
+    size_t previousStart = ends.size() >= 2 ? ends[ends.size() - 2] : 0;
+    size_t previousLength = ends.empty() ? 0 : ends.back() - previousStart;
+
+    if (i > 0) {
+      auto value = readVarint(p, end);
+
+      if (!value || *value > previousLength) break;
+      shared = *value;
+    }
+
+    auto suffixLength = readVarint(p, end);
+
+    if (!suffixLength || *suffixLength > static_cast<uint64_t>(end - p)) break;
+
+    // no reallocation can happen while the shared prefix is copied from the buffer itself
+    buffer.reserve(buffer.size() + shared + *suffixLength);
+    buffer.append(buffer.data() + previousStart, shared);
+    buffer.append(reinterpret_cast<const char *>(p), *suffixLength);
+    p += *suffixLength;
+    ends.emplace_back(buffer.size());
+  }
+}
+
+void FilenameSnapshot::forEachCandidate(
+    const std::vector<std::string> &tokens,
+    const std::function<void(std::string_view name, uint32_t firstFile, uint32_t lastFile)> &fn) const {
+  // once this few candidates are left, checking their names is cheaper than intersecting more lists
+  static constexpr size_t MIN_INTERSECTED_CANDIDATE_COUNT = 32;
+  std::vector<const Gram *> grams;
+
+  for (const auto &token : tokens) {
+    for (size_t i = 0; i + TRIGRAM_SIZE <= token.size(); ++i) {
+      const Gram *gram = findGram(gramKey(token.data() + i));
+
+      if (!gram) return;
+      if (std::ranges::find(grams, gram) == grams.end()) grams.emplace_back(gram);
+    }
+  }
+
+  if (grams.empty()) return;
+
+  std::ranges::sort(grams, [](const Gram *a, const Gram *b) { return a->count < b->count; });
+
+  // intersect the lists from the shortest, which bounds the number of candidates from the start
+  std::vector<uint32_t> candidates = decodePostings(*grams.front());
+
+  for (size_t i = 1; i < grams.size() && candidates.size() > MIN_INTERSECTED_CANDIDATE_COUNT; ++i) {
+    std::vector<uint32_t> list = decodePostings(*grams[i]);
+    auto end = std::ranges::set_intersection(candidates, list, candidates.begin()).out;
+
+    candidates.erase(end, candidates.end());
+  }
+
+  std::string buffer;
+  std::vector<uint32_t> ends;
+  std::optional<uint32_t> decodedBucket;
+
+  // candidates are sorted, so that every bucket is decoded at most once
+  for (uint32_t nameIndex : candidates) {
+    uint32_t bucket = nameIndex / NAME_BUCKET_SIZE;
+    uint32_t position = nameIndex % NAME_BUCKET_SIZE;
+
+    if (decodedBucket != bucket) {
+      decodeBucket(bucket, buffer, ends);
+      decodedBucket = bucket;
+    }
+
+    if (position >= ends.size()) continue;
+
+    uint32_t start = position == 0 ? 0 : ends[position - 1];
+
+    fn(std::string_view(buffer).substr(start, ends[position] - start), m_nameFiles[nameIndex],
+       m_nameFiles[nameIndex + 1]);
+  }
+}
+
+static bool isWordStart(std::string_view name, size_t pos) {
+  if (pos == 0) return true;
+
+  auto previous = static_cast<unsigned char>(name[pos - 1]);
+
+  // bytes of multibyte characters are all above 0x80, and only letters are left after normalization
+  return previous < 0x80 && !std::isalnum(previous);
+}
+
+/**
+ * Rank of the match of `tokens` in `name`, higher being better, or nothing if a token is missing.
+ */
+static std::optional<double> computeMatchScore(std::string_view name,
+                                               const std::vector<std::string> &tokens) {
+  double score = 1.0;
+  size_t matchedLength = 0;
+
+  for (const auto &token : tokens) {
+    size_t pos = name.find(token);
+
+    if (pos == std::string_view::npos) return std::nullopt;
+
+    while (pos != std::string_view::npos && !isWordStart(name, pos)) {
+      pos = name.find(token, pos + 1);
+    }
+
+    if (pos != std::string_view::npos) score *= WORD_START_MATCH_BOOST;
+    matchedLength += token.size();
+  }
+
+  size_t unmatchedLength = name.size() - std::min(matchedLength, name.size());
+
+  return score / (1.0 + UNMATCHED_CHARACTER_PENALTY * unmatchedLength);
+}
+
+fs::path FilenameIndex::getSnapshotPath() { return Omnicast::dataDir() / "file-indexer-names.idx"; }
+
+void FilenameIndex::setEnabled(bool enabled) {
+  m_enabled = enabled;
+
+  if (enabled) return;
+
+  std::lock_guard syncLock(m_syncMutex);
+  std::unique_lock lock(m_mutex);
+
+  m_snapshot.reset();
+  m_added.clear();
+  m_deleted.clear();
+  m_stale = false;
+}
+
+bool FilenameIndex::load(const FileIndexerDatabase &db) {
+  fs::path path = getSnapshotPath();
+  std::error_code ec;
+
+  if (!fs::exists(path, ec)) return false;
+
+  // the index was enabled by a previous run
+  m_enabled = true;
+
+  // the database was reset since the snapshot was written, which makes the ids it has meaningless
+  if (!db.hasDeletionLog()) {
+    qWarning() << "Filename index snapshot is out of date";
+    return false;
+  }
+
+  auto snapshot = FilenameSnapshot::open(path);
+
+  if (!snapshot) return false;
+
+  qInfo() << "Loaded filename index snapshot of" << snapshot->fileCount() << "files";
+  install(std::move(snapshot));
+
+  return true;
+}
+
+bool FilenameIndex::needsRewrite() const {
+  if (!m_enabled) return false;
+
+  {
+    std::shared_lock lock(m_mutex);
+    if (m_snapshot && !m_stale) return false;
+  }
+
+  std::lock_guard lock(m_failureMutex);
+
+  return !m_lastFailureAt || std::chrono::steady_clock::now() - *m_lastFailureAt >= REWRITE_RETRY_DELAY;
+}
+
+bool FilenameIndex::requestRewrite() { return !m_rewriteRequested.exchange(true); }
+
+bool FilenameIndex::rewrite(FileIndexerDatabase &db) {
+  auto startedAt = std::chrono::steady_clock::now();
+  bool ok = m_enabled && writeSnapshot(db);
+
+  m_rewriteRequested = false;
+
+  if (!m_enabled) return false;
+
+  std::lock_guard lock(m_failureMutex);
+
+  if (ok) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                         startedAt);
+
+    qInfo() << "Wrote filename index snapshot in" << elapsed.count() << "ms";
+    m_lastFailureAt.reset();
+  } else {
+    m_lastFailureAt = std::chrono::steady_clock::now();
+  }
+
+  return ok;
+}
+
+bool FilenameIndex::writeSnapshot(FileIndexerDatabase &db) {
+  if (!db.hasDeletionLog() && !db.createDeletionLog()) return false;
+
+  auto listing = db.listIndexedNames();
+
+  if (!listing) return false;
+
+  std::vector<FilenameSnapshot::File> files;
+
+  files.reserve(listing->files.size());
+
+  for (auto &file : listing->files) {
+    files.push_back(
+        {.id = file.id, .name = TextTokenizer::normalize(file.name), .score = file.relevancyScore});
+  }
+
+  int64_t lastFileId = listing->lastFileId;
+  int64_t lastDeletionSeq = listing->lastDeletionSeq;
+  fs::path path = getSnapshotPath();
+
+  listing.reset();
+
+  if (!FilenameSnapshot::write(path, std::move(files), lastFileId, lastDeletionSeq)) return false;
+
+  auto snapshot = FilenameSnapshot::open(path);
+
+  if (!snapshot) return false;
+
+  install(std::move(snapshot));
+  // deletions included in the snapshot will never be pulled again
+  db.pruneDeletionLog(lastDeletionSeq);
+
+  return true;
+}
+
+void FilenameIndex::drop(FileIndexerDatabase &db) {
+  // enabled again in the meantime
+  if (m_enabled) return;
+
+  std::error_code ec;
+
+  fs::remove(getSnapshotPath(), ec);
+  db.dropDeletionLog();
+}
+
+void FilenameIndex::install(std::shared_ptr<const FilenameSnapshot> snapshot) {
+  std::lock_guard syncLock(m_syncMutex);
+  std::unique_lock lock(m_mutex);
+
+  if (!m_enabled) return;
+
+  m_lastFileId = snapshot->lastFileId();
+  m_lastDeletionSeq = snapshot->lastDeletionSeq();
+  m_added.clear();
+  m_deleted.clear();
+  m_stale = false;
+  m_snapshot = std::move(snapshot);
+}
+
+std::optional<size_t> FilenameIndex::sync(const FileIndexerDatabase &db) {
+  std::lock_guard syncLock(m_syncMutex);
+  size_t deltaSize = 0;
+
+  // only modified while holding the sync lock, which we have
+  if (!m_snapshot || m_stale) return std::nullopt;
+
+  deltaSize = m_added.size() + m_deleted.size();
+
+  auto changes = db.retrieveFileChanges(m_lastFileId, m_lastDeletionSeq, MAX_DELTA_SIZE - deltaSize);
+
+  if (!changes) return std::nullopt;
+  if (changes->added.empty() && changes->deleted.empty()) return deltaSize;
+
+  std::vector<DeltaFile> added;
+
+  added.reserve(changes->added.size());
+
+  for (auto &file : changes->added) {
+    added.push_back(
+        {.id = file.id, .name = TextTokenizer::normalize(file.name), .score = file.relevancyScore});
+  }
+
+  std::unique_lock lock(m_mutex);
+
+  m_lastFileId = changes->lastFileId;
+  m_lastDeletionSeq = changes->lastDeletionSeq;
+
+  if (deltaSize + added.size() + changes->deleted.size() > MAX_DELTA_SIZE) {
+    qInfo() << "Too many changes since the filename index snapshot was written, a new one is needed";
+    m_stale = true;
+    m_added.clear();
+    m_deleted.clear();
+    return std::nullopt;
+  }
+
+  m_added.insert(m_added.end(), std::make_move_iterator(added.begin()), std::make_move_iterator(added.end()));
+  m_deleted.insert(changes->deleted.begin(), changes->deleted.end());
+
+  if (!changes->deleted.empty()) {
+    std::erase_if(m_added, [&](const DeltaFile &file) { return m_deleted.contains(file.id); });
+  }
+
+  return m_added.size() + m_deleted.size();
+}
+
+std::optional<std::vector<fs::path>> FilenameIndex::search(FileIndexerDatabase &db, std::string_view query,
+                                                           const AbstractFileIndexer::QueryParams &params,
+                                                           const std::function<bool()> &shouldStop) {
+  if (!m_enabled) return std::nullopt;
+
+  const auto &pagination = params.pagination;
+  size_t pageEnd = std::max(0, pagination.offset + pagination.limit);
+  size_t candidateCount = std::max(MIN_CANDIDATE_COUNT, pageEnd * CANDIDATE_OVERSAMPLING);
+
+  // deep pages are left to the full text index
+  if (candidateCount > MAX_CANDIDATE_COUNT) return std::nullopt;
+
+  std::string normalized;
+  std::vector<TextSpan> spans;
+  std::vector<std::string> tokens;
+
+  TextTokenizer::tokenize(query, normalized, spans, {.splitCamelCase = false});
+
+  for (const auto &span : spans) {
+    tokens.emplace_back(std::string_view(normalized).substr(span.offset, span.length));
+  }
+
+  // names cannot be looked up without at least one trigram
+  if (std::ranges::none_of(tokens, [](auto &&token) { return token.size() >= TRIGRAM_SIZE; })) {
+    return std::nullopt;
+  }
+
+  if (!sync(db)) return std::nullopt;
+
+  // min heap of the best candidates so far, by rank
+  std::vector<std::pair<double, FileIndexerDatabase::RankCandidate>> best;
+  auto worse = [](const auto &a, const auto &b) { return a.first > b.first; };
+
+  // returns false if the candidate ranks below all the best ones
+  auto consider = [&](int64_t id, float score, double matchScore) {
+    double rank = matchScore * score;
+
+    if (best.size() == candidateCount && rank <= best.front().first) return false;
+    if (!m_deleted.empty() && m_deleted.contains(id)) return true;
+
+    if (best.size() == candidateCount) {
+      std::ranges::pop_heap(best, worse);
+      best.pop_back();
+    }
+
+    best.push_back({rank, {.id = id, .matchScore = matchScore}});
+    std::ranges::push_heap(best, worse);
+
+    return true;
+  };
+
+  {
+    std::shared_lock lock(m_mutex);
+
+    if (!m_snapshot || m_stale) return std::nullopt;
+
+    m_snapshot->forEachCandidate(tokens, [&](std::string_view name, uint32_t firstFile, uint32_t lastFile) {
+      auto matchScore = computeMatchScore(name, tokens);
+
+      if (!matchScore) return;
+
+      for (uint32_t file = firstFile; file != lastFile; ++file) {
+        if (!consider(m_snapshot->fileId(file), m_snapshot->fileScore(file), *matchScore)) break;
+      }
+    });
+
+    for (const auto &file : m_added) {
+      if (auto matchScore = computeMatchScore(file.name, tokens)) {
+        consider(file.id, file.score, *matchScore);
+      }
+    }
+  }
+
+  if (shouldStop && shouldStop()) return std::vector<fs::path>{};
+
+  std::vector<FileIndexerDatabase::RankCandidate> candidates;
+
+  candidates.reserve(best.size());
+  for (const auto &[rank, candidate] : best) {
+    candidates.emplace_back(candidate);
+  }
+
+  return db.rankFiles(candidates, pagination, shouldStop);
+}
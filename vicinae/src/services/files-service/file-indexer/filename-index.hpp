@@ -0,0 +1,192 @@
+#pragma once
+#include "common.hpp"
+#include "services/files-service/abstract-file-indexer.hpp"
+#include "services/files-service/file-indexer/file-indexer-db.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Immutable, memory mapped snapshot of the indexed file names.
+ *
+ * Names are normalized (see `TextTokenizer::normalize`) and deduplicated, as a lot of files share the same
+ * name (index.js, README.md...). Unique names are sorted and front coded in buckets of `NAME_BUCKET_SIZE`,
+ * each one storing its first name in full and only the suffix that differs from the previous name for the
+ * others. Every byte trigram of every name has a posting list of the names containing it, delta and varint
+ * encoded, which lets substring queries only look at the names containing all of their trigrams.
+ *
+ * Files are stored by name, as their database id and stored relevancy score.
+ */
+class FilenameSnapshot : public NonCopyable {
+public:
+  static constexpr uint32_t VERSION = 1;
+  static constexpr uint32_t NAME_BUCKET_SIZE = 16;
+
+  struct File {
+    int64_t id;
+    std::string name;
+    float score;
+  };
+
+  /**
+   * Write a snapshot of `files` at `path`, replacing any existing one atomically.
+   * `lastFileId` and `lastDeletionSeq` are the positions up to which the database changes are included.
+   */
+  static bool write(const std::filesystem::path &path, std::vector<File> files, int64_t lastFileId,
+                    int64_t lastDeletionSeq);
+  static std::unique_ptr<FilenameSnapshot> open(const std::filesystem::path &path);
+
+  int64_t lastFileId() const;
+  int64_t lastDeletionSeq() const;
+  size_t fileCount() const;
+
+  /**
+   * Call `fn` for every name containing all the trigrams of `tokens`, in name order, along with the range
+   * of its files. Only tokens of at least 3 bytes have trigrams, at least one is required.
+   */
+  void forEachCandidate(const std::vector<std::string> &tokens,
+                        const std::function<void(std::string_view name, uint32_t firstFile,
+                                                 uint32_t lastFile)> &fn) const;
+
+  int64_t fileId(uint32_t file) const { return m_fileIds[file]; }
+  float fileScore(uint32_t file) const { return m_fileScores[file]; }
+
+  ~FilenameSnapshot();
+
+private:
+  struct Header;
+  struct Gram;
+
+  void *m_data = nullptr;
+  size_t m_size = 0;
+  const Header *m_header = nullptr;
+  const uint32_t *m_bucketOffsets = nullptr;
+  const uint8_t *m_pool = nullptr;
+  const Gram *m_grams = nullptr;
+  const uint8_t *m_postings = nullptr;
+  const uint32_t *m_nameFiles = nullptr;
+  const int64_t *m_fileIds = nullptr;
+  const float *m_fileScores = nullptr;
+
+  FilenameSnapshot() = default;
+
+  bool map(int fd, size_t size);
+  const Gram *findGram(uint32_t key) const;
+  std::vector<uint32_t> decodePostings(const Gram &gram) const;
+  void decodeBucket(uint32_t bucket, std::string &buffer, std::vector<uint32_t> &ends) const;
+};
+
+/**
+ * Optional in-memory index of the file names, answering most queries in well under a millisecond where the
+ * full text index takes tens of milliseconds on large indexes.
+ *
+ * A snapshot of the names is written by the writer thread and memory mapped, so that it is shared with the
+ * page cache and loaded instantly on startup. Changes made to the database afterwards are pulled before
+ * every search: new files are found from their ids, which only ever grow, and deleted ones from the file
+ * deletion log (see `FileIndexerDatabase::createDeletionLog`). These are kept in a small delta, merged into
+ * a new snapshot once it grows larger than `SNAPSHOT_REWRITE_THRESHOLD`.
+ *
+ * Queries match every token as a substring of the names, names where tokens start words ranking higher.
+ * The best candidates, ranked by match and stored relevancy score, are then ranked again by the database
+ * with the metadata it has (modification time, opens), which is also where their paths come from.
+ *
+ * The stored relevancy score of files that get reindexed is only refreshed by the next snapshot.
+ */
+class FilenameIndex : public NonCopyable {
+public:
+  // changes pulled since the last snapshot after which a new one gets written
+  static constexpr size_t SNAPSHOT_REWRITE_THRESHOLD = 20'000;
+  // and after which searches fall back to the database until it is
+  static constexpr size_t MAX_DELTA_SIZE = 100'000;
+
+  static std::filesystem::path getSnapshotPath();
+
+  bool enabled() const { return m_enabled; }
+  /**
+   * Disabling the index releases the snapshot, which still needs to be deleted from the writer thread.
+   */
+  void setEnabled(bool enabled);
+
+  /**
+   * Load the snapshot written by a previous run, if any. Returns false if there was none, or if it could
+   * not be used, in which case a new one has to be written.
+   */
+  bool load(const FileIndexerDatabase &db);
+
+  /**
+   * Write a new snapshot from the content of `db`, and use it. Called from the writer thread.
+   */
+  bool rewrite(FileIndexerDatabase &db);
+
+  /**
+   * Pull the changes made to `db` since the last pull. Returns the number of changes applied on top of the
+   * snapshot, or nothing if there still is no usable snapshot or if there are too many of them.
+   */
+  std::optional<size_t> sync(const FileIndexerDatabase &db);
+
+  /**
+   * Whether there is no usable snapshot, because none was written yet or because too many changes were
+   * made since. Failed writes are only retried after a while.
+   */
+  bool needsRewrite() const;
+
+  /**
+   * Returns true the first time it is called since the last snapshot was written, to avoid requesting
+   * several of them at once.
+   */
+  bool requestRewrite();
+
+  /**
+   * Delete the snapshot and the deletion log, unless the index was enabled again in the meantime.
+   * Called from the writer thread.
+   */
+  void drop(FileIndexerDatabase &db);
+
+  /**
+   * Nothing is returned if the index is not able to answer the query, in which case the full text index
+   * has to be searched instead.
+   */
+  std::optional<std::vector<std::filesystem::path>> search(FileIndexerDatabase &db, std::string_view query,
+                                                           const AbstractFileIndexer::QueryParams &params,
+                                                           const std::function<bool()> &shouldStop = {});
+
+private:
+  static constexpr size_t CANDIDATE_OVERSAMPLING = 4;
+  static constexpr size_t MAX_CANDIDATE_COUNT = 2000;
+
+  struct DeltaFile {
+    int64_t id;
+    std::string name;
+    float score;
+  };
+
+  std::atomic<bool> m_enabled = false;
+  std::atomic<bool> m_rewriteRequested = false;
+
+  // only one thread pulls changes at a time, searches only need the shared lock once it is done
+  std::mutex m_syncMutex;
+  mutable std::shared_mutex m_mutex;
+  std::shared_ptr<const FilenameSnapshot> m_snapshot;
+  std::vector<DeltaFile> m_added;
+  std::unordered_set<int64_t> m_deleted;
+  int64_t m_lastFileId = 0;
+  int64_t m_lastDeletionSeq = 0;
+  // too many changes were made since the snapshot
+  bool m_stale = false;
+
+  mutable std::mutex m_failureMutex;
+  std::optional<std::chrono::steady_clock::time_point> m_lastFailureAt;
+
+  bool writeSnapshot(FileIndexerDatabase &db);
+  void install(std::shared_ptr<const FilenameSnapshot> snapshot);
+};
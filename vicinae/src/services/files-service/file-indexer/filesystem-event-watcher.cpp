@@ -0,0 +1,509 @@
+#include "services/files-service/file-indexer/filesystem-event-watcher.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <fstream>
+#include <poll.h>
+#include <qlogging.h>
+#include <sys/eventfd.h>
+#include <sys/fanotify.h>
+#include <sys/inotify.h>
+#include <sys/statfs.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+static constexpr uint64_t FANOTIFY_MASK =
+    FAN_CREATE | FAN_DELETE | FAN_MOVED_FROM | FAN_MOVED_TO | FAN_CLOSE_WRITE | FAN_ONDIR;
+
+static constexpr uint32_t INOTIFY_MASK = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                         IN_CLOSE_WRITE | IN_ONLYDIR | IN_DONT_FOLLOW | IN_EXCL_UNLINK;
+
+static bool isBelow(std::string_view path, std::string_view dir) {
+  return path.size() > dir.size() && path.starts_with(dir) && path[dir.size()] == '/';
+}
+
+size_t FileSystemEventWatcher::defaultMaxWatchCount() {
+  static constexpr size_t FALLBACK_COUNT = 8192;
+  static constexpr size_t MAX_COUNT = 65'536;
+  std::ifstream ifs("/proc/sys/fs/inotify/max_user_watches");
+  size_t userMax = 0;
+
+  if (!(ifs >> userMax)) return FALLBACK_COUNT;
+
+  // leave room for the other programs
+  return std::clamp<size_t>(userMax / 2, 1, MAX_COUNT);
+}
+
+void FileSystemEventWatcher::setMaxWatchCount(size_t count) { m_maxWatchCount = count; }
+
+bool FileSystemEventWatcher::setupFanotify() {
+  int fd = fanotify_init(FAN_CLASS_NOTIF | FAN_CLOEXEC | FAN_NONBLOCK | FAN_REPORT_DFID_NAME,
+                         O_RDONLY | O_CLOEXEC | O_LARGEFILE);
+
+  if (fd == -1) {
+    qDebug() << "fanotify is not available:" << strerror(errno);
+    return false;
+  }
+
+  m_fd = fd;
+
+  for (const auto &root : m_roots) {
+    static constexpr unsigned int MARK_FLAGS = FAN_MARK_ADD | FAN_MARK_FILESYSTEM;
+
+    if (fanotify_mark(m_fd, MARK_FLAGS, FANOTIFY_MASK, AT_FDCWD, root.c_str()) == -1) {
+      qDebug() << "Can't watch the filesystem of" << root.c_str() << "using fanotify:" << strerror(errno);
+      teardown();
+      return false;
+    }
+
+    int rootFd = open(root.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    struct statfs st;
+
+    if (rootFd == -1 || fstatfs(rootFd, &st) == -1) {
+      qDebug() << "Failed to open" << root.c_str() << strerror(errno);
+      if (rootFd != -1) close(rootFd);
+      teardown();
+      return false;
+    }
+
+    bool known = std::ranges::any_of(m_filesystems, [&](const MarkedFilesystem &marked) {
+      return memcmp(&marked.fsid, &st.f_fsid, sizeof(fsid_t)) == 0;
+    });
+
+    if (known) {
+      close(rootFd);
+    } else {
+      m_filesystems.push_back({.fsid = st.f_fsid, .fd = rootFd});
+    }
+  }
+
+  m_backend = Backend::Fanotify;
+
+  return true;
+}
+
+bool FileSystemEventWatcher::setupInotify() {
+  m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+  if (m_fd == -1) {
+    qWarning() << "Failed to initialize inotify:" << strerror(errno);
+    return false;
+  }
+
+  m_backend = Backend::Inotify;
+
+  for (const auto &root : m_roots) {
+    walkDirectory(root, nullptr);
+  }
+
+  return true;
+}
+
+void FileSystemEventWatcher::teardown() {
+  for (const auto &marked : m_filesystems) {
+    close(marked.fd);
+  }
+
+  if (m_fd != -1) close(m_fd);
+
+  m_fd = -1;
+  m_backend = Backend::None;
+  m_filesystems.clear();
+  m_watches.clear();
+  m_watchLimitReached = false;
+  m_pending.clear();
+}
+
+bool FileSystemEventWatcher::addWatch(const fs::path &dir) {
+  if (m_watchLimitReached) return false;
+
+  if (m_watches.size() >= m_maxWatchCount) {
+    qWarning() << "Reached the maximum number of watched directories (" << m_maxWatchCount
+               << "), changes to directories that are not watched will only be picked up by scans";
+    m_watchLimitReached = true;
+    return false;
+  }
+
+  int wd = inotify_add_watch(m_fd, dir.c_str(), INOTIFY_MASK);
+
+  if (wd == -1) {
+    // the kernel limit is shared with other programs, and can be reached before ours
+    if (errno == ENOSPC) {
+      qWarning() << "Reached the kernel limit of inotify watches after" << m_watches.size()
+                 << "watches, consider raising fs.inotify.max_user_watches";
+      m_watchLimitReached = true;
+    }
+    return false;
+  }
+
+  m_watches[wd] = dir;
+
+  return true;
+}
+
+void FileSystemEventWatcher::removeWatches(const fs::path &dir) {
+  for (auto it = m_watches.begin(); it != m_watches.end();) {
+    if (it->second == dir || isBelow(it->second.native(), dir.native())) {
+      inotify_rm_watch(m_fd, it->first);
+      it = m_watches.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  // some room may have been made
+  m_watchLimitReached = false;
+}
+
+void FileSystemEventWatcher::walkDirectory(const fs::path &root, std::vector<FileSystemEntry> *entries) {
+  bool watch = m_backend == Backend::Inotify;
+  // breadth first, so that shallow directories get watched first if the limit is reached
+  std::deque<fs::path> dirs;
+
+  dirs.push_back(root);
+
+  while (!dirs.empty()) {
+    fs::path dir = std::move(dirs.front());
+
+    dirs.pop_front();
+
+    if (watch && !addWatch(dir)) {
+      // nothing more to do if we only walk to add watches
+      if (m_watchLimitReached && !entries) return;
+    }
+
+    auto onEntry = [&](FileSystemEntry &&entry) {
+      if (entry.isDirectory) { dirs.push_back(entry.path); }
+      if (entries) { entries->emplace_back(std::move(entry)); }
+    };
+
+    // entrypoints can be symbolic links, the ones below them are skipped
+    m_walker.readDirectory(dir, onEntry, std::ranges::contains(m_roots, dir));
+  }
+}
+
+std::optional<fs::path> FileSystemEventWatcher::resolveHandle(const fsid_t &fsid, file_handle *handle) const {
+  auto it = std::ranges::find_if(m_filesystems, [&](const MarkedFilesystem &marked) {
+    return memcmp(&marked.fsid, &fsid, sizeof(fsid_t)) == 0;
+  });
+
+  if (it == m_filesystems.end()) return std::nullopt;
+
+  int fd = open_by_handle_at(it->fd, handle, O_PATH | O_CLOEXEC);
+
+  // the directory may have been deleted since the event was emitted
+  if (fd == -1) return std::nullopt;
+
+  char buf[PATH_MAX];
+  std::string link = "/proc/self/fd/" + std::to_string(fd);
+  ssize_t length = readlink(link.c_str(), buf, sizeof(buf));
+
+  close(fd);
+
+  if (length <= 0) return std::nullopt;
+
+  return fs::path(std::string(buf, length));
+}
+
+bool FileSystemEventWatcher::isWatchedPath(const fs::path &path) {
+  std::string_view fullPath = path.native();
+  auto root = std::ranges::find_if(m_roots, [&](const fs::path &root) {
+    return fullPath == root.native() || isBelow(fullPath, root.native());
+  });
+
+  if (root == m_roots.end()) return false;
+
+  // every directory below the root has to be walkable for the path to be indexed
+  for (size_t sep = fullPath.find('/', root->native().size() + 1); sep != std::string_view::npos;
+       sep = fullPath.find('/', sep + 1)) {
+    if (m_walker.isExcluded(fs::path(fullPath.substr(0, sep)), true)) return false;
+  }
+
+  return true;
+}
+
+void FileSystemEventWatcher::readFanotifyEvents() {
+  char buf[EVENT_BUFFER_SIZE];
+
+  for (;;) {
+    ssize_t length = read(m_fd, buf, sizeof(buf));
+
+    if (length <= 0) return;
+
+    // events are not guaranteed to be aligned in the buffer, so they are copied out before being read
+    for (ssize_t offset = 0; offset + static_cast<ssize_t>(sizeof(fanotify_event_metadata)) <= length;) {
+      const char *event = buf + offset;
+      fanotify_event_metadata meta;
+
+      memcpy(&meta, event, sizeof(meta));
+
+      if (meta.vers != FANOTIFY_METADATA_VERSION) {
+        qCritical() << "Unsupported fanotify metadata version" << meta.vers;
+        return;
+      }
+
+      if (meta.event_len < sizeof(meta) || offset + meta.event_len > length) break;
+
+      offset += meta.event_len;
+
+      if (meta.mask & FAN_Q_OVERFLOW) {
+        handleOverflow();
+        continue;
+      }
+
+      size_t minLength = meta.metadata_len + sizeof(fanotify_event_info_fid) + sizeof(file_handle);
+
+      if (meta.event_len < minLength) continue;
+
+      fanotify_event_info_fid info;
+      const char *infoData = event + meta.metadata_len;
+
+      memcpy(&info, infoData, sizeof(info));
+
+      if (info.hdr.info_type != FAN_EVENT_INFO_TYPE_DFID_NAME) continue;
+
+      const char *handleData = infoData + sizeof(fanotify_event_info_fid);
+      file_handle header;
+
+      memcpy(&header, handleData, sizeof(header));
+
+      if (header.handle_bytes > MAX_HANDLE_SZ) continue;
+
+      alignas(file_handle) char handle[sizeof(file_handle) + MAX_HANDLE_SZ];
+      const char *name = handleData + sizeof(file_handle) + header.handle_bytes;
+      fsid_t fsid;
+
+      memcpy(handle, handleData, sizeof(file_handle) + header.handle_bytes);
+      memcpy(&fsid, &info.fsid, sizeof(fsid));
+
+      auto dir = resolveHandle(fsid, reinterpret_cast<file_handle *>(handle));
+
+      // events about the directory itself, which are covered by the events reported to its parent
+      if (!dir || strcmp(name, ".") == 0) continue;
+
+      fs::path path = *dir / name;
+
+      if (isWatchedPath(path)) { record(std::move(path)); }
+    }
+  }
+}
+
+void FileSystemEventWatcher::readInotifyEvents() {
+  alignas(inotify_event) char buf[EVENT_BUFFER_SIZE];
+
+  for (;;) {
+    ssize_t length = read(m_fd, buf, sizeof(buf));
+
+    if (length <= 0) return;
+
+    for (char *ptr = buf; ptr < buf + length;) {
+      auto *event = reinterpret_cast<inotify_event *>(ptr);
+
+      ptr += sizeof(inotify_event) + event->len;
+
+      if (event->mask & IN_Q_OVERFLOW) {
+        handleOverflow();
+        continue;
+      }
+
+      auto it = m_watches.find(event->wd);
+
+      if (it == m_watches.end()) continue;
+
+      if (event->mask & IN_IGNORED) {
+        m_watches.erase(it);
+        m_watchLimitReached = false;
+        continue;
+      }
+
+      if (event->len == 0) continue;
+
+      fs::path path = it->second / event->name;
+
+      // watches follow the directory, which would report events with its old path
+      if ((event->mask & (IN_ISDIR | IN_MOVED_FROM)) == (IN_ISDIR | IN_MOVED_FROM)) { removeWatches(path); }
+
+      record(std::move(path));
+    }
+  }
+}
+
+void FileSystemEventWatcher::record(fs::path path) {
+  auto now = Clock::now();
+
+  if (m_pending.empty()) { m_firstEventAt = now; }
+
+  m_lastEventAt = now;
+  m_pending.insert(std::move(path));
+}
+
+void FileSystemEventWatcher::handleOverflow() {
+  qWarning() << "Filesystem events were lost, rescanning watched directories";
+
+  m_pending.clear();
+
+  // directories created in the meantime are missing a watch, existing watches are left untouched
+  if (m_backend == Backend::Inotify) {
+    for (const auto &root : m_roots) {
+      walkDirectory(root, nullptr);
+    }
+  }
+
+  for (const auto &root : m_roots) {
+    m_scanner.enqueueFull(root);
+  }
+}
+
+FileSystemEventWatcher::Clock::time_point FileSystemEventWatcher::flushDeadline() const {
+  return std::min(m_lastEventAt + DEBOUNCE_DELAY, m_firstEventAt + MAX_FLUSH_DELAY);
+}
+
+void FileSystemEventWatcher::flush() {
+  std::vector<fs::path> deleted;
+  // created directories come with their whole content, which may overlap with other pending paths
+  std::unordered_map<fs::path, FileSystemEntry> indexed;
+
+  auto add = [&](FileSystemEntry &&entry) { indexed.try_emplace(entry.path, std::move(entry)); };
+  std::vector<fs::path> changedRules;
+
+  // the rules of a directory are read again when one of its ignore files changes, and the directory is
+  // walked again for what they no longer exclude
+  for (const auto &path : m_pending) {
+    if (m_walker.isIgnoreFile(path)) { changedRules.emplace_back(path.parent_path()); }
+  }
+
+  for (auto &dir : changedRules) {
+    m_walker.forgetIgnoreRules(dir);
+    m_pending.insert(std::move(dir));
+  }
+
+  for (const auto &path : m_pending) {
+    auto entry = FileSystemEntry::fromPath(path, std::ranges::contains(m_roots, path));
+
+    // symbolic links are never indexed, the path may have been a regular file before
+    if (!entry) {
+      deleted.emplace_back(path);
+      continue;
+    }
+
+    if (indexed.contains(path) || m_walker.isExcluded(path, entry->isDirectory)) continue;
+
+    // keep the modification time of the parent up to date
+    if (auto parent = FileSystemEntry::fromPath(path.parent_path())) { add(std::move(*parent)); }
+
+    if (entry->isDirectory) {
+      std::vector<FileSystemEntry> entries;
+
+      walkDirectory(path, &entries);
+
+      for (auto &child : entries) {
+        add(std::move(child));
+      }
+    }
+
+    add(std::move(*entry));
+  }
+
+  m_pending.clear();
+  m_scanner.enqueueDeletion(std::move(deleted));
+
+  std::vector<FileSystemEntry> batch;
+
+  for (auto &[path, entry] : indexed) {
+    batch.emplace_back(std::move(entry));
+
+    if (batch.size() >= FLUSH_BATCH_SIZE) {
+      m_scanner.enqueueIndex(std::move(batch));
+      batch.clear();
+    }
+  }
+
+  m_scanner.enqueueIndex(std::move(batch));
+}
+
+void FileSystemEventWatcher::run() {
+  if (!setupFanotify() && !setupInotify()) {
+    qWarning() << "Filesystem changes will not be watched, the index will only be updated by scans";
+    return;
+  }
+
+  if (m_backend == Backend::Fanotify) {
+    qInfo() << "Watching filesystem changes using fanotify";
+  } else {
+    qInfo() << "Watching filesystem changes using inotify," << m_watches.size() << "directories watched";
+  }
+
+  pollfd fds[] = {{.fd = m_fd, .events = POLLIN}, {.fd = m_stopFd, .events = POLLIN}};
+
+  while (m_alive) {
+    int timeout = -1;
+
+    if (!m_pending.empty()) {
+      auto remaining = std::chrono::ceil<std::chrono::milliseconds>(flushDeadline() - Clock::now());
+
+      timeout = std::max<int>(0, remaining.count());
+    }
+
+    if (poll(fds, std::size(fds), timeout) == -1) {
+      if (errno == EINTR) continue;
+      qCritical() << "Failed to poll filesystem events:" << strerror(errno);
+      break;
+    }
+
+    if (fds[1].revents & POLLIN) break;
+
+    if (fds[0].revents & POLLIN) {
+      if (m_backend == Backend::Fanotify) {
+        readFanotifyEvents();
+      } else {
+        readInotifyEvents();
+      }
+    }
+
+    if (!m_pending.empty() && Clock::now() >= flushDeadline()) { flush(); }
+  }
+
+  teardown();
+}
+
+void FileSystemEventWatcher::start(const std::vector<fs::path> &roots) {
+  if (m_thread.joinable()) return;
+
+  m_stopFd = eventfd(0, EFD_CLOEXEC);
+
+  if (m_stopFd == -1) {
+    qCritical() << "Failed to create eventfd:" << strerror(errno);
+    return;
+  }
+
+  // paths resolved from fanotify events are canonical
+  m_roots.clear();
+  for (const auto &root : roots) {
+    std::error_code ec;
+    auto canonical = fs::weakly_canonical(root, ec);
+
+    m_roots.emplace_back(ec ? root : canonical);
+  }
+
+  m_alive = true;
+  m_thread = std::thread([this]() { run(); });
+}
+
+void FileSystemEventWatcher::stop() {
+  if (!m_thread.joinable()) return;
+
+  uint64_t value = 1;
+
+  m_alive = false;
+  write(m_stopFd, &value, sizeof(value));
+  m_thread.join();
+  close(m_stopFd);
+  m_stopFd = -1;
+}
+
+FileSystemEventWatcher::FileSystemEventWatcher(IndexerScanner &scanner) : m_scanner(scanner) {}
+
+FileSystemEventWatcher::~FileSystemEventWatcher() { stop(); }
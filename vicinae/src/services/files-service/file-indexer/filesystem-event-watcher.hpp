@@ -0,0 +1,110 @@
+#pragma once
+#include "common.hpp"
+#include "services/files-service/file-indexer/filesystem-walker.hpp"
+#include "services/files-service/file-indexer/indexer-scanner.hpp"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <sys/types.h>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+struct file_handle;
+
+/**
+ * Keeps the index up to date by listening to the filesystem events reported by the kernel, so that
+ * changes show up within seconds without having to periodically rescan the watched directories.
+ *
+ * fanotify is used when the process is allowed to watch entire filesystems (which usually requires
+ * CAP_SYS_ADMIN), events identifying the changed entry by its parent directory and name
+ * (FAN_REPORT_DFID_NAME). Otherwise, an inotify watch is added to every directory below the watched roots,
+ * up to a configurable limit, shallow directories first. Directories left unwatched are only refreshed by
+ * regular scans.
+ *
+ * Events are accumulated until things settle down, or for at most `MAX_FLUSH_DELAY`. The state of every
+ * changed path is then checked to decide whether it needs to be indexed or deleted, which turns any
+ * sequence of events for the same path into a single write.
+ */
+class FileSystemEventWatcher : public NonCopyable {
+  static constexpr auto DEBOUNCE_DELAY = std::chrono::milliseconds(500);
+  static constexpr auto MAX_FLUSH_DELAY = std::chrono::seconds(3);
+  static constexpr size_t FLUSH_BATCH_SIZE = 10'000;
+  static constexpr size_t EVENT_BUFFER_SIZE = 64 * 1024;
+
+  enum class Backend { None, Fanotify, Inotify };
+
+  struct MarkedFilesystem {
+    fsid_t fsid;
+    // any file descriptor on the filesystem, used to resolve the file handles reported in events
+    int fd = -1;
+  };
+
+  using Clock = std::chrono::steady_clock;
+
+  IndexerScanner &m_scanner;
+  FileSystemWalker m_walker;
+  std::vector<std::filesystem::path> m_roots;
+  std::atomic<size_t> m_maxWatchCount = defaultMaxWatchCount();
+  std::atomic<bool> m_alive = false;
+  Backend m_backend = Backend::None;
+  int m_fd = -1;
+  int m_stopFd = -1;
+  std::thread m_thread;
+
+  // inotify watch descriptors and the directory they were added for
+  std::unordered_map<int, std::filesystem::path> m_watches;
+  bool m_watchLimitReached = false;
+
+  std::vector<MarkedFilesystem> m_filesystems;
+
+  std::unordered_set<std::filesystem::path> m_pending;
+  Clock::time_point m_firstEventAt;
+  Clock::time_point m_lastEventAt;
+
+  bool setupFanotify();
+  bool setupInotify();
+  void teardown();
+
+  bool addWatch(const std::filesystem::path &dir);
+  void removeWatches(const std::filesystem::path &dir);
+
+  /**
+   * Walk the directory tree rooted at `dir`, adding inotify watches along the way if inotify is in use.
+   * If `entries` is not null, every walked entry is appended to it.
+   */
+  void walkDirectory(const std::filesystem::path &dir, std::vector<FileSystemEntry> *entries);
+
+  std::optional<std::filesystem::path> resolveHandle(const fsid_t &fsid, file_handle *handle) const;
+
+  /**
+   * Whether `path` is located below one of the roots, without being excluded by the walker.
+   * Only needed for fanotify, as it reports events for the entire filesystem.
+   */
+  bool isWatchedPath(const std::filesystem::path &path);
+
+  void readFanotifyEvents();
+  void readInotifyEvents();
+  void record(std::filesystem::path path);
+  void handleOverflow();
+  Clock::time_point flushDeadline() const;
+  void flush();
+  void run();
+
+public:
+  static size_t defaultMaxWatchCount();
+
+  /**
+   * Maximum number of inotify watches to add. Every watch costs about 1KB of kernel memory, and the
+   * limit is shared with all the other programs run by the user. Takes effect on the next start.
+   */
+  void setMaxWatchCount(size_t count);
+
+  void start(const std::vector<std::filesystem::path> &roots);
+  void stop();
+
+  FileSystemEventWatcher(IndexerScanner &scanner);
+  ~FileSystemEventWatcher();
+};
@@ -1,14 +1,22 @@
 #include "services/files-service/file-indexer/filesystem-walker.hpp"
 #include "utils/utils.hpp"
+#include <atomic>
 #include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <dirent.h>
+#include <fcntl.h>
 #include <filesystem>
-#include <fstream>
-#include <fnmatch.h>
 #include <qlogging.h>
 #include <qobjectdefs.h>
+#include <mutex>
 #include <stack>
 #include <qlogging.h>
 #include <string>
+#include <sys/stat.h>
+#include <sys/vfs.h>
+#include <thread>
+#include <unistd.h>
 
 namespace fs = std::filesystem;
 
@@ -35,61 +43,203 @@ static const std::vector<std::string_view> EXCLUDED_FILENAMES = {
     ".clangd",
 };
 
-bool GitIgnoreReader::matches(const fs::path &path) const {
-  for (const auto &pattern : m_patterns) {
-    std::string filename = getLastPathComponent(path);
-    std::string processedPattern = pattern;
+struct FilesystemType {
+  // as reported by statfs, see statfs(2)
+  int64_t magic;
+  std::string_view name;
+  MountPolicy policy;
+};
 
-    if (pattern.starts_with('/')) {
-      // get rid of leading slash to match more gitignore patterns - this is a hack:
-      // directory separators are not handled properly.
-      processedPattern = pattern.substr(1);
-    }
+/**
+ * Filesystems that are not walked like local disks. Those found on removable drives are also found on
+ * internal ones, but seldom hold the files of the user there.
+ */
+static constexpr FilesystemType FILESYSTEM_TYPES[] = {
+    {0x9fa0, "proc", MountPolicy::Skip},
+    {0x62656572, "sysfs", MountPolicy::Skip},
+    {0x1cd1, "devpts", MountPolicy::Skip},
+    {0x64626720, "debugfs", MountPolicy::Skip},
+    {0x74726163, "tracefs", MountPolicy::Skip},
+    {0x73636673, "securityfs", MountPolicy::Skip},
+    {0x27e0eb, "cgroup", MountPolicy::Skip},
+    {0x63677270, "cgroup2", MountPolicy::Skip},
+    {0x6165676c, "pstore", MountPolicy::Skip},
+    {0xcafe4a11, "bpf", MountPolicy::Skip},
+    {0x62656570, "configfs", MountPolicy::Skip},
+    {0x19800202, "mqueue", MountPolicy::Skip},
+    {0x958458f6, "hugetlbfs", MountPolicy::Skip},
+    {0x42494e4d, "binfmt_misc", MountPolicy::Skip},
+    {0x0187, "autofs", MountPolicy::Skip},
+    {0xde5e81e4, "efivarfs", MountPolicy::Skip},
+    {0x6e736673, "nsfs", MountPolicy::Skip},
+    {0x65735543, "fusectl", MountPolicy::Skip},
+    {0x6969, "nfs", MountPolicy::Shallow},
+    {0x517b, "smb", MountPolicy::Shallow},
+    {0xff534d42, "cifs", MountPolicy::Shallow},
+    {0xfe534d42, "smb2", MountPolicy::Shallow},
+    {0x65735546, "fuse", MountPolicy::Shallow},
+    {0x00c36400, "ceph", MountPolicy::Shallow},
+    {0x5346414f, "afs", MountPolicy::Shallow},
+    {0x01021997, "9p", MountPolicy::Shallow},
+    {0x4d44, "vfat", MountPolicy::Serial},
+    {0x2011bab0, "exfat", MountPolicy::Serial},
+    {0x5346544e, "ntfs", MountPolicy::Serial},
+    {0x9660, "iso9660", MountPolicy::Serial},
+    {0x15013346, "udf", MountPolicy::Serial},
+};
 
-    if (fnmatch(processedPattern.c_str(), filename.c_str(), FNM_PATHNAME | FNM_EXTMATCH) == 0) {
-      return true;
-    }
-  }
+fs::file_time_type FileTimes::lastModified() const {
+  using namespace std::chrono;
+  sys_time<nanoseconds> time{nanoseconds(modified)};
 
-  return false;
+  return time_point_cast<fs::file_time_type::duration>(fs::file_time_type::clock::from_sys(time));
 }
 
-const std::vector<std::string> &GitIgnoreReader::patterns() const { return m_patterns; }
+FileTimes FileTimes::fromStat(const struct stat &st) {
+  auto toNanoseconds = [](const timespec &ts) -> int64_t {
+    return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+  };
 
-GitIgnoreReader::GitIgnoreReader(const fs::path &path) : m_path(path) {
-  std::ifstream ifs(path);
-  std::string line;
+  return {.modified = toNanoseconds(st.st_mtim), .changed = toNanoseconds(st.st_ctim)};
+}
 
-  while (std::getline(ifs, line)) {
-    m_patterns.emplace_back(line);
-  }
+std::optional<FileSystemEntry> FileSystemEntry::fromPath(const fs::path &path, bool followSymlink) {
+  struct stat st;
+  int result = followSymlink ? stat(path.c_str(), &st) : lstat(path.c_str(), &st);
+
+  if (result != 0 || S_ISLNK(st.st_mode)) return std::nullopt;
+
+  return FileSystemEntry{.path = path,
+                         .isDirectory = S_ISDIR(st.st_mode),
+                         .times = FileTimes::fromStat(st),
+                         .device = st.st_dev};
 }
 
 void FileSystemWalker::setIgnoreFiles(const std::vector<std::string> &files) { m_ignoreFiles = files; }
 
+bool FileSystemWalker::isIgnoreFile(const fs::path &path) const {
+  return std::ranges::contains(m_ignoreFiles, path.filename().native());
+}
+
+void FileSystemWalker::forgetIgnoreRules(const fs::path &dir) {
+  std::unique_lock lock(m_ignoreCacheMutex);
+
+  if (auto it = m_ignoreCache.find(dir.native()); it != m_ignoreCache.end()) { m_ignoreCache.erase(it); }
+}
+
 void FileSystemWalker::setRecursive(bool value) { m_recursive = value; }
 
 void FileSystemWalker::setMaxDepth(std::optional<size_t> maxDepth) { m_maxDepth = maxDepth; }
 
 void FileSystemWalker::setIgnoreHiddenPaths(bool value) { m_ignoreHiddenFiles = value; }
 
-bool FileSystemWalker::isIgnored(const std::filesystem::path &path) const {
-  fs::path p = path.parent_path();
+void FileSystemWalker::setThreadCount(size_t count) { m_threadCount = std::max<size_t>(1, count); }
 
-  while (p != p.root_directory()) {
-    for (const auto &name : m_ignoreFiles) {
-      fs::path ignorePath = p / name;
+std::shared_ptr<const IgnoreRules> FileSystemWalker::ignoreRules(std::string_view dir) const {
+  {
+    std::shared_lock lock(m_ignoreCacheMutex);
 
-      if (!fs::is_regular_file(ignorePath)) continue;
-      if (GitIgnoreReader(ignorePath).matches(path)) { return true; }
-    }
+    if (auto it = m_ignoreCache.find(dir); it != m_ignoreCache.end()) { return it->second; }
+  }
+
+  auto rules = std::make_shared<IgnoreRules>();
 
-    p = p.parent_path();
+  for (const auto &name : m_ignoreFiles) {
+    fs::path ignorePath = fs::path(dir) / name;
+
+    if (fs::is_regular_file(ignorePath)) { rules->load(ignorePath); }
+  }
+
+  std::shared_ptr<const IgnoreRules> result = rules->empty() ? nullptr : std::move(rules);
+  std::unique_lock lock(m_ignoreCacheMutex);
+
+  m_ignoreCache.insert({std::string(dir), result});
+
+  return result;
+}
+
+bool FileSystemWalker::isIgnored(const std::filesystem::path &path, bool isDirectory) const {
+  std::string_view fullPath = path.native();
+
+  // walk up the parent directories, the closest ignore files taking precedence
+  for (size_t sep = fullPath.rfind('/'); sep != std::string_view::npos && sep > 0;
+       sep = fullPath.rfind('/', sep - 1)) {
+    auto rules = ignoreRules(fullPath.substr(0, sep));
+
+    if (!rules) continue;
+
+    switch (rules->match(fullPath.substr(sep + 1), isDirectory)) {
+    case IgnoreRules::Verdict::Ignored:
+      return true;
+    case IgnoreRules::Verdict::Included:
+      return false;
+    case IgnoreRules::Verdict::None:
+      break;
+    }
   }
 
   return false;
 }
 
+std::shared_ptr<FileSystemWalker::Mount> FileSystemWalker::mountFor(dev_t device,
+                                                                    const fs::path &path) const {
+  std::lock_guard lock(m_mountMutex);
+
+  if (auto it = m_mounts.find(device); it != m_mounts.end()) return it->second;
+
+  auto mount = std::make_shared<Mount>();
+  struct statfs st;
+
+  mount->path = path;
+  mount->filesystem = "unknown";
+
+  if (statfs(path.c_str(), &st) == 0) {
+    auto matches = [&](const FilesystemType &type) { return type.magic == static_cast<int64_t>(st.f_type); };
+
+    if (auto it = std::ranges::find_if(FILESYSTEM_TYPES, matches); it != std::end(FILESYSTEM_TYPES)) {
+      mount->filesystem = it->name;
+      mount->policy = it->policy;
+    }
+  }
+
+  if (mount->policy == MountPolicy::Skip || mount->policy == MountPolicy::Shallow) {
+    m_excludedMounts.push_back({.path = path, .filesystem = mount->filesystem, .policy = mount->policy});
+  }
+
+  m_mounts.emplace(device, mount);
+
+  return mount;
+}
+
+void FileSystemWalker::markSlow(Mount &mount) const {
+  if (mount.slow.exchange(true)) return;
+
+  qWarning() << "Filesystem mounted at" << mount.path.c_str()
+             << "is too slow to list, not walking it any further";
+
+  std::lock_guard lock(m_mountMutex);
+
+  m_excludedMounts.push_back(
+      {.path = mount.path, .filesystem = mount.filesystem, .policy = mount.policy, .slow = true});
+}
+
+std::vector<ExcludedMount> FileSystemWalker::excludedMounts() const {
+  std::lock_guard lock(m_mountMutex);
+
+  return m_excludedMounts;
+}
+
+bool FileSystemWalker::isExcluded(const fs::path &path, bool isDirectory) const {
+  fs::path filename = path.filename();
+  std::string_view name = filename.native();
+
+  if (m_ignoreHiddenFiles && name.starts_with('.')) return true;
+  if (std::ranges::contains(EXCLUDED_FILENAMES, name)) return true;
+  if (std::ranges::contains(EXCLUDED_PATHS, path)) return true;
+
+  return isIgnored(path, isDirectory);
+}
+
 void FileSystemWalker::walk(const fs::path &root, const WalkCallback &callback) {
   std::stack<fs::path> dirStack;
   size_t rootDepth = std::distance(root.begin(), root.end());
@@ -114,9 +264,11 @@ void FileSystemWalker::walk(const fs::path &root, const WalkCallback &callback)
       if (m_ignoreHiddenFiles && isHiddenPath(path)) continue;
       if (std::ranges::contains(EXCLUDED_PATHS, path)) { continue; }
       if (std::ranges::contains(EXCLUDED_FILENAMES, path.filename())) { continue; }
-      if (isIgnored(path)) { continue; }
+      bool isDirectory = entry.is_directory();
+
+      if (isIgnored(path, isDirectory)) { continue; }
 
-      if (m_recursive && entry.is_directory()) {
+      if (m_recursive && isDirectory) {
         size_t depth = std::distance(path.begin(), path.end()) - rootDepth;
 
         if (!(m_maxDepth && depth > *m_maxDepth)) { dirStack.push(entry); }
@@ -126,3 +278,229 @@ void FileSystemWalker::walk(const fs::path &root, const WalkCallback &callback)
     }
   }
 }
+
+void FileSystemWalker::readDirectory(const fs::path &dir, const EntryCallback &fn, bool followSymlink) const {
+  int flags = O_RDONLY | O_DIRECTORY | O_CLOEXEC;
+
+  if (!followSymlink) flags |= O_NOFOLLOW;
+
+  int fd = open(dir.c_str(), flags);
+
+  if (fd == -1) {
+    qDebug() << "walk error" << dir.c_str() << strerror(errno);
+    return;
+  }
+
+  struct stat dirStat;
+  // entries that are on another filesystem are mount points
+  dev_t device = fstat(fd, &dirStat) == 0 ? dirStat.st_dev : 0;
+  DIR *handle = fdopendir(fd);
+
+  if (!handle) {
+    qDebug() << "walk error" << dir.c_str() << strerror(errno);
+    close(fd);
+    return;
+  }
+
+  while (dirent *entry = readdir(handle)) {
+    std::string_view name = entry->d_name;
+
+    if (name == "." || name == "..") continue;
+
+    unsigned char type = entry->d_type;
+
+    // the file type reported by the listing lets us skip excluded entries without a stat
+    if (type == DT_LNK) continue;
+    // parent directories have been checked already
+    if (m_ignoreHiddenFiles && name.starts_with('.')) continue;
+    if (std::ranges::contains(EXCLUDED_FILENAMES, name)) continue;
+
+    fs::path path = dir / name;
+
+    if (std::ranges::contains(EXCLUDED_PATHS, path)) continue;
+
+    struct stat st;
+    bool hasStat = fstatat(fd, entry->d_name, &st, AT_SYMLINK_NOFOLLOW) == 0;
+
+    // some filesystems do not report the file type
+    if (type == DT_UNKNOWN) {
+      if (!hasStat || S_ISLNK(st.st_mode)) continue;
+      type = S_ISDIR(st.st_mode) ? DT_DIR : DT_REG;
+    }
+
+    if (isIgnored(path, type == DT_DIR)) continue;
+
+    bool isMountPoint = hasStat && device != 0 && st.st_dev != device;
+
+    if (type == DT_DIR && isMountPoint && mountFor(st.st_dev, path)->policy == MountPolicy::Skip) continue;
+
+    FileSystemEntry walked{.path = std::move(path), .isDirectory = type == DT_DIR};
+
+    if (hasStat) {
+      walked.times = FileTimes::fromStat(st);
+      walked.device = st.st_dev;
+    }
+
+    fn(std::move(walked));
+  }
+
+  closedir(handle);
+}
+
+void FileSystemWalker::walkParallel(const fs::path &root, size_t batchSize, const BatchCallback &fn) {
+  struct Task {
+    fs::path path;
+    size_t depth = 0;
+    dev_t device = 0;
+    // null for the filesystem of the root, which is always walked
+    std::shared_ptr<Mount> mount;
+    // below the mount point of `mount`
+    size_t mountDepth = 0;
+  };
+
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  size_t threadCount = m_threadCount;
+  std::vector<Worker> workers(threadCount);
+  // directories that have been discovered but not processed yet
+  std::atomic<size_t> pending = 1;
+  struct stat rootStat;
+  dev_t rootDevice = stat(root.c_str(), &rootStat) == 0 ? rootStat.st_dev : 0;
+
+  workers[0].tasks.push_back({.path = root, .device = rootDevice});
+
+  auto popTask = [&](size_t self) -> std::optional<Task> {
+    {
+      auto &own = workers[self];
+      std::lock_guard lock(own.mutex);
+
+      if (!own.tasks.empty()) {
+        Task task = std::move(own.tasks.back());
+        own.tasks.pop_back();
+        return task;
+      }
+    }
+
+    // steal the oldest task of another worker, which is the most likely to hold a large subtree
+    for (size_t i = 1; i != threadCount; ++i) {
+      auto &victim = workers[(self + i) % threadCount];
+      std::lock_guard lock(victim.mutex);
+
+      if (!victim.tasks.empty()) {
+        Task task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return task;
+      }
+    }
+
+    return std::nullopt;
+  };
+
+  auto work = [&](size_t self) {
+    std::vector<FileSystemEntry> batch;
+
+    batch.reserve(batchSize);
+
+    while (pending > 0) {
+      auto task = popTask(self);
+
+      if (!task) {
+        std::this_thread::sleep_for(PARALLEL_IDLE_WAIT);
+        continue;
+      }
+
+      const auto &mount = task->mount;
+
+      if (mount && mount->slow) {
+        --pending;
+        continue;
+      }
+
+      std::unique_lock<std::mutex> serial;
+
+      // directories of a filesystem that is not walked concurrently wait for the one being listed
+      if (mount && mount->policy != MountPolicy::Walk) {
+        serial = std::unique_lock(mount->mutex, std::try_to_lock);
+
+        if (!serial.owns_lock()) {
+          auto &own = workers[self];
+
+          {
+            std::lock_guard lock(own.mutex);
+            own.tasks.push_front(std::move(*task));
+          }
+
+          std::this_thread::sleep_for(PARALLEL_IDLE_WAIT);
+          continue;
+        }
+      }
+
+      size_t depth = task->depth + 1;
+      auto startedAt = std::chrono::steady_clock::now();
+
+      auto onEntry = [&](FileSystemEntry &&entry) {
+        if (m_recursive && entry.isDirectory && !(m_maxDepth && depth > *m_maxDepth)) {
+          Task child{.path = entry.path,
+                     .depth = depth,
+                     .device = task->device,
+                     .mount = mount,
+                     .mountDepth = task->mountDepth + 1};
+
+          if (entry.device != 0 && task->device != 0 && entry.device != task->device) {
+            child.device = entry.device;
+            child.mount = mountFor(entry.device, entry.path);
+            child.mountDepth = 0;
+          }
+
+          bool isTooDeep = child.mount && child.mount->policy == MountPolicy::Shallow &&
+                           child.mountDepth >= SHALLOW_MOUNT_DEPTH;
+
+          if (!isTooDeep) {
+            auto &own = workers[self];
+            std::lock_guard lock(own.mutex);
+
+            ++pending;
+            own.tasks.push_back(std::move(child));
+          }
+        }
+
+        batch.emplace_back(std::move(entry));
+
+        if (batch.size() >= batchSize) {
+          fn(std::move(batch));
+          batch.clear();
+          batch.reserve(batchSize);
+        }
+      };
+
+      // only the root can be a symbolic link, the ones below it are skipped
+      readDirectory(task->path, onEntry, task->depth == 0);
+
+      // listing can't be interrupted, only what is left of the filesystem can be given up on
+      if (mount && std::chrono::steady_clock::now() - startedAt > SLOW_DIRECTORY_TIMEOUT) {
+        markSlow(*mount);
+      }
+
+      --pending;
+    }
+
+    if (!batch.empty()) { fn(std::move(batch)); }
+  };
+
+  std::vector<std::thread> threads;
+
+  threads.reserve(threadCount - 1);
+
+  for (size_t i = 1; i != threadCount; ++i) {
+    threads.emplace_back(work, i);
+  }
+
+  work(0);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
@@ -1,29 +1,137 @@
 #pragma once
+#include "services/files-service/file-indexer/ignore-rules.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <sys/stat.h>
+#include <unordered_map>
 #include <vector>
 
-class GitIgnoreReader {
-  std::vector<std::string> m_patterns;
-  std::filesystem::path m_path;
+struct FileTimes {
+  // nanoseconds since the unix epoch
+  int64_t modified = 0;
+  int64_t changed = 0;
 
-public:
-  bool matches(const std::filesystem::path &path) const;
+  bool operator==(const FileTimes &other) const = default;
+
+  std::filesystem::file_time_type lastModified() const;
+
+  static FileTimes fromStat(const struct stat &st);
+};
+
+/**
+ * A walked path, along with the file information gathered while walking it, so that consumers
+ * do not need to stat it again.
+ */
+struct FileSystemEntry {
+  std::filesystem::path path;
+  bool isDirectory = false;
+  // not set if the entry could not be stat'ed
+  std::optional<FileTimes> times;
+  // filesystem the entry belongs to, 0 if it could not be stat'ed
+  dev_t device = 0;
+
+  /**
+   * Stat `path`. Nothing is returned if it does not exist or is a symbolic link, as those are never
+   * walked, unless `followSymlink` is set, which is the case for the root of a walk.
+   */
+  static std::optional<FileSystemEntry> fromPath(const std::filesystem::path &path,
+                                                 bool followSymlink = false);
+};
+
+/**
+ * How the walker goes through a filesystem mounted below the directory it walks, which depends on the type
+ * of the filesystem (see `FileSystemWalker::mountFor`).
+ */
+enum class MountPolicy {
+  // local disks
+  Walk,
+  // removable drives, which get slower when listed concurrently: walked one directory at a time
+  Serial,
+  // network and FUSE filesystems, which can be huge and slow to list: only their first levels are walked, one
+  // directory at a time
+  Shallow,
+  // pseudo filesystems, such as bind mounts of /proc, which hold nothing worth finding
+  Skip,
+};
 
-  const std::vector<std::string> &patterns() const;
-  GitIgnoreReader(const std::filesystem::path &path);
+/**
+ * A mounted filesystem that a walk left out, in part or entirely.
+ */
+struct ExcludedMount {
+  std::filesystem::path path;
+  std::string filesystem;
+  // only the first levels of `Shallow` filesystems are left out
+  MountPolicy policy = MountPolicy::Skip;
+  // left out once listing one of its directories took too long, rather than for its type
+  bool slow = false;
 };
 
 class FileSystemWalker {
+  static constexpr auto PARALLEL_IDLE_WAIT = std::chrono::milliseconds(1);
+  // levels of a filesystem with the `Shallow` policy that are walked, below its mount point
+  static constexpr size_t SHALLOW_MOUNT_DEPTH = 2;
+  // a filesystem that takes longer than that to list a directory is not walked any deeper
+  static constexpr auto SLOW_DIRECTORY_TIMEOUT = std::chrono::seconds(2);
+
+  struct Mount {
+    std::filesystem::path path;
+    std::string filesystem;
+    MountPolicy policy = MountPolicy::Walk;
+    // held while listing a directory of a filesystem that is not walked concurrently
+    std::mutex mutex;
+    std::atomic<bool> slow = false;
+  };
+
   std::vector<std::string> m_ignoreFiles = {".gitignore"};
   bool m_recursive = true;
   bool m_ignoreHiddenFiles = false;
   std::optional<size_t> m_maxDepth;
+  size_t m_threadCount = 1;
+
+  // compiled ignore rules of every directory looked at during the walk, null if it has none
+  mutable std::shared_mutex m_ignoreCacheMutex;
+  mutable std::unordered_map<std::string, std::shared_ptr<const IgnoreRules>, TransparentStringHash,
+                             std::equal_to<>>
+      m_ignoreCache;
+
+  // filesystems found mounted below the walked directories, by device
+  mutable std::mutex m_mountMutex;
+  mutable std::unordered_map<dev_t, std::shared_ptr<Mount>> m_mounts;
+  mutable std::vector<ExcludedMount> m_excludedMounts;
+
+  std::shared_ptr<const IgnoreRules> ignoreRules(std::string_view dir) const;
+  bool isIgnored(const std::filesystem::path &path, bool isDirectory) const;
 
-  bool isIgnored(const std::filesystem::path &path) const;
+  /**
+   * The filesystem of `device`, mounted at `path`. Its policy is picked from its type the first time it is
+   * found, and it is reported as excluded if it is to be skipped.
+   */
+  std::shared_ptr<Mount> mountFor(dev_t device, const std::filesystem::path &path) const;
+  void markSlow(Mount &mount) const;
 
 public:
   using WalkCallback = std::function<void(const std::filesystem::directory_entry &path)>;
+  using EntryCallback = std::function<void(FileSystemEntry &&entry)>;
+  using BatchCallback = std::function<void(std::vector<FileSystemEntry> &&entries)>;
+
+  /**
+   * List the entries of `dir` that should be walked. Entries that are not excluded are stat'ed relative
+   * to the directory file descriptor, which is much cheaper than a later stat of the full path.
+   * Mount points of filesystems with the `Skip` policy are left out, as are symbolic links.
+   * `dir` itself is only opened if it is a symbolic link when `followSymlink` is set, which is the case for
+   * the root of a walk (e.g. an entrypoint pointing to another disk).
+   * This is not recursive.
+   */
+  void readDirectory(const std::filesystem::path &dir, const EntryCallback &fn,
+                     bool followSymlink = false) const;
 
   /**
    * Register specific filenames for them to be considered as ignore files.
@@ -31,17 +139,26 @@ public:
    * Ignore files are used to skip entire directory hierarchies when they match one
    * of the patterns present in these files.
    *
-   * Similary to git, all ignore files located above the path that is being scrutinized are considered.
-   * Relative patterns (without leading '/') are considered with respect to the path location.
+   * Similary to git, all ignore files located above the path that is being scrutinized are considered,
+   * the closest ones taking precedence. Patterns are interpreted following gitignore semantics
+   * (see `IgnoreRules`).
    *
-   * Patterns are interpreted using `fnmatch` which is not exactly conform to the logic git uses
-   * internally. For that reason, very complex patterns may not be interpreted correctly.
-   *
-   * // TODO: consider implementing a gitignore parsing C++ library (I haven't found any).
+   * Ignore files are only parsed once per walk, the compiled rules being cached per directory.
    *
    * By default, we only honor `.gitignore` files.
    */
   void setIgnoreFiles(const std::vector<std::string> &files);
+
+  /**
+   * Whether `path` is named like one of the ignore files.
+   */
+  bool isIgnoreFile(const std::filesystem::path &path) const;
+
+  /**
+   * Drop the cached rules of `dir`, for its ignore files to be read again the next time they are needed.
+   * Walkers that outlive a walk have to do so when an ignore file changes.
+   */
+  void forgetIgnoreRules(const std::filesystem::path &dir);
   void setMaxDepth(std::optional<size_t> maxDepth);
 
   /**
@@ -51,5 +168,34 @@ public:
 
   void setRecursive(bool value);
 
+  /**
+   * Number of threads used by `walkParallel`.
+   */
+  void setThreadCount(size_t count);
+
+  /**
+   * Whether `path` would be skipped by a walk of one of its parent directories, because of its name or of
+   * the ignore files located above it. Only `path` itself is checked, not its parent directories.
+   */
+  bool isExcluded(const std::filesystem::path &path, bool isDirectory) const;
+
   void walk(const std::filesystem::path &path, const WalkCallback &fn);
+
+  /**
+   * Walk `path` using multiple threads, each directory being a separate task.
+   * Every thread works on its own stack of directories and steals from the other threads when it runs out of
+   * work. Walked paths are handed to `fn` in batches of at most `batchSize` paths.
+   *
+   * Filesystems mounted below `path` are walked according to their `MountPolicy`, the one of `path` being
+   * walked entirely. A filesystem that is too slow to list one of its directories is not walked any deeper.
+   *
+   * `fn` is called concurrently from the walker threads and needs to be thread safe.
+   * This function returns once the whole hierarchy has been walked.
+   */
+  void walkParallel(const std::filesystem::path &path, size_t batchSize, const BatchCallback &fn);
+
+  /**
+   * Filesystems that were skipped, or not walked entirely, since the walker was created.
+   */
+  std::vector<ExcludedMount> excludedMounts() const;
 };
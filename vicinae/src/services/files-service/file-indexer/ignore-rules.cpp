@@ -0,0 +1,232 @@
+#include "services/files-service/file-indexer/ignore-rules.hpp"
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+static constexpr std::string_view GLOB_SPECIAL_CHARS = "*?[\\";
+
+/**
+ * Match a character class starting at `p[pi]` (the opening bracket) against `ch`.
+ * Returns the index right after the closing bracket, or `std::string_view::npos` if the class is not
+ * terminated, in which case the bracket is to be interpreted literally.
+ */
+static size_t matchCharacterClass(std::string_view p, size_t pi, char ch, bool &matched) {
+  size_t j = pi + 1;
+  bool negated = j < p.size() && (p[j] == '!' || p[j] == '^');
+
+  if (negated) ++j;
+
+  size_t start = j;
+
+  matched = false;
+
+  // a ']' right after the opening bracket is part of the class
+  while (j < p.size() && (p[j] != ']' || j == start)) {
+    unsigned char lo = p[j];
+
+    if (lo == '\\' && j + 1 < p.size()) lo = p[++j];
+
+    unsigned char hi = lo;
+
+    if (j + 2 < p.size() && p[j + 1] == '-' && p[j + 2] != ']') {
+      hi = p[j + 2];
+      j += 2;
+    }
+
+    if (lo <= static_cast<unsigned char>(ch) && static_cast<unsigned char>(ch) <= hi) matched = true;
+    ++j;
+  }
+
+  if (j >= p.size()) return std::string_view::npos;
+
+  matched = matched != negated && ch != '/';
+
+  return j + 1;
+}
+
+static bool globMatch(std::string_view p, std::string_view t) {
+  size_t pi = 0;
+  size_t ti = 0;
+
+  while (pi < p.size()) {
+    char c = p[pi];
+
+    if (c == '*') {
+      bool doubleStar = pi + 1 < p.size() && p[pi + 1] == '*';
+
+      // '**' only has a special meaning when it spans a full path component
+      if (doubleStar && (pi == 0 || p[pi - 1] == '/') && (pi + 2 == p.size() || p[pi + 2] == '/')) {
+        // trailing '**': everything below
+        if (pi + 2 == p.size()) return true;
+
+        std::string_view rest = p.substr(pi + 3);
+
+        // '**/': zero or more directories
+        for (size_t i = ti;;) {
+          if (globMatch(rest, t.substr(i))) return true;
+
+          size_t slash = t.find('/', i);
+
+          if (slash == std::string_view::npos) return false;
+          i = slash + 1;
+        }
+      }
+
+      while (pi < p.size() && p[pi] == '*') {
+        ++pi;
+      }
+
+      if (pi == p.size()) return t.find('/', ti) == std::string_view::npos;
+
+      for (size_t i = ti; i <= t.size(); ++i) {
+        if (globMatch(p.substr(pi), t.substr(i))) return true;
+        if (i < t.size() && t[i] == '/') return false;
+      }
+
+      return false;
+    }
+
+    if (ti >= t.size()) return false;
+
+    if (c == '?') {
+      if (t[ti] == '/') return false;
+      ++pi;
+      ++ti;
+      continue;
+    }
+
+    if (c == '[') {
+      bool matched = false;
+      size_t next = matchCharacterClass(p, pi, t[ti], matched);
+
+      if (next != std::string_view::npos) {
+        if (!matched) return false;
+        pi = next;
+        ++ti;
+        continue;
+      }
+    }
+
+    if (c == '\\' && pi + 1 < p.size()) c = p[++pi];
+    if (c != t[ti]) return false;
+
+    ++pi;
+    ++ti;
+  }
+
+  return ti == t.size();
+}
+
+void IgnoreRules::addRule(Rule rule) {
+  uint32_t index = m_rules.size();
+  std::string_view pattern = rule.pattern;
+
+  if (pattern.find_first_of(GLOB_SPECIAL_CHARS) == std::string_view::npos) {
+    (rule.anchored ? m_anchoredLiterals : m_literals)[rule.pattern].emplace_back(index);
+  } else if (!rule.anchored && pattern.starts_with("*.") &&
+             pattern.find_first_of(GLOB_SPECIAL_CHARS, 1) == std::string_view::npos) {
+    m_extensions[std::string(pattern.substr(1))].emplace_back(index);
+  } else {
+    m_globs.emplace_back(index);
+  }
+
+  m_rules.emplace_back(std::move(rule));
+}
+
+void IgnoreRules::parse(std::string_view content) {
+  size_t pos = 0;
+
+  while (pos < content.size()) {
+    size_t end = content.find('\n', pos);
+
+    if (end == std::string_view::npos) end = content.size();
+
+    std::string_view line = content.substr(pos, end - pos);
+
+    pos = end + 1;
+
+    if (line.ends_with('\r')) line.remove_suffix(1);
+    if (line.empty() || line.front() == '#') continue;
+
+    // trailing spaces are ignored, unless escaped
+    while (line.ends_with(' ') && !line.ends_with("\\ ")) {
+      line.remove_suffix(1);
+    }
+
+    Rule rule;
+
+    if (line.starts_with('!')) {
+      rule.negated = true;
+      line.remove_prefix(1);
+    } else if (line.starts_with("\\!") || line.starts_with("\\#")) {
+      line.remove_prefix(1);
+    }
+
+    if (line.ends_with('/')) {
+      rule.dirOnly = true;
+      line.remove_suffix(1);
+    }
+
+    rule.anchored = line.find('/') != std::string_view::npos;
+
+    if (line.starts_with('/')) line.remove_prefix(1);
+    if (line.empty()) continue;
+
+    rule.pattern = line;
+    addRule(std::move(rule));
+  }
+}
+
+bool IgnoreRules::load(const fs::path &path) {
+  std::ifstream ifs(path);
+
+  if (!ifs) return false;
+
+  std::stringstream ss;
+
+  ss << ifs.rdbuf();
+  parse(ss.view());
+
+  return true;
+}
+
+IgnoreRules::Verdict IgnoreRules::match(std::string_view relativePath, bool isDirectory) const {
+  std::string_view filename = relativePath.substr(relativePath.rfind('/') + 1);
+  int64_t best = -1;
+
+  auto consider = [&](const RuleIndex &index, std::string_view key) {
+    auto it = index.find(key);
+
+    if (it == index.end()) return;
+
+    for (auto idx = it->second.rbegin(); idx != it->second.rend() && *idx > best; ++idx) {
+      if (m_rules[*idx].dirOnly && !isDirectory) continue;
+      best = *idx;
+      return;
+    }
+  };
+
+  consider(m_literals, filename);
+  consider(m_anchoredLiterals, relativePath);
+
+  for (size_t dot = filename.find('.'); dot != std::string_view::npos; dot = filename.find('.', dot + 1)) {
+    consider(m_extensions, filename.substr(dot));
+  }
+
+  // only globs that come after the best match so far can change the outcome
+  for (auto idx = m_globs.rbegin(); idx != m_globs.rend() && *idx > best; ++idx) {
+    const Rule &rule = m_rules[*idx];
+
+    if (rule.dirOnly && !isDirectory) continue;
+
+    if (globMatch(rule.pattern, rule.anchored ? relativePath : filename)) {
+      best = *idx;
+      break;
+    }
+  }
+
+  if (best < 0) return Verdict::None;
+
+  return m_rules[best].negated ? Verdict::Included : Verdict::Ignored;
+}
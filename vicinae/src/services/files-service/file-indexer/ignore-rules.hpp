@@ -0,0 +1,70 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Allows string keyed maps to be looked up with a string view, without allocating a key.
+ */
+struct TransparentStringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view s) const { return std::hash<std::string_view>()(s); }
+};
+
+/**
+ * Compiled set of rules read from one or more ignore files located in the same directory, following
+ * gitignore semantics:
+ * - Blank lines and lines starting with '#' are skipped
+ * - A leading '!' negates the pattern, re-including previously ignored paths
+ * - A trailing '/' only matches directories
+ * - Patterns containing a '/' are matched against the path relative to the ignore file directory,
+ *   other patterns are matched against the file name only
+ * - '*', '?' and '[...]' never match '/', while '**' matches any number of directories
+ * - The last matching pattern wins
+ *
+ * Rules are compiled once, when they are parsed: literal patterns and simple extension patterns ("*.o")
+ * are hashed, which allows most lookups to be resolved without running the glob matcher at all.
+ */
+class IgnoreRules {
+public:
+  enum class Verdict { None, Ignored, Included };
+
+  /**
+   * Append the rules read from the ignore file at `path`.
+   * Returns false if the file could not be read.
+   */
+  bool load(const std::filesystem::path &path);
+  void parse(std::string_view content);
+
+  /**
+   * `relativePath` is the path relative to the directory the ignore files are in.
+   */
+  Verdict match(std::string_view relativePath, bool isDirectory) const;
+
+  bool empty() const { return m_rules.empty(); }
+
+private:
+  struct Rule {
+    std::string pattern;
+    bool negated = false;
+    bool dirOnly = false;
+    // matched against the full relative path instead of the file name
+    bool anchored = false;
+  };
+
+  // rule indexes, in increasing order
+  using RuleIndex =
+      std::unordered_map<std::string, std::vector<uint32_t>, TransparentStringHash, std::equal_to<>>;
+
+  std::vector<Rule> m_rules;
+  RuleIndex m_literals;
+  RuleIndex m_anchoredLiterals;
+  RuleIndex m_extensions;
+  std::vector<uint32_t> m_globs;
+
+  void addRule(Rule rule);
+};
@@ -2,67 +2,69 @@
 #include "services/files-service/file-indexer/file-indexer-db.hpp"
 #include "services/files-service/file-indexer/filesystem-walker.hpp"
 #include <algorithm>
-#include <ranges>
+#include <stack>
 #include <unordered_set>
 
 namespace fs = std::filesystem;
 
-void IncrementalScanner::processDirectory(const std::filesystem::path &root) {
-  auto indexedFiles = m_db.listIndexedDirectoryFiles(root);
-  std::unordered_set<fs::path> existingFiles(indexedFiles.begin(), indexedFiles.end());
+void IncrementalScanner::processDirectory(const FileSystemEntry &dir, bool isRoot) {
+  auto indexedFiles = m_db.listIndexedDirectoryFiles(dir.path);
   std::unordered_set<fs::path> currentFiles;
+  std::vector<FileSystemEntry> entries;
   std::vector<fs::path> deletedFiles;
-  std::error_code ec;
-
-  currentFiles.insert(root);
-
-  for (const auto &entry : fs::directory_iterator(root, ec)) {
-    if (ec) continue;
 
+  auto onEntry = [&](FileSystemEntry &&entry) {
     // XXX - We may want to differenciate between new files and already existing later
     // especially if we start indexing file content as well.
-    currentFiles.insert(entry.path());
-  }
+    currentFiles.insert(entry.path);
+    entries.emplace_back(std::move(entry));
+  };
+
+  m_walker.readDirectory(dir.path, onEntry, isRoot);
 
   for (const auto &path : indexedFiles) {
     if (currentFiles.find(path) == currentFiles.end()) { deletedFiles.emplace_back(path); }
   }
 
+  m_walkedFileCount += entries.size();
   m_db.deleteIndexedFiles(deletedFiles);
-  m_db.indexFiles(currentFiles | std::ranges::to<std::vector>());
+  m_db.indexFiles(entries);
+  // only now that its content has been indexed
+  m_db.indexFiles({dir}, true);
 }
 
-std::vector<fs::path> IncrementalScanner::getScannableDirectories(const fs::path &path,
-                                                                  std::optional<size_t> maxDepth) const {
-  std::vector<fs::path> scannableDirs;
-  std::error_code ec;
-  FileSystemWalker walker;
+void IncrementalScanner::scan(const fs::path &path, std::optional<size_t> maxDepth) {
+  struct Task {
+    fs::path path;
+    std::optional<FileTimes> indexedTimes;
+    size_t depth = 0;
+  };
 
-  scannableDirs.emplace_back(path);
+  std::stack<Task> tasks;
 
-  walker.setMaxDepth(maxDepth);
-  walker.walk(path, [&](const fs::directory_entry &entry) {
-    if (!entry.is_directory()) return;
+  tasks.push({.path = path, .indexedTimes = m_db.retrieveDirectoryTimes(path)});
 
-    auto lastScanned = m_db.retrieveIndexedLastModified(entry);
+  while (!tasks.empty()) {
+    Task task = std::move(tasks.top());
 
-    if (auto lastModified = fs::last_write_time(entry); lastScanned.has_value() && !ec) {
-      using namespace std::chrono;
-      auto sctp = clock_cast<system_clock>(lastModified);
-      auto lastModifiedDate =
-          QDateTime::fromSecsSinceEpoch(duration_cast<seconds>(sctp.time_since_epoch()).count());
+    tasks.pop();
 
-      if (lastScanned < lastModifiedDate) { scannableDirs.emplace_back(entry.path()); }
-    }
-  });
+    bool isRoot = task.depth == 0;
+    auto dir = FileSystemEntry::fromPath(task.path, isRoot);
 
-  return scannableDirs;
-}
+    ++m_walkedFileCount;
 
-void IncrementalScanner::scan(const fs::path &path, std::optional<size_t> maxDepth) {
-  for (const auto &dir : getScannableDirectories(path, maxDepth)) {
-    processDirectory(dir);
+    // directories that are gone are deleted when their parent gets listed again
+    if (!dir || !dir->isDirectory) continue;
+
+    if (!dir->times || dir->times != task.indexedTimes) { processDirectory(*dir, isRoot); }
+    if (maxDepth && task.depth >= *maxDepth) continue;
+
+    for (auto &subdir : m_db.listIndexedSubdirectories(task.path)) {
+      tasks.push({.path = std::move(subdir.path), .indexedTimes = subdir.times, .depth = task.depth + 1});
+    }
   }
 }
 
-IncrementalScanner::IncrementalScanner(FileIndexerDatabase &db) : m_db(db) {}
+IncrementalScanner::IncrementalScanner(FileIndexerDatabase &db, std::atomic<size_t> &walkedFileCount)
+    : m_db(db), m_walkedFileCount(walkedFileCount) {}
@@ -1,17 +1,29 @@
 #pragma once
 #include "common.hpp"
 #include "services/files-service/file-indexer/file-indexer-db.hpp"
+#include "services/files-service/file-indexer/filesystem-walker.hpp"
+#include <atomic>
 #include <qsqldatabase.h>
 #include <filesystem>
 
+/**
+ * Brings the index up to date with the filesystem, without listing every directory again.
+ *
+ * A directory's times change whenever an entry is added to or removed from it, so only directories whose
+ * times differ from the ones recorded when they were last listed need to be listed again. Unchanged
+ * directories are descended into using the subdirectories known to the index, which means a single
+ * stat and index lookup per directory for an unchanged tree.
+ */
 class IncrementalScanner : public NonCopyable {
   FileIndexerDatabase &m_db;
+  FileSystemWalker m_walker;
+  // incremented for every entry that gets stat'ed
+  std::atomic<size_t> &m_walkedFileCount;
 
-  std::vector<std::filesystem::path> getScannableDirectories(const std::filesystem::path &path,
-                                                             std::optional<size_t> maxDepth) const;
-  void processDirectory(const std::filesystem::path &path);
+  // `isRoot` is set for the directory the scan starts from, which can be a symbolic link
+  void processDirectory(const FileSystemEntry &dir, bool isRoot);
 
 public:
   void scan(const std::filesystem::path &path, std::optional<size_t> maxDepth);
-  IncrementalScanner(FileIndexerDatabase &db);
+  IncrementalScanner(FileIndexerDatabase &db, std::atomic<size_t> &walkedFileCount);
 };
@@ -3,53 +3,174 @@
 #include "services/files-service/file-indexer/file-indexer.hpp"
 #include "services/files-service/file-indexer/filesystem-walker.hpp"
 #include "services/files-service/file-indexer/incremental-scanner.hpp"
+#include "trace/trace.hpp"
+#include <algorithm>
+#include <iterator>
 #include <qlogging.h>
+#include <thread>
 
 namespace fs = std::filesystem;
 
+void IndexerMetrics::recordWrite(std::chrono::microseconds duration) {
+  int64_t us = duration.count();
+  int64_t max = maxWriteTimeUs;
+
+  while (us > max && !maxWriteTimeUs.compare_exchange_weak(max, us)) {}
+
+  lastWriteTimeUs = us;
+  totalWriteTimeUs += us;
+  ++writtenBatchCount;
+}
+
 void IndexerScanner::stop() {
   m_alive = false;
-  m_scanCv.notify_one();
+  // paused walker threads wait on the scan condition as well
+  m_scanCv.notify_all();
+  m_contentIndexer.stop();
+  if (m_contentThread.joinable()) m_contentThread.join();
   m_writerThread.join();
 }
 
-void IndexerScanner::enqueueBatch(const std::vector<std::filesystem::path> &paths) {
-  bool shouldWait = true;
+size_t IndexerScanner::defaultScanThreadCount() {
+  // walking is mostly I/O bound, half the cores is enough to keep fast drives busy
+  return std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 1, 8);
+}
 
-  while (shouldWait) {
-    {
-      std::lock_guard lock(m_batchMutex);
+void IndexerScanner::setScanThreadCount(size_t count) {
+  m_scanThreadCount = std::max<size_t>(1, count);
+  m_contentIndexer.setThreadCount(m_scanThreadCount);
+}
+
+void IndexerScanner::setSchedulingMode(IndexerScheduler::Mode mode) { m_scheduler.setMode(mode); }
+
+void IndexerScanner::enqueueBatch(WriteBatch batch, bool applyBackpressure) {
+  {
+    std::unique_lock lock(m_batchMutex);
+
+    // walkers hand out small batches, merge them until they reach the size the writer is most efficient at
+    if (batch.kind == WriteBatch::Kind::Index && !m_writeBatches.empty()) {
+      auto &last = m_writeBatches.back();
 
-      /**
-       * handle backpressure by waiting if too many batches are queued
-       */
-      shouldWait = m_writeBatches.size() >= MAX_PENDING_BATCH_COUNT;
-      if (!shouldWait) { m_writeBatches.emplace_back(paths); }
+      if (last.kind == WriteBatch::Kind::Index && last.recordDirectoryTimes == batch.recordDirectoryTimes &&
+          last.entries.size() + batch.entries.size() <= m_scheduler.batchSize()) {
+        last.entries.insert(last.entries.end(), std::make_move_iterator(batch.entries.begin()),
+                            std::make_move_iterator(batch.entries.end()));
+        return;
+      }
     }
 
-    if (shouldWait) {
+    /**
+     * handle backpressure by waiting if too many batches are queued
+     */
+    if (applyBackpressure && m_writeBatches.size() >= MAX_PENDING_BATCH_COUNT) {
       qDebug() << "Handling backpressure: too many batched";
-      std::this_thread::sleep_for(std::chrono::milliseconds(BACKPRESSURE_WAIT_MS));
+
+      auto startedAt = std::chrono::steady_clock::now();
+
+      while (m_writeBatches.size() >= MAX_PENDING_BATCH_COUNT) {
+        m_drainCv.wait_for(lock, std::chrono::milliseconds(BACKPRESSURE_WAIT_MS));
+      }
+
+      m_metrics.backpressureWaitTimeMs += std::chrono::duration_cast<std::chrono::milliseconds>(
+                                              std::chrono::steady_clock::now() - startedAt)
+                                              .count();
     }
+
+    m_writeBatches.emplace_back(std::move(batch));
   }
 
   m_batchCv.notify_one();
 }
 
+void IndexerScanner::waitWhilePaused() {
+  std::unique_lock lock(m_scanMutex);
+
+  while (m_alive && m_scheduler.shouldPause()) {
+    m_scanCv.wait_for(lock, PAUSE_POLL_INTERVAL);
+  }
+}
+
+void IndexerScanner::enqueueIndex(std::vector<FileSystemEntry> entries) {
+  if (entries.empty()) return;
+  enqueueBatch({.kind = WriteBatch::Kind::Index, .entries = std::move(entries)});
+}
+
+void IndexerScanner::enqueueDeletion(std::vector<fs::path> paths) {
+  if (paths.empty()) return;
+  enqueueBatch({.kind = WriteBatch::Kind::Delete, .paths = std::move(paths)});
+}
+
+void IndexerScanner::enqueueFileOpen(const fs::path &path) {
+  enqueueBatch({.kind = WriteBatch::Kind::RecordOpen, .paths = {path}}, false);
+}
+
+void IndexerScanner::enqueueSubstringIndex(bool enabled) {
+  auto kind = enabled ? WriteBatch::Kind::CreateSubstringIndex : WriteBatch::Kind::DropSubstringIndex;
+
+  enqueueBatch({.kind = kind}, false);
+}
+
+void IndexerScanner::setContentRoots(std::vector<fs::path> roots) {
+  m_contentIndexer.setRoots(roots);
+  enqueueBatch({.kind = WriteBatch::Kind::PruneContent, .paths = std::move(roots)}, false);
+}
+
+void IndexerScanner::enqueueContentRefresh(const fs::path &path) {
+  enqueueBatch({.kind = WriteBatch::Kind::RefreshContent, .paths = {path}}, false);
+}
+
+void IndexerScanner::enqueueContents(std::vector<FileIndexerDatabase::FileContent> contents) {
+  if (contents.empty()) return;
+  enqueueBatch({.kind = WriteBatch::Kind::IndexContent, .contents = std::move(contents)});
+}
+
+void IndexerScanner::enqueueShrinkMemory() { enqueueBatch({.kind = WriteBatch::Kind::ShrinkMemory}, false); }
+
+void IndexerScanner::setFilenameIndexEnabled(bool enabled) {
+  if (m_filenameIndex.enabled() == enabled) return;
+
+  m_filenameIndex.setEnabled(enabled);
+
+  if (enabled) {
+    requestFilenameIndexRewrite();
+  } else {
+    enqueueBatch({.kind = WriteBatch::Kind::DropFilenameIndex}, false);
+  }
+}
+
+void IndexerScanner::requestFilenameIndexRewrite() {
+  if (m_filenameIndex.requestRewrite()) {
+    enqueueBatch({.kind = WriteBatch::Kind::RewriteFilenameIndex}, false);
+  }
+}
+
 void IndexerScanner::scan(const std::filesystem::path &root) {
-  std::vector<fs::path> batchedIndex;
+  TraceScope trace("indexer", "full scan");
   FileSystemWalker walker;
 
-  walker.walk(root, [&](const fs::directory_entry &entry) {
-    batchedIndex.emplace_back(entry);
+  // batches get merged up to the size picked by the scheduler when they are enqueued
+  size_t batchSize = m_scheduler.mode() == IndexerScheduler::Mode::Adaptive ? IndexerScheduler::MIN_BATCH_SIZE
+                                                                           : m_scheduler.batchSize();
 
-    if (batchedIndex.size() > INDEX_BATCH_SIZE) {
-      enqueueBatch(batchedIndex);
-      batchedIndex.clear();
-    }
+  walker.setThreadCount(m_scanThreadCount);
+  // every walked directory gets listed as well, as full scans are not depth limited
+  walker.walkParallel(root, batchSize, [&](std::vector<FileSystemEntry> &&entries) {
+    TraceScope trace("indexer", "enqueue batch");
+
+    waitWhilePaused();
+    m_metrics.walkedFileCount += entries.size();
+    enqueueBatch(
+        {.kind = WriteBatch::Kind::Index, .entries = std::move(entries), .recordDirectoryTimes = true});
   });
 
-  enqueueBatch(batchedIndex);
+  for (const auto &mount : walker.excludedMounts()) {
+    const char *reason = mount.slow ? "as it is too slow to list"
+                         : mount.policy == MountPolicy::Shallow ? "below its first levels"
+                                                                : "";
+
+    qInfo() << "Full scan of" << root.c_str() << "left out the" << mount.filesystem.c_str()
+            << "filesystem mounted at" << mount.path.c_str() << reason;
+  }
 }
 
 void IndexerScanner::enqueueFull(const std::filesystem::path &path) {
@@ -60,23 +181,81 @@ void IndexerScanner::enqueue(const std::filesystem::path &path, FileIndexerDatab
                              std::optional<size_t> maxDepth) {
   {
     std::lock_guard lock(m_scanMutex);
-    m_scanPaths.push(EnqueuedScan{.type = type, .path = path, .maxDepth = maxDepth});
+    m_scanPaths.push_back(EnqueuedScan{.type = type, .path = path, .maxDepth = maxDepth});
   }
   m_scanCv.notify_one();
 }
 
+void IndexerScanner::beginScanProgress(const EnqueuedScan &scan) {
+  m_currentScan = scan;
+  m_currentScanStartedAt = std::chrono::steady_clock::now();
+  m_currentScanWalkedBase = m_metrics.walkedFileCount;
+}
+
+size_t IndexerScanner::endScanProgress() {
+  std::lock_guard lock(m_scanMutex);
+  size_t walked = m_metrics.walkedFileCount - m_currentScanWalkedBase;
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_currentScanStartedAt;
+
+  if (elapsed.count() > 0) { m_lastScanRate = walked / elapsed.count(); }
+  m_currentScan.reset();
+
+  return walked;
+}
+
+IndexerScanner::Progress IndexerScanner::progress() {
+  Progress progress;
+
+  {
+    std::lock_guard lock(m_scanMutex);
+
+    progress.current = m_currentScan;
+    progress.pending.assign(m_scanPaths.begin(), m_scanPaths.end());
+    progress.filesPerSecond = m_lastScanRate;
+
+    if (m_currentScan) {
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_currentScanStartedAt;
+
+      progress.walkedFileCount = m_metrics.walkedFileCount - m_currentScanWalkedBase;
+      if (elapsed.count() > 0) { progress.filesPerSecond = progress.walkedFileCount / elapsed.count(); }
+    }
+  }
+
+  {
+    std::lock_guard lock(m_batchMutex);
+    progress.queuedBatchCount = m_writeBatches.size();
+  }
+
+  return progress;
+}
+
 void IndexerScanner::run() {
   m_db = std::make_unique<FileIndexerDatabase>();
-  m_writerWorker = std::make_unique<WriterWorker>(m_batchMutex, m_writeBatches, m_batchCv);
+  // the writer and walker threads inherit the scheduling classes of this thread
+  m_scheduler.applyToCurrentThread();
+  m_writerWorker = std::make_unique<WriterWorker>(m_batchMutex, m_writeBatches, m_batchCv, m_drainCv,
+                                                  m_metrics, m_scheduler, m_filenameIndex, m_contentIndexer);
   m_writerThread = std::thread([&]() { m_writerWorker->run(); });
+  m_contentIndexer.setThreadCount(m_scanThreadCount);
+  m_contentThread = std::thread([&]() { m_contentIndexer.run(); });
 
   while (m_alive) {
     EnqueuedScan sc;
     {
       std::unique_lock<std::mutex> lock(m_scanMutex);
       m_scanCv.wait(lock, [&]() { return !m_scanPaths.empty(); });
+    }
+
+    // the scan stays pending while paused
+    waitWhilePaused();
+    // the scheduling mode may have changed since the last scan
+    m_scheduler.applyToCurrentThread();
+
+    {
+      std::unique_lock<std::mutex> lock(m_scanMutex);
       sc = m_scanPaths.front();
-      m_scanPaths.pop();
+      m_scanPaths.pop_front();
+      beginScanProgress(sc);
     }
 
     auto result = m_db->createScan(sc.path, sc.type);
@@ -84,6 +263,7 @@ void IndexerScanner::run() {
     if (!result) {
       qWarning() << "Not scanning" << sc.path << "because scan record creation failed with error"
                  << result.error();
+      endScanProgress();
       continue;
     }
 
@@ -92,14 +272,26 @@ void IndexerScanner::run() {
     m_db->updateScanStatus(scanRecord.id, FileIndexerDatabase::ScanStatus::Started);
 
     switch (sc.type) {
-    case FileIndexerDatabase::ScanType::Full:
+    case FileIndexerDatabase::ScanType::Full: {
+      // populating an empty index is a lot faster when the full text index is built once at the end
+      bool bulk = !m_db->hasIndexedFiles();
+
+      if (bulk) { enqueueBatch({.kind = WriteBatch::Kind::BeginBulkLoad}); }
       scan(sc.path);
+      if (bulk) { enqueueBatch({.kind = WriteBatch::Kind::EndBulkLoad}); }
       break;
+    }
     case FileIndexerDatabase::ScanType::Incremental:
-      IncrementalScanner(*m_db.get()).scan(sc.path, sc.maxDepth);
+      IncrementalScanner(*m_db.get(), m_metrics.walkedFileCount).scan(sc.path, sc.maxDepth);
       break;
     }
 
+    // contents are refreshed from the index, once the writer is done with the scan
+    for (const auto &path : m_contentIndexer.treesToRefresh(sc.path)) {
+      enqueueContentRefresh(path);
+    }
+
+    m_db->setScanIndexedFileCount(scanRecord.id, endScanProgress());
     m_db->updateScanStatus(scanRecord.id, FileIndexerDatabase::ScanStatus::Finished);
   }
 }
@@ -1,10 +1,30 @@
 #pragma once
 #include "common.hpp"
+#include "services/files-service/file-indexer/content-indexer.hpp"
 #include "services/files-service/file-indexer/file-indexer-db.hpp"
-#include <queue>
+#include "services/files-service/file-indexer/filename-index.hpp"
+#include "services/files-service/file-indexer/filesystem-walker.hpp"
+#include "services/files-service/file-indexer/indexer-scheduler.hpp"
+#include <atomic>
+#include <chrono>
+#include <deque>
 
 class WriterWorker;
 
+/**
+ * Counters updated by the scanner, walker and writer threads as they go, readable from any thread.
+ */
+struct IndexerMetrics {
+  std::atomic<size_t> walkedFileCount = 0;
+  std::atomic<size_t> writtenBatchCount = 0;
+  std::atomic<int64_t> totalWriteTimeUs = 0;
+  std::atomic<int64_t> lastWriteTimeUs = 0;
+  std::atomic<int64_t> maxWriteTimeUs = 0;
+  std::atomic<int64_t> backpressureWaitTimeMs = 0;
+
+  void recordWrite(std::chrono::microseconds duration);
+};
+
 class IndexerScanner : public NonCopyable {
 public:
   struct EnqueuedScan {
@@ -13,28 +33,154 @@ public:
     std::optional<size_t> maxDepth;
   };
 
+  struct WriteBatch {
+    // bulk load markers and index changes carry no data, see `FileIndexerDatabase::beginBulkLoad`,
+    // `FileIndexerDatabase::createSubstringIndex` and `FilenameIndex`
+    enum class Kind {
+      Index,
+      Delete,
+      RecordOpen,
+      IndexContent,
+      RefreshContent,
+      PruneContent,
+      BeginBulkLoad,
+      EndBulkLoad,
+      CreateSubstringIndex,
+      DropSubstringIndex,
+      RewriteFilenameIndex,
+      DropFilenameIndex,
+      ShrinkMemory
+    };
+
+    Kind kind = Kind::Index;
+    // to index
+    std::vector<FileSystemEntry> entries;
+    // the directories in `entries` are walked as well, see `FileIndexerDatabase::indexFiles`
+    bool recordDirectoryTimes = false;
+    // to delete, or to record as opened. Trees to refresh the content of, or content roots to keep
+    std::vector<std::filesystem::path> paths;
+    // file contents to index
+    std::vector<FileIndexerDatabase::FileContent> contents;
+  };
+
+  struct Progress {
+    std::optional<EnqueuedScan> current;
+    // entries walked by the current scan so far
+    size_t walkedFileCount = 0;
+    // walk rate of the current scan, or of the last one if no scan is running
+    double filesPerSecond = 0;
+    std::vector<EnqueuedScan> pending;
+    size_t queuedBatchCount = 0;
+  };
+
 private:
-  static constexpr size_t INDEX_BATCH_SIZE = 10'000;
   static constexpr size_t MAX_PENDING_BATCH_COUNT = 10;
   static constexpr size_t BACKPRESSURE_WAIT_MS = 100;
+  static constexpr auto PAUSE_POLL_INTERVAL = std::chrono::seconds(5);
   std::unique_ptr<FileIndexerDatabase> m_db;
+  IndexerMetrics m_metrics;
+  IndexerScheduler m_scheduler;
+  FilenameIndex m_filenameIndex;
+  ContentIndexer m_contentIndexer{*this, m_scheduler};
+  std::thread m_contentThread;
 
   std::atomic<bool> m_alive = true;
-  std::deque<std::vector<std::filesystem::path>> m_writeBatches;
+  std::atomic<size_t> m_scanThreadCount = defaultScanThreadCount();
+  std::deque<WriteBatch> m_writeBatches;
   std::mutex m_batchMutex;
   std::condition_variable m_batchCv;
+  // notified by the writer when it takes the queued batches
+  std::condition_variable m_drainCv;
 
-  std::queue<EnqueuedScan> m_scanPaths;
+  std::deque<EnqueuedScan> m_scanPaths;
   std::mutex m_scanMutex;
   std::condition_variable m_scanCv;
 
+  // guarded by m_scanMutex
+  std::optional<EnqueuedScan> m_currentScan;
+  std::chrono::steady_clock::time_point m_currentScanStartedAt;
+  size_t m_currentScanWalkedBase = 0;
+  double m_lastScanRate = 0;
+
   std::unique_ptr<WriterWorker> m_writerWorker;
   std::thread m_writerThread;
 
   void scan(const std::filesystem::path &path);
-  void enqueueBatch(const std::vector<std::filesystem::path> &paths);
+  void enqueueBatch(WriteBatch batch, bool applyBackpressure = true);
+  // blocks the calling thread for as long as the scheduler asks for scans to be paused
+  void waitWhilePaused();
+  // called with m_scanMutex held
+  void beginScanProgress(const EnqueuedScan &scan);
+  // returns the number of entries walked by the scan
+  size_t endScanProgress();
 
 public:
+  static size_t defaultScanThreadCount();
+
+  /**
+   * Number of threads used to walk the filesystem during full scans. Takes effect on the next scan.
+   * Lower values reduce the load the indexer puts on the system, e.g when running on battery.
+   */
+  void setScanThreadCount(size_t count);
+
+  /**
+   * See `IndexerScheduler`. Scheduling classes are applied to the indexing threads on the next scan.
+   */
+  void setSchedulingMode(IndexerScheduler::Mode mode);
+
+  const IndexerMetrics &metrics() const { return m_metrics; }
+  FilenameIndex &filenameIndex() { return m_filenameIndex; }
+  ContentIndexer &contentIndexer() { return m_contentIndexer; }
+  Progress progress();
+
+  /**
+   * Index or delete a specific set of paths, without scanning anything. Meant to be used to apply
+   * changes reported by the filesystem. Writes are applied in the order they were enqueued.
+   */
+  void enqueueIndex(std::vector<FileSystemEntry> entries);
+  void enqueueDeletion(std::vector<std::filesystem::path> paths);
+
+  /**
+   * Record that the user opened the file at `path`. Never blocks, as it is called from the UI thread.
+   */
+  void enqueueFileOpen(const std::filesystem::path &path);
+
+  /**
+   * Create or drop the substring index, see `FileIndexerDatabase::createSubstringIndex`.
+   */
+  void enqueueSubstringIndex(bool enabled);
+
+  /**
+   * Enable or disable the filename index, see `FilenameIndex`.
+   */
+  void setFilenameIndexEnabled(bool enabled);
+
+  /**
+   * Have the writer write a new filename index snapshot, unless one is already on its way.
+   */
+  void requestFilenameIndexRewrite();
+
+  /**
+   * Index the text content of the files below `roots`, see `ContentIndexer`. The content of the files below
+   * other paths is dropped.
+   */
+  void setContentRoots(std::vector<std::filesystem::path> roots);
+
+  /**
+   * Have the content of the stale files below `path` read again, once the writes queued so far are done.
+   */
+  void enqueueContentRefresh(const std::filesystem::path &path);
+
+  /**
+   * Hand file contents over to the writer. Blocks when too many writes are queued already.
+   */
+  void enqueueContents(std::vector<FileIndexerDatabase::FileContent> contents);
+
+  /**
+   * Have the writer release the page cache of its connection.
+   */
+  void enqueueShrinkMemory();
+
   void enqueueFull(const std::filesystem::path &path);
   void enqueue(const std::filesystem::path &path,
                FileIndexerDatabase::ScanType type = FileIndexerDatabase::ScanType::Incremental,
@@ -0,0 +1,121 @@
+#include "services/files-service/file-indexer/indexer-scheduler.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <linux/ioprio.h>
+#include <qlogging.h>
+#include <sched.h>
+#include <string>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+static std::string readSysfsValue(const fs::path &path) {
+  std::ifstream ifs(path);
+  std::string value;
+
+  std::getline(ifs, value);
+
+  return value;
+}
+
+bool IndexerScheduler::isOnBattery() {
+  std::error_code ec;
+  bool discharging = false;
+
+  for (const auto &entry : fs::directory_iterator("/sys/class/power_supply", ec)) {
+    std::string type = readSysfsValue(entry.path() / "type");
+
+    if (type == "Mains" || type == "USB") {
+      if (readSysfsValue(entry.path() / "online") == "1") return false;
+    } else if (type == "Battery" && readSysfsValue(entry.path() / "scope") != "Device") {
+      // batteries of peripherals (mice, headsets...) report a "Device" scope
+      discharging = discharging || readSysfsValue(entry.path() / "status") == "Discharging";
+    }
+  }
+
+  // not every laptop exposes its adapter, but batteries always report whether they are discharging
+  return discharging;
+}
+
+double IndexerScheduler::loadPerCore() {
+  double load = 0;
+
+  if (getloadavg(&load, 1) != 1) return 0;
+
+  return load / std::max(1u, std::thread::hardware_concurrency());
+}
+
+void IndexerScheduler::setMode(Mode mode) { m_mode = mode; }
+
+void IndexerScheduler::applyToCurrentThread() const {
+  bool adaptive = m_mode == Mode::Adaptive;
+  sched_param param{.sched_priority = 0};
+  // no explicit class means the I/O priority derives from the CPU niceness
+  int ioprio = adaptive ? IOPRIO_PRIO_VALUE(IOPRIO_CLASS_IDLE, 0) : IOPRIO_PRIO_VALUE(IOPRIO_CLASS_NONE, 0);
+
+  // both apply to the calling thread only, 0 standing for the calling thread
+  if (sched_setscheduler(0, adaptive ? SCHED_IDLE : SCHED_OTHER, &param) != 0) {
+    qWarning() << "Failed to set indexer thread scheduling policy:" << strerror(errno);
+  }
+
+  if (syscall(SYS_ioprio_set, IOPRIO_WHO_PROCESS, 0, ioprio) != 0) {
+    qWarning() << "Failed to set indexer thread I/O priority:" << strerror(errno);
+  }
+}
+
+size_t IndexerScheduler::batchSize() const {
+  if (m_mode == Mode::Normal) return DEFAULT_BATCH_SIZE;
+
+  return m_batchSize;
+}
+
+void IndexerScheduler::recordWrite(size_t entryCount, std::chrono::microseconds duration) {
+  if (entryCount == 0) return;
+
+  double cost = static_cast<double>(duration.count()) / entryCount;
+
+  if (m_writeCostPerEntryUs == 0) {
+    m_writeCostPerEntryUs = cost;
+  } else {
+    m_writeCostPerEntryUs = WRITE_COST_SMOOTHING * cost + (1 - WRITE_COST_SMOOTHING) * m_writeCostPerEntryUs;
+  }
+
+  if (m_writeCostPerEntryUs <= 0) return;
+
+  double target = std::chrono::microseconds(TARGET_BATCH_WRITE_TIME).count() / m_writeCostPerEntryUs;
+
+  m_batchSize = std::clamp(static_cast<size_t>(target), MIN_BATCH_SIZE, MAX_BATCH_SIZE);
+}
+
+bool IndexerScheduler::shouldPause() {
+  if (m_mode == Mode::Normal) return false;
+
+  std::lock_guard lock(m_checkMutex);
+  auto now = std::chrono::steady_clock::now();
+
+  if (m_lastCheckAt && now - *m_lastCheckAt < SYSTEM_CHECK_INTERVAL) return m_paused;
+
+  m_lastCheckAt = now;
+
+  bool onBattery = isOnBattery();
+  double load = loadPerCore();
+  bool busy = load > (m_paused ? NORMAL_LOAD_PER_CORE : HIGH_LOAD_PER_CORE);
+  bool paused = onBattery || busy;
+
+  if (paused && !m_paused) {
+    qInfo() << "Pausing file indexing:" << (onBattery ? "running on battery" : "system is busy")
+            << "( load per core:" << load << ")";
+  } else if (!paused && m_paused) {
+    qInfo() << "Resuming file indexing";
+  }
+
+  m_paused = paused;
+
+  return m_paused;
+}
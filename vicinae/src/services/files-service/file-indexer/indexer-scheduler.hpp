@@ -0,0 +1,73 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+
+/**
+ * Decides how hard background indexing is allowed to push the system.
+ *
+ * In adaptive mode, indexing threads run in the idle CPU and I/O scheduling classes, so that they only get
+ * the disk and CPU time nothing else wants: a running build is not slowed down by a full scan. Write
+ * batches are sized so that writing one takes about `TARGET_BATCH_WRITE_TIME`, which keeps the write
+ * transactions short on slow drives while avoiding per transaction overhead on fast ones. Scans are paused
+ * entirely while running on battery, or while the system is already busy.
+ *
+ * In normal mode, indexing runs with the default priorities and a fixed batch size.
+ */
+class IndexerScheduler {
+public:
+  enum class Mode { Normal, Adaptive };
+
+  static constexpr size_t DEFAULT_BATCH_SIZE = 10'000;
+  static constexpr size_t MIN_BATCH_SIZE = 500;
+  static constexpr size_t MAX_BATCH_SIZE = 50'000;
+  static constexpr auto TARGET_BATCH_WRITE_TIME = std::chrono::milliseconds(200);
+
+private:
+  static constexpr auto SYSTEM_CHECK_INTERVAL = std::chrono::seconds(10);
+  // scans pause above this one minute load average per core, and resume below the lower one
+  static constexpr double HIGH_LOAD_PER_CORE = 1.0;
+  static constexpr double NORMAL_LOAD_PER_CORE = 0.75;
+  // weight of the last write in the write cost average
+  static constexpr double WRITE_COST_SMOOTHING = 0.3;
+
+  std::atomic<Mode> m_mode = Mode::Adaptive;
+  std::atomic<size_t> m_batchSize = DEFAULT_BATCH_SIZE;
+  // only accessed from the writer thread
+  double m_writeCostPerEntryUs = 0;
+
+  std::mutex m_checkMutex;
+  std::optional<std::chrono::steady_clock::time_point> m_lastCheckAt;
+  bool m_paused = false;
+
+  static bool isOnBattery();
+  static double loadPerCore();
+
+public:
+  Mode mode() const { return m_mode; }
+  void setMode(Mode mode);
+
+  /**
+   * Apply the scheduling classes of the current mode to the calling thread.
+   * Threads created afterwards by the calling thread inherit them.
+   */
+  void applyToCurrentThread() const;
+
+  /**
+   * Number of entries to write per batch.
+   */
+  size_t batchSize() const;
+
+  /**
+   * Record the time it took to write a batch of `entryCount` entries, from which batch sizes are derived.
+   */
+  void recordWrite(size_t entryCount, std::chrono::microseconds duration);
+
+  /**
+   * Whether scans should currently be paused. The state of the system is checked at most every
+   * `SYSTEM_CHECK_INTERVAL`.
+   */
+  bool shouldPause();
+};
@@ -1,5 +1,6 @@
 #include "relevancy-scorer.hpp"
 #include "utils/utils.hpp"
+#include <chrono>
 #include <filesystem>
 #include <qlocale.h>
 #include <sys/select.h>
@@ -77,21 +78,54 @@ double RelevancyScorer::computePathDepthMultiplier(const std::filesystem::path &
   return 0.7;
 }
 
-double RelevancyScorer::computeRecencyMultiplier(std::filesystem::file_time_type lastModified) {
-  auto now = std::filesystem::file_time_type::clock::now();
-  auto duration = now - lastModified;
-  auto days = std::chrono::duration_cast<std::chrono::days>(duration).count();
+/**
+ * Multiplier applied to a file depending on how long ago something happened to it: the multiplier of the
+ * first bucket whose age is not exceeded is used, or the fallback one if the file is older than all of them.
+ */
+struct AgeBucket {
+  std::chrono::seconds maxAge;
+  double multiplier;
+};
+
+// clang-format off
+static const std::vector<AgeBucket> MODIFICATION_AGE_BUCKETS = {
+	{std::chrono::days(7), 1.3},
+	{std::chrono::days(30), 1.1},
+	{std::chrono::days(90), 1.0},
+	{std::chrono::days(365), 0.9},
+};
+static constexpr double OLD_MODIFICATION_MULTIPLIER = 0.8;
+
+static const std::vector<AgeBucket> OPEN_AGE_BUCKETS = {
+	{std::chrono::days(1), 1.0},
+	{std::chrono::days(7), 0.7},
+	{std::chrono::days(30), 0.4},
+};
+static constexpr double OLD_OPEN_MULTIPLIER = 0.2;
+// clang-format on
+
+// boost given to the most opened files, approached as the open count grows
+static constexpr double MAX_OPEN_BOOST = 2.0;
+// open count at which half of the boost is given
+static constexpr double HALF_OPEN_BOOST_COUNT = 3.0;
 
-  if (days <= 7) return 1.3;
-  if (days <= 30) return 1.1;
-  if (days <= 90) return 1.0;
-  if (days <= 365) return 0.9;
+static QString ageMultiplierExpression(const QString &column, const std::vector<AgeBucket> &buckets,
+                                       double fallback) {
+  QString expr = "CASE";
 
-  return 0.8;
+  for (const auto &bucket : buckets) {
+    expr += QString(" WHEN clock.now - %1 <= %2 THEN %3")
+                .arg(column)
+                .arg(bucket.maxAge.count())
+                .arg(bucket.multiplier);
+  }
+
+  expr += QString(" ELSE %1 END").arg(fallback);
+
+  return expr;
 }
 
-double RelevancyScorer::computeScore(const std::filesystem::path &path,
-                                     std::optional<std::filesystem::file_time_type> lastModified) {
+double RelevancyScorer::computeScore(const std::filesystem::path &path) {
   double score = 1.0;
 
   // 1. Location-based scoring
@@ -106,8 +140,28 @@ double RelevancyScorer::computeScore(const std::filesystem::path &path,
   // 4. Path depth penalty
   score *= computePathDepthMultiplier(path);
 
-  // 5. Recency bonus (if modification time available)
-  if (lastModified.has_value()) { score *= computeRecencyMultiplier(lastModified.value()); }
-
   return std::max(0.1, score); // Minimum score of 0.1
 }
+
+QString RelevancyScorer::rankExpression(const QString &ftsTable) {
+  // bm25 is negative, lower values being better matches
+  return QString("-bm25(%1) * %2").arg(ftsTable, metadataRankExpression());
+}
+
+QString RelevancyScorer::metadataRankExpression() {
+  QString modification = ageMultiplierExpression("f.last_modified_at", MODIFICATION_AGE_BUCKETS,
+                                                 OLD_MODIFICATION_MULTIPLIER);
+  QString open = ageMultiplierExpression("o.last_opened_at", OPEN_AGE_BUCKETS, OLD_OPEN_MULTIPLIER);
+
+  // constants are formatted with a decimal point so that sqlite does not perform integer divisions
+  QString openBoost = QString("%1 * o.open_count / (o.open_count + %2) * %3")
+                          .arg(MAX_OPEN_BOOST, 0, 'f', 1)
+                          .arg(HALF_OPEN_BOOST_COUNT, 0, 'f', 1)
+                          .arg(open);
+
+  return QString("f.relevancy_score"
+                 " * (CASE WHEN f.last_modified_at IS NULL THEN 1.0 ELSE %1 END)"
+                 " * (1.0 + CASE WHEN o.open_count IS NULL THEN 0.0 ELSE %2 END)")
+      .arg(modification)
+      .arg(openBoost);
+}
@@ -1,14 +1,33 @@
 #pragma once
 #include <filesystem>
+#include <qstring.h>
 
+/**
+ * Ranks indexed files.
+ *
+ * Multipliers that only depend on the path of a file are combined once, when the file is indexed, into its
+ * stored relevancy score. Multipliers that change over time (how recently the file was modified, how often
+ * and how recently it was opened from the search results) are applied at query time, together with the
+ * full text rank of the match, see `rankExpression`.
+ */
 class RelevancyScorer {
   double computeLocationMultiplier(const std::filesystem::path &path);
   double computeFileTypeMultiplier(const std::filesystem::path &path);
   double computeHiddenFileMultiplier(const std::filesystem::path &path);
   double computePathDepthMultiplier(const std::filesystem::path &path);
-  double computeRecencyMultiplier(const std::filesystem::file_time_type lastModified);
 
 public:
-  double computeScore(const std::filesystem::path &path,
-                      std::optional<std::filesystem::file_time_type> lastModified);
+  double computeScore(const std::filesystem::path &path);
+
+  /**
+   * SQL expression computing the final rank of a search result, higher being better.
+   * Expects `ftsTable` to be the matched full text table, `f` the matching `indexed_file` row,
+   * `o` the left joined `file_open` row and `clock.now` the current unix time.
+   */
+  static QString rankExpression(const QString &ftsTable);
+
+  /**
+   * Same as `rankExpression`, without the full text rank, for files that were matched by other means.
+   */
+  static QString metadataRankExpression();
 };
@@ -0,0 +1,100 @@
+#include "services/files-service/file-metadata-loader.hpp"
+#include "utils/utils.hpp"
+#include <QFile>
+#include <QFileInfo>
+#include <algorithm>
+
+namespace fs = std::filesystem;
+
+FileMetadataLoader &FileMetadataLoader::instance() {
+  static FileMetadataLoader loader;
+
+  return loader;
+}
+
+QFuture<FileMetadata> FileMetadataLoader::load(const fs::path &path) { return submit(path, LOAD_PRIORITY); }
+
+void FileMetadataLoader::prefetch(const fs::path &path) { submit(path, PREFETCH_PRIORITY); }
+
+QMimeType FileMetadataLoader::mimeTypeForName(const fs::path &path) const {
+  return m_mimeDb.mimeTypeForFile(path.c_str(), QMimeDatabase::MatchExtension);
+}
+
+QFuture<FileMetadata> FileMetadataLoader::submit(const fs::path &path, TaskScheduler::Priority priority) {
+  if (auto it = m_files.find(path.native()); it != m_files.end()) {
+    // most recently used files are evicted last
+    if (priority == LOAD_PRIORITY) {
+      std::erase(m_fileOrder, path.native());
+      m_fileOrder.emplace_back(path.native());
+    }
+
+    return it->second;
+  }
+
+  auto future = TaskScheduler::instance().run(priority, [this, path]() { return loadNow(path); });
+
+  m_files.emplace(path.native(), future);
+  m_fileOrder.emplace_back(path.native());
+
+  if (m_fileOrder.size() > MAX_CACHED_FILES) {
+    m_files.erase(m_fileOrder.front());
+    m_fileOrder.pop_front();
+  }
+
+  return future;
+}
+
+FileMetadata FileMetadataLoader::loadNow(const fs::path &path) {
+  FileMetadata metadata;
+  QFileInfo info(path);
+
+  metadata.lastModifiedAt = info.lastModified();
+
+  if (info.isDir()) {
+    metadata.mimeType = m_mimeDb.mimeTypeForName("inode/directory");
+    return metadata;
+  }
+
+  QFile file(path);
+
+  if (!file.open(QIODevice::ReadOnly)) {
+    // the best that can be done without reading the file
+    metadata.mimeType = mimeTypeForName(path);
+    return metadata;
+  }
+
+  // the preview is read along with the magic bytes, it is dropped if the file is not text
+  QByteArray head = file.read(std::max(MAGIC_SIZE, TEXT_PREVIEW_SIZE));
+
+  metadata.mimeType = detectMimeType(path, head.first(std::min(MAGIC_SIZE, head.size())));
+
+  if (isTextMimeType(metadata.mimeType)) { metadata.textPreview = std::move(head); }
+
+  return metadata;
+}
+
+QMimeType FileMetadataLoader::detectMimeType(const fs::path &path, const QByteArray &magic) {
+  QByteArray key = path.extension().native().c_str();
+
+  // files without an extension can still be matched by their whole name (Makefile, README...)
+  if (key.isEmpty()) { key = path.filename().native().c_str(); }
+
+  key += '\0';
+  key += magic;
+
+  {
+    std::lock_guard lock(m_mimeMutex);
+
+    if (auto it = m_mimeTypes.find(key); it != m_mimeTypes.end()) return it->second;
+  }
+
+  auto mimeType = m_mimeDb.mimeTypeForFileNameAndData(path.filename().c_str(), magic);
+  std::lock_guard lock(m_mimeMutex);
+
+  // detections are cheap to redo, dropping all of them beats tracking which ones are used
+  if (m_mimeTypes.size() >= MAX_CACHED_MIME_TYPES) { m_mimeTypes.clear(); }
+
+  m_mimeTypes.emplace(std::move(key), mimeType);
+
+  return mimeType;
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include "common.hpp"
+#include "task-scheduler/task-scheduler.hpp"
+#include <QByteArray>
+#include <QDateTime>
+#include <QFuture>
+#include <QMimeDatabase>
+#include <QMimeType>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+/**
+ * What is shown about a file in the detail of a search result.
+ */
+struct FileMetadata {
+  QMimeType mimeType;
+  QDateTime lastModifiedAt;
+  // the start of the file, for text files only
+  std::optional<QByteArray> textPreview;
+};
+
+/**
+ * Loads the metadata of files on the threads of the `TaskScheduler`, as it takes a stat, a read of the start
+ * of the file and a mime type lookup, none of which should be done on the GUI thread.
+ *
+ * The metadata of the last `MAX_CACHED_FILES` files asked for is kept, so that navigating back and forth in
+ * results does not load them again, and so that neighbours of the selected result can be prefetched.
+ *
+ * Mime types are detected from the name and the first `MAGIC_SIZE` bytes of files, detections being cached
+ * by extension and magic bytes: files of the same kind tend to start the same way, and a cached detection
+ * saves running the glob and magic rules of the whole mime database again.
+ */
+class FileMetadataLoader : public NonCopyable {
+public:
+  static constexpr size_t MAX_CACHED_FILES = 64;
+  static constexpr size_t MAX_CACHED_MIME_TYPES = 512;
+  static constexpr qint64 MAGIC_SIZE = 512;
+  static constexpr qint64 TEXT_PREVIEW_SIZE = 10 * 1024;
+
+  static FileMetadataLoader &instance();
+
+  /**
+   * The metadata of the file at `path`, loaded ahead of the prefetches that are still pending.
+   */
+  QFuture<FileMetadata> load(const std::filesystem::path &path);
+
+  /**
+   * Load the metadata of the file at `path` whenever a thread is free, for a later `load` to be immediate.
+   */
+  void prefetch(const std::filesystem::path &path);
+
+  /**
+   * The mime type `path` most likely has, guessed from its name only. This does not do any I/O and is meant
+   * for whatever needs a mime type for many files at once, such as the icons of list rows.
+   */
+  QMimeType mimeTypeForName(const std::filesystem::path &path) const;
+
+private:
+  static constexpr auto LOAD_PRIORITY = TaskScheduler::Priority::VisibleUi;
+  static constexpr auto PREFETCH_PRIORITY = TaskScheduler::Priority::Prefetch;
+
+  QFuture<FileMetadata> submit(const std::filesystem::path &path, TaskScheduler::Priority priority);
+  FileMetadata loadNow(const std::filesystem::path &path);
+  QMimeType detectMimeType(const std::filesystem::path &path, const QByteArray &magic);
+
+  FileMetadataLoader() = default;
+
+  QMimeDatabase m_mimeDb;
+
+  // only accessed from the GUI thread
+  std::unordered_map<std::string, QFuture<FileMetadata>> m_files;
+  std::deque<std::string> m_fileOrder;
+
+  std::mutex m_mimeMutex;
+  std::unordered_map<QByteArray, QMimeType> m_mimeTypes;
+};
@@ -9,8 +9,17 @@ FileService::queryAsync(std::string_view query, const AbstractFileIndexer::Query
   return m_indexer->queryAsync(query, params);
 }
 
+QFuture<std::vector<IndexerFileResult>>
+FileService::queryStreamAsync(std::string_view query, const AbstractFileIndexer::QueryParams &params) {
+  return m_indexer->queryStreamAsync(query, params);
+}
+
 void FileService::rebuildIndex() { m_indexer->rebuildIndex(); }
 
+IndexerStats FileService::stats() const { return m_indexer->stats(); }
+
+void FileService::recordFileOpen(const std::filesystem::path &path) { m_indexer->recordFileOpen(path); }
+
 void FileService::setEntrypoints(const std::vector<AbstractFileIndexer::Entrypoint> &entrypoints) {
   m_indexer->setEntrypoints(entrypoints);
 }
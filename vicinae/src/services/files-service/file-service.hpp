@@ -9,9 +9,13 @@ public:
   AbstractFileIndexer *indexer() const;
 
   void rebuildIndex();
+  IndexerStats stats() const;
+  void recordFileOpen(const std::filesystem::path &path);
 
   QFuture<std::vector<IndexerFileResult>> queryAsync(std::string_view query,
                                                      const AbstractFileIndexer::QueryParams &params = {});
+  QFuture<std::vector<IndexerFileResult>>
+  queryStreamAsync(std::string_view query, const AbstractFileIndexer::QueryParams &params = {});
 
   void setEntrypoints(const std::vector<AbstractFileIndexer::Entrypoint> &entrypoints);
 
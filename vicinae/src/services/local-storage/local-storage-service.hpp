@@ -1,16 +1,45 @@
 #pragma once
+#include <optional>
+#include <qhash.h>
 #include <qsqlquery.h>
 #include <qsqlerror.h>
 #include <qjsonobject.h>
+#include <unordered_map>
+#include <vector>
 
 class OmniDatabase;
 
+/**
+ * Key value storage of the extensions, one namespace per extension.
+ *
+ * Reads are served from a per namespace cache of the items read or written so far, kept up to date by the
+ * writes made through the service, which is the only writer of the storage.
+ */
 class LocalStorageService {
 public:
   enum ValueType { Number, String, Boolean };
 
+  struct Operation {
+    enum Kind { Set, Remove, Clear };
+
+    Kind kind;
+    QString key;
+    QJsonValue value;
+  };
+
 private:
+  // past which the cache of a namespace is dropped, to keep extensions storing lots of items in check
+  static constexpr size_t MAX_CACHED_ITEMS = 10'000;
+
+  struct NamespaceCache {
+    // items that are known to be missing are cached as well
+    std::unordered_map<QString, std::optional<QJsonValue>> items;
+    // whether all the items of the namespace are cached, missing ones being known to be missing
+    bool complete = false;
+  };
+
   OmniDatabase &db;
+  std::unordered_map<QString, NamespaceCache> m_cache;
   QSqlQuery m_clearQuery;
   QSqlQuery m_listQuery;
   QSqlQuery m_removeQuery;
@@ -21,12 +50,32 @@ private:
 
   QJsonValue deserializeValue(const QString &value, ValueType type);
 
+  bool execSetItem(const QString &namespaceId, const QString &key, const QJsonValue &json);
+  bool execRemoveItem(const QString &namespaceId, const QString &key);
+  bool execClearNamespace(const QString &namespaceId);
+  bool execOperation(const QString &namespaceId, const Operation &op);
+
+  // apply a write made to the storage to the cache
+  void cacheOperation(const QString &namespaceId, const Operation &op);
+  std::optional<QJsonValue> fetchItem(const QString &namespaceId, const QString &key);
+
 public:
   bool clearNamespace(const QString &namespaceId);
   QJsonObject listNamespaceItems(const QString &namespaceId);
   bool removeItem(const QString &namespaceId, const QString &key);
   bool setItem(const QString &namespaceId, const QString &key, const QJsonValue &json);
   QJsonValue getItem(const QString &namespaceId, const QString &key);
+
+  /**
+   * Items that do not exist are missing from the returned object.
+   */
+  QJsonObject getItems(const QString &namespaceId, const std::vector<QString> &keys);
+  bool setItems(const QString &namespaceId, const QJsonObject &values);
+
+  /**
+   * Apply `operations` in order, in a single transaction: none of them is applied if one fails.
+   */
+  bool applyBatch(const QString &namespaceId, const std::vector<Operation> &operations);
   QJsonObject getItemAsJson(const QString &namespaceId, const QString &key);
 
   LocalStorageService(OmniDatabase &db);
@@ -1,9 +1,11 @@
 #include <qjsondocument.h>
 #include <qjsonobject.h>
+#include <qsqlerror.h>
 #include <qsqlquery.h>
 #include <qvariant.h>
 #include "local-storage-service.hpp"
 #include "omni-database.hpp"
+#include "sql-profiler/sql-profiler.hpp"
 
 using ValueType = LocalStorageService::ValueType;
 
@@ -36,24 +38,52 @@ QJsonObject LocalStorageService::getItemAsJson(const QString &namespaceId, const
   return QJsonDocument::fromJson(json.toString().toUtf8()).object();
 }
 
-QJsonValue LocalStorageService::getItem(const QString &namespaceId, const QString &key) {
+std::optional<QJsonValue> LocalStorageService::fetchItem(const QString &namespaceId, const QString &key) {
+  auto &cache = m_cache[namespaceId];
+
+  if (auto it = cache.items.find(key); it != cache.items.end()) return it->second;
+  if (cache.complete) return std::nullopt;
+
   m_getQuery.bindValue(":namespace_id", namespaceId);
   m_getQuery.bindValue(":key", key);
 
-  if (!m_getQuery.exec()) {
+  if (!SqlProfiler::exec(m_getQuery)) {
     qCritical() << "LocalStorageService::getItem: failed to execute query" << m_getQuery.lastError();
-    return {};
+    return std::nullopt;
   }
 
-  if (!m_getQuery.next()) return {};
+  std::optional<QJsonValue> item;
+
+  if (m_getQuery.next()) {
+    QString value = m_getQuery.value(0).toString();
+    ValueType valueType = static_cast<ValueType>(m_getQuery.value(1).toUInt());
 
-  QString value = m_getQuery.value(0).toString();
-  ValueType valueType = static_cast<ValueType>(m_getQuery.value(1).toUInt());
+    item = deserializeValue(value, valueType);
+  }
 
-  return deserializeValue(value, valueType);
+  if (cache.items.size() >= MAX_CACHED_ITEMS) cache = {};
+
+  cache.items[key] = item;
+
+  return item;
 }
 
-bool LocalStorageService::setItem(const QString &namespaceId, const QString &key, const QJsonValue &json) {
+QJsonValue LocalStorageService::getItem(const QString &namespaceId, const QString &key) {
+  return fetchItem(namespaceId, key).value_or(QJsonValue());
+}
+
+QJsonObject LocalStorageService::getItems(const QString &namespaceId, const std::vector<QString> &keys) {
+  QJsonObject items;
+
+  for (const auto &key : keys) {
+    if (auto item = fetchItem(namespaceId, key)) items[key] = *item;
+  }
+
+  return items;
+}
+
+bool LocalStorageService::execSetItem(const QString &namespaceId, const QString &key,
+                                      const QJsonValue &json) {
   auto [value, valueType] = serializeValue(json);
 
   m_setItemQuery.bindValue(":namespace_id", namespaceId);
@@ -61,7 +91,7 @@ bool LocalStorageService::setItem(const QString &namespaceId, const QString &key
   m_setItemQuery.bindValue(":value", value);
   m_setItemQuery.bindValue(":value_type", valueType);
 
-  if (!m_setItemQuery.exec()) {
+  if (!SqlProfiler::exec(m_setItemQuery)) {
     qCritical() << "LocalStorageService::setItem: failed to execute query" << m_setItemQuery.lastError();
     return false;
   }
@@ -69,22 +99,138 @@ bool LocalStorageService::setItem(const QString &namespaceId, const QString &key
   return true;
 }
 
-bool LocalStorageService::removeItem(const QString &namespaceId, const QString &key) {
+bool LocalStorageService::execRemoveItem(const QString &namespaceId, const QString &key) {
   m_removeQuery.bindValue(":namespace_id", namespaceId);
   m_removeQuery.bindValue(":key", key);
 
-  if (!m_removeQuery.exec()) {
+  if (!SqlProfiler::exec(m_removeQuery)) {
     qCritical() << "LocalStorageService::removeItem: failed to execute query" << m_removeQuery.lastError();
     return false;
   }
 
+  return true;
+}
+
+bool LocalStorageService::execClearNamespace(const QString &namespaceId) {
+  m_clearQuery.bindValue(":namespace_id", namespaceId);
+
+  if (!SqlProfiler::exec(m_clearQuery)) {
+    qCritical() << "LocalStorageService::clearNamespace: failed to execute query" << m_clearQuery.lastError();
+    return false;
+  }
+
+  return true;
+}
+
+bool LocalStorageService::execOperation(const QString &namespaceId, const Operation &op) {
+  switch (op.kind) {
+  case Operation::Set:
+    return execSetItem(namespaceId, op.key, op.value);
+  case Operation::Remove:
+    return execRemoveItem(namespaceId, op.key);
+  case Operation::Clear:
+    return execClearNamespace(namespaceId);
+  }
+
+  return false;
+}
+
+void LocalStorageService::cacheOperation(const QString &namespaceId, const Operation &op) {
+  auto &cache = m_cache[namespaceId];
+
+  switch (op.kind) {
+  case Operation::Set: {
+    // values are cached the way they read back from the database
+    auto [value, valueType] = serializeValue(op.value);
+
+    if (cache.items.size() >= MAX_CACHED_ITEMS) cache = {};
+
+    cache.items[op.key] = deserializeValue(value, valueType);
+    break;
+  }
+  case Operation::Remove:
+    cache.items[op.key] = std::nullopt;
+    break;
+  case Operation::Clear:
+    cache = {.complete = true};
+    break;
+  }
+}
+
+bool LocalStorageService::setItem(const QString &namespaceId, const QString &key, const QJsonValue &json) {
+  Operation op{.kind = Operation::Set, .key = key, .value = json};
+
+  if (!execOperation(namespaceId, op)) return false;
+
+  cacheOperation(namespaceId, op);
+
+  return true;
+}
+
+bool LocalStorageService::removeItem(const QString &namespaceId, const QString &key) {
+  Operation op{.kind = Operation::Remove, .key = key};
+
+  if (!execOperation(namespaceId, op)) return false;
+
+  cacheOperation(namespaceId, op);
+
   return m_removeQuery.numRowsAffected() != 0;
 }
 
+bool LocalStorageService::setItems(const QString &namespaceId, const QJsonObject &values) {
+  std::vector<Operation> operations;
+
+  operations.reserve(values.size());
+
+  for (const auto &key : values.keys()) {
+    operations.push_back({.kind = Operation::Set, .key = key, .value = values.value(key)});
+  }
+
+  return applyBatch(namespaceId, operations);
+}
+
+bool LocalStorageService::applyBatch(const QString &namespaceId, const std::vector<Operation> &operations) {
+  if (!db.db().transaction()) {
+    qCritical() << "LocalStorageService::applyBatch: failed to start transaction" << db.db().lastError();
+    return false;
+  }
+
+  for (const auto &op : operations) {
+    if (!execOperation(namespaceId, op)) {
+      db.db().rollback();
+      return false;
+    }
+  }
+
+  if (!db.db().commit()) {
+    qCritical() << "LocalStorageService::applyBatch: failed to commit transaction" << db.db().lastError();
+    db.db().rollback();
+    return false;
+  }
+
+  for (const auto &op : operations) {
+    cacheOperation(namespaceId, op);
+  }
+
+  return true;
+}
+
 QJsonObject LocalStorageService::listNamespaceItems(const QString &namespaceId) {
+  auto &cache = m_cache[namespaceId];
+
+  if (cache.complete) {
+    QJsonObject obj;
+
+    for (const auto &[key, value] : cache.items) {
+      if (value) obj[key] = *value;
+    }
+
+    return obj;
+  }
+
   m_listQuery.bindValue(":namespace_id", namespaceId);
 
-  if (!m_listQuery.exec()) {
+  if (!SqlProfiler::exec(m_listQuery)) {
     qCritical() << "LocalStorageService::listNamespaceItems: failed to execute query"
                 << m_listQuery.lastError();
     return {};
@@ -94,21 +240,29 @@ QJsonObject LocalStorageService::listNamespaceItems(const QString &namespaceId)
 
   while (m_listQuery.next()) {
     auto key = m_listQuery.value(0).toString();
-    auto value = m_listQuery.value(1);
+    auto value = m_listQuery.value(1).toString();
+    auto valueType = static_cast<ValueType>(m_listQuery.value(2).toUInt());
+
+    obj[key] = deserializeValue(value, valueType);
+  }
+
+  if (static_cast<size_t>(obj.size()) <= MAX_CACHED_ITEMS) {
+    cache = {.complete = true};
 
-    obj[key] = QJsonValue::fromVariant(value);
+    for (const auto &key : obj.keys()) {
+      cache.items[key] = obj.value(key);
+    }
   }
 
   return obj;
 }
 
 bool LocalStorageService::clearNamespace(const QString &namespaceId) {
-  m_clearQuery.bindValue(":namespace_id", namespaceId);
+  Operation op{.kind = Operation::Clear};
 
-  if (!m_clearQuery.exec()) {
-    qCritical() << "LocalStorageService::clearNamespace: failed to execute query" << m_clearQuery.lastError();
-    return false;
-  }
+  if (!execOperation(namespaceId, op)) return false;
+
+  cacheOperation(namespaceId, op);
 
   return true;
 }
@@ -121,7 +275,8 @@ LocalStorageService::LocalStorageService(OmniDatabase &db) : db(db) {
   m_getQuery = db.createQuery();
 
   m_clearQuery.prepare("DELETE FROM storage_data_item WHERE namespace_id = :namespace_id");
-  m_listQuery.prepare("SELECT key, value FROM storage_data_item WHERE namespace_id = :namespace_id");
+  m_listQuery.prepare(
+      "SELECT key, value, value_type FROM storage_data_item WHERE namespace_id = :namespace_id");
   m_removeQuery.prepare("DELETE FROM storage_data_item WHERE namespace_id = :namespace_id AND key = :key");
   m_setItemQuery.prepare(R"(
 		INSERT INTO storage_data_item (namespace_id, key, value, value_type)
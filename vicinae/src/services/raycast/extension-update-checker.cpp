@@ -0,0 +1,206 @@
+#include "services/raycast/extension-update-checker.hpp"
+#include "services/extension-registry/extension-registry.hpp"
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <qfuturewatcher.h>
+#include <qlogging.h>
+
+namespace fs = std::filesystem;
+
+void ExtensionUpdateChecker::check() {
+  if (m_check) return;
+
+  m_check = Check{};
+
+  for (const auto &manifest : m_registry.manifests()) {
+    QFileInfo info(manifest.path / "package.json");
+
+    m_check->installedAt.insert({manifest.id, info.lastModified()});
+  }
+
+  if (m_check->installedAt.empty()) {
+    finishCheck(true);
+    return;
+  }
+
+  fetchPage();
+}
+
+void ExtensionUpdateChecker::fetchPage() {
+  using Watcher = QFutureWatcher<Raycast::ListResult>;
+  auto watcher = new Watcher(this);
+
+  connect(watcher, &Watcher::finished, this, [this, watcher]() {
+    watcher->deleteLater();
+    handlePage(watcher->result());
+  });
+  watcher->setFuture(m_store.refreshExtensions({.page = m_check->page, .perPage = PAGE_SIZE}));
+}
+
+void ExtensionUpdateChecker::handlePage(const Raycast::ListResult &result) {
+  if (!result) {
+    qWarning() << "Failed to check for extension updates:" << result.error();
+    finishCheck(false);
+    return;
+  }
+
+  const auto &extensions = result->m_extensions;
+
+  for (const auto &extension : extensions) {
+    auto it = m_check->installedAt.find(extension.id);
+
+    if (it == m_check->installedAt.end()) continue;
+    if (extension.updatedAtDateTime() > it->second) { m_check->updates.emplace_back(extension); }
+
+    m_check->installedAt.erase(it);
+  }
+
+  bool lastPage = extensions.size() < PAGE_SIZE || m_check->page == MAX_PAGES;
+
+  if (m_check->installedAt.empty() || lastPage) {
+    finishCheck(true);
+    return;
+  }
+
+  ++m_check->page;
+  fetchPage();
+}
+
+void ExtensionUpdateChecker::finishCheck(bool complete) {
+  auto check = std::move(*m_check);
+  std::unordered_set<std::string> archives;
+
+  m_check.reset();
+
+  for (const auto &extension : check.updates) {
+    qInfo() << "Update available for extension" << extension.name;
+    archives.insert(archivePath(extension).native());
+    download(extension);
+  }
+
+  // an interrupted check does not know about the updates it did not get to
+  if (!complete) return;
+
+  std::error_code ec;
+
+  // updates that were superseded by a newer one, or whose extension was updated from elsewhere
+  for (const auto &entry : fs::directory_iterator(m_downloadDir, ec)) {
+    if (!archives.contains(entry.path().native())) { fs::remove(entry.path(), ec); }
+  }
+
+  std::erase_if(m_updates,
+                [&](const auto &pair) { return !archives.contains(pair.second.archive.native()); });
+}
+
+void ExtensionUpdateChecker::download(const Raycast::Extension &extension) {
+  using Watcher = QFutureWatcher<Raycast::DownloadExtensionResult>;
+  auto path = archivePath(extension);
+
+  if (m_updates.contains(extension.id) || m_downloading.contains(extension.id)) return;
+
+  // downloaded by a previous session
+  if (fs::exists(path)) {
+    m_updates.insert({extension.id, Update{.extension = extension, .archive = path}});
+    emit updateReady(extension.id);
+    return;
+  }
+
+  auto watcher = new Watcher(this);
+
+  m_downloading.insert(extension.id);
+  connect(watcher, &Watcher::finished, this, [this, watcher, extension, path]() {
+    auto result = watcher->result();
+
+    watcher->deleteLater();
+    m_downloading.erase(extension.id);
+
+    if (!result) {
+      qWarning() << "Failed to download the update of extension" << extension.name << result.error();
+      return;
+    }
+
+    std::error_code ec;
+    QSaveFile file(path.c_str());
+
+    fs::create_directories(m_downloadDir, ec);
+
+    if (!file.open(QIODevice::WriteOnly) || file.write(*result) != result->size() || !file.commit()) {
+      qWarning() << "Failed to save the update of extension" << extension.name << file.errorString();
+      return;
+    }
+
+    m_updates.insert({extension.id, Update{.extension = extension, .archive = path}});
+    emit updateReady(extension.id);
+  });
+  watcher->setFuture(
+      m_store.downloadExtension(extension.download_url, RaycastStoreService::BACKGROUND_DISTANCE));
+}
+
+const ExtensionUpdateChecker::Update *ExtensionUpdateChecker::update(const QString &id) const {
+  if (auto it = m_updates.find(id); it != m_updates.end()) return &it->second;
+
+  return nullptr;
+}
+
+std::vector<Raycast::Extension> ExtensionUpdateChecker::updates() const {
+  std::vector<Raycast::Extension> extensions;
+
+  extensions.reserve(m_updates.size());
+
+  for (const auto &[id, update] : m_updates) {
+    extensions.emplace_back(update.extension);
+  }
+
+  return extensions;
+}
+
+bool ExtensionUpdateChecker::applyUpdate(const QString &id) {
+  auto it = m_updates.find(id);
+
+  if (it == m_updates.end()) return false;
+
+  QFile file(it->second.archive);
+  bool installed = false;
+
+  if (!file.open(QIODevice::ReadOnly)) {
+    qWarning() << "Failed to open the update of extension" << id << file.errorString();
+  } else if (auto data = file.map(0, file.size())) {
+    installed = m_registry.installFromZip(id, std::string_view(reinterpret_cast<const char *>(data),
+                                                               static_cast<size_t>(file.size())));
+  } else {
+    installed = m_registry.installFromZip(id, file.readAll().toStdString());
+  }
+
+  file.close();
+  dropUpdate(id);
+
+  return installed;
+}
+
+void ExtensionUpdateChecker::dropUpdate(const QString &id) {
+  auto it = m_updates.find(id);
+
+  if (it == m_updates.end()) return;
+
+  std::error_code ec;
+
+  fs::remove(it->second.archive, ec);
+  m_updates.erase(it);
+}
+
+fs::path ExtensionUpdateChecker::archivePath(const Raycast::Extension &extension) const {
+  return m_downloadDir / QString("%1-%2.zip").arg(extension.id).arg(extension.updated_at).toStdString();
+}
+
+ExtensionUpdateChecker::ExtensionUpdateChecker(RaycastStoreService &store, ExtensionRegistry &registry,
+                                               fs::path downloadDir)
+    : m_store(store), m_registry(registry), m_downloadDir(std::move(downloadDir)) {
+  m_timer->setInterval(CHECK_INTERVAL);
+  connect(m_timer, &QTimer::timeout, this, &ExtensionUpdateChecker::check);
+  connect(&m_registry, &ExtensionRegistry::extensionUninstalled, this, &ExtensionUpdateChecker::dropUpdate);
+  QTimer::singleShot(FIRST_CHECK_DELAY, this, [this]() {
+    check();
+    m_timer->start();
+  });
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include "services/raycast/raycast-store.hpp"
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <qdatetime.h>
+#include <qobject.h>
+#include <qtimer.h>
+#include <qtmetamacros.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class ExtensionRegistry;
+
+/**
+ * Checks the store for updates of the installed extensions in the background, and downloads them ahead of
+ * time so that applying one does not wait on the network.
+ *
+ * The store can't be asked about a list of extensions at once: updates are found by going through the
+ * store listing, a large page at a time, until every installed extension was seen. Pages are revalidated
+ * through the disk cache of the fetcher, with If-None-Match/If-Modified-Since, so that a check finding
+ * nothing new mostly costs a few empty responses.
+ *
+ * An installed extension has an update when it was published on the store after its manifest was written,
+ * which is when it was installed.
+ */
+class ExtensionUpdateChecker : public QObject {
+  Q_OBJECT
+
+public:
+  static constexpr auto FIRST_CHECK_DELAY = std::chrono::minutes(5);
+  static constexpr auto CHECK_INTERVAL = std::chrono::hours(6);
+  static constexpr int PAGE_SIZE = 100;
+  // extensions that were not seen by then are not on the store, such as the ones being developed
+  static constexpr int MAX_PAGES = 30;
+
+  struct Update {
+    Raycast::Extension extension;
+    // the downloaded bundle
+    std::filesystem::path archive;
+  };
+
+  /**
+   * Check for updates, unless a check is already running. Checks also run on their own, every
+   * `CHECK_INTERVAL`.
+   */
+  void check();
+
+  /**
+   * The update of `id` that is downloaded and ready to be applied, if there is one.
+   */
+  const Update *update(const QString &id) const;
+  std::vector<Raycast::Extension> updates() const;
+
+  /**
+   * Install the downloaded update of `id`. The update is dropped whether it could be installed or not.
+   */
+  bool applyUpdate(const QString &id);
+
+  ExtensionUpdateChecker(RaycastStoreService &store, ExtensionRegistry &registry,
+                         std::filesystem::path downloadDir);
+
+signals:
+  void updateReady(const QString &id) const;
+
+private:
+  struct Check {
+    // when each of the installed extensions that were not seen yet was installed, by id
+    std::unordered_map<QString, QDateTime> installedAt;
+    std::vector<Raycast::Extension> updates;
+    int page = 1;
+  };
+
+  void fetchPage();
+  void handlePage(const Raycast::ListResult &result);
+  /**
+   * Download the updates that were found. Once a check went through every page it needs, the updates it
+   * did not find are dropped.
+   */
+  void finishCheck(bool complete);
+  void download(const Raycast::Extension &extension);
+  void dropUpdate(const QString &id);
+  std::filesystem::path archivePath(const Raycast::Extension &extension) const;
+
+  RaycastStoreService &m_store;
+  ExtensionRegistry &m_registry;
+  std::filesystem::path m_downloadDir;
+  std::optional<Check> m_check;
+  std::unordered_map<QString, Update> m_updates;
+  std::unordered_set<QString> m_downloading;
+  QTimer *m_timer = new QTimer(this);
+};
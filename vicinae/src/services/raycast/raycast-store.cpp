@@ -1,140 +1,113 @@
 #include "raycast-store.hpp"
+#include "image-fetcher.hpp"
 #include <qfuture.h>
-#include <qnetworkdiskcache.h>
-#include <qnetworkreply.h>
+#include <qpromise.h>
+#include <qurlquery.h>
 #include <expected>
 
-QFuture<Raycast::ListResult> RaycastStoreService::search(const QString &query) {
-
-  QUrl endpoint = QString("%1/store_listings/search?q=%2").arg(BASE_URL).arg(query);
+QFuture<Raycast::ListResult> RaycastStoreService::fetchListing(const QUrl &endpoint, int distance,
+                                                               bool fromMemory) {
+  QString key = endpoint.toString();
   QPromise<Raycast::ListResult> promise;
   auto future = promise.future();
-  QNetworkRequest request(endpoint);
 
-  request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-  request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::PreferCache);
+  promise.start();
 
-  auto reply = m_net->get(request);
+  if (auto it = m_listings.find(key); fromMemory && it != m_listings.end()) {
+    promise.addResult(it->second);
+    promise.finish();
+    return future;
+  }
 
-  connect(reply, &QNetworkReply::finished, this, [this, reply, promise = std::move(promise)]() mutable {
-    if (reply->error() != QNetworkReply::NoError) {
-      promise.addResult(std::unexpected(""));
-    } else {
-      std::vector<Raycast::Extension> extensions;
-      auto data = reply->readAll();
-      QJsonParseError error;
-      QJsonDocument doc = QJsonDocument::fromJson(data, &error);
+  auto reply = NetworkFetcher::instance()->fetch(endpoint, distance, FetchCachePolicy::Revalidate);
 
-      if (error.error != QJsonParseError::NoError) {
-        qWarning() << "JSON parse error:" << error.errorString();
-        promise.addResult(std::unexpected("Failed to parse response"));
-        promise.finish();
-        reply->deleteLater();
-        return;
-      }
+  connect(reply, &FetchReply::finished, this,
+          [this, key, reply, promise = std::move(promise)](const QByteArray &data) mutable {
+            reply->deleteLater();
 
-      auto jsonList = doc.object().value("data").toArray();
+            if (!reply->ok()) {
+              promise.addResult(std::unexpected("Failed to fetch"));
+              promise.finish();
+              return;
+            }
 
-      extensions.reserve(jsonList.size());
+            QJsonParseError error;
+            QJsonDocument doc = QJsonDocument::fromJson(data, &error);
 
-      for (const auto &result : doc.object().value("data").toArray()) {
-        extensions.emplace_back(Raycast::Extension::fromJson(result.toObject()));
-      }
+            if (error.error != QJsonParseError::NoError) {
+              qWarning() << "JSON parse error:" << error.errorString();
+              promise.addResult(std::unexpected("Failed to parse response"));
+              promise.finish();
+              return;
+            }
 
-      promise.addResult(extensions);
-    }
+            std::vector<Raycast::Extension> extensions;
+            auto jsonList = doc.object().value("data").toArray();
 
-    promise.finish();
-    reply->deleteLater();
-  });
+            extensions.reserve(jsonList.size());
 
-  return future;
-}
+            for (const auto &result : jsonList) {
+              extensions.emplace_back(Raycast::Extension::fromJson(result.toObject()));
+            }
 
-QFuture<Raycast::DownloadExtensionResult> RaycastStoreService::downloadExtension(const QUrl &url) {
-  QNetworkRequest request(url);
-  QPromise<Raycast::DownloadExtensionResult> promise;
-  auto future = promise.future();
-  auto reply = m_net->get(request);
+            auto [it, inserted] = m_listings.insert_or_assign(key, extensions);
 
-  request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::PreferCache);
-
-  connect(reply, &QNetworkReply::finished, this, [this, reply, promise = std::move(promise)]() mutable {
-    if (reply->error() != QNetworkReply::NoError) {
-      promise.addResult(std::unexpected("Failed to fetch"));
-    } else {
-      promise.addResult(reply->readAll());
-    }
-
-    promise.finish();
-    reply->deleteLater();
-  });
+            promise.addResult(it->second);
+            promise.finish();
+          });
 
   return future;
 }
 
-QFuture<Raycast::ListResult>
-RaycastStoreService::fetchExtensions(const Raycast::ListPaginationOptions &opts) {
-
-  QUrl endpoint =
-      QString("%1/store_listings?page=%2&per_page=%3").arg(BASE_URL).arg(opts.page).arg(opts.perPage);
-  QPromise<Raycast::ListResult> promise;
-  auto future = promise.future();
-  QNetworkRequest request(endpoint);
-
-  if (auto it = m_cachedPages.find(opts.page); it != m_cachedPages.end()) {
-    qDebug() << "cached page" << opts.page;
-    promise.addResult(it->second);
-    promise.finish();
-    return future;
-  }
-
-  request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-  request.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::PreferCache);
-
-  auto reply = m_net->get(request);
-
-  connect(reply, &QNetworkReply::finished, this, [this, opts, reply, promise = std::move(promise)]() mutable {
-    if (reply->error() != QNetworkReply::NoError) {
-      promise.addResult(std::unexpected(""));
-    } else {
-      std::vector<Raycast::Extension> extensions;
-      auto data = reply->readAll();
-      QJsonParseError error;
-      QJsonDocument doc = QJsonDocument::fromJson(data, &error);
-
-      if (error.error != QJsonParseError::NoError) {
-        qWarning() << "JSON parse error:" << error.errorString();
-        promise.addResult(std::unexpected("Failed to parse response"));
-        promise.finish();
-        reply->deleteLater();
-        return;
-      }
+QFuture<Raycast::ListResult> RaycastStoreService::search(const QString &query) {
+  QUrl endpoint = QString("%1/store_listings/search").arg(BASE_URL);
+  QUrlQuery params;
 
-      auto jsonList = doc.object().value("data").toArray();
+  params.addQueryItem("q", query);
+  endpoint.setQuery(params);
 
-      extensions.reserve(jsonList.size());
+  return fetchListing(endpoint);
+}
 
-      for (const auto &result : doc.object().value("data").toArray()) {
-        extensions.emplace_back(Raycast::Extension::fromJson(result.toObject()));
-      }
+QFuture<Raycast::DownloadExtensionResult> RaycastStoreService::downloadExtension(const QUrl &url,
+                                                                                  int distance) {
+  QPromise<Raycast::DownloadExtensionResult> promise;
+  auto future = promise.future();
+  // bundles are only downloaded once, they would evict the images the cache is meant for
+  auto reply = NetworkFetcher::instance()->fetch(url, distance, FetchCachePolicy::NoCache);
+
+  promise.start();
+  connect(reply, &FetchReply::finished, this,
+          [reply, promise = std::move(promise)](const QByteArray &data) mutable {
+            if (!reply->ok()) {
+              promise.addResult(std::unexpected("Failed to fetch"));
+            } else {
+              promise.addResult(data);
+            }
+
+            promise.finish();
+            reply->deleteLater();
+          });
 
-      m_cachedPages.insert({opts.page, extensions});
-      promise.addResult(extensions);
-    }
+  return future;
+}
 
-    promise.finish();
-    reply->deleteLater();
-  });
+QUrl RaycastStoreService::listingEndpoint(const Raycast::ListPaginationOptions &opts) {
+  return QString("%1/store_listings?page=%2&per_page=%3").arg(BASE_URL).arg(opts.page).arg(opts.perPage);
+}
 
-  return future;
+QFuture<Raycast::ListResult>
+RaycastStoreService::fetchExtensions(const Raycast::ListPaginationOptions &opts) {
+  return fetchListing(listingEndpoint(opts));
 }
 
-RaycastStoreService::RaycastStoreService() {
-  auto diskCache = new QNetworkDiskCache;
-  auto cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
-                  QLatin1StringView("/omnicast/raycast-store");
+QFuture<Raycast::ListResult>
+RaycastStoreService::refreshExtensions(const Raycast::ListPaginationOptions &opts) {
+  return fetchListing(listingEndpoint(opts), BACKGROUND_DISTANCE, false);
+}
 
-  diskCache->setCacheDirectory(cacheDir);
-  m_net->setCache(diskCache);
+void RaycastStoreService::prefetchExtensions(const Raycast::ListPaginationOptions &opts) {
+  fetchExtensions(opts);
 }
+
+RaycastStoreService::RaycastStoreService() {}
@@ -3,11 +3,11 @@
 #include "../../ui/image/url.hpp"
 #include "theme.hpp"
 #include <expected>
+#include <limits>
 #include <qcontainerfwd.h>
 #include <qstringview.h>
 #include <vector>
 #include <qfuture.h>
-#include <qnetworkaccessmanager.h>
 #include <qobject.h>
 #include <QString>
 #include <QStringList>
@@ -480,18 +480,40 @@ using DownloadExtensionResult = std::expected<QByteArray, QString>;
 
 } // namespace Raycast
 
+/**
+ * Listings and search results are fetched through the shared network fetcher, which keeps them in its disk
+ * cache and revalidates them with the store. Within a session, a listing that was fetched once is served
+ * from memory.
+ */
 class RaycastStoreService : public QObject, NonCopyable {
-  std::unordered_map<int, Raycast::ListFrontPageResponse> m_cachedPages;
-  QNetworkAccessManager *m_net = new QNetworkAccessManager(this);
+  // keyed by endpoint, for pages and searches alike
+  std::unordered_map<QString, Raycast::ListFrontPageResponse> m_listings;
   static constexpr const char *BASE_URL = "https://backend.raycast.com/api/v1";
 
+  QFuture<Raycast::ListResult> fetchListing(const QUrl &endpoint, int distance = 0, bool fromMemory = true);
+  static QUrl listingEndpoint(const Raycast::ListPaginationOptions &opts);
+
 public:
+  // fetch distance of what is done in the background, after everything that is being shown
+  static constexpr int BACKGROUND_DISTANCE = std::numeric_limits<int>::max();
+
   RaycastStoreService();
 
   /**
    * Download the extension bundle as a zip file.
    */
-  QFuture<Raycast::DownloadExtensionResult> downloadExtension(const QUrl &url);
+  QFuture<Raycast::DownloadExtensionResult> downloadExtension(const QUrl &url, int distance = 0);
   QFuture<Raycast::ListResult> fetchExtensions(const Raycast::ListPaginationOptions &opts = {});
+
+  /**
+   * Fetch a page of the store as it is now, for background work: the page is revalidated with the store
+   * even if it was fetched during the session, and it is fetched after everything that is being shown.
+   */
+  QFuture<Raycast::ListResult> refreshExtensions(const Raycast::ListPaginationOptions &opts);
+
+  /**
+   * Fetch a page ahead of it being shown, so that scrolling to it is instant.
+   */
+  void prefetchExtensions(const Raycast::ListPaginationOptions &opts);
   QFuture<Raycast::ListResult> search(const QString &query);
 };
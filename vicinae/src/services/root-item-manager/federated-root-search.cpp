@@ -0,0 +1,124 @@
+#include "services/root-item-manager/federated-root-search.hpp"
+#include "services/root-item-manager/root-item-manager.hpp"
+#include <algorithm>
+#include <optional>
+
+void FederatedRootSearch::syncSources() {
+  for (auto source : m_manager.searchSources()) {
+    if (std::ranges::any_of(m_searches, [&](auto &&search) { return search->source == source; })) continue;
+
+    auto &search = m_searches.emplace_back(std::make_unique<SourceSearch>());
+    auto handle = search.get();
+
+    search->source = source;
+    connect(&search->watcher, &Watcher::finished, this, [this, handle]() { handleFinished(*handle); });
+  }
+}
+
+void FederatedRootSearch::start(const QString &query) {
+  cancel();
+  syncSources();
+  m_startedAt.start();
+  m_settled = false;
+
+  for (auto &search : m_searches) {
+    if (!search->source->accepts(query)) continue;
+
+    search->state = State::Pending;
+    search->watcher.setFuture(search->source->search(query));
+  }
+
+  updateSettled();
+}
+
+void FederatedRootSearch::cancel() {
+  m_deadline->stop();
+  m_late.clear();
+
+  for (auto &search : m_searches) {
+    if (search->state == State::Pending || search->state == State::TimedOut) { search->watcher.cancel(); }
+
+    search->state = State::Idle;
+    search->results.clear();
+    search->late = false;
+  }
+
+  m_settled = true;
+}
+
+std::vector<FederatedRootSearch::Section>
+FederatedRootSearch::sections(RootSearchSource::Placement placement) const {
+  std::vector<Section> sections;
+
+  for (const auto &search : m_searches) {
+    bool shown = search->state == State::Done && !search->late && !search->results.empty();
+
+    if (shown && search->source->placement() == placement) {
+      sections.emplace_back(Section{.source = search->source, .results = &search->results});
+    }
+  }
+
+  if (placement == RootSearchSource::Placement::AfterItems) {
+    for (const auto &search : m_late) {
+      sections.emplace_back(Section{.source = search->source, .results = &search->results});
+    }
+  }
+
+  return sections;
+}
+
+void FederatedRootSearch::handleFinished(SourceSearch &search) {
+  if (search.state != State::Pending && search.state != State::TimedOut) return;
+
+  auto future = search.watcher.future();
+  bool late = search.state == State::TimedOut;
+
+  search.state = State::Done;
+
+  if (!future.isCanceled() && future.resultCount() > 0) { search.results = future.result(); }
+
+  if (!late) return updateSettled();
+  if (search.results.empty()) return;
+
+  search.late = true;
+  m_late.emplace_back(&search);
+  emit updated();
+}
+
+void FederatedRootSearch::handleDeadline() { updateSettled(); }
+
+void FederatedRootSearch::updateSettled() {
+  if (m_settled) return;
+
+  auto elapsed = std::chrono::milliseconds(m_startedAt.elapsed());
+  std::optional<std::chrono::milliseconds> nextDeadline;
+
+  for (auto &search : m_searches) {
+    if (search->state != State::Pending) continue;
+
+    auto budget = search->source->budget();
+
+    if (elapsed >= budget) {
+      search->state = State::TimedOut;
+      continue;
+    }
+
+    nextDeadline = std::min(nextDeadline.value_or(budget - elapsed), budget - elapsed);
+  }
+
+  if (nextDeadline) {
+    m_deadline->start(*nextDeadline);
+    return;
+  }
+
+  m_deadline->stop();
+  m_settled = true;
+  emit updated();
+}
+
+FederatedRootSearch::FederatedRootSearch(RootItemManager &manager, QObject *parent)
+    : QObject(parent), m_manager(manager) {
+  m_deadline->setSingleShot(true);
+  m_deadline->setTimerType(Qt::PreciseTimer);
+  connect(m_deadline, &QTimer::timeout, this, &FederatedRootSearch::handleDeadline);
+}
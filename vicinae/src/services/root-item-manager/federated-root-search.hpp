@@ -0,0 +1,112 @@
+#pragma once
+#include "ui/omni-list/omni-list.hpp"
+#include <chrono>
+#include <memory>
+#include <qelapsedtimer.h>
+#include <qfuture.h>
+#include <qfuturewatcher.h>
+#include <qobject.h>
+#include <qstring.h>
+#include <qtimer.h>
+#include <qtmetamacros.h>
+#include <vector>
+
+class RootItemManager;
+
+/**
+ * A source of root search results other than root items, such as files or calculator answers, which are
+ * shown in a section of their own.
+ */
+class RootSearchSource {
+public:
+  using Results = std::vector<std::shared_ptr<OmniList::AbstractVirtualItem>>;
+
+  // where the section of the source goes if it comes back in time, relative to the root items
+  enum class Placement { BeforeItems, AfterItems };
+
+  virtual QString id() const = 0;
+  virtual QString title() const = 0;
+  virtual Placement placement() const { return Placement::AfterItems; }
+
+  /**
+   * For how long showing the results of a query can wait for this source. Results coming back later are
+   * appended to the ones shown instead of being merged in their place.
+   */
+  virtual std::chrono::milliseconds budget() const = 0;
+
+  /**
+   * Whether the source has anything to search `query` for, sources that do not are not waited for.
+   */
+  virtual bool accepts(const QString &query) const { return true; }
+
+  /**
+   * Results for `query`, in rank order. Searching again, or canceling the future, means the previous
+   * results are no longer wanted.
+   */
+  virtual QFuture<Results> search(const QString &query) = 0;
+
+  virtual ~RootSearchSource() = default;
+};
+
+/**
+ * The search of every source of a `RootItemManager` for the query typed in the root search, which is shown
+ * along with the root items.
+ *
+ * A query is settled once every source either came back with its results or ran out of budget, which is
+ * when results are to be shown: sources that came back are in their place, in the order they were added
+ * to the manager. Sources coming back after that are late, and are appended in the order they come back,
+ * so that nothing already shown moves.
+ */
+class FederatedRootSearch : public QObject {
+  Q_OBJECT
+
+public:
+  struct Section {
+    const RootSearchSource *source;
+    const RootSearchSource::Results *results;
+  };
+
+  void start(const QString &query);
+  void cancel();
+  bool settled() const { return m_settled; }
+
+  /**
+   * The sections to show in `placement` for the current query, late ones at the end of the ones after the
+   * root items.
+   */
+  std::vector<Section> sections(RootSearchSource::Placement placement) const;
+
+  FederatedRootSearch(RootItemManager &manager, QObject *parent = nullptr);
+
+signals:
+  /**
+   * The query got settled, or a late source came back with results.
+   */
+  void updated() const;
+
+private:
+  using Watcher = QFutureWatcher<RootSearchSource::Results>;
+
+  enum class State { Idle, Pending, TimedOut, Done };
+
+  struct SourceSearch {
+    RootSearchSource *source = nullptr;
+    Watcher watcher;
+    RootSearchSource::Results results;
+    State state = State::Idle;
+    bool late = false;
+  };
+
+  void syncSources();
+  void handleFinished(SourceSearch &search);
+  void handleDeadline();
+  void updateSettled();
+
+  RootItemManager &m_manager;
+  std::vector<std::unique_ptr<SourceSearch>> m_searches;
+  // late searches, in the order they came back
+  std::vector<const SourceSearch *> m_late;
+  QElapsedTimer m_startedAt;
+  QTimer *m_deadline = new QTimer(this);
+  bool m_settled = true;
+};
@@ -1,9 +1,18 @@
 #include "root-item-manager.hpp"
 #include "root-search.hpp"
+#include "memory-budget/memory-budget.hpp"
+#include "services/root-item-manager/root-item-snapshot.hpp"
+#include "sql-profiler/sql-profiler.hpp"
+#include "startup-benchmark.hpp"
 #include <bits/chrono.h>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <qlogging.h>
 #include <qobjectdefs.h>
+#include <qpromise.h>
 #include <ranges>
+#include <unordered_set>
 
 std::vector<std::shared_ptr<RootItem>> RootItemManager::fallbackItems() const {
   auto items = allItems() |
@@ -17,8 +26,42 @@ std::vector<std::shared_ptr<RootItem>> RootItemManager::fallbackItems() const {
   return items;
 }
 
-RootItemMetadata RootItemManager::loadMetadata(const QString &id) {
+static std::vector<QString> itemIds(const std::vector<std::shared_ptr<RootItem>> &items) {
+  return items | std::views::transform([](const auto &item) { return item->uniqueId(); }) |
+         std::ranges::to<std::vector>();
+}
+
+static RootItemMetadata metadataFromRow(const QSqlQuery &query) {
   RootItemMetadata item;
+
+  item.isEnabled = query.value(0).toBool();
+  item.fallbackPosition = query.value(1).toInt();
+  item.alias = query.value(2).toString();
+  item.visitCount = query.value(3).toInt();
+  item.lastVisitedAt = std::chrono::system_clock::from_time_t(query.value(4).toULongLong());
+  item.providerId = query.value(5).toString();
+  item.favorite = query.value(6).toBool();
+
+  return item;
+}
+
+/**
+ * The preference values saved as `rawJson` for `item`, with the default value of the ones that are not set.
+ */
+static QJsonObject withDefaultValues(const RootItem &item, const QString &rawJson) {
+  QJsonObject values = QJsonDocument::fromJson(rawJson.toUtf8()).object();
+
+  for (const auto &preference : item.preferences()) {
+    QJsonValue defaultValue = preference.defaultValue();
+    if (!values.contains(preference.name()) && !defaultValue.isNull()) {
+      values[preference.name()] = defaultValue;
+    }
+  }
+
+  return values;
+}
+
+RootItemMetadata RootItemManager::loadMetadata(const QString &id) {
   QSqlQuery query = m_db.createQuery();
 
   query.prepare(R"(
@@ -30,32 +73,58 @@ RootItemMetadata RootItemManager::loadMetadata(const QString &id) {
 	)");
   query.bindValue(":id", id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to load item metadata for" << id << query.lastError();
     return {};
   }
 
   if (!query.next()) { return {}; };
 
-  item.isEnabled = query.value(0).toBool();
-  item.fallbackPosition = query.value(1).toInt();
-  item.alias = query.value(2).toString();
-  item.visitCount = query.value(3).toInt();
-  item.lastVisitedAt = std::chrono::system_clock::from_time_t(query.value(4).toULongLong());
-  item.providerId = query.value(5).toString();
-  item.favorite = query.value(6).toBool();
-
-  return item;
+  return metadataFromRow(query);
 }
 
-RootItem *RootItemManager::findItemById(const QString &id) const {
-  auto it = std::ranges::find_if(m_items, [&](auto &&v) { return v->uniqueId() == id; });
+RootItem *RootItemManager::findItemById(const QString &id) const { return findSharedItemById(id).get(); }
 
-  if (it != m_items.end()) return it->get();
+std::shared_ptr<RootItem> RootItemManager::findSharedItemById(const QString &id) const {
+  if (auto it = m_itemIndex.find(id); it != m_itemIndex.end()) return m_items[it->second];
 
   return nullptr;
 }
 
+void RootItemManager::indexItems() {
+  m_itemIndex.clear();
+  m_itemIndex.reserve(m_items.size());
+  m_preferenceValues.clear();
+  m_rankingDirty = true;
+
+  // the first item with an id is the one it refers to
+  for (size_t i = 0; i != m_items.size(); ++i) {
+    m_itemIndex.emplace(m_items[i]->uniqueId(), i);
+  }
+}
+
+void RootItemManager::appendItems(const std::vector<std::shared_ptr<RootItem>> &items) {
+  m_items.reserve(m_items.size() + items.size());
+  m_rankingDirty = true;
+
+  for (const auto &item : items) {
+    m_itemIndex.emplace(item->uniqueId(), m_items.size());
+    m_items.emplace_back(item);
+  }
+}
+
+void RootItemManager::dropProviderItems(const QString &id) {
+  auto it = m_providerItems.find(id);
+
+  if (it == m_providerItems.end()) return;
+
+  std::unordered_set<QString> ids(it->second.begin(), it->second.end());
+
+  m_providerItems.erase(it);
+  std::erase_if(m_items, [&](const auto &item) { return ids.contains(item->uniqueId()); });
+  indexItems();
+}
+
 RootProvider *RootItemManager::findProviderById(const QString &id) const {
   auto it = std::ranges::find_if(m_providers, [&](auto &&provider) { return provider->uniqueId() == id; });
 
@@ -72,17 +141,39 @@ void RootItemManager::reloadProviders() {
     return;
   }
 
-  m_items.clear();
+  StartupBenchmark::Scope benchmark("reload-providers");
+
+  // items of the snapshot stay until their provider is added
+  std::erase_if(m_items, [&](const auto &item) {
+    auto snapshotItem = dynamic_cast<const SnapshotRootItem *>(item.get());
+    return !snapshotItem || findProviderById(snapshotItem->owner());
+  });
+  indexItems();
+  m_providerItems.clear();
   isReloading = true;
 
+  // providers do not depend on each other, reloading only takes as long as the slowest one
+  std::vector<QFuture<std::vector<std::shared_ptr<RootItem>>>> loads;
+
+  loads.reserve(m_providers.size());
   for (const auto &provider : m_providers) {
-    auto items = provider->loadItems();
+    auto load = [provider = provider.get()]() { return provider->loadItems(); };
+
+    loads.emplace_back(TaskScheduler::instance().run(TaskScheduler::Priority::Interactive, load));
+  }
+
+  if (!m_db.db().transaction()) { qWarning() << "Failed to start upsert transaction"; }
+
+  for (size_t i = 0; i != m_providers.size(); ++i) {
+    const auto &provider = m_providers[i];
+    auto items = loads[i].result();
 
     if (!upsertProvider(*provider.get())) continue;
 
-    m_items.insert(m_items.end(), items.begin(), items.end());
+    appendItems(items);
+    m_providerItems[provider->uniqueId()] = itemIds(items);
 
-    std::ranges::for_each(items, [&](const auto &item) { upsertItem(provider->uniqueId(), *item.get()); });
+    upsertItems(provider->uniqueId(), items);
 
     auto preferences = getProviderPreferenceValues(provider->uniqueId());
 
@@ -95,33 +186,147 @@ void RootItemManager::reloadProviders() {
     // provider->preferencesChanged(preferences);
   }
 
+  m_db.db().commit();
   isReloading = false;
+  rebuildSearchIndex();
+  m_snapshotTimer->start();
   emit itemsChanged();
 }
 
-bool RootItemManager::upsertItem(const QString &providerId, const RootItem &item) {
+void RootItemManager::reloadProvider(const QString &id) {
+  static bool isReloading = false;
+  auto provider = findProviderById(id);
+
+  if (!provider) return;
+
+  if (isReloading) {
+    qWarning() << "nested reloadProvider() detected, ignoring.";
+    return;
+  }
+
+  isReloading = true;
+  auto items = provider->loadItems();
+  isReloading = false;
+
+  auto &previousIds = m_providerItems[id];
+  std::unordered_set<QString> previous(previousIds.begin(), previousIds.end());
+  std::unordered_set<QString> current;
+  RootItemChanges changes{.providerId = id};
+
+  for (const auto &item : items) {
+    auto itemId = item->uniqueId();
+
+    current.insert(itemId);
+    (previous.contains(itemId) ? changes.updated : changes.added).emplace_back(itemId);
+  }
+
+  for (const auto &itemId : previousIds) {
+    if (!current.contains(itemId)) { changes.removed.emplace_back(itemId); }
+  }
+
+  if (changes.added.empty() && changes.removed.empty() && changes.updated.empty()) return;
+
+  if (!m_db.db().transaction()) { qWarning() << "Failed to start upsert transaction"; }
+
+  for (const auto &item : items) {
+    auto itemId = item->uniqueId();
+
+    if (auto it = m_itemIndex.find(itemId); previous.contains(itemId) && it != m_itemIndex.end()) {
+      m_items[it->second] = item;
+    } else {
+      m_items.emplace_back(item);
+    }
+  }
+
+  // only the new items are saved, the others only get their metadata and preferences
+  upsertItems(id, items);
+  m_db.db().commit();
+
+  if (!changes.removed.empty()) {
+    std::unordered_set<QString> removed(changes.removed.begin(), changes.removed.end());
+
+    std::erase_if(m_items, [&](const auto &item) { return removed.contains(item->uniqueId()); });
+  }
+
+  previousIds = itemIds(items);
+  indexItems();
+  rebuildSearchIndex();
+  m_snapshotTimer->start();
+  emit providerItemsChanged(changes);
+  emit itemsChanged();
+}
+
+std::unordered_map<QString, RootItemManager::ItemRow>
+RootItemManager::loadItemRows(const QString &providerId) {
+  std::unordered_map<QString, ItemRow> rows;
+  QSqlQuery query = m_db.createQuery();
+
+  query.prepare(R"(
+		SELECT
+			enabled, fallback_position, alias, rank_visit_count, rank_last_visited_at, provider_id, favorite, id,
+			preference_values
+		FROM
+			root_provider_item
+		WHERE provider_id = :provider_id
+	)");
+  query.bindValue(":provider_id", providerId);
+
+  if (!SqlProfiler::exec(query)) {
+    qCritical() << "Failed to load the items of provider" << providerId << query.lastError();
+    return rows;
+  }
+
+  while (query.next()) {
+    rows[query.value(7).toString()] = {.metadata = metadataFromRow(query),
+                                       .preferenceValues = query.value(8).toString()};
+  }
+
+  return rows;
+}
+
+void RootItemManager::upsertItems(const QString &providerId,
+                                  const std::vector<std::shared_ptr<RootItem>> &items) {
+  auto rows = loadItemRows(providerId);
   QSqlQuery query = m_db.createQuery();
+  bool inserted = false;
 
+  // saved rows are left alone, they hold what the user changed about their item
   query.prepare(R"(
 		INSERT INTO 
 			root_provider_item (id, provider_id, enabled) 
 		VALUES (:id, :provider_id, :enabled) 
 		ON CONFLICT(id) DO NOTHING
 	)");
-  query.bindValue(":id", item.uniqueId());
-  query.bindValue(":provider_id", providerId);
-  query.bindValue(":enabled", !item.isDefaultDisabled());
 
-  if (!query.exec()) {
-    qCritical() << "Failed to upsert provider with id" << item.uniqueId() << query.lastError();
-    return false;
+  for (const auto &item : items) {
+    if (rows.contains(item->uniqueId())) continue;
+
+    query.bindValue(":id", item->uniqueId());
+    query.bindValue(":provider_id", providerId);
+    query.bindValue(":enabled", !item->isDefaultDisabled());
+
+    if (!SqlProfiler::exec(query)) {
+      qCritical() << "Failed to upsert item with id" << item->uniqueId() << query.lastError();
+      continue;
+    }
+
+    inserted = true;
   }
 
-  m_metadata[item.uniqueId()] = loadMetadata(item.uniqueId());
+  if (inserted) { rows = loadItemRows(providerId); }
 
-  item.preferenceValuesChanged(getItemPreferenceValues(item.uniqueId()));
+  for (const auto &item : items) {
+    auto id = item->uniqueId();
 
-  return true;
+    if (auto it = rows.find(id); it != rows.end()) {
+      m_metadata[id] = it->second.metadata;
+      item->preferenceValuesChanged(withDefaultValues(*item, it->second.preferenceValues));
+    } else {
+      // saved for another provider
+      m_metadata[id] = loadMetadata(id);
+      item->preferenceValuesChanged(getItemPreferenceValues(id));
+    }
+  }
 }
 
 bool RootItemManager::upsertProvider(const RootProvider &provider) {
@@ -136,7 +341,7 @@ bool RootItemManager::upsertProvider(const RootProvider &provider) {
 	)");
   query.bindValue(":id", provider.uniqueId());
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qWarning() << "Failed to upsert provider with id" << provider.uniqueId() << query.lastError();
     return false;
   }
@@ -144,38 +349,156 @@ bool RootItemManager::upsertProvider(const RootProvider &provider) {
   return true;
 }
 
+static const std::chrono::minutes FRECENCY_REFRESH_INTERVAL(10);
+// a selection weighs 1/e of what it did after that long
+static const double QUERY_SELECTION_DECAY_DAYS = 14;
+// below this, what was launched from a query is too old to predict anything
+static const double QUERY_SELECTION_MIN_WEIGHT = 0.5;
+static const std::chrono::days QUERY_SELECTION_RETENTION(90);
+
+void RootItemManager::rebuildSearchIndex() {
+  auto index = std::make_shared<RootSearchIndex>();
+
+  index->rebuild(m_items, m_metadata);
+  m_searchIndex = index;
+  m_searchCache.invalidate();
+  refreshFrecencyScores();
+}
+
+RootSearchIndex &RootItemManager::mutableSearchIndex() {
+  // an asynchronous search is still holding a snapshot of this index
+  if (m_searchIndex.use_count() > 1) { m_searchIndex = std::make_shared<RootSearchIndex>(*m_searchIndex); }
+
+  return *m_searchIndex;
+}
+
+void RootItemManager::refreshFrecencyScores() {
+  for (auto &entry : mutableSearchIndex().entries()) {
+    if (auto it = m_metadata.find(entry.id); it != m_metadata.end()) {
+      entry.frecency = computeScore(it->second, entry.item->baseScoreWeight());
+    } else {
+      entry.frecency = computeScore({}, entry.item->baseScoreWeight());
+    }
+  }
+
+  m_frecencyComputedAt = std::chrono::steady_clock::now();
+}
+
+void RootItemManager::refreshFrecencyScore(const QString &id) {
+  if (auto entry = mutableSearchIndex().find(id)) {
+    entry->frecency = computeScore(itemMetadata(id), entry->item->baseScoreWeight());
+  }
+}
+
+/**
+ * Weight the string score of each result by the frecency of the item, and sort the `limit` best
+ * results. The result at position `topHit` of the index, if it matched, is always ranked first. Results are
+ * reordered in place.
+ */
+static std::vector<std::shared_ptr<RootItem>> rankSearchResults(const RootSearchIndex &index,
+                                                                std::vector<RootSearcher::ScoredItem> &results,
+                                                                std::optional<size_t> limit,
+                                                                std::optional<uint32_t> topHit) {
+  const auto &entries = index.entries();
+
+  for (auto &result : results) {
+    result.score *= entries[result.index].frecency;
+    if (result.index == topHit) { result.score = std::numeric_limits<double>::infinity(); }
+  }
+
+  size_t count = std::min(limit.value_or(results.size()), results.size());
+  auto middle = results.begin() + count;
+
+  std::ranges::partial_sort(results, middle, [](const auto &a, const auto &b) { return a.score > b.score; });
+
+  return std::ranges::subrange(results.begin(), middle) |
+         std::views::transform([](auto &&item) { return item.item; }) | std::ranges::to<std::vector>();
+}
+
+static std::vector<uint32_t> matchedPositions(const std::vector<RootSearcher::ScoredItem> &results) {
+  return results | std::views::transform([](auto &&r) { return r.index; }) | std::ranges::to<std::vector>();
+}
+
 std::vector<std::shared_ptr<RootItem>>
 RootItemManager::prefixSearch(const QString &query, const RootItemPrefixSearchOptions &opts) {
-  RootSearcher searcher(m_metadata);
+  if (std::chrono::steady_clock::now() - m_frecencyComputedAt > FRECENCY_REFRESH_INTERVAL) {
+    refreshFrecencyScores();
+  }
+
+  RootSearcher searcher(*m_searchIndex);
   std::vector<RootSearcher::ScoredItem> results;
 
-  if (!opts.includeDisabled) {
-    auto candidates =
-        m_items |
-        std::views::filter([this](auto &&item) { return itemMetadata(item->uniqueId()).isEnabled; }) |
-        std::ranges::to<std::vector>();
-    results = searcher.search(candidates, query);
+  // the cache only tracks enabled items, searches including disabled ones always go through the full index
+  if (opts.includeDisabled) {
+    results = searcher.search(query, opts);
   } else {
-    results = searcher.search(m_items, query);
+    if (auto candidates = m_searchCache.candidates(query)) {
+      results = searcher.search(query, *candidates, opts);
+    } else {
+      results = searcher.search(query, opts);
+    }
+
+    if (RootSearcher::toleratesTypos(query)) { m_searchCache.update(query, matchedPositions(results)); }
+  }
+
+  return rankSearchResults(*m_searchIndex, results, opts.limit, learnedTopHit(query));
+}
+
+QFuture<std::vector<std::shared_ptr<RootItem>>>
+RootItemManager::prefixSearchAsync(const QString &query, const RootItemPrefixSearchOptions &opts) {
+  m_pendingSearch.cancel();
+
+  if (std::chrono::steady_clock::now() - m_frecencyComputedAt > FRECENCY_REFRESH_INTERVAL) {
+    refreshFrecencyScores();
+  }
+
+  std::shared_ptr<const RootSearchIndex> snapshot = m_searchIndex;
+  std::optional<uint32_t> topHit = learnedTopHit(query);
+  std::optional<std::vector<uint32_t>> candidates;
+  uint64_t cacheGeneration = m_searchCache.generation();
+  QPromise<std::vector<std::shared_ptr<RootItem>>> promise;
+  auto future = promise.future();
+
+  if (!opts.includeDisabled) {
+    if (auto cached = m_searchCache.candidates(query)) { candidates = *cached; }
   }
 
-  std::ranges::sort(results, [this](const auto &a, const auto &b) {
-    auto ameta = itemMetadata(a.item->uniqueId());
-    auto bmeta = itemMetadata(b.item->uniqueId());
-    auto ascore = a.score * computeScore(ameta, a.item->baseScoreWeight());
-    auto bscore = b.score * computeScore(bmeta, b.item->baseScoreWeight());
+  promise.start();
+  m_searchQueue.start([this, snapshot, candidates = std::move(candidates), query, opts, cacheGeneration,
+                       topHit, promise = std::move(promise)]() mutable {
+    RootSearcher searcher(*snapshot);
 
-    return ascore > bscore;
+    searcher.setCancellationCheck([&promise]() { return promise.isCanceled(); });
+
+    auto results = candidates ? searcher.search(query, *candidates, opts) : searcher.search(query, opts);
+
+    if (promise.isCanceled()) {
+      promise.finish();
+      return;
+    }
+
+    if (!opts.includeDisabled && RootSearcher::toleratesTypos(query)) {
+      // the cache is owned by the main thread. Queued calls are delivered in order, so this is
+      // processed before the caller is notified of the result.
+      QMetaObject::invokeMethod(
+          this,
+          [this, query, cacheGeneration, matches = matchedPositions(results)]() mutable {
+            if (m_searchCache.generation() == cacheGeneration) { m_searchCache.update(query, std::move(matches)); }
+          },
+          Qt::QueuedConnection);
+    }
+
+    promise.addResult(rankSearchResults(*snapshot, results, opts.limit, topHit));
+    promise.finish();
   });
 
-  return results | std::views::transform([](auto &&item) { return item.item; }) |
-         std::ranges::to<std::vector>();
+  m_pendingSearch = future;
+
+  return future;
 }
 
 bool RootItemManager::setItemEnabled(const QString &id, bool value) {
-  auto it = std::ranges::find_if(m_items, [&id](const auto &item) { return item->uniqueId() == id; });
-
-  if (it == m_items.end()) {
+  if (!findItemById(id)) {
     qCritical() << "No such item to enable" << id;
     return false;
   }
@@ -186,15 +509,18 @@ bool RootItemManager::setItemEnabled(const QString &id, bool value) {
   query.bindValue(":enabled", value);
   query.bindValue(":id", id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qDebug() << "Failed to update item" << query.lastError();
     return false;
   }
 
-  auto metadata = itemMetadata((*it)->uniqueId());
+  auto metadata = itemMetadata(id);
 
   metadata.isEnabled = value;
-  m_metadata[(*it)->uniqueId()] = metadata;
+  m_metadata[id] = metadata;
+  mutableSearchIndex().setEnabled(id, value);
+  m_searchCache.invalidate();
+  rerankItem(id);
 
   return true;
 }
@@ -212,11 +538,13 @@ bool RootItemManager::setProviderPreferenceValues(const QString &id, const QJson
   query.bindValue(":preferences", json.toJson());
   query.bindValue(":id", id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qDebug() << "setRepositoryPreferenceValues:" << query.lastError();
     return false;
   }
 
+  std::erase_if(m_preferenceValues,
+                [&](const auto &entry) { return itemMetadata(entry.first).providerId == id; });
   provider->preferencesChanged(preferences);
 
   return true;
@@ -238,11 +566,12 @@ bool RootItemManager::setItemPreferenceValues(const QString &id, const QJsonObje
   query.bindValue(":preferences", json.toJson());
   query.bindValue(":id", id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qDebug() << "setCommandPreferenceValues:" << query.lastError().driverText();
     return false;
   }
 
+  m_preferenceValues.erase(id);
   item->preferenceValuesChanged(preferences);
 
   return true;
@@ -292,9 +621,7 @@ void RootItemManager::setPreferenceValues(const QString &id, const QJsonObject &
 }
 
 bool RootItemManager::setAlias(const QString &id, const QString &alias) {
-  auto it = std::ranges::find_if(m_items, [&id](const auto &item) { return item->uniqueId() == id; });
-
-  if (it == m_items.end()) {
+  if (!findItemById(id)) {
     qCritical() << "setAlias: no item with id " << id;
     return false;
   }
@@ -305,7 +632,7 @@ bool RootItemManager::setAlias(const QString &id, const QString &alias) {
   query.bindValue(":alias", alias);
   query.bindValue(":id", id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qDebug() << "Failed to update item" << query.lastError();
     return false;
   }
@@ -314,6 +641,7 @@ bool RootItemManager::setAlias(const QString &id, const QString &alias) {
 
   metadata.alias = alias;
   m_metadata[id] = metadata;
+  rebuildSearchIndex();
 
   qDebug() << "Set alias";
 
@@ -335,7 +663,7 @@ QJsonObject RootItemManager::getProviderPreferenceValues(const QString &id) cons
 	)");
   query.addBindValue(id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qDebug() << "Failed to get preference values for provider with ID" << id << query.lastError();
     return {};
   }
@@ -356,7 +684,7 @@ bool RootItemManager::pruneProvider(const QString &id) {
   query.prepare("DELETE FROM root_provider WHERE id = :id");
   query.addBindValue(id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "pruneProvider() failed" << id << query.lastError();
     return false;
   }
@@ -366,11 +694,9 @@ bool RootItemManager::pruneProvider(const QString &id) {
 
 QJsonObject RootItemManager::getItemPreferenceValues(const QString &id) const {
   auto query = m_db.createQuery();
-  auto it = std::ranges::find_if(m_items, [&id](const auto &item) { return item->uniqueId() == id; });
-
-  if (it == m_items.end()) { return {}; }
+  auto item = findItemById(id);
 
-  auto &item = *it;
+  if (!item) { return {}; }
 
   query.prepare(R"(
 		SELECT 
@@ -382,7 +708,7 @@ QJsonObject RootItemManager::getItemPreferenceValues(const QString &id) const {
 	)");
   query.addBindValue(id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qDebug() << "Failed to get preference values for provider with ID" << id << query.lastError();
     return {};
   }
@@ -391,18 +717,8 @@ QJsonObject RootItemManager::getItemPreferenceValues(const QString &id) const {
     qDebug() << "No results";
     return {};
   }
-  auto rawJson = query.value(0).toString();
-  auto json = QJsonDocument::fromJson(rawJson.toUtf8());
-  QJsonObject values = json.object();
 
-  for (const auto &preference : item->preferences()) {
-    QJsonValue defaultValue = preference.defaultValue();
-    if (!values.contains(preference.name()) && !defaultValue.isNull()) {
-      values[preference.name()] = defaultValue;
-    }
-  }
-
-  return values;
+  return withDefaultValues(*item, query.value(0).toString());
 }
 
 std::vector<Preference> RootItemManager::getMergedItemPreferences(const QString &rootItemId) const {
@@ -421,16 +737,15 @@ std::vector<Preference> RootItemManager::getMergedItemPreferences(const QString
 }
 
 QJsonObject RootItemManager::getPreferenceValues(const QString &id) const {
+  if (auto it = m_preferenceValues.find(id); it != m_preferenceValues.end()) return it->second;
+
   auto query = m_db.createQuery();
-  auto it = std::ranges::find_if(m_items, [&](auto &&item) { return item->uniqueId() == id; });
 
-  if (it == m_items.end()) {
+  if (!findItemById(id)) {
     qWarning() << "No item with id" << id;
     return {};
   }
 
-  auto &item = *it;
-
   query.prepare(R"(
 		SELECT 
 			json_patch(provider.preference_values, item.preference_values) as preference_values 
@@ -445,7 +760,7 @@ QJsonObject RootItemManager::getPreferenceValues(const QString &id) const {
 	)");
   query.addBindValue(id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qDebug() << "Failed to get preference values for command with ID" << id << query.lastError();
     return {};
   }
@@ -467,6 +782,8 @@ QJsonObject RootItemManager::getPreferenceValues(const QString &id) const {
     }
   }
 
+  m_preferenceValues[id] = preferenceValues;
+
   return preferenceValues;
 }
 
@@ -496,7 +813,7 @@ bool RootItemManager::moveFallbackDown(const QString &id) {
       "SELECT id FROM root_provider_item WHERE fallback_position > :pos ORDER BY fallback_position ASC");
   query.bindValue(":pos", pos);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qWarning() << "Failed to exec" << query.lastError();
     return false;
   }
@@ -513,7 +830,7 @@ bool RootItemManager::moveFallbackDown(const QString &id) {
     updateQuery.bindValue(":pos", pos);
     updateQuery.bindValue(":id", nextId);
 
-    if (!updateQuery.exec()) {
+    if (!SqlProfiler::exec(updateQuery)) {
       qWarning() << "Failed to exec" << query.lastError();
       return false;
     }
@@ -524,7 +841,7 @@ bool RootItemManager::moveFallbackDown(const QString &id) {
       updateQuery.bindValue(":pos", ++pos);
       updateQuery.bindValue(":id", id);
 
-      if (!updateQuery.exec()) {
+      if (!SqlProfiler::exec(updateQuery)) {
         qWarning() << "Failed to exec" << query.lastError();
         return false;
       }
@@ -546,14 +863,14 @@ bool RootItemManager::disableFallback(const QString &id) {
 
   query.prepare("SELECT id, fallback_position FROM root_provider_item WHERE fallback_position >= 0 ORDER BY "
                 "fallback_position");
-  query.exec();
+  SqlProfiler::exec(query);
 
   QSqlQuery updateQuery = m_db.createQuery();
 
   updateQuery.prepare("UPDATE root_provider_item SET fallback_position = :pos WHERE id = :id");
   updateQuery.bindValue(":pos", -1);
   updateQuery.bindValue(":id", id);
-  updateQuery.exec();
+  SqlProfiler::exec(updateQuery);
   m_metadata[id].fallbackPosition = -1;
 
   int normalizedPos = 0;
@@ -565,7 +882,7 @@ bool RootItemManager::disableFallback(const QString &id) {
 
     updateQuery.bindValue(":pos", normalizedPos);
     updateQuery.bindValue(":id", nextId);
-    updateQuery.exec();
+    SqlProfiler::exec(updateQuery);
     m_metadata[nextId].fallbackPosition = normalizedPos;
     ++normalizedPos;
   }
@@ -580,7 +897,7 @@ bool RootItemManager::enableFallback(const QString &id) {
 
   query.prepare("SELECT id, fallback_position FROM root_provider_item WHERE fallback_position >= 0 ORDER BY "
                 "fallback_position");
-  query.exec();
+  SqlProfiler::exec(query);
 
   QSqlQuery updateQuery = m_db.createQuery();
 
@@ -588,7 +905,7 @@ bool RootItemManager::enableFallback(const QString &id) {
   updateQuery.bindValue(":pos", 0);
   updateQuery.bindValue(":id", id);
 
-  if (!updateQuery.exec()) {
+  if (!SqlProfiler::exec(updateQuery)) {
     qWarning() << "failed to update" << updateQuery.lastError();
     return false;
   }
@@ -604,7 +921,7 @@ bool RootItemManager::enableFallback(const QString &id) {
 
     updateQuery.bindValue(":pos", normalizedPos);
     updateQuery.bindValue(":id", nextId);
-    updateQuery.exec();
+    SqlProfiler::exec(updateQuery);
     m_metadata[nextId].fallbackPosition = normalizedPos;
     ++normalizedPos;
   }
@@ -624,7 +941,7 @@ bool RootItemManager::moveFallbackUp(const QString &id) {
                 "ORDER BY fallback_position DESC");
   query.bindValue(":pos", pos);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qWarning() << "Failed to exec" << query.lastError();
     return false;
   }
@@ -641,7 +958,7 @@ bool RootItemManager::moveFallbackUp(const QString &id) {
     updateQuery.bindValue(":pos", pos);
     updateQuery.bindValue(":id", nextId);
 
-    if (!updateQuery.exec()) {
+    if (!SqlProfiler::exec(updateQuery)) {
       qWarning() << "Failed to exec" << query.lastError();
       return false;
     }
@@ -652,7 +969,7 @@ bool RootItemManager::moveFallbackUp(const QString &id) {
       updateQuery.bindValue(":pos", --pos);
       updateQuery.bindValue(":id", id);
 
-      if (!updateQuery.exec()) {
+      if (!SqlProfiler::exec(updateQuery)) {
         qWarning() << "Failed to exec" << query.lastError();
         return false;
       }
@@ -680,12 +997,13 @@ bool RootItemManager::setItemAsFavorite(const QString &itemId, bool value) {
   query.addBindValue(value);
   query.addBindValue(itemId);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to set item as favorite" << itemId << value;
     return false;
   }
 
   m_metadata[itemId].favorite = value;
+  rerankItem(itemId);
   emit itemFavoriteChanged(itemId, value);
 
   return true;
@@ -711,48 +1029,100 @@ double RootItemManager::computeScore(const RootItemMetadata &meta, int weight) c
   return (frequencyScore + recencyScore) * weight;
 }
 
-std::vector<std::shared_ptr<RootItem>> RootItemManager::queryFavorites(int limit) {
-  auto items = m_items | std::views::transform([this](const std::shared_ptr<RootItem> &item) {
-                 RootItemMetadata meta = itemMetadata(item->uniqueId());
-                 return std::pair<std::shared_ptr<RootItem>, RootItemMetadata>(item, meta);
-               }) |
-               std::views::filter([](auto &&item) { return item.second.isEnabled && item.second.favorite; }) |
-               std::ranges::to<std::vector>();
+void RootItemManager::rankItems() {
+  static const RootItemMetadata defaultMetadata;
+  auto byScore = [](const RankedItem &a, const RankedItem &b) { return a.score > b.score; };
 
-  std::ranges::sort(items, [this](const auto &a, const auto &b) {
-    const auto &[aitem, ameta] = a;
-    const auto &[bitem, bmeta] = b;
+  m_favorites.clear();
+  m_suggestions.clear();
 
-    auto ascore = computeScore(ameta, aitem->baseScoreWeight());
-    auto bscore = computeScore(ameta, bitem->baseScoreWeight());
+  for (const auto &item : m_items) {
+    auto it = m_metadata.find(item->uniqueId());
+    const auto &meta = it == m_metadata.end() ? defaultMetadata : it->second;
 
-    return ameta.visitCount > bmeta.visitCount;
-  });
+    if (!meta.isEnabled) continue;
+    if (meta.favorite) {
+      m_favorites.push_back({.item = item, .score = static_cast<double>(meta.visitCount)});
+    }
+    if (meta.visitCount > 0) {
+      m_suggestions.push_back({.item = item, .score = computeScore(meta, item->baseScoreWeight())});
+    }
+  }
+
+  // only the first few suggestions are kept, there is no point in sorting all of them
+  auto middle = m_suggestions.begin() + std::min(m_suggestionCapacity, m_suggestions.size());
+
+  std::ranges::stable_sort(m_favorites, byScore);
+  std::partial_sort(m_suggestions.begin(), middle, m_suggestions.end(), byScore);
+  m_suggestionsTruncated = middle != m_suggestions.end();
+  m_suggestions.erase(middle, m_suggestions.end());
+  m_rankingDirty = false;
+}
+
+void RootItemManager::rerankItem(const QString &id) {
+  if (m_rankingDirty) return;
+
+  auto item = findSharedItemById(id);
+  auto it = m_metadata.find(id);
+  bool enabled = item && it != m_metadata.end() && it->second.isEnabled;
+  auto byId = [&](const RankedItem &ranked) { return ranked.item->uniqueId() == id; };
+  auto place = [](std::vector<RankedItem> &items, RankedItem ranked) {
+    auto pos = std::ranges::upper_bound(items, ranked.score, std::greater{}, &RankedItem::score);
+
+    items.insert(pos, std::move(ranked));
+  };
+
+  std::erase_if(m_favorites, byId);
+
+  if (enabled && it->second.favorite) {
+    place(m_favorites, {.item = item, .score = static_cast<double>(it->second.visitCount)});
+  }
+
+  std::optional<double> previousScore;
+
+  if (auto previous = std::ranges::find_if(m_suggestions, byId); previous != m_suggestions.end()) {
+    previousScore = previous->score;
+    m_suggestions.erase(previous);
+  }
+
+  if (!enabled || it->second.visitCount == 0) {
+    // the item that was left out and now makes it in is not known
+    if (previousScore && m_suggestionsTruncated) { m_rankingDirty = true; }
+    return;
+  }
+
+  double score = computeScore(it->second, item->baseScoreWeight());
+
+  // items that were left out may rank higher than this one now
+  if (previousScore && score < *previousScore && m_suggestionsTruncated) {
+    m_rankingDirty = true;
+    return;
+  }
+
+  place(m_suggestions, {.item = item, .score = score});
+
+  if (m_suggestions.size() > m_suggestionCapacity) {
+    m_suggestions.pop_back();
+    m_suggestionsTruncated = true;
+  }
+}
+
+std::vector<std::shared_ptr<RootItem>> RootItemManager::queryFavorites(int limit) {
+  if (m_rankingDirty) { rankItems(); }
 
-  return items | std::views::take(limit) | std::views::transform([](auto &&a) { return a.first; }) |
+  return m_favorites | std::views::take(std::max(limit, 0)) | std::views::transform(&RankedItem::item) |
          std::ranges::to<std::vector>();
 }
 
 std::vector<std::shared_ptr<RootItem>> RootItemManager::querySuggestions(int limit) {
-  auto items =
-      m_items | std::views::transform([this](const std::shared_ptr<RootItem> &item) {
-        RootItemMetadata meta = itemMetadata(item->uniqueId());
-        return std::pair<std::shared_ptr<RootItem>, RootItemMetadata>(item, meta);
-      }) |
-      std::views::filter([](auto &&item) { return item.second.isEnabled && item.second.visitCount > 0; }) |
-      std::ranges::to<std::vector>();
-
-  std::ranges::sort(items, [this](const auto &a, const auto &b) {
-    const auto &[aitem, ameta] = a;
-    const auto &[bitem, bmeta] = b;
-
-    auto ascore = computeScore(ameta, aitem->baseScoreWeight());
-    auto bscore = computeScore(bmeta, bitem->baseScoreWeight());
-
-    return ascore > bscore;
-  });
+  if (static_cast<size_t>(std::max(limit, 0)) > m_suggestionCapacity) {
+    m_suggestionCapacity = limit;
+    m_rankingDirty = true;
+  }
+
+  if (m_rankingDirty) { rankItems(); }
 
-  return items | std::views::take(limit) | std::views::transform([](auto &&a) { return a.first; }) |
+  return m_suggestions | std::views::take(std::max(limit, 0)) | std::views::transform(&RankedItem::item) |
          std::ranges::to<std::vector>();
 }
 
@@ -768,7 +1138,7 @@ bool RootItemManager::resetRanking(const QString &id) {
 	)");
   query.addBindValue(id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to reset ranking" << query.lastError();
     return false;
   }
@@ -777,35 +1147,130 @@ bool RootItemManager::resetRanking(const QString &id) {
 
   metadata.lastVisitedAt = std::nullopt;
   metadata.visitCount = 0;
+  refreshFrecencyScore(id);
+  rerankItem(id);
+  forgetQuerySelections(id);
   emit itemRankingReset(id);
 
   return true;
 }
 
-bool RootItemManager::registerVisit(const QString &id) {
+void RootItemManager::loadQuerySelections() {
   QSqlQuery query = m_db.createQuery();
 
-  query.prepare(R"(
+  query.prepare("DELETE FROM root_query_selection WHERE last_selected_at < unixepoch() - ?");
+  query.addBindValue(static_cast<qint64>(std::chrono::seconds(QUERY_SELECTION_RETENTION).count()));
+
+  if (!SqlProfiler::exec(query)) { qWarning() << "Failed to prune query selections" << query.lastError(); }
+
+  if (!SqlProfiler::exec(query, "SELECT query, item_id, selection_count, last_selected_at "
+                                "FROM root_query_selection")) {
+    qCritical() << "Failed to load query selections" << query.lastError();
+    return;
+  }
+
+  while (query.next()) {
+    QuerySelection selection{
+        .itemId = query.value(1).toString(),
+        .count = query.value(2).toInt(),
+        .lastSelectedAt = std::chrono::sys_seconds(std::chrono::seconds(query.value(3).toLongLong())),
+    };
+
+    m_querySelections[query.value(0).toString()].emplace_back(std::move(selection));
+  }
+}
+
+void RootItemManager::registerQuerySelection(const QString &query, const QString &id) {
+  QString key = TextTokenizer::normalize(query.trimmed());
+
+  if (key.isEmpty()) return;
+
+  static const QString sql = R"(
+		INSERT INTO root_query_selection (query, item_id, selection_count, last_selected_at)
+		VALUES (?, ?, 1, unixepoch())
+		ON CONFLICT(query, item_id) DO UPDATE
+		SET
+			selection_count = selection_count + 1,
+			last_selected_at = unixepoch()
+	)";
+
+  m_db.deferWrite(sql, {key, id});
+
+  auto &selections = m_querySelections[key];
+  auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+
+  if (auto it = std::ranges::find(selections, id, &QuerySelection::itemId); it != selections.end()) {
+    it->count += 1;
+    it->lastSelectedAt = now;
+  } else {
+    selections.push_back({.itemId = id, .count = 1, .lastSelectedAt = now});
+  }
+}
+
+void RootItemManager::forgetQuerySelections(const QString &id) {
+  m_db.deferWrite("DELETE FROM root_query_selection WHERE item_id = ?", {id});
+
+  for (auto it = m_querySelections.begin(); it != m_querySelections.end();) {
+    std::erase_if(it->second, [&](const QuerySelection &selection) { return selection.itemId == id; });
+    it = it->second.empty() ? m_querySelections.erase(it) : std::next(it);
+  }
+}
+
+std::optional<uint32_t> RootItemManager::learnedTopHit(const QString &query) const {
+  auto it = m_querySelections.find(TextTokenizer::normalize(query.trimmed()));
+
+  if (it == m_querySelections.end()) return std::nullopt;
+
+  auto now = std::chrono::system_clock::now();
+  const QuerySelection *best = nullptr;
+  double bestWeight = QUERY_SELECTION_MIN_WEIGHT;
+
+  for (const auto &selection : it->second) {
+    auto age = now - selection.lastSelectedAt;
+    double days = std::chrono::duration<double, std::chrono::days::period>(age).count();
+    double weight = selection.count * std::exp(-days / QUERY_SELECTION_DECAY_DAYS);
+
+    if (weight >= bestWeight) {
+      best = &selection;
+      bestWeight = weight;
+    }
+  }
+
+  if (!best) return std::nullopt;
+
+  return m_searchIndex->position(best->itemId);
+}
+
+bool RootItemManager::registerVisit(const QString &id, const QString &query) {
+  auto it = m_metadata.find(id);
+
+  if (it == m_metadata.end()) {
+    qDebug() << "Failed to update item: no item with id" << id;
+    return false;
+  }
+
+  static const QString sql = R"(
 		UPDATE root_provider_item 
 		SET 
 			visit_count = visit_count + 1,
 			rank_visit_count = rank_visit_count + 1,
 			last_visited_at = unixepoch(),
 			rank_last_visited_at = unixepoch()
-		WHERE id = :id
-		RETURNING rank_visit_count, rank_last_visited_at, visit_count, last_visited_at
-	)");
-  query.bindValue(":id", id);
+		WHERE id = ?
+	)";
 
-  if (!query.exec() || !query.next()) {
-    qDebug() << "Failed to update item" << query.lastError();
-    return false;
-  }
+  // the ranking is computed from the metadata in memory, the database only needs to catch up eventually
+  m_db.deferWrite(sql, {id});
 
-  RootItemMetadata &meta = m_metadata[id];
+  RootItemMetadata &meta = it->second;
 
-  meta.visitCount = query.value(0).toInt();
-  meta.lastVisitedAt = std::chrono::system_clock::from_time_t(query.value(1).toULongLong());
+  meta.visitCount += 1;
+  // as stored by unixepoch()
+  meta.lastVisitedAt = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+  refreshFrecencyScore(id);
+  rerankItem(id);
+  if (!query.isEmpty()) { registerQuerySelection(query, id); }
+  emit itemVisited(id);
 
   return true;
 }
@@ -827,16 +1292,21 @@ bool RootItemManager::setProviderEnabled(const QString &providerId, bool value)
   query.bindValue(":enabled", value);
   query.bindValue(":provider_id", providerId);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qDebug() << "Failed to update item" << query.lastError();
     return false;
   }
 
   for (auto &[id, metadata] : m_metadata) {
-    if (providerId == metadata.providerId) { metadata.isEnabled = value; }
+    if (providerId == metadata.providerId) {
+      metadata.isEnabled = value;
+      mutableSearchIndex().setEnabled(id, value);
+    }
   }
 
   m_provider_metadata[providerId].enabled = value;
+  m_searchCache.invalidate();
+  m_rankingDirty = true;
 
   return true;
 }
@@ -851,43 +1321,98 @@ std::vector<RootProvider *> RootItemManager::providers() const {
 }
 
 void RootItemManager::removeProvider(const QString &id) {
+  if (!findProviderById(id)) return;
+
   pruneProvider(id);
+  dropProviderItems(id);
   std::erase_if(m_providers, [&](auto &&p) { return p->uniqueId() == id; });
-  reloadProviders();
+  rebuildSearchIndex();
+  m_snapshotTimer->start();
+  emit itemsChanged();
 }
 
 void RootItemManager::addProvider(std::unique_ptr<RootProvider> provider) {
-  auto items = provider->loadItems();
+  std::vector<std::unique_ptr<RootProvider>> providers;
+
+  providers.emplace_back(std::move(provider));
+  addProviders(std::move(providers));
+}
+
+void RootItemManager::addProviders(std::vector<std::unique_ptr<RootProvider>> providers) {
+  std::vector<QFuture<std::vector<std::shared_ptr<RootItem>>>> loads;
+  std::vector<std::pair<std::unique_ptr<RootProvider>, std::vector<std::shared_ptr<RootItem>>>> loaded;
+  std::unordered_set<QString> providerIds;
+  std::unordered_set<QString> previousIds;
+
+  if (providers.empty()) return;
+
+  loads.reserve(providers.size());
+  for (const auto &provider : providers) {
+    auto load = [provider = provider.get()]() { return provider->loadItems(); };
+
+    loads.emplace_back(TaskScheduler::instance().run(TaskScheduler::Priority::Interactive, load));
+  }
 
   if (!m_db.db().transaction()) { qWarning() << "Failed to start upsert transaction"; }
 
-  if (!upsertProvider(*provider.get())) {
-    m_db.db().rollback();
-    return;
+  for (size_t i = 0; i != providers.size(); ++i) {
+    auto items = loads[i].result();
+
+    if (!upsertProvider(*providers[i].get())) continue;
+
+    providerIds.insert(providers[i]->uniqueId());
+    loaded.emplace_back(std::move(providers[i]), std::move(items));
+  }
+
+  // the items of the snapshot and of the previous version of the providers are replaced
+  for (const auto &id : providerIds) {
+    if (auto it = m_providerItems.find(id); it != m_providerItems.end()) {
+      previousIds.insert(it->second.begin(), it->second.end());
+      m_providerItems.erase(it);
+    }
   }
 
-  m_items.insert(m_items.end(), items.begin(), items.end());
+  std::erase_if(m_items, [&](const auto &item) {
+    auto snapshotItem = dynamic_cast<const SnapshotRootItem *>(item.get());
+
+    if (snapshotItem) return providerIds.contains(snapshotItem->owner());
+
+    return previousIds.contains(item->uniqueId());
+  });
+  indexItems();
+  std::erase_if(m_providers, [&](auto &&p) { return providerIds.contains(p->uniqueId()); });
 
-  std::ranges::for_each(items, [&](const auto &item) { upsertItem(provider->uniqueId(), *item.get()); });
+  for (const auto &[provider, items] : loaded) {
+    appendItems(items);
+    m_providerItems[provider->uniqueId()] = itemIds(items);
+    upsertItems(provider->uniqueId(), items);
+  }
 
   m_db.db().commit();
 
-  auto preferences = getProviderPreferenceValues(provider->uniqueId());
+  for (auto &[provider, items] : loaded) {
+    auto preferences = getProviderPreferenceValues(provider->uniqueId());
 
-  if (preferences.empty()) {
-    preferences = provider->generateDefaultPreferences();
+    if (preferences.empty()) {
+      preferences = provider->generateDefaultPreferences();
 
-    if (!preferences.empty()) {
-      qCritical() << "set default preferences for app" << provider->uniqueId();
-      setProviderPreferenceValues(provider->uniqueId(), preferences);
+      if (!preferences.empty()) {
+        qCritical() << "set default preferences for app" << provider->uniqueId();
+        setProviderPreferenceValues(provider->uniqueId(), preferences);
+      }
     }
+
+    provider->preferencesChanged(preferences);
+
+    connect(provider.get(), &RootProvider::itemsChanged, this,
+            [this, name = provider->uniqueId()]() { reloadProvider(name); });
+    m_providers.emplace_back(std::move(provider));
   }
 
-  provider->preferencesChanged(preferences);
+  if (loaded.empty()) return;
 
-  connect(provider.get(), &RootProvider::itemsChanged, this,
-          [this, name = provider->uniqueId()]() { reloadProviders(); });
-  m_providers.emplace_back(std::move(provider));
+  rebuildSearchIndex();
+  m_snapshotTimer->start();
   emit itemsChanged();
 }
 
@@ -898,3 +1423,123 @@ RootProvider *RootItemManager::provider(const QString &id) const {
 
   return nullptr;
 }
+
+void RootItemManager::addSearchSource(std::unique_ptr<RootSearchSource> source) {
+  m_searchSources.emplace_back(std::move(source));
+}
+
+std::vector<RootSearchSource *> RootItemManager::searchSources() const {
+  return m_searchSources | std::views::transform([](const auto &source) { return source.get(); }) |
+         std::ranges::to<std::vector>();
+}
+
+bool RootItemManager::hasSnapshotItems() const {
+  return std::ranges::any_of(
+      m_items, [](const auto &item) { return dynamic_cast<const SnapshotRootItem *>(item.get()); });
+}
+
+void RootItemManager::loadSnapshot(const std::filesystem::path &path) {
+  m_snapshotPath = path;
+
+  auto items = RootItemSnapshot::load(path);
+
+  if (items.empty()) return;
+
+  std::unordered_map<QString, RootItemMetadata> metadata;
+  QSqlQuery query = m_db.createQuery();
+
+  // one query for all of them, providers upsert their items one at a time
+  bool ok = SqlProfiler::exec(query, R"(
+		SELECT
+			enabled, fallback_position, alias, rank_visit_count, rank_last_visited_at, provider_id, favorite, id
+		FROM
+			root_provider_item
+	)");
+
+  if (!ok) {
+    qCritical() << "Failed to load item metadata for snapshot" << query.lastError();
+    return;
+  }
+
+  while (query.next()) {
+    metadata[query.value(7).toString()] = metadataFromRow(query);
+  }
+
+  for (const auto &item : items) {
+    if (findProviderById(item.owner) || findItemById(item.id)) continue;
+
+    appendItems({std::make_shared<SnapshotRootItem>(item, *this)});
+    m_metadata[item.id] = metadata[item.id];
+  }
+
+  rebuildSearchIndex();
+  emit itemsChanged();
+}
+
+void RootItemManager::dropSnapshotItems() {
+  if (!hasSnapshotItems()) return;
+
+  std::erase_if(m_items,
+                [](const auto &item) { return dynamic_cast<const SnapshotRootItem *>(item.get()); });
+  indexItems();
+  rebuildSearchIndex();
+  m_snapshotTimer->start();
+  emit itemsChanged();
+}
+
+std::shared_ptr<RootItem> RootItemManager::resolveSnapshotItem(const QString &id) {
+  if (hasSnapshotItems()) { emit providersRequired(); }
+
+  auto item = findSharedItemById(id);
+
+  if (!item || dynamic_cast<const SnapshotRootItem *>(item.get())) return nullptr;
+
+  return item;
+}
+
+void RootItemManager::saveSnapshot() {
+  // a snapshot missing the items of the providers that are not added yet would hide them next time
+  if (m_snapshotPath.empty() || hasSnapshotItems()) return;
+
+  std::vector<RootItemSnapshot::Item> items;
+
+  items.reserve(m_items.size());
+
+  for (const auto &item : m_items) {
+    auto id = item->uniqueId();
+    auto meta = m_metadata.find(id);
+
+    if (meta == m_metadata.end()) continue;
+
+    items.emplace_back(RootItemSnapshot::Item{.owner = meta->second.providerId,
+                                              .providerId = item->providerId(),
+                                              .id = id,
+                                              .name = item->displayName(),
+                                              .subtitle = item->subtitle(),
+                                              .typeName = item->typeDisplayName(),
+                                              .icon = item->iconUrl().toString(),
+                                              .keywords = item->keywords(),
+                                              .weight = item->baseScoreWeight(),
+                                              .fallback = item->isSuitableForFallback()});
+  }
+
+  RootItemSnapshot::save(m_snapshotPath, items);
+}
+
+RootItemManager::RootItemManager(OmniDatabase &db) : m_db(db) {
+  // providers are added one after the other at startup, only the final set of items is worth saving
+  m_snapshotTimer->setSingleShot(true);
+  m_snapshotTimer->setInterval(2000);
+  connect(m_snapshotTimer, &QTimer::timeout, this, &RootItemManager::saveSnapshot);
+  // recency decays with time, rankings are refreshed now and then rather than when the root view is shown
+  m_rankingTimer->setInterval(FRECENCY_REFRESH_INTERVAL);
+  connect(m_rankingTimer, &QTimer::timeout, this, [this]() {
+    // otherwise they are ranked from scratch the next time they are needed anyway
+    if (!m_rankingDirty) { rankItems(); }
+  });
+  m_rankingTimer->start();
+  loadQuerySelections();
+  // the index is always needed to search, it is only accounted for
+  MemoryBudget::instance().add({.subsystem = MemoryBudget::Subsystem::RootSearchIndex,
+                                .usage = [this]() { return m_searchIndex->memUsage(); }});
+}
@@ -6,8 +6,13 @@
 #include "omni-database.hpp"
 #include "../../ui/image/url.hpp"
 #include "preference.hpp"
+#include "services/root-item-manager/federated-root-search.hpp"
+#include "services/root-item-manager/root-search-index.hpp"
+#include "lib/incremental-search-cache.hpp"
+#include "task-scheduler/task-scheduler.hpp"
 #include "ui/action-pannel/action.hpp"
 #include "ui/default-list-item-widget/default-list-item-widget.hpp"
+#include <filesystem>
 #include <qdnslookup.h>
 #include <qjsonobject.h>
 #include <qjsonvalue.h>
@@ -18,6 +23,8 @@
 #include <qsqlquery.h>
 #include <qstring.h>
 #include <qhash.h>
+#include <qfuture.h>
+#include <qtimer.h>
 #include <qtmetamacros.h>
 #include <qwidget.h>
 
@@ -25,6 +32,11 @@ class RootItemMetadata;
 
 struct RootItemPrefixSearchOptions {
   bool includeDisabled = false;
+  /**
+   * Only return the `limit` best ranked results. Only these results are sorted, which is
+   * much cheaper than ranking the full result set.
+   */
+  std::optional<size_t> limit;
 };
 
 class RootItem {
@@ -114,6 +126,12 @@ public:
   virtual std::vector<QString> keywords() const { return {}; }
 
   virtual void preferenceValuesChanged(const QJsonObject &values) const {}
+
+  /**
+   * Called when the item stayed selected in the root search for a little while, as it is likely to be
+   * activated next. Items that are slow to start can get a head start there.
+   */
+  virtual void prewarm(ApplicationContext *ctx) const {}
 };
 
 class RootProvider : public QObject {
@@ -164,6 +182,12 @@ public:
   // function is called.
   void intialize(QJsonObject &preference) {}
 
+  /**
+   * The items this provider currently has. Providers are loaded concurrently from a thread pool while the GUI
+   * thread waits for them: this is expected to only read the state of the provider and build items out of
+   * it, without creating any QObject or widget, nor going through the database connections of the GUI
+   * thread.
+   */
   virtual std::vector<std::shared_ptr<RootItem>> loadItems() const = 0;
   virtual PreferenceList preferences() const { return {}; }
 
@@ -189,6 +213,17 @@ struct RootProviderMetadata {
   bool enabled;
 };
 
+/**
+ * What changed in the items of a provider when it was reloaded, by item id. Updated items are the ones that
+ * were loaded again, as new objects.
+ */
+struct RootItemChanges {
+  QString providerId;
+  std::vector<QString> added;
+  std::vector<QString> removed;
+  std::vector<QString> updated;
+};
+
 class RootItemManager : public QObject {
 private:
   Q_OBJECT
@@ -198,20 +233,133 @@ private:
   };
 
   std::vector<std::shared_ptr<RootItem>> m_items;
+  // position of every item in `m_items`, by id
+  std::unordered_map<QString, size_t> m_itemIndex;
+  // merged and default filled preference values, by item id, see `getPreferenceValues`
+  mutable std::unordered_map<QString, QJsonObject> m_preferenceValues;
   std::unordered_map<QString, RootItemMetadata> m_metadata;
   std::unordered_map<QString, RootProviderMetadata> m_provider_metadata;
   std::vector<std::unique_ptr<RootProvider>> m_providers;
+  std::vector<std::unique_ptr<RootSearchSource>> m_searchSources;
+
+  struct QuerySelection {
+    QString itemId;
+    int count = 0;
+    std::chrono::sys_seconds lastSelectedAt;
+  };
+
+  // items launched from a search, by normalized query, as saved in the root_query_selection table
+  std::unordered_map<QString, std::vector<QuerySelection>> m_querySelections;
+  // ids of the items last loaded from every provider, by provider id
+  std::unordered_map<QString, std::vector<QString>> m_providerItems;
+  // shared with in-flight asynchronous searches, which work on a snapshot of it
+  std::shared_ptr<RootSearchIndex> m_searchIndex = std::make_shared<RootSearchIndex>();
+  // index positions of the entries that matched the last query
+  IncrementalSearchCache<uint32_t> m_searchCache;
+  std::chrono::steady_clock::time_point m_frecencyComputedAt;
+  // searches run one after the other, a search started while one is running cancels it
+  TaskQueue m_searchQueue{TaskScheduler::Priority::Interactive};
+  QFuture<std::vector<std::shared_ptr<RootItem>>> m_pendingSearch;
+  std::filesystem::path m_snapshotPath;
+  QTimer *m_snapshotTimer = new QTimer(this);
+
+  struct RankedItem {
+    std::shared_ptr<RootItem> item;
+    double score;
+  };
+
+  // what the root view shows when the search is empty, best first, kept up to date as items are visited
+  std::vector<RankedItem> m_favorites;
+  std::vector<RankedItem> m_suggestions;
+  // suggestions ranked, more than are shown for some of them to be removed without ranking again
+  size_t m_suggestionCapacity = 32;
+  // whether some items with visits were left out of the suggestions
+  bool m_suggestionsTruncated = false;
+  bool m_rankingDirty = true;
+  QTimer *m_rankingTimer = new QTimer(this);
   OmniDatabase &m_db;
 
   RootItemMetadata loadMetadata(const QString &id);
+  void loadQuerySelections();
+  void registerQuerySelection(const QString &query, const QString &id);
+  void forgetQuerySelections(const QString &id);
+
+  /**
+   * Position in the search index of the item `query` led to launching most, recent launches weighing more,
+   * which is ranked first when searching `query` again.
+   */
+  std::optional<uint32_t> learnedTopHit(const QString &query) const;
   bool upsertProvider(const RootProvider &provider);
-  bool upsertItem(const QString &providerId, const RootItem &item);
+
+  struct ItemRow {
+    RootItemMetadata metadata;
+    QString preferenceValues;
+  };
+
+  /**
+   * Saved rows of the items of the provider `providerId`, by item id.
+   */
+  std::unordered_map<QString, ItemRow> loadItemRows(const QString &providerId);
+
+  /**
+   * Save the items of the provider `providerId` that are not saved yet and load what is saved about all of
+   * them. Rows are read and inserted in bulk, callers wrap it in a transaction.
+   */
+  void upsertItems(const QString &providerId, const std::vector<std::shared_ptr<RootItem>> &items);
   RootItem *findItemById(const QString &id) const;
+  std::shared_ptr<RootItem> findSharedItemById(const QString &id) const;
+
+  /**
+   * Rebuild the id index of the items, which needs to be done every time items are removed.
+   * Cached preference values are dropped along with it, as the preferences of the items may have changed.
+   */
+  void indexItems();
+  // add items to `m_items`, keeping the id index up to date
+  void appendItems(const std::vector<std::shared_ptr<RootItem>> &items);
   RootProvider *findProviderById(const QString &id) const;
   bool pruneProvider(const QString &id);
 
+  /**
+   * Remove the items loaded from the provider `id`, leaving the items of the other providers alone.
+   */
+  void dropProviderItems(const QString &id);
+
+  /**
+   * Rebuild the precomputed search index from the current list of items.
+   * Needs to be called every time items are added, removed or renamed.
+   */
+  void rebuildSearchIndex();
+
+  /**
+   * The search index, for modification. If a snapshot of it is still being used by an
+   * asynchronous search, it is copied first.
+   */
+  RootSearchIndex &mutableSearchIndex();
+
+  /**
+   * Recompute the frecency score cached in the search index, for every item.
+   * As scores depend on the current time, this is also periodically done during search.
+   */
+  void refreshFrecencyScores();
+  void refreshFrecencyScore(const QString &id);
+
+  bool hasSnapshotItems() const;
+  void saveSnapshot();
+
+  /**
+   * Rank the enabled favorites by visit count, and the best `m_suggestionCapacity` visited items by score,
+   * from scratch. Scores decay with time, this is also done periodically.
+   */
+  void rankItems();
+
+  /**
+   * Move the item `id` to its place among the favorites and suggestions after its metadata changed,
+   * without ranking the other items again unless what it leaves room for is not known.
+   */
+  void rerankItem(const QString &id);
+
 public:
-  RootItemManager(OmniDatabase &db) : m_db(db) {}
+  RootItemManager(OmniDatabase &db);
 
   bool setProviderPreferenceValues(const QString &id, const QJsonObject &preferences);
 
@@ -248,7 +396,10 @@ public:
   std::vector<std::shared_ptr<RootItem>> queryFavorites(int limit = 5);
   std::vector<std::shared_ptr<RootItem>> querySuggestions(int limit = 5);
   bool resetRanking(const QString &id);
-  bool registerVisit(const QString &id);
+  /**
+   * Register the launch of the item `id`, from the search of `query` if it was launched from search results.
+   */
+  bool registerVisit(const QString &id, const QString &query = {});
   bool setItemAsFavorite(const QString &item, bool value = true);
   QString getItemProviderId(const QString &id);
   bool setProviderEnabled(const QString &providerId, bool value);
@@ -259,19 +410,85 @@ public:
   std::vector<RootProvider *> providers() const;
 
   void reloadProviders();
+
+  /**
+   * Load the items of the provider `id` again, leaving the items of the other providers alone. Only the
+   * items that were not there before are saved.
+   */
+  void reloadProvider(const QString &id);
+
+  /**
+   * Remove a provider and its items, without reloading the other providers.
+   */
   void removeProvider(const QString &id);
+
+  /**
+   * Add a provider and its items. A provider with the same id is replaced, keeping what is saved about it
+   * and its items.
+   */
   void addProvider(std::unique_ptr<RootProvider> provider);
+
+  /**
+   * Add several providers as `addProvider` does, loading them concurrently and rebuilding the search index
+   * once for all of them.
+   */
+  void addProviders(std::vector<std::unique_ptr<RootProvider>> providers);
   RootProvider *provider(const QString &id) const;
+
+  /**
+   * Add a source of results searched along with the root items, see `FederatedRootSearch`. Sources are
+   * shown in the order they are added.
+   */
+  void addSearchSource(std::unique_ptr<RootSearchSource> source);
+  std::vector<RootSearchSource *> searchSources() const;
+
   std::vector<std::shared_ptr<RootItem>> allItems() const { return m_items; }
+  size_t itemCount() const { return m_items.size(); }
+
+  /**
+   * Show the items saved at `path` until the providers they come from are added, and save the items
+   * there once every provider is done loading them.
+   */
+  void loadSnapshot(const std::filesystem::path &path);
+
+  /**
+   * Drop the snapshot items left, to be called once every provider was added.
+   */
+  void dropSnapshotItems();
+
+  /**
+   * The item a snapshot item stands for, every provider being required first if some are not added yet.
+   */
+  std::shared_ptr<RootItem> resolveSnapshotItem(const QString &id);
   std::vector<std::shared_ptr<RootItem>> fallbackItems() const;
   std::vector<std::shared_ptr<RootItem>> prefixSearch(const QString &query,
                                                       const RootItemPrefixSearchOptions &opts = {});
 
+  /**
+   * Same as `prefixSearch`, but scoring is performed on a worker thread against an immutable
+   * snapshot of the search index.
+   * Starting a new search cancels the previous one if it is still running, in which case
+   * its future is canceled and never gets a result.
+   */
+  QFuture<std::vector<std::shared_ptr<RootItem>>>
+  prefixSearchAsync(const QString &query, const RootItemPrefixSearchOptions &opts = {});
+
 signals:
   void itemsChanged() const;
+
+  /**
+   * Emitted when a single provider was reloaded, right before `itemsChanged`.
+   */
+  void providerItemsChanged(const RootItemChanges &changes) const;
   void itemRankingReset(const QString &id) const;
+  void itemVisited(const QString &id) const;
   void itemFavoriteChanged(const QString &id, bool favorite);
   void fallbackEnabled(const QString &id) const;
   void fallbackOrderChanged(const QString &id) const;
   void fallbackDisabled(const QString &id) const;
+
+  /**
+   * Emitted when a snapshot item is acted on before every provider is added, for them to be added now.
+   */
+  void providersRequired() const;
 };
@@ -0,0 +1,111 @@
+#include "services/root-item-manager/root-item-snapshot.hpp"
+#include <QDataStream>
+#include <QSaveFile>
+#include <qfile.h>
+#include <qlogging.h>
+
+static constexpr quint32 SNAPSHOT_MAGIC = 0x56525354; // VRST
+static constexpr quint32 SNAPSHOT_VERSION = 1;
+
+static QDataStream &operator<<(QDataStream &stream, const RootItemSnapshot::Item &item) {
+  stream << item.owner << item.providerId << item.id << item.name << item.subtitle << item.typeName
+         << item.icon << static_cast<quint32>(item.keywords.size());
+
+  for (const auto &keyword : item.keywords) {
+    stream << keyword;
+  }
+
+  return stream << item.weight << item.fallback;
+}
+
+static QDataStream &operator>>(QDataStream &stream, RootItemSnapshot::Item &item) {
+  quint32 keywordCount = 0;
+
+  stream >> item.owner >> item.providerId >> item.id >> item.name >> item.subtitle >> item.typeName >>
+      item.icon >> keywordCount;
+
+  // a corrupted count should not have us reserve gigabytes
+  for (quint32 i = 0; i != keywordCount && stream.status() == QDataStream::Ok; ++i) {
+    stream >> item.keywords.emplace_back();
+  }
+
+  return stream >> item.weight >> item.fallback;
+}
+
+std::vector<RootItemSnapshot::Item> RootItemSnapshot::load(const std::filesystem::path &path) {
+  QFile file(path);
+
+  if (!file.open(QIODevice::ReadOnly)) return {};
+
+  auto data = file.map(0, file.size());
+
+  if (!data) {
+    qWarning() << "Failed to map root item snapshot" << file.errorString();
+    return {};
+  }
+
+  // the mapping is read in place, strings being the only copies made
+  auto bytes = QByteArray::fromRawData(reinterpret_cast<const char *>(data), file.size());
+  QDataStream stream(bytes);
+  quint32 magic = 0;
+  quint32 version = 0;
+  quint32 count = 0;
+  std::vector<Item> items;
+
+  stream.setVersion(QDataStream::Qt_6_0);
+  stream >> magic >> version >> count;
+
+  if (magic != SNAPSHOT_MAGIC || version != SNAPSHOT_VERSION) return {};
+
+  for (quint32 i = 0; i != count && stream.status() == QDataStream::Ok; ++i) {
+    stream >> items.emplace_back();
+  }
+
+  if (stream.status() != QDataStream::Ok) {
+    qWarning() << "Ignoring corrupted root item snapshot" << path.c_str();
+    return {};
+  }
+
+  return items;
+}
+
+bool RootItemSnapshot::save(const std::filesystem::path &path, const std::vector<Item> &items) {
+  QSaveFile file(path);
+
+  if (!file.open(QIODevice::WriteOnly)) {
+    qWarning() << "Failed to open root item snapshot for writing" << file.errorString();
+    return false;
+  }
+
+  QDataStream stream(&file);
+
+  stream.setVersion(QDataStream::Qt_6_0);
+  stream << SNAPSHOT_MAGIC << SNAPSHOT_VERSION << static_cast<quint32>(items.size());
+
+  for (const auto &item : items) {
+    stream << item;
+  }
+
+  if (!file.commit()) {
+    qWarning() << "Failed to write root item snapshot" << file.errorString();
+    return false;
+  }
+
+  return true;
+}
+
+std::unique_ptr<ActionPanelState> SnapshotRootItem::newActionPanel(ApplicationContext *ctx,
+                                                                   const RootItemMetadata &metadata) {
+  if (auto item = m_manager.resolveSnapshotItem(uniqueId())) { return item->newActionPanel(ctx, metadata); }
+
+  return {};
+}
+
+std::unique_ptr<ActionPanelState> SnapshotRootItem::fallbackActionPanel(ApplicationContext *ctx,
+                                                                        const RootItemMetadata &metadata) {
+  if (auto item = m_manager.resolveSnapshotItem(uniqueId())) {
+    return item->fallbackActionPanel(ctx, metadata);
+  }
+
+  return {};
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "services/root-item-manager/root-item-manager.hpp"
+#include <filesystem>
+
+/**
+ * Compact binary copy of the root items, written once their providers are done loading them and read
+ * back at startup so that root search shows every item before the providers have loaded theirs.
+ *
+ * Only what is needed to index and show an item in the root list is kept. Its icon is kept as an
+ * ImageURL string.
+ */
+class RootItemSnapshot {
+public:
+  struct Item {
+    // the RootProvider the item came from, which is not RootItem::providerId()
+    QString owner;
+    QString providerId;
+    QString id;
+    QString name;
+    QString subtitle;
+    QString typeName;
+    QString icon;
+    std::vector<QString> keywords;
+    double weight = 1;
+    bool fallback = false;
+  };
+
+  static std::vector<Item> load(const std::filesystem::path &path);
+  static bool save(const std::filesystem::path &path, const std::vector<Item> &items);
+};
+
+/**
+ * Stands for an item of the snapshot until its provider is loaded. Acting on it has the root item
+ * manager load every provider right away, to act on the item it stands for.
+ */
+class SnapshotRootItem : public RootItem {
+  RootItemSnapshot::Item m_item;
+  RootItemManager &m_manager;
+
+public:
+  const QString &owner() const { return m_item.owner; }
+
+  QString providerId() const override { return m_item.providerId; }
+  QString uniqueId() const override { return m_item.id; }
+  QString displayName() const override { return m_item.name; }
+  QString subtitle() const override { return m_item.subtitle; }
+  QString typeDisplayName() const override { return m_item.typeName; }
+  ImageURL iconUrl() const override { return ImageURL(m_item.icon); }
+  std::vector<QString> keywords() const override { return m_item.keywords; }
+  double baseScoreWeight() const override { return m_item.weight; }
+  bool isSuitableForFallback() const override { return m_item.fallback; }
+
+  std::unique_ptr<ActionPanelState> newActionPanel(ApplicationContext *ctx,
+                                                   const RootItemMetadata &metadata) override;
+  std::unique_ptr<ActionPanelState> fallbackActionPanel(ApplicationContext *ctx,
+                                                        const RootItemMetadata &metadata) override;
+
+  SnapshotRootItem(const RootItemSnapshot::Item &item, RootItemManager &manager)
+      : m_item(item), m_manager(manager) {}
+};
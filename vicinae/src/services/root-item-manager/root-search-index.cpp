@@ -0,0 +1,110 @@
+#include "root-search-index.hpp"
+#include "services/root-item-manager/root-item-manager.hpp"
+
+RootSearchIndex::Field RootSearchIndex::appendField(const QString &str) {
+  Field field;
+  uint32_t base = m_text.size();
+
+  field.wordOffset = m_words.size();
+  TextTokenizer::tokenize(str, m_text, m_words);
+  field.text = {.offset = base, .length = static_cast<uint32_t>(m_text.size() - base)};
+  field.wordCount = m_words.size() - field.wordOffset;
+
+  return field;
+}
+
+RootSearchIndex::Span RootSearchIndex::appendUtf8(QStringView str) {
+  QByteArray data = str.toUtf8();
+  Span span{.offset = static_cast<uint32_t>(m_utf8.size()), .length = static_cast<uint32_t>(data.size())};
+
+  m_utf8.append(data.constData(), data.size());
+
+  return span;
+}
+
+size_t RootSearchIndex::memUsage() const {
+  // a node per position, holding its key, its value and a link to the next node of its bucket
+  size_t positions = m_positions.size() * (sizeof(QString) + sizeof(uint32_t) + sizeof(void *)) +
+                     m_positions.bucket_count() * sizeof(void *);
+  size_t ids = 0;
+
+  for (const auto &entry : m_entries) {
+    ids += entry.id.capacity() * sizeof(QChar);
+  }
+
+  return m_entries.capacity() * sizeof(Entry) + ids + positions + m_keywords.capacity() * sizeof(Field) +
+         m_words.capacity() * sizeof(Span) + m_text.capacity() * sizeof(QChar) + m_utf8.capacity() +
+         m_typos.memUsage();
+}
+
+void RootSearchIndex::clear() {
+  m_entries.clear();
+  m_positions.clear();
+  m_keywords.clear();
+  m_words.clear();
+  m_text.clear();
+  m_utf8.clear();
+  m_typos.clear();
+}
+
+void RootSearchIndex::rebuild(const std::vector<std::shared_ptr<RootItem>> &items,
+                              const std::unordered_map<QString, RootItemMetadata> &metadata) {
+  clear();
+  m_entries.reserve(items.size());
+  m_positions.reserve(items.size());
+  // rough estimate, avoids most of the reallocations for typical item names
+  m_text.reserve(items.size() * 48);
+  m_words.reserve(items.size() * 4);
+
+  for (const auto &item : items) {
+    Entry entry;
+    QString alias;
+
+    entry.item = item;
+    entry.id = item->uniqueId();
+
+    if (auto it = metadata.find(entry.id); it != metadata.end()) {
+      alias = it->second.alias;
+      entry.enabled = it->second.isEnabled;
+    }
+
+    QString name = item->displayName();
+
+    entry.name = appendField(name);
+    entry.alias = appendField(alias);
+    entry.subtitle = appendField(item->subtitle());
+    entry.utf8Name = appendUtf8(text(entry.name.text));
+
+    for (const auto &word : words(entry.name)) {
+      m_typos.add(m_entries.size(), text(word));
+    }
+
+    entry.keywordOffset = m_keywords.size();
+
+    for (const auto &keyword : item->keywords()) {
+      m_keywords.emplace_back(appendField(keyword));
+    }
+
+    entry.keywordCount = m_keywords.size() - entry.keywordOffset;
+    m_positions[entry.id] = m_entries.size();
+    m_entries.emplace_back(std::move(entry));
+  }
+
+  m_typos.build();
+}
+
+RootSearchIndex::Entry *RootSearchIndex::find(const QString &id) {
+  if (auto it = m_positions.find(id); it != m_positions.end()) { return &m_entries[it->second]; }
+
+  return nullptr;
+}
+
+std::optional<uint32_t> RootSearchIndex::position(const QString &id) const {
+  if (auto it = m_positions.find(id); it != m_positions.end()) { return it->second; }
+
+  return std::nullopt;
+}
+
+void RootSearchIndex::setEnabled(const QString &id, bool value) {
+  if (auto entry = find(id)) { entry->enabled = value; }
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include "lib/text-tokenizer.hpp"
+#include "lib/typo-index.hpp"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <qstring.h>
+#include <qstringview.h>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class RootItem;
+struct RootItemMetadata;
+
+/**
+ * Precomputed, flat representation of all the root items that is used to answer search queries.
+ *
+ * Every searchable string (name, alias, subtitle and keywords) is normalized and split into words
+ * by the shared `TextTokenizer` once, when the index is built. All the text is stored inside a single buffer that entries only
+ * reference by offset, so that scoring a query walks contiguous memory and never allocates per item.
+ *
+ * The words of the names are also indexed for typos, so that only the entries they could be a typo of go
+ * through the fuzzy matcher.
+ *
+ * The index is rebuilt by the root item manager every time the set of items changes.
+ */
+class RootSearchIndex {
+public:
+  using Span = TextSpan;
+
+  struct Field {
+    Span text;
+    uint32_t wordOffset = 0;
+    uint32_t wordCount = 0;
+  };
+
+  struct Entry {
+    std::shared_ptr<RootItem> item;
+    QString id;
+    Field name;
+    Field alias;
+    Field subtitle;
+    uint32_t keywordOffset = 0;
+    uint32_t keywordCount = 0;
+    // normalized UTF-8 name, fed as is to the fuzzy matcher
+    Span utf8Name;
+    bool enabled = true;
+    // cached frecency score, maintained by the root item manager
+    double frecency = 0;
+  };
+
+  void rebuild(const std::vector<std::shared_ptr<RootItem>> &items,
+               const std::unordered_map<QString, RootItemMetadata> &metadata);
+  void clear();
+
+  /**
+   * Update the enabled state of a single entry, without requiring a full rebuild.
+   */
+  void setEnabled(const QString &id, bool value);
+
+  Entry *find(const QString &id);
+  std::optional<uint32_t> position(const QString &id) const;
+
+  const std::vector<Entry> &entries() const { return m_entries; }
+  std::vector<Entry> &entries() { return m_entries; }
+  size_t size() const { return m_entries.size(); }
+
+  /**
+   * Approximate heap memory used by the index, in bytes. The items themselves are not part of it.
+   */
+  size_t memUsage() const;
+
+  QStringView text(const Span &span) const { return QStringView(m_text).mid(span.offset, span.length); }
+  std::string_view utf8(const Span &span) const {
+    return std::string_view(m_utf8).substr(span.offset, span.length);
+  }
+  std::span<const Span> words(const Field &field) const {
+    return std::span(m_words).subspan(field.wordOffset, field.wordCount);
+  }
+  std::span<const Field> keywords(const Entry &entry) const {
+    return std::span(m_keywords).subspan(entry.keywordOffset, entry.keywordCount);
+  }
+
+  /**
+   * Documents are positions of entries.
+   */
+  const TypoIndex &typos() const { return m_typos; }
+
+private:
+  std::vector<Entry> m_entries;
+  std::unordered_map<QString, uint32_t> m_positions;
+  std::vector<Field> m_keywords;
+  std::vector<Span> m_words;
+  QString m_text;
+  std::string m_utf8;
+  TypoIndex m_typos;
+
+  Field appendField(const QString &str);
+  Span appendUtf8(QStringView str);
+};
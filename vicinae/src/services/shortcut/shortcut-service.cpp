@@ -1,6 +1,7 @@
 #include "services/shortcut/shortcut-service.hpp"
 #include "shortcut-service.hpp"
 #include "crypto.hpp"
+#include "sql-profiler/sql-profiler.hpp"
 #include <qlogging.h>
 
 std::vector<std::shared_ptr<Shortcut>> ShortcutService::loadAll() {
@@ -12,7 +13,7 @@ std::vector<std::shared_ptr<Shortcut>> ShortcutService::loadAll() {
 		FROM shortcut
 	)");
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to execute loadAll query: " << query.lastError();
     return {};
   }
@@ -49,22 +50,6 @@ Shortcut *ShortcutService::findById(const QString &id) {
 }
 
 bool ShortcutService::registerVisit(const QString &id) {
-  QSqlQuery query = m_db.createQuery();
-
-  query.prepare("UPDATE shortcut SET last_used_at = unixepoch(), open_count = open_count + 1 WHERE id = :id "
-                "RETURNING last_used_at, open_count");
-  query.bindValue(":id", id);
-
-  if (!query.exec()) {
-    qWarning() << "Failed to register shortcut visit" << query.lastError();
-    return false;
-  }
-
-  if (!query.next()) {
-    qWarning() << "No shortcut" << id << "to update";
-    return false;
-  }
-
   auto shortcut = findById(id);
 
   if (!shortcut) {
@@ -72,11 +57,12 @@ bool ShortcutService::registerVisit(const QString &id) {
     return false;
   }
 
-  auto lastOpenedAtEpoch = query.value(0).toULongLong();
-  int count = query.value(1).toInt();
+  // shortcuts are listed from memory, the database only needs to catch up eventually
+  m_db.deferWrite("UPDATE shortcut SET last_used_at = unixepoch(), open_count = open_count + 1 WHERE id = ?",
+                  {id});
 
-  shortcut->setLastOpenedAt(QDateTime::fromSecsSinceEpoch(lastOpenedAtEpoch));
-  shortcut->setOpenCount(count);
+  shortcut->setLastOpenedAt(QDateTime::fromSecsSinceEpoch(QDateTime::currentSecsSinceEpoch()));
+  shortcut->setOpenCount(shortcut->openCount() + 1);
   emit shortcutVisited(id);
 
   return true;
@@ -107,7 +93,7 @@ bool ShortcutService::updateShortcut(const QString &id, const QString &name, con
   query.addBindValue(app);
   query.bindValue(":id", id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to update shortcut" << query.lastError();
     return false;
   }
@@ -127,7 +113,7 @@ bool ShortcutService::removeShortcut(const QString &id) {
   query.prepare("DELETE FROM shortcut WHERE id = :id");
   query.bindValue(":id", id);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qCritical() << "Failed to remove shortcut" << query.lastError();
     return false;
   }
@@ -157,7 +143,7 @@ bool ShortcutService::createShortcut(const QString &name, const QString &icon, c
   query.bindValue(":url", url);
   query.bindValue(":app", app);
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     qWarning() << "Failed to save shortcut" << query.lastError();
     return false;
   }
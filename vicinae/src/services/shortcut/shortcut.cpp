@@ -1,4 +1,8 @@
 #include "services/shortcut/shortcut.hpp"
+#include <QApplication>
+#include <qclipboard.h>
+#include <qurl.h>
+#include <quuid.h>
 
 void Shortcut::insertPlaceholder(const ParsedPlaceholder &placeholder) {
   bool isReserved =
@@ -18,12 +22,78 @@ void Shortcut::insertPlaceholder(const ParsedPlaceholder &placeholder) {
   }
 
   m_placeholders.emplace_back(placeholder);
+  m_parts.emplace_back(placeholder);
+}
+
+void Shortcut::insertLiteral(const QString &literal) {
+  m_literalLength += literal.size();
+  m_parts.emplace_back(literal);
+}
+
+QString Shortcut::applyModifiers(QString value, const std::vector<QString> &modifiers) {
+  for (const auto &modifier : modifiers) {
+    if (modifier == "percent-encode") {
+      value = QString::fromUtf8(QUrl::toPercentEncoding(value));
+    } else if (modifier == "uppercase") {
+      value = value.toUpper();
+    } else if (modifier == "lowercase") {
+      value = value.toLower();
+    } else if (modifier == "trim") {
+      value = value.trimmed();
+    } else if (modifier != "raw") {
+      qWarning() << "Unknown placeholder modifier" << modifier;
+    }
+  }
+
+  return value;
+}
+
+QString Shortcut::expand(const std::vector<QString> &arguments) const {
+  QString expanded;
+  size_t argumentIndex = 0;
+  qsizetype argumentLength = 0;
+
+  for (const auto &argument : arguments) {
+    argumentLength += argument.size();
+  }
+
+  expanded.reserve(m_literalLength + argumentLength);
+
+  for (const auto &part : m_parts) {
+    if (auto s = std::get_if<QString>(&part)) {
+      expanded += *s;
+      continue;
+    }
+
+    auto &placeholder = std::get<ParsedPlaceholder>(part);
+    QString value;
+
+    if (placeholder.id == "clipboard") {
+      value = QApplication::clipboard()->text();
+    } else if (placeholder.id == "selected") {
+      // TODO: selected text
+    } else if (placeholder.id == "uuid") {
+      value = QUuid::createUuid().toString(QUuid::StringFormat::WithoutBraces);
+    } else if (placeholder.id != "date") {
+      if (argumentIndex < arguments.size()) { value = arguments.at(argumentIndex); }
+      if (value.isEmpty()) {
+        if (auto it = placeholder.args.find("default"); it != placeholder.args.end()) { value = it->second; }
+      }
+      ++argumentIndex;
+    }
+
+    if (!placeholder.modifiers.empty()) { value = applyModifiers(std::move(value), placeholder.modifiers); }
+
+    expanded += value;
+  }
+
+  return expanded;
 }
 
 QString Shortcut::app() const { return m_app; }
 QString Shortcut::name() const { return m_name; }
 QString Shortcut::icon() const { return m_icon; }
-std::vector<Shortcut::UrlPart> Shortcut::parts() const { return m_parts; }
+const std::vector<Shortcut::UrlPart> &Shortcut::parts() const { return m_parts; }
 const std::vector<Shortcut::ParsedPlaceholder> &Shortcut::placeholders() const { return m_placeholders; }
 const std::vector<Shortcut::Argument> &Shortcut::arguments() const { return m_args; }
 
@@ -53,7 +123,9 @@ void Shortcut::parseLink(const QString &link) {
     PH_KEY,
     PH_VALUE_START,
     PH_VALUE,
-    PH_VALUE_QUOTED
+    PH_VALUE_QUOTED,
+    PH_MODIFIER_START,
+    PH_MODIFIER
   } state = BK_NORMAL;
   size_t i = 0;
   size_t startPos = 0;
@@ -61,6 +133,7 @@ void Shortcut::parseLink(const QString &link) {
   std::pair<QString, QString> arg;
 
   m_parts.clear();
+  m_literalLength = 0;
   m_placeholders.clear();
   m_args.clear();
   m_raw = link;
@@ -71,7 +144,7 @@ void Shortcut::parseLink(const QString &link) {
     switch (state) {
     case BK_NORMAL:
       if (ch == '{') {
-        m_parts.emplace_back(link.sliced(startPos, i - startPos));
+        insertLiteral(link.sliced(startPos, i - startPos));
         state = PH_ID;
         startPos = i + 1;
       }
@@ -85,12 +158,16 @@ void Shortcut::parseLink(const QString &link) {
       break;
     case PH_KEY_START:
       if (ch == '}') {
-        m_parts.emplace_back(parsed);
         insertPlaceholder(parsed);
+        parsed = {};
         startPos = i + 1;
         state = BK_NORMAL;
         break;
       }
+      if (ch == '|') {
+        state = PH_MODIFIER_START;
+        break;
+      }
       if (!ch.isSpace()) {
         startPos = i--;
         arg.first.clear();
@@ -132,10 +209,24 @@ void Shortcut::parseLink(const QString &link) {
         startPos = i + 1;
         state = PH_VALUE;
       }
+      break;
+    case PH_MODIFIER_START:
+      if (!ch.isSpace()) {
+        startPos = i--;
+        state = PH_MODIFIER;
+      }
+      break;
+    case PH_MODIFIER:
+      if (!ch.isLetterOrNumber() && ch != '-') {
+        parsed.modifiers.emplace_back(link.sliced(startPos, i - startPos));
+        --i;
+        state = PH_KEY_START;
+      }
+      break;
     }
 
     ++i;
   }
 
-  if (state == BK_NORMAL && i - startPos > 0) { m_parts.emplace_back(link.sliced(startPos, i - startPos)); }
+  if (state == BK_NORMAL && i - startPos > 0) { insertLiteral(link.sliced(startPos, i - startPos)); }
 }
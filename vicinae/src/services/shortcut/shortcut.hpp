@@ -18,9 +18,14 @@ class Shortcut {
   const std::vector<QString> m_reservedPlaceholderIds = {"clipboard", "selected", "uuid", "date"};
 
 public:
+  /**
+   * A `{id key="value" | modifier}` placeholder. Modifiers are applied in order to the expanded value, the
+   * supported ones are `percent-encode`, `uppercase`, `lowercase`, `trim` and `raw`.
+   */
   struct ParsedPlaceholder {
     QString id;
     std::map<QString, QString> args;
+    std::vector<QString> modifiers;
   };
 
   using UrlPart = std::variant<QString, ParsedPlaceholder>;
@@ -34,6 +39,8 @@ private:
   std::vector<ParsedPlaceholder> m_placeholders;
   std::vector<Argument> m_args;
   std::vector<UrlPart> m_parts;
+  // total length of the literal parts, to size the expanded link upfront
+  qsizetype m_literalLength = 0;
   QString m_raw;
   QString m_id;
   QString m_name;
@@ -45,6 +52,8 @@ private:
   int m_openCount = 0;
 
   void insertPlaceholder(const ParsedPlaceholder &placeholder);
+  void insertLiteral(const QString &literal);
+  static QString applyModifiers(QString value, const std::vector<QString> &modifiers);
 
 public:
   const std::vector<ParsedPlaceholder> &placeholders() const;
@@ -64,7 +73,14 @@ public:
   QDateTime updatedAt();
   std::optional<QDateTime> lastOpenedAt();
 
-  std::vector<UrlPart> parts() const;
+  const std::vector<UrlPart> &parts() const;
+
+  /**
+   * The link with its placeholders expanded, argument placeholders taking `arguments` in order.
+   *
+   * The link is only parsed once (see `parseLink`), expanding it for every keystroke is cheap.
+   */
+  QString expand(const std::vector<QString> &arguments) const;
 
   void setApp(const QString &app);
   void setName(const QString &name);
@@ -61,7 +61,23 @@ public:
    * Close a window. Returns true if successful, false otherwise.
    * This is a common operation that should be supported by all window managers.
    */
-  virtual bool closeWindow(const AbstractWindow &window) const { return false; }
+  virtual bool closeWindowSync(const AbstractWindow &window) const { return false; }
+
+  /**
+   * Asynchronous variants of the methods above, to be preferred from the GUI thread: window managers that
+   * have to wait on another process should reimplement them so that the launcher does not freeze while
+   * that process is busy.
+   * The default implementations call the synchronous methods and return a finished future.
+   */
+  virtual QFuture<WindowList> listWindows() const { return readyFuture(listWindowsSync()); }
+  virtual QFuture<WindowPtr> getFocusedWindow() const { return readyFuture(getFocusedWindowSync()); }
+  virtual QFuture<void> focusWindow(const AbstractWindow &window) const {
+    focusWindowSync(window);
+    return readyFuture();
+  }
+  virtual QFuture<bool> closeWindow(const AbstractWindow &window) const {
+    return readyFuture(closeWindowSync(window));
+  }
 
   /**
    * Whether the window manager supports sending arbitrary key events to any given window.
@@ -112,6 +128,26 @@ public:
    */
   virtual void start() const = 0;
 
+protected:
+  template <typename T> static QFuture<T> readyFuture(T value) {
+    QPromise<T> promise;
+
+    promise.start();
+    promise.addResult(std::move(value));
+    promise.finish();
+
+    return promise.future();
+  }
+
+  static QFuture<void> readyFuture() {
+    QPromise<void> promise;
+
+    promise.start();
+    promise.finish();
+
+    return promise.future();
+  }
+
 private:
   Q_OBJECT
 
@@ -1,6 +1,7 @@
 #include "gnome-window-manager.hpp"
 #include "utils/environment.hpp"
 #include <QDBusConnection>
+#include <QDBusPendingReply>
 #include <QDBusReply>
 #include <QJsonDocument>
 #include <QJsonValue>
@@ -64,6 +65,103 @@ bool GnomeWindowManager::callDBusMethodVoid(const QString &method, const QVarian
   return true;
 }
 
+QDBusPendingCallWatcher *GnomeWindowManager::asyncCall(const QString &method,
+                                                       const QVariantList &args) const {
+  auto *interface = getDBusInterface();
+  if (!interface || !interface->isValid()) {
+    qWarning() << "GnomeWindowManager: D-Bus interface not available for method:" << method;
+    return nullptr;
+  }
+
+  auto watcher = new QDBusPendingCallWatcher(interface->asyncCallWithArgumentList(method, args));
+
+  connect(watcher, &QDBusPendingCallWatcher::finished, watcher, &QObject::deleteLater);
+
+  return watcher;
+}
+
+QFuture<AbstractWindowManager::WindowList> GnomeWindowManager::listWindows() const {
+  auto promise = std::make_shared<QPromise<WindowList>>();
+  auto watcher = asyncCall("List");
+
+  promise->start();
+
+  if (!watcher) {
+    promise->addResult(WindowList{});
+    promise->finish();
+    return promise->future();
+  }
+
+  connect(watcher, &QDBusPendingCallWatcher::finished, this, [this, promise](QDBusPendingCallWatcher *call) {
+    QDBusPendingReply<QString> reply = *call;
+
+    if (reply.isError()) {
+      qWarning() << "GnomeWindowManager: D-Bus call failed for method: List"
+                 << "Error:" << reply.error().message();
+    }
+
+    promise->addResult(reply.isError() ? WindowList{} : parseWindowList(reply.value()));
+    promise->finish();
+  });
+
+  return promise->future();
+}
+
+QFuture<AbstractWindowManager::WindowPtr> GnomeWindowManager::getFocusedWindow() const {
+  return listWindows().then([](const WindowList &windows) { return findFocusedWindow(windows); });
+}
+
+QFuture<void> GnomeWindowManager::focusWindow(const AbstractWindow &window) const {
+  const GnomeWindow *gnomeWindow = dynamic_cast<const GnomeWindow *>(&window);
+
+  if (!gnomeWindow || gnomeWindow->numericId() == 0) {
+    qWarning() << "GnomeWindowManager: Invalid window to focus:" << window.title();
+    return readyFuture();
+  }
+
+  uint32_t windowId = gnomeWindow->numericId();
+  auto watcher = asyncCall("Activate", {windowId});
+
+  if (!watcher) return readyFuture();
+
+  auto promise = std::make_shared<QPromise<void>>();
+
+  promise->start();
+  connect(watcher, &QDBusPendingCallWatcher::finished, this,
+          [windowId, promise](QDBusPendingCallWatcher *call) {
+            if (call->isError()) {
+              qWarning() << "GnomeWindowManager: Failed to activate window ID:" << windowId
+                         << call->error().message();
+            }
+
+            promise->finish();
+          });
+
+  return promise->future();
+}
+
+QFuture<bool> GnomeWindowManager::closeWindow(const AbstractWindow &window) const {
+  const GnomeWindow *gnomeWindow = dynamic_cast<const GnomeWindow *>(&window);
+  auto watcher = gnomeWindow ? asyncCall("Close", {gnomeWindow->numericId()}) : nullptr;
+
+  if (!watcher) return readyFuture(false);
+
+  auto promise = std::make_shared<QPromise<bool>>();
+
+  promise->start();
+  connect(watcher, &QDBusPendingCallWatcher::finished, this, [this, promise](QDBusPendingCallWatcher *call) {
+    bool success = !call->isError();
+
+    if (!success) { qWarning() << "GnomeWindowManager: Failed to close window" << call->error().message(); }
+    if (success) { emit windowsChanged(); }
+
+    promise->addResult(success);
+    promise->finish();
+  });
+
+  return promise->future();
+}
+
 QJsonObject GnomeWindowManager::parseJsonResponse(const QString &response) const {
   if (response.isEmpty()) {
     qWarning() << "GnomeWindowManager: Empty response received";
@@ -100,10 +198,7 @@ QJsonArray GnomeWindowManager::parseJsonArrayResponse(const QString &response) c
   return doc.array();
 }
 
-AbstractWindowManager::WindowList GnomeWindowManager::listWindowsSync() const {
-  qDebug() << "GnomeWindowManager: Listing windows";
-
-  QString response = callDBusMethod("List");
+AbstractWindowManager::WindowList GnomeWindowManager::parseWindowList(const QString &response) const {
   if (response.isEmpty()) {
     qWarning() << "GnomeWindowManager: No response from List method";
     return {};
@@ -133,12 +228,7 @@ AbstractWindowManager::WindowList GnomeWindowManager::listWindowsSync() const {
   return windows;
 }
 
-std::shared_ptr<AbstractWindowManager::AbstractWindow> GnomeWindowManager::getFocusedWindowSync() const {
-  qDebug() << "GnomeWindowManager: Getting focused window";
-
-  // Get all windows and find the focused one
-  auto windows = listWindowsSync();
-
+AbstractWindowManager::WindowPtr GnomeWindowManager::findFocusedWindow(const WindowList &windows) {
   for (const auto &window : windows) {
     // Cast to GnomeWindow to access GNOME-specific properties
     if (auto gnomeWindow = std::dynamic_pointer_cast<GnomeWindow>(window)) {
@@ -153,6 +243,19 @@ std::shared_ptr<AbstractWindowManager::AbstractWindow> GnomeWindowManager::getFo
   return nullptr;
 }
 
+AbstractWindowManager::WindowList GnomeWindowManager::listWindowsSync() const {
+  qDebug() << "GnomeWindowManager: Listing windows";
+
+  return parseWindowList(callDBusMethod("List"));
+}
+
+std::shared_ptr<AbstractWindowManager::AbstractWindow> GnomeWindowManager::getFocusedWindowSync() const {
+  qDebug() << "GnomeWindowManager: Getting focused window";
+
+  // Get all windows and find the focused one
+  return findFocusedWindow(listWindowsSync());
+}
+
 void GnomeWindowManager::focusWindowSync(const AbstractWindow &window) const {
   qDebug() << "GnomeWindowManager: Focusing window:" << window.title();
 
@@ -218,7 +321,7 @@ void GnomeWindowManager::start() const {
   // No special startup required for GNOME integration
 }
 
-bool GnomeWindowManager::closeWindow(const AbstractWindow &window) const {
+bool GnomeWindowManager::closeWindowSync(const AbstractWindow &window) const {
   const GnomeWindow *gnomeWindow = dynamic_cast<const GnomeWindow *>(&window);
   if (!gnomeWindow) return false;
 
@@ -2,6 +2,7 @@
 #include "services/window-manager/abstract-window-manager.hpp"
 #include "gnome-window.hpp"
 #include <QDBusInterface>
+#include <QDBusPendingCallWatcher>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <memory>
@@ -33,6 +34,15 @@ private:
    */
   bool callDBusMethodVoid(const QString &method, const QVariantList &args = {}) const;
 
+  /**
+   * Start a D-Bus method call, without waiting for its reply. Returns nullptr if the interface is not
+   * available. The watcher deletes itself once the reply was handled.
+   */
+  QDBusPendingCallWatcher *asyncCall(const QString &method, const QVariantList &args = {}) const;
+
+  WindowList parseWindowList(const QString &response) const;
+  static WindowPtr findFocusedWindow(const WindowList &windows);
+
   /**
    * Parse JSON string response from D-Bus
    */
@@ -50,7 +60,12 @@ public:
   WindowList listWindowsSync() const override;
   std::shared_ptr<AbstractWindow> getFocusedWindowSync() const override;
   void focusWindowSync(const AbstractWindow &window) const override;
-  bool closeWindow(const AbstractWindow &window) const override;
+  bool closeWindowSync(const AbstractWindow &window) const override;
+
+  QFuture<WindowList> listWindows() const override;
+  QFuture<WindowPtr> getFocusedWindow() const override;
+  QFuture<void> focusWindow(const AbstractWindow &window) const override;
+  QFuture<bool> closeWindow(const AbstractWindow &window) const override;
 
   bool isActivatable() const override;
   bool ping() const override;
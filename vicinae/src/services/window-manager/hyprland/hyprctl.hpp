@@ -18,6 +18,7 @@
 #include <qdebug.h>
 #include <unistd.h>
 #include <expected>
+#include <optional>
 
 class Hyprctl : public QObject {
 public:
@@ -26,17 +27,32 @@ public:
   Hyprctl() { QLocalSocket client; }
   ~Hyprctl() {}
 
-  QByteArray start(const std::string &command) {
-    char _buf[1 << 8];
+  /**
+   * Path to the socket `name` of the running Hyprland instance, such as `.socket.sock` for commands or
+   * `.socket2.sock` for events.
+   */
+  static std::optional<std::filesystem::path> socketPath(std::string_view name) {
     auto his = getenv("HYPRLAND_INSTANCE_SIGNATURE");
 
-    if (!his) { qWarning() << "Hyprctl::execute() failed: HYPRLAND_INSTANCE_SIGNATURE is not set"; }
+    if (!his) {
+      qWarning() << "Hyprctl: HYPRLAND_INSTANCE_SIGNATURE is not set";
+      return std::nullopt;
+    }
 
     std::filesystem::path rundir = "/tmp";
 
     if (auto p = getenv("XDG_RUNTIME_DIR")) rundir = p;
 
-    std::filesystem::path sockPath = rundir / "hypr" / his / ".socket.sock";
+    return rundir / "hypr" / his / name;
+  }
+
+  QByteArray start(const std::string &command) {
+    char _buf[1 << 12];
+    auto path = socketPath(".socket.sock");
+
+    if (!path) { return {}; }
+
+    std::filesystem::path sockPath = *path;
     int sock = socket(AF_UNIX, SOCK_STREAM, 0);
 
     if (sock < 0) {
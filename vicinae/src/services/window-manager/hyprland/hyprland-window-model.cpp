@@ -0,0 +1,172 @@
+#include "services/window-manager/hyprland/hyprland-window-model.hpp"
+#include "services/window-manager/hyprland/hyprctl.hpp"
+#include <QJsonArray>
+#include <qjsondocument.h>
+#include <qlogging.h>
+
+// events identify windows by their address in hexadecimal, without the prefix used by hyprctl
+static QString windowAddress(QByteArrayView address) { return "0x" + QString::fromUtf8(address); }
+
+// `count` comma separated fields, the last one taking the rest of `data` as titles can include commas
+static std::vector<QByteArrayView> splitFields(QByteArrayView data, int count) {
+  std::vector<QByteArrayView> fields;
+
+  while (static_cast<int>(fields.size()) < count - 1) {
+    auto comma = data.indexOf(',');
+
+    if (comma == -1) break;
+
+    fields.emplace_back(data.first(comma));
+    data = data.sliced(comma + 1);
+  }
+
+  fields.emplace_back(data);
+
+  return fields;
+}
+
+static std::optional<int> parseWorkspace(QByteArrayView id) {
+  bool ok = false;
+  int workspace = id.toInt(&ok);
+
+  if (!ok) return std::nullopt;
+
+  return workspace;
+}
+
+HyprlandWindowModel::HyprlandWindowModel(QObject *parent)
+    : QObject(parent), m_socket(new QLocalSocket(this)), m_reconnectTimer(new QTimer(this)) {
+  m_reconnectTimer->setInterval(RECONNECT_INTERVAL_MS);
+  m_reconnectTimer->setSingleShot(true);
+
+  connect(m_reconnectTimer, &QTimer::timeout, this, &HyprlandWindowModel::connectToSocket);
+  connect(m_socket, &QLocalSocket::connected, this, &HyprlandWindowModel::resync);
+  connect(m_socket, &QLocalSocket::readyRead, this, &HyprlandWindowModel::handleReadyRead);
+  connect(m_socket, &QLocalSocket::disconnected, this, [this]() {
+    qWarning() << "Lost connection to the hyprland event socket, retrying in" << RECONNECT_INTERVAL_MS
+               << "ms";
+    m_synced = false;
+    m_reconnectTimer->start();
+  });
+  connect(m_socket, &QLocalSocket::errorOccurred, this, [this](QLocalSocket::LocalSocketError error) {
+    if (m_socket->state() != QLocalSocket::UnconnectedState) return;
+
+    qWarning() << "Failed to connect to the hyprland event socket" << m_socket->errorString();
+    m_synced = false;
+    m_reconnectTimer->start();
+  });
+}
+
+bool HyprlandWindowModel::isSynced() const { return m_synced; }
+
+AbstractWindowManager::WindowList HyprlandWindowModel::windows() const {
+  return {m_windows.begin(), m_windows.end()};
+}
+
+AbstractWindowManager::WindowPtr HyprlandWindowModel::activeWindow() const {
+  auto it = std::ranges::find(m_windows, m_activeAddress, &HyprlandWindow::id);
+
+  return it == m_windows.end() ? nullptr : *it;
+}
+
+void HyprlandWindowModel::start() { connectToSocket(); }
+
+void HyprlandWindowModel::connectToSocket() {
+  auto path = Hyprctl::socketPath(".socket2.sock");
+
+  if (!path) return;
+
+  m_buffer.clear();
+  m_socket->connectToServer(path->c_str());
+}
+
+void HyprlandWindowModel::resync() {
+  // events may arrive before the responses, they apply on top of what is listed next
+  auto clients = QJsonDocument::fromJson(Hyprctl::oneshot("-j/clients")).array();
+  auto active = QJsonDocument::fromJson(Hyprctl::oneshot("-j/activewindow")).object();
+
+  m_windows.clear();
+  m_windows.reserve(clients.size());
+
+  for (const auto &client : clients) {
+    m_windows.emplace_back(std::make_shared<HyprlandWindow>(client.toObject()));
+  }
+
+  m_activeAddress = active.value("address").toString();
+  m_synced = true;
+  qInfo() << "Synced" << m_windows.size() << "windows from hyprland";
+  emit windowsChanged();
+}
+
+void HyprlandWindowModel::handleReadyRead() {
+  m_buffer += m_socket->readAll();
+
+  qsizetype start = 0;
+
+  for (auto end = m_buffer.indexOf('\n'); end != -1; end = m_buffer.indexOf('\n', start)) {
+    QByteArrayView line = QByteArrayView(m_buffer).sliced(start, end - start);
+    auto separator = line.indexOf(">>");
+
+    if (separator != -1) { handleEvent(line.first(separator), line.sliced(separator + 2)); }
+
+    start = end + 1;
+  }
+
+  m_buffer.remove(0, start);
+}
+
+std::vector<std::shared_ptr<HyprlandWindow>>::iterator
+HyprlandWindowModel::findWindow(const QString &address) {
+  return std::ranges::find(m_windows, address, &HyprlandWindow::id);
+}
+
+void HyprlandWindowModel::handleEvent(QByteArrayView name, QByteArrayView data) {
+  if (!m_synced) return;
+
+  if (name == "openwindow") {
+    // openwindow>>ADDRESS,WORKSPACENAME,CLASS,TITLE
+    auto fields = splitFields(data, 4);
+
+    if (fields.size() != 4) return;
+
+    auto address = windowAddress(fields[0]);
+
+    if (findWindow(address) != m_windows.end()) return;
+
+    m_windows.emplace_back(std::make_shared<HyprlandWindow>(address, QString::fromUtf8(fields[2]),
+                                                            QString::fromUtf8(fields[3]),
+                                                            parseWorkspace(fields[1])));
+    emit windowsChanged();
+  } else if (name == "closewindow") {
+    // closewindow>>ADDRESS
+    auto it = findWindow(windowAddress(data));
+
+    if (it == m_windows.end()) return;
+
+    m_windows.erase(it);
+    emit windowsChanged();
+  } else if (name == "activewindowv2") {
+    // activewindowv2>>ADDRESS, with no address when nothing is focused
+    m_activeAddress = data.isEmpty() || data == "," ? QString() : windowAddress(data);
+  } else if (name == "movewindowv2") {
+    // movewindowv2>>ADDRESS,WORKSPACEID,WORKSPACENAME
+    auto fields = splitFields(data, 3);
+
+    if (fields.size() != 3) return;
+
+    if (auto it = findWindow(windowAddress(fields[0])); it != m_windows.end()) {
+      (*it)->setWorkspace(parseWorkspace(fields[1]));
+      emit windowsChanged();
+    }
+  } else if (name == "windowtitlev2") {
+    // windowtitlev2>>ADDRESS,TITLE
+    auto fields = splitFields(data, 2);
+
+    if (fields.size() != 2) return;
+
+    if (auto it = findWindow(windowAddress(fields[0])); it != m_windows.end()) {
+      (*it)->setTitle(QString::fromUtf8(fields[1]));
+      emit windowsChanged();
+    }
+  }
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "services/window-manager/abstract-window-manager.hpp"
+#include "services/window-manager/hyprland/hyprland.hpp"
+#include <qlocalsocket.h>
+#include <qobject.h>
+#include <qtimer.h>
+#include <qtmetamacros.h>
+
+/**
+ * The windows of the running Hyprland instance, kept up to date from the events Hyprland sends over its
+ * event socket.
+ *
+ * The full list of windows is only requested when connecting to the socket: once synced, listing windows
+ * or looking up the focused one does not make any IPC call. The connection is retried if it is lost.
+ */
+class HyprlandWindowModel : public QObject {
+  Q_OBJECT
+
+public:
+  /**
+   * Whether the model is connected to the event socket and holds the current windows.
+   */
+  bool isSynced() const;
+
+  AbstractWindowManager::WindowList windows() const;
+  AbstractWindowManager::WindowPtr activeWindow() const;
+
+  void start();
+
+  HyprlandWindowModel(QObject *parent = nullptr);
+
+signals:
+  void windowsChanged() const;
+
+private:
+  static constexpr int RECONNECT_INTERVAL_MS = 2000;
+
+  QLocalSocket *m_socket;
+  QTimer *m_reconnectTimer;
+  QByteArray m_buffer;
+  std::vector<std::shared_ptr<HyprlandWindow>> m_windows;
+  QString m_activeAddress;
+  bool m_synced = false;
+
+  void connectToSocket();
+  void resync();
+  void handleReadyRead();
+  void handleEvent(QByteArrayView name, QByteArrayView data);
+  std::vector<std::shared_ptr<HyprlandWindow>>::iterator findWindow(const QString &address);
+};
@@ -1,12 +1,26 @@
 #include "hyprland.hpp"
 #include "services/window-manager/abstract-window-manager.hpp"
 #include "services/window-manager/hyprland/hyprctl.hpp"
+#include "services/window-manager/hyprland/hyprland-window-model.hpp"
 #include <ranges>
 
 HyprlandWindow::HyprlandWindow(const QJsonObject &json) {
   m_id = json.value("address").toString();
   m_title = json.value("title").toString();
   m_wmClass = json.value("class").toString();
+
+  if (auto pid = json.value("pid"); pid.isDouble()) { m_pid = pid.toInt(); }
+  if (auto workspace = json.value("workspace").toObject().value("id"); workspace.isDouble()) {
+    m_workspace = workspace.toInt();
+  }
+}
+
+HyprlandWindow::HyprlandWindow(const QString &id, const QString &wmClass, const QString &title,
+                               std::optional<int> workspace)
+    : m_id(id), m_title(title), m_wmClass(wmClass), m_workspace(workspace) {}
+
+HyprlandWindowManager::HyprlandWindowManager() : m_model(new HyprlandWindowModel(this)) {
+  connect(m_model, &HyprlandWindowModel::windowsChanged, this, &HyprlandWindowManager::windowsChanged);
 }
 
 QString HyprlandWindowManager::stringifyModifiers(QFlags<Qt::KeyboardModifier> mods) {
@@ -25,6 +39,8 @@ QString HyprlandWindowManager::id() const { return "hyprland"; }
 QString HyprlandWindowManager::displayName() const { return "Hyprland"; }
 
 AbstractWindowManager::WindowList HyprlandWindowManager::listWindowsSync() const {
+  if (m_model->isSynced()) { return m_model->windows(); }
+
   auto response = Hyprctl::oneshot("-j/clients");
   auto json = QJsonDocument::fromJson(response);
   auto windows = json.array() |
@@ -37,6 +53,8 @@ AbstractWindowManager::WindowList HyprlandWindowManager::listWindowsSync() const
 }
 
 AbstractWindowManager::WindowPtr HyprlandWindowManager::getFocusedWindowSync() const {
+  if (m_model->isSynced()) { return m_model->activeWindow(); }
+
   auto response = Hyprctl::oneshot("-j/activewindow");
   auto json = QJsonDocument::fromJson(response);
 
@@ -63,9 +81,11 @@ void HyprlandWindowManager::focusWindowSync(const AbstractWindow &window) const
   Hyprctl::oneshot(std::format("dispatch focuswindow address:{}", window.id().toStdString()));
 }
 
-bool HyprlandWindowManager::closeWindow(const AbstractWindow &window) const {
+bool HyprlandWindowManager::closeWindowSync(const AbstractWindow &window) const {
   Hyprctl::oneshot(std::format("dispatch closewindow address:{}", window.id().toStdString()));
-  emit windowsChanged();
+
+  // the window is removed from the model once hyprland reports it closed
+  if (!m_model->isSynced()) { emit windowsChanged(); }
 
   return true;
 }
@@ -81,4 +101,4 @@ bool HyprlandWindowManager::ping() const {
   return true;
 }
 
-void HyprlandWindowManager::start() const {}
+void HyprlandWindowManager::start() const { m_model->start(); }
@@ -21,22 +21,30 @@ class HyprlandWindow : public AbstractWindowManager::AbstractWindow {
   QString m_id;
   QString m_title;
   QString m_wmClass;
-  int m_pid;
+  std::optional<int> m_pid;
+  std::optional<int> m_workspace;
 
 public:
   QString id() const override { return m_id; }
   std::optional<int> pid() const override { return m_pid; }
   QString title() const override { return m_title; }
   QString wmClass() const override { return m_wmClass; }
-
-  // Extended AbstractWindow interface - use defaults for now
-  std::optional<int> workspace() const override { return std::nullopt; }
+  std::optional<int> workspace() const override { return m_workspace; }
   bool canClose() const override { return true; }
 
+  void setTitle(const QString &title) { m_title = title; }
+  void setWorkspace(std::optional<int> workspace) { m_workspace = workspace; }
+
   HyprlandWindow(const QJsonObject &json);
+  HyprlandWindow(const QString &id, const QString &wmClass, const QString &title,
+                 std::optional<int> workspace);
 };
 
+class HyprlandWindowModel;
+
 class HyprlandWindowManager : public AbstractWindowManager {
+  HyprlandWindowModel *m_model;
+
   QString stringifyModifiers(QFlags<Qt::KeyboardModifier> mods);
 
   QString stringifyKey(Qt::Key key) const;
@@ -49,11 +57,12 @@ public:
   bool supportsInputForwarding() const override;
   bool sendShortcutSync(const AbstractWindow &window, const KeyboardShortcut &shortcut) override;
   void focusWindowSync(const AbstractWindow &window) const override;
-  bool closeWindow(const AbstractWindow &window) const override;
+  bool closeWindowSync(const AbstractWindow &window) const override;
   bool isActivatable() const override;
 
   bool ping() const override;
   void start() const override;
 
+  HyprlandWindowManager();
   ~HyprlandWindowManager() override = default;
 };
@@ -26,10 +26,15 @@ AbstractWindowManager *WindowManager::provider() const { return m_provider.get()
 
 AbstractWindowManager::WindowList WindowManager::listWindowsSync() { return m_provider->listWindowsSync(); }
 
+QFuture<AbstractWindowManager::WindowList> WindowManager::listWindows() { return m_provider->listWindows(); }
+
 AbstractWindowManager::WindowPtr WindowManager::getFocusedWindow() {
   return m_provider->getFocusedWindowSync();
 }
 
 bool WindowManager::canPaste() const { return m_provider->supportsInputForwarding(); }
 
-WindowManager::WindowManager() { m_provider = createProvider(); }
+WindowManager::WindowManager() {
+  m_provider = createProvider();
+  m_provider->start();
+}
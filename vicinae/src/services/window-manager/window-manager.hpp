@@ -10,6 +10,7 @@ class WindowManager {
 public:
   AbstractWindowManager *provider() const;
   AbstractWindowManager::WindowList listWindowsSync();
+  QFuture<AbstractWindowManager::WindowList> listWindows();
   AbstractWindowManager::WindowPtr getFocusedWindow();
   bool canPaste() const;
 
@@ -12,9 +12,11 @@
 #include "ui/omni-tree/omni-tree.hpp"
 #include "ui/typography/typography.hpp"
 #include <libqalculate/Number.h>
+#include <map>
 #include <memory>
 #include <qabstractitemmodel.h>
 #include <qboxlayout.h>
+#include <qcache.h>
 #include <qdnslookup.h>
 #include <qevent.h>
 #include <qjsonobject.h>
@@ -30,6 +32,8 @@
 #include <qlineedit.h>
 #include <qwidget.h>
 #include <qtreeview.h>
+#include <unordered_map>
+#include <unordered_set>
 
 class NameTreeWidget : public QWidget {
   QHBoxLayout *m_layout = new QHBoxLayout;
@@ -132,6 +136,8 @@ public:
 
 class AbstractSettingsDetailPaneItem {
 public:
+  // what the detail is about, content created for the same id can be shown again
+  virtual QString id() const = 0;
   virtual ImageURL icon() const = 0;
   virtual QString title() const = 0;
   virtual QWidget *content() const = 0;
@@ -143,6 +149,7 @@ class ProviderDetailPaneItem : public AbstractSettingsDetailPaneItem {
   RootProvider *m_provider = nullptr;
 
 public:
+  QString id() const override { return m_provider->uniqueId(); }
   ImageURL icon() const override { return m_provider->icon(); }
   QString title() const override { return m_provider->displayName(); }
   QWidget *content() const override { return m_provider->settingsDetail(); }
@@ -154,6 +161,7 @@ class RootDetailPaneItem : public AbstractSettingsDetailPaneItem {
   std::shared_ptr<RootItem> m_item;
 
 public:
+  QString id() const override { return m_item->uniqueId(); }
   ImageURL icon() const override { return m_item->iconUrl(); }
   QString title() const override { return m_item->displayName(); }
   QWidget *content() const override {
@@ -188,9 +196,30 @@ public:
   bool disabled() const override { return !m_enabled; }
 
   void setEnabled(bool value) { m_enabled = value; }
+  void setItem(const std::shared_ptr<RootItem> &item) { m_item = item; }
 
   QString id() const override { return m_item->uniqueId(); }
 
+  QVariant sortKey(int column) const override {
+    switch (column) {
+    case 0:
+      return m_item->displayName();
+    case 1:
+      return m_item->typeDisplayName();
+    case 2: {
+      auto alias = ServiceRegistry::instance()->rootItemManager()->itemMetadata(m_item->uniqueId()).alias;
+
+      // items without an alias are listed last
+      return alias.isEmpty() ? QVariant() : alias;
+    }
+    case 3:
+      // in the order of the provider checkbox states
+      return m_enabled ? 2 : 0;
+    default:
+      return {};
+    }
+  }
+
   void refreshForColumn(QWidget *widget, int column) const override {
     if (column == 3) {
       auto checkbox = static_cast<CheckboxContainer *>(widget)->checkbox();
@@ -268,7 +297,6 @@ public:
 private:
   RootProvider *m_provider = nullptr;
   CheckboxState m_checkboxState = UNCHECKED;
-  std::vector<std::shared_ptr<RootItem>> items;
   std::vector<std::shared_ptr<VirtualTreeItemDelegate>> child;
 
 public:
@@ -280,6 +308,19 @@ public:
 
   QString id() const override { return m_provider->uniqueId(); }
 
+  QVariant sortKey(int column) const override {
+    switch (column) {
+    case 0:
+      return m_provider->displayName();
+    case 1:
+      return m_provider->typeAsString();
+    case 3:
+      return m_checkboxState == CHECKED ? 2 : m_checkboxState == PARTIAL ? 1 : 0;
+    default:
+      return {};
+    }
+  }
+
   void styleCheckbox(Checkbox *checkbox) const {
     checkbox->blockSignals(true);
     checkbox->setValue(m_checkboxState == CHECKED || m_checkboxState == PARTIAL);
@@ -343,23 +384,41 @@ public:
   std::vector<std::shared_ptr<VirtualTreeItemDelegate>> children() const override { return child; }
 
   void setCheckboxState(CheckboxState state) { m_checkboxState = state; }
+  void setProvider(RootProvider *provider) { m_provider = provider; }
 
-public:
-  ProviderItemDelegate(RootProvider *provider, const std::vector<std::shared_ptr<RootItem>> &items)
-      : m_provider(provider), items(items) {
+  /**
+   * Set the items of the provider. The delegates of the items it already had are kept, so that their rows
+   * are updated in place.
+   */
+  void setItems(const std::vector<std::shared_ptr<RootItem>> &items) {
+    auto manager = ServiceRegistry::instance()->rootItemManager();
+    std::unordered_map<QString, std::shared_ptr<VirtualTreeItemDelegate>> previous;
     size_t disabledCount = 0;
 
+    for (auto &delegate : child) {
+      previous.insert({delegate->id(), std::move(delegate)});
+    }
+
+    child.clear();
+    child.reserve(items.size());
+
     for (const auto &item : items) {
-      auto manager = ServiceRegistry::instance()->rootItemManager();
       auto metadata = manager->itemMetadata(item->uniqueId());
-      auto delegate = new RootItemDelegate(item);
+      std::shared_ptr<RootItemDelegate> delegate;
+
+      if (auto it = previous.find(item->uniqueId()); it != previous.end()) {
+        delegate = std::static_pointer_cast<RootItemDelegate>(it->second);
+        delegate->setItem(item);
+      } else {
+        delegate = std::make_shared<RootItemDelegate>(item);
+        connect(delegate.get(), &RootItemDelegate::itemEnabledChanged, this,
+                [delegate = delegate.get(), this](auto a, bool value) {
+                  emit itemEnabledChanged(delegate, value);
+                });
+      }
 
       disabledCount += !metadata.isEnabled;
       delegate->setEnabled(metadata.isEnabled);
-
-      connect(delegate, &RootItemDelegate::itemEnabledChanged, this,
-              [delegate, this](auto a, bool value) { emit itemEnabledChanged(delegate, value); });
-
       child.emplace_back(delegate);
     }
 
@@ -372,34 +431,58 @@ public:
     }
   }
 
+public:
+  ProviderItemDelegate(RootProvider *provider, const std::vector<std::shared_ptr<RootItem>> &items)
+      : m_provider(provider) {
+    setItems(items);
+  }
+
 signals:
   void itemEnabledChanged(RootItemDelegate *delegate, bool value) const;
   void providerEnabledChanged(const RootProvider *provider, bool value) const;
 };
 
 class ExtensionSettingsDetailPane : public QWidget {
+  static constexpr int CACHED_CONTENT_COUNT = 16;
+
   ImageWidget *m_icon = new ImageWidget;
   QVBoxLayout *m_layout = new QVBoxLayout;
   TypographyWidget *m_title = new TypographyWidget;
   QWidget *m_header = new QWidget;
   QScrollArea *m_content = new VerticalScrollArea(this);
   HDivider *m_divider = new HDivider;
+  // content that was shown before and is not anymore, by id of the item it is the detail of
+  QCache<QString, QWidget> m_cachedContent{CACHED_CONTENT_COUNT};
+  QString m_contentId;
 
 public:
+  /**
+   * Forget the content created so far, as what it shows may have changed.
+   */
+  void invalidateContent() { m_cachedContent.clear(); }
+
   void setData(std::unique_ptr<AbstractSettingsDetailPaneItem> data) {
     m_title->setText(data->title());
     m_icon->setUrl(data->icon());
     m_icon->show();
     m_divider->show();
 
-    QWidget *content = data->content();
+    if (data->id() != m_contentId || !m_content->widget()) {
+      // the scroll area deletes the widget it is given another one for
+      if (auto previous = m_content->takeWidget()) {
+        previous->hide();
+        m_cachedContent.insert(m_contentId, previous);
+      }
+
+      QWidget *content = m_cachedContent.take(data->id());
+
+      if (!content) content = data->content();
 
-    if (auto previous = m_content->widget()) {
-      // previous->deleteLater();
-      previous->hide();
+      m_content->setWidget(content);
+      content->show();
+      m_contentId = data->id();
     }
 
-    m_content->setWidget(content);
     m_divider->show();
     m_content->show();
     m_header->show();
@@ -447,8 +530,10 @@ class ExtensionSettingsContextLeftPane : public QWidget {
   ExtensionSettingsToolbar *m_toolbar = new ExtensionSettingsToolbar();
   OmniTree *m_tree = new OmniTree;
   QTimer m_searchDebounce;
+  // built once with every item and kept across searches, which only change what rows are visible
+  std::map<QString, std::shared_ptr<ProviderItemDelegate>> m_providers;
 
-  void handleTextChange(const QString &text) { populateTreeFromQuery(text); }
+  void handleTextChange(const QString &text) { m_searchDebounce.start(); }
 
   void providerEnabledChanged(ProviderItemDelegate *delegate, bool value) {
     auto manager = ServiceRegistry::instance()->rootItemManager();
@@ -476,14 +561,19 @@ class ExtensionSettingsContextLeftPane : public QWidget {
     m_tree->refresh();
   }
 
-  void populateTreeFromQuery(const QString &query) {
+  /**
+   * Bring the tree in line with the items of the root item manager. Delegates are reused by id, for
+   * providers and items alike.
+   */
+  void rebuildTree() {
     auto manager = ServiceRegistry::instance()->rootItemManager();
     RootItemPrefixSearchOptions opts;
     std::map<QString, std::vector<std::shared_ptr<RootItem>>> map;
+    std::map<QString, std::shared_ptr<ProviderItemDelegate>> providers;
 
     opts.includeDisabled = true;
 
-    for (const auto &item : manager->prefixSearch(query, opts)) {
+    for (const auto &item : manager->prefixSearch("", opts)) {
       QString providerId = manager->getItemProviderId(item->uniqueId());
 
       if (providerId.isEmpty()) continue;
@@ -491,39 +581,78 @@ class ExtensionSettingsContextLeftPane : public QWidget {
       map[providerId].emplace_back(item);
     }
 
-    std::vector<std::shared_ptr<VirtualTreeItemDelegate>> delegates;
-
-    delegates.reserve(map.size());
-
     for (const auto &[providerId, items] : map) {
       auto provider = manager->provider(providerId);
 
       if (!provider) continue;
 
+      if (auto it = m_providers.find(providerId); it != m_providers.end()) {
+        it->second->setProvider(provider);
+        it->second->setItems(items);
+        providers.insert(m_providers.extract(it));
+        continue;
+      }
+
       auto delegate = std::make_shared<ProviderItemDelegate>(provider, items);
       auto delegatePtr = delegate.get();
 
-      delegate->setExpandable(!query.isEmpty());
-
       connect(delegate.get(), &ProviderItemDelegate::providerEnabledChanged, this,
               [this, delegatePtr](auto provider, bool value) { providerEnabledChanged(delegatePtr, value); });
       connect(delegate.get(), &ProviderItemDelegate::itemEnabledChanged, this,
               &ExtensionSettingsContextLeftPane::itemEnabledChanged);
 
-      delegates.emplace_back(delegate);
+      providers.insert({providerId, delegate});
     }
 
-    m_tree->setColumns({"Name", "Type", "Alias", "Enabled"});
-    m_tree->setColumnWidth(1, 100);
-    m_tree->setColumnWidth(2, 100);
-    m_tree->setColumnWidth(3, 80);
-    m_tree->addRows(delegates);
+    m_providers = std::move(providers);
+
+    std::vector<std::shared_ptr<VirtualTreeItemDelegate>> rows;
+
+    rows.reserve(m_providers.size());
+
+    for (const auto &[providerId, delegate] : m_providers) {
+      rows.emplace_back(delegate);
+    }
+
+    filterTree(m_toolbar->input()->text());
+    m_tree->addRows(rows);
   }
 
-  void handleDebouncedSearch() {
-    QString text = m_toolbar->input()->text();
+  /**
+   * Only show the items matching `query`, under their provider.
+   */
+  void filterTree(const QString &query) {
+    auto manager = ServiceRegistry::instance()->rootItemManager();
+    RootItemPrefixSearchOptions opts;
+    std::unordered_set<QString> matches;
+    bool filtering = !query.isEmpty();
+
+    opts.includeDisabled = true;
+
+    if (filtering) {
+      for (const auto &item : manager->prefixSearch(query, opts)) {
+        matches.insert(item->uniqueId());
+      }
+    }
+
+    for (const auto &[providerId, delegate] : m_providers) {
+      bool visible = !filtering;
+
+      for (const auto &child : delegate->children()) {
+        bool matched = !filtering || matches.contains(child->id());
+
+        child->setVisible(matched);
+        visible = visible || matched;
+      }
+
+      delegate->setVisible(visible);
+      delegate->setExpandable(filtering);
+    }
+  }
 
-    populateTreeFromQuery(text);
+  void handleDebouncedSearch() {
+    filterTree(m_toolbar->input()->text());
+    m_tree->renderModel(OmniList::SelectionPolicy::SelectNone);
   }
 
   void selectionUpdated(VirtualTreeItemDelegate *next, VirtualTreeItemDelegate *previous) {
@@ -556,11 +685,15 @@ class ExtensionSettingsContextLeftPane : public QWidget {
     });
 
     connect(m_tree, &OmniTree::selectionUpdated, this, &ExtensionSettingsContextLeftPane::selectionUpdated);
-    connect(manager, &RootItemManager::itemsChanged, this,
-            [this]() { populateTreeFromQuery(m_toolbar->input()->text()); });
+    connect(manager, &RootItemManager::itemsChanged, this, &ExtensionSettingsContextLeftPane::rebuildTree);
 
+    m_tree->setColumns({"Name", "Type", "Alias", "Enabled"});
+    m_tree->setColumnWidth(1, 100);
+    m_tree->setColumnWidth(2, 100);
+    m_tree->setColumnWidth(3, 80);
+    m_tree->setSortingEnabled(true);
     setLayout(layout);
-    populateTreeFromQuery("");
+    rebuildTree();
   }
 
 public:
@@ -601,6 +734,8 @@ public:
 
     connect(m_left, &ExtensionSettingsContextLeftPane::itemSelectionChanged, this,
             &ExtensionSettingsContent::itemSelectionChanged);
+    connect(ServiceRegistry::instance()->rootItemManager(), &RootItemManager::itemsChanged, m_detail,
+            [this]() { m_detail->invalidateContent(); });
   }
 
   ExtensionSettingsContent() { setupUI(); }
@@ -37,14 +37,17 @@ QWidget *SettingsWindow::createWidget() {
   QVBoxLayout *layout = new QVBoxLayout;
 
   for (const auto &category : m_categories) {
+    auto page = new QWidget;
+    auto pageLayout = new QVBoxLayout(page);
+
+    pageLayout->setContentsMargins(0, 0, 0, 0);
     m_navigation->addPane(category->id(), category->title(), category->icon());
-    content->addWidget(category->createContent());
+    m_pages.emplace_back(page);
+    m_builtPages.emplace_back(false);
+    content->addWidget(page);
   }
 
-  connect(m_navigation, &SettingsNavWidget::rowChanged, this, [this](int idx) {
-    content->setCurrentIndex(idx);
-    m_navigation->setSelected(m_categories.at(idx)->id());
-  });
+  connect(m_navigation, &SettingsNavWidget::rowChanged, this, [this](int idx) { selectCategory(idx); });
 
   layout->setContentsMargins(0, 0, 0, 0);
   layout->setSpacing(0);
@@ -56,7 +59,29 @@ QWidget *SettingsWindow::createWidget() {
   return widget;
 }
 
-void SettingsWindow::showEvent(QShowEvent *event) { QMainWindow::showEvent(event); }
+void SettingsWindow::showEvent(QShowEvent *event) {
+  selectCategory(content->currentIndex());
+  QMainWindow::showEvent(event);
+}
+
+void SettingsWindow::selectCategory(size_t idx) {
+  if (!m_builtPages.at(idx)) {
+    m_builtPages[idx] = true;
+    m_pages[idx]->layout()->addWidget(m_categories[idx]->createContent());
+  }
+
+  content->setCurrentIndex(idx);
+  m_navigation->setSelected(m_categories[idx]->id());
+}
+
+bool SettingsWindow::openTab(const QString &id) {
+  auto it = std::ranges::find_if(m_categories, [&](auto &&cat) { return cat->id() == id; });
+
+  if (it == m_categories.end()) return false;
+
+  selectCategory(std::distance(m_categories.begin(), it));
+  return true;
+}
 
 SettingsWindow::SettingsWindow(ApplicationContext *ctx) : m_ctx(ctx) {
   setWindowFlags(Qt::FramelessWindowHint);
@@ -73,24 +98,61 @@ SettingsWindow::SettingsWindow(ApplicationContext *ctx) : m_ctx(ctx) {
   m_categories.emplace_back(std::make_unique<AboutSettingsCategory>());
   setCentralWidget(createWidget());
 
+  // built when the window is first shown, unless another tab gets opened first
+  m_navigation->setSelected(m_categories.front()->id());
+  content->setCurrentIndex(0);
+}
+
+SettingsWindow::~SettingsWindow() {}
+
+SettingsWindow *LazySettingsWindow::window() {
+  if (!m_window) {
+    m_window = new SettingsWindow(m_ctx);
+    m_window->installEventFilter(this);
+  }
+
+  return m_window;
+}
+
+bool LazySettingsWindow::eventFilter(QObject *watched, QEvent *event) {
+  if (watched == m_window) {
+    if (event->type() == QEvent::Hide) {
+      m_releaseTimer->start();
+    } else if (event->type() == QEvent::Show) {
+      m_releaseTimer->stop();
+    }
+  }
+
+  return QObject::eventFilter(watched, event);
+}
+
+void LazySettingsWindow::release() {
+  if (!m_window || m_window->isVisible()) return;
+
+  m_window->deleteLater();
+  m_window.clear();
+}
+
+LazySettingsWindow::LazySettingsWindow(ApplicationContext *ctx) : m_ctx(ctx) {
+  m_releaseTimer->setSingleShot(true);
+  m_releaseTimer->setInterval(RELEASE_DELAY);
+  connect(m_releaseTimer, &QTimer::timeout, this, &LazySettingsWindow::release);
+
   connect(m_ctx->settings.get(), &SettingsController::windowVisiblityChangeRequested, this,
           [this](bool value) {
-            hide();
-            setVisible(value);
+            // closing a window that was never opened should not create it
+            if (!value && !m_window) return;
+
+            window()->hide();
+            window()->setVisible(value);
           });
 
   connect(m_ctx->settings.get(), &SettingsController::tabIdOpened, this, [this](const QString &id) {
-    if (auto it = std::ranges::find_if(m_categories, [&](auto &&cat) { return cat->id() == id; });
-        it != m_categories.end()) {
-      m_navigation->setSelected(id);
-      content->setCurrentIndex(std::distance(m_categories.begin(), it));
-      hide();
-      show();
+    if (window()->openTab(id)) {
+      window()->hide();
+      window()->show();
     }
   });
-
-  m_navigation->setSelected("general");
-  content->setCurrentIndex(0);
 }
 
-SettingsWindow::~SettingsWindow() {}
+LazySettingsWindow::~LazySettingsWindow() { delete m_window; }
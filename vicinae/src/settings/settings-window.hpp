@@ -13,9 +13,12 @@
 #include <qmainwindow.h>
 #include <qnamespace.h>
 #include <qpainterpath.h>
+#include <qpointer.h>
 #include <qstackedwidget.h>
+#include <qtimer.h>
 #include <qtmetamacros.h>
 #include <qwidget.h>
+#include <chrono>
 
 class SettingsNavPane : public QWidget {
   Q_OBJECT
@@ -172,14 +175,45 @@ struct PaneInfo {
 class SettingsWindow : public QMainWindow {
   ApplicationContext *m_ctx = nullptr;
   std::vector<std::unique_ptr<SettingsCategory>> m_categories;
+  // category contents are only created once the category is first selected
+  std::vector<QWidget *> m_pages;
+  std::vector<bool> m_builtPages;
   SettingsNavWidget *m_navigation = new SettingsNavWidget;
   QStackedWidget *content = new QStackedWidget;
 
   void showEvent(QShowEvent *event) override;
   void paintEvent(QPaintEvent *event) override;
   QWidget *createWidget();
+  void selectCategory(size_t idx);
 
 public:
+  /**
+   * Select the category with `id`, if there is one.
+   */
+  bool openTab(const QString &id);
+
   SettingsWindow(ApplicationContext *ctx);
   ~SettingsWindow();
 };
+
+/**
+ * Owns the settings window on behalf of the settings controller. Most sessions never open the settings, so
+ * the window is only created when it is first requested, and it is destroyed once it has been closed for
+ * `RELEASE_DELAY`.
+ */
+class LazySettingsWindow : public QObject {
+public:
+  static constexpr std::chrono::minutes RELEASE_DELAY{2};
+
+  LazySettingsWindow(ApplicationContext *ctx);
+  ~LazySettingsWindow();
+
+private:
+  bool eventFilter(QObject *watched, QEvent *event) override;
+  SettingsWindow *window();
+  void release();
+
+  ApplicationContext *m_ctx = nullptr;
+  QPointer<SettingsWindow> m_window;
+  QTimer *m_releaseTimer = new QTimer(this);
+};
@@ -0,0 +1,68 @@
+#include "startup-benchmark.hpp"
+#include <QJsonArray>
+#include <QJsonObject>
+#include <algorithm>
+
+using std::chrono::microseconds;
+
+static double toMs(microseconds duration) { return duration.count() / 1000.0; }
+
+StartupBenchmark::Scope::Scope(QString name) : m_name(std::move(name)) {
+  if (auto &benchmark = instance(); benchmark.isRunning()) { m_start = benchmark.elapsed(); }
+}
+
+StartupBenchmark::Scope::~Scope() {
+  auto &benchmark = instance();
+
+  if (m_start.count() < 0 || !benchmark.isRunning()) return;
+
+  benchmark.m_phases.emplace_back(
+      Phase{.name = std::move(m_name), .start = m_start, .duration = benchmark.elapsed() - m_start});
+}
+
+StartupBenchmark &StartupBenchmark::instance() {
+  static StartupBenchmark benchmark;
+
+  return benchmark;
+}
+
+void StartupBenchmark::start(const QString &dataDir) {
+  m_dataDir = dataDir;
+  m_phases.clear();
+  m_milestones.clear();
+  m_timer.start();
+}
+
+microseconds StartupBenchmark::elapsed() const { return microseconds(m_timer.nsecsElapsed() / 1000); }
+
+bool StartupBenchmark::reach(const char *name) {
+  if (!isRunning() || hasReached(name)) return false;
+
+  m_milestones[name] = elapsed();
+
+  return true;
+}
+
+QJsonDocument StartupBenchmark::report() const {
+  auto phases = m_phases;
+  QJsonArray phaseList;
+  QJsonObject milestones;
+
+  // scopes are recorded as they end, which puts nested phases before the ones they are part of
+  std::ranges::stable_sort(phases, {}, &Phase::start);
+
+  for (const auto &phase : phases) {
+    phaseList.append(QJsonObject{
+        {"name", phase.name}, {"startMs", toMs(phase.start)}, {"durationMs", toMs(phase.duration)}});
+  }
+
+  for (const auto &[name, time] : m_milestones) {
+    milestones[name] = toMs(time);
+  }
+
+  return QJsonDocument(QJsonObject{{"dataDir", m_dataDir},
+                                   {"query", QUERY},
+                                   {"totalMs", toMs(elapsed())},
+                                   {"phases", phaseList},
+                                   {"milestones", milestones}});
+}
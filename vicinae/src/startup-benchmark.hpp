@@ -0,0 +1,76 @@
+#pragma once
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QString>
+#include <chrono>
+#include <map>
+#include <vector>
+
+/**
+ * Timeline of a start of the daemon run with `vicinae server --startup-benchmark`, to track the cold start
+ * time across releases.
+ *
+ * Phases are the startup steps along with the expensive work done within them, milestones are what the
+ * user sees: the window painted for the first time and the first search results rendered. Everything is
+ * measured from the time the benchmark starts, nothing is recorded outside of a benchmark.
+ */
+class StartupBenchmark {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  // matches a builtin command, so that there is a result with any data directory
+  static constexpr const char *QUERY = "settings";
+  // a milestone that cannot be reached should not leave the benchmark hanging
+  static constexpr auto TIMEOUT = std::chrono::seconds(60);
+  static constexpr auto POLL_INTERVAL = std::chrono::milliseconds(5);
+
+  static constexpr const char *WINDOW_PAINTED = "windowPainted";
+  static constexpr const char *FIRST_SEARCH_RESULT = "firstSearchResult";
+  static constexpr const char *DEFERRED_STARTED = "deferredServicesStarted";
+
+  struct Phase {
+    QString name;
+    std::chrono::microseconds start;
+    std::chrono::microseconds duration;
+  };
+
+  /**
+   * Records the phase it lives for, if a benchmark is running.
+   */
+  class Scope {
+  public:
+    Scope(QString name);
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    QString m_name;
+    std::chrono::microseconds m_start{-1};
+  };
+
+  static StartupBenchmark &instance();
+
+  void start(const QString &dataDir);
+  bool isRunning() const { return m_timer.isValid(); }
+
+  /**
+   * Record that `name` was reached, unless it already was. Returns whether it was recorded.
+   */
+  bool reach(const char *name);
+  bool hasReached(const char *name) const { return m_milestones.contains(name); }
+
+  std::chrono::microseconds elapsed() const;
+
+  /**
+   * Phases in the order they started and milestones, in milliseconds.
+   */
+  QJsonDocument report() const;
+
+private:
+  QElapsedTimer m_timer;
+  QString m_dataDir;
+  std::vector<Phase> m_phases;
+  std::map<QString, std::chrono::microseconds> m_milestones;
+};
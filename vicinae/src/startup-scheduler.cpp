@@ -0,0 +1,87 @@
+#include "startup-scheduler.hpp"
+#include "startup-benchmark.hpp"
+#include <QElapsedTimer>
+#include <algorithm>
+#include <utility>
+#include <qlogging.h>
+#include <qtimer.h>
+
+void StartupScheduler::add(const QString &name, Stage stage, std::function<void()> start,
+                           const std::vector<QString> &dependencies) {
+  m_steps.emplace_back(Step{.name = name, .stage = stage, .start = start, .dependencies = dependencies});
+}
+
+StartupScheduler::Step *StartupScheduler::find(const QString &name) {
+  auto it = std::ranges::find(m_steps, name, &Step::name);
+
+  return it == m_steps.end() ? nullptr : &*it;
+}
+
+void StartupScheduler::run(Step &step) {
+  if (step.started) return;
+
+  if (step.starting) {
+    qCritical() << "Startup step" << step.name << "depends on itself";
+    return;
+  }
+
+  step.starting = true;
+
+  for (const auto &name : step.dependencies) {
+    if (auto dependency = find(name)) {
+      run(*dependency);
+    } else {
+      qCritical() << "Startup step" << step.name << "depends on unknown step" << name;
+    }
+  }
+
+  QElapsedTimer timer;
+  StartupBenchmark::Scope benchmark(step.name);
+
+  timer.start();
+  step.start();
+  step.started = true;
+  step.starting = false;
+  qInfo().noquote() << "Started" << step.name << "in" << timer.elapsed() << "ms";
+}
+
+void StartupScheduler::startCritical() {
+  QElapsedTimer timer;
+
+  timer.start();
+
+  for (auto &step : m_steps) {
+    if (step.stage == Critical) { run(step); }
+  }
+
+  qInfo() << "Started critical services in" << timer.elapsed() << "ms";
+}
+
+void StartupScheduler::startDeferred(std::function<void()> done) {
+  m_deferredDone = std::move(done);
+  scheduleNextDeferred();
+}
+
+void StartupScheduler::scheduleNextDeferred() {
+  QTimer::singleShot(0, [this]() { runNextDeferred(); });
+}
+
+void StartupScheduler::runNextDeferred() {
+  auto it = std::ranges::find_if(m_steps, [](const Step &step) { return !step.started; });
+
+  if (it == m_steps.end()) {
+    if (auto done = std::exchange(m_deferredDone, {})) { done(); }
+    return;
+  }
+
+  run(*it);
+  scheduleNextDeferred();
+}
+
+void StartupScheduler::require(const QString &name) {
+  if (auto step = find(name)) {
+    run(*step);
+  } else {
+    qCritical() << "No startup step named" << name;
+  }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <QString>
+#include <functional>
+#include <vector>
+
+/**
+ * Runs the steps starting the services of the daemon in the order of their dependencies, logging how long
+ * each of them took.
+ *
+ * Critical steps run before the launcher window is created. Deferred steps are only needed by a few
+ * commands: they run one per event loop iteration once the loop is started so that the window can be
+ * toggled in between, and a deferred service that is needed sooner is started on demand with `require`.
+ *
+ * Steps run on the main thread, the services being QObjects living there and most of them owning a
+ * QSqlDatabase connection, which can only be used from the thread that opened it.
+ */
+class StartupScheduler {
+public:
+  enum Stage { Critical, Deferred };
+
+  void add(const QString &name, Stage stage, std::function<void()> start,
+           const std::vector<QString> &dependencies = {});
+
+  /**
+   * Run every critical step, and the deferred steps they depend on.
+   */
+  void startCritical();
+
+  /**
+   * Run the deferred steps that are not started yet from the event loop, one at a time, calling `done` once
+   * every step is started.
+   */
+  void startDeferred(std::function<void()> done = {});
+
+  /**
+   * Run the step called `name` and its dependencies right away, if it was not started yet.
+   */
+  void require(const QString &name);
+
+private:
+  struct Step {
+    QString name;
+    Stage stage;
+    std::function<void()> start;
+    std::vector<QString> dependencies;
+    bool started = false;
+    bool starting = false;
+  };
+
+  std::vector<Step> m_steps;
+  std::function<void()> m_deferredDone;
+
+  Step *find(const QString &name);
+  void run(Step &step);
+  void runNextDeferred();
+  void scheduleNextDeferred();
+};
@@ -1,15 +1,53 @@
 #include "theme.hpp"
-#include "template-engine/template-engine.hpp"
+#include "common.hpp"
 #include "timer.hpp"
 #include "ui/omni-painter/omni-painter.hpp"
 #include "vicinae.hpp"
+#include <QJsonArray>
 #include <QLinearGradient>
+#include <QSaveFile>
+#include <QStandardPaths>
 #include <filesystem>
 #include <QStyleHints>
 #include <system_error>
 
 namespace fs = std::filesystem;
 
+// keys of the palette colors, in theme files and in the theme catalog
+static constexpr std::array<std::pair<const char *, QColor ColorPalette::*>, 10> PALETTE_COLORS = {{
+    {"background", &ColorPalette::background},
+    {"foreground", &ColorPalette::foreground},
+    {"blue", &ColorPalette::blue},
+    {"green", &ColorPalette::green},
+    {"magenta", &ColorPalette::magenta},
+    {"orange", &ColorPalette::orange},
+    {"purple", &ColorPalette::purple},
+    {"red", &ColorPalette::red},
+    {"yellow", &ColorPalette::yellow},
+    {"cyan", &ColorPalette::cyan},
+}};
+
+size_t colorHash(const ColorLike &color, size_t seed) {
+  auto points = [](const std::vector<QColor> &points, size_t seed) {
+    for (const auto &point : points) {
+      seed = qHash(static_cast<quint64>(point.rgba64()), seed);
+    }
+
+    return seed;
+  };
+
+  seed = qHash(color.index(), seed);
+
+  // clang-format off
+  return std::visit(overloads {
+    [&](const QColor &color) { return qHash(static_cast<quint64>(color.rgba64()), seed); },
+    [&](const ThemeLinearGradient &gradient) { return points(gradient.points, seed); },
+    [&](const ThemeRadialGradient &gradient) { return points(gradient.points, seed); },
+    [&](SemanticColor tint) { return qHash(static_cast<int>(tint), seed); }
+  }, color);
+  // clang-format on
+}
+
 QColor ThemeInfo::resolveTint(SemanticColor tint) const {
   switch (tint) {
   // Basic palette
@@ -364,54 +402,9 @@ ThemeInfo ThemeInfo::fromParsed(const ParsedThemeData &scheme) {
 }
 
 void ThemeService::setTheme(const ThemeInfo &info) {
-  m_theme = info;
-
-  double mainInputSize = std::round(m_baseFontPointSize * 1.20);
-
-  TemplateEngine engine;
-
-  engine.setVar("FONT_SIZE", QString::number(m_baseFontPointSize));
-  engine.setVar("INPUT_BORDER_COLOR", info.colors.border.name());
-  engine.setVar("INPUT_FOCUS_BORDER_COLOR", info.colors.inputBorderFocus.name());
-  engine.setVar("SEARCH_FONT_SIZE", QString::number(mainInputSize));
-
-  /**
-   * We try to not use stylesheets directly in most of the app, but some very high level
-   * rules can help fix issues that would be hard to fix otherwise.
-   */
-  auto style = engine.build(R"(
-  		QWidget {
-			font-size: {FONT_SIZE}pt;
-		}
-
-		QLineEdit, QTextEdit, QPlainTextEdit {
-			background-color: transparent;
-			border: none;
- 		}
-
-		QWidget[form-input="true"] {
-		    border: 2px solid {INPUT_BORDER_COLOR};
-			border-radius: 5px;
-		}
-
-		QLineEdit[form-input="true"]:focus {
-			border-color: {INPUT_FOCUS_BORDER_COLOR};
-		}
-
-		QPlainTextEdit[form-input="true"]:focus {
-			border-color: {INPUT_FOCUS_BORDER_COLOR};
-		}
-
-		QLineEdit[search-input="true"] {
-			font-size: {SEARCH_FONT_SIZE}pt;
-		}
+  Timer timer;
 
-		QScrollArea, 
-		QScrollArea > QWidget,
-		QScrollArea > QWidget > QWidget { 
-			background: transparent; 
-		}
-		)");
+  m_theme = info;
 
   auto palette = QApplication::palette();
 
@@ -432,11 +425,14 @@ void ThemeService::setTheme(const ThemeInfo &info) {
 
   QApplication::setPalette(palette);
 
-  Timer timer;
-  qApp->setStyleSheet(style);
-  timer.time("Theme changed");
-
   emit themeChanged(info);
+
+  // everything else resolves theme colors as it paints
+  for (auto widget : QApplication::topLevelWidgets()) {
+    widget->update();
+  }
+
+  timer.time("Theme changed");
 }
 
 void ThemeService::registerBuiltinThemes() {
@@ -473,9 +469,10 @@ void ThemeService::upsertTheme(const ParsedThemeData &data) {
 void ThemeService::scanThemeDirectories() {
   auto configThemes = Omnicast::configDir() / "themes";
   auto dataThemes = Omnicast::dataDir() / "themes";
+  std::vector<ThemeCatalogEntry> catalog;
 
-  scanThemeDirectory(configThemes);
-  scanThemeDirectory(dataThemes);
+  scanThemeDirectory(configThemes, catalog);
+  scanThemeDirectory(dataThemes, catalog);
 
   for (const auto dir : Omnicast::xdgDataDirs()) {
     fs::path themeDir = dir / "vicinae" / "themes";
@@ -483,11 +480,21 @@ void ThemeService::scanThemeDirectories() {
 
     if (!fs::is_directory(themeDir, ec)) continue;
 
-    scanThemeDirectory(themeDir);
+    scanThemeDirectory(themeDir, catalog);
   }
+
+  bool changed = !std::ranges::equal(catalog, m_catalog, [](auto &&a, auto &&b) {
+    return a.path == b.path && a.mtime == b.mtime && a.size == b.size;
+  });
+
+  m_catalog = std::move(catalog);
+  registerCatalog();
+
+  if (changed) { saveCatalog(); }
 }
 
-void ThemeService::scanThemeDirectory(const std::filesystem::path &path) {
+void ThemeService::scanThemeDirectory(const std::filesystem::path &path,
+                                      std::vector<ThemeCatalogEntry> &catalog) const {
   std::error_code ec;
   std::stack<std::filesystem::path> dirs;
 
@@ -508,66 +515,208 @@ void ThemeService::scanThemeDirectory(const std::filesystem::path &path) {
 
       if (!isJson) continue;
 
-      QFile file(entry.path());
+      std::error_code statError;
+      ThemeCatalogEntry cataloged{.path = entry.path(),
+                                  .mtime = entry.last_write_time(statError),
+                                  .size = entry.file_size(statError)};
+      auto previous = std::ranges::find_if(m_catalog, [&](auto &&e) { return e.path == cataloged.path; });
 
-      if (!file.open(QIODevice::ReadOnly)) {
-        qCritical() << "Theme: failed to open" << entry.path() << "for reading";
+      if (!statError && previous != m_catalog.end() && previous->mtime == cataloged.mtime &&
+          previous->size == cataloged.size) {
+        catalog.emplace_back(*previous);
         continue;
       }
 
-      QJsonParseError error;
-      auto json = QJsonDocument::fromJson(file.readAll(), &error);
-
-      if (error.error != QJsonParseError::NoError) {
-        qCritical() << "Failed to parse" << entry.path() << "as JSON: " << error.errorString();
-        continue;
+      if (auto theme = parseThemeFile(entry.path(), dir)) {
+        cataloged.data = std::move(*theme);
+        catalog.emplace_back(std::move(cataloged));
       }
+    }
+  }
+}
 
-      QJsonObject obj = json.object();
-      ParsedThemeData theme;
+std::optional<ParsedThemeData> ThemeService::parseThemeFile(const fs::path &path, const fs::path &dir) {
+  QFile file(path);
 
-      theme.id = QString::fromStdString(entry.path().filename().string());
-      theme.appearance = obj.value("appearance").toString();
-      theme.name = obj.value("name").toString();
-      theme.description = obj.value("description").toString();
+  if (!file.open(QIODevice::ReadOnly)) {
+    qCritical() << "Theme: failed to open" << path << "for reading";
+    return std::nullopt;
+  }
 
-      if (theme.name.isEmpty()) {
-        qCritical() << "Ignoring theme" << entry.path() << "=> missing name field";
-        continue;
-      }
+  QJsonParseError error;
+  auto json = QJsonDocument::fromJson(file.readAll(), &error);
 
-      if (obj.contains("icon")) {
-        QString rawIcon = obj.value("icon").toString();
+  if (error.error != QJsonParseError::NoError) {
+    qCritical() << "Failed to parse" << path << "as JSON: " << error.errorString();
+    return std::nullopt;
+  }
 
-        if (rawIcon.isEmpty()) { qWarning() << "'icon' field specified but empty"; }
+  QJsonObject obj = json.object();
+  ParsedThemeData theme;
 
-        // assuming absolute path
-        if (rawIcon.startsWith("/")) {
-          theme.icon = rawIcon.toStdString();
-        } else {
-          theme.icon = dir / rawIcon.toStdString();
-        }
-      }
+  theme.id = QString::fromStdString(path.filename().string());
+  theme.appearance = obj.value("appearance").toString();
+  theme.name = obj.value("name").toString();
+  theme.description = obj.value("description").toString();
+
+  if (theme.name.isEmpty()) {
+    qCritical() << "Ignoring theme" << path << "=> missing name field";
+    return std::nullopt;
+  }
+
+  if (obj.contains("icon")) {
+    QString rawIcon = obj.value("icon").toString();
+
+    if (rawIcon.isEmpty()) { qWarning() << "'icon' field specified but empty"; }
+
+    // assuming absolute path
+    if (rawIcon.startsWith("/")) {
+      theme.icon = rawIcon.toStdString();
+    } else {
+      theme.icon = dir / rawIcon.toStdString();
+    }
+  }
+
+  auto colors = obj.value("palette").toObject();
+
+  // TODO: use default value for missing colors
+  for (const auto &[key, color] : PALETTE_COLORS) {
+    theme.palette.*color = colors.value(key).toString();
+  }
+
+  return theme;
+}
+
+QString ThemeService::catalogPath() {
+  return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/omnicast/theme-catalog.json";
+}
+
+bool ThemeService::loadCatalog() {
+  QFile file(catalogPath());
+
+  if (!file.open(QIODevice::ReadOnly)) return false;
+
+  QJsonParseError error;
+  auto json = QJsonDocument::fromJson(file.readAll(), &error).object();
+
+  if (error.error != QJsonParseError::NoError || json.value("version").toInt() != CATALOG_VERSION) {
+    qWarning() << "Ignoring invalid theme catalog" << file.fileName();
+    return false;
+  }
+
+  m_catalog.clear();
+
+  for (const auto &value : json.value("themes").toArray()) {
+    auto obj = value.toObject();
+    auto palette = obj.value("palette").toObject();
+    ThemeCatalogEntry entry;
+
+    entry.path = obj.value("path").toString().toStdString();
+    entry.mtime = fs::file_time_type(fs::file_time_type::duration(obj.value("mtime").toInteger()));
+    entry.size = obj.value("size").toInteger();
+    entry.data.id = obj.value("id").toString();
+    entry.data.appearance = obj.value("appearance").toString();
+    entry.data.name = obj.value("name").toString();
+    entry.data.description = obj.value("description").toString();
+
+    if (auto icon = obj.value("icon"); icon.isString()) { entry.data.icon = icon.toString().toStdString(); }
+
+    for (const auto &[key, color] : PALETTE_COLORS) {
+      entry.data.palette.*color = palette.value(key).toString();
+    }
+
+    m_catalog.emplace_back(std::move(entry));
+  }
+
+  registerCatalog();
+
+  return true;
+}
+
+void ThemeService::saveCatalog() const {
+  QJsonArray themes;
+
+  for (const auto &entry : m_catalog) {
+    QJsonObject palette;
+    QJsonObject obj;
+
+    for (const auto &[key, color] : PALETTE_COLORS) {
+      const QColor &value = entry.data.palette.*color;
+
+      // invalid colors would come back black
+      palette[key] = value.isValid() ? value.name(QColor::HexArgb) : QString();
+    }
+
+    obj["path"] = QString::fromStdString(entry.path.string());
+    obj["mtime"] = static_cast<qint64>(entry.mtime.time_since_epoch().count());
+    obj["size"] = static_cast<qint64>(entry.size);
+    obj["id"] = entry.data.id;
+    obj["appearance"] = entry.data.appearance;
+    obj["name"] = entry.data.name;
+    obj["description"] = entry.data.description;
+    obj["palette"] = palette;
+
+    if (entry.data.icon) { obj["icon"] = QString::fromStdString(entry.data.icon->string()); }
+
+    themes.append(obj);
+  }
+
+  QString path = catalogPath();
+  QSaveFile out(path);
+
+  QDir().mkpath(QFileInfo(path).absolutePath());
+
+  if (!out.open(QIODevice::WriteOnly)) {
+    qWarning() << "Failed to open theme catalog for writing" << out.errorString();
+    return;
+  }
+
+  out.write(QJsonDocument(QJsonObject{{"version", CATALOG_VERSION}, {"themes", themes}}).toJson());
+
+  if (!out.commit()) { qWarning() << "Failed to write theme catalog" << out.errorString(); }
+}
+
+void ThemeService::registerCatalog() {
+  m_themes.clear();
+  registerBuiltinThemes();
 
-      auto colors = obj.value("palette").toObject();
+  for (const auto &entry : m_catalog) {
+    upsertTheme(entry.data);
+  }
+}
 
-      // TODO: use default value for missing colors
-      theme.palette.background = colors.value("background").toString();
-      theme.palette.foreground = colors.value("foreground").toString();
-      theme.palette.blue = colors.value("blue").toString();
-      theme.palette.green = colors.value("green").toString();
-      theme.palette.magenta = colors.value("magenta").toString();
-      theme.palette.orange = colors.value("orange").toString();
-      theme.palette.purple = colors.value("purple").toString();
-      theme.palette.red = colors.value("red").toString();
-      theme.palette.yellow = colors.value("yellow").toString();
-      theme.palette.cyan = colors.value("cyan").toString();
+std::optional<ThemeInfo> ThemeService::resolveTheme(const QString &name) {
+  auto theme = findTheme(name);
+  auto entry = std::ranges::find_if(m_catalog, [&](auto &&e) { return theme && e.data.id == theme->id; });
 
-      upsertTheme(theme);
+  // builtin theme
+  if (theme && entry == m_catalog.end()) return theme;
+
+  if (theme) {
+    std::error_code ec;
+    auto mtime = fs::last_write_time(entry->path, ec);
+    auto size = ec ? 0 : fs::file_size(entry->path, ec);
 
-      // use default
+    if (!ec && mtime == entry->mtime && size == entry->size) return theme;
+
+    // only the themes that are set are parsed again, the others once they are listed
+    if (!ec) {
+      if (auto data = parseThemeFile(entry->path, entry->path.parent_path())) {
+        entry->mtime = mtime;
+        entry->size = size;
+        entry->data = std::move(*data);
+        upsertTheme(entry->data);
+        saveCatalog();
+
+        return findTheme(name);
+      }
     }
   }
+
+  // the catalog is out of date
+  scanThemeDirectories();
+
+  return findTheme(name);
 }
 
 std::vector<ParsedThemeData> ThemeService::loadColorSchemes() const {
@@ -634,7 +783,17 @@ double ThemeService::pointSize(TextSize size) const {
   return m_baseFontPointSize;
 }
 
-void ThemeService::setFontBasePointSize(double pointSize) { m_baseFontPointSize = pointSize; }
+void ThemeService::setFontBasePointSize(double pointSize) {
+  m_baseFontPointSize = pointSize;
+  setFontFamily(QApplication::font().family());
+}
+
+void ThemeService::setFontFamily(const QString &family) {
+  QFont font(family);
+
+  font.setPointSizeF(m_baseFontPointSize);
+  QApplication::setFont(font);
+}
 
 void ThemeService::reloadCurrentTheme() { setTheme(m_theme.id); }
 
@@ -647,7 +806,7 @@ std::optional<ThemeInfo> ThemeService::theme(const QString &name) const {
 }
 
 bool ThemeService::setTheme(const QString &name) {
-  if (auto theme = findTheme(name)) {
+  if (auto theme = resolveTheme(name)) {
     setTheme(*theme);
     return true;
   }
@@ -660,7 +819,29 @@ const ThemeInfo &ThemeService::theme() const { return m_theme; }
 ColorLike ThemeService::getTintColor(SemanticColor tint) const { return m_theme.resolveTint(tint); }
 
 ThemeService::ThemeService() {
-  registerBuiltinThemes();
-  scanThemeDirectories();
+  /**
+   * We try to not use stylesheets directly in most of the app, but some very high level
+   * rules can help fix issues that would be hard to fix otherwise.
+   * These rules do not depend on the theme: setting a stylesheet has every widget polished again,
+   * so it is only done once. Theme colors come from the palette or are resolved at paint time.
+   */
+  qApp->setStyleSheet(R"(
+		QLineEdit, QTextEdit, QPlainTextEdit {
+			background-color: transparent;
+			border: none;
+ 		}
+
+		QScrollArea, 
+		QScrollArea > QWidget,
+		QScrollArea > QWidget > QWidget { 
+			background: transparent; 
+		}
+		)");
+
+  setFontBasePointSize(m_baseFontPointSize);
+
+  // the directories are only scanned once the themes are listed, or if there is no catalog yet
+  if (!loadCatalog()) { scanThemeDirectories(); }
+
   setTheme("vicinae-dark");
 }
@@ -3,215 +3,195 @@
 #include <cstdint>
 #include <functional>
 #include <libqalculate/includes.h>
+#include "lib/text-tokenizer.hpp"
 #include <memory>
+#include <string>
 #include <string_view>
-#include <unordered_map>
 #include <unordered_set>
-#include <variant>
 #include <vector>
-#define TRIE_LINEAR_CAP 32
 
+/**
+ * Compressed (radix) trie used for prefix based search.
+ *
+ * Chains of nodes with a single child are merged into a single edge labeled with the whole
+ * substring, which considerably reduces the number of nodes for typical keyword sets.
+ *
+ * Nodes, edge labels and matches each live in a single contiguous arena and reference each other
+ * by index: children are stored as a linked list of siblings and matches as a linked list of match
+ * slots. Indexing a string performs no per node heap allocation, apart from the occasional arena
+ * growth.
+ */
 template <typename T, typename Hash = std::hash<T>> class Trie {
-  // XXX - Implement compression later on
-  struct CompressedNode {};
+  static constexpr uint32_t NONE = UINT32_MAX;
+  static constexpr uint32_t ROOT = 0;
 
   struct Node {
-    struct CharNode {
-      uint8_t ch;
-      std::unique_ptr<Node> node;
-
-      static CharNode fromChar(uint8_t ch) {
-        CharNode node;
-
-        node.ch = ch;
-        node.node = std::make_unique<Node>();
-
-        return node;
-      }
-    };
-
-    using NodeMap = std::unordered_map<uint8_t, std::unique_ptr<Node>>;
-    using NodeList = std::vector<CharNode>;
-    using Empty = std::monostate;
-    using Data = std::variant<Empty, CharNode, NodeList, NodeMap>;
+    // label of the edge leading to this node, stored in m_labels
+    uint32_t labelOffset = 0;
+    uint32_t labelLength = 0;
+    uint32_t firstChild = NONE;
+    uint32_t nextSibling = NONE;
+    uint32_t firstMatch = NONE;
+  };
 
-    Data data;
-    std::vector<T> matches;
-    uint8_t npath = 0;
+  struct Match {
+    T value;
+    uint32_t next = NONE;
   };
 
-  size_t memUsage = 0;
-  Node m_root;
-  bool m_compression;
+  std::vector<Node> m_nodes{Node{}};
+  std::vector<Match> m_matches;
+  std::string m_labels;
+
+  // scratch buffers reused across calls to indexLatinText, so that tokenizing does not allocate
+  std::string m_tokenBuffer;
+  std::vector<TextSpan> m_tokens;
 
   /**
-   * Tokenizes a string based on:
-   * - Whitespace boundaries
-   * - Case changes (camelCase -> camel Case)
-   * - Non-alphanumeric boundaries
+   * Tokenize `s` using the shared text tokenizer. Tokens are views into the internal scratch buffer and are
+   * only valid until the next call.
    */
-  std::vector<std::string_view> splitWords(std::string_view view) {
-    // Define character types for our state machine
-    enum TrieCharType { CharTypeLower, CharTypeUpper, CharTypeDigit, CharTypeSpace, CharTypeOther };
-
-    std::vector<std::string_view> words;
-    words.reserve(view.size() / 4); // Estimate average word length of 4
-
-    if (view.empty()) { return words; }
-
-    size_t wordStart = 0;
-    TrieCharType prevType = CharTypeSpace;
-
-    for (size_t i = 0; i < view.size(); ++i) {
-      char ch = view[i];
-      TrieCharType currentType;
-
-      // Determine current character type
-      if (std::islower(ch))
-        currentType = CharTypeLower;
-      else if (std::isupper(ch))
-        currentType = CharTypeUpper;
-      else if (std::isdigit(ch))
-        currentType = CharTypeDigit;
-      else if (std::isspace(ch))
-        currentType = CharTypeSpace;
-      else
-        currentType = CharTypeOther;
-
-      // Check for word boundaries based on state transitions
-      bool isWordBoundary = false;
-
-      if (currentType == CharTypeSpace && prevType == CharTypeSpace) {
-        wordStart += 1;
-        continue;
-      }
+  std::vector<TextSpan> &tokenize(std::string_view s) {
+    m_tokenBuffer.clear();
+    m_tokens.clear();
+    TextTokenizer::tokenize(s, m_tokenBuffer, m_tokens);
 
-      if (currentType == CharTypeSpace) {
-        // Space after non-space creates a boundary
-        isWordBoundary = (prevType != CharTypeSpace);
-      } else if (currentType == CharTypeOther) {
-        // Non-alphanumeric creates a boundary
-        isWordBoundary = (prevType != CharTypeSpace && prevType != CharTypeOther);
-      } else if (currentType == CharTypeUpper && prevType == CharTypeLower) {
-        // camelCase transition creates a boundary
-        isWordBoundary = true;
-      }
+    return m_tokens;
+  }
 
-      // Handle word boundary
-      if (isWordBoundary) {
-        // Add word if it has content
-        if (i > wordStart) { words.emplace_back(view.substr(wordStart, i - wordStart)); }
+  std::string_view token(const TextSpan &span) const {
+    return std::string_view(m_tokenBuffer).substr(span.offset, span.length);
+  }
 
-        // Skip consecutive spaces or non-alphanumeric chars
-        if (currentType == CharTypeSpace || currentType == CharTypeOther) {
-          wordStart = i + 1;
-        } else {
-          wordStart = i;
-        }
-      } else {
-      }
+  std::string_view label(const Node &node) const {
+    return std::string_view(m_labels).substr(node.labelOffset, node.labelLength);
+  }
 
-      prevType = currentType;
+  uint32_t findChild(uint32_t node, char ch) const {
+    for (uint32_t child = m_nodes[node].firstChild; child != NONE; child = m_nodes[child].nextSibling) {
+      if (m_labels[m_nodes[child].labelOffset] == ch) return child;
     }
 
-    // Add the last word if needed
-    if (wordStart < view.size()) { words.emplace_back(view.substr(wordStart)); }
-
-    return words;
+    return NONE;
   }
 
-  const Node *findStartNode(std::string_view prefix) const {
-    const Node *cur = &m_root;
-
-    for (char ch : prefix) {
-      auto index = static_cast<uint8_t>(tolower(ch));
+  /**
+   * Walk down the trie following `key`.
+   * If `exact` is true, the key has to end exactly on a node. Otherwise, the key is allowed to end
+   * in the middle of an edge, in which case the node the edge leads to is returned.
+   */
+  uint32_t walk(std::string_view key, bool exact) const {
+    uint32_t cur = ROOT;
+    size_t pos = 0;
 
-      if (auto charNode = std::get_if<typename Node::CharNode>(&cur->data)) {
-        if (charNode->ch == index) {
-          cur = charNode->node.get();
-          continue;
-        }
-      }
+    while (pos < key.size()) {
+      uint32_t child = findChild(cur, key[pos]);
 
-      if (auto list = std::get_if<typename Node::NodeList>(&cur->data)) {
-        auto it = std::ranges::find_if(*list, [index](const auto &charNode) { return charNode.ch == index; });
+      if (child == NONE) return NONE;
 
-        if (it != list->end()) {
-          cur = it->node.get();
-          continue;
-        }
-      }
+      std::string_view edge = label(m_nodes[child]);
+      std::string_view rest = key.substr(pos);
+      size_t common = std::ranges::mismatch(edge, rest).in1 - edge.begin();
 
-      if (auto map = std::get_if<typename Node::NodeMap>(&cur->data)) {
-        if (auto it = map->find(index); it != map->end()) {
-          cur = it->second.get();
-          continue;
-        }
+      if (common < edge.size()) {
+        if (exact || common < rest.size()) return NONE;
+        return child;
       }
 
-      return {};
+      cur = child;
+      pos += common;
     }
 
     return cur;
   }
 
-  Node *findStartNode(std::string_view prefix) {
-    Node *cur = &m_root;
+  uint32_t createNode(uint32_t offset, uint32_t length) {
+    m_nodes.push_back({.labelOffset = offset, .labelLength = length});
+    return m_nodes.size() - 1;
+  }
+
+  /**
+   * Append `child` to the children of `parent`.
+   */
+  void link(uint32_t parent, uint32_t child) {
+    uint32_t *slot = &m_nodes[parent].firstChild;
 
-    for (char ch : prefix) {
-      auto index = static_cast<uint8_t>(tolower(ch));
+    while (*slot != NONE) {
+      slot = &m_nodes[*slot].nextSibling;
+    }
 
-      if (auto charNode = std::get_if<typename Node::CharNode>(&cur->data)) {
-        if (charNode->ch == index) {
-          cur = charNode->node.get();
-          continue;
-        }
-      }
+    *slot = child;
+  }
 
-      if (auto list = std::get_if<typename Node::NodeList>(&cur->data)) {
-        auto it = std::ranges::find_if(*list, [index](const auto &charNode) { return charNode.ch == index; });
+  /**
+   * Split the edge leading to `node` after `at` characters. `node` keeps the first part of the label,
+   * while its children and matches are moved to a new node labeled with the remaining part.
+   */
+  void split(uint32_t node, uint32_t at) {
+    const Node &original = m_nodes[node];
+    uint32_t tail = createNode(original.labelOffset + at, original.labelLength - at);
+    Node &head = m_nodes[node]; // createNode may have reallocated the arena
+
+    m_nodes[tail].firstChild = head.firstChild;
+    m_nodes[tail].firstMatch = head.firstMatch;
+    head.labelLength = at;
+    head.firstChild = tail;
+    head.firstMatch = NONE;
+  }
 
-        if (it != list->end()) {
-          cur = it->node.get();
-          continue;
-        }
-      }
+  void insert(std::string_view s, const T &data) {
+    if (s.empty()) return;
 
-      if (auto map = std::get_if<typename Node::NodeMap>(&cur->data)) {
-        if (auto it = map->find(index); it != map->end()) {
-          cur = it->second.get();
-          continue;
-        }
+    uint32_t cur = ROOT;
+    size_t pos = 0;
+
+    while (pos < s.size()) {
+      std::string_view rest = s.substr(pos);
+      uint32_t child = findChild(cur, rest.front());
+
+      if (child == NONE) {
+        uint32_t node = createNode(m_labels.size(), rest.size());
+
+        m_labels.append(rest);
+        link(cur, node);
+        cur = node;
+        break;
       }
 
-      return {};
+      std::string_view edge = label(m_nodes[child]);
+      size_t common = std::ranges::mismatch(edge, rest).in1 - edge.begin();
+
+      if (common < edge.size()) { split(child, common); }
+
+      cur = child;
+      pos += common;
     }
 
-    return cur;
-  }
+    uint32_t last = NONE;
 
-  void traversePaths(const Node *node, const std::function<void(const Node *)> &fn) const {
-    std::vector<const Node *> paths;
+    for (uint32_t match = m_nodes[cur].firstMatch; match != NONE; match = m_matches[match].next) {
+      if (m_matches[match].value == data) return;
+      last = match;
+    }
 
-    paths.push_back(node);
+    // no pointer into the match arena can be held across the push
+    m_matches.push_back({.value = data});
 
-    while (!paths.empty()) {
-      const Node *node = paths[paths.size() - 1];
+    uint32_t &slot = last == NONE ? m_nodes[cur].firstMatch : m_matches[last].next;
 
-      paths.pop_back();
-      paths.reserve(paths.size() + node->npath);
-      fn(node);
-
-      if (auto charNode = std::get_if<typename Node::CharNode>(&node->data)) {
-        paths.push_back(charNode->node.get());
-      } else if (auto list = std::get_if<typename Node::NodeList>(&node->data)) {
-        for (const auto &charNode : *list) {
-          paths.push_back(charNode.node.get());
-        }
-      } else if (auto map = std::get_if<typename Node::NodeMap>(&node->data)) {
-        for (const auto &[ch, node] : *map) {
-          paths.push_back(node.get());
-        }
+    slot = m_matches.size() - 1;
+  }
+
+  void removeNormalized(std::string_view s, const T &data) {
+    uint32_t target = walk(s, true);
+
+    if (target == NONE) return;
+
+    // unlinked match slots are not reclaimed, removals are expected to be rare
+    for (uint32_t *slot = &m_nodes[target].firstMatch; *slot != NONE; slot = &m_matches[*slot].next) {
+      if (m_matches[*slot].value == data) {
+        *slot = m_matches[*slot].next;
+        return;
       }
     }
   }
@@ -221,12 +201,16 @@ public:
 
   Trie() {}
 
-  void clear() { m_root = {}; }
+  void clear() {
+    m_nodes.assign(1, Node{});
+    m_matches.clear();
+    m_labels.clear();
+  }
 
   bool exactMatch(std::string_view query) const {
-    const Node *cur = findStartNode(query);
+    uint32_t node = walk(TextTokenizer::normalize(query), true);
 
-    return cur && !cur->matches.empty();
+    return node != NONE && m_nodes[node].firstMatch != NONE;
   }
 
   /**
@@ -235,42 +219,31 @@ public:
    */
   void prefixTraverse(std::string_view prefix, const std::function<void(const T &)> &fn,
                       int limit = 1000) const {
-    const Node *start = findStartNode(prefix);
+    uint32_t start = walk(TextTokenizer::normalize(prefix), false);
 
-    if (!start) return;
+    if (start == NONE) return;
 
-    std::unordered_set<size_t> m_visited;
-    std::vector<const Node *> paths;
+    std::unordered_set<size_t> visited;
+    std::vector<uint32_t> paths;
 
     paths.push_back(start);
 
     while (!paths.empty()) {
-      const Node *node = paths[paths.size() - 1];
+      const Node &node = m_nodes[paths.back()];
 
       paths.pop_back();
-      paths.reserve(paths.size() + node->npath);
 
-      for (const auto &match : node->matches) {
-        size_t key = Hash()(match);
-        bool exists = std::ranges::find(m_visited, key) != m_visited.end();
+      for (uint32_t match = node.firstMatch; match != NONE; match = m_matches[match].next) {
+        const T &value = m_matches[match].value;
 
-        if (!exists) {
-          fn(match);
-          m_visited.insert(key);
-          if (m_visited.size() >= limit) return;
+        if (visited.insert(Hash()(value)).second) {
+          fn(value);
+          if (visited.size() >= limit) return;
         }
       }
 
-      if (auto charNode = std::get_if<typename Node::CharNode>(&node->data)) {
-        paths.push_back(charNode->node.get());
-      } else if (auto list = std::get_if<typename Node::NodeList>(&node->data)) {
-        for (const auto &charNode : *list) {
-          paths.push_back(charNode.node.get());
-        }
-      } else if (auto map = std::get_if<typename Node::NodeMap>(&node->data)) {
-        for (const auto &[ch, node] : *map) {
-          paths.push_back(node.get());
-        }
+      for (uint32_t child = node.firstChild; child != NONE; child = m_nodes[child].nextSibling) {
+        paths.push_back(child);
       }
     }
   }
@@ -281,7 +254,15 @@ public:
    * If you have a lot to remove, rebuilding the trie anew is probably best.
    */
   void erase(const T &value) {
-    traversePaths(m_root, [&](const Node *node) { std::ranges::remove(node->matches, value); });
+    for (auto &node : m_nodes) {
+      for (uint32_t *slot = &node.firstMatch; *slot != NONE;) {
+        if (m_matches[*slot].value == value) {
+          *slot = m_matches[*slot].next;
+        } else {
+          slot = &m_matches[*slot].next;
+        }
+      }
+    }
   }
 
   std::vector<T> prefixSearch(std::string_view prefix, int limit = 1000) const {
@@ -294,118 +275,43 @@ public:
 
   /**
    * Splits the text into words and then index each one separately.
+   * See `TextTokenizer` for how words are delimited and normalized.
    */
   void indexLatinText(std::string_view s, const T &data) {
-    for (const auto &word : splitWords(s)) {
-      index(word, data);
+    for (const auto &span : tokenize(s)) {
+      insert(token(span), data);
     }
   }
 
   void removeLatinTextItem(std::string_view s, const T &data) {
-    for (const auto &word : splitWords(s)) {
-      removeItem(word, data);
+    for (const auto &span : tokenize(s)) {
+      removeNormalized(token(span), data);
     }
   }
 
-  void removeItem(std::string_view s, const T &data) {
-    Node *target = findStartNode(s);
+  void removeItem(std::string_view s, const T &data) { removeNormalized(TextTokenizer::normalize(s), data); }
 
-    if (!target) return;
+  /**
+   * Index the whole string as a single word.
+   */
+  void index(std::string_view s, const T &data) { insert(TextTokenizer::normalize(s), data); }
 
-    if (auto it = std::ranges::find(target->matches, data); it != target->matches.end()) {
-      target->matches.erase(it);
-    }
+  /**
+   * Release the unused capacity of the arenas. Meant to be called once the initial set of items
+   * has been indexed.
+   */
+  void shrinkToFit() {
+    m_nodes.shrink_to_fit();
+    m_matches.shrink_to_fit();
+    m_labels.shrink_to_fit();
   }
 
-  void index(std::string_view s, const T &data) {
-    if (s.empty()) return;
-
-    Node *cur = &m_root;
-
-    for (char ch : s) {
-      uint8_t idx = static_cast<uint8_t>(tolower(ch));
-
-      if (std::holds_alternative<std::monostate>(cur->data)) {
-        auto charNode = Node::CharNode::fromChar(idx);
-        auto ptr = charNode.node.get();
-
-        cur->data = std::move(charNode);
-        cur->npath = 1;
-        cur = ptr;
-        memUsage += sizeof(Node);
-      }
-
-      else if (auto charNode = std::get_if<typename Node::CharNode>(&cur->data)) {
-        if (idx == charNode->ch) {
-          cur = charNode->node.get();
-          continue;
-        }
-
-        typename Node::NodeList list;
-        auto newNode = Node::CharNode::fromChar(idx);
-        auto newCur = newNode.node.get();
-
-        list.reserve(2);
-        list.emplace_back(std::move(*charNode));
-        list.emplace_back(std::move(newNode));
-        cur->data = std::move(list);
-        cur->npath++;
-
-        cur = newCur;
-      }
-
-      else if (auto list = std::get_if<typename Node::NodeList>(&cur->data)) {
-        auto it = std::ranges::find_if(*list, [idx](const auto &charNode) { return charNode.ch == idx; });
-
-        if (it != list->end()) {
-          cur = it->node.get();
-          continue;
-        }
+  size_t nodeCount() const { return m_nodes.size(); }
 
-        if (list->size() < TRIE_LINEAR_CAP) {
-          auto newNode = Node::CharNode::fromChar(idx);
-          auto newCur = newNode.node.get();
-
-          list->emplace_back(std::move(newNode));
-          cur->npath++;
-          cur = newCur;
-          continue;
-        }
-
-        typename Node::NodeMap map;
-        memUsage += sizeof(map);
-
-        auto newNode = std::make_unique<Node>();
-        auto nodePtr = newNode.get();
-
-        for (auto &charNode : *list) {
-          map[charNode.ch] = std::move(charNode.node);
-        }
-
-        map[idx] = std::move(newNode);
-        cur->data = std::move(map);
-        cur->npath++;
-        cur = nodePtr;
-        continue;
-      }
-
-      else if (auto map = std::get_if<typename Node::NodeMap>(&cur->data)) {
-        if (auto it = map->find(idx); it != map->end()) {
-          cur = it->second.get();
-          continue;
-        }
-
-        auto newNode = std::make_unique<Node>();
-        auto nodePtr = newNode.get();
-
-        map->insert({idx, std::move(newNode)});
-        cur->npath++;
-        cur = nodePtr;
-      }
-    }
-
-    if (std::ranges::find(cur->matches, data) == cur->matches.end()) { cur->matches.emplace_back(data); }
-
-    memUsage += sizeof(T) * cur->matches.capacity();
+  /**
+   * Approximate heap memory used by the trie, in bytes.
+   */
+  size_t memUsage() const {
+    return m_nodes.capacity() * sizeof(Node) + m_matches.capacity() * sizeof(Match) + m_labels.capacity();
   }
 };
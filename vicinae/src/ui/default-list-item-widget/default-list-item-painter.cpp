@@ -0,0 +1,198 @@
+#include "ui/default-list-item-widget/default-list-item-painter.hpp"
+#include "theme.hpp"
+#include "ui/image/image-cache.hpp"
+#include "ui/text-layout-cache/text-layout-cache.hpp"
+#include <cmath>
+#include <qfontmetrics.h>
+
+static constexpr int ICON_SIZE = 25;
+static constexpr int ACCESSORY_ICON_SIZE = 16;
+static constexpr int SPACING = 15;
+static constexpr int ACCESSORY_SPACING = 6;
+static constexpr QMargins MARGINS(10, 8, 10, 8);
+static constexpr QMargins ACCESSORY_MARGINS(6, 3, 6, 3);
+
+DefaultListItemPainter &DefaultListItemPainter::instance() {
+  static DefaultListItemPainter painter;
+
+  return painter;
+}
+
+void DefaultListItemPainter::load(const ImageCacheKey &key, const ImageURL &url) {
+  auto &image = m_images[key];
+  auto loader = createImageLoader(url);
+
+  image.loader.reset(loader);
+
+  auto handleError = [this, key, loader, url]() {
+    auto it = m_images.find(key);
+
+    // the image was evicted or is already being loaded from its fallback
+    if (it == m_images.end() || it->second.loader.get() != loader) return;
+
+    auto fallback = url.fallback().value_or(ImageURL::builtin("question-mark-circle"));
+
+    if (fallback == url) return;
+
+    load(key, fallback);
+  };
+
+  if (!loader) return handleError();
+
+  connect(loader, &AbstractImageLoader::dataUpdated, this, [this, key, loader](const QPixmap &pixmap) {
+    auto it = m_images.find(key);
+
+    if (it == m_images.end() || it->second.loader.get() != loader) return;
+
+    it->second.pixmap = pixmap;
+    emit imageLoaded();
+  });
+  connect(loader, &AbstractImageLoader::errorOccured, this, handleError);
+  loader->render(key.config);
+}
+
+void DefaultListItemPainter::drawImage(OmniPainter &painter, const ImageURL &url, const QRect &rect) {
+  RenderConfig config{.size = rect.size(), .devicePixelRatio = painter.device()->devicePixelRatio()};
+  auto key = ImageCache::key(url, config);
+  auto it = m_images.find(key);
+
+  if (it == m_images.end()) {
+    // loading is asynchronous for most images, evicting everything keeps the entries loading sane
+    if (m_images.size() >= MAX_IMAGES) { m_images.clear(); }
+
+    load(key, url);
+    it = m_images.find(key);
+  }
+
+  auto &pixmap = it->second.pixmap;
+
+  if (pixmap.isNull()) return;
+
+  QSize logicalSize = pixmap.size() / pixmap.devicePixelRatio();
+  QRect target(rect.topLeft() + QPoint((rect.width() - logicalSize.width()) / 2,
+                                       (rect.height() - logicalSize.height()) / 2),
+               logicalSize);
+
+  painter.save();
+  painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+  painter.drawPixmap(target, pixmap, url.mask());
+  painter.restore();
+}
+
+QSize DefaultListItemPainter::accessorySize(const ListAccessory &accessory,
+                                            const QFontMetrics &metrics) const {
+  int width = ACCESSORY_MARGINS.left() + ACCESSORY_MARGINS.right();
+  int height = accessory.text.isEmpty() ? 0 : metrics.height();
+
+  if (accessory.icon) {
+    width += ACCESSORY_ICON_SIZE;
+    height = std::max(height, ACCESSORY_ICON_SIZE);
+  }
+
+  if (accessory.icon && !accessory.text.isEmpty()) { width += ACCESSORY_SPACING; }
+  if (!accessory.text.isEmpty()) { width += metrics.horizontalAdvance(accessory.text); }
+
+  return {width, height + ACCESSORY_MARGINS.top() + ACCESSORY_MARGINS.bottom()};
+}
+
+void DefaultListItemPainter::drawAccessory(OmniPainter &painter, const ListAccessory &accessory,
+                                           const QRect &rect) {
+  QRect content = rect.marginsRemoved(ACCESSORY_MARGINS);
+  int left = content.left();
+
+  if (accessory.fillBackground && accessory.color) {
+    painter.setPen(Qt::NoPen);
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    painter.fillRect(rect, *accessory.color, 6, 0.2);
+  }
+
+  if (accessory.icon) {
+    auto url = *accessory.icon;
+
+    url.setFill(accessory.color);
+    drawImage(painter, url,
+              QRect(left, content.center().y() - ACCESSORY_ICON_SIZE / 2 + 1, ACCESSORY_ICON_SIZE,
+                    ACCESSORY_ICON_SIZE));
+    left += ACCESSORY_ICON_SIZE + ACCESSORY_SPACING;
+  }
+
+  if (accessory.text.isEmpty()) return;
+
+  auto staticText = TextLayoutCache::instance().staticText(accessory.text, painter.font(),
+                                                          content.right() + 1 - left, Qt::ElideRight);
+
+  painter.setThemePen(accessory.color.value_or(SemanticColor::TextPrimary));
+  painter.drawStaticText(left, content.top() + (content.height() - staticText.size().height()) / 2,
+                         staticText);
+}
+
+void DefaultListItemPainter::paint(OmniPainter &painter, const QRect &rect,
+                                   const AbstractDefaultListItem::ItemData &data) {
+  QFont font = painter.font();
+
+  font.setPointSizeF(ThemeService::instance().pointSize(TextSize::TextRegular));
+  painter.save();
+  painter.setFont(font);
+
+  QFontMetrics metrics(font);
+  QRect content = rect.marginsRemoved(MARGINS);
+  int centerY = content.top() + content.height() / 2;
+  int left = content.left();
+  int right = content.right() + 1;
+
+  // accessories are aligned to the right, what is left of the row going to the rest of the item
+  for (auto it = data.accessories.rbegin(); it != data.accessories.rend(); ++it) {
+    QSize size = accessorySize(*it, metrics);
+
+    if (right - size.width() < left) break;
+
+    right -= size.width();
+    drawAccessory(painter, *it, QRect(QPoint(right, centerY - size.height() / 2), size));
+    right -= SPACING;
+  }
+
+  if (data.iconUrl) {
+    drawImage(painter, *data.iconUrl, QRect(left, centerY - ICON_SIZE / 2, ICON_SIZE, ICON_SIZE));
+    left += ICON_SIZE + SPACING;
+  }
+
+  auto drawText = [&](const QString &str, int width, Qt::TextElideMode mode, SemanticColor color) {
+    if (str.isEmpty() || width <= 0) return;
+
+    auto staticText = TextLayoutCache::instance().staticText(str, font, width, mode);
+
+    painter.setThemePen(color);
+    painter.drawStaticText(left, centerY - metrics.height() / 2, staticText);
+    left += std::ceil(staticText.size().width()) + SPACING;
+  };
+
+  // clang-format off
+  const auto subtitle = std::visit(overloads {
+    [](const std::filesystem::path &path) { return std::pair(QString(path.c_str()), Qt::ElideMiddle); },
+    [](const QString &text) { return std::pair(text, Qt::ElideRight); }
+  }, data.subtitle);
+  // clang-format on
+
+  ListAccessory alias{.text = data.alias, .color = SemanticColor::TextPrimary, .fillBackground = true};
+  int aliasWidth = data.alias.isEmpty() ? 0 : accessorySize(alias, metrics).width() + SPACING;
+
+  drawText(data.name, std::min<int>(metrics.horizontalAdvance(data.name), right - left), Qt::ElideRight,
+           SemanticColor::TextPrimary);
+  drawText(subtitle.first, right - left - aliasWidth, subtitle.second, SemanticColor::TextSecondary);
+
+  if (!data.alias.isEmpty() && left + aliasWidth - SPACING <= right) {
+    QSize size = accessorySize(alias, metrics);
+
+    drawAccessory(painter, alias, QRect(QPoint(left, centerY - size.height() / 2), size));
+  }
+
+  painter.restore();
+}
+
+DefaultListItemPainter::DefaultListItemPainter() {
+  // images are tinted with the colors of the theme and text is laid out with its font size
+  connect(&ThemeService::instance(), &ThemeService::themeChanged, this, [this]() {
+    m_images.clear();
+    TextLayoutCache::instance().clear();
+  });
+}
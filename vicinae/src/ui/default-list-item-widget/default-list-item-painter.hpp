@@ -0,0 +1,49 @@
+#pragma once
+#include "common.hpp"
+#include "ui/image/image.hpp"
+#include "ui/list-accessory/list-accessory.hpp"
+#include "ui/omni-list/omni-list.hpp"
+#include "ui/omni-painter/omni-painter.hpp"
+#include <QStaticText>
+#include <qobject.h>
+#include <unordered_map>
+
+/**
+ * Paints default list items the way DefaultListItemWidget lays them out, for lists that paint the rows
+ * they do not need a widget for instead of creating one for each row in view.
+ *
+ * Elided text is laid out once into a QStaticText, kept in the text layout cache, and images are loaded
+ * once for each url and size, so that painting a row again mostly comes down to blitting what was cached.
+ */
+class DefaultListItemPainter : public QObject {
+  Q_OBJECT
+
+public:
+  static DefaultListItemPainter &instance();
+
+  void paint(OmniPainter &painter, const QRect &rect, const AbstractDefaultListItem::ItemData &data);
+
+signals:
+  /**
+   * Emitted when an image that was painted before it was done loading is loaded.
+   */
+  void imageLoaded() const;
+
+private:
+  static constexpr int MAX_IMAGES = 512;
+
+  struct Image {
+    QPixmap pixmap;
+    QObjectUniquePtr<AbstractImageLoader> loader;
+  };
+
+  // keyed by everything the pixmap depends on, the fill color of the url included
+  std::unordered_map<ImageCacheKey, Image> m_images;
+
+  void load(const ImageCacheKey &key, const ImageURL &url);
+  void drawImage(OmniPainter &painter, const ImageURL &url, const QRect &rect);
+  QSize accessorySize(const ListAccessory &accessory, const QFontMetrics &metrics) const;
+  void drawAccessory(OmniPainter &painter, const ListAccessory &accessory, const QRect &rect);
+
+  DefaultListItemPainter();
+};
@@ -27,15 +27,12 @@ public:
 
 AppPickerInput::AppPickerInput(const AbstractAppDatabase *appDb) : m_appDb(appDb) {
   auto filter = [](auto &&app) { return app->displayable(); };
-  auto map = [](auto &&app) -> std::unique_ptr<OmniList::AbstractVirtualItem> {
-    return std::make_unique<AppItem>(app);
+  auto map = [](auto &&app) -> std::shared_ptr<SelectorInput::AbstractItem> {
+    return std::make_shared<AppItem>(app);
   };
 
-  list()->updateModel([&]() {
-    auto items = m_appDb->list() | std::views::filter(filter) | std::views::transform(map) |
-                 std::ranges::to<std::vector>();
-    auto &section = list()->addSection();
-
-    section.addItems(std::move(items));
-  });
+  // sections are what the default filter searches
+  addSection("", m_appDb->list() | std::views::filter(filter) | std::views::transform(map) |
+                     std::ranges::to<std::vector>());
+  updateModel();
 }
@@ -7,6 +7,7 @@
 #include <qnamespace.h>
 #include <qpainter.h>
 #include "ui/form/base-input.hpp"
+#include "ui/omni-painter/omni-painter.hpp"
 
 bool BaseInput::event(QEvent *event) { return QWidget::event(event); }
 
@@ -15,6 +16,18 @@ void BaseInput::resizeEvent(QResizeEvent *event) {
   recalculate();
 }
 
+void BaseInput::paintEvent(QPaintEvent *event) {
+  OmniPainter painter(this);
+  QRectF border = QRectF(rect()).adjusted(BORDER_WIDTH / 2.0, BORDER_WIDTH / 2.0, -BORDER_WIDTH / 2.0,
+                                          -BORDER_WIDTH / 2.0);
+
+  painter.setRenderHint(QPainter::Antialiasing);
+  painter.setThemePen(m_input->hasFocus() ? SemanticColor::InputBorderFocus : SemanticColor::Border,
+                      BORDER_WIDTH);
+  painter.setBrush(Qt::NoBrush);
+  painter.drawRoundedRect(border, BORDER_RADIUS, BORDER_RADIUS);
+}
+
 void BaseInput::recalculate() {
   QMargins margins = m_defaultTextMargins;
 
@@ -71,9 +84,11 @@ bool BaseInput::eventFilter(QObject *watched, QEvent *event) {
     switch (event->type()) {
     case QEvent::FocusIn:
       m_focusNotifier->focusChanged(true);
+      update();
       break;
     case QEvent::FocusOut:
       m_focusNotifier->focusChanged(false);
+      update();
       break;
     default:
       break;
@@ -88,7 +103,7 @@ void BaseInput::setTextMargins(const QMargins &margins) { m_defaultTextMargins =
 BaseInput::BaseInput(QWidget *parent) : leftAccessory(nullptr), rightAccessory(nullptr) {
   auto layout = new QVBoxLayout;
 
-  layout->setContentsMargins(0, 0, 0, 0);
+  layout->setContentsMargins(BORDER_WIDTH, BORDER_WIDTH, BORDER_WIDTH, BORDER_WIDTH);
   layout->addWidget(m_input);
   m_input->setFrame(false);
   m_input->installEventFilter(this);
@@ -97,8 +112,6 @@ BaseInput::BaseInput(QWidget *parent) : leftAccessory(nullptr), rightAccessory(n
   setFocusProxy(m_input);
   setAttribute(Qt::WA_TranslucentBackground);
 
-  m_input->setProperty("form-input", true); // used for border styling
-
   connect(m_input, &QLineEdit::textChanged, this, &BaseInput::textChanged);
 }
 
@@ -148,6 +148,10 @@ SelectorInput::SelectorInput(QWidget *parent)
 
   selectionIcon->hide();
 
+  m_searchThrottle->setSingleShot(true);
+  m_searchThrottle->setInterval(0);
+  connect(m_searchThrottle, &QTimer::timeout, this, [this]() { emit textChanged(searchText()); });
+
   connect(m_searchField, &QLineEdit::textChanged, this, &SelectorInput::handleTextChanged);
   connect(m_list, &OmniList::itemActivated, this, &SelectorInput::itemActivated);
   connect(m_list, &OmniList::itemUpdated, this, &SelectorInput::itemUpdated);
@@ -203,25 +207,40 @@ void SelectorInput::setEnableDefaultFilter(bool value) {
   if (value == m_defaultFilterEnabled) return;
 
   m_defaultFilterEnabled = value;
+  if (!searchText().isEmpty()) { renderSections(OmniList::PreserveSelection); }
 }
 
-void SelectorInput::handleTextChanged(const QString &text) {
-  if (m_defaultFilterEnabled) {
-    m_list->updateModel([&]() {
-      for (const auto &section : m_sections) {
-        auto results = section.search(text);
+void SelectorInput::setSearchThrottled(bool value) {
+  m_searchThrottle->setInterval(value ? SEARCH_THROTTLE_INTERVAL : std::chrono::milliseconds(0));
+}
 
-        if (results.empty()) continue;
+void SelectorInput::renderSections(OmniList::SelectionPolicy policy) {
+  QString query = m_defaultFilterEnabled ? searchText() : QString();
 
-        auto &listSection = m_list->addSection(section.title);
+  m_list->updateModel(
+      [&]() {
+        for (const auto &section : m_sections) {
+          auto items = section.search(query);
 
-        listSection.addItems(results);
-      }
-    });
+          if (items.empty() && !query.isEmpty()) continue;
+
+          m_list->addSection(section.title).addItems(std::move(items));
+        }
+      },
+      policy);
+}
+
+void SelectorInput::handleTextChanged(const QString &text) {
+  if (m_defaultFilterEnabled) { renderSections(OmniList::SelectFirst); }
 
-    // m_list->setFilter(std::make_unique<ItemFilter>(text));
+  if (m_searchThrottle->interval() == 0) {
+    m_searchThrottle->stop();
+    emit textChanged(text);
+    return;
   }
-  emit textChanged(text);
+
+  // options loaded by the handler replace the local ones, there is no use asking for them on every keystroke
+  m_searchThrottle->start();
 }
 
 void SelectorInput::itemUpdated(const OmniList::AbstractVirtualItem &item) {
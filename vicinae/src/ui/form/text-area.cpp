@@ -1,6 +1,7 @@
 #include "text-area.hpp"
 #include "common.hpp"
 #include "theme.hpp"
+#include "ui/omni-painter/omni-painter.hpp"
 #include "ui/scroll-bar/scroll-bar.hpp"
 #include "utils/layout.hpp"
 #include <QPlainTextEdit>
@@ -25,20 +26,32 @@ void TextArea::resizeEvent(QResizeEvent *event) {
   resizeArea();
 }
 
+void TextArea::paintEvent(QPaintEvent *event) {
+  OmniPainter painter(this);
+  QRectF border = QRectF(rect()).adjusted(BORDER_WIDTH / 2.0, BORDER_WIDTH / 2.0, -BORDER_WIDTH / 2.0,
+                                          -BORDER_WIDTH / 2.0);
+
+  painter.setRenderHint(QPainter::Antialiasing);
+  painter.setThemePen(m_textEdit->hasFocus() ? SemanticColor::InputBorderFocus : SemanticColor::Border,
+                      BORDER_WIDTH);
+  painter.setBrush(Qt::NoBrush);
+  painter.drawRoundedRect(border, BORDER_RADIUS, BORDER_RADIUS);
+}
+
 void TextArea::setupUI() {
   m_textEdit = new QPlainTextEdit;
   m_textEdit->setFrameShape(QFrame::NoFrame);
   m_textEdit->setVerticalScrollBar(new OmniScrollBar);
-  m_textEdit->setProperty("form-input", true);
   m_notifier->track(m_textEdit);
   setFocusProxy(m_textEdit);
   setGrowAsRequired(true);
   setTabSetFocus(true);
   setMargins(10);
   setRows(2);
-  VStack().add(m_textEdit).imbue(this);
+  VStack().add(m_textEdit).margins(BORDER_WIDTH).imbue(this);
 
   connect(m_textEdit, &QPlainTextEdit::textChanged, this, &TextArea::resizeArea);
+  connect(m_notifier, &FocusNotifier::focusChanged, this, [this]() { update(); });
 }
 
 void TextArea::setMargins(int margins) { m_textEdit->document()->setDocumentMargin(margins); }
@@ -53,7 +66,7 @@ void TextArea::resizeArea() {
     int height = std::max(minTextHeight, textHeight);
 
     setFixedHeight(height);
-    m_textEdit->setFixedHeight(height);
+    m_textEdit->setFixedHeight(height - BORDER_WIDTH * 2);
   }
 }
 
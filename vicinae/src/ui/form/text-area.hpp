@@ -44,9 +44,13 @@ public:
 
 protected:
   void resizeEvent(QResizeEvent *event) override;
+  void paintEvent(QPaintEvent *event) override;
   int heightForRowCount(int rowCount);
 
 private:
+  static constexpr int BORDER_WIDTH = 2;
+  static constexpr int BORDER_RADIUS = 5;
+
   void resizeArea();
 
   QPlainTextEdit *m_textEdit = nullptr;
@@ -8,7 +8,30 @@
 #include <qnamespace.h>
 #include <qwidget.h>
 
-void HorizontalMetadata::setMetadata(const std::vector<MetadataItem> &metadatas) {
+void HorizontalMetadata::setMetadata(const std::vector<MetadataItem> &metadatas, size_t key) {
+  if (key != 0 && key == m_key) return;
+
+  QWidget *cached = key != 0 ? m_containers.take(key) : nullptr;
+
+  if (m_key != 0 || cached) {
+    QWidget *current = takeWidget();
+
+    if (m_key != 0) {
+      m_containers.insert(m_key, current, std::max<qsizetype>(1, current->layout()->count()));
+    } else {
+      delete current;
+    }
+
+    container = cached ? cached : new QWidget;
+    setWidget(container);
+  }
+
+  m_key = key;
+
+  if (!cached) { build(container, metadatas); }
+}
+
+void HorizontalMetadata::build(QWidget *target, const std::vector<MetadataItem> &metadatas) {
   auto stack = VStack().spacing(10).margins(0, 0, 0, 0);
 
   int marginX = 10;
@@ -69,7 +92,7 @@ void HorizontalMetadata::setMetadata(const std::vector<MetadataItem> &metadatas)
     if (auto sep = std::get_if<MetadataSeparator>(&metadata)) { stack.add(new HDivider); }
   }
 
-  stack.imbue(container);
+  stack.imbue(target);
 }
 
 HorizontalMetadata::HorizontalMetadata() : container(new QWidget) { setWidget(container); }
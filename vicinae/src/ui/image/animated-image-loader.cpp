@@ -1,39 +1,35 @@
 #include "animated-image-loader.hpp"
 #include "ui/image/image.hpp"
-#include <QMovie>
-#include <qbuffer.h>
-#include <qstringview.h>
+#include <qcryptographichash.h>
 
-void AnimatedIODeviceImageLoader::render(const RenderConfig &cfg) {
-  QSize deviceSize = cfg.size * cfg.devicePixelRatio;
-
-  m_movie = std::make_unique<QMovie>();
-  m_movie->setDevice(&m_buf);
+void AnimatedIODeviceImageLoader::stop() const {
+  if (!m_playing) return;
 
-  // m_movie->setScaledSize({deviceSize.width(), -1});
-  m_movie->setCacheMode(QMovie::CacheAll);
-  connect(m_movie.get(), &QMovie::updated, this, [this, deviceSize, cfg]() {
-    auto pix = m_movie->currentPixmap();
+  disconnect(m_animation.get(), nullptr, this, nullptr);
+  AnimationCache::instance().pause(m_animation.get());
+  m_playing = false;
+}
 
-    QSize originalSize = pix.size();
-    bool isDownScalable =
-        originalSize.height() > deviceSize.height() || originalSize.width() > deviceSize.width();
+void AnimatedIODeviceImageLoader::render(const RenderConfig &cfg) {
+  auto &cache = AnimationCache::instance();
 
-    if (isDownScalable) {
-      Qt::AspectRatioMode ar = cfg.fit == ObjectFitFill ? Qt::IgnoreAspectRatio : Qt::KeepAspectRatio;
+  stop();
+  m_animation = cache.acquire(m_data, m_digest, cfg);
 
-      m_movie->setScaledSize(originalSize.scaled(deviceSize, ar));
-      emit dataUpdated(pix.scaled(deviceSize, ar));
-      return;
-    }
+  if (!m_animation) {
+    emit errorOccured("Failed to decode animation");
+    return;
+  }
 
-    pix.setDevicePixelRatio(cfg.devicePixelRatio);
-    emit dataUpdated(pix);
-  });
-  m_movie->start();
+  connect(m_animation.get(), &SharedAnimation::frameChanged, this, &AbstractImageLoader::dataUpdated);
+  cache.play(m_animation.get());
+  m_playing = true;
+  emit dataUpdated(m_animation->currentFrame());
 }
 
-AnimatedIODeviceImageLoader::AnimatedIODeviceImageLoader(const QByteArray &data) : m_data(data) {
-  m_buf.setData(m_data);
-  m_buf.open(QIODevice::ReadOnly);
-}
+void AnimatedIODeviceImageLoader::abort() const { stop(); }
+
+AnimatedIODeviceImageLoader::AnimatedIODeviceImageLoader(const QByteArray &data)
+    : m_data(data), m_digest(QCryptographicHash::hash(data, QCryptographicHash::Md5)) {}
+
+AnimatedIODeviceImageLoader::~AnimatedIODeviceImageLoader() { stop(); }
@@ -1,15 +1,27 @@
 #pragma once
 #include "image.hpp"
-#include <QMovie>
-#include <qbuffer.h>
+#include "ui/image/animation-cache.hpp"
+#include <memory>
 #include <qstringview.h>
 
+/**
+ * Plays an animated image from the shared `AnimationCache`, so that widgets showing the same animation at
+ * the same size share its frames. Aborting the loader pauses the animation, rendering it again resumes it.
+ */
 class AnimatedIODeviceImageLoader : public AbstractImageLoader {
-  std::unique_ptr<QMovie> m_movie;
-  QBuffer m_buf;
   QByteArray m_data;
+  QByteArray m_digest;
+  // mutable as the animation is paused by abort()
+  mutable std::shared_ptr<SharedAnimation> m_animation;
+  mutable bool m_playing = false;
+
+  void stop() const;
 
 public:
   void render(const RenderConfig &cfg) override;
+  void abort() const override;
+  bool animated() const override { return true; }
+
   AnimatedIODeviceImageLoader(const QByteArray &bytes);
+  ~AnimatedIODeviceImageLoader();
 };
@@ -0,0 +1,133 @@
+#include "ui/image/animation-cache.hpp"
+#include "trace/trace.hpp"
+#include <algorithm>
+#include <qbuffer.h>
+#include <qimagereader.h>
+
+AnimationCache &AnimationCache::instance() {
+  static AnimationCache cache;
+
+  return cache;
+}
+
+std::vector<SharedAnimation::Frame> AnimationCache::decode(const QByteArray &data,
+                                                           const RenderConfig &config) {
+  TraceScope trace("image", "decode-animation");
+  QBuffer buffer;
+  QSize deviceSize = config.size * config.devicePixelRatio;
+  std::vector<SharedAnimation::Frame> frames;
+
+  buffer.setData(data);
+  buffer.open(QIODevice::ReadOnly);
+
+  QImageReader reader(&buffer);
+  QSize originalSize = reader.size();
+  bool isDownScalable =
+      originalSize.height() > deviceSize.height() || originalSize.width() > deviceSize.width();
+
+  if (originalSize.isValid() && isDownScalable) {
+    reader.setScaledSize(originalSize.scaled(
+        deviceSize, config.fit == ObjectFitFill ? Qt::IgnoreAspectRatio : Qt::KeepAspectRatio));
+  }
+
+  while (frames.size() != MAX_FRAMES) {
+    QImage image = reader.read();
+
+    if (image.isNull()) break;
+
+    int delay = reader.nextImageDelay();
+    auto frameDelay = delay > 0 ? std::max(std::chrono::milliseconds(delay), MIN_FRAME_DELAY)
+                                : DEFAULT_FRAME_DELAY;
+
+    image.setDevicePixelRatio(config.devicePixelRatio);
+    frames.emplace_back(SharedAnimation::Frame{.pixmap = QPixmap::fromImage(std::move(image)),
+                                               .delay = frameDelay});
+  }
+
+  return frames;
+}
+
+std::shared_ptr<SharedAnimation> AnimationCache::acquire(const QByteArray &data, const QByteArray &digest,
+                                                         const RenderConfig &config) {
+  QString key = QString("%1:%2x%3@%4:%5")
+                    .arg(QString::fromLatin1(digest.toHex()))
+                    .arg(config.size.width())
+                    .arg(config.size.height())
+                    .arg(config.devicePixelRatio)
+                    .arg(config.fit);
+
+  if (auto it = m_animations.find(key); it != m_animations.end()) {
+    if (auto animation = it->second.lock()) return animation;
+  }
+
+  auto frames = decode(data, config);
+
+  if (frames.empty()) return nullptr;
+
+  auto animation = std::make_shared<SharedAnimation>(std::move(frames));
+
+  // entries of animations nobody holds anymore are dropped along the way
+  std::erase_if(m_animations, [](const auto &entry) { return entry.second.expired(); });
+  m_animations[key] = animation;
+
+  return animation;
+}
+
+void AnimationCache::play(SharedAnimation *animation) {
+  if (animation->m_players++ > 0 || animation->m_frames.size() < 2) return;
+
+  animation->m_nextFrameAt = SharedAnimation::Clock::now() + animation->m_frames[animation->m_current].delay;
+  m_playing.emplace_back(animation);
+  scheduleNextFrame();
+}
+
+void AnimationCache::pause(SharedAnimation *animation) {
+  if (--animation->m_players > 0) return;
+
+  std::erase(m_playing, animation);
+  scheduleNextFrame();
+}
+
+void AnimationCache::advance() {
+  auto now = SharedAnimation::Clock::now();
+  std::vector<SharedAnimation *> advanced;
+
+  for (auto animation : m_playing) {
+    if (animation->m_nextFrameAt > now) continue;
+
+    // frames that are long overdue, such as after the event loop was blocked, are skipped
+    while (animation->m_nextFrameAt <= now) {
+      animation->m_current = (animation->m_current + 1) % animation->m_frames.size();
+      animation->m_nextFrameAt += animation->m_frames[animation->m_current].delay;
+    }
+
+    advanced.emplace_back(animation);
+  }
+
+  for (auto animation : advanced) {
+    // players of an animation may stop playing others as they get its frame
+    if (std::ranges::find(m_playing, animation) == m_playing.end()) continue;
+
+    emit animation->frameChanged(animation->currentFrame());
+  }
+
+  scheduleNextFrame();
+}
+
+void AnimationCache::scheduleNextFrame() {
+  if (m_playing.empty()) {
+    m_timer->stop();
+    return;
+  }
+
+  auto next = std::ranges::min(m_playing, {}, &SharedAnimation::m_nextFrameAt)->m_nextFrameAt;
+  auto delay = std::chrono::ceil<std::chrono::milliseconds>(next - SharedAnimation::Clock::now());
+
+  m_timer->start(std::max(delay, std::chrono::milliseconds(0)));
+}
+
+AnimationCache::AnimationCache() {
+  m_timer->setSingleShot(true);
+  m_timer->setTimerType(Qt::PreciseTimer);
+  connect(m_timer, &QTimer::timeout, this, &AnimationCache::advance);
+}
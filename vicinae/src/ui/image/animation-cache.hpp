@@ -0,0 +1,90 @@
+#pragma once
+#include "ui/image/image.hpp"
+#include <QTimer>
+#include <chrono>
+#include <memory>
+#include <qobject.h>
+#include <qpixmap.h>
+#include <qtmetamacros.h>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Frames of an animated image decoded for a given size, played for every widget showing it.
+ *
+ * The animation only advances while it has players (see `AnimationCache::play`), all widgets playing it
+ * show the same frame.
+ */
+class SharedAnimation : public QObject {
+  Q_OBJECT
+
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Frame {
+    QPixmap pixmap;
+    std::chrono::milliseconds delay;
+  };
+
+  const QPixmap &currentFrame() const { return m_frames[m_current].pixmap; }
+  size_t frameCount() const { return m_frames.size(); }
+
+  SharedAnimation(std::vector<Frame> frames) : m_frames(std::move(frames)) {}
+
+signals:
+  void frameChanged(const QPixmap &frame) const;
+
+private:
+  friend class AnimationCache;
+
+  std::vector<Frame> m_frames;
+  size_t m_current = 0;
+  int m_players = 0;
+  Clock::time_point m_nextFrameAt;
+};
+
+/**
+ * Process-wide cache of decoded animations, keyed by the content of the image and the size it is decoded
+ * for. An animation is decoded once, downscaled as it is decoded, and shared by everyone showing it for as
+ * long as someone holds it.
+ *
+ * A single timer drives all the animations being played, firing when the next frame of one of them is due,
+ * and stops once none is.
+ */
+class AnimationCache : public QObject {
+public:
+  // bounds the memory a single animation takes, longer ones are cut
+  static constexpr size_t MAX_FRAMES = 500;
+  // delay for frames that do not specify one, as browsers do
+  static constexpr std::chrono::milliseconds DEFAULT_FRAME_DELAY{100};
+  // browsers play frames with shorter delays at this one, most animations expect it
+  static constexpr std::chrono::milliseconds MIN_FRAME_DELAY{20};
+
+  static AnimationCache &instance();
+
+  /**
+   * The animation `data` encodes, decoded to fit in `config`, or nullptr if it could not be decoded.
+   * `digest` identifies `data`, such as a hash of it.
+   */
+  std::shared_ptr<SharedAnimation> acquire(const QByteArray &data, const QByteArray &digest,
+                                           const RenderConfig &config);
+
+  /**
+   * Start playing `animation` for one more player, to be balanced with a call to `pause`.
+   */
+  void play(SharedAnimation *animation);
+  void pause(SharedAnimation *animation);
+
+  size_t size() const { return m_animations.size(); }
+
+private:
+  std::unordered_map<QString, std::weak_ptr<SharedAnimation>> m_animations;
+  std::vector<SharedAnimation *> m_playing;
+  QTimer *m_timer = new QTimer(this);
+
+  static std::vector<SharedAnimation::Frame> decode(const QByteArray &data, const RenderConfig &config);
+  void advance();
+  void scheduleNextFrame();
+
+  AnimationCache();
+};
@@ -0,0 +1,77 @@
+#include "ui/image/async-image-loader.hpp"
+#include "task-scheduler/task-scheduler.hpp"
+#include "trace/trace.hpp"
+#include <qimagereader.h>
+
+QImage decodeImage(QIODevice &device, const RenderConfig &config) {
+  TraceScope trace("image", "decode");
+  QSize deviceSize = config.size * config.devicePixelRatio;
+  QImageReader reader(&device);
+  QSize originalSize = reader.size();
+  bool isDownScalable =
+      originalSize.height() > deviceSize.height() || originalSize.width() > deviceSize.width();
+
+  if (originalSize.isValid() && isDownScalable) {
+    reader.setScaledSize(originalSize.scaled(
+        deviceSize, config.fit == ObjectFitFill ? Qt::IgnoreAspectRatio : Qt::KeepAspectRatio));
+  }
+
+  auto image = reader.read();
+
+  image.setDevicePixelRatio(config.devicePixelRatio);
+
+  return image;
+}
+
+void AsyncImageLoader::decodeAsync(std::function<QImage()> job) {
+  // jobs that did not start by the time they are cancelled never run, a grid full of images cannot hold up
+  // what the user is waiting on
+  auto future = TaskScheduler::instance().run(TaskScheduler::Priority::VisibleUi, std::move(job));
+
+  if (m_watcher->isRunning()) { m_watcher->cancel(); }
+
+  m_watcher->setFuture(future);
+}
+
+ColorLike AsyncImageLoader::resolveColor(const ColorLike &color) {
+  auto tint = std::get_if<SemanticColor>(&color);
+
+  if (!tint) return color;
+
+  auto &theme = ThemeService::instance();
+  auto resolved = theme.getTintColor(*tint);
+
+  // a tint resolving to another tint is not allowed by the theme
+  if (std::holds_alternative<SemanticColor>(resolved)) { return theme.theme().resolveTint(*tint); }
+
+  return resolved;
+}
+
+std::optional<ColorLike> AsyncImageLoader::resolveColor(const std::optional<ColorLike> &color) {
+  if (!color) return std::nullopt;
+
+  return resolveColor(*color);
+}
+
+void AsyncImageLoader::abort() const {
+  if (m_watcher->isRunning()) { m_watcher->cancel(); }
+}
+
+AsyncImageLoader::AsyncImageLoader() : m_watcher(QSharedPointer<ImageWatcher>::create()) {
+  connect(m_watcher.get(), &ImageWatcher::finished, this, [this]() {
+    auto future = m_watcher->future();
+
+    if (future.isCanceled() || future.resultCount() == 0) return;
+
+    auto image = future.takeResult();
+
+    if (image.isNull()) {
+      emit errorOccured("Failed to decode image");
+      return;
+    }
+
+    emit dataUpdated(QPixmap::fromImage(std::move(image)));
+  });
+}
+
+AsyncImageLoader::~AsyncImageLoader() { abort(); }
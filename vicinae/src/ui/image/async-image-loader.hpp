@@ -0,0 +1,44 @@
+#pragma once
+#include "theme.hpp"
+#include "ui/image/image.hpp"
+#include <QSharedPointer>
+#include <functional>
+#include <qfuturewatcher.h>
+#include <qimage.h>
+#include <qiodevice.h>
+
+/**
+ * Base for loaders that decode or rasterize their image off the GUI thread.
+ * Subclasses hand a job producing the image to `decodeAsync`, which runs it on the image decoding
+ * thread pool and emits it as a pixmap once back on the GUI thread, or errors out if it is null.
+ * Starting a job cancels the previous one, as does aborting the loader.
+ *
+ * Jobs run outside of the GUI thread and should only use what they captured: theme colors in particular
+ * are to be resolved beforehand with `resolveColor`.
+ */
+class AsyncImageLoader : public AbstractImageLoader {
+  using ImageWatcher = QFutureWatcher<QImage>;
+  QSharedPointer<ImageWatcher> m_watcher;
+
+protected:
+  void decodeAsync(std::function<QImage()> job);
+
+  /**
+   * `color` with semantic colors replaced by the color the current theme gives them, so that it can be
+   * painted with from any thread.
+   */
+  static ColorLike resolveColor(const ColorLike &color);
+  static std::optional<ColorLike> resolveColor(const std::optional<ColorLike> &color);
+
+public:
+  void abort() const override;
+
+  AsyncImageLoader();
+  ~AsyncImageLoader();
+};
+
+/**
+ * Decode the image `device` holds for it to fit in `config`. Images bigger than that are downscaled as
+ * they are decoded, which for formats such as JPEG is much faster than decoding them at full size.
+ */
+QImage decodeImage(QIODevice &device, const RenderConfig &config);
@@ -0,0 +1,73 @@
+#include "ui/image/builtin-icon-cache.hpp"
+#include "ui/image/svg-image-loader.hpp"
+#include <qsvgrenderer.h>
+
+size_t qHash(const BuiltinIconCache::ShapeKey &key, size_t seed) {
+  return qHashMulti(seed, key.iconName, key.size.width(), key.size.height());
+}
+
+size_t qHash(const BuiltinIconCache::PixmapKey &key, size_t seed) {
+  seed = qHashMulti(seed, key.iconName, key.size.width(), key.size.height(), key.devicePixelRatio);
+
+  if (key.fillColor) { seed = colorHash(*key.fillColor, seed); }
+  if (key.backgroundColor) { seed = colorHash(*key.backgroundColor, qHash(1, seed)); }
+
+  return seed;
+}
+
+BuiltinIconCache &BuiltinIconCache::instance() {
+  static BuiltinIconCache cache;
+
+  return cache;
+}
+
+qsizetype BuiltinIconCache::cost(QSize size, int depth) {
+  return std::max<qsizetype>(1, qsizetype(size.width()) * size.height() * depth / 8);
+}
+
+QImage BuiltinIconCache::shape(const QString &iconName, QSize size) {
+  ShapeKey key{.iconName = iconName, .size = size};
+
+  {
+    std::lock_guard lock(m_shapeMutex);
+
+    if (auto shape = m_shapes.object(key)) return *shape;
+  }
+
+  // rasterized without holding the lock, an icon requested by two threads at once is rasterized twice
+  QSvgRenderer renderer(iconName);
+  QImage shape;
+
+  if (renderer.isValid() && !size.isEmpty()) {
+    shape = QImage(size, QImage::Format_ARGB32_Premultiplied);
+    shape.fill(Qt::transparent);
+    SvgImageLoader::rasterize(shape, shape.rect(), renderer, std::nullopt);
+  }
+
+  std::lock_guard lock(m_shapeMutex);
+
+  // icons that fail to load are remembered as null shapes, which is not worth reporting again
+  m_shapes.insert(key, new QImage(shape), cost(shape.size(), shape.depth()));
+
+  return shape;
+}
+
+const QPixmap *BuiltinIconCache::findPixmap(const PixmapKey &key) { return m_pixmaps.object(key); }
+
+void BuiltinIconCache::insertPixmap(const PixmapKey &key, const QPixmap &pixmap) {
+  m_pixmaps.insert(key, new QPixmap(pixmap), cost(pixmap.size(), pixmap.depth()));
+}
+
+void BuiltinIconCache::clear() {
+  std::lock_guard lock(m_shapeMutex);
+
+  m_shapes.clear();
+  m_pixmaps.clear();
+}
+
+BuiltinIconCache::BuiltinIconCache() {
+  m_shapes.setMaxCost(SHAPE_BYTE_BUDGET);
+  m_pixmaps.setMaxCost(PIXMAP_BYTE_BUDGET);
+  // composed icons are keyed by resolved colors, those of the previous theme are not going to be used again
+  connect(&ThemeService::instance(), &ThemeService::themeChanged, this, [this]() { m_pixmaps.clear(); });
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "theme.hpp"
+#include <QCache>
+#include <QImage>
+#include <QPixmap>
+#include <QString>
+#include <mutex>
+#include <optional>
+
+/**
+ * Rasterized builtin icons, for them not to be parsed and rasterized again every time they are shown.
+ *
+ * Icons are rasterized once per name and pixel size, in their own colors, as a shape. The tinted variants of
+ * an icon are made by filling its shape, so that an icon shown in several colors only goes through the svg
+ * renderer once. Shapes can be rasterized and looked up from any thread, which is what loaders rendering
+ * builtin icons off the GUI thread do.
+ *
+ * Fully composed icons (tinted and painted on their background) are also kept, on the GUI thread only, for
+ * the widgets painting icons themselves to draw them from a cached pixmap.
+ */
+class BuiltinIconCache : public QObject {
+public:
+  static constexpr qsizetype SHAPE_BYTE_BUDGET = 4 * 1024 * 1024;
+  static constexpr qsizetype PIXMAP_BYTE_BUDGET = 4 * 1024 * 1024;
+
+  /**
+   * A composed icon. Colors are resolved ones, as the theme gives them.
+   */
+  struct PixmapKey {
+    QString iconName;
+    QSize size;
+    qreal devicePixelRatio = 1;
+    std::optional<ColorLike> fillColor;
+    std::optional<ColorLike> backgroundColor;
+
+    bool operator==(const PixmapKey &rhs) const = default;
+  };
+
+  static BuiltinIconCache &instance();
+
+  /**
+   * The svg at `iconName` rasterized to `size` pixels, which is null if it can't be loaded.
+   */
+  QImage shape(const QString &iconName, QSize size);
+
+  /**
+   * To be used from the GUI thread only.
+   */
+  const QPixmap *findPixmap(const PixmapKey &key);
+  void insertPixmap(const PixmapKey &key, const QPixmap &pixmap);
+
+  void clear();
+
+private:
+  struct ShapeKey {
+    QString iconName;
+    QSize size;
+
+    bool operator==(const ShapeKey &rhs) const = default;
+  };
+
+  friend size_t qHash(const ShapeKey &key, size_t seed);
+  friend size_t qHash(const PixmapKey &key, size_t seed);
+
+  static qsizetype cost(QSize size, int depth);
+
+  std::mutex m_shapeMutex;
+  QCache<ShapeKey, QImage> m_shapes;
+  QCache<PixmapKey, QPixmap> m_pixmaps;
+
+  BuiltinIconCache();
+};
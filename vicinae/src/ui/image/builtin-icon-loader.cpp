@@ -1,33 +1,69 @@
 #include "builtin-icon-loader.hpp"
 #include "theme.hpp"
+#include "ui/image/builtin-icon-cache.hpp"
 #include "ui/image/image.hpp"
-#include "svg-image-loader.hpp"
 
-void BuiltinIconLoader::render(const RenderConfig &config) { emit dataUpdated(renderSync(config)); }
+void BuiltinIconLoader::render(const RenderConfig &config) {
+  decodeAsync([config, iconName = m_iconName, backgroundColor = resolveColor(m_backgroundColor),
+               fillColor = resolveColor(m_fillColor)]() {
+    return rasterize(config, iconName, backgroundColor, fillColor);
+  });
+}
 
 QPixmap BuiltinIconLoader::renderSync(const RenderConfig &config) {
-  QPixmap canva(config.size * config.devicePixelRatio);
+  auto &cache = BuiltinIconCache::instance();
+  BuiltinIconCache::PixmapKey key{.iconName = m_iconName,
+                                  .size = config.size,
+                                  .devicePixelRatio = config.devicePixelRatio,
+                                  .fillColor = resolveColor(m_fillColor),
+                                  .backgroundColor = resolveColor(m_backgroundColor)};
+
+  if (auto pixmap = cache.findPixmap(key)) return *pixmap;
+
+  auto pixmap = QPixmap::fromImage(rasterize(config, m_iconName, key.backgroundColor, key.fillColor));
+
+  cache.insertPixmap(key, pixmap);
+
+  return pixmap;
+}
+
+QImage BuiltinIconLoader::rasterize(const RenderConfig &config, const QString &iconName,
+                                    const std::optional<ColorLike> &backgroundColor,
+                                    const std::optional<ColorLike> &fillColor) {
+  QImage canva(config.size * config.devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
   int margin = 0;
 
   canva.fill(Qt::transparent);
 
-  if (m_backgroundColor) {
+  if (backgroundColor) {
     OmniPainter painter(&canva);
     qreal radius = qRound(4 * config.devicePixelRatio);
 
     painter.setRenderHint(QPainter::Antialiasing, true);
     margin = qRound(3 * config.devicePixelRatio);
-    painter.setBrush(painter.colorBrush(*m_backgroundColor));
+    painter.setBrush(painter.colorBrush(*backgroundColor));
     painter.setPen(Qt::NoPen);
     painter.drawRoundedRect(canva.rect(), radius, radius);
   }
 
   QMargins margins{margin, margin, margin, margin};
   QRect iconRect = canva.rect().marginsRemoved(margins);
-  SvgImageLoader loader(m_iconName);
+  // shared by every tint of the icon, filling it detaches it from the cached one
+  QImage icon = BuiltinIconCache::instance().shape(iconName, iconRect.size());
+
+  if (!icon.isNull()) {
+    if (fillColor) {
+      OmniPainter painter(&icon);
+
+      painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
+      painter.fillRect(icon.rect(), *fillColor);
+    }
+
+    QPainter painter(&canva);
+
+    painter.drawImage(iconRect.topLeft(), icon);
+  }
 
-  loader.setFillColor(m_fillColor);
-  loader.render(canva, iconRect);
   canva.setDevicePixelRatio(config.devicePixelRatio);
 
   return canva;
@@ -39,4 +75,4 @@ void BuiltinIconLoader::setBackgroundColor(const std::optional<ColorLike> &color
 }
 
 BuiltinIconLoader::BuiltinIconLoader(const QString &iconName)
-    : m_iconName(iconName), m_fillColor(SemanticColor::TextPrimary) {}
+    : m_fillColor(SemanticColor::TextPrimary), m_iconName(iconName) {}
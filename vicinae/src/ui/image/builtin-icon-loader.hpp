@@ -1,12 +1,17 @@
 #pragma once
+#include "ui/image/async-image-loader.hpp"
 #include "ui/image/image.hpp"
 #include <qpixmap.h>
 
-class BuiltinIconLoader : public AbstractImageLoader {
+class BuiltinIconLoader : public AsyncImageLoader {
   std::optional<ColorLike> m_backgroundColor;
   std::optional<ColorLike> m_fillColor;
   QString m_iconName;
 
+  static QImage rasterize(const RenderConfig &config, const QString &iconName,
+                          const std::optional<ColorLike> &backgroundColor,
+                          const std::optional<ColorLike> &fillColor);
+
 public:
   void render(const RenderConfig &config) override;
   QPixmap renderSync(const RenderConfig &config);
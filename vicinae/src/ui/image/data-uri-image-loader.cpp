@@ -1,18 +1,18 @@
 #include "data-uri-image-loader.hpp"
 #include "data-uri/data-uri.hpp"
 
-DataUriImageLoader::DataUriImageLoader(const QString &url) {
-  DataUri uri(url);
-
-  if (!m_tmp.open()) {
-    qCritical() << "Failed to open temp file for data URI image";
-    return;
+// the content is decoded straight from memory, on the same path images from any other source go through
+void DataUriImageLoader::render(const RenderConfig &config) {
+  if (!m_loader) {
+    m_loader.reset(new IODeviceImageLoader(DataUri(m_uri).decodeContent()));
+    m_loader->forwardSignals(this);
   }
 
-  m_tmp.write(uri.decodeContent());
-  m_tmp.close();
-  m_loader.reset(new LocalImageLoader(m_tmp.filesystemFileName()));
-  m_loader->forwardSignals(this);
+  m_loader->render(config);
+}
+
+void DataUriImageLoader::abort() const {
+  if (m_loader) { m_loader->abort(); }
 }
 
-void DataUriImageLoader::render(const RenderConfig &config) { m_loader->render(config); }
+DataUriImageLoader::DataUriImageLoader(const QString &uri) : m_uri(uri) {}
@@ -1,15 +1,25 @@
 #pragma once
 #include "common.hpp"
-#include "local-image-loader.hpp"
+#include "io-image-loader.hpp"
 #include "ui/image/image.hpp"
 #include <QtCore>
 
+/**
+ * The content of the uri is only decoded once it is rendered: widgets showing an image that is already in
+ * the `ImageCache` never render their loader, and extensions tend to send the same inline icons over and
+ * over.
+ */
 class DataUriImageLoader : public AbstractImageLoader {
-  QTemporaryFile m_tmp;
-  QObjectUniquePtr<LocalImageLoader> m_loader;
+  QString m_uri;
+  QObjectUniquePtr<IODeviceImageLoader> m_loader;
 
   void render(const RenderConfig &config) override;
+  void abort() const override;
+  bool animated() const override { return m_loader && m_loader->animated(); }
 
 public:
-  DataUriImageLoader(const QString &url);
+  /**
+   * `uri` may or may not have the `data:` scheme.
+   */
+  DataUriImageLoader(const QString &uri);
 };
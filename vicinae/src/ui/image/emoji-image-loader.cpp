@@ -1,23 +1,38 @@
 #include "emoji-image-loader.hpp"
 #include "service-registry.hpp"
 #include "font-service.hpp"
+#include <qfontdatabase.h>
+#include <qpainter.h>
 
-void EmojiImageLoader::render(const RenderConfig &config) {
-  auto font = ServiceRegistry::instance()->fontService()->emojiFont();
-  QPixmap canva(config.size * config.devicePixelRatio);
-
-  font.setStyleStrategy(QFont::StyleStrategy::NoFontMerging);
+QImage EmojiImageLoader::rasterize(const QString &emoji, QFont font, const RenderConfig &config) {
+  QImage canva(config.size * config.devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
 
   canva.fill(Qt::transparent);
   font.setPixelSize(canva.height() * 0.8);
 
-  QPainter painter(&canva);
+  {
+    QPainter painter(&canva);
+
+    painter.setFont(font);
+    painter.drawText(canva.rect(), Qt::AlignCenter, emoji);
+  }
 
-  painter.setFont(font);
-  painter.drawText(canva.rect(), Qt::AlignCenter, m_emoji);
   canva.setDevicePixelRatio(config.devicePixelRatio);
 
-  emit dataUpdated(canva);
+  return canva;
+}
+
+void EmojiImageLoader::render(const RenderConfig &config) {
+  auto font = ServiceRegistry::instance()->fontService()->emojiFont();
+
+  font.setStyleStrategy(QFont::StyleStrategy::NoFontMerging);
+
+  if (!QFontDatabase::supportsThreadedFontRendering()) {
+    emit dataUpdated(QPixmap::fromImage(rasterize(m_emoji, font, config)));
+    return;
+  }
+
+  decodeAsync([emoji = m_emoji, font, config]() { return rasterize(emoji, font, config); });
 }
 
 EmojiImageLoader::EmojiImageLoader(const QString &emoji) : m_emoji(emoji) {}
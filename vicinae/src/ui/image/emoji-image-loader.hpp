@@ -1,9 +1,16 @@
 #pragma once
-#include "ui/image/image.hpp"
+#include "ui/image/async-image-loader.hpp"
+#include <qfont.h>
 
-class EmojiImageLoader : public AbstractImageLoader {
+/**
+ * Rasterizes an emoji with the emoji font. Color emoji fonts are expensive to scale, so this is done on the
+ * image decoding pool when the platform supports rendering text outside of the GUI thread. Rendered emojis
+ * are then served by the image cache, for every size and device pixel ratio they are shown at.
+ */
+class EmojiImageLoader : public AsyncImageLoader {
   QString m_emoji;
 
+  static QImage rasterize(const QString &emoji, QFont font, const RenderConfig &config);
   void render(const RenderConfig &config) override;
 
 public:
@@ -3,10 +3,12 @@
 #include <qbuffer.h>
 
 void HttpImageLoader::render(const RenderConfig &cfg) {
-  if (m_reply) { m_reply->abort(); }
+  if (m_reply) {
+    m_reply->abort();
+    m_reply->deleteLater();
+  }
 
-  QNetworkRequest request(m_url);
-  auto reply = NetworkFetcher::instance()->fetch(m_url);
+  auto reply = NetworkFetcher::instance()->fetch(m_url, m_viewportDistance);
 
   // important: we connect to the current reply, not m_reply
   m_reply = reply;
@@ -14,6 +16,7 @@ void HttpImageLoader::render(const RenderConfig &cfg) {
   connect(reply, &FetchReply::finished, this, [this, reply, cfg](const QByteArray &data) {
     if (m_reply != reply) return;
 
+    // decoding happens on the decode pool, duplicate fetches of the url only share the bytes
     m_loader.reset(new IODeviceImageLoader(data));
     m_loader->forwardSignals(this);
     m_loader->render(cfg);
@@ -22,6 +25,12 @@ void HttpImageLoader::render(const RenderConfig &cfg) {
   });
 }
 
+void HttpImageLoader::abort() const {
+  // a reply that is still queued is dropped, which frees its spot for the images that are in view
+  if (m_reply) { m_reply->abort(); }
+  if (m_loader) { m_loader->abort(); }
+}
+
 HttpImageLoader::HttpImageLoader(const QUrl &url) : m_url(url) {}
 
 HttpImageLoader::~HttpImageLoader() {
@@ -9,8 +9,12 @@ class HttpImageLoader : public AbstractImageLoader {
   QObjectUniquePtr<IODeviceImageLoader> m_loader;
   FetchReply *m_reply = nullptr;
   QUrl m_url;
+  int m_viewportDistance = 0;
 
   void render(const RenderConfig &cfg) override;
+  void abort() const override;
+  bool animated() const override { return m_loader && m_loader->animated(); }
+  void setViewportDistance(int distance) override { m_viewportDistance = distance; }
 
 public:
   HttpImageLoader(const QUrl &url);
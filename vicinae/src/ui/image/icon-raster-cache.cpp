@@ -0,0 +1,225 @@
+#include "ui/image/icon-raster-cache.hpp"
+#include <QSaveFile>
+#include <cstring>
+#include <functional>
+#include <qcoreapplication.h>
+#include <qdatetime.h>
+#include <qdir.h>
+#include <qfileinfo.h>
+#include <qicon.h>
+#include <qlogging.h>
+#include <qstandardpaths.h>
+
+static constexpr char MAGIC[8] = {'V', 'I', 'C', 'I', 'C', 'O', 'N', 'S'};
+static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+static constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+// stable across runs, unlike qHash which is seeded
+static uint64_t fnv1a(uint64_t hash, const QByteArray &data) {
+  for (char c : data) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= FNV_PRIME;
+  }
+
+  return hash;
+}
+
+static QString packPath() {
+  return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/omnicast/icon-rasters.pack";
+}
+
+IconRasterCache &IconRasterCache::instance() {
+  static IconRasterCache cache;
+
+  return cache;
+}
+
+uint64_t IconRasterCache::key(const QString &name, const QString &theme, QSize size, qreal devicePixelRatio) {
+  QString key = QString("%1|%2|%3x%4@%5")
+                    .arg(name)
+                    .arg(theme)
+                    .arg(size.width())
+                    .arg(size.height())
+                    .arg(devicePixelRatio);
+
+  // icons given as a path are not part of a theme, it is their file that can change
+  if (name.startsWith('/')) { key += QString("|%1").arg(QFileInfo(name).lastModified().toMSecsSinceEpoch()); }
+
+  return fnv1a(FNV_OFFSET_BASIS, key.toUtf8());
+}
+
+uint64_t IconRasterCache::iconThemesStamp() {
+  uint64_t stamp = FNV_OFFSET_BASIS;
+  QStringList roots = QIcon::themeSearchPaths() + QIcon::fallbackSearchPaths();
+
+  roots << "/usr/share/pixmaps";
+
+  // search path, theme, size and category: installing an icon modifies the directory of its category
+  std::function<void(const QString &, int)> visit = [&](const QString &path, int depth) {
+    QFileInfo info(path);
+
+    if (!info.isDir()) return;
+
+    stamp = fnv1a(stamp, QString("%1:%2;").arg(path).arg(info.lastModified().toMSecsSinceEpoch()).toUtf8());
+
+    if (depth == 0) return;
+
+    for (const auto &entry : QDir(path).entryList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Name)) {
+      visit(path + '/' + entry, depth - 1);
+    }
+  };
+
+  for (const auto &root : roots) {
+    visit(root, 3);
+  }
+
+  return stamp;
+}
+
+void IconRasterCache::open() {
+  m_file.setFileName(packPath());
+
+  if (!m_file.open(QIODevice::ReadOnly)) return;
+
+  uint64_t size = m_file.size();
+  Header header;
+
+  if (size < sizeof(Header) || !(m_data = m_file.map(0, size))) {
+    m_file.close();
+    return;
+  }
+
+  std::memcpy(&header, m_data, sizeof(header));
+
+  bool valid = std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 && header.version == VERSION &&
+               header.stamp == m_stamp && header.count <= (size - sizeof(Header)) / sizeof(Entry);
+
+  if (!valid) {
+    m_file.unmap(const_cast<uchar *>(m_data));
+    m_file.close();
+    m_data = nullptr;
+    return;
+  }
+
+  m_entries.reserve(header.count);
+
+  for (uint32_t i = 0; i != header.count; ++i) {
+    Entry entry;
+
+    std::memcpy(&entry, m_data + sizeof(Header) + i * sizeof(Entry), sizeof(entry));
+
+    uint64_t pixelsSize = static_cast<uint64_t>(entry.bytesPerLine) * entry.height;
+
+    // a corrupted offset is not to wrap around the end of the mapping
+    if (entry.offset > size || pixelsSize > size - entry.offset) continue;
+
+    m_entries[entry.key] = entry;
+  }
+}
+
+void IconRasterCache::flush() {
+  if (m_pending.empty()) return;
+
+  QString path = packPath();
+  QSaveFile out(path);
+  std::vector<Entry> entries;
+  std::vector<const uchar *> pixels;
+  uint64_t dataSize = 0;
+
+  auto add = [&](Entry entry, const uchar *data) {
+    entry.offset = dataSize;
+    dataSize += static_cast<uint64_t>(entry.bytesPerLine) * entry.height;
+    entries.emplace_back(entry);
+    pixels.emplace_back(data);
+  };
+
+  for (const auto &[key, image] : m_pending) {
+    add({.key = key,
+         .width = static_cast<uint32_t>(image.width()),
+         .height = static_cast<uint32_t>(image.height()),
+         .bytesPerLine = static_cast<uint32_t>(image.bytesPerLine()),
+         .devicePixelRatio = static_cast<float>(image.devicePixelRatio())},
+        image.constBits());
+  }
+
+  // icons that are no longer used are dropped once the pack gets too big
+  for (const auto &[key, entry] : m_entries) {
+    if (m_pending.contains(key) || dataSize > MAX_PACK_SIZE) continue;
+
+    add(entry, m_data + entry.offset);
+  }
+
+  uint64_t headerSize = sizeof(Header) + entries.size() * sizeof(Entry);
+  Header header{.version = VERSION, .count = static_cast<uint32_t>(entries.size()), .stamp = m_stamp};
+
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  QDir().mkpath(QFileInfo(path).absolutePath());
+
+  if (!out.open(QIODevice::WriteOnly)) {
+    qWarning() << "Failed to open icon raster cache for writing" << out.errorString();
+    return;
+  }
+
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  for (auto entry : entries) {
+    entry.offset += headerSize;
+    out.write(reinterpret_cast<const char *>(&entry), sizeof(entry));
+  }
+
+  for (size_t i = 0; i != entries.size(); ++i) {
+    out.write(reinterpret_cast<const char *>(pixels[i]),
+              static_cast<qint64>(entries[i].bytesPerLine) * entries[i].height);
+  }
+
+  if (!out.commit()) {
+    qWarning() << "Failed to write icon raster cache" << out.errorString();
+    return;
+  }
+
+  // the pending icons are part of the new pack, which replaces the mapping of the old one
+  if (m_data) { m_file.unmap(const_cast<uchar *>(m_data)); }
+
+  m_file.close();
+  m_data = nullptr;
+  m_entries.clear();
+  m_pending.clear();
+  open();
+}
+
+std::optional<QImage> IconRasterCache::find(const QString &name, const QString &theme, QSize size,
+                                            qreal devicePixelRatio) {
+  uint64_t k = key(name, theme, size, devicePixelRatio);
+
+  if (auto it = m_pending.find(k); it != m_pending.end()) return it->second;
+
+  auto it = m_entries.find(k);
+
+  if (it == m_entries.end()) return std::nullopt;
+
+  auto &entry = it->second;
+  QImage image(m_data + entry.offset, entry.width, entry.height, entry.bytesPerLine,
+               QImage::Format_ARGB32_Premultiplied);
+
+  image.setDevicePixelRatio(entry.devicePixelRatio);
+
+  return image;
+}
+
+void IconRasterCache::insert(const QString &name, const QString &theme, QSize size, qreal devicePixelRatio,
+                             const QImage &image) {
+  if (image.isNull()) return;
+
+  m_pending[key(name, theme, size, devicePixelRatio)] =
+      image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+  m_flushTimer->start();
+}
+
+IconRasterCache::IconRasterCache() {
+  m_stamp = iconThemesStamp();
+  m_flushTimer->setSingleShot(true);
+  m_flushTimer->setInterval(5000);
+  connect(m_flushTimer, &QTimer::timeout, this, &IconRasterCache::flush);
+  connect(qApp, &QCoreApplication::aboutToQuit, this, &IconRasterCache::flush);
+  open();
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <QFile>
+#include <cstdint>
+#include <optional>
+#include <qimage.h>
+#include <qobject.h>
+#include <qtimer.h>
+#include <unordered_map>
+
+/**
+ * Persistent cache of the system icons rendered by QIconImageLoader, for the first time the launcher shows
+ * up after login not to resolve and rasterize every application icon again.
+ *
+ * Icons are keyed by name, theme, size and scale, and written to a single pack file that is memory mapped
+ * when it is opened: a header, an index of all the icons and their raw premultiplied ARGB32 pixels.
+ * The whole pack is invalidated if the directories of the icon themes were modified since it was written,
+ * which is what installing or removing an application or an icon theme does.
+ */
+class IconRasterCache : public QObject {
+  static constexpr uint32_t VERSION = 1;
+  static constexpr uint64_t MAX_PACK_SIZE = 32 * 1024 * 1024;
+
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t count;
+    uint64_t stamp;
+  };
+
+  struct Entry {
+    uint64_t key;
+    uint64_t offset;
+    uint32_t width;
+    uint32_t height;
+    uint32_t bytesPerLine;
+    float devicePixelRatio;
+  };
+
+  QFile m_file;
+  const uchar *m_data = nullptr;
+  uint64_t m_stamp = 0;
+  std::unordered_map<uint64_t, Entry> m_entries;
+  // icons rendered since the pack was written, which are added to it the next time it is
+  std::unordered_map<uint64_t, QImage> m_pending;
+  QTimer *m_flushTimer = new QTimer(this);
+
+  static uint64_t key(const QString &name, const QString &theme, QSize size, qreal devicePixelRatio);
+
+  /**
+   * Hash of the modification times of the icon theme directories, down to the directories icons are in.
+   */
+  static uint64_t iconThemesStamp();
+
+  void open();
+  void flush();
+
+  IconRasterCache();
+
+public:
+  static IconRasterCache &instance();
+
+  /**
+   * The icon rendered at `size` device independent pixels and `devicePixelRatio`, if it is cached.
+   * The image can point into the pack file, it is to be converted to a pixmap right away.
+   */
+  std::optional<QImage> find(const QString &name, const QString &theme, QSize size, qreal devicePixelRatio);
+  void insert(const QString &name, const QString &theme, QSize size, qreal devicePixelRatio,
+              const QImage &image);
+};
@@ -0,0 +1,208 @@
+#include "ui/image/image-cache.hpp"
+#include "memory-budget/memory-budget.hpp"
+#include "theme.hpp"
+#include <QGuiApplication>
+#include <QScreen>
+#include <algorithm>
+
+static size_t hashKey(const ImageCacheKey &key) {
+  return qHashMulti(key.url.hash(), key.theme, key.config.size.width(), key.config.size.height(),
+                    key.config.devicePixelRatio, static_cast<int>(key.config.fit));
+}
+
+ImageCache &ImageCache::instance() {
+  static ImageCache cache;
+
+  return cache;
+}
+
+ImageCacheKey ImageCache::key(const ImageURL &url, const RenderConfig &config) {
+  ImageCacheKey key{.url = url, .theme = ThemeService::instance().theme().id, .config = config};
+
+  key.hash = hashKey(key);
+
+  return key;
+}
+
+ImageCacheKey ImageCache::withRatio(const ImageCacheKey &key, qreal devicePixelRatio) {
+  ImageCacheKey variant = key;
+
+  variant.config.devicePixelRatio = devicePixelRatio;
+  variant.hash = hashKey(variant);
+
+  return variant;
+}
+
+std::vector<qreal> ImageCache::screenRatios() {
+  std::vector<qreal> ratios;
+
+  for (auto screen : QGuiApplication::screens()) {
+    if (std::ranges::find(ratios, screen->devicePixelRatio()) == ratios.end()) {
+      ratios.emplace_back(screen->devicePixelRatio());
+    }
+  }
+
+  return ratios;
+}
+
+const QPixmap *ImageCache::find(const ImageCacheKey &key) {
+  auto pixmap = m_pixmaps.object(key);
+
+  ++(pixmap ? m_hits : m_misses);
+
+  return pixmap;
+}
+
+const QPixmap *ImageCache::derive(const ImageCacheKey &key) {
+  const QPixmap *source = nullptr;
+  qreal sourceRatio = 0;
+
+  for (qreal ratio : screenRatios()) {
+    if (ratio <= key.config.devicePixelRatio || (source && ratio >= sourceRatio)) continue;
+
+    if (auto pixmap = m_pixmaps.object(withRatio(key, ratio)); pixmap && !pixmap->isNull()) {
+      source = pixmap;
+      sourceRatio = ratio;
+    }
+  }
+
+  if (!source) return nullptr;
+
+  QSize size = (QSizeF(source->size()) * key.config.devicePixelRatio / sourceRatio).toSize();
+  QPixmap scaled = source->scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+  scaled.setDevicePixelRatio(key.config.devicePixelRatio);
+  insert(key, scaled);
+
+  return m_pixmaps.object(key);
+}
+
+void ImageCache::setDevicePixelRatio(qreal devicePixelRatio) {
+  if (devicePixelRatio == m_devicePixelRatio) return;
+
+  // the ratio of the screen the launcher first shows up on is not a change
+  bool moved = m_devicePixelRatio != 0;
+
+  m_devicePixelRatio = devicePixelRatio;
+  if (moved) { schedulePrerender(); }
+}
+
+void ImageCache::schedulePrerender() { m_prerenderTimer->start(); }
+
+void ImageCache::prerender() {
+  auto ratios = screenRatios();
+
+  std::erase(ratios, m_devicePixelRatio);
+  m_prerenderQueue.clear();
+
+  if (ratios.empty()) return;
+
+  for (const auto &key : m_pixmaps.keys()) {
+    if (m_prerenderQueue.size() >= MAX_PRERENDERED_IMAGES) break;
+    if (key.config.devicePixelRatio != m_devicePixelRatio) continue;
+
+    // images that failed to load would only fail again
+    if (auto pixmap = m_pixmaps.object(key); !pixmap || pixmap->isNull()) continue;
+
+    for (qreal ratio : ratios) {
+      if (auto variant = withRatio(key, ratio); !m_pixmaps.contains(variant)) {
+        m_prerenderQueue.emplace_back(std::move(variant));
+      }
+    }
+  }
+
+  prerenderNext();
+}
+
+void ImageCache::prerenderNext() {
+  QString theme = ThemeService::instance().theme().id;
+
+  while (!m_prerenderQueue.empty() && m_prerenderLoads.size() < MAX_PRERENDER_LOADS) {
+    ImageCacheKey key = std::move(m_prerenderQueue.front());
+
+    m_prerenderQueue.pop_front();
+
+    // the theme changed since, or the variant was shown and loaded meanwhile
+    if (key.theme != theme || m_pixmaps.contains(key) || m_animated.contains(key)) continue;
+    if (derive(key) || !claim(key)) continue;
+
+    auto loader = createImageLoader(key.url);
+
+    if (!loader) {
+      abandon(key);
+      continue;
+    }
+
+    m_prerenderLoads.emplace_back(loader);
+    connect(loader, &AbstractImageLoader::dataUpdated, this, [this, loader, key](const QPixmap &pixmap) {
+      if (loader->animated()) {
+        abandon(key, true);
+      } else {
+        insert(key, pixmap);
+      }
+      finishPrerender(loader);
+    });
+    // a widget showing the image retries it on its own, failures may not be for good
+    connect(loader, &AbstractImageLoader::errorOccured, this, [this, loader, key]() {
+      abandon(key);
+      finishPrerender(loader);
+    });
+    loader->render(key.config);
+  }
+}
+
+void ImageCache::finishPrerender(AbstractImageLoader *loader) {
+  disconnect(loader, nullptr, this, nullptr);
+  loader->abort();
+  loader->deleteLater();
+  std::erase(m_prerenderLoads, loader);
+  prerenderNext();
+}
+
+bool ImageCache::claim(const ImageCacheKey &key) { return m_loading.insert(key).second; }
+
+void ImageCache::insert(const ImageCacheKey &key, const QPixmap &pixmap) {
+  qsizetype cost = std::max<qsizetype>(1, qsizetype(pixmap.width()) * pixmap.height() * pixmap.depth() / 8);
+
+  m_loading.erase(key);
+  m_pixmaps.insert(key, new QPixmap(pixmap), cost);
+  emit imageLoaded(key, pixmap);
+}
+
+void ImageCache::abandon(const ImageCacheKey &key, bool animated) {
+  m_loading.erase(key);
+
+  if (animated) { m_animated.insert(key); }
+
+  emit loadAbandoned(key);
+}
+
+void ImageCache::clear() {
+  m_pixmaps.clear();
+  m_animated.clear();
+  m_prerenderQueue.clear();
+}
+
+void ImageCache::trim(size_t bytes) {
+  m_pixmaps.setMaxCost(std::min<qsizetype>(bytes, BYTE_BUDGET));
+  m_pixmaps.setMaxCost(BYTE_BUDGET);
+}
+
+ImageCache::Stats ImageCache::stats() const {
+  return {.hits = m_hits,
+          .misses = m_misses,
+          .count = static_cast<size_t>(m_pixmaps.size()),
+          .bytes = static_cast<size_t>(m_pixmaps.totalCost())};
+}
+
+ImageCache::ImageCache() {
+  m_pixmaps.setMaxCost(BYTE_BUDGET);
+  m_prerenderTimer->setSingleShot(true);
+  m_prerenderTimer->setInterval(PRERENDER_DELAY);
+  connect(m_prerenderTimer, &QTimer::timeout, this, &ImageCache::prerender);
+  connect(qGuiApp, &QGuiApplication::screenAdded, this, &ImageCache::schedulePrerender);
+  MemoryBudget::instance().add({.subsystem = MemoryBudget::Subsystem::ImageCache,
+                                .usage = [this]() { return static_cast<size_t>(m_pixmaps.totalCost()); },
+                                .trim = [this](size_t budget) { trim(budget); }});
+  connect(&ThemeService::instance(), &ThemeService::themeChanged, this, &ImageCache::clear);
+}
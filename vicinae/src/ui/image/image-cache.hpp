@@ -0,0 +1,122 @@
+#pragma once
+#include "ui/image/image.hpp"
+#include "ui/image/url.hpp"
+#include <QCache>
+#include <qobject.h>
+#include <qpixmap.h>
+#include <qtimer.h>
+#include <qtmetamacros.h>
+#include <chrono>
+#include <deque>
+#include <unordered_set>
+
+/**
+ * Process-wide cache of rendered images, keyed by everything the pixmap of an image depends on: its url,
+ * fill color included, the size and device pixel ratio it is rendered at and how it fits in it, and the
+ * theme its colors come from. Keys share the payload of their url and carry its hash, for lookups not to
+ * serialize or copy anything.
+ *
+ * Pixmaps are evicted least recently used first once they take more than the byte budget.
+ * Images that failed to load are remembered as null pixmaps, for their fallback to be used right away.
+ *
+ * Loads are coalesced: the first widget asking for an image that is not cached claims its loading, and
+ * widgets asking for the same image while it loads wait for `imageLoaded` instead of loading it again.
+ * If the load is abandoned, `loadAbandoned` is emitted for one of them to claim it in turn.
+ *
+ * Images are cached per device pixel ratio, for the launcher to move between screens of different scales
+ * without throwing away what was rendered for the other ones. A variant missing at some ratio is scaled
+ * down from one cached at a higher ratio rather than loaded from its source again. After the launcher
+ * moved to another screen, or a screen was plugged in, the images rendered at the current ratio are
+ * rendered in the background at the ratio of the other screens.
+ */
+class ImageCache : public QObject {
+  Q_OBJECT
+
+  static constexpr qsizetype BYTE_BUDGET = 64 * 1024 * 1024;
+  // images shown right after a screen change are loaded first, prerendering waits for them
+  static constexpr auto PRERENDER_DELAY = std::chrono::seconds(1);
+  static constexpr size_t MAX_PRERENDERED_IMAGES = 128;
+  static constexpr size_t MAX_PRERENDER_LOADS = 2;
+
+public:
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t count = 0;
+    size_t bytes = 0;
+  };
+
+private:
+  QCache<ImageCacheKey, QPixmap> m_pixmaps;
+  std::unordered_set<ImageCacheKey> m_loading;
+  // images that turned out to be animated, that are rendered by every widget showing them
+  std::unordered_set<ImageCacheKey> m_animated;
+  uint64_t m_hits = 0;
+  uint64_t m_misses = 0;
+
+  qreal m_devicePixelRatio = 0;
+  std::deque<ImageCacheKey> m_prerenderQueue;
+  std::vector<AbstractImageLoader *> m_prerenderLoads;
+  QTimer *m_prerenderTimer = new QTimer(this);
+
+  static ImageCacheKey withRatio(const ImageCacheKey &key, qreal devicePixelRatio);
+  // distinct device pixel ratios of the screens that are plugged in
+  static std::vector<qreal> screenRatios();
+
+  void schedulePrerender();
+  void prerender();
+  void prerenderNext();
+  void finishPrerender(AbstractImageLoader *loader);
+
+  ImageCache();
+
+public:
+  static ImageCache &instance();
+  static ImageCacheKey key(const ImageURL &url, const RenderConfig &config);
+
+  /**
+   * The cached pixmap for `key`, which is null if the image failed to load, or nullptr if none is.
+   */
+  const QPixmap *find(const ImageCacheKey &key);
+  bool cacheable(const ImageCacheKey &key) const { return !m_animated.contains(key); }
+
+  /**
+   * Cache the pixmap for `key` scaled down from the variant of the same image cached at the nearest higher
+   * device pixel ratio, and return it, or nullptr if there is no such variant.
+   */
+  const QPixmap *derive(const ImageCacheKey &key);
+
+  /**
+   * The device pixel ratio images are being rendered at, that is the one of the screen the launcher is on.
+   * When it changes, the images rendered at the new ratio are prerendered at the other ones.
+   */
+  void setDevicePixelRatio(qreal devicePixelRatio);
+
+  /**
+   * Claim the loading of `key`, unless someone else already did in which case false is returned.
+   */
+  bool claim(const ImageCacheKey &key);
+
+  /**
+   * Cache the pixmap `key` was loaded as, or a null pixmap if it failed to load, ending its loading.
+   */
+  void insert(const ImageCacheKey &key, const QPixmap &pixmap);
+
+  /**
+   * End the loading of `key` without caching anything, which for animated images is never done.
+   */
+  void abandon(const ImageCacheKey &key, bool animated = false);
+
+  void clear();
+
+  /**
+   * Evict the least recently used pixmaps until the cached ones take at most `bytes`.
+   */
+  void trim(size_t bytes);
+
+  Stats stats() const;
+
+signals:
+  void imageLoaded(const ImageCacheKey &key, const QPixmap &pixmap) const;
+  void loadAbandoned(const ImageCacheKey &key) const;
+};
@@ -0,0 +1,94 @@
+#include "ui/image/image-load-scheduler.hpp"
+#include <algorithm>
+#include <limits>
+
+ImageLoadScheduler &ImageLoadScheduler::instance() {
+  static ImageLoadScheduler scheduler;
+
+  return scheduler;
+}
+
+int ImageLoadScheduler::viewportDistance(const QWidget *widget) {
+  auto window = widget->window();
+  QRect bounds(widget->mapTo(window, QPoint(0, 0)), widget->size());
+  QRect viewport = window->rect();
+
+  // the widget can only be seen through the intersection of its ancestors
+  for (auto parent = widget->parentWidget(); parent && parent != window; parent = parent->parentWidget()) {
+    viewport &= QRect(parent->mapTo(window, QPoint(0, 0)), parent->size());
+  }
+
+  if (viewport.isEmpty()) return std::numeric_limits<int>::max();
+
+  int dx = std::max({0, viewport.left() - bounds.right(), bounds.left() - viewport.right()});
+  int dy = std::max({0, viewport.top() - bounds.bottom(), bounds.top() - viewport.bottom()});
+
+  return dx + dy;
+}
+
+void ImageLoadScheduler::schedule(AbstractImageLoader *loader, const RenderConfig &config,
+                                  const QWidget *target) {
+  Request request{.loader = loader, .config = config, .target = target, .distance = viewportDistance(target)};
+
+  cancel(loader);
+
+  // images in view are not worth the extra frame it takes to reach the event loop
+  if (request.distance == 0 && target->isVisible() && m_running.size() < MAX_CONCURRENT_LOADS) {
+    return start(request);
+  }
+
+  m_pending.emplace_back(request);
+  m_dispatchTimer->start();
+}
+
+void ImageLoadScheduler::start(const Request &request) {
+  auto loader = request.loader;
+
+  // animated images keep updating, only the first frame ends the load
+  connect(loader, &AbstractImageLoader::dataUpdated, this, [this, loader]() { finish(loader); });
+  connect(loader, &AbstractImageLoader::errorOccured, this, [this, loader]() { finish(loader); });
+  m_running.push_back(loader);
+  loader->setViewportDistance(request.distance);
+  loader->render(request.config);
+}
+
+void ImageLoadScheduler::cancel(AbstractImageLoader *loader) {
+  std::erase_if(m_pending, [&](const Request &request) { return request.loader == loader; });
+
+  if (std::ranges::find(m_running, loader) != m_running.end()) {
+    loader->abort();
+    finish(loader);
+  }
+}
+
+void ImageLoadScheduler::finish(AbstractImageLoader *loader) {
+  disconnect(loader, nullptr, this, nullptr);
+  std::erase(m_running, loader);
+
+  if (!m_pending.empty()) { m_dispatchTimer->start(); }
+}
+
+void ImageLoadScheduler::dispatch() {
+  // images of widgets that were hidden since are loaded again next time they are shown
+  std::erase_if(m_pending,
+                [](const Request &request) { return !request.target || !request.target->isVisible(); });
+
+  for (auto &request : m_pending) {
+    request.distance = viewportDistance(request.target);
+  }
+
+  // a loader that is done synchronously, or that errors out, can schedule or cancel requests as it starts
+  while (m_running.size() < MAX_CONCURRENT_LOADS && !m_pending.empty()) {
+    auto nearest = std::ranges::min_element(m_pending, {}, &Request::distance);
+    auto request = *nearest;
+
+    m_pending.erase(nearest);
+    start(request);
+  }
+}
+
+ImageLoadScheduler::ImageLoadScheduler() {
+  m_dispatchTimer->setSingleShot(true);
+  m_dispatchTimer->setInterval(0);
+  connect(m_dispatchTimer, &QTimer::timeout, this, &ImageLoadScheduler::dispatch);
+}
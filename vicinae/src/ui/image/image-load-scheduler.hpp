@@ -0,0 +1,64 @@
+#pragma once
+#include "ui/image/image.hpp"
+#include <qobject.h>
+#include <qpointer.h>
+#include <qtimer.h>
+#include <qwidget.h>
+#include <vector>
+
+/**
+ * Starts image loads on behalf of the widgets showing them, nearest to the viewport first and only
+ * a few at a time, so that scrolling quickly through a grid of thousands of images does not start a load
+ * for every cell that merely flew by.
+ *
+ * Loads of images that are not in view yet are started from the event loop rather than when they are
+ * scheduled: a widget that is hidden or destroyed by then, such as a cell that was recycled in the same
+ * scroll frame it was attached in, never starts its load. A load that was started is aborted if it is
+ * cancelled before it is done.
+ *
+ * Loaders are expected to be cancelled before they are destroyed.
+ */
+class ImageLoadScheduler : public QObject {
+  static constexpr size_t MAX_CONCURRENT_LOADS = 8;
+
+  struct Request {
+    AbstractImageLoader *loader;
+    RenderConfig config;
+    QPointer<const QWidget> target;
+    int distance;
+  };
+
+  std::vector<Request> m_pending;
+  std::vector<AbstractImageLoader *> m_running;
+  QTimer *m_dispatchTimer = new QTimer(this);
+
+  void dispatch();
+  void start(const Request &request);
+  void finish(AbstractImageLoader *loader);
+
+  ImageLoadScheduler();
+
+public:
+  static ImageLoadScheduler &instance();
+
+  /**
+   * Distance in pixels from `widget` to the part of its window it can be seen in, that is 0 if it is
+   * in view. Widgets placed just outside of a scroll area, such as rows prefetched by a list, are near.
+   */
+  static int viewportDistance(const QWidget *widget);
+
+  /**
+   * Render `loader` with `config` once `target`, the widget the image is for, is among the visible widgets
+   * that are the nearest to the viewport. This is right away if it is in view and few loads are running.
+   * Scheduling a loader again replaces its previous request.
+   */
+  void schedule(AbstractImageLoader *loader, const RenderConfig &config, const QWidget *target);
+
+  /**
+   * Forget about `loader`, aborting it if its load was started and is not done yet.
+   */
+  void cancel(AbstractImageLoader *loader);
+
+  size_t pendingCount() const { return m_pending.size(); }
+  size_t runningCount() const { return m_running.size(); }
+};
@@ -4,7 +4,10 @@
 #include "ui/image/http-image-loader.hpp"
 #include "ui/image/builtin-icon-loader.hpp"
 #include "ui/image/image.hpp"
+#include "ui/image/image-cache.hpp"
+#include "ui/image/image-load-scheduler.hpp"
 #include "ui/image/local-image-loader.hpp"
+#include "ui/image/thumbnail-image-loader.hpp"
 #include "ui/image/emoji-image-loader.hpp"
 #include "ui/image/qicon-image-loader.hpp"
 #include <qpainterpath.h>
@@ -12,6 +15,45 @@
 void ImageWidget::handleDataUpdated(const QPixmap &data) {
   m_data = data;
   update();
+
+  if (m_cacheState == LoadingForCache) {
+    auto &cache = ImageCache::instance();
+
+    m_cacheState = NotCached;
+
+    if (m_loader->animated()) {
+      cache.abandon(m_cacheKey, true);
+    } else {
+      cache.insert(m_cacheKey, data);
+    }
+  }
+}
+
+void ImageWidget::handleCachedImage(const ImageCacheKey &key, const QPixmap &data) {
+  if (m_cacheState != WaitingForCache || key != m_cacheKey) return;
+
+  releaseCache();
+  ImageLoadScheduler::instance().cancel(m_loader.get());
+
+  if (data.isNull()) { return handleLoadingError("Failed to load"); }
+
+  m_data = data;
+  update();
+}
+
+void ImageWidget::releaseCache() {
+  auto &cache = ImageCache::instance();
+
+  if (m_cacheState == LoadingForCache) { cache.abandon(m_cacheKey); }
+  if (m_cacheState == WaitingForCache) { disconnect(&cache, nullptr, this, nullptr); }
+
+  m_cacheState = NotCached;
+}
+
+void ImageWidget::cancelLoading() {
+  if (m_loader) { ImageLoadScheduler::instance().cancel(m_loader.get()); }
+
+  releaseCache();
 }
 
 void ImageWidget::render() {
@@ -19,11 +61,41 @@ void ImageWidget::render() {
 
   if (!m_loader) { return; }
 
+  // hidden widgets would otherwise claim loads they never get to start, they render once shown
+  if (!isVisible()) { return; }
+
   QSize drawableSize = rect().marginsRemoved(contentsMargins()).size();
+  // the ratio of the screen the widget is on, which is not the highest one of all screens
+  RenderConfig config{.size = drawableSize, .fit = m_fit, .devicePixelRatio = devicePixelRatio()};
+  auto &cache = ImageCache::instance();
 
   m_renderCount += 1;
-  m_loader->render(
-      RenderConfig{.size = drawableSize, .fit = m_fit, .devicePixelRatio = qApp->devicePixelRatio()});
+  cancelLoading();
+  cache.setDevicePixelRatio(config.devicePixelRatio);
+  m_cacheKey = ImageCache::key(m_source, config);
+
+  if (auto cached = cache.find(m_cacheKey); cached || (cached = cache.derive(m_cacheKey))) {
+    if (cached->isNull()) { return handleLoadingError("Failed to load"); }
+
+    m_data = *cached;
+    update();
+    return;
+  }
+
+  if (cache.cacheable(m_cacheKey)) {
+    if (!cache.claim(m_cacheKey)) {
+      m_cacheState = WaitingForCache;
+      connect(&cache, &ImageCache::imageLoaded, this, &ImageWidget::handleCachedImage);
+      connect(&cache, &ImageCache::loadAbandoned, this, [this](const ImageCacheKey &key) {
+        if (m_cacheState == WaitingForCache && key == m_cacheKey) { render(); }
+      });
+      return;
+    }
+
+    m_cacheState = LoadingForCache;
+  }
+
+  ImageLoadScheduler::instance().schedule(m_loader.get(), config, this);
 }
 
 void ImageWidget::setAlignment(Qt::Alignment alignment) {
@@ -46,34 +118,29 @@ ImageWidget::ImageWidget(QWidget *parent) : QWidget(parent) {
 }
 
 ImageWidget::~ImageWidget() {
-  if (m_loader) {
-    disconnect(m_loader.get());
-    m_loader->abort();
-  }
+  if (m_loader) { disconnect(m_loader.get()); }
+
+  cancelLoading();
 }
 
 const ImageURL &ImageWidget::url() const { return m_source; }
 
 void ImageWidget::refreshTheme(const ThemeInfo &theme) { setUrlImpl(m_source); }
 
-void ImageWidget::setUrlImpl(const ImageURL &url) {
+AbstractImageLoader *createImageLoader(const ImageURL &url) {
   auto &theme = ThemeService::instance().theme();
   auto type = url.type();
 
-  m_source = url;
-  m_data = {};
-  m_loader.reset();
-
   if (type == ImageURLType::Favicon) {
-    m_loader.reset(new FaviconImageLoader(url.name()));
+    return new FaviconImageLoader(url.name());
   }
 
   else if (type == ImageURLType::System) {
-    m_loader.reset(new QIconImageLoader(url.name(), url.param("theme")));
+    return new QIconImageLoader(url.name(), url.param("theme"));
   }
 
   else if (type == ImageURLType::DataURI) {
-    m_loader.reset(new DataUriImageLoader(QString("data:%1").arg(url.name())));
+    return new DataUriImageLoader(url.name());
   }
 
   else if (type == ImageURLType::Builtin) {
@@ -88,11 +155,14 @@ void ImageWidget::setUrlImpl(const ImageURL &url) {
       loader->setFillColor(url.fillColor());
     }
 
-    m_loader.reset(loader);
+    return loader;
   }
 
   else if (type == ImageURLType::Local) {
     std::filesystem::path path = url.name().toStdString();
+
+    if (url.param("thumbnail")) { return new ThumbnailImageLoader(path); }
+
     auto filename = path.filename().string();
     auto pos = filename.find('.');
     std::string suffixed;
@@ -108,19 +178,28 @@ void ImageWidget::setUrlImpl(const ImageURL &url) {
 
     if (std::filesystem::is_regular_file(suffixedPath)) { path = suffixedPath; }
 
-    m_loader.reset(new LocalImageLoader(path));
+    return new LocalImageLoader(path);
   }
 
   else if (type == ImageURLType::Http) {
     QUrl httpUrl("https://" + url.name());
 
-    m_loader.reset(new HttpImageLoader(httpUrl));
+    return new HttpImageLoader(httpUrl);
   }
 
   else if (type == ImageURLType::Emoji) {
-    m_loader.reset(new EmojiImageLoader(url.name()));
+    return new EmojiImageLoader(url.name());
   }
 
+  return nullptr;
+}
+
+void ImageWidget::setUrlImpl(const ImageURL &url) {
+  m_source = url;
+  m_data = {};
+  cancelLoading();
+  m_loader.reset(createImageLoader(url));
+
   if (!m_loader) { return handleLoadingError("No loader"); }
 
   if (m_loader) {
@@ -137,6 +216,11 @@ QSize ImageWidget::sizeHint() const {
 
 void ImageWidget::handleLoadingError(const QString &reason) {
   // qCritical() << "Failed to load" << reason;
+  if (m_cacheState == LoadingForCache) {
+    m_cacheState = NotCached;
+    ImageCache::instance().insert(m_cacheKey, {});
+  }
+
   if (auto fallback = m_source.fallback()) { return setUrl(*fallback); }
   return setUrl(ImageURL::builtin("question-mark-circle"));
 }
@@ -151,6 +235,22 @@ void ImageWidget::showEvent(QShowEvent *event) {
   render();
 }
 
+bool ImageWidget::event(QEvent *event) {
+  // moved to a screen of another scale, the image is most likely cached at it already
+  if (event->type() == QEvent::DevicePixelRatioChange) { render(); }
+
+  return QWidget::event(event);
+}
+
+void ImageWidget::hideEvent(QHideEvent *event) {
+  QWidget::hideEvent(event);
+
+  // the image is rendered again when shown, there is no point finishing a load nobody will see
+  cancelLoading();
+  // nor playing an animation nobody sees, it resumes when rendered again
+  if (m_loader && m_loader->animated()) { m_loader->abort(); }
+}
+
 void ImageWidget::paintEvent(QPaintEvent *event) {
   if (m_data.isNull()) return;
 
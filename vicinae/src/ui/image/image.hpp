@@ -18,6 +18,27 @@ struct RenderConfig {
   qreal devicePixelRatio = 1;
 };
 
+/**
+ * Everything the pixmap of an image depends on, see `ImageCache::key`. The fill color is part of the url.
+ */
+struct ImageCacheKey {
+  ImageURL url;
+  QString theme;
+  RenderConfig config;
+  size_t hash = 0;
+
+  bool operator==(const ImageCacheKey &rhs) const {
+    return hash == rhs.hash && config.size == rhs.config.size && config.fit == rhs.config.fit &&
+           config.devicePixelRatio == rhs.config.devicePixelRatio && theme == rhs.theme && url == rhs.url;
+  }
+};
+
+inline size_t qHash(const ImageCacheKey &key, size_t seed = 0) { return qHash(key.hash, seed); }
+
+template <> struct std::hash<ImageCacheKey> {
+  size_t operator()(const ImageCacheKey &key) const { return key.hash; }
+};
+
 class AbstractImageLoader : public QObject {
   Q_OBJECT
 
@@ -28,6 +49,17 @@ public:
    */
   void virtual render(const RenderConfig &config) = 0;
   void virtual abort() const {};
+
+  /**
+   * Whether the image keeps updating once rendered, which is only known once it started loading.
+   */
+  virtual bool animated() const { return false; }
+
+  /**
+   * How far from the viewport, in pixels, the image is shown. Loaders that queue their work start the
+   * nearest images first. Set by the scheduler right before render.
+   */
+  virtual void setViewportDistance(int distance) {}
   virtual ~AbstractImageLoader() {}
 
   void forwardSignals(AbstractImageLoader *other) const {
@@ -40,7 +72,20 @@ signals:
   void errorOccured(const QString &errorDescription) const;
 };
 
+/**
+ * Loader for the image `url` points to, which is not rendered yet, or nullptr if it has no known type.
+ */
+AbstractImageLoader *createImageLoader(const ImageURL &url);
+
 class ImageWidget : public QWidget {
+  enum CacheState {
+    NotCached,
+    // the image is loaded by this widget for everyone asking for it
+    LoadingForCache,
+    // the image is loaded by another widget
+    WaitingForCache,
+  };
+
   QObjectUniquePtr<AbstractImageLoader> m_loader;
   QPixmap m_data;
   ImageURL m_source;
@@ -50,12 +95,19 @@ class ImageWidget : public QWidget {
   QFlags<Qt::AlignmentFlag> m_alignment = Qt::AlignCenter;
   std::optional<ColorLike> m_backgroundColor;
   int m_borderRadius = 4;
+  ImageCacheKey m_cacheKey;
+  CacheState m_cacheState = NotCached;
 
   void paintEvent(QPaintEvent *event) override;
   void resizeEvent(QResizeEvent *event) override;
   void handleLoadingError(const QString &reason);
   void showEvent(QShowEvent *event) override;
+  void hideEvent(QHideEvent *event) override;
+  bool event(QEvent *event) override;
   void handleDataUpdated(const QPixmap &data);
+  void handleCachedImage(const ImageCacheKey &key, const QPixmap &data);
+  void releaseCache();
+  void cancelLoading();
   QSize sizeHint() const override;
   void setUrlImpl(const ImageURL &url);
   void refreshTheme(const ThemeInfo &theme);
@@ -23,4 +23,8 @@ void IODeviceImageLoader::render(const RenderConfig &cfg) {
   m_loader->render(cfg);
 }
 
+void IODeviceImageLoader::abort() const {
+  if (m_loader) { m_loader->abort(); }
+}
+
 IODeviceImageLoader::IODeviceImageLoader(QByteArray bytes) : m_data(bytes) {}
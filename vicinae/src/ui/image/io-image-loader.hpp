@@ -11,6 +11,8 @@ class IODeviceImageLoader : public AbstractImageLoader {
 
 public:
   void render(const RenderConfig &cfg) override;
+  void abort() const override;
+  bool animated() const override { return m_loader && m_loader->animated(); }
 
   IODeviceImageLoader(QByteArray bytes);
 };
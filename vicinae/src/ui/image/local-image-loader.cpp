@@ -1,14 +1,38 @@
 #include "ui/image/image.hpp"
 #include "local-image-loader.hpp"
+#include <qmimedatabase.h>
 
 void LocalImageLoader::render(const RenderConfig &cfg) {
-  QFile file(m_path);
+  QMimeDatabase mimeDb;
 
-  file.open(QIODevice::ReadOnly);
+  // animated images are played from memory by QMovie, everything else is read and decoded off the GUI
+  // thread, straight from the file
+  if (mimeDb.mimeTypeForFile(QString::fromStdString(m_path.string())).name() == "image/gif") {
+    QFile file(m_path);
 
-  m_loader = std::make_unique<IODeviceImageLoader>(file.readAll());
-  m_loader->forwardSignals(this);
-  m_loader->render(cfg);
+    if (!file.open(QIODevice::ReadOnly)) {
+      emit errorOccured(file.errorString());
+      return;
+    }
+
+    m_loader = std::make_unique<IODeviceImageLoader>(file.readAll());
+    m_loader->forwardSignals(this);
+    m_loader->render(cfg);
+    return;
+  }
+
+  decodeAsync([path = m_path, cfg]() {
+    QFile file(path);
+
+    if (!file.open(QIODevice::ReadOnly)) return QImage();
+
+    return decodeImage(file, cfg);
+  });
+}
+
+void LocalImageLoader::abort() const {
+  AsyncImageLoader::abort();
+  if (m_loader) { m_loader->abort(); }
 }
 
 LocalImageLoader::LocalImageLoader(const std::filesystem::path &path) { m_path = path; }
@@ -1,13 +1,16 @@
 #pragma once
+#include "ui/image/async-image-loader.hpp"
 #include "ui/image/image.hpp"
 #include "io-image-loader.hpp"
 
-class LocalImageLoader : public AbstractImageLoader {
+class LocalImageLoader : public AsyncImageLoader {
   std::unique_ptr<IODeviceImageLoader> m_loader;
   std::filesystem::path m_path;
 
 public:
   void render(const RenderConfig &cfg) override;
+  void abort() const override;
+  bool animated() const override { return m_loader && m_loader->animated(); }
 
   LocalImageLoader(const std::filesystem::path &path);
 };
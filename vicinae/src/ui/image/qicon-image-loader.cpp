@@ -1,10 +1,21 @@
 #include "qicon-image-loader.hpp"
+#include "ui/image/icon-raster-cache.hpp"
 
 void QIconImageLoader::render(const RenderConfig &config) {
+  auto &rasters = IconRasterCache::instance();
   QString savedTheme = QIcon::themeName();
 
   if (m_theme) { QIcon::setThemeName(*m_theme); }
 
+  QString theme = QIcon::themeName();
+
+  // resolving the icon through the theme is what is slow, much more than rendering it
+  if (auto image = rasters.find(m_icon, theme, config.size, config.devicePixelRatio)) {
+    QIcon::setThemeName(savedTheme);
+    emit dataUpdated(QPixmap::fromImage(*image));
+    return;
+  }
+
   auto icon = QIcon::fromTheme(m_icon);
 
   // If icon fails to resolve, try loading it from the filesystem (QIcon does not resolve icons not part of a
@@ -23,7 +34,10 @@ void QIconImageLoader::render(const RenderConfig &config) {
 
   // most likely SVG, we can request the size we want
   if (it == sizes.end()) {
-    emit dataUpdated(icon.pixmap(config.size));
+    auto pix = icon.pixmap(config.size);
+
+    rasters.insert(m_icon, theme, config.size, config.devicePixelRatio, pix.toImage());
+    emit dataUpdated(pix);
     QIcon::setThemeName(savedTheme);
     return;
   }
@@ -34,6 +48,7 @@ void QIconImageLoader::render(const RenderConfig &config) {
 
   pix.setDevicePixelRatio(config.devicePixelRatio);
   QIcon::setThemeName(savedTheme);
+  rasters.insert(m_icon, theme, config.size, config.devicePixelRatio, pix.toImage());
 
   emit dataUpdated(pix);
 }
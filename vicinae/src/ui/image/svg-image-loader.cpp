@@ -1,42 +1,48 @@
 #include "ui/image/image.hpp"
 #include "svg-image-loader.hpp"
 
-void SvgImageLoader::render(QPixmap &pixmap, const QRect &bounds) {
-  auto svgSize = m_renderer.defaultSize();
-  // QRect targetRect = QRect(QPoint(0, 0), svgSize.scaled(bounds.size(), Qt::KeepAspectRatio));
-
-  QPixmap filledSvg(bounds.size());
+void SvgImageLoader::rasterize(QImage &image, const QRect &bounds, QSvgRenderer &renderer,
+                               const std::optional<ColorLike> &fill) {
+  QImage filledSvg(bounds.size(), QImage::Format_ARGB32_Premultiplied);
 
   filledSvg.fill(Qt::transparent);
 
-  // first, we paint the filled svg on a separate pixmap
+  // first, we paint the filled svg on a separate image
   {
     OmniPainter painter(&filledSvg);
 
-    m_renderer.render(&painter, filledSvg.rect());
+    renderer.render(&painter, filledSvg.rect());
 
-    if (m_fill) {
+    if (fill) {
       painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-      painter.fillRect(filledSvg.rect(), *m_fill);
+      painter.fillRect(filledSvg.rect(), *fill);
     }
   }
 
-  QPainter painter(&pixmap);
+  QPainter painter(&image);
 
   painter.setRenderHint(QPainter::Antialiasing, true);
   painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
-  painter.drawPixmap(bounds, filledSvg);
+  painter.drawImage(bounds, filledSvg);
 }
 
 void SvgImageLoader::render(const RenderConfig &config) {
-  QPixmap pixmap(config.size * config.devicePixelRatio);
+  decodeAsync([data = m_data, filename = m_filename, fill = resolveColor(m_fill), config]() {
+    QSvgRenderer renderer;
+
+    if (filename.isEmpty() ? !renderer.load(data) : !renderer.load(filename)) return QImage();
+
+    QImage image(config.size * config.devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+
+    image.fill(Qt::transparent);
+    rasterize(image, image.rect(), renderer, fill);
+    image.setDevicePixelRatio(config.devicePixelRatio);
 
-  render(pixmap, pixmap.rect());
-  pixmap.setDevicePixelRatio(config.devicePixelRatio);
-  emit dataUpdated(pixmap);
+    return image;
+  });
 }
 
 void SvgImageLoader::setFillColor(const std::optional<ColorLike> &color) { m_fill = color; }
 
-SvgImageLoader::SvgImageLoader(const QByteArray &data) { m_renderer.load(data); }
-SvgImageLoader::SvgImageLoader(const QString &filename) { m_renderer.load(filename); }
+SvgImageLoader::SvgImageLoader(const QByteArray &data) : m_data(data) {}
+SvgImageLoader::SvgImageLoader(const QString &filename) : m_filename(filename) {}
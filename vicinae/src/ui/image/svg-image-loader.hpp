@@ -1,13 +1,21 @@
 #pragma once
+#include "ui/image/async-image-loader.hpp"
 #include "ui/image/image.hpp"
 #include <qsvgrenderer.h>
 
-class SvgImageLoader : public AbstractImageLoader {
-  QSvgRenderer m_renderer;
+class SvgImageLoader : public AsyncImageLoader {
+  QByteArray m_data;
+  QString m_filename;
   std::optional<ColorLike> m_fill;
 
 public:
-  void render(QPixmap &pixmap, const QRect &bounds);
+  /**
+   * Rasterize the svg `renderer` holds into `bounds` of `image`, filled with `fill` if set.
+   * This can be done from any thread, provided `fill` is resolved.
+   */
+  static void rasterize(QImage &image, const QRect &bounds, QSvgRenderer &renderer,
+                        const std::optional<ColorLike> &fill);
+
   void render(const RenderConfig &config) override;
   void setFillColor(const std::optional<ColorLike> &color);
 
@@ -0,0 +1,143 @@
+#include "ui/image/thumbnail-image-loader.hpp"
+#include "trace/trace.hpp"
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QUrl>
+#include <array>
+#include <qlogging.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct Flavor {
+  const char *dir;
+  int size;
+};
+
+// from the smallest to the biggest, as per the spec
+constexpr std::array<Flavor, 4> FLAVORS = {
+    {{"normal", 128}, {"large", 256}, {"x-large", 512}, {"xx-large", 1024}}};
+
+QString thumbnailDir() {
+  return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + "/thumbnails";
+}
+
+QImage fitImage(QImage image, const RenderConfig &config) {
+  QSize deviceSize = config.size * config.devicePixelRatio;
+
+  if (image.width() > deviceSize.width() || image.height() > deviceSize.height()) {
+    auto mode = config.fit == ObjectFitFill ? Qt::IgnoreAspectRatio : Qt::KeepAspectRatio;
+
+    image = image.scaled(deviceSize, mode, Qt::SmoothTransformation);
+  }
+
+  image.setDevicePixelRatio(config.devicePixelRatio);
+
+  return image;
+}
+
+/**
+ * The thumbnail at `path`, if it was made from the version of `uri` last modified at `mtime`.
+ */
+QImage readThumbnail(const QString &path, const QString &uri, const QString &mtime) {
+  if (!QFileInfo::exists(path)) return {};
+
+  QImageReader reader(path);
+
+  if (reader.text("Thumb::URI") != uri || reader.text("Thumb::MTime") != mtime) return {};
+
+  return reader.read();
+}
+
+/**
+ * Only the owner is to be able to read thumbnails of their files, new directories are made private.
+ */
+bool makePrivateDir(const fs::path &path) {
+  std::error_code ec;
+
+  if (fs::create_directory(path, ec)) { fs::permissions(path, fs::perms::owner_all, ec); }
+
+  return fs::is_directory(path, ec);
+}
+
+bool writeThumbnail(const QString &path, QImage image, const QFileInfo &info, const QString &uri,
+                    const QString &mtime) {
+  fs::path flavorDir = QFileInfo(path).path().toStdString();
+  std::error_code ec;
+
+  fs::create_directories(flavorDir.parent_path().parent_path(), ec);
+  if (!makePrivateDir(flavorDir.parent_path()) || !makePrivateDir(flavorDir)) return false;
+
+  // written to a temporary file first, for other apps never to read a partial thumbnail
+  QSaveFile file(path);
+
+  image.setText("Thumb::URI", uri);
+  image.setText("Thumb::MTime", mtime);
+  image.setText("Thumb::Size", QString::number(info.size()));
+  image.setText("Software", "vicinae");
+
+  if (!file.open(QIODevice::WriteOnly)) return false;
+
+  if (!image.save(&file, "PNG")) {
+    file.cancelWriting();
+    return false;
+  }
+
+  if (!file.commit()) return false;
+
+  return QFile::setPermissions(path, QFile::ReadOwner | QFile::WriteOwner);
+}
+
+QImage loadThumbnail(const fs::path &path, const RenderConfig &config) {
+  TraceScope trace("image", "thumbnail");
+  QSize deviceSize = config.size * config.devicePixelRatio;
+  int size = std::max(deviceSize.width(), deviceSize.height());
+  auto flavor = std::ranges::find_if(FLAVORS, [&](const Flavor &flavor) { return flavor.size >= size; });
+  QFileInfo info(QString::fromStdString(path.string()));
+  QFile file(info.filePath());
+  QString root = thumbnailDir();
+
+  // too big for any thumbnail, or a thumbnail itself, which is not to be thumbnailed again
+  if (flavor == FLAVORS.end() || info.absoluteFilePath().startsWith(root + "/")) {
+    if (!file.open(QIODevice::ReadOnly)) return {};
+    return decodeImage(file, config);
+  }
+
+  QString uri = QUrl::fromLocalFile(info.absoluteFilePath()).toString(QUrl::FullyEncoded);
+  QString mtime = QString::number(info.lastModified().toSecsSinceEpoch());
+  QString name = QCryptographicHash::hash(uri.toUtf8(), QCryptographicHash::Md5).toHex() + ".png";
+  auto thumbnailPath = [&](const Flavor &flavor) { return root + '/' + flavor.dir + '/' + name; };
+
+  // bigger thumbnails do too
+  for (auto it = flavor; it != FLAVORS.end(); ++it) {
+    QImage image = readThumbnail(thumbnailPath(*it), uri, mtime);
+
+    if (!image.isNull()) return fitImage(std::move(image), config);
+  }
+
+  if (!file.open(QIODevice::ReadOnly)) return {};
+
+  QImage image = decodeImage(file, {.size = QSize(flavor->size, flavor->size)});
+
+  if (image.isNull()) return image;
+
+  if (!writeThumbnail(thumbnailPath(*flavor), image, info, uri, mtime)) {
+    qDebug() << "Failed to save the thumbnail of" << info.filePath();
+  }
+
+  return fitImage(std::move(image), config);
+}
+
+} // namespace
+
+void ThumbnailImageLoader::render(const RenderConfig &cfg) {
+  decodeAsync([path = m_path, cfg]() { return loadThumbnail(path, cfg); });
+}
+
+ThumbnailImageLoader::ThumbnailImageLoader(const std::filesystem::path &path) : m_path(path) {}
@@ -0,0 +1,20 @@
+#pragma once
+#include "ui/image/async-image-loader.hpp"
+#include <filesystem>
+
+/**
+ * Image of a local file, shown from its thumbnail in the freedesktop thumbnail cache that file managers and
+ * other apps share (https://specifications.freedesktop.org/thumbnail-spec/latest/).
+ *
+ * A thumbnail is only used if it was made from the current version of the file, as told by its
+ * `Thumb::MTime`. Otherwise one is made from the file, off the GUI thread, and saved to the cache for the
+ * next time the file is shown, here or anywhere else.
+ */
+class ThumbnailImageLoader : public AsyncImageLoader {
+  std::filesystem::path m_path;
+
+public:
+  void render(const RenderConfig &cfg) override;
+
+  ThumbnailImageLoader(const std::filesystem::path &path);
+};
@@ -1,39 +1,173 @@
 #include "extend/image-model.hpp"
 #include "lib/emoji-detect.hpp"
 #include "services/asset-resolver/asset-resolver.hpp"
+#include <array>
 #include <qdir.h>
 #include <qstringview.h>
 #include <qurlquery.h>
+#include <string_view>
 #include "url.hpp"
 
+namespace {
+
+template <typename T> struct NamedValue {
+  std::u16string_view name;
+  T value;
+};
+
+/**
+ * Lookup of values by name in a table whose names all hash to a different slot, which is checked when the
+ * table is built. Lookups are a hash and a single comparison.
+ */
+template <typename T, size_t N, size_t SLOTS, size_t MULTIPLIER> class PerfectNameTable {
+  static constexpr uint8_t EMPTY = 0xFF;
+
+  std::array<NamedValue<T>, N> m_entries;
+  std::array<uint8_t, SLOTS> m_slots{};
+
+  static constexpr size_t slot(size_t size, char16_t first, char16_t last) {
+    return (size * MULTIPLIER + first + last) % SLOTS;
+  }
+
+public:
+  consteval PerfectNameTable(const std::array<NamedValue<T>, N> &entries) : m_entries(entries) {
+    m_slots.fill(EMPTY);
+
+    for (size_t i = 0; i != N; ++i) {
+      auto name = entries[i].name;
+      auto &slot = m_slots[PerfectNameTable::slot(name.size(), name.front(), name.back())];
+
+      // not a constant expression, which fails the build: change the multiplier or the slot count
+      if (slot != EMPTY) throw "names of the table collide";
+
+      slot = i;
+    }
+  }
+
+  std::optional<T> find(QStringView name) const {
+    if (name.isEmpty()) return std::nullopt;
+
+    auto index = m_slots[slot(name.size(), name.front().unicode(), name.back().unicode())];
+
+    if (index == EMPTY) return std::nullopt;
+
+    auto &entry = m_entries[index];
+
+    if (name != QStringView(entry.name.data(), entry.name.size())) return std::nullopt;
+
+    return entry.value;
+  }
+
+  QString nameFor(T value) const {
+    for (const auto &entry : m_entries) {
+      if (entry.value == value) return QString::fromUtf16(entry.name.data(), entry.name.size());
+    }
+
+    return {};
+  }
+};
+
+constexpr PerfectNameTable<ImageURLType, 6, 9, 7> ICON_TYPES({{
+    {u"favicon", Favicon},
+    {u"omnicast", Builtin},
+    {u"system", System},
+    {u"http", Http},
+    {u"https", Http},
+    {u"local", Local},
+}});
+
+constexpr PerfectNameTable<SemanticColor, 9, 13, 3> COLOR_TINTS({{
+    {u"blue", SemanticColor::Blue},
+    {u"green", SemanticColor::Green},
+    {u"magenta", SemanticColor::Magenta},
+    {u"orange", SemanticColor::Orange},
+    {u"purple", SemanticColor::Purple},
+    {u"red", SemanticColor::Red},
+    {u"yellow", SemanticColor::Yellow},
+    {u"primary-text", SemanticColor::TextPrimary},
+    {u"secondary-text", SemanticColor::TextSecondary},
+}});
+
+} // namespace
+
+SemanticColor ImageURL::tintForName(QStringView name) {
+  return COLOR_TINTS.find(name).value_or(SemanticColor::InvalidTint);
+}
+
+QString ImageURL::nameForTint(SemanticColor type) { return COLOR_TINTS.nameFor(type); }
+
+ImageURLType ImageURL::typeForName(QStringView name) {
+  return ICON_TYPES.find(name).value_or(ImageURLType::Invalid);
+}
+
+QString ImageURL::nameForType(ImageURLType type) { return ICON_TYPES.nameFor(type); }
+
+ImageURL::Data::Data(const Data &other)
+    : type(other.type), isValid(other.isValid), name(other.name), bgTint(other.bgTint), fgTint(other.fgTint),
+      mask(other.mask), fallback(other.fallback), fillColor(other.fillColor), params(other.params) {}
+
+bool ImageURL::Data::operator==(const Data &rhs) const {
+  return type == rhs.type && isValid == rhs.isValid && name == rhs.name && bgTint == rhs.bgTint &&
+         fgTint == rhs.fgTint && mask == rhs.mask && fallback == rhs.fallback && fillColor == rhs.fillColor &&
+         params == rhs.params;
+}
+
+ImageURL::Data &ImageURL::mutableData() {
+  if (d.use_count() != 1) { d = std::make_shared<Data>(*d); }
+
+  d->hash.store(0, std::memory_order_relaxed);
+
+  return *d;
+}
+
+size_t ImageURL::hash() const {
+  if (size_t hash = d->hash.load(std::memory_order_relaxed)) return hash;
+
+  size_t hash = qHashMulti(0, static_cast<int>(d->type), d->isValid, d->name, static_cast<int>(d->bgTint),
+                           static_cast<int>(d->fgTint), static_cast<int>(d->mask));
+
+  if (d->fallback) { hash = qHash(*d->fallback, hash); }
+  if (d->fillColor) { hash = colorHash(*d->fillColor, hash); }
+
+  for (const auto &[key, value] : d->params) {
+    hash = qHashMulti(hash, key, value);
+  }
+
+  // 0 stands for a hash that is not computed yet
+  hash = std::max<size_t>(hash, 1);
+  d->hash.store(hash, std::memory_order_relaxed);
+
+  return hash;
+}
+
 ImageURL &ImageURL::setFill(const std::optional<ColorLike> &color) {
-  _fillColor = color;
+  mutableData().fillColor = color;
   return *this;
 }
 
 ImageURL &ImageURL::setMask(OmniPainter::ImageMaskType mask) {
-  _mask = mask;
+  mutableData().mask = mask;
   return *this;
 }
 
 ImageURL &ImageURL::setForegroundTint(SemanticColor tint) {
-  _fgTint = tint;
+  mutableData().fgTint = tint;
   return *this;
 }
 ImageURL &ImageURL::setBackgroundTint(SemanticColor tint) {
-  _bgTint = tint;
+  mutableData().bgTint = tint;
   return *this;
 }
 
-ImageURLType ImageURL::type() const { return _type; }
-const QString &ImageURL::name() const { return _name; }
-SemanticColor ImageURL::foregroundTint() const { return _fgTint; }
-SemanticColor ImageURL::backgroundTint() const { return _bgTint; }
-const std::optional<ColorLike> &ImageURL::fillColor() const { return _fillColor; }
-OmniPainter::ImageMaskType ImageURL::mask() const { return _mask; }
+ImageURLType ImageURL::type() const { return d->type; }
+const QString &ImageURL::name() const { return d->name; }
+SemanticColor ImageURL::foregroundTint() const { return d->fgTint; }
+SemanticColor ImageURL::backgroundTint() const { return d->bgTint; }
+const std::optional<ColorLike> &ImageURL::fillColor() const { return d->fillColor; }
+OmniPainter::ImageMaskType ImageURL::mask() const { return d->mask; }
 
 ImageURL &ImageURL::withFallback(const ImageURL &fallback) {
-  _fallback = fallback.toString();
+  mutableData().fallback = fallback.toString();
   return *this;
 }
 
@@ -41,20 +175,20 @@ QUrl ImageURL::url() const {
   QUrl url;
 
   url.setScheme("icon");
-  url.setHost(nameForType(_type));
-  url.setPath("/" + _name);
+  url.setHost(nameForType(d->type));
+  url.setPath("/" + d->name);
 
   QUrlQuery query;
 
-  if (_fallback) query.addQueryItem("fallback", *_fallback);
-  if (_bgTint != InvalidTint) query.addQueryItem("bg_tint", nameForTint(_bgTint));
-  if (_fillColor) {
-    if (auto tint = std::get_if<SemanticColor>(&*_fillColor); tint && *tint != InvalidTint) {
+  if (d->fallback) query.addQueryItem("fallback", *d->fallback);
+  if (d->bgTint != InvalidTint) query.addQueryItem("bg_tint", nameForTint(d->bgTint));
+  if (d->fillColor) {
+    if (auto tint = std::get_if<SemanticColor>(&*d->fillColor); tint && *tint != InvalidTint) {
       query.addQueryItem("fill", nameForTint(*tint));
     }
   }
 
-  for (const auto &[k, v] : m_params) {
+  for (const auto &[k, v] : d->params) {
     query.addQueryItem(k, v);
   }
 
@@ -64,30 +198,40 @@ QUrl ImageURL::url() const {
 }
 
 ImageURL &ImageURL::param(const QString &name, const QString &value) {
-  m_params[name] = value;
+  mutableData().params[name] = value;
   return *this;
 }
 
 std::optional<QString> ImageURL::param(const QString &name) const {
-  if (auto it = m_params.find(name); it != m_params.end()) return it->second;
+  if (auto it = d->params.find(name); it != d->params.end()) return it->second;
 
   return std::nullopt;
 }
 
-void ImageURL::setType(ImageURLType type) { _type = type; }
-void ImageURL::setName(const QString &name) { _name = name; }
+void ImageURL::setType(ImageURLType type) { mutableData().type = type; }
+void ImageURL::setName(const QString &name) { mutableData().name = name; }
+
+bool ImageURL::operator==(const ImageURL &rhs) const {
+  return d == rhs.d || (hash() == rhs.hash() && *d == *rhs.d);
+}
+
+ImageURL::ImageURL(const QString &s) noexcept : ImageURL(QUrl(s)) {}
 
-bool ImageURL::operator==(const ImageURL &rhs) const { return toString() == rhs.toString(); }
+const std::shared_ptr<ImageURL::Data> &ImageURL::emptyData() {
+  static const auto empty = std::make_shared<Data>();
 
-ImageURL::ImageURL(const QString &s) noexcept { *this = std::move(QUrl(s)); }
+  return empty;
+}
 
-ImageURL::ImageURL() : _bgTint(InvalidTint), _fgTint(InvalidTint) {}
+ImageURL::ImageURL() {}
 
 ImageURL::ImageURL(const proto::ext::ui::Image &image) {
   using Source = proto::ext::ui::ImageSource;
   ExtensionImageModel model;
 
-  if (image.has_color_tint()) { model.tintColor = ImageURL::tintForName(image.color_tint().c_str()); }
+  if (image.has_color_tint()) {
+    model.tintColor = ImageURL::tintForName(QString::fromStdString(image.color_tint()));
+  }
   if (image.has_mask()) {
     switch (image.mask()) {
     case proto::ext::ui::ImageMask::Circle:
@@ -128,37 +272,39 @@ ImageURL::ImageURL(const proto::ext::ui::Image &image) {
   *this = ImageLikeModel(model);
 }
 
-ImageURL::ImageURL(const QUrl &url) : _bgTint(InvalidTint), _fgTint(InvalidTint), _mask(OmniPainter::NoMask) {
+ImageURL::ImageURL(const QUrl &url) {
   if (url.scheme() != "icon") { return; }
 
-  _type = typeForName(url.host());
+  auto type = typeForName(url.host());
 
-  if (_type == Invalid) { return; }
+  if (type == Invalid) { return; }
 
-  _name = url.path().sliced(1);
+  auto &data = mutableData();
+
+  data.type = type;
+  data.name = url.path().sliced(1);
 
   auto query = QUrlQuery(url.query());
 
-  if (auto fgTint = query.queryItemValue("fg_tint"); !fgTint.isEmpty()) { _fgTint = tintForName(fgTint); }
-  if (auto bgTint = query.queryItemValue("bg_tint"); !bgTint.isEmpty()) { _bgTint = tintForName(bgTint); }
-  if (auto fill = query.queryItemValue("fill"); !fill.isEmpty()) { _fillColor = tintForName(fill); }
-  if (auto fallback = query.queryItemValue("fallback"); !fallback.isEmpty()) { _fallback = fallback; }
+  if (auto tint = query.queryItemValue("fg_tint"); !tint.isEmpty()) { data.fgTint = tintForName(tint); }
+  if (auto tint = query.queryItemValue("bg_tint"); !tint.isEmpty()) { data.bgTint = tintForName(tint); }
+  if (auto fill = query.queryItemValue("fill"); !fill.isEmpty()) { data.fillColor = tintForName(fill); }
+  if (auto fallback = query.queryItemValue("fallback"); !fallback.isEmpty()) { data.fallback = fallback; }
   if (auto mask = query.queryItemValue("mask"); !mask.isEmpty()) {
     if (mask == "circle")
-      _mask = OmniPainter::ImageMaskType::CircleMask;
+      data.mask = OmniPainter::ImageMaskType::CircleMask;
     else if (mask == "roundedRectangle")
-      _mask = OmniPainter::ImageMaskType::RoundedRectangleMask;
+      data.mask = OmniPainter::ImageMaskType::RoundedRectangleMask;
   }
 
   for (const auto &[k, v] : query.queryItems()) {
-    m_params[k] = v;
+    data.params[k] = v;
   }
 
-  _isValid = true;
+  data.isValid = true;
 }
 
-ImageURL::ImageURL(const ImageLikeModel &imageLike)
-    : _bgTint(InvalidTint), _fgTint(InvalidTint), _mask(OmniPainter::NoMask) {
+ImageURL::ImageURL(const ImageLikeModel &imageLike) {
   if (auto image = std::get_if<ExtensionImageModel>(&imageLike)) {
     struct {
       QString operator()(const ThemedIconSource &icon) {
@@ -271,6 +417,10 @@ ImageURL ImageURL::local(const QString &path) {
 
 ImageURL ImageURL::local(const std::filesystem::path &path) { return local(QString(path.c_str())); }
 
+ImageURL ImageURL::thumbnail(const std::filesystem::path &path) {
+  return local(path).param("thumbnail", "true");
+}
+
 ImageURL ImageURL::http(const QUrl &httpUrl) {
   ImageURL url;
 
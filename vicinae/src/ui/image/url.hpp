@@ -3,41 +3,53 @@
 #include "proto/ui.pb.h"
 #include "theme.hpp"
 #include "ui/omni-painter/omni-painter.hpp"
+#include <atomic>
 #include <filesystem>
+#include <map>
+#include <memory>
+#include <qhashfunctions.h>
 #include <qstringview.h>
-#include <vector>
 #include <QString>
 
 enum ImageURLType { Invalid, Builtin, Favicon, System, Http, Local, Emoji, DataURI };
 
-static std::vector<std::pair<QString, ImageURLType>> iconTypes = {
-    {"favicon", Favicon}, {"omnicast", Builtin}, {"system", System},
-    {"http", Http},       {"https", Http},       {"local", Local},
-};
-
-static std::vector<std::pair<QString, SemanticColor>> colorTints = {
-    {"blue", SemanticColor::Blue},
-    {"green", SemanticColor::Green},
-    {"magenta", SemanticColor::Magenta},
-    {"orange", SemanticColor::Orange},
-    {"purple", SemanticColor::Purple},
-    {"red", SemanticColor::Red},
-    {"yellow", SemanticColor::Yellow},
-    {"primary-text", SemanticColor::TextPrimary},
-    {"secondary-text", SemanticColor::TextSecondary}};
-
+/**
+ * Copies of an image url share their payload, which is only copied when a shared one is modified: urls are
+ * passed around by value everywhere (items, accessories, models), and are the key images are cached by.
+ *
+ * The hash of the payload is computed the first time it is needed and kept with it, so that urls are cheap
+ * to hash and to compare again.
+ */
 class ImageURL {
-  ImageURLType _type = ImageURLType::Invalid;
-  bool _isValid = false;
-  QString _name;
-  SemanticColor _bgTint;
-  SemanticColor _fgTint;
-  OmniPainter::ImageMaskType _mask = OmniPainter::ImageMaskType::NoMask;
-  std::optional<QString> _fallback;
-  std::optional<ColorLike> _fillColor = std::nullopt;
-
-  // url dependant custom params
-  std::map<QString, QString> m_params;
+  struct Data {
+    ImageURLType type = ImageURLType::Invalid;
+    bool isValid = false;
+    QString name;
+    SemanticColor bgTint = SemanticColor::InvalidTint;
+    SemanticColor fgTint = SemanticColor::InvalidTint;
+    OmniPainter::ImageMaskType mask = OmniPainter::ImageMaskType::NoMask;
+    std::optional<QString> fallback;
+    std::optional<ColorLike> fillColor;
+    // url dependant custom params
+    std::map<QString, QString> params;
+    // 0 until computed, payloads that are shared across threads are not modified anymore
+    mutable std::atomic<size_t> hash = 0;
+
+    bool operator==(const Data &rhs) const;
+
+    Data() = default;
+    Data(const Data &other);
+  };
+
+  static const std::shared_ptr<Data> &emptyData();
+
+  // every url starts out sharing the same empty payload, which saves an allocation for those never set
+  std::shared_ptr<Data> d = emptyData();
+
+  /**
+   * The payload, for modification. It is copied first if other urls share it.
+   */
+  Data &mutableData();
 
 public:
   ImageURL &circle() {
@@ -45,44 +57,17 @@ public:
     return *this;
   }
 
-  static SemanticColor tintForName(const QString &name) {
-    for (const auto &[n, t] : colorTints) {
-      if (name == n) return t;
-    }
-
-    return SemanticColor::InvalidTint;
-  }
-
-  static QString nameForTint(SemanticColor type) {
-    for (const auto &[n, t] : colorTints) {
-      if (t == type) return n;
-    }
-
-    return {};
-  }
-
-  static ImageURLType typeForName(const QString &name) {
-    for (const auto &[n, t] : iconTypes) {
-      if (name == n) return t;
-    }
+  static SemanticColor tintForName(QStringView name);
+  static QString nameForTint(SemanticColor type);
+  static ImageURLType typeForName(QStringView name);
+  static QString nameForType(ImageURLType type);
 
-    return ImageURLType::Invalid;
-  }
-
-  static QString nameForType(ImageURLType type) {
-    for (const auto &[n, t] : iconTypes) {
-      if (t == type) return n;
-    }
-
-    return {};
-  }
-
-  bool isValid() { return _isValid; }
-  operator bool() { return isValid(); }
+  bool isValid() const { return d->isValid; }
+  operator bool() const { return isValid(); }
 
   QString toString() const { return url().toString(); }
 
-  std::optional<QString> fallback() const { return _fallback; }
+  std::optional<QString> fallback() const { return d->fallback; }
   ImageURL &withFallback(const ImageURL &fallback);
 
   QUrl url() const;
@@ -115,12 +100,25 @@ public:
   bool operator==(const ImageURL &rhs) const;
   operator QString() const { return toString(); }
 
+  size_t hash() const;
+
   static ImageURL builtin(const QString &name);
   static ImageURL favicon(const QString &domain);
   static ImageURL system(const QString &name);
   static ImageURL local(const QString &path);
   static ImageURL local(const std::filesystem::path &path);
+  /**
+   * Local image shown from its thumbnail in the freedesktop thumbnail cache, for previews of images that
+   * may be big.
+   */
+  static ImageURL thumbnail(const std::filesystem::path &path);
   static ImageURL http(const QUrl &httpUrl);
   static ImageURL emoji(const QString &emoji);
   static ImageURL rawData(const QByteArray &data, const QString &mimeType);
 };
+
+inline size_t qHash(const ImageURL &url, size_t seed = 0) { return qHash(url.hash(), seed); }
+
+template <> struct std::hash<ImageURL> {
+  size_t operator()(const ImageURL &url) const { return url.hash(); }
+};
@@ -16,15 +16,20 @@
 #include "../image/url.hpp"
 #include "vicinae.hpp"
 #include "services/config/config-service.hpp"
+#include "services/root-item-manager/root-item-manager.hpp"
+#include "service-registry.hpp"
 #include "overlay-controller/overlay-controller.hpp"
 #include "root-command.hpp"
 #include "ui/action-pannel/action.hpp"
 #include "ui/dialog/dialog.hpp"
 #include "ui/overlay/overlay.hpp"
 #include "ui/hud/hud.hpp"
+#include "ui/performance-hud/performance-hud.hpp"
+#include "ui/search-bar/search-bar.hpp"
 #include "ui/views/base-view.hpp"
 #include <QStackedWidget>
 #include "settings-controller/settings-controller.hpp"
+#include "startup-benchmark.hpp"
 
 void LauncherWindow::showEvent(QShowEvent *event) { m_hud->hide(); }
 
@@ -45,11 +50,16 @@ LauncherWindow::LauncherWindow(ApplicationContext &ctx) : m_ctx(ctx) {
   m_barDivider = new HDivider(this);
   m_hudDismissTimer = new QTimer(this);
   m_actionVeil = new ActionVeilWidget(this);
+  m_standbyTimer = new QTimer(this);
+  m_performanceHud = new PerformanceHud(this);
 
   m_header->setFixedHeight(Omnicast::TOP_BAR_HEIGHT);
   m_bar->setFixedHeight(Omnicast::STATUS_BAR_HEIGHT);
   m_hudDismissTimer->setInterval(1500ms);
   m_hudDismissTimer->setSingleShot(true);
+  // changes usually come in bursts, and asynchronous search results shortly after them
+  m_standbyTimer->setInterval(250ms);
+  m_standbyTimer->setSingleShot(true);
   m_dialog->hide();
 
   setupUI();
@@ -68,6 +78,7 @@ LauncherWindow::LauncherWindow(ApplicationContext &ctx) : m_ctx(ctx) {
   });
 
   connect(m_hudDismissTimer, &QTimer::timeout, this, [this]() { m_hud->fadeOut(); });
+  connect(m_header->input(), &QLineEdit::textEdited, this, []() { FrameMonitor::instance().recordInput(); });
 
   connect(m_ctx.navigation.get(), &NavigationController::actionPanelVisibilityChanged, this,
           [this](bool value) {
@@ -109,8 +120,23 @@ LauncherWindow::LauncherWindow(ApplicationContext &ctx) : m_ctx(ctx) {
   connect(m_ctx.navigation.get(), &NavigationController::actionsChanged, this,
           [this](auto &&actions) { m_actionPanel->setNewActions(actions); });
 
-  connect(m_ctx.navigation.get(), &NavigationController::windowVisiblityChanged, this,
-          [this](bool visible) { setVisible(visible); });
+  connect(m_ctx.navigation.get(), &NavigationController::windowVisiblityChanged, this, [this](bool visible) {
+    if (visible && !isVisible()) { m_showRequestTimer.start(); }
+    setVisible(visible);
+    if (!visible) { m_standbyTimer->start(); }
+  });
+
+  connect(m_standbyTimer, &QTimer::timeout, this, &LauncherWindow::renderStandby);
+
+  auto manager = ServiceRegistry::instance()->rootItemManager();
+  auto scheduleStandby = [this]() {
+    if (!isVisible()) { m_standbyTimer->start(); }
+  };
+
+  connect(manager, &RootItemManager::itemsChanged, this, scheduleStandby);
+  connect(manager, &RootItemManager::itemVisited, this, scheduleStandby);
+  connect(manager, &RootItemManager::itemFavoriteChanged, this, scheduleStandby);
+  connect(manager, &RootItemManager::itemRankingReset, this, scheduleStandby);
 
   ctx.navigation->pushView(new RootSearchView);
   ctx.navigation->setNavigationIcon(ImageURL::builtin("vicinae"));
@@ -130,6 +156,20 @@ LauncherWindow::LauncherWindow(ApplicationContext &ctx) : m_ctx(ctx) {
   });
 }
 
+void LauncherWindow::renderStandby() {
+  if (isVisible()) return;
+
+  QElapsedTimer timer;
+
+  timer.start();
+
+  // rendering a hidden widget sends it the resize events it has pending and activates its layouts
+  if (!testAttribute(Qt::WA_Resized)) { resize(minimumSize()); }
+  grab();
+
+  qDebug() << "Rendered hidden launcher window in" << timer.elapsed() << "ms";
+}
+
 void LauncherWindow::handleShowHUD(const QString &text, const std::optional<ImageURL> &icon) {
   m_hud->clear();
   m_hud->setText(text);
@@ -200,6 +240,16 @@ void LauncherWindow::handleViewChange(const NavigationController::ViewState &sta
 }
 
 bool LauncherWindow::event(QEvent *event) {
+  // posted by the repaint manager, the whole window is painted and flushed while it is handled
+  if (event->type() == QEvent::UpdateRequest && FrameMonitor::instance().isEnabled()) {
+    auto start = FrameMonitor::Clock::now();
+    bool handled = QMainWindow::event(event);
+
+    FrameMonitor::instance().recordFrame(start, FrameMonitor::Clock::now());
+
+    return handled;
+  }
+
   if (event->type() == QEvent::KeyPress) {
     auto keyEvent = static_cast<QKeyEvent *>(event);
 
@@ -213,6 +263,13 @@ bool LauncherWindow::event(QEvent *event) {
       return true;
     }
 
+    if (keyEvent->keyCombination() == QKeyCombination(Qt::ControlModifier | Qt::ShiftModifier, Qt::Key_P)) {
+      auto &monitor = FrameMonitor::instance();
+
+      monitor.setEnabled(!monitor.isEnabled());
+      return true;
+    }
+
     if (keyEvent->keyCombination() == QKeyCombination(Qt::ControlModifier, Qt::Key_Comma)) {
       m_ctx.navigation->closeWindow();
       m_ctx.settings->openWindow();
@@ -260,6 +317,11 @@ void LauncherWindow::handleActionVisibilityChanged(bool visible) {
 }
 
 void LauncherWindow::paintEvent(QPaintEvent *event) {
+  if (m_showRequestTimer.isValid() && isVisible()) {
+    qInfo() << "Launcher window painted" << m_showRequestTimer.elapsed() << "ms after it was requested";
+    m_showRequestTimer.invalidate();
+  }
+
   auto &config = ServiceRegistry::instance()->config()->value();
   auto &theme = ThemeService::instance().theme();
   int borderWidth = 2;
@@ -285,6 +347,8 @@ void LauncherWindow::paintEvent(QPaintEvent *event) {
   } else {
     painter.fillRect(rect(), finalBgColor);
   }
+
+  if (isVisible()) { StartupBenchmark::instance().reach(StartupBenchmark::WINDOW_PAINTED); }
 }
 
 QWidget *LauncherWindow::createWidget() const {
@@ -1,6 +1,7 @@
 #pragma once
 #include "../image/url.hpp"
 #include <qdebug.h>
+#include <qelapsedtimer.h>
 #include <qevent.h>
 #include <qlogging.h>
 #include <qmainwindow.h>
@@ -20,6 +21,7 @@ class DialogWidget;
 class DialogContentWidget;
 class HDivider;
 class ImageURL;
+class PerformanceHud;
 
 class ActionVeilWidget : public QWidget {
   Q_OBJECT
@@ -33,6 +35,11 @@ signals:
   void mousePressed() const;
 };
 
+/**
+ * The launcher window is kept ready while it is hidden: what changes in the meantime is laid out and painted
+ * offscreen, so that showing it only has to map the window. The time it takes for the window to be painted
+ * once it was requested is logged.
+ */
 class LauncherWindow : public QMainWindow {
 
 public:
@@ -51,6 +58,7 @@ private:
   ActionPanelV2Widget *m_actionPanel = nullptr;
   GlobalHeader *m_header = nullptr;
   HudWidget *m_hud = nullptr;
+  PerformanceHud *m_performanceHud = nullptr;
   QTimer *m_hudDismissTimer = nullptr;
   HDivider *m_barDivider = nullptr;
   GlobalBar *m_bar = nullptr;
@@ -60,10 +68,18 @@ private:
   QStackedWidget *m_currentOverlayWrapper = nullptr;
   DialogWidget *m_dialog = nullptr;
   QWidget *m_focusWidget = nullptr;
+  QTimer *m_standbyTimer = nullptr;
+  QElapsedTimer m_showRequestTimer;
 
   void handleShowHUD(const QString &text, const std::optional<ImageURL> &icon);
   void handleDialog(DialogContentWidget *alert);
   void handleViewChange(const NavigationController::ViewState &state);
   void setupUI();
+
+  /**
+   * Lay out and paint the hidden window, filling the caches used to paint it, such as laid out text and
+   * loaded icons. Painting the window next time it is shown then mostly comes down to blitting them.
+   */
+  void renderStandby();
   QWidget *createWidget() const;
 };
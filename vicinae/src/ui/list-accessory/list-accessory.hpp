@@ -13,6 +13,8 @@ struct ListAccessory {
   QString tooltip;
   bool fillBackground;
   std::optional<ImageURL> icon;
+
+  bool operator==(const ListAccessory &) const = default;
 };
 
 class ListAccessoryWidget : public QWidget {
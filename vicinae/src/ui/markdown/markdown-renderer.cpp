@@ -2,6 +2,7 @@
 #include "service-registry.hpp"
 #include "theme.hpp"
 #include "ui/image/http-image-loader.hpp"
+#include "ui/image/image-cache.hpp"
 #include "ui/image/image.hpp"
 #include "ui/image/local-image-loader.hpp"
 #include "ui/scroll-bar/scroll-bar.hpp"
@@ -15,6 +16,7 @@
 #include <qpixmap.h>
 #include <qplaintextedit.h>
 #include <qresource.h>
+#include <qscrollbar.h>
 #include <qsize.h>
 #include <qsqlquery.h>
 #include <qstringview.h>
@@ -74,54 +76,129 @@ void MarkdownRenderer::insertImage(cmark_node *node) {
   int widthOffset = documentMargin * 4;
   QSize iconSize(size().width() - widthOffset, size().height() - documentMargin * 2);
 
-  for (const auto &attr : widthAttributes) {
-    if (auto value = query.queryItemValue(attr); !value.isEmpty()) {
-      iconSize.setWidth(value.toInt());
-      break;
-    }
-  }
+  bool hasExplicitSize = true;
 
-  for (const auto &attr : heightAttributes) {
-    if (auto value = query.queryItemValue(attr); !value.isEmpty()) {
-      iconSize.setHeight(value.toInt());
-      break;
+  auto attribute = [&](const std::vector<const char *> &attributes) -> std::optional<int> {
+    for (const auto &attr : attributes) {
+      if (auto value = query.queryItemValue(attr); !value.isEmpty()) { return value.toInt(); }
     }
-  }
+
+    hasExplicitSize = false;
+    return std::nullopt;
+  };
+
+  if (auto width = attribute(widthAttributes)) { iconSize.setWidth(*width); }
+  if (auto height = attribute(heightAttributes)) { iconSize.setHeight(*height); }
 
   for (const auto &attr : tintAttributes) {
     // implement for tint
   }
 
   std::unique_ptr<AbstractImageLoader> imageLoader;
+  ImageURL source;
 
   if (url.scheme() == "https") {
     imageLoader = std::make_unique<HttpImageLoader>(url);
+    source = ImageURL::http(url);
   } else {
     std::filesystem::path path = QString("%1%2").arg(url.host()).arg(url.path()).toStdString();
 
     imageLoader = std::make_unique<LocalImageLoader>(path);
+    source = ImageURL::local(path);
   }
 
+  RenderConfig config{.size = iconSize, .devicePixelRatio = devicePixelRatio()};
+  ImageCacheKey cacheKey = ImageCache::key(source, config);
   auto pos = _cursor.position();
 
-  connect(imageLoader.get(), &AbstractImageLoader::dataUpdated, this, [this, url, pos](const QPixmap &pix) {
-    auto old = _cursor.position();
+  // the document may be in the cache by the time the image is loaded
+  auto showLoadedImage = [document = _document, budget = m_imageBytes, url, pos,
+                          counted = false](const QPixmap &pix) mutable {
+    // animated images update their frame, which replaces the previous one
+    if (!counted) {
+      qsizetype bytes = qsizetype(pix.width()) * pix.height() * pix.depth() / 8;
+
+      if (*budget + bytes > MAX_IMAGE_BYTES_PER_DOCUMENT) {
+        qWarning() << "Not showing markdown image" << url << "as the document has too many images";
+        return;
+      }
+
+      *budget += bytes;
+      counted = true;
+    }
+
+    showImage(document, pos, url, pix);
+  };
+
+  connect(imageLoader.get(), &AbstractImageLoader::dataUpdated, this, showLoadedImage);
+
+  // loaded as it is scrolled into view, this keeps its place in the meantime
+  QTextImageFormat placeholder;
+
+  placeholder.setName(IMAGE_PLACEHOLDER_NAME);
+
+  if (hasExplicitSize) {
+    placeholder.setWidth(iconSize.width());
+    placeholder.setHeight(iconSize.height());
+  }
+
+  _cursor.insertImage(placeholder);
+  m_images.push_back({.cursorPos = pos,
+                      .icon = std::move(imageLoader),
+                      .name = url,
+                      .config = config,
+                      .cacheKey = cacheKey});
+  m_imageLoadTimer->start();
+}
 
-    _cursor.setPosition(pos);
-    _document->addResource(QTextDocument::ImageResource, url, pix);
+void MarkdownRenderer::showImage(QTextDocument *document, int pos, const QUrl &url, const QPixmap &pixmap) {
+  QTextCursor cursor(document);
 
-    QTextBlockFormat blockFormat = _cursor.blockFormat();
+  cursor.setPosition(pos);
+  cursor.movePosition(QTextCursor::NextCharacter, QTextCursor::KeepAnchor);
+  document->addResource(QTextDocument::ImageResource, url, pixmap);
 
-    blockFormat.setAlignment(Qt::AlignCenter);
+  QTextBlockFormat blockFormat = cursor.blockFormat();
 
-    _cursor.setBlockFormat(blockFormat);
-    _cursor.insertImage(url.toString());
-    _cursor.setPosition(old);
-    _document->markContentsDirty(0, _document->characterCount());
-  });
+  blockFormat.setAlignment(Qt::AlignCenter);
 
-  imageLoader->render({.size = iconSize, .devicePixelRatio = devicePixelRatio()});
-  m_images.push_back({.cursorPos = pos, .icon = std::move(imageLoader)});
+  cursor.setBlockFormat(blockFormat);
+  cursor.insertImage(url.toString());
+  document->markContentsDirty(0, document->characterCount());
+}
+
+void MarkdownRenderer::loadVisibleImages() {
+  auto layout = _document->documentLayout();
+  int viewportHeight = _textEdit->viewport()->height();
+  int top = _textEdit->verticalScrollBar()->value() - viewportHeight;
+  int bottom = _textEdit->verticalScrollBar()->value() + viewportHeight * 2;
+
+  for (auto &image : m_images) {
+    if (image.requested) continue;
+
+    // a renderer that grows as required shows everything, whatever scrolls it is not known here
+    if (!m_growAsRequired) {
+      QRectF bounds = layout->blockBoundingRect(_document->findBlock(image.cursorPos));
+
+      if (bounds.bottom() < top || bounds.top() > bottom) continue;
+    }
+
+    image.requested = true;
+
+    // images of the document are shared with everything else showing them at the same size
+    if (auto cached = ImageCache::instance().find(image.cacheKey); cached && !cached->isNull()) {
+      emit image.icon->dataUpdated(*cached);
+      continue;
+    }
+
+    connect(
+        image.icon.get(), &AbstractImageLoader::dataUpdated, this,
+        [key = image.cacheKey, loader = image.icon.get()](const QPixmap &pix) {
+          if (!loader->animated()) { ImageCache::instance().insert(key, pix); }
+        },
+        Qt::SingleShotConnection);
+    image.icon->render(image.config);
+  }
 }
 
 void MarkdownRenderer::insertCodeBlock(cmark_node *node, bool isClosing) {
@@ -349,9 +426,13 @@ void MarkdownRenderer::clear() {
   _document->clear();
   _markdown.clear();
   _document->setDefaultFont(m_font);
+  addImagePlaceholder(_document);
 }
 
-void MarkdownRenderer::setBasePointSize(int pointSize) { _basePointSize = pointSize; }
+void MarkdownRenderer::setBasePointSize(int pointSize) {
+  _basePointSize = pointSize;
+  m_documentCache.clear();
+}
 
 void MarkdownRenderer::appendMarkdown(QStringView markdown) {
   auto oldScroll = _textEdit->verticalScrollBar()->value();
@@ -372,6 +453,10 @@ void MarkdownRenderer::appendMarkdown(QStringView markdown) {
     _cursor.setPosition(_lastNodePosition.renderedText);
     _cursor.movePosition(QTextCursor::End, QTextCursor::KeepAnchor);
     _cursor.removeSelectedText();
+    // images of the last node are loaded again as it is rendered again
+    std::erase_if(m_images, [&](const ImageResource &image) {
+      return image.cursorPos >= _lastNodePosition.renderedText;
+    });
   } else {
     fragment = markdown.toString();
   }
@@ -442,22 +527,106 @@ void MarkdownRenderer::appendMarkdown(QStringView markdown) {
   }
 }
 
-void MarkdownRenderer::setMarkdown(QStringView markdown) {
+void MarkdownRenderer::render(QStringView markdown) {
   m_isFirstBlock = true;
   m_images.clear();
+  m_imageBytes = std::make_shared<qsizetype>(0);
   clear();
   appendMarkdown(markdown);
   _cursor.setPosition(0);
   _textEdit->verticalScrollBar()->setValue(0);
   _textEdit->setTextCursor(_cursor);
-  qreal height = _document->size().height();
 
   if (m_growAsRequired) { setFixedHeight(_document->size().height()); }
 }
 
+QTextDocument *MarkdownRenderer::createDocument() const {
+  auto document = new QTextDocument;
+
+  document->setUseDesignMetrics(true);
+  document->setDocumentMargin(_document->documentMargin());
+  document->setDefaultFont(m_font);
+  addImagePlaceholder(document);
+
+  return document;
+}
+
+void MarkdownRenderer::addImagePlaceholder(QTextDocument *document) {
+  // drawn at the size of the image if it is known, or as a single transparent pixel
+  QImage placeholder(1, 1, QImage::Format_ARGB32_Premultiplied);
+
+  placeholder.fill(Qt::transparent);
+  document->addResource(QTextDocument::ImageResource, QUrl(IMAGE_PLACEHOLDER_NAME), placeholder);
+}
+
+bool MarkdownRenderer::restoreDocument(const QString &markdown) {
+  RenderedDocument *cached = m_documentCache.take(markdown);
+
+  // laid out for another size, images would not fit
+  if (cached && cached->size != size()) {
+    delete cached;
+    cached = nullptr;
+  }
+
+  if (!_markdown.isEmpty()) {
+    auto current = new RenderedDocument{.size = size(),
+                                        .document = std::unique_ptr<QTextDocument>(_document),
+                                        .images = std::move(m_images),
+                                        .lastNodePosition = _lastNodePosition,
+                                        .lastNodeType = _lastNodeType,
+                                        .isFirstBlock = m_isFirstBlock,
+                                        .imageBytes = std::move(m_imageBytes)};
+
+    m_images.clear();
+    m_imageBytes = std::make_shared<qsizetype>(0);
+    m_documentCache.insert(_markdown, current);
+    _document = cached ? cached->document.release() : createDocument();
+  } else if (cached) {
+    delete _document;
+    _document = cached->document.release();
+  }
+
+  _textEdit->setDocument(_document);
+  _cursor = QTextCursor(_document);
+
+  if (!cached) return false;
+
+  _markdown = markdown;
+  m_images = std::move(cached->images);
+  _lastNodePosition = cached->lastNodePosition;
+  _lastNodeType = cached->lastNodeType;
+  m_isFirstBlock = cached->isFirstBlock;
+  m_imageBytes = std::move(cached->imageBytes);
+  delete cached;
+  m_imageLoadTimer->start();
+
+  _textEdit->verticalScrollBar()->setValue(0);
+  _textEdit->setTextCursor(_cursor);
+
+  if (m_growAsRequired) { setFixedHeight(_document->size().height()); }
+
+  return true;
+}
+
+void MarkdownRenderer::setMarkdown(QStringView markdown) {
+  if (markdown == _markdown) return;
+
+  if (!_markdown.isEmpty() && markdown.startsWith(_markdown)) {
+    appendMarkdown(markdown.sliced(_markdown.size()));
+
+    if (m_growAsRequired) { setFixedHeight(_document->size().height()); }
+    return;
+  }
+
+  QString text = markdown.toString();
+
+  if (!restoreDocument(text)) { render(text); }
+}
+
 void MarkdownRenderer::setFont(const QFont &font) {
   _document->setDefaultFont(font);
   m_font = font;
+  m_documentCache.clear();
 }
 
 void MarkdownRenderer::setGrowAsRequired(bool value) { m_growAsRequired = value; }
@@ -486,7 +655,19 @@ MarkdownRenderer::MarkdownRenderer()
   _basePointSize = config->value().font.baseSize;
 
   connect(config, &ConfigService::configChanged, this,
-          [this, config]() { _basePointSize = config->value().font.baseSize; });
+          [this](const ConfigService::Value &next, const ConfigService::Value &prev,
+                 ConfigService::Sections changed) {
+            if (changed.testFlag(ConfigService::FontSection)) { setBasePointSize(next.font.baseSize); }
+          });
+  // cached documents are formatted with the colors of the theme they were rendered with
+  connect(&ThemeService::instance(), &ThemeService::themeChanged, this,
+          [this]() { m_documentCache.clear(); });
 
   _cursor = QTextCursor(_document);
+
+  m_imageLoadTimer->setSingleShot(true);
+  m_imageLoadTimer->setInterval(0);
+  connect(m_imageLoadTimer, &QTimer::timeout, this, &MarkdownRenderer::loadVisibleImages);
+  connect(_textEdit->verticalScrollBar(), &QScrollBar::valueChanged, m_imageLoadTimer,
+          qOverload<>(&QTimer::start));
 }
@@ -2,6 +2,7 @@
 #include "../image/url.hpp"
 #include "ui/image/image.hpp"
 #include <QTextBlock>
+#include <qcache.h>
 #include <qlogging.h>
 #include <qnamespace.h>
 #include <qplaintextedit.h>
@@ -13,6 +14,7 @@
 #include <qtextedit.h>
 #include <qtextformat.h>
 #include <qtextlist.h>
+#include <qtimer.h>
 #include <qurl.h>
 #include <qwidget.h>
 
@@ -24,11 +26,38 @@ struct ImageResource {
   int cursorPos;
   std::unique_ptr<AbstractImageLoader> icon;
   QUrl name;
+  RenderConfig config;
+  ImageCacheKey cacheKey;
+  bool requested = false;
 };
 
 class MarkdownRenderer : public QWidget {
   constexpr static float HEADING_LEVEL_SCALE_FACTORS[5] = {2, 1.6, 1.3, 1.16, 1};
   constexpr static int DEFAULT_BASE_POINT_SIZE = 12;
+  constexpr static int MAX_CACHED_DOCUMENTS = 16;
+  // images past this are not shown, a listing with hundreds of screenshots would otherwise take it all
+  constexpr static qsizetype MAX_IMAGE_BYTES_PER_DOCUMENT = 48 * 1024 * 1024;
+  constexpr static const char *IMAGE_PLACEHOLDER_NAME = "vicinae-markdown-image-placeholder";
+
+  struct NodePosition {
+    int originalMarkdown;
+    int renderedText;
+  };
+
+  /**
+   * A document rendered before, kept around so that switching back to the same markdown
+   * (as list details do when the selection moves back and forth) does not render it again.
+   */
+  struct RenderedDocument {
+    QSize size;
+    std::unique_ptr<QTextDocument> document;
+    // destroyed first, images that are still loading write into the document
+    std::vector<ImageResource> images;
+    NodePosition lastNodePosition;
+    int lastNodeType;
+    bool isFirstBlock;
+    std::shared_ptr<qsizetype> imageBytes;
+  };
 
   std::vector<ImageResource> m_images;
   QString _markdown;
@@ -42,11 +71,14 @@ class MarkdownRenderer : public QWidget {
   bool m_isFirstBlock = true;
 
   int _lastNodeType = CMARK_NODE_NONE;
+  NodePosition _lastNodePosition;
 
-  struct {
-    int originalMarkdown;
-    int renderedText;
-  } _lastNodePosition;
+  // bytes taken by the images of the current document, shared with the loaders that fill it
+  std::shared_ptr<qsizetype> m_imageBytes = std::make_shared<qsizetype>(0);
+  QTimer *m_imageLoadTimer = new QTimer(this);
+
+  // keyed by markdown, which QCache looks up by hash
+  QCache<QString, RenderedDocument> m_documentCache{MAX_CACHED_DOCUMENTS};
 
   int getHeadingLevelPointSize(int level) const;
 
@@ -62,6 +94,24 @@ class MarkdownRenderer : public QWidget {
 
   void insertIfNotFirstBlock();
 
+  static void addImagePlaceholder(QTextDocument *document);
+  static void showImage(QTextDocument *document, int pos, const QUrl &url, const QPixmap &pixmap);
+
+  /**
+   * Load the images that are in view, or about to be. Images of documents that are scrolled through
+   * are loaded as they come into view, instead of all at once as the document is built.
+   */
+  void loadVisibleImages();
+
+  QTextDocument *createDocument() const;
+  void render(QStringView markdown);
+
+  /**
+   * Put the current document in the cache and show the one cached for `markdown` instead.
+   * Returns false if there is no such document, in which case an empty document is shown.
+   */
+  bool restoreDocument(const QString &markdown);
+
 public:
   void setGrowAsRequired(bool value);
   void setDocumentMargin(int margin) { _document->setDocumentMargin(margin); }
@@ -80,7 +130,7 @@ public:
   void resizeEvent(QResizeEvent *event) override {
     QWidget::resizeEvent(event);
     _textEdit->setFixedSize(event->size());
-    setMarkdown(QString(_markdown));
+    render(QString(_markdown));
   }
 
   void setBaseTextColor(const ColorLike &color);
@@ -96,6 +146,11 @@ public:
    * or emulate a typewriting effect.
    */
   void appendMarkdown(QStringView markdown);
+
+  /**
+   * Markdown that starts with the current markdown is appended, so that content streamed by setting
+   * the whole text again and again is only parsed from its last block.
+   */
   void setMarkdown(QStringView markdown);
 
   MarkdownRenderer();
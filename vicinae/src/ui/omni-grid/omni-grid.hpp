@@ -85,6 +85,7 @@ public:
 
   public:
     void setInset(GridItemContentWidget::Inset inset) { m_inset = inset; }
+    GridItemContentWidget::Inset inset() const { return m_inset; }
 
     AbstractGridItem() : m_inset(GridItemContentWidget::Inset::Small) {}
   };
@@ -0,0 +1,290 @@
+#include "ui/omni-list/omni-list-benchmark.hpp"
+#include "extension/manager/extension-tracer.hpp"
+#include "ui/image/image.hpp"
+#include "ui/omni-grid/omni-grid.hpp"
+#include "ui/omni-list/omni-list.hpp"
+#include "ui/performance-hud/performance-hud.hpp"
+#include <QApplication>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QKeyEvent>
+#include <QWheelEvent>
+#include <array>
+#include <thread>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace OmniListBenchmark {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+constexpr auto FRAME_INTERVAL = microseconds(16'667);
+constexpr std::array<size_t, 3> ITEM_COUNTS = {1'000, 10'000, 100'000};
+constexpr size_t ITEMS_PER_SECTION = 100;
+constexpr size_t DIVIDER_INTERVAL = 25;
+constexpr int GRID_COLUMNS = 8;
+// the size of the list in the launcher window
+constexpr QSize VIEWPORT_SIZE{770, 420};
+
+constexpr size_t WHEEL_FRAMES = 120;
+constexpr size_t KEY_FRAMES = 120;
+constexpr size_t JUMP_FRAMES = 30;
+constexpr size_t RESET_FRAMES = 10;
+
+constexpr std::array ICONS = {"hammer", "folder", "link", "cog", "calendar"};
+
+enum class View { WidgetList, PaintedList, Grid };
+
+const char *viewName(View view) {
+  switch (view) {
+  case View::WidgetList:
+    return "list";
+  case View::PaintedList:
+    return "painted-list";
+  case View::Grid:
+    return "grid";
+  }
+
+  return "unknown";
+}
+
+class BenchmarkListItem : public AbstractDefaultListItem {
+  size_t m_index;
+
+public:
+  QString generateId() const override { return QString::number(m_index); }
+
+  ItemData data() const override {
+    ItemData data{.iconUrl = ImageURL::builtin(ICONS[m_index % ICONS.size()]),
+                  .name = QString("Item %1").arg(m_index),
+                  .subtitle = QString("Subtitle of item %1").arg(m_index)};
+
+    if (m_index % 3 == 0) { data.accessories.push_back({.text = QString::number(m_index)}); }
+    if (m_index % 5 == 0) { data.accessories.push_back({.text = "Tag", .fillBackground = true}); }
+    if (m_index % 7 == 0) { data.alias = "alias"; }
+
+    return data;
+  }
+
+  BenchmarkListItem(size_t index) : m_index(index) {}
+};
+
+class BenchmarkGridItem : public OmniGrid::AbstractGridItem {
+  size_t m_index;
+
+  QString title() const override { return QString("Cell %1").arg(m_index); }
+
+  QWidget *centerWidget() const override {
+    auto icon = new ImageWidget;
+
+    icon->setUrl(ImageURL::builtin(ICONS[m_index % ICONS.size()]));
+
+    return icon;
+  }
+
+  void recycleCenterWidget(QWidget *widget) const override {
+    static_cast<ImageWidget *>(widget)->setUrl(ImageURL::builtin(ICONS[m_index % ICONS.size()]));
+  }
+
+public:
+  QString generateId() const override { return QString::number(m_index); }
+
+  BenchmarkGridItem(size_t index) : m_index(index) {}
+};
+
+int64_t heapInUse() {
+#ifdef __GLIBC__
+  return static_cast<int64_t>(mallinfo2().uordblks);
+#else
+  return 0;
+#endif
+}
+
+/**
+ * Every `stride`th item of `count`, which is how filtering the list looks like to it.
+ */
+void fillModel(OmniList &list, View view, size_t count, size_t stride = 1) {
+  list.updateModel(
+      [&]() {
+        for (size_t begin = 0; begin < count; begin += ITEMS_PER_SECTION) {
+          auto &section = list.addSection(QString("Section %1").arg(begin / ITEMS_PER_SECTION));
+          size_t end = std::min(begin + ITEMS_PER_SECTION, count);
+
+          if (view == View::Grid) {
+            section.setColumns(GRID_COLUMNS);
+            section.setSpacing(10);
+          }
+
+          for (size_t i = begin; i < end; i += stride) {
+            if (view == View::Grid) {
+              section.addItem(std::make_shared<BenchmarkGridItem>(i));
+              continue;
+            }
+
+            if (i != begin && i % DIVIDER_INTERVAL == 0) { section.addDivider(); }
+            section.addItem(std::make_shared<BenchmarkListItem>(i));
+          }
+        }
+      },
+      OmniList::PreserveSelection);
+}
+
+struct Result {
+  const char *scenario;
+  size_t frames = 0;
+  LatencyHistogram frame;
+  LatencyHistogram calculateHeights;
+  LatencyHistogram updateVisibleItems;
+  size_t createdWidgets = 0;
+  microseconds elapsed{0};
+  int64_t heapGrowth = 0;
+};
+
+QJsonObject latencyToJson(const LatencyHistogram &latency) {
+  return QJsonObject{{"count", qint64(latency.count())},
+                     {"meanUs", qint64(latency.mean().count())},
+                     {"p50Us", qint64(latency.percentile(0.5).count())},
+                     {"p95Us", qint64(latency.percentile(0.95).count())},
+                     {"p99Us", qint64(latency.percentile(0.99).count())},
+                     {"maxUs", qint64(latency.max().count())}};
+}
+
+/**
+ * Run `frames` frames, feeding the list the input of every frame with `input` before letting it handle
+ * what is due and painting it.
+ */
+Result runFrames(OmniList &list, const char *scenario, size_t frames,
+                 const std::function<void(size_t frame)> &input) {
+  Result result{.scenario = scenario, .frames = frames};
+  auto &monitor = FrameMonitor::instance();
+
+  monitor.setSink([&result](FrameMonitor::Metric metric, microseconds duration) {
+    if (metric == FrameMonitor::Metric::CalculateHeights) { result.calculateHeights.add(duration); }
+    if (metric == FrameMonitor::Metric::UpdateVisibleItems) { result.updateVisibleItems.add(duration); }
+  });
+  monitor.setEnabled(true);
+
+  size_t createdWidgets = list.createdWidgetCount();
+  int64_t heap = heapInUse();
+  auto start = Clock::now();
+  auto deadline = start;
+
+  for (size_t i = 0; i != frames; ++i) {
+    auto frameStart = Clock::now();
+
+    input(i);
+    QCoreApplication::processEvents();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    list.repaint();
+
+    auto frameEnd = Clock::now();
+
+    result.frame.add(duration_cast<microseconds>(frameEnd - frameStart));
+    deadline += FRAME_INTERVAL;
+
+    // a late frame pushes the following ones back, as it would on screen
+    if (frameEnd < deadline) {
+      std::this_thread::sleep_until(deadline);
+    } else {
+      deadline = frameEnd;
+    }
+  }
+
+  result.elapsed = duration_cast<microseconds>(Clock::now() - start);
+  result.createdWidgets = list.createdWidgetCount() - createdWidgets;
+  result.heapGrowth = heapInUse() - heap;
+  monitor.setEnabled(false);
+  monitor.setSink({});
+
+  return result;
+}
+
+QJsonArray runView(View view, size_t count) {
+  std::unique_ptr<OmniList> list =
+      view == View::Grid ? std::make_unique<OmniGrid>() : std::make_unique<OmniList>();
+  QJsonArray results;
+
+  if (view == View::PaintedList) { list->setRowRendering(OmniList::PaintedRows); }
+
+  list->resize(VIEWPORT_SIZE);
+  list->show();
+
+  std::vector<Result> runs;
+  auto center = QPointF(VIEWPORT_SIZE.width() / 2.0, VIEWPORT_SIZE.height() / 2.0);
+  // spreads the jumps over the whole list without depending on a random number generator
+  auto jumpTarget = [count](size_t frame) { return (frame * 7919 + 13) % count; };
+
+  runs.emplace_back(runFrames(*list, "populate", 1, [&](size_t) { fillModel(*list, view, count); }));
+
+  list->selectFirst();
+  runs.emplace_back(runFrames(*list, "wheel", WHEEL_FRAMES, [&](size_t frame) {
+    // a notch every other frame, a wheel spun steadily
+    if (frame % 2) return;
+
+    QWheelEvent event(center, list->mapToGlobal(center), QPoint(), QPoint(0, -120), Qt::NoButton,
+                      Qt::NoModifier, Qt::NoScrollPhase, false);
+
+    QApplication::sendEvent(list.get(), &event);
+  }));
+
+  runs.emplace_back(runFrames(*list, "page-jump", JUMP_FRAMES, [&](size_t frame) {
+    list->setSelected(QString::number(jumpTarget(frame)), OmniList::ScrollAbsolute);
+  }));
+
+  list->selectFirst();
+  runs.emplace_back(runFrames(*list, "held-key", KEY_FRAMES, [&](size_t frame) {
+    // what moving through a grid most often amounts to as well
+    QKeyEvent event(QEvent::KeyPress, Qt::Key_Down, Qt::NoModifier, QString(), frame != 0);
+
+    QApplication::sendEvent(list.get(), &event);
+  }));
+
+  runs.emplace_back(runFrames(*list, "model-reset", RESET_FRAMES, [&](size_t frame) {
+    // alternating between the whole list and half of it, as when typing and erasing a character
+    fillModel(*list, view, count, frame % 2 ? 1 : 2);
+  }));
+
+  for (const auto &run : runs) {
+    double seconds = run.elapsed.count() / 1e6;
+
+    results.append(QJsonObject{
+        {"view", viewName(view)},
+        {"items", qint64(count)},
+        {"scenario", run.scenario},
+        {"frames", qint64(run.frames)},
+        {"frame", latencyToJson(run.frame)},
+        {"calculateHeights", latencyToJson(run.calculateHeights)},
+        {"updateVisibleItems", latencyToJson(run.updateVisibleItems)},
+        {"widgetsCreated", qint64(run.createdWidgets)},
+        {"widgetsCreatedPerSecond", seconds > 0 ? run.createdWidgets / seconds : 0.0},
+        {"heapGrowthBytes", qint64(run.heapGrowth)},
+    });
+  }
+
+  return results;
+}
+
+} // namespace
+
+QJsonDocument run() {
+  QJsonArray results;
+
+  for (auto count : ITEM_COUNTS) {
+    for (auto view : {View::WidgetList, View::PaintedList, View::Grid}) {
+      for (const auto &result : runView(view, count)) {
+        results.append(result);
+      }
+    }
+  }
+
+  return QJsonDocument(QJsonObject{{"platform", QGuiApplication::platformName()},
+                                   {"frameIntervalUs", qint64(FRAME_INTERVAL.count())},
+                                   {"results", results}});
+}
+
+} // namespace OmniListBenchmark
@@ -0,0 +1,20 @@
+#pragma once
+#include <QJsonDocument>
+
+namespace OmniListBenchmark {
+
+/**
+ * Scroll through and navigate synthetic lists and grids of 1k, 10k and 100k items the way a user would,
+ * one input per frame, and report how long frames take, how long `calculateHeights` and
+ * `updateVisibleItems` take within them, how many widgets had to be created for lack of one to reuse and
+ * how much the heap grew.
+ *
+ * Lists mix sections, dividers and items with icons and accessories, and are run with both row renderings.
+ * Inputs are paced at 60 frames per second: a frame is the time it takes for the input and whatever timers
+ * are due to be handled and for the list to be painted, the rest of the interval is slept through.
+ *
+ * Meant to be run offscreen, where nothing else competes for the event loop.
+ */
+QJsonDocument run();
+
+} // namespace OmniListBenchmark
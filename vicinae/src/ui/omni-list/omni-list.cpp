@@ -1,11 +1,13 @@
 #include "omni-list.hpp"
-#include "timer.hpp"
+#include "ui/default-list-item-widget/default-list-item-painter.hpp"
 #include "ui/list-section-header.hpp"
 #include "ui/omni-list/omni-list-item-widget-wrapper.hpp"
+#include "ui/performance-hud/performance-hud.hpp"
+#include "trace/trace.hpp"
 #include <algorithm>
-#include <chrono>
 #include <qabstractitemview.h>
 #include <qapplication.h>
+#include <qcursor.h>
 #include <qevent.h>
 #include <qlogging.h>
 #include <qnamespace.h>
@@ -34,6 +36,10 @@ bool OmniList::AbstractVirtualItem::isSection() const { return role() == ListRol
 
 size_t OmniList::AbstractVirtualItem::typeId() const { return typeid(*this).hash_code(); }
 
+void AbstractDefaultListItem::paint(OmniPainter &painter, const QRect &rect) const {
+  DefaultListItemPainter::instance().paint(painter, rect, data());
+}
+
 void OmniList::itemClicked(int index) { setSelectedIndex(index); }
 
 void OmniList::itemDoubleClicked(int index) const { emit itemActivated(*m_items[index].item); }
@@ -55,165 +61,217 @@ void OmniList::updateFocusChain() {
   }
 }
 
-void OmniList::updateVisibleItems() {
+QRect OmniList::viewportBounds(const VirtualWidgetInfo &info) const {
+  int scrollHeight = scrollBar->value();
+  int marginOffset = std::max(0, margins.top - scrollHeight);
 
-  m_visibleWidgets.clear();
-  if (m_items.empty()) return;
-  setUpdatesEnabled(false);
+  return QRect(info.x, marginOffset + m_rows.prefix(info.row) - scrollHeight, info.width, info.height);
+}
 
+int OmniList::indexAt(const QPoint &pos) const {
   int scrollHeight = scrollBar->value();
-  size_t startIndex = 0;
+  int marginOffset = std::max(0, margins.top - scrollHeight);
+
+  if (!rect().contains(pos) || pos.y() < marginOffset) return -1;
+
+  size_t row = m_rows.find(pos.y() - marginOffset + scrollHeight);
+
+  if (row >= m_rowItems.size()) return -1;
+
+  for (size_t index = m_rowItems[row]; index < m_items.size() && m_items[index].row == row; ++index) {
+    auto &info = m_items[index];
 
-  while (startIndex < m_items.size() && !isInViewport(m_items.at(startIndex).bounds)) {
-    ++startIndex;
+    if (pos.x() >= info.x && pos.x() < info.x + info.width) return index;
   }
 
-  if (startIndex >= m_items.size()) {
-    visibleIndexRange = VisibleRangeV2::empty();
-    return;
+  return -1;
+}
+
+bool OmniList::needsWidget(size_t index) const {
+  if (m_rowRendering == WidgetRows || !m_items[index].item->paintable()) return true;
+
+  return static_cast<int>(index) == m_selected || static_cast<int>(index) == m_hoveredIndex;
+}
+
+size_t OmniList::firstVisibleIndex() const {
+  size_t row = m_rows.find(scrollBar->value());
+
+  return row < m_rowItems.size() ? m_rowItems[row] : m_items.size();
+}
+
+OmniList::CachedWidget OmniList::attachWidget(const AbstractVirtualItem &item) {
+  if (item.recyclable()) {
+    CachedWidget cache{.recyclingId = item.recyclingId()};
+    auto detached = std::ranges::find(m_detachedWidgets, cache.recyclingId, &CachedWidget::recyclingId);
+
+    if (detached != m_detachedWidgets.end()) {
+      cache.widget = detached->widget;
+      *detached = m_detachedWidgets.back();
+      m_detachedWidgets.pop_back();
+      item.recycle(cache.widget->widget());
+      item.attached(cache.widget->widget());
+
+      return cache;
+    }
+
+    if (auto wrapper = takeFromPool(cache.recyclingId)) {
+      wrapper->setParent(this);
+      item.recycle(wrapper->widget());
+      item.attached(wrapper->widget());
+      wrapper->blockSignals(false);
+      wrapper->setUpdatesEnabled(true);
+      cache.widget = wrapper;
+
+      return cache;
+    }
   }
 
-  auto &cell = m_items[startIndex];
-  int marginOffset = std::max(0, margins.top - scrollHeight);
-  QSize viewportSize = size();
-  size_t endIndex = startIndex;
+  auto widget = new OmniListItemWidgetWrapper(this);
 
-  std::unordered_set<QString> reused;
+  ++m_createdWidgetCount;
+  connect(widget, &OmniListItemWidgetWrapper::clicked, this, &OmniList::itemClicked, Qt::UniqueConnection);
+  connect(widget, &OmniListItemWidgetWrapper::doubleClicked, this, &OmniList::itemDoubleClicked,
+          Qt::UniqueConnection);
+  connect(widget, &OmniListItemWidgetWrapper::rightClicked, this, &OmniList::rightClicked,
+          Qt::UniqueConnection);
+  widget->stackUnder(scrollBar);
+  OmniListItemWidget *w = item.createWidget();
+  widget->setWidget(w);
+  item.attached(w);
 
-  // we perform a first scan to mark all cached widgets with an ID in range
-  // so that we can reuse them directly. Calling refresh() on a widget with the same ID
-  // is very likely to be a no-op.
+  return {.widget = widget, .recyclingId = item.recyclable() ? item.recyclingId() : 0};
+}
 
-  int viewportY = marginOffset + cell.bounds.y() - scrollHeight;
-  int lastY = -1;
+void OmniList::releaseWidget(const CachedWidget &cache) {
+  if (cache.recyclingId) {
+    moveToPool(cache.recyclingId, cache.widget);
+  } else {
+    cache.widget->deleteLater();
+  }
+}
 
-  while (endIndex < m_items.size()) {
-    auto &vinfo = m_items[endIndex];
-    auto cacheIt = _widgetCache.find(vinfo.item->id());
+void OmniList::updateVisibleItems() {
+  FrameMonitor::Scope monitor(FrameMonitor::Metric::UpdateVisibleItems);
+  TraceScope trace("layout", "updateVisibleItems");
 
-    if (lastY != -1 && lastY != vinfo.bounds.y()) { viewportY += vinfo.bounds.y() - lastY; }
+  m_visibleWidgets.clear();
+  measureItemsNearViewport();
 
-    if (viewportY >= viewportSize.height()) break;
+  int scrollHeight = scrollBar->value();
+  int marginOffset = std::max(0, margins.top - scrollHeight);
+  int viewportHeight = height();
+  size_t startIndex = firstVisibleIndex();
+  size_t endIndex = startIndex;
 
-    if (cacheIt != _widgetCache.end()) reused.insert(vinfo.item->id());
+  // the layout may have moved under the cursor
+  if (m_rowRendering == PaintedRows) {
+    m_hoveredIndex = isVisible() ? indexAt(mapFromGlobal(QCursor::pos())) : -1;
+  }
 
-    lastY = vinfo.bounds.y();
+  while (endIndex < m_items.size() &&
+         marginOffset + m_rows.prefix(m_items[endIndex].row) - scrollHeight < viewportHeight) {
     ++endIndex;
   }
 
-  lastY = -1;
-  viewportY = marginOffset + cell.bounds.y() - scrollHeight;
-  endIndex = startIndex;
-
-  while (endIndex < m_items.size()) {
-    auto &vinfo = m_items[endIndex];
-    auto cacheIt = _widgetCache.find(vinfo.item->id());
-    OmniListItemWidgetWrapper *widget = nullptr;
+  if (scrollHeight != m_lastScrollValue) {
+    m_scrollingUp = scrollHeight < m_lastScrollValue;
+    m_lastScrollValue = scrollHeight;
+  }
 
-    if (lastY != -1 && lastY != vinfo.bounds.y()) { viewportY += vinfo.bounds.y() - lastY; }
+  // the rows about to scroll into view get their widget ahead of time, for their images to be loaded
+  // by the time they are in view
+  size_t attachStart = startIndex;
+  size_t attachEnd = endIndex;
 
-    if (viewportY >= viewportSize.height()) break;
+  // while scrolling is animated, so do the rows the next frame is expected to bring into view
+  int nextFrameDelta = std::clamp(m_scrollAnimator->nextFrameDelta(), -viewportHeight, viewportHeight);
+  auto rowTop = [&](size_t index) {
+    return marginOffset + m_rows.prefix(m_items[index].row) - scrollHeight;
+  };
 
-    bool isWidgetCreated = false;
+  for (size_t prefetched = 0;; ++prefetched) {
+    if (m_scrollingUp && attachStart > 0) {
+      if (prefetched >= PREFETCH_ROWS && rowTop(attachStart) <= nextFrameDelta) break;
 
-    auto start = std::chrono::high_resolution_clock::now();
+      size_t row = m_items[attachStart - 1].row;
 
-    if (cacheIt == _widgetCache.end()) {
-      bool recycled = false;
-      // TODO: find a more efficient solution, this is doing too much map stuff
-      for (const auto &[key, cache] : _widgetCache) {
-        bool reserved = reused.find(key) != reused.end();
+      while (attachStart > 0 && m_items[attachStart - 1].row == row) {
+        --attachStart;
+      }
+    } else if (!m_scrollingUp && attachEnd < m_items.size()) {
+      if (prefetched >= PREFETCH_ROWS && rowTop(attachEnd) >= viewportHeight + nextFrameDelta) break;
 
-        if (!reserved && vinfo.item->recyclable() && vinfo.item->recyclingId() == cache.recyclingId) {
-          vinfo.item->recycle(cache.widget->widget());
-          vinfo.item->attached(cache.widget->widget());
-          widget = cache.widget;
-          _widgetCache[vinfo.item->id()] = cache;
-          reused.insert(vinfo.item->id());
-          // qDebug() << "placed to reused" << vinfo.item->id();
-          _widgetCache.erase(key);
+      size_t row = m_items[attachEnd].row;
 
-          // qInfo() << "recycled in place" << vinfo.item->id();
-          recycled = true;
-          break;
-        }
+      while (attachEnd < m_items.size() && m_items[attachEnd].row == row) {
+        ++attachEnd;
       }
+    } else {
+      break;
+    }
+  }
 
-      if (!recycled) {
-        if (auto wrapper = takeFromPool(vinfo.item->recyclingId())) {
-          wrapper->setParent(this);
-          vinfo.item->recycle(wrapper->widget());
-          vinfo.item->attached(wrapper->widget());
-          wrapper->blockSignals(false);
-          wrapper->setUpdatesEnabled(true);
-          widget = wrapper;
-        } else {
-          widget = new OmniListItemWidgetWrapper(this);
-          connect(widget, &OmniListItemWidgetWrapper::clicked, this, &OmniList::itemClicked,
-                  Qt::UniqueConnection);
-          connect(widget, &OmniListItemWidgetWrapper::doubleClicked, this, &OmniList::itemDoubleClicked,
-                  Qt::UniqueConnection);
-          connect(widget, &OmniListItemWidgetWrapper::rightClicked, this, &OmniList::rightClicked,
-                  Qt::UniqueConnection);
-          widget->stackUnder(scrollBar);
-          OmniListItemWidget *w = vinfo.item->createWidget();
-          widget->setWidget(w);
-          vinfo.item->attached(w);
-        }
+  // items that stay in view keep their widget, which is very likely to be up to date: the other widgets
+  // are detached, for the items coming into view to be shown in
+  for (size_t index : m_attachedItems) {
+    if (index >= attachStart && index < attachEnd) continue;
+
+    auto &info = m_items[index];
 
-        CachedWidget cache{.widget = widget, .recyclingId = 0};
+    m_detachedWidgets.emplace_back(info.widget);
+    info.widget = {};
+  }
 
-        if (vinfo.item->recyclable()) { cache.recyclingId = vinfo.item->recyclingId(); }
+  m_attachedItems.clear();
+  setUpdatesEnabled(false);
 
-        isWidgetCreated = true;
-        reused.insert(vinfo.item->id());
-        _widgetCache[vinfo.item->id()] = cache;
+  for (size_t index = attachStart; index != attachEnd; ++index) {
+    auto &vinfo = m_items[index];
+    bool inView = index >= startIndex && index < endIndex;
+
+    if (!needsWidget(index)) {
+      if (vinfo.widget.widget) {
+        m_detachedWidgets.emplace_back(vinfo.widget);
+        vinfo.widget = {};
       }
-    } else {
-      widget = cacheIt->second.widget;
+      continue;
     }
 
-    QPoint pos(vinfo.bounds.x(), viewportY);
-    QSize size(vinfo.bounds.width(), vinfo.bounds.height());
+    if (!vinfo.widget.widget) { vinfo.widget = attachWidget(*vinfo.item); }
 
-    // qDebug() << "pos" << pos << "size" << size << "index" << endIndex << vinfo.item->id();
+    auto widget = vinfo.widget.widget;
+    QRect bounds = viewportBounds(vinfo);
+    QPoint pos = bounds.topLeft();
+    QSize size = bounds.size();
 
     widget->blockSignals(true);
-    widget->setIndex(endIndex);
-    widget->setSelected(endIndex == m_selected);
+    widget->setIndex(index);
+    widget->setSelected(index == m_selected);
     if (widget->size() != size) { widget->resize(size); }
     widget->move(pos);
     widget->show();
-
-    /*
-qDebug() << "Widget" << vinfo.item->id() << "visible:" << widget->isVisible()
-         << "parent:" << widget->parent() << "geometry:" << widget->geometry()
-         << "enabled:" << widget->isEnabled();
-                     */
     widget->blockSignals(false);
 
-    lastY = vinfo.bounds.y();
-    m_visibleWidgets.emplace_back(widget);
-    reused.insert(vinfo.item->id());
-
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 1e6;
-    ++endIndex;
+    if (inView) { m_visibleWidgets.emplace_back(widget); }
+    m_attachedItems.push_back(index);
   }
 
-  for (auto it = _widgetCache.begin(); it != _widgetCache.end();) {
-    if (auto match = reused.find(it->first); match == reused.end()) {
-      it->second.widget->deleteLater();
-      it = _widgetCache.erase(it);
-    } else {
-      ++it;
-    }
+  for (const auto &detached : m_detachedWidgets) {
+    releaseWidget(detached);
   }
 
+  m_detachedWidgets.clear();
   setUpdatesEnabled(true);
   recalculateMousePosition();
   updateFocusChain();
   this->visibleIndexRange = {startIndex, endIndex - startIndex};
+
+  if (m_rowRendering == PaintedRows) { update(); }
+
+  bool itemsNearEnd = m_nearEndItems > 0 && m_items.size() - endIndex <= m_nearEndItems;
+
+  if (itemsNearEnd && !m_itemsNearEnd) { emit scrolledNearEnd(); }
+  m_itemsNearEnd = itemsNearEnd;
 }
 
 bool OmniList::isDividableContent(const ModelItem &item) {
@@ -224,13 +282,10 @@ bool OmniList::isDividableContent(const ModelItem &item) {
   return false;
 }
 
-void OmniList::calculateHeights() {
-  Timer timer;
-
-  int yOffset = 0;
+KeyedDiff OmniList::calculateHeights() {
+  FrameMonitor::Scope monitor(FrameMonitor::Metric::CalculateHeights);
+  TraceScope trace("layout", "calculateHeights");
   int availableWidth = width() - margins.left - margins.right;
-  std::optional<SectionCalculationContext> sctx;
-  std::unordered_map<QString, CachedWidget> updatedCache;
 
   auto view = m_model | std::views::filter([](const auto &item) {
                 return std::holds_alternative<std::unique_ptr<Section>>(item);
@@ -240,24 +295,33 @@ void OmniList::calculateHeights() {
               });
   auto totalSize = std::ranges::fold_left(view, 0, std::plus<size_t>());
 
-  m_items.reserve(totalSize);
+  std::swap(m_items, m_previousItems);
   m_items.clear();
+  m_items.reserve(totalSize);
+  m_rows.clear();
+  m_rows.reserve(totalSize);
+  m_rowItems.clear();
+  m_rowItems.reserve(totalSize);
   visibleIndexRange = VisibleRangeV2::empty();
 
+  auto addRow = [&](int height) {
+    m_rowItems.push_back(m_items.size());
+    m_rows.push(height);
+  };
+
   size_t i = -1;
 
   for (const auto &item : m_model) {
     ++i;
     if (auto divider = std::get_if<Divider>(&item)) {
-      if (yOffset == 0) continue;
+      if (m_rows.total() == 0) continue;
       if (i + 1 == m_model.size() || !isDividableContent(m_model.at(i + 1))) continue;
 
-      int height = divider->item()->calculateHeight(availableWidth);
-      QRect bounds(0, yOffset, width(), height);
-      VirtualWidgetInfo vinfo{.bounds = bounds, .item = divider->item()};
+      VirtualWidgetInfo vinfo{.item = divider->item(), .row = m_rows.size(), .x = 0, .width = width()};
 
+      calculateItemHeight(vinfo);
+      addRow(vinfo.height);
       m_items.push_back(vinfo);
-      yOffset += height;
     } else if (auto p = std::get_if<std::unique_ptr<Section>>(&item)) {
       auto &section = *p;
 
@@ -267,13 +331,21 @@ void OmniList::calculateHeights() {
 
       if (items.empty()) continue;
 
-      sctx = {.x = margins.left, .maxHeight = 0};
-
       size_t shownCount = 0;
+      int x = margins.left;
+      // height of the row being filled, only added once it is complete
+      std::optional<int> rowHeight;
+
+      auto endRow = [&]() {
+        if (rowHeight) { m_rows.push(*rowHeight); }
+        rowHeight.reset();
+        x = margins.left;
+      };
 
       for (auto &sectionItem : items) {
         if (auto spacer = std::get_if<Spacer>(&sectionItem)) {
-          yOffset += spacer->value;
+          endRow();
+          addRow(spacer->value);
           continue;
         }
 
@@ -284,132 +356,180 @@ void OmniList::calculateHeights() {
           // considered)
           if (shownCount == 0) {
             if (auto header = section->headerItem(); header && !section->title().isEmpty()) {
-              int height = header->calculateHeight(availableWidth);
-              QRect geometry(margins.left, yOffset, availableWidth, height);
-
-              VirtualWidgetInfo vinfo{.bounds = geometry, .item = header};
+              VirtualWidgetInfo vinfo{
+                  .item = header, .row = m_rows.size(), .x = margins.left, .width = availableWidth};
 
+              calculateItemHeight(vinfo);
+              addRow(vinfo.height);
               m_items.push_back(vinfo);
-              yOffset += height;
             }
           }
 
-          ++shownCount;
-
-          int vIndex = m_items.size();
-          int height = 0;
-          int width = columnWidth;
-          int x = margins.left;
-          int y = yOffset;
-
-          if (sctx) {
-            // width = sctx->section->calculateItemWidth(width, sctx->index);
-            //  x = sctx->section->calculateItemX(sctx->x, sctx->index);
-            if (sctx->x == margins.left && sctx->index > 0) {
-              yOffset += section->spacing();
-              y = yOffset;
-            }
-
-            x = sctx->x;
-            sctx->x = sctx->x + width + section->spacing();
-            height = calculateItemHeight(item.get(), width);
-            sctx->maxHeight = std::max(sctx->maxHeight, height);
-
-            if (sctx->x >= availableWidth) {
-              yOffset += sctx->maxHeight;
-              sctx->x = margins.left;
-              sctx->maxHeight = 0;
-            }
+          if (!rowHeight) {
+            if (shownCount > 0 && section->spacing() > 0) { addRow(section->spacing()); }
 
-            ++sctx->index;
-          } else {
-            height = item->calculateHeight(width);
-            yOffset += height;
-          }
-
-          QRect geometry(x, y, width, height);
-          VirtualWidgetInfo vinfo{.bounds = geometry, .item = item.get(), .enumerable = true};
-
-          // TODO: if in viewport, look for cached entry
-          if (isInViewport(geometry)) {
-            if (auto it = _widgetCache.find(item->id()); it != _widgetCache.end()) {
-              QWidget *widget = it->second.widget->widget();
-
-              widget->setUpdatesEnabled(false);
-              item->refresh(widget);
-              widget->setUpdatesEnabled(true);
-              updatedCache[item->id()] = it->second;
-              _widgetCache.erase(it->first);
-            } else {
-              for (const auto &[key, cache] : _widgetCache) {
-                if (cache.recyclingId == item->recyclingId()) {
-                  QWidget *widget = cache.widget->widget();
-
-                  widget->setUpdatesEnabled(false);
-                  item->attached(widget);
-                  item->recycle(widget);
-                  widget->setUpdatesEnabled(true);
-                  updatedCache[item->id()] = cache;
-                  _widgetCache.erase(key);
-                  break;
-                }
-              }
-            }
+            m_rowItems.push_back(m_items.size());
+            rowHeight = 0;
           }
 
           ++shownCount;
+
+          VirtualWidgetInfo vinfo{
+              .item = item.get(), .row = m_rows.size(), .x = x, .width = columnWidth, .enumerable = true};
+
+          calculateItemHeight(vinfo);
+          rowHeight = std::max(*rowHeight, vinfo.height);
+          x += columnWidth + section->spacing();
           m_items.push_back(vinfo);
+
+          if (x >= availableWidth) { endRow(); }
         }
       }
 
-      if (sctx) { yOffset += sctx->maxHeight; }
+      endRow();
     }
   }
 
-  if (!m_items.empty()) { yOffset += margins.bottom + margins.top; }
+  auto ids = [](const std::vector<VirtualWidgetInfo> &items) {
+    return items | std::views::transform([](auto &&info) { return info.item->id(); }) |
+           std::ranges::to<std::vector>();
+  };
+  auto diff = KeyedDiff::compute(ids(m_previousItems), ids(m_items));
+  auto isUnchanged = [&](const VirtualWidgetInfo &info, const VirtualWidgetInfo &previous) {
+    return info.item == previous.item || info.item->hasSameContent(*previous.item);
+  };
 
-  for (auto &[key, cache] : _widgetCache) {
-    if (cache.recyclingId) {
-      moveToPool(cache.recyclingId, cache.widget);
-    } else {
-      cache.widget->deleteLater();
+  for (size_t i = 0; i != m_items.size(); ++i) {
+    auto &info = m_items[i];
+    size_t previousIndex = diff.previousIndex[i];
+
+    if (info.measured || previousIndex == KeyedDiff::npos) continue;
+
+    auto &previous = m_previousItems[previousIndex];
+
+    if (previous.measured && previous.width == info.width && isUnchanged(info, previous)) {
+      info.height = previous.height;
+      info.measured = true;
+      resizeRow(info.row);
     }
   }
 
-  _visibleWidgets.clear();
-  _widgetCache = updatedCache;
-  scrollBar->setMaximum(std::max(0, yOffset - height()));
-  scrollBar->setMinimum(0);
-  m_virtualHeight = yOffset;
+  size_t attachedCount = m_attachedItems.size();
+
+  // the items that are still there keep their widget
+  for (size_t n = 0; n != attachedCount; ++n) {
+    auto &previous = m_previousItems[m_attachedItems[n]];
+    size_t index = diff.nextIndex[m_attachedItems[n]];
 
-  // timer.time("calculateHeights");
+    if (index == KeyedDiff::npos) {
+      m_detachedWidgets.emplace_back(previous.widget);
+      continue;
+    }
+
+    auto &info = m_items[index];
+
+    if (!isUnchanged(info, previous)) {
+      QWidget *widget = previous.widget.widget->widget();
 
+      widget->setUpdatesEnabled(false);
+      info.item->refresh(widget);
+      widget->setUpdatesEnabled(true);
+    }
+
+    info.widget = previous.widget;
+    m_attachedItems.push_back(index);
+  }
+
+  m_attachedItems.erase(m_attachedItems.begin(), m_attachedItems.begin() + attachedCount);
+  m_previousItems.clear();
+  m_previousModel.clear();
+  _visibleWidgets.clear();
+  updateVirtualHeight();
   updateVisibleItems();
 
   emit virtualHeightChanged(m_virtualHeight);
+
+  return diff;
 }
 
-bool OmniList::isInViewport(const QRect &bounds) {
-  int low = scrollBar->value();
-  int high = low + height();
+void OmniList::updateVirtualHeight() {
+  m_virtualHeight = m_rows.total();
+
+  if (!m_items.empty()) { m_virtualHeight += margins.bottom + margins.top; }
+
+  scrollBar->setMaximum(std::max(0, m_virtualHeight - height()));
+  scrollBar->setMinimum(0);
+}
+
+void OmniList::calculateItemHeight(VirtualWidgetInfo &info) {
+  auto cached = m_typeHeights.find(info.item->typeId());
+
+  if (cached == m_typeHeights.end() || cached->second.width != info.width) {
+    measureItem(info);
+    return;
+  }
+
+  info.height = cached->second.height;
+  info.measured = info.item->hasUniformHeight();
+}
 
-  return bounds.y() + bounds.height() >= low && bounds.y() <= high;
+void OmniList::measureItem(VirtualWidgetInfo &info) {
+  info.height = info.item->calculateHeight(info.width);
+  info.measured = true;
+  m_typeHeights[info.item->typeId()] = {.width = info.width, .height = info.height};
 }
 
-int OmniList::calculateItemHeight(const AbstractVirtualItem *item, int width) {
-  if (!item->hasUniformHeight()) { return item->calculateHeight(width); }
+void OmniList::resizeRow(size_t row) {
+  int height = 0;
+
+  for (size_t i = m_rowItems[row]; i < m_items.size() && m_items[i].row == row; ++i) {
+    height = std::max(height, m_items[i].height);
+  }
+
+  m_rows.set(row, height);
+}
+
+void OmniList::measureItemsNearViewport() {
+  int scrollHeight = scrollBar->value();
+  int bottom = scrollHeight + 2 * height();
+  int scrollDelta = 0;
+  bool resized = false;
+
+  for (size_t row = m_rows.find(std::max(0, scrollHeight - height()));
+       row < m_rows.size() && m_rows.prefix(row) < bottom; ++row) {
+    int rowHeight = 0;
+    bool measured = false;
+
+    for (size_t i = m_rowItems[row]; i < m_items.size() && m_items[i].row == row; ++i) {
+      auto &info = m_items[i];
+
+      if (!info.measured) {
+        measureItem(info);
+        measured = true;
+      }
+
+      rowHeight = std::max(rowHeight, info.height);
+    }
+
+    if (!measured || rowHeight == m_rows.value(row)) continue;
+
+    if (m_rows.prefix(row) < scrollHeight + scrollDelta) { scrollDelta += rowHeight - m_rows.value(row); }
 
-  auto pred = [&](auto &&pair) { return pair.first == item->recyclingId(); };
-  auto match = std::ranges::find_if(m_cachedHeights, pred);
-  size_t typeId = item->recyclingId();
+    m_rows.set(row, rowHeight);
+    resized = true;
+  }
 
-  if (match != m_cachedHeights.end()) { return match->second; }
+  if (!resized) return;
 
-  int height = item->calculateHeight(width);
+  updateVirtualHeight();
 
-  m_cachedHeights.push_back({typeId, height});
+  if (scrollDelta != 0) {
+    QSignalBlocker blocker(scrollBar);
 
-  return height;
+    scrollBar->setValue(scrollHeight + scrollDelta);
+  }
+
+  emit virtualHeightChanged(m_virtualHeight);
 }
 
 std::vector<const OmniList::AbstractVirtualItem *> OmniList::items() const {
@@ -437,15 +557,10 @@ void OmniList::setSelected(SelectionPolicy policy) {
     selectFirst();
     break;
   case KeepSelection:
-    qDebug() << "update with keep selection";
+    // the selected item is gone, otherwise endResetModel would have followed it
     if (m_selected == -1) {
       selectFirst();
-    } else if (auto idx = indexOfItem(m_selectedId); idx != -1) {
-      qCritical() << "not implemented yet";
-      // qDebug() << "idx of " << _selectedId << _items[idx].vIndex;
-      // setSelectedIndex(_items[idx].vIndex);
     } else {
-      qDebug() << "no index for" << m_selectedId;
       setSelectedIndex(std::max(0, std::min(m_selected, static_cast<int>(m_items.size() - 1))));
     }
     break;
@@ -487,8 +602,22 @@ void OmniList::setSelected(SelectionPolicy policy) {
 }
 
 void OmniList::endResetModel(OmniList::SelectionPolicy selectionPolicy) {
-  calculateHeights();
-  setSelected(selectionPolicy);
+  size_t previousSelection = m_selected;
+
+  // a new model is a new end to get near to
+  m_scrolledNearEnd = m_itemsNearEnd = false;
+  auto diff = calculateHeights();
+  bool followsSelection = selectionPolicy == KeepSelection || selectionPolicy == PreserveSelection;
+
+  // the selected item is followed to wherever it is in the new model
+  if (followsSelection && previousSelection < diff.nextIndex.size() &&
+      diff.nextIndex[previousSelection] != KeyedDiff::npos) {
+    setSelectedIndex(diff.nextIndex[previousSelection]);
+  } else {
+    setSelected(selectionPolicy);
+  }
+
+  FrameMonitor::instance().recordResultsUpdated();
   emit modelChanged();
 }
 
@@ -512,12 +641,6 @@ void OmniList::moveToPool(size_t type, OmniListItemWidgetWrapper *widget) {
   _widgetPools[type].push(widget);
 }
 
-int OmniList::indexOfItem(const QString &id) const {
-  // if (auto it = _idMap.find(id); it != _idMap.end()) return it->second;
-
-  return -1;
-}
-
 const OmniList::AbstractVirtualItem *OmniList::firstSelectableItem() const {
   for (int i = 0; i < m_items.size(); ++i) {
     auto item = m_items[i].item;
@@ -529,11 +652,14 @@ const OmniList::AbstractVirtualItem *OmniList::firstSelectableItem() const {
 }
 
 void OmniList::clearVisibleWidgets() {
-  for (const auto &[_, cache] : _widgetCache) {
-    cache.widget->deleteLater();
+  for (size_t index : m_attachedItems) {
+    auto &info = m_items[index];
+
+    info.widget.widget->deleteLater();
+    info.widget = {};
   }
   _visibleWidgets.clear();
-  _widgetCache.clear();
+  m_attachedItems.clear();
 }
 
 bool OmniList::selectDown() {
@@ -546,21 +672,20 @@ bool OmniList::selectDown() {
   auto &current = m_items[m_selected];
   int next = m_selected;
 
-  while (next < m_items.size() &&
-         (m_items[next].bounds.y() == current.bounds.y() || !m_items[next].item->selectable())) {
+  while (next < m_items.size() && (m_items[next].row == current.row || !m_items[next].item->selectable())) {
     ++next;
   }
 
   int endNext = next;
 
-  while (endNext < m_items.size() && m_items[endNext].bounds.y() == m_items[next].bounds.y()) {
+  while (endNext < m_items.size() && m_items[endNext].row == m_items[next].row) {
     ++endNext;
   }
 
   for (int i = endNext - 1; i >= next; --i) {
     auto &vItem = m_items[i];
 
-    if (vItem.bounds.x() <= current.bounds.x() && vItem.item->selectable()) {
+    if (vItem.x <= current.x && vItem.item->selectable()) {
       setSelectedIndex(i, ScrollBehaviour::ScrollRelative);
       return true;
     }
@@ -581,8 +706,7 @@ bool OmniList::selectUp() {
   for (int i = m_selected - 1; i >= 0; --i) {
     auto &vitem = m_items[i];
 
-    if (vitem.bounds.y() < current.bounds.y() && vitem.bounds.x() <= current.bounds.x() &&
-        vitem.item->selectable()) {
+    if (vitem.row < current.row && vitem.x <= current.x && vitem.item->selectable()) {
       setSelectedIndex(i, ScrollBehaviour::ScrollRelative);
       return true;
     }
@@ -599,8 +723,7 @@ bool OmniList::selectLeft() {
     auto &vItem = m_items[i];
 
     if (!vItem.item->selectable()) { continue; }
-    if (vItem.bounds.y() < base.bounds.y() && vItem.bounds.width() == base.bounds.width() &&
-        base.bounds.width() == availableWidth) {
+    if (vItem.row < base.row && vItem.width == base.width && base.width == availableWidth) {
       return false;
     }
 
@@ -620,9 +743,7 @@ bool OmniList::selectRight() {
 
     if (!vItem.item->selectable()) { continue; }
 
-    if (vItem.bounds.y() > base.bounds.y() && vItem.bounds.width() == base.bounds.width() &&
-        base.bounds.width() == availableWidth)
-      return false;
+    if (vItem.row > base.row && vItem.width == base.width && base.width == availableWidth) return false;
 
     setSelectedIndex(i, ScrollBehaviour::ScrollRelative);
     return true;
@@ -665,7 +786,7 @@ int OmniList::previousRowIndex(int index) {
   for (int i = index - 1; i >= 0; --i) {
     auto &info = m_items[i];
 
-    if (info.bounds.y() < base.bounds.y()) { return i; }
+    if (info.row < base.row) { return i; }
   }
 
   return -1;
@@ -677,7 +798,7 @@ int OmniList::nextRowIndex(int index) {
   for (int i = index + 1; i < m_items.size(); ++i) {
     auto &info = m_items[i];
 
-    if (info.bounds.y() > base.bounds.y()) { return i; }
+    if (info.row > base.row) { return i; }
   }
 
   return -1;
@@ -687,7 +808,7 @@ void OmniList::scrollTo(int idx, ScrollBehaviour behaviour) {
   if (idx < 0 || idx >= m_items.size()) return;
 
   auto &item = m_items[idx];
-  auto &bounds = item.bounds;
+  auto bounds = itemBounds(item);
 
   int previousIdx = previousRowIndex(idx);
 
@@ -719,11 +840,13 @@ void OmniList::scrollTo(int idx, ScrollBehaviour behaviour) {
     auto &anchor = m_items[previousIdx];
     int low = newScroll;
     int high = low + height();
-    bool isAnchorVisible = anchor.bounds.y() >= low && anchor.bounds.y() <= high;
+    int anchorY = m_rows.prefix(anchor.row);
+    bool isAnchorVisible = anchorY >= low && anchorY <= high;
 
     if (!isAnchorVisible) { return scrollTo(previousIdx, behaviour); }
   }
 
+  m_scrollAnimator->stop();
   scrollBar->setValue(newScroll);
 }
 
@@ -735,7 +858,9 @@ void OmniList::activateCurrentSelection() const {
 
 bool OmniList::event(QEvent *event) {
   if (event->type() == QEvent::Wheel) {
-    QApplication::sendEvent(scrollBar, event);
+    if (!m_scrollAnimator->handleWheel(static_cast<QWheelEvent *>(event))) {
+      QApplication::sendEvent(scrollBar, event);
+    }
 
     return true;
   }
@@ -784,10 +909,84 @@ void OmniList::resizeEvent(QResizeEvent *event) {
   scrollBar->setPageStep(size.height());
   scrollBar->setFixedHeight(size.height());
   scrollBar->move(size.width() - scrollBar->sizeHint().width(), 0);
-  m_cachedHeights.clear();
+
+  // only the width changes the layout
+  if (event->oldSize().width() == size.width()) {
+    updateVirtualHeight();
+    updateVisibleItems();
+    return;
+  }
+
   calculateHeights();
 }
 
+void OmniList::paintEvent(QPaintEvent *event) {
+  if (m_rowRendering == WidgetRows) return QWidget::paintEvent(event);
+
+  OmniPainter painter(this);
+  size_t endIndex = std::min(visibleIndexRange.start + visibleIndexRange.size, m_items.size());
+
+  painter.setClipRegion(event->region());
+
+  for (size_t index = visibleIndexRange.start; index < endIndex; ++index) {
+    auto &info = m_items[index];
+    QRect bounds = viewportBounds(info);
+
+    if (info.widget.widget || !info.item->paintable() || !event->region().intersects(bounds)) continue;
+
+    info.item->paint(painter, bounds);
+  }
+}
+
+void OmniList::mouseMoveEvent(QMouseEvent *event) {
+  QWidget::mouseMoveEvent(event);
+
+  // the hovered row gets a widget, for it to be highlighted and respond to the mouse like any other
+  if (m_rowRendering == PaintedRows && indexAt(event->pos()) != m_hoveredIndex) { updateVisibleItems(); }
+}
+
+void OmniList::mousePressEvent(QMouseEvent *event) {
+  int index = m_rowRendering == PaintedRows ? indexAt(event->pos()) : -1;
+
+  if (index == -1 || !m_items[index].item->selectable()) return QWidget::mousePressEvent(event);
+
+  if (event->button() == Qt::LeftButton) { itemClicked(index); }
+  if (event->button() == Qt::RightButton) { rightClicked(index); }
+}
+
+void OmniList::mouseDoubleClickEvent(QMouseEvent *event) {
+  int index = m_rowRendering == PaintedRows ? indexAt(event->pos()) : -1;
+
+  if (index == -1 || event->button() != Qt::LeftButton || !m_items[index].item->selectable()) {
+    return QWidget::mouseDoubleClickEvent(event);
+  }
+
+  itemDoubleClicked(index);
+}
+
+void OmniList::leaveEvent(QEvent *event) {
+  QWidget::leaveEvent(event);
+
+  if (m_rowRendering == PaintedRows && m_hoveredIndex != -1) { updateVisibleItems(); }
+}
+
+void OmniList::setRowRendering(RowRendering rendering) {
+  if (m_rowRendering == rendering) return;
+
+  auto &painter = DefaultListItemPainter::instance();
+
+  m_rowRendering = rendering;
+
+  if (rendering == PaintedRows) {
+    connect(&painter, &DefaultListItemPainter::imageLoaded, this, qOverload<>(&QWidget::update),
+            Qt::UniqueConnection);
+  } else {
+    disconnect(&painter, &DefaultListItemPainter::imageLoaded, this, nullptr);
+  }
+
+  updateVisibleItems();
+}
+
 const OmniList::AbstractVirtualItem *OmniList::selected() const {
   if (m_selected >= 0 && m_selected < m_items.size()) return m_items[m_selected].item;
 
@@ -795,13 +994,10 @@ const OmniList::AbstractVirtualItem *OmniList::selected() const {
 }
 
 void OmniList::refresh() const {
-  for (int i = 0; i != visibleIndexRange.size; ++i) {
-    int index = visibleIndexRange.start + i;
-    auto item = m_items.at(index).item;
+  for (size_t index : m_attachedItems) {
+    auto &info = m_items[index];
 
-    if (auto it = _widgetCache.find(item->id()); it != _widgetCache.end()) {
-      item->refresh(it->second.widget->widget());
-    }
+    info.item->refresh(info.widget.widget->widget());
   }
 }
 
@@ -841,9 +1037,10 @@ void OmniList::setMargins(int left, int top, int right, int bottom) { margins =
 void OmniList::setMargins(int value) { setMargins(value, value, value, value); }
 
 void OmniList::clear() {
-  m_model.clear();
+  beginResetModel();
   m_selected = DEFAULT_SELECTION_INDEX;
   m_virtualHeight = 0;
+  m_scrolledNearEnd = m_itemsNearEnd = false;
 
   calculateHeights();
 }
@@ -855,52 +1052,50 @@ bool OmniList::removeItem(const QString &id) {
 }
 
 bool OmniList::updateItem(const QString &id, const UpdateItemCallback &cb) {
-  auto item = itemAt(id);
+  auto info = std::ranges::find_if(m_items, [&](auto &&entry) { return entry.item->id() == id; });
+
+  if (info == m_items.end()) return false;
 
-  if (!item) return false;
+  auto item = info->item;
 
   cb(item);
 
-  if (item->recyclable()) {
-    if (auto it2 = _widgetCache.find(id); it2 != _widgetCache.end()) {
-      item->recycle(it2->second.widget->widget());
-    }
+  if (item->recyclable() && info->widget.widget) { item->recycle(info->widget.widget->widget()); }
+
+  // its new height is measured if it is near the viewport, which only moves the rows after it
+  if (!item->hasUniformHeight()) {
+    info->measured = false;
+    updateVisibleItems();
   }
 
   return true;
 }
 
 void OmniList::invalidateCache() {
-  for (const auto &[id, cached] : _widgetCache) {
-    auto item = itemAt(id);
+  for (size_t index : m_attachedItems) {
+    auto &info = m_items[index];
 
-    if (item->recyclable()) {
-      moveToPool(item->recyclingId(), cached.widget);
-    } else {
-      cached.widget->deleteLater();
-    }
+    releaseWidget(info.widget);
+    info.widget = {};
   }
 
-  _widgetCache.clear();
+  m_attachedItems.clear();
   _visibleWidgets.clear();
 
   // if (!_isUpdating) { updateVisibleItems(); }
 }
 
 void OmniList::invalidateCache(const QString &id) {
-  auto it = _widgetCache.find(id);
+  auto attached =
+      std::ranges::find_if(m_attachedItems, [&](size_t index) { return m_items[index].item->id() == id; });
 
-  if (it == _widgetCache.end()) { return; }
+  if (attached == m_attachedItems.end()) { return; }
 
-  auto item = itemAt(id);
+  auto &info = m_items[*attached];
 
-  if (item->recyclable()) {
-    moveToPool(item->recyclingId(), it->second.widget);
-  } else {
-    it->second.widget->deleteLater();
-  }
-
-  _widgetCache.erase(it);
+  releaseWidget(info.widget);
+  info.widget = {};
+  m_attachedItems.erase(attached);
 }
 
 const OmniList::AbstractVirtualItem *OmniList::setSelected(const QString &id,
@@ -917,7 +1112,7 @@ const OmniList::AbstractVirtualItem *OmniList::setSelected(const QString &id,
 }
 
 void OmniList::clearWidgetPools() {
-  for (auto [type, stack] : _widgetPools) {
+  for (auto &[type, stack] : _widgetPools) {
     while (!stack.empty()) {
       stack.top()->deleteLater();
       stack.pop();
@@ -925,13 +1120,36 @@ void OmniList::clearWidgetPools() {
   }
 }
 
+size_t OmniList::pooledWidgetCount() const {
+  size_t count = 0;
+
+  for (const auto &[type, stack] : _widgetPools) {
+    count += stack.size();
+  }
+
+  return count;
+}
+
 void OmniList::handleDebouncedScroll() { updateVisibleItems(); }
 
 OmniList::OmniList() {
   scrollBar->setSingleStep(40);
   m_scrollTimer->setSingleShot(true);
-  connect(scrollBar, &QScrollBar::valueChanged, this, [this]() {
-    if (!m_scrollTimer->isActive()) { m_scrollTimer->start(16); }
+  connect(scrollBar, &QScrollBar::valueChanged, this, [this](int value) {
+    FrameMonitor::instance().recordScroll();
+
+    // animated scrolls already change the value once per frame
+    if (m_scrollAnimator->isAnimating()) {
+      m_scrollTimer->stop();
+      updateVisibleItems();
+    } else if (!m_scrollTimer->isActive()) {
+      m_scrollTimer->start(16);
+    }
+
+    bool nearEnd = value >= scrollBar->maximum() - height();
+
+    if (nearEnd && !m_scrolledNearEnd) { emit scrolledNearEnd(); }
+    m_scrolledNearEnd = nearEnd;
   });
   connect(scrollBar, &QScrollBar::sliderReleased, this, [this]() { updateVisibleItems(); });
   connect(m_scrollTimer, &QTimer::timeout, this, [this]() { updateVisibleItems(); });
@@ -939,8 +1157,16 @@ OmniList::OmniList() {
   int scrollBarWidth = scrollBar->sizeHint().width();
 
   setMargins(8, 5, 8, 5);
-  _widgetCache.reserve(20);
+  m_attachedItems.reserve(20);
+  m_detachedWidgets.reserve(20);
   setMouseTracking(true);
+  // pooled widgets are only worth keeping while the list is in use
+  m_memoryConsumer = MemoryBudget::instance().add({.subsystem = MemoryBudget::Subsystem::ListWidgetPools,
+                                                   .usage = [this]() { return pooledWidgetCount(); },
+                                                   .trim = [this](size_t) { clearWidgetPools(); }});
 }
 
-OmniList::~OmniList() { clearWidgetPools(); }
+OmniList::~OmniList() {
+  MemoryBudget::instance().remove(m_memoryConsumer);
+  clearWidgetPools();
+}
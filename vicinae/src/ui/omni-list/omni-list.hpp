@@ -3,7 +3,11 @@
 #include "../image/url.hpp"
 #include "ui/omni-list/omni-list-item-widget.hpp"
 #include "ui/omni-list/omni-list-item-widget-wrapper.hpp"
+#include "ui/omni-list/prefix-sum-tree.hpp"
+#include "lib/keyed-diff.hpp"
+#include "memory-budget/memory-budget.hpp"
 #include "ui/default-list-item-widget/default-list-item-widget.hpp"
+#include "ui/scroll-animator/scroll-animator.hpp"
 #include "ui/scroll-bar/scroll-bar.hpp"
 #include <algorithm>
 #include <bits/ranges_algo.h>
@@ -30,8 +34,12 @@
 #include <unordered_map>
 #include <variant>
 
+class OmniPainter;
+
 class OmniList : public QWidget {
   static constexpr const double SCROLL_FRAME_TIME = 1000 / 120.0;
+  // rows past the viewport, in the direction of the scroll, that are attached before they are in view
+  static constexpr size_t PREFETCH_ROWS = 2;
   QTimer *m_scrollTimer = new QTimer;
 
 public:
@@ -40,6 +48,13 @@ public:
     ScrollAbsolute,
   };
 
+  enum RowRendering {
+    // every item in view is shown in a widget
+    WidgetRows,
+    // paintable items are painted by the list, only the selected and hovered ones being shown in a widget
+    PaintedRows,
+  };
+
   class AbstractVirtualItem {
     mutable QString m_id;
 
@@ -66,6 +81,8 @@ public:
      * Whether the virtual height of this item type can change across many items.
      * If set to true, the height returned by the `calculateHeight`	method is cached
      * until the width allocation for the widget changes.
+     * Otherwise the height of the last item of the same type is used as an estimate, and the item is only
+     * measured once it gets near the viewport.
      */
     virtual bool hasUniformHeight() const { return false; }
 
@@ -87,6 +104,25 @@ public:
     virtual bool recyclable() const;
     virtual bool hasPartialUpdates() const { return false; }
     virtual void refresh(QWidget *widget) const {}
+
+    /**
+     * Whether this item renders exactly like `previous`, the item with the same id in the previous model.
+     * If so, the widget `previous` was shown in is kept as is as the model is reset, without being refreshed,
+     * and so is its height if it is not uniform.
+     */
+    virtual bool hasSameContent(const AbstractVirtualItem &previous) const { return false; }
+
+    /**
+     * Whether this item can be painted by lists that paint their rows, in which case it is only shown in a
+     * widget while it is selected or hovered.
+     */
+    virtual bool paintable() const { return false; }
+
+    /**
+     * Paint the item in `rect` the way its widget would render it, when it is not selected nor hovered.
+     */
+    virtual void paint(OmniPainter &painter, const QRect &rect) const {}
+
     virtual QString generateId() const { return QUuid::createUuid().toString(); }
 
     QString id() const {
@@ -307,49 +343,120 @@ private:
     int right = 0;
     int bottom = 0;
   } margins;
+  struct CachedWidget {
+    OmniListItemWidgetWrapper *widget = nullptr;
+    size_t recyclingId = -1;
+  };
   struct VirtualWidgetInfo {
-    QRect bounds;
     AbstractVirtualItem *item = nullptr;
+    // the row of the layout the item is in, which its vertical offset is computed from
+    size_t row = 0;
+    int x = 0;
+    int width = 0;
+    int height = 0;
     bool enumerable = false;
+    // false if the height is only estimated from another item of the same type
+    bool measured = true;
+    // the widget the item is shown in, if it is in the viewport
+    CachedWidget widget;
   };
-  struct SectionCalculationContext {
-    int index = 0;
-    int x = 0;
-    int maxHeight = 0;
-  };
-  struct CachedWidget {
-    OmniListItemWidgetWrapper *widget = nullptr;
-    size_t recyclingId = -1;
+  struct TypeHeight {
+    int width = 0;
+    int height = 0;
   };
 
   QScrollBar *scrollBar = new OmniScrollBar(this);
+  ScrollAnimator *m_scrollAnimator = new ScrollAnimator(scrollBar, this);
+  // the model being replaced, whose items the previous layout points to until the new model is laid out
+  std::vector<ModelItem> m_previousModel;
   std::vector<VirtualWidgetInfo> m_items;
+  // the layout of the previous model while the new one is diffed against it, kept around for its capacity
+  std::vector<VirtualWidgetInfo> m_previousItems;
+  // heights of the rows, spacing between them being rows of its own
+  PrefixSumTree m_rows;
+  // index of the first item in or after each row
+  std::vector<size_t> m_rowItems;
   std::vector<OmniListItemWidgetWrapper *> m_visibleWidgets;
   std::map<size_t, OmniListItemWidgetWrapper *> _visibleWidgets;
-  std::unordered_map<QString, CachedWidget> _widgetCache;
+  // indices of the items that have a widget attached, in no particular order
+  std::vector<size_t> m_attachedItems;
+  // widgets of the items that went out of view or were removed, that the items coming into view can be
+  // shown in. Only used while updating the visible items, kept around so that scrolling does not allocate
+  std::vector<CachedWidget> m_detachedWidgets;
   std::unordered_map<size_t, std::stack<OmniListItemWidgetWrapper *>> _widgetPools;
-  std::vector<std::pair<size_t, int>> m_cachedHeights;
+  size_t m_createdWidgetCount = 0;
+  MemoryBudget::Handle m_memoryConsumer = 0;
+  // height of the last item measured for each type of item
+  std::unordered_map<size_t, TypeHeight> m_typeHeights;
 
   int m_selected = DEFAULT_SELECTION_INDEX;
   QString m_selectedId;
-  int m_virtualHeight;
+  int m_virtualHeight = 0;
+  RowRendering m_rowRendering = WidgetRows;
+  int m_hoveredIndex = -1;
+  int m_lastScrollValue = 0;
+  bool m_scrollingUp = false;
+  size_t m_nearEndItems = 0;
+  // whether the viewport was near the end last time it was checked, `scrolledNearEnd` is only emitted when
+  // it gets there
+  bool m_scrolledNearEnd = false;
+  bool m_itemsNearEnd = false;
 
   void itemClicked(int index);
   void itemDoubleClicked(int index) const;
   void rightClicked(int index) const;
 
   void updateVisibleItems();
+
+  /**
+   * Index of the start of the first row that reaches into the viewport, found in O(log N).
+   */
+  size_t firstVisibleIndex() const;
+
+  /**
+   * Widget to show `item` in, reused from a detached widget or the pool when possible.
+   */
+  CachedWidget attachWidget(const AbstractVirtualItem &item);
+  void releaseWidget(const CachedWidget &cache);
+
   bool isDividableContent(const ModelItem &item);
-  bool isInViewport(const QRect &bounds);
+
+  QRect itemBounds(const VirtualWidgetInfo &info) const {
+    return QRect(info.x, m_rows.prefix(info.row), info.width, info.height);
+  }
+
+  /**
+   * Where the item currently is in the list widget, as opposed to in the virtual layout.
+   */
+  QRect viewportBounds(const VirtualWidgetInfo &info) const;
 
   /**
-   * Calculate the height for width of a widget, using the internal height cache,
-   * if applicable.
+   * Index of the item at `pos` in the list widget, or -1 if there is none.
    */
-  int calculateItemHeight(const AbstractVirtualItem *item, int width);
-  void calculateHeights();
+  int indexAt(const QPoint &pos) const;
 
-  int indexOfItem(const QString &id) const;
+  bool needsWidget(size_t index) const;
+
+  /**
+   * Set the height of the item for its width, from the height of the last item of the same type laid out
+   * at that width if there is one. Only items with a uniform height are considered measured that way.
+   */
+  void calculateItemHeight(VirtualWidgetInfo &info);
+  void measureItem(VirtualWidgetInfo &info);
+
+  /**
+   * Measure the items within a page of the viewport that only have an estimated height, resizing their
+   * rows. The scroll position is adjusted for the rows above the viewport, for its content not to move.
+   */
+  void measureItemsNearViewport();
+  void resizeRow(size_t row);
+  void updateVirtualHeight();
+
+  /**
+   * Lay out the model, diffing it against the previous layout by item id: the items that are still there
+   * keep their widget, which is only refreshed if their content changed.
+   */
+  KeyedDiff calculateHeights();
 
   void clearVisibleWidgets();
 
@@ -374,6 +481,10 @@ private:
 protected:
   bool event(QEvent *event) override;
   void resizeEvent(QResizeEvent *event) override;
+  void paintEvent(QPaintEvent *event) override;
+  void mousePressEvent(QMouseEvent *event) override;
+  void mouseDoubleClickEvent(QMouseEvent *event) override;
+  void leaveEvent(QEvent *event) override;
   void showEvent(QShowEvent *event) override {
     recalculateMousePosition();
     QWidget::showEvent(event);
@@ -381,9 +492,20 @@ protected:
 
   void setSelected(SelectionPolicy policy);
 
-  void clearWidgetPools();
+  size_t pooledWidgetCount() const;
 
 public:
+  /**
+   * Delete the widgets kept for reuse, for a list that is not going to be scrolled for a while.
+   */
+  void clearWidgetPools();
+
+  /**
+   * Widgets created to show items in so far, as opposed to reused from the ones that went out of view or
+   * from the pool.
+   */
+  size_t createdWidgetCount() const { return m_createdWidgetCount; }
+
   /**
    * The list of items that are currently in the viewport. This does _NOT_
    * include section headers or other layout items.
@@ -402,7 +524,7 @@ public:
   OmniList();
   ~OmniList();
 
-  void mouseMoveEvent(QMouseEvent *event) override { QWidget::mouseMoveEvent(event); }
+  void mouseMoveEvent(QMouseEvent *event) override;
 
   void addDivider() { m_model.emplace_back(Divider{}); }
 
@@ -423,6 +545,9 @@ public:
   }
 
   void beginResetModel() {
+    // if a reset is already in progress, the model it was building is simply discarded
+    if (m_previousModel.empty()) { m_previousModel = std::move(m_model); }
+
     m_model.clear();
     m_model.reserve(0xF);
   }
@@ -453,6 +578,19 @@ public:
 
   void setMargins(int left, int top, int right, int bottom);
   void setMargins(int value);
+
+  /**
+   * Also emit `scrolledNearEnd` when the visible items change and at most `items` items (sections
+   * included) come after the last one in view, which is also the case when the whole list fits in the
+   * viewport. 0, the default, only emits it when scrolling within a page of the end.
+   */
+  void setNearEndThreshold(size_t items) { m_nearEndItems = items; }
+
+  /**
+   * How the items in view are rendered. Painting rows saves creating and laying out a widget for every
+   * row that scrolls into view, which adds up in lists that are scrolled through quickly.
+   */
+  void setRowRendering(RowRendering rendering);
   void clear();
   void clearSelection() { setSelectedIndex(-1); }
   void refresh() const;
@@ -465,6 +603,13 @@ signals:
   void selectionChanged(const AbstractVirtualItem *next, const AbstractVirtualItem *previous) const;
   void itemRightClicked(const AbstractVirtualItem &item) const;
   void virtualHeightChanged(int height) const;
+
+  /**
+   * Emitted when the viewport gets within one page of the end of the list, or within the items set with
+   * `setNearEndThreshold`. Useful to lazily load more items. Emitted once each time the viewport gets
+   * there, and once more after the model is reset if it is still there.
+   */
+  void scrolledNearEnd() const;
 };
 
 class AbstractDefaultListItem : public OmniList::AbstractVirtualItem {
@@ -478,13 +623,25 @@ public:
     ItemDataSubtitle subtitle;
     AccessoryList accessories;
     QString alias;
+
+    bool operator==(const ItemData &) const = default;
   };
   virtual ItemData data() const = 0;
 
   bool hasUniformHeight() const override { return true; }
 
+  bool hasSameContent(const AbstractVirtualItem &previous) const override {
+    auto item = dynamic_cast<const AbstractDefaultListItem *>(&previous);
+
+    return item && item->data() == data();
+  }
+
   bool hasPartialUpdates() const override { return true; }
 
+  bool paintable() const override { return true; }
+
+  void paint(OmniPainter &painter, const QRect &rect) const override;
+
   size_t recyclingId() const override { return typeid(AbstractDefaultListItem).hash_code(); }
 
   void refresh(QWidget *w) const override {
@@ -0,0 +1,89 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Fenwick tree over a sequence of non-negative values, such as the heights of the rows of a list.
+ * The sum of any prefix, which is the offset of a row, and the value an offset falls in are found in
+ * O(log N). Values can be changed, appended and removed from the end in O(log N) as well.
+ */
+class PrefixSumTree {
+public:
+  size_t size() const { return m_values.size(); }
+  bool empty() const { return m_values.empty(); }
+  int total() const { return m_total; }
+  int value(size_t index) const { return m_values[index]; }
+
+  /**
+   * Sum of the first `count` values.
+   */
+  int prefix(size_t count) const {
+    int sum = 0;
+
+    for (; count > 0; count &= count - 1) {
+      sum += m_tree[count - 1];
+    }
+
+    return sum;
+  }
+
+  /**
+   * Index of the value `offset` falls in, that is the number of values whose sum is lower or equal to it,
+   * or `size()` if it is past the end.
+   */
+  size_t find(int offset) const {
+    size_t index = 0;
+
+    for (size_t step = std::bit_floor(size()); step > 0; step >>= 1) {
+      if (index + step <= size() && m_tree[index + step - 1] <= offset) {
+        index += step;
+        offset -= m_tree[index - 1];
+      }
+    }
+
+    return index;
+  }
+
+  void set(size_t index, int value) {
+    int delta = value - m_values[index];
+
+    m_values[index] = value;
+    m_total += delta;
+
+    for (size_t i = index + 1; i <= size(); i += i & -i) {
+      m_tree[i - 1] += delta;
+    }
+  }
+
+  void push(int value) {
+    size_t n = size() + 1;
+
+    // the new node covers the values after n - lowbit(n), which all come before it
+    m_tree.push_back(value + prefix(n - 1) - prefix(n - (n & -n)));
+    m_values.push_back(value);
+    m_total += value;
+  }
+
+  void pop() {
+    m_total -= m_values.back();
+    m_values.pop_back();
+    m_tree.pop_back();
+  }
+
+  void reserve(size_t n) {
+    m_tree.reserve(n);
+    m_values.reserve(n);
+  }
+
+  void clear() {
+    m_tree.clear();
+    m_values.clear();
+    m_total = 0;
+  }
+
+private:
+  std::vector<int> m_tree;
+  std::vector<int> m_values;
+  int m_total = 0;
+};
@@ -6,6 +6,46 @@
 #include <qlogging.h>
 #include <qnamespace.h>
 #include <qsvgrenderer.h>
+#include <QHash>
+#include <array>
+
+namespace {
+
+/**
+ * What theme tints resolve to, for list rows not to resolve the same few tints for every tag, accessory
+ * and icon they paint. Entries are resolved on first use and dropped when the theme changes.
+ */
+class TintCache {
+public:
+  struct Entry {
+    QBrush brush;
+    QColor textColor;
+  };
+
+  static TintCache &instance() {
+    static TintCache cache;
+
+    return cache;
+  }
+
+  template <typename Resolve> const Entry &get(SemanticColor tint, const Resolve &resolve) {
+    auto &entry = m_entries.at(tint);
+
+    if (!entry) { entry = resolve(); }
+
+    return *entry;
+  }
+
+private:
+  std::array<std::optional<Entry>, SemanticColor::TooltipText + 1> m_entries;
+
+  TintCache() {
+    QObject::connect(&ThemeService::instance(), &ThemeService::themeChanged,
+                     [this]() { m_entries.fill(std::nullopt); });
+  }
+};
+
+} // namespace
 
 OmniPainter::ImageMaskType OmniPainter::maskForName(const QString &name) {
   if (name == "circle") {
@@ -60,7 +100,22 @@ void OmniPainter::fillRect(QRect rect, const ThemeRadialGradient &rgrad, int rad
   drawRoundedRect(rect, radius, radius);
 }
 
-QBrush OmniPainter::colorBrush(const ColorLike &colorLike) const {
+static QBrush resolveBrush(const ColorLike &colorLike);
+
+static const TintCache::Entry &resolveTintEntry(SemanticColor tint) {
+  return TintCache::instance().get(tint, [tint]() -> TintCache::Entry {
+    auto color = ThemeService::instance().getTintColor(tint);
+
+    if (std::get_if<SemanticColor>(&color)) {
+      qWarning() << "Theme color set to color tint, not allowed! No color will be set to avoid loop";
+      return {};
+    }
+
+    return {.brush = resolveBrush(color), .textColor = OmniPainter::textColorForBackground(color)};
+  });
+}
+
+static QBrush resolveBrush(const ColorLike &colorLike) {
   if (auto color = std::get_if<QColor>(&colorLike)) {
     return *color;
   } else if (auto lgrad = std::get_if<ThemeLinearGradient>(&colorLike)) {
@@ -89,19 +144,14 @@ QBrush OmniPainter::colorBrush(const ColorLike &colorLike) const {
 
     return gradient;
   } else if (auto tint = std::get_if<SemanticColor>(&colorLike)) {
-    auto color = ThemeService::instance().getTintColor(*tint);
-
-    if (std::get_if<SemanticColor>(&color)) {
-      qWarning() << "Theme color set to color tint, not allowed! No color will be set to avoid loop";
-      return {};
-    }
-
-    return colorBrush(color);
+    return resolveTintEntry(*tint).brush;
   }
 
   return {};
 }
 
+QBrush OmniPainter::colorBrush(const ColorLike &colorLike) const { return resolveBrush(colorLike); }
+
 void OmniPainter::fillRect(QRect rect, const ColorLike &colorLike, int radius, float alpha) {
   if (auto color = std::get_if<QColor>(&colorLike)) {
     fillRect(rect, *color, radius, alpha);
@@ -127,35 +177,38 @@ void OmniPainter::setThemePen(const ColorLike &color, int width) {
 
 void OmniPainter::setThemeBrush(const ColorLike &color) { QPainter::setBrush(colorBrush(color)); }
 
-QColor OmniPainter::textColorForBackground(const ColorLike &colorLike) {
-  if (auto color = std::get_if<QColor>(&colorLike)) {
-    int n = 180;
-    while (n > 100) {
-      QColor candidate = color->lighter(n);
+static QColor lighterTextColor(const QColor &color) {
+  int n = 180;
+  while (n > 100) {
+    QColor candidate = color.lighter(n);
 
-      if (candidate.redF() == 1 && candidate.greenF() == 1 && candidate.blueF() == 1) {
-      } else {
-        return candidate;
-      }
-
-      n -= 5;
+    if (candidate.redF() == 1 && candidate.greenF() == 1 && candidate.blueF() == 1) {
+    } else {
+      return candidate;
     }
 
-    return *color;
+    n -= 5;
+  }
+
+  return color;
+}
 
+QColor OmniPainter::textColorForBackground(const ColorLike &colorLike) {
+  if (auto color = std::get_if<QColor>(&colorLike)) {
+    // models repeat the same few colors, and finding a lighter one can take a few tries
+    static constexpr qsizetype MAX_CACHED = 256;
+    static QHash<QRgb, QColor> cache;
+
+    if (auto it = cache.constFind(color->rgba()); it != cache.constEnd()) return *it;
+    if (cache.size() >= MAX_CACHED) { cache.clear(); }
+
+    return *cache.insert(color->rgba(), lighterTextColor(*color));
   } else if (auto lgrad = std::get_if<ThemeLinearGradient>(&colorLike)) {
     return {};
   } else if (auto rgrad = std::get_if<ThemeRadialGradient>(&colorLike)) {
     return {};
   } else if (auto tint = std::get_if<SemanticColor>(&colorLike)) {
-    auto color = ThemeService::instance().getTintColor(*tint);
-
-    if (std::get_if<SemanticColor>(&color)) {
-      qWarning() << "Theme color set to color tint, not allowed! No color will be set to avoid loop";
-      return {};
-    }
-
-    return textColorForBackground(color);
+    return resolveTintEntry(*tint).textColor;
   }
 
   return {};
@@ -0,0 +1,89 @@
+#include "ui/omni-tree/omni-tree-model.hpp"
+#include <algorithm>
+#include <functional>
+
+namespace OmniTreeModel {
+
+namespace {
+
+using Row = OmniTreeSnapshot::Row;
+
+bool matches(const Row &row, const QString &filter) {
+  return filter.isEmpty() || row.filterText.contains(filter, Qt::CaseInsensitive);
+}
+
+/**
+ * The rows of `rows` to keep, sorted.
+ */
+std::vector<const Row *> arrangeLevel(const std::vector<Row> &rows, const OmniTreeQuery &query,
+                                      const std::function<bool(const Row &)> &keep) {
+  std::vector<const Row *> arranged;
+
+  arranged.reserve(rows.size());
+
+  for (const auto &row : rows) {
+    if (keep(row)) { arranged.emplace_back(&row); }
+  }
+
+  if (!query.sortOrder) return arranged;
+
+  bool descending = *query.sortOrder == Qt::DescendingOrder;
+
+  std::ranges::stable_sort(arranged, [descending](const Row *a, const Row *b) {
+    bool hasA = a->sortKey.isValid();
+    bool hasB = b->sortKey.isValid();
+
+    if (!hasA || !hasB) return hasA && !hasB;
+
+    int order = compareKeys(a->sortKey, b->sortKey);
+
+    return descending ? order > 0 : order < 0;
+  });
+
+  return arranged;
+}
+
+} // namespace
+
+int compareKeys(const QVariant &a, const QVariant &b) {
+  if (a.typeId() == QMetaType::QString && b.typeId() == QMetaType::QString) {
+    return std::clamp(QString::compare(a.toString(), b.toString(), Qt::CaseInsensitive), -1, 1);
+  }
+
+  auto order = QVariant::compare(a, b);
+
+  if (order == QPartialOrdering::Less) return -1;
+  if (order == QPartialOrdering::Greater) return 1;
+
+  return 0;
+}
+
+std::optional<OmniTreeArrangement> arrange(const OmniTreeSnapshot &snapshot, const OmniTreeQuery &query,
+                                           const CancellationToken &token) {
+  OmniTreeArrangement arrangement;
+  auto keepMatching = [&](const Row &row) {
+    return matches(row, query.filter) ||
+           std::ranges::any_of(row.children, [&](const Row &child) { return matches(child, query.filter); });
+  };
+
+  for (const Row *row : arrangeLevel(snapshot.rows, query, keepMatching)) {
+    if (token.isCancelled()) return std::nullopt;
+
+    // all the children of a matching row are kept
+    bool keepChildren = matches(*row, query.filter);
+    auto &arranged = arrangement.rows.emplace_back(OmniTreeArrangement::Row{.id = row->id});
+    auto children = arrangeLevel(row->children, query, [&](const Row &child) {
+      return keepChildren || matches(child, query.filter);
+    });
+
+    arranged.children.reserve(children.size());
+
+    for (const Row *child : children) {
+      arranged.children.emplace_back(child->id);
+    }
+  }
+
+  return arrangement;
+}
+
+} // namespace OmniTreeModel
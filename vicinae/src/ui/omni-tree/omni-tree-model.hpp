@@ -0,0 +1,61 @@
+#pragma once
+#include "task-scheduler/task-scheduler.hpp"
+#include <QString>
+#include <QVariant>
+#include <optional>
+#include <vector>
+
+/**
+ * What the rows of an `OmniTree` are sorted and filtered by, copied from their delegates on the GUI thread
+ * so that sorting and filtering can happen on another one: the delegates themselves are never touched there.
+ */
+struct OmniTreeSnapshot {
+  struct Row {
+    QString id;
+    QVariant sortKey;
+    QString filterText;
+    std::vector<Row> children;
+  };
+
+  std::vector<Row> rows;
+};
+
+/**
+ * Rows of an `OmniTree` in the order they are to be shown, once filtered, by id.
+ */
+struct OmniTreeArrangement {
+  struct Row {
+    QString id;
+    std::vector<QString> children;
+  };
+
+  std::vector<Row> rows;
+};
+
+struct OmniTreeQuery {
+  // rows are kept in the order of the snapshot if not set
+  std::optional<Qt::SortOrder> sortOrder;
+  // matched anywhere in the filter text of the rows, ignoring case
+  QString filter;
+
+  bool isIdentity() const { return !sortOrder && filter.isEmpty(); }
+};
+
+namespace OmniTreeModel {
+
+/**
+ * Sort and filter `snapshot`, at each level of the tree. A row is kept if it matches the filter, along with
+ * all of its children, or if one of its children does, along with the children that do.
+ *
+ * Rows are sorted by key, rows with the same key staying in the order of the snapshot and rows without a
+ * key coming last whatever the order. Returns nothing if `token` is cancelled before it is done.
+ */
+std::optional<OmniTreeArrangement> arrange(const OmniTreeSnapshot &snapshot, const OmniTreeQuery &query,
+                                           const CancellationToken &token = {});
+
+/**
+ * -1, 0 or 1 depending on how `a` compares to `b`. Strings are compared ignoring case.
+ */
+int compareKeys(const QVariant &a, const QVariant &b);
+
+} // namespace OmniTreeModel
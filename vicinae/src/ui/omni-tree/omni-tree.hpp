@@ -4,6 +4,7 @@
 #include "theme.hpp"
 #include "ui/image/image.hpp"
 #include "ui/omni-list/omni-list.hpp"
+#include "ui/omni-tree/omni-tree-model.hpp"
 #include "ui/selectable-omni-list-widget/selectable-omni-list-widget.hpp"
 #include "ui/typography/typography.hpp"
 #include <QtConcurrent/qtconcurrentiteratekernel.h>
@@ -18,9 +19,11 @@
 #include <qtmetamacros.h>
 #include <qwidget.h>
 #include <ranges>
+#include <unordered_map>
 
 class VirtualTreeItemDelegate {
   bool m_expanded = false;
+  bool m_visible = true;
 
 public:
   virtual std::vector<std::shared_ptr<VirtualTreeItemDelegate>> children() const { return {}; }
@@ -30,6 +33,24 @@ public:
   virtual QMargins contentMargins() const { return {5, 5, 5, 5}; }
   void setExpandable(bool value) { m_expanded = value; }
   bool expanded() const { return m_expanded; }
+
+  /**
+   * Hidden rows stay in the model of the tree but are not rendered, which is how a tree is filtered without
+   * being rebuilt.
+   */
+  void setVisible(bool value) { m_visible = value; }
+  bool visible() const { return m_visible; }
+
+  /**
+   * What the row is sorted by when the tree is sorted by `column`. Keys are compared on a worker thread,
+   * they must be copies of what the row shows. Rows without a key are listed last.
+   */
+  virtual QVariant sortKey(int column) const { return {}; }
+
+  /**
+   * Text the filter of the tree is matched against, see `OmniTree::setFilter`.
+   */
+  virtual QString filterText() const { return {}; }
   virtual QWidget *widgetForColumn(int column) const { return nullptr; }
   virtual void refreshForColumn(QWidget *widget, int column) const {}
   virtual bool disabled() const { return false; }
@@ -50,11 +71,18 @@ public:
     ColumnSizePolicy sizePolicy = ColumnSizePolicy::Auto;
     int width = 0;
   };
+  struct SortInfo {
+    int column;
+    Qt::SortOrder order;
+  };
 
   std::vector<ColumnInfo> m_columns;
+  std::optional<SortInfo> m_sort;
 
 public:
   std::vector<ColumnInfo> columns() const { return m_columns; }
+  const std::optional<SortInfo> &sort() const { return m_sort; }
+  void setSort(const std::optional<SortInfo> &sort) { m_sort = sort; }
   void setColumns(const std::vector<QString> &cols) {
     m_columns = cols | std::views::transform([](auto &&str) { return ColumnInfo{.name = str}; }) |
                 std::ranges::to<std::vector>();
@@ -77,9 +105,20 @@ class HeaderWidget : public QWidget {
 
   class HeaderColumn : public QWidget {
     TypographyWidget *m_typography = new TypographyWidget;
+    std::function<void()> m_clicked;
+
+    void mousePressEvent(QMouseEvent *event) override {
+      if (event->button() == Qt::LeftButton && m_clicked) {
+        m_clicked();
+        return;
+      }
+
+      QWidget::mousePressEvent(event);
+    }
 
   public:
     void setText(const QString &text) { m_typography->setText(text); }
+    void setClickHandler(std::function<void()> handler) { m_clicked = std::move(handler); }
     HeaderColumn() {
       auto layout = new QHBoxLayout;
       layout->setContentsMargins(5, 0, 0, 0);
@@ -101,7 +140,9 @@ class HeaderWidget : public QWidget {
     painter.drawRect(rect());
   }
 
-  void setupUI(HeaderInfo *info) {
+  void setupUI(HeaderInfo *info, const std::function<void(int column)> &columnClicked) {
+    auto sort = info->sort();
+
     m_layout->setContentsMargins(5, 5, 5, 5);
 
     for (const auto [idx, col] : info->columns() | std::views::enumerate) {
@@ -116,14 +157,27 @@ class HeaderWidget : public QWidget {
         m_layout->addWidget(column, 1);
       }
 
-      column->setText(col.name);
+      if (sort && sort->column == idx) {
+        column->setText(QString("%1 %2").arg(col.name).arg(sort->order == Qt::AscendingOrder ? "↑" : "↓"));
+      } else {
+        column->setText(col.name);
+      }
+
+      if (columnClicked) {
+        column->setClickHandler([columnClicked, idx]() { columnClicked(idx); });
+      }
     }
 
     setLayout(m_layout);
   }
 
 public:
-  HeaderWidget(HeaderInfo *info) { setupUI(info); }
+  /**
+   * `columnClicked` is called with the index of the column whose header was clicked, if set.
+   */
+  HeaderWidget(HeaderInfo *info, const std::function<void(int column)> &columnClicked = {}) {
+    setupUI(info, columnClicked);
+  }
 };
 
 class LeftTableWidget : public QWidget {
@@ -353,15 +407,129 @@ public:
   }
 };
 
+/**
+ * Table of rows with up to one level of children, optionally sorted by a column and filtered.
+ *
+ * Sorting and filtering work on a snapshot of the keys and filter texts of the rows taken on the GUI thread,
+ * and happen on a worker thread: only the latest request is applied once done, the rows being matched by id
+ * with the ones shown so that the selection and the rows that were expanded are kept. Without a sort column
+ * or a filter, rows are shown in the order of the model right away.
+ */
 class OmniTree : public QWidget {
   Q_OBJECT
 
+  using DelegateMap = std::unordered_map<QString, std::shared_ptr<VirtualTreeItemDelegate>>;
+
   OmniList *m_list = new OmniList;
   std::vector<std::shared_ptr<VirtualTreeItemDelegate>> m_model;
   HeaderInfo m_header;
   QWidget *m_widget = new QWidget;
   QVBoxLayout *layout = new QVBoxLayout;
   std::optional<ColorLike> m_alternateBackgroundColor;
+  bool m_sortingEnabled = false;
+  QString m_filter;
+
+  // rows as last sorted and filtered, not set if they are shown in the order of the model
+  std::optional<OmniTreeArrangement> m_arrangement;
+  // delegates of the arranged rows by id, and of the rows being arranged
+  DelegateMap m_arrangedDelegates;
+  DelegateMap m_pendingDelegates;
+  uint64_t m_generation = 0;
+  CancellationToken m_arrangeToken;
+  // last, so that running tasks are waited for before anything they post their result to is destroyed
+  TaskGroup m_arrangeTasks{TaskScheduler::Priority::Interactive};
+
+  HeaderWidget *createHeader() {
+    return new HeaderWidget(&m_header, [this](int column) { columnClicked(column); });
+  }
+
+  void columnClicked(int column) {
+    if (!m_sortingEnabled) return;
+
+    auto &sort = m_header.sort();
+    bool ascending = sort && sort->column == column && sort->order == Qt::AscendingOrder;
+
+    sortByColumn(column, ascending ? Qt::DescendingOrder : Qt::AscendingOrder);
+  }
+
+  OmniTreeSnapshot::Row snapshotRow(const std::shared_ptr<VirtualTreeItemDelegate> &delegate,
+                                    std::optional<int> sortColumn, DelegateMap &delegates) const {
+    OmniTreeSnapshot::Row row{.id = delegate->id(), .filterText = delegate->filterText()};
+
+    if (sortColumn) { row.sortKey = delegate->sortKey(*sortColumn); }
+
+    for (const auto &child : delegate->children()) {
+      row.children.emplace_back(snapshotRow(child, sortColumn, delegates));
+    }
+
+    delegates.insert({row.id, delegate});
+
+    return row;
+  }
+
+  void arranged(uint64_t generation, OmniTreeArrangement arrangement, OmniList::SelectionPolicy policy) {
+    if (generation != m_generation) return;
+
+    m_arrangement = std::move(arrangement);
+    m_arrangedDelegates = std::move(m_pendingDelegates);
+    m_pendingDelegates.clear();
+    renderModel(policy);
+  }
+
+  /**
+   * Sort and filter the model again, rendering it once done.
+   */
+  void rearrange(OmniList::SelectionPolicy policy = OmniList::PreserveSelection) {
+    OmniTreeQuery query{.filter = m_filter};
+    std::optional<int> sortColumn;
+
+    if (auto &sort = m_header.sort()) {
+      query.sortOrder = sort->order;
+      sortColumn = sort->column;
+    }
+
+    m_arrangeToken.cancel();
+    m_arrangeToken = {};
+    ++m_generation;
+    m_pendingDelegates.clear();
+
+    if (query.isIdentity()) {
+      m_arrangement.reset();
+      m_arrangedDelegates.clear();
+      renderModel(policy);
+      return;
+    }
+
+    OmniTreeSnapshot snapshot;
+
+    snapshot.rows.reserve(m_model.size());
+
+    for (const auto &row : m_model) {
+      snapshot.rows.emplace_back(snapshotRow(row, sortColumn, m_pendingDelegates));
+    }
+
+    m_arrangeTasks.start(
+        [this, snapshot = std::move(snapshot), query, policy, token = m_arrangeToken,
+         generation = m_generation]() {
+          auto arrangement = OmniTreeModel::arrange(snapshot, query, token);
+
+          if (!arrangement) return;
+
+          QMetaObject::invokeMethod(
+              this,
+              [this, generation, policy, arrangement = std::move(*arrangement)]() mutable {
+                arranged(generation, std::move(arrangement), policy);
+              },
+              Qt::QueuedConnection);
+        },
+        m_arrangeToken);
+  }
+
+  VirtualTreeItemDelegate *arrangedDelegate(const QString &id) const {
+    auto it = m_arrangedDelegates.find(id);
+
+    return it != m_arrangedDelegates.end() ? it->second.get() : nullptr;
+  }
 
 public:
   OmniTree(QWidget *parent = nullptr) : QWidget(parent) {
@@ -374,6 +542,8 @@ public:
     connect(m_list, &OmniList::selectionChanged, this, &OmniTree::handleSelectionChanged);
   }
 
+  ~OmniTree() override { m_arrangeToken.cancel(); }
+
   void setHeader(HeaderWidget *widget) {
     if (auto item = layout->itemAt(0)) {
       if (auto previous = item->widget()) {
@@ -385,21 +555,44 @@ public:
 
   void setColumns(const std::vector<QString> &columns) {
     m_header.setColumns(columns);
-    setHeader(new HeaderWidget(&m_header));
+    setHeader(createHeader());
   }
   void setColumnSizePolicy(int idx, HeaderInfo::ColumnSizePolicy policy) {
     m_header.setColumnSizePolicy(idx, policy);
-    setHeader(new HeaderWidget(&m_header));
+    setHeader(createHeader());
   }
   void setColumnWidth(int index, int width) {
     m_header.setColumnWidth(index, width);
-    setHeader(new HeaderWidget(&m_header));
+    setHeader(createHeader());
   }
 
   void setAlternateBackgroundColor(const std::optional<ColorLike> &color) {
     m_alternateBackgroundColor = color;
   }
 
+  /**
+   * Let the user sort the rows by clicking the header of a column, clicking it again reversing the order.
+   * Rows are sorted by `VirtualTreeItemDelegate::sortKey`.
+   */
+  void setSortingEnabled(bool value) { m_sortingEnabled = value; }
+
+  void sortByColumn(int column, Qt::SortOrder order = Qt::AscendingOrder) {
+    m_header.setSort(HeaderInfo::SortInfo{.column = column, .order = order});
+    setHeader(createHeader());
+    rearrange();
+  }
+
+  /**
+   * Only show the rows whose `VirtualTreeItemDelegate::filterText` contains `filter`, and the rows they are
+   * children of.
+   */
+  void setFilter(const QString &filter) {
+    if (filter == m_filter) return;
+
+    m_filter = filter;
+    rearrange();
+  }
+
   void activateDelegate(const OmniList::AbstractVirtualItem &item) {
     auto &row = static_cast<const VirtualTreeItemRow &>(item);
 
@@ -430,30 +623,51 @@ public:
     return static_cast<const VirtualTreeItemRow *>(item)->delegate();
   }
 
+  /**
+   * Render the rows as last arranged, which only accounts for changes to what rows are visible or expanded.
+   * Changes to the rows themselves go through `addRows`.
+   */
   void renderModel(OmniList::SelectionPolicy policy = OmniList::PreserveSelection) {
     m_list->updateModel(
         [&]() {
           auto &section = m_list->addSection();
           size_t idx = 0;
-
-          for (const auto &row : m_model) {
-            auto item = std::make_shared<VirtualTreeItemRow>(row.get(), &m_header);
+          auto addRow = [&](VirtualTreeItemDelegate *delegate, int indent) {
+            auto item = std::make_shared<VirtualTreeItemRow>(delegate, &m_header);
 
             if (idx % 2) item->setBackgroundColor(m_alternateBackgroundColor);
-
+            item->setIndentLevel(indent);
             section.addItem(item);
             ++idx;
+          };
+
+          if (!m_arrangement) {
+            for (const auto &row : m_model) {
+              if (!row->visible()) continue;
 
-            if (row->expanded()) {
-              for (const auto &row2 : row->children()) {
-                auto item = std::make_shared<VirtualTreeItemRow>(row2.get(), &m_header);
+              addRow(row.get(), 0);
 
-                if (idx % 2) item->setBackgroundColor(m_alternateBackgroundColor);
-                item->setIndentLevel(1);
-                section.addItem(item);
-                ++idx;
+              if (!row->expanded()) continue;
+
+              for (const auto &child : row->children()) {
+                if (child->visible()) { addRow(child.get(), 1); }
               }
             }
+            return;
+          }
+
+          for (const auto &row : m_arrangement->rows) {
+            auto delegate = arrangedDelegate(row.id);
+
+            if (!delegate || !delegate->visible()) continue;
+
+            addRow(delegate, 0);
+
+            if (!delegate->expanded()) continue;
+
+            for (const auto &childId : row.children) {
+              if (auto child = arrangedDelegate(childId); child && child->visible()) { addRow(child, 1); }
+            }
           }
         },
         policy);
@@ -461,7 +675,7 @@ public:
 
   void addRows(std::vector<std::shared_ptr<VirtualTreeItemDelegate>> rows) {
     m_model = rows;
-    renderModel(OmniList::SelectionPolicy::SelectNone);
+    rearrange(OmniList::SelectionPolicy::SelectNone);
   }
 
 signals:
@@ -0,0 +1,227 @@
+#include "ui/performance-hud/performance-hud.hpp"
+#include "ui/image/image-load-scheduler.hpp"
+#include "ui/omni-painter/omni-painter.hpp"
+#include <QFontDatabase>
+#include <QScreen>
+#include <algorithm>
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+static constexpr int LABEL_WIDTH = 19;
+
+FrameMonitor::Scope::Scope(Metric metric) : m_metric(metric) {
+  if (FrameMonitor::instance().isEnabled()) { m_start = Clock::now(); }
+}
+
+FrameMonitor::Scope::~Scope() {
+  if (!m_start) return;
+
+  FrameMonitor::instance().record(m_metric, duration_cast<microseconds>(Clock::now() - *m_start));
+}
+
+FrameMonitor &FrameMonitor::instance() {
+  static FrameMonitor monitor;
+
+  return monitor;
+}
+
+const char *FrameMonitor::metricName(Metric metric) {
+  switch (metric) {
+  case Metric::Frame:
+    return "frame";
+  case Metric::CalculateHeights:
+    return "calculateHeights";
+  case Metric::UpdateVisibleItems:
+    return "updateVisibleItems";
+  case Metric::InputLatency:
+    return "key to results";
+  }
+
+  return "unknown";
+}
+
+void FrameMonitor::setEnabled(bool enabled) {
+  if (m_enabled == enabled) return;
+
+  m_enabled = enabled;
+  reset();
+  emit enabledChanged(enabled);
+}
+
+void FrameMonitor::reset() {
+  for (auto &samples : m_samples) {
+    samples.clear();
+  }
+
+  m_lastFrameStart.reset();
+  m_lastScroll.reset();
+  m_inputStart.reset();
+  m_resultsUpdated = false;
+  m_droppedFrames = 0;
+  m_scrollFrames = 0;
+}
+
+void FrameMonitor::record(Metric metric, microseconds duration) {
+  if (!m_enabled) return;
+  if (m_sink) { m_sink(metric, duration); }
+
+  auto &samples = m_samples[static_cast<size_t>(metric)];
+
+  if (samples.size() == SAMPLE_COUNT) { samples.pop_front(); }
+
+  samples.push_back(duration);
+}
+
+void FrameMonitor::recordFrame(Clock::time_point start, Clock::time_point end) {
+  if (!m_enabled) return;
+
+  record(Metric::Frame, duration_cast<microseconds>(end - start));
+
+  if (m_lastScroll && start - *m_lastScroll < SCROLL_GRACE && m_lastFrameStart) {
+    auto interval = start - *m_lastFrameStart;
+
+    ++m_scrollFrames;
+
+    // a frame that took a little longer than usual is not worth reporting
+    if (interval > m_frameInterval * 3 / 2) { m_droppedFrames += interval / m_frameInterval - 1; }
+  }
+
+  if (m_inputStart) {
+    if (m_resultsUpdated) {
+      record(Metric::InputLatency, duration_cast<microseconds>(end - *m_inputStart));
+      m_inputStart.reset();
+    } else if (end - *m_inputStart > INPUT_TIMEOUT) {
+      m_inputStart.reset();
+    }
+  }
+
+  m_lastFrameStart = start;
+}
+
+void FrameMonitor::recordInput() {
+  if (!m_enabled) return;
+
+  // results of the previous keystroke may still be on their way, the time is counted from the first one
+  if (!m_inputStart) { m_inputStart = Clock::now(); }
+
+  m_resultsUpdated = false;
+}
+
+void FrameMonitor::recordResultsUpdated() {
+  if (m_enabled && m_inputStart) { m_resultsUpdated = true; }
+}
+
+void FrameMonitor::recordScroll() {
+  if (m_enabled) { m_lastScroll = Clock::now(); }
+}
+
+void FrameMonitor::setRefreshRate(double hz) {
+  if (hz <= 0) return;
+
+  m_frameInterval = duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / hz));
+}
+
+FrameMonitor::Summary FrameMonitor::summary(Metric metric) const {
+  const auto &samples = m_samples[static_cast<size_t>(metric)];
+  Summary summary{.count = samples.size()};
+
+  if (samples.empty()) return summary;
+
+  std::vector<microseconds> sorted(samples.begin(), samples.end());
+
+  std::ranges::sort(sorted);
+  summary.last = samples.back();
+  summary.p50 = sorted[sorted.size() / 2];
+  summary.p95 = sorted[std::min(sorted.size() - 1, sorted.size() * 95 / 100)];
+  summary.max = sorted.back();
+
+  return summary;
+}
+
+static QString formatDuration(microseconds duration) {
+  return QString::number(duration.count() / 1000.0, 'f', 2).rightJustified(7);
+}
+
+static QString label(const char *text) { return QString(text).leftJustified(LABEL_WIDTH); }
+
+QStringList PerformanceHud::lines() const {
+  using Metric = FrameMonitor::Metric;
+  auto &monitor = FrameMonitor::instance();
+  auto &scheduler = ImageLoadScheduler::instance();
+  QStringList lines;
+
+  lines << label("") + "   last    p50    p95    max (ms)";
+
+  for (auto metric :
+       {Metric::Frame, Metric::CalculateHeights, Metric::UpdateVisibleItems, Metric::InputLatency}) {
+    auto summary = monitor.summary(metric);
+
+    lines << label(FrameMonitor::metricName(metric)) + formatDuration(summary.last) +
+                 formatDuration(summary.p50) + formatDuration(summary.p95) + formatDuration(summary.max);
+  }
+
+  lines << label("dropped (scroll)") +
+               QString("%1 / %2 frames").arg(monitor.droppedFrames()).arg(monitor.scrollFrames());
+  lines << label("image loads") +
+               QString("%1 pending, %2 running").arg(scheduler.pendingCount()).arg(scheduler.runningCount());
+
+  return lines;
+}
+
+void PerformanceHud::paintEvent(QPaintEvent *event) {
+  OmniPainter painter(this);
+  auto background = painter.resolveColor(SemanticColor::MainBackground);
+
+  background.setAlphaF(0.85);
+  painter.setRenderHint(QPainter::Antialiasing);
+  painter.setBrush(background);
+  painter.setPen(Qt::NoPen);
+  painter.drawRoundedRect(rect(), 6, 6);
+  painter.setThemePen(SemanticColor::TextPrimary);
+  painter.drawText(rect().adjusted(PADDING, PADDING, -PADDING, -PADDING), Qt::AlignLeft | Qt::AlignTop,
+                   lines().join('\n'));
+}
+
+void PerformanceHud::refresh() {
+  auto text = lines();
+  QFontMetrics metrics(font());
+  int width = 0;
+
+  for (const auto &line : text) {
+    width = std::max(width, metrics.horizontalAdvance(line));
+  }
+
+  QSize size(width + PADDING * 2, metrics.lineSpacing() * text.size() + PADDING * 2);
+  auto parent = parentWidget();
+
+  if (auto screen = parent->screen()) { FrameMonitor::instance().setRefreshRate(screen->refreshRate()); }
+
+  setGeometry(QRect(QPoint(parent->width() - size.width() - MARGIN, MARGIN), size));
+  raise();
+  update();
+}
+
+void PerformanceHud::setMonitorEnabled(bool enabled) {
+  setVisible(enabled);
+
+  if (!enabled) {
+    m_refreshTimer->stop();
+    return;
+  }
+
+  refresh();
+  m_refreshTimer->start();
+}
+
+PerformanceHud::PerformanceHud(QWidget *parent) : QWidget(parent) {
+  auto font = QFontDatabase::systemFont(QFontDatabase::FixedFont);
+
+  font.setPointSizeF(font.pointSizeF() * 0.85);
+  setFont(font);
+  setAttribute(Qt::WA_TransparentForMouseEvents);
+  hide();
+  m_refreshTimer->setInterval(REFRESH_INTERVAL_MS);
+  connect(m_refreshTimer, &QTimer::timeout, this, &PerformanceHud::refresh);
+  connect(&FrameMonitor::instance(), &FrameMonitor::enabledChanged, this, &PerformanceHud::setMonitorEnabled);
+}
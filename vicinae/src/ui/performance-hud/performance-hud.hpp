@@ -0,0 +1,135 @@
+#pragma once
+#include <QObject>
+#include <QTimer>
+#include <QWidget>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <vector>
+
+/**
+ * Timings of what makes the launcher feel fast or laggy: how long frames take to be painted, how long lists
+ * take to be laid out, how long it takes for a keystroke to show up in the results and how many frames are
+ * dropped while scrolling.
+ *
+ * Samples are only collected while the monitor is enabled, recording one is a branch otherwise. The last
+ * `SAMPLE_COUNT` samples of every metric are kept.
+ */
+class FrameMonitor : public QObject {
+  Q_OBJECT
+
+public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class Metric { Frame, CalculateHeights, UpdateVisibleItems, InputLatency };
+
+  static constexpr size_t METRIC_COUNT = 4;
+  static constexpr size_t SAMPLE_COUNT = 120;
+
+  struct Summary {
+    std::chrono::microseconds last{0};
+    std::chrono::microseconds p50{0};
+    std::chrono::microseconds p95{0};
+    std::chrono::microseconds max{0};
+    size_t count = 0;
+  };
+
+  /**
+   * Times the scope it lives for as a sample of `metric`, if the monitor is enabled.
+   */
+  class Scope {
+  public:
+    Scope(Metric metric);
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    Metric m_metric;
+    std::optional<Clock::time_point> m_start;
+  };
+
+  static FrameMonitor &instance();
+
+  static const char *metricName(Metric metric);
+
+  bool isEnabled() const { return m_enabled; }
+  void setEnabled(bool enabled);
+
+  void record(Metric metric, std::chrono::microseconds duration);
+
+  using Sink = std::function<void(Metric metric, std::chrono::microseconds duration)>;
+
+  /**
+   * Also pass every sample recorded while enabled to `sink`, for benchmarks that need more than the last
+   * `SAMPLE_COUNT` ones.
+   */
+  void setSink(Sink sink) { m_sink = std::move(sink); }
+
+  /**
+   * A frame of the launcher window was painted. Frames further apart than the refresh interval while the
+   * list is being scrolled count as dropped, and the results updated since the last keystroke are now seen.
+   */
+  void recordFrame(Clock::time_point start, Clock::time_point end);
+
+  /**
+   * The search text was edited. The latency is the time it takes for a frame showing updated results to
+   * be painted.
+   */
+  void recordInput();
+  void recordResultsUpdated();
+  void recordScroll();
+
+  void setRefreshRate(double hz);
+
+  Summary summary(Metric metric) const;
+  size_t droppedFrames() const { return m_droppedFrames; }
+  size_t scrollFrames() const { return m_scrollFrames; }
+
+private:
+  static constexpr auto SCROLL_GRACE = std::chrono::milliseconds(100);
+  // keystrokes that do not lead to new results are forgotten about eventually
+  static constexpr auto INPUT_TIMEOUT = std::chrono::seconds(2);
+
+  void reset();
+
+  bool m_enabled = false;
+  Sink m_sink;
+  std::array<std::deque<std::chrono::microseconds>, METRIC_COUNT> m_samples;
+  Clock::duration m_frameInterval = std::chrono::microseconds(16'667);
+  std::optional<Clock::time_point> m_lastFrameStart;
+  std::optional<Clock::time_point> m_lastScroll;
+  std::optional<Clock::time_point> m_inputStart;
+  bool m_resultsUpdated = false;
+  size_t m_droppedFrames = 0;
+  size_t m_scrollFrames = 0;
+
+signals:
+  void enabledChanged(bool enabled) const;
+};
+
+/**
+ * Overlay of the frame monitor, drawn in the top right corner of the window it is a child of along with
+ * the depth of the image load queue. Shown for as long as the monitor is enabled.
+ */
+class PerformanceHud : public QWidget {
+public:
+  PerformanceHud(QWidget *parent);
+
+protected:
+  void paintEvent(QPaintEvent *event) override;
+
+private:
+  static constexpr int REFRESH_INTERVAL_MS = 250;
+  static constexpr int MARGIN = 10;
+  static constexpr int PADDING = 8;
+
+  QStringList lines() const;
+  void setMonitorEnabled(bool enabled);
+  void refresh();
+
+  QTimer *m_refreshTimer = new QTimer(this);
+};
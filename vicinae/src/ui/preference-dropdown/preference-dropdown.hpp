@@ -20,6 +20,8 @@ class PreferenceDropdownItem : public SelectorInput::AbstractItem {
   AbstractItem *clone() const override { return new PreferenceDropdownItem(*this); }
 
 public:
+  void setDisplayName(const QString &name) { m_displayName = name; }
+
   PreferenceDropdownItem(const Preference::DropdownData::Option &option)
       : m_id(option.value), m_displayName(option.title) {}
 };
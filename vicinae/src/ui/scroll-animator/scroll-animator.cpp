@@ -0,0 +1,85 @@
+#include "ui/scroll-animator/scroll-animator.hpp"
+#include <QApplication>
+#include <QScreen>
+#include <algorithm>
+#include <cmath>
+
+bool ScrollAnimator::handleWheel(const QWheelEvent *event) {
+  if (event->modifiers() != Qt::NoModifier) return false;
+  if (std::abs(event->angleDelta().x()) > std::abs(event->angleDelta().y())) return false;
+
+  if (!isAnimating()) {
+    m_position = m_target = m_value = m_scrollBar->value();
+    m_lastDelta = 0;
+  }
+
+  if (!event->pixelDelta().isNull()) {
+    m_target -= event->pixelDelta().y();
+    m_eased = false;
+  } else {
+    double steps = event->angleDelta().y() / 120.0;
+
+    m_target -= steps * QApplication::wheelScrollLines() * m_scrollBar->singleStep();
+    m_eased = true;
+  }
+
+  m_target = std::clamp<double>(m_target, m_scrollBar->minimum(), m_scrollBar->maximum());
+
+  if (!isAnimating()) {
+    m_timer->setInterval(std::max(1, static_cast<int>(frameInterval())));
+    m_clock.start();
+    m_timer->start();
+  }
+
+  return true;
+}
+
+void ScrollAnimator::stop() {
+  m_timer->stop();
+  m_lastDelta = 0;
+}
+
+int ScrollAnimator::nextFrameDelta() const {
+  if (!isAnimating()) return 0;
+  if (!m_eased) return m_lastDelta;
+
+  return std::lround((m_target - m_position) * (1 - std::exp(-frameInterval() / EASING_TIME_MS)));
+}
+
+double ScrollAnimator::frameInterval() const {
+  auto screen = m_widget->screen();
+  double rate = screen ? screen->refreshRate() : 60;
+
+  return 1000 / std::max(rate, 30.0);
+}
+
+void ScrollAnimator::frame() {
+  double elapsed = m_clock.restart();
+
+  // the view moved the scroll bar itself, such as to keep its content in place when rows above resized
+  if (int moved = m_scrollBar->value() - m_value; moved != 0) {
+    m_position += moved;
+    m_target += moved;
+  }
+
+  m_target = std::clamp<double>(m_target, m_scrollBar->minimum(), m_scrollBar->maximum());
+
+  if (m_eased && std::abs(m_target - m_position) >= 0.5) {
+    m_position += (m_target - m_position) * (1 - std::exp(-elapsed / EASING_TIME_MS));
+  } else {
+    m_position = m_target;
+  }
+
+  int value = std::lround(m_position);
+
+  m_lastDelta = value - m_scrollBar->value();
+  if (m_lastDelta != 0) { m_scrollBar->setValue(value); }
+  m_value = m_scrollBar->value();
+  if (m_position == m_target) { stop(); }
+}
+
+ScrollAnimator::ScrollAnimator(QScrollBar *scrollBar, QWidget *widget)
+    : QObject(widget), m_scrollBar(scrollBar), m_widget(widget) {
+  m_timer->setTimerType(Qt::PreciseTimer);
+  connect(m_timer, &QTimer::timeout, this, &ScrollAnimator::frame);
+}
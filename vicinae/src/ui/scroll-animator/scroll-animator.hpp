@@ -0,0 +1,59 @@
+#pragma once
+#include <QElapsedTimer>
+#include <QScrollBar>
+#include <QTimer>
+#include <QWheelEvent>
+#include <qobject.h>
+#include <qtmetamacros.h>
+
+/**
+ * Scrolls a scroll bar from wheel events, once per frame of the screen the widget is shown on.
+ *
+ * Touchpads send pixel deltas at a rate of their own, often well above the refresh rate: they are added up
+ * and applied as is on the next frame. Mouse wheel steps move the target position instead, which is eased
+ * towards over a few frames. Either way the scroll bar value changes at most once per frame, for views to lay
+ * themselves out at most once per frame as well.
+ */
+class ScrollAnimator : public QObject {
+  Q_OBJECT
+
+public:
+  // time for an eased scroll to cover two thirds of the remaining distance
+  static constexpr double EASING_TIME_MS = 40;
+
+  /**
+   * Scroll for `event`. Returns false for the events the scroll bar should handle as usual, such as
+   * horizontal or modified scrolls.
+   */
+  bool handleWheel(const QWheelEvent *event);
+
+  /**
+   * Stop on the current position, for scrolls made without the animator to take over.
+   */
+  void stop();
+
+  bool isAnimating() const { return m_timer->isActive(); }
+
+  /**
+   * How much the next frame is expected to scroll by, negative when scrolling up. 0 if not animating.
+   */
+  int nextFrameDelta() const;
+
+  ScrollAnimator(QScrollBar *scrollBar, QWidget *widget);
+
+private:
+  void frame();
+  double frameInterval() const;
+
+  QScrollBar *m_scrollBar = nullptr;
+  QWidget *m_widget = nullptr;
+  QTimer *m_timer = new QTimer(this);
+  QElapsedTimer m_clock;
+  // positions are fractional for small touchpad deltas to add up
+  double m_position = 0;
+  double m_target = 0;
+  // value set on the last frame, to notice the scroll bar being moved in between
+  int m_value = 0;
+  int m_lastDelta = 0;
+  bool m_eased = false;
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include "argument.hpp"
 #include "../image/url.hpp"
+#include "theme.hpp"
+#include <cmath>
 #include <qcontainerfwd.h>
 #include <qlineedit.h>
 #include <qtimer.h>
@@ -35,7 +37,8 @@ public:
     auto debounce = new QTimer(this);
 
     setFrame(false);
-    setProperty("search-input", true);
+    applyFont();
+    connect(&ThemeService::instance(), &ThemeService::themeChanged, this, &SearchBar::applyFont);
     debounce->setInterval(10);
     debounce->setSingleShot(true);
     connect(debounce, &QTimer::timeout, this, &SearchBar::debounce);
@@ -75,6 +78,17 @@ public:
 
   void debounce() { emit debouncedTextEdited(text()); }
 
+  /**
+   * The search input is larger than the rest of the text, only its size is set so that the
+   * family follows the application font.
+   */
+  void applyFont() {
+    QFont font;
+
+    font.setPointSizeF(std::round(ThemeService::instance().pointSize(TextSize::TextRegular) * 1.20));
+    setFont(font);
+  }
+
 signals:
   void debouncedTextEdited(const QString &text);
   void pop();
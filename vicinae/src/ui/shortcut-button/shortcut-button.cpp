@@ -30,8 +30,11 @@ void ShortcutButton::setText(const QString &text) {
 }
 
 void ShortcutButton::setTextColor(const QColor &color) {
-  _label->setStyleSheet(QString("color: %1").arg(color.name()));
-  updateGeometry();
+  auto palette = _label->palette();
+
+  // set on every hover, a stylesheet would have the label polished again each time
+  palette.setColor(QPalette::WindowText, color);
+  _label->setPalette(palette);
 }
 
 void ShortcutButton::setShortcut(const std::optional<KeyboardShortcutModel> &model) {
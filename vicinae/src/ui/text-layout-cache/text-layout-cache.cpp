@@ -0,0 +1,77 @@
+#include "ui/text-layout-cache/text-layout-cache.hpp"
+#include <QFontMetrics>
+
+TextLayoutCache &TextLayoutCache::instance() {
+  static TextLayoutCache cache;
+
+  return cache;
+}
+
+TextLayoutCache::Layout *TextLayoutCache::layout(const QString &text, const QFont &font, int width,
+                                                 Qt::TextElideMode mode) {
+  QString key = QString("%1:%2:%3:%4").arg(font.key()).arg(width).arg(mode).arg(text);
+
+  if (auto cached = m_layouts.object(key)) {
+    ++m_hits;
+    return cached;
+  }
+
+  auto layout = new Layout{.elided = QFontMetrics(font).elidedText(text, mode, width)};
+
+  ++m_misses;
+  m_layouts.insert(key, layout);
+
+  return layout;
+}
+
+QString TextLayoutCache::elidedText(const QString &text, const QFont &font, int width,
+                                    Qt::TextElideMode mode) {
+  return layout(text, font, width, mode)->elided;
+}
+
+QStaticText TextLayoutCache::staticText(const QString &text, const QFont &font, int width,
+                                        Qt::TextElideMode mode) {
+  auto entry = layout(text, font, width, mode);
+
+  if (!entry->prepared) {
+    entry->staticText.setText(entry->elided);
+    entry->staticText.setTextFormat(Qt::PlainText);
+    entry->staticText.prepare({}, font);
+    entry->prepared = true;
+  }
+
+  return entry->staticText;
+}
+
+QSize TextLayoutCache::naturalSize(const QString &text, const QFont &font,
+                                   const std::function<QSize()> &measure) {
+  QString key = QString("%1:%2").arg(font.key()).arg(text);
+
+  if (auto cached = m_sizes.object(key)) {
+    ++m_hits;
+    return *cached;
+  }
+
+  auto size = measure();
+
+  ++m_misses;
+  m_sizes.insert(key, new QSize(size));
+
+  return size;
+}
+
+TextLayoutCache::Stats TextLayoutCache::stats() const {
+  size_t count = m_layouts.size() + m_sizes.size();
+
+  return {.hits = m_hits, .misses = m_misses, .count = count};
+}
+
+void TextLayoutCache::clear() {
+  m_layouts.clear();
+  m_sizes.clear();
+}
+
+TextLayoutCache::TextLayoutCache() {
+  m_layouts.setMaxCost(MAX_ENTRIES);
+  m_sizes.setMaxCost(MAX_ENTRIES);
+}
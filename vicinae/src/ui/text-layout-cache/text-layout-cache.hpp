@@ -0,0 +1,64 @@
+#pragma once
+#include <QCache>
+#include <QFont>
+#include <QSize>
+#include <QStaticText>
+#include <QString>
+#include <cstdint>
+#include <functional>
+
+/**
+ * Process-wide cache of how pieces of text are laid out, shared by the widgets and painters of list rows:
+ * rows recycled for items with the same content, and rows painted again while scrolling, find their text
+ * already elided and shaped.
+ *
+ * Entries are keyed by the text and everything its layout depends on: the font, the width it is elided to
+ * and the elide mode. Static texts are only prepared for the entries that get painted with them.
+ */
+class TextLayoutCache {
+public:
+  // of elided texts, and of natural sizes
+  static constexpr qsizetype MAX_ENTRIES = 8192;
+
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t count = 0;
+  };
+
+  static TextLayoutCache &instance();
+
+  /**
+   * `text` elided to fit in `width` pixels with `font`.
+   */
+  QString elidedText(const QString &text, const QFont &font, int width, Qt::TextElideMode mode);
+
+  /**
+   * Same as `elidedText`, laid out for painting with `font`.
+   */
+  QStaticText staticText(const QString &text, const QFont &font, int width, Qt::TextElideMode mode);
+
+  /**
+   * Size `text` takes with `font` when not elided, as computed by `measure` the first time it is asked for.
+   */
+  QSize naturalSize(const QString &text, const QFont &font, const std::function<QSize()> &measure);
+
+  Stats stats() const;
+  void clear();
+
+private:
+  struct Layout {
+    QString elided;
+    QStaticText staticText;
+    bool prepared = false;
+  };
+
+  Layout *layout(const QString &text, const QFont &font, int width, Qt::TextElideMode mode);
+
+  QCache<QString, Layout> m_layouts;
+  QCache<QString, QSize> m_sizes;
+  uint64_t m_hits = 0;
+  uint64_t m_misses = 0;
+
+  TextLayoutCache();
+};
@@ -3,6 +3,8 @@
 ThemeSelector::ThemeSelector() {
   auto &theme = ThemeService::instance();
 
+  theme.scanThemeDirectories();
+
   auto items = theme.themes() |
                std::views::transform([](auto &&theme) -> std::shared_ptr<SelectorInput::AbstractItem> {
                  return std::make_shared<ThemeSelectorItem>(theme);
@@ -1,6 +1,7 @@
 #include "ui/typography/typography.hpp"
 #include "theme.hpp"
 #include "ui/omni-painter/omni-painter.hpp"
+#include "ui/text-layout-cache/text-layout-cache.hpp"
 #include <qboxlayout.h>
 #include <qlabel.h>
 #include <qnamespace.h>
@@ -13,9 +14,10 @@ void TypographyWidget::updateText() {
     return;
   }
 
-  QFontMetrics metrics = m_label->fontMetrics();
-  QString text = metrics.elidedText(m_text, m_elideMode, width());
-  m_label->setText(text);
+  QString text = TextLayoutCache::instance().elidedText(m_text, m_label->font(), width(), m_elideMode);
+
+  // the label only has to lay its text out again if eliding it gave something else
+  if (m_label->text() != text) { m_label->setText(text); }
   updateGeometry();
 }
 
@@ -65,16 +67,20 @@ void TypographyWidget::setAutoEllide(bool autoEllide) {
 
 QSize TypographyWidget::sizeHint() const {
   if (!m_label->wordWrap() && m_autoEllide) {
-    auto ruler = measurementLabel();
+    auto measure = [&]() {
+      auto ruler = measurementLabel();
 
-    ruler->setFont(m_label->font());
-    ruler->setText(m_text);
-    ruler->setAlignment(m_label->alignment());
-    ruler->setContentsMargins(contentsMargins());
+      ruler->setFont(m_label->font());
+      ruler->setText(m_text);
+      ruler->setContentsMargins({});
 
-    auto hint = ruler->sizeHint();
+      return ruler->sizeHint();
+    };
+    auto margins = contentsMargins();
 
-    return hint;
+    // alignment does not change the size of the text, margins are added on top of it
+    return TextLayoutCache::instance().naturalSize(m_text, m_label->font(), measure) +
+           QSize(margins.left() + margins.right(), margins.top() + margins.bottom());
   }
 
   return m_label->sizeHint();
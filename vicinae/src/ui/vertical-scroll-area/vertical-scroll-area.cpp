@@ -1,4 +1,5 @@
 #include "ui/vertical-scroll-area/vertical-scroll-area.hpp"
+#include "ui/scroll-animator/scroll-animator.hpp"
 #include "ui/scroll-bar/scroll-bar.hpp"
 #include <qcoreevent.h>
 
@@ -18,9 +19,19 @@ void VerticalScrollArea::resizeEvent(QResizeEvent *event) {
   QScrollArea::resizeEvent(event);
 }
 
+void VerticalScrollArea::wheelEvent(QWheelEvent *event) {
+  if (m_scrollAnimator->handleWheel(event)) {
+    event->accept();
+    return;
+  }
+
+  QScrollArea::wheelEvent(event);
+}
+
 VerticalScrollArea::VerticalScrollArea(QWidget *parent) : QScrollArea(parent) {
   setFocusPolicy(Qt::NoFocus);
   setWidgetResizable(true);
   setVerticalScrollBar(new OmniScrollBar);
+  m_scrollAnimator = new ScrollAnimator(verticalScrollBar(), this);
   setHorizontalScrollBarPolicy(Qt::ScrollBarPolicy::ScrollBarAlwaysOff);
 }
@@ -4,10 +4,15 @@
 
 class QObject;
 class QEvent;
+class ScrollAnimator;
 
 class VerticalScrollArea : public QScrollArea {
   Q_OBJECT
 
+  ScrollAnimator *m_scrollAnimator = nullptr;
+
+  void wheelEvent(QWheelEvent *event) override;
+
 public:
   bool eventFilter(QObject *o, QEvent *e) override;
   void resizeEvent(QResizeEvent *event) override;
@@ -1,6 +1,7 @@
 #include "ui/views/base-view.hpp"
 #include "common.hpp"
 #include "navigation-controller.hpp"
+#include "ui/omni-list/omni-list.hpp"
 #include <qlogging.h>
 #include <stdexcept>
 
@@ -42,6 +43,26 @@ void BaseView::initialize() {}
 void BaseView::activate() { onActivate(); }
 void BaseView::deactivate() { onDeactivate(); }
 
+void BaseView::suspend() {
+  if (m_suspended) return;
+
+  m_suspended = true;
+
+  // pools are refilled as the list is scrolled again
+  for (auto list : findChildren<OmniList *>()) {
+    list->clearWidgetPools();
+  }
+
+  onSuspend();
+}
+
+void BaseView::resume() {
+  if (!m_suspended) return;
+
+  m_suspended = false;
+  onResume();
+}
+
 void BaseView::textChanged(const QString &text) {}
 
 QString BaseView::navigationTitle() const {
@@ -9,6 +9,7 @@ class ImageURL;
 
 class BaseView : public QWidget {
   bool m_initialized = false;
+  bool m_suspended = false;
   ApplicationContext *m_ctx = nullptr;
   const BaseView *m_navProxy = this;
 
@@ -64,6 +65,25 @@ public:
    */
   virtual void onDeactivate();
 
+  /**
+   * Called when another view is pushed on top of this one, once it is no longer shown. A view can stay
+   * below others for a long time, so what it only needs while shown is released: widgets pooled by its
+   * lists are dropped, and images stop loading and animating as they are hidden.
+   */
+  void suspend();
+
+  /**
+   * Called when the view is shown again, after the views pushed on top of it were poped.
+   */
+  void resume();
+  bool isSuspended() const { return m_suspended; }
+
+  /**
+   * Release what the view does not need in the background, see `suspend`.
+   */
+  virtual void onSuspend() {}
+  virtual void onResume() {}
+
   void activateCompleter(const ArgumentList &args, const ImageURL &icon) {
     // m_uiController->activateCompleter(args, icon);
   }
@@ -1,11 +1,15 @@
 #include "migration-manager.hpp"
+#include "sql-profiler/sql-profiler.hpp"
+#include <QMutex>
+#include <QtEndian>
 #include <qsqldatabase.h>
+#include <unordered_map>
 #include <regex>
 #include <ranges>
 
 void MigrationManager::initialize() {
   QSqlQuery query(m_db);
-  bool created = query.exec(R"(
+  bool created = SqlProfiler::exec(query, R"(
 	  	CREATE TABLE IF NOT EXISTS schema_migrations (
 			id TEXT PRIMARY KEY,
 			applied_at INTEGER DEFAULT (unixepoch()),
@@ -24,7 +28,7 @@ std::vector<MigrationManager::RegisteredMigration> MigrationManager::loadDatabas
 		ORDER BY version
 	)";
 
-  if (!query.exec(QUERY)) { return {}; }
+  if (!SqlProfiler::exec(query, QUERY)) { return {}; }
 
   std::vector<RegisteredMigration> migrations;
 
@@ -85,7 +89,7 @@ void MigrationManager::executeMigration(const Migration &migration) {
     qDebug() << "executing" << statement;
 
     QSqlQuery query(m_db);
-    if (!query.exec(trimmed)) {
+    if (!SqlProfiler::exec(query, trimmed)) {
       auto error = std::format("Failed to execute statement in migration {}: {}", migration.version,
                                query.lastError().databaseText().toStdString());
 
@@ -135,12 +139,51 @@ void MigrationManager::insertMigration(const Migration &migration) {
   query.addBindValue(migration.version);
   query.addBindValue(computeContentHash(migration.content));
 
-  if (!query.exec()) {
+  if (!SqlProfiler::exec(query)) {
     throw std::runtime_error(
         std::format("Failed to insert migration entry for migration: {}", migration.id.toStdString()));
   }
 }
 
+const MigrationManager::MigrationSet &MigrationManager::migrationSet() {
+  static QMutex mutex;
+  // node based, references to the sets stay valid as others are added
+  static std::unordered_map<QString, MigrationSet> sets;
+  QMutexLocker lock(&mutex);
+
+  if (auto it = sets.find(m_migrationNamespace); it != sets.end()) return it->second;
+
+  MigrationSet set{.migrations = loadMigrations()};
+
+  set.fingerprint = computeFingerprint(set.migrations);
+
+  return sets.emplace(m_migrationNamespace, std::move(set)).first->second;
+}
+
+qint32 MigrationManager::computeFingerprint(const std::vector<Migration> &migrations) {
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+
+  for (const auto &migration : migrations) {
+    hash.addData(migration.id.toUtf8());
+    hash.addData(QByteArray::number(migration.version));
+    hash.addData(migration.content.toUtf8());
+    hash.addData(QByteArrayView("\0", 1));
+  }
+
+  auto fingerprint = qFromBigEndian<qint32>(hash.result().constData());
+
+  // a database that never had its fingerprint stored has a user_version of 0
+  return fingerprint == 0 ? 1 : fingerprint;
+}
+
+std::optional<qint32> MigrationManager::schemaFingerprint() {
+  QSqlQuery query(m_db);
+
+  if (!SqlProfiler::exec(query, "PRAGMA user_version") || !query.next()) return std::nullopt;
+
+  return query.value(0).toInt();
+}
+
 std::vector<MigrationManager::Migration> MigrationManager::loadMigrations() {
   std::filesystem::path migrationDirPath =
       std::filesystem::path(":database") / m_migrationNamespace.toStdString() / "migrations";
@@ -160,8 +203,14 @@ std::vector<MigrationManager::Migration> MigrationManager::loadMigrations() {
 }
 
 void MigrationManager::runMigrations() {
+  const auto &set = migrationSet();
+
+  if (schemaFingerprint() == set.fingerprint) return;
+
+  initialize();
+
   auto dbMigrations = loadDatabaseMigrations();
-  auto fsMigrations = loadMigrations();
+  const auto &fsMigrations = set.migrations;
 
   if (!m_db.transaction()) {
     qCritical() << "Failed to start" << m_db.lastError();
@@ -193,6 +242,13 @@ void MigrationManager::runMigrations() {
       ++newExecCount;
     }
 
+    QSqlQuery query(m_db);
+
+    // pragmas do not take bound values
+    if (!SqlProfiler::exec(query, QString("PRAGMA user_version = %1").arg(set.fingerprint))) {
+      throw std::runtime_error("Failed to store the schema fingerprint");
+    }
+
     if (!m_db.commit()) { throw std::runtime_error("Failed to commit transaction"); }
   } catch (const std::exception &exception) {
     qCritical() << "Failed to run migrations:" << exception.what();
@@ -201,6 +257,4 @@ void MigrationManager::runMigrations() {
 }
 
 MigrationManager::MigrationManager(QSqlDatabase &db, const QString &migrationNamespace)
-    : m_db(db), m_migrationNamespace(migrationNamespace) {
-  initialize();
-}
+    : m_db(db), m_migrationNamespace(migrationNamespace) {}
@@ -1,5 +1,6 @@
 #pragma once
 #include <expected>
+#include <optional>
 #include <qcryptographichash.h>
 #include <qlogging.h>
 #include <qsqlerror.h>
@@ -23,6 +24,15 @@ class MigrationManager {
     QString content;
   };
 
+  /**
+   * Migrations of a namespace as compiled into the resources, loaded once per process.
+   */
+  struct MigrationSet {
+    std::vector<Migration> migrations;
+    // stored in the `user_version` of a database once it has every migration of the set applied
+    qint32 fingerprint = 0;
+  };
+
   struct RegisteredMigration {
     QString id;
     int version = -1;
@@ -31,6 +41,9 @@ class MigrationManager {
   };
 
   void initialize();
+  const MigrationSet &migrationSet();
+  static qint32 computeFingerprint(const std::vector<Migration> &migrations);
+  std::optional<qint32> schemaFingerprint();
   std::vector<RegisteredMigration> loadDatabaseMigrations();
   std::expected<Migration, MigrationLoadingError> loadMigrationFile(const std::filesystem::path &path);
 
@@ -41,6 +54,12 @@ class MigrationManager {
 
 public:
   std::vector<Migration> loadMigrations();
+
+  /**
+   * Apply the migrations the database does not have yet. Connections are opened all the time, a database
+   * whose `user_version` matches the fingerprint of the migration set is taken as up to date without
+   * looking at its migration table.
+   */
   void runMigrations();
 
   MigrationManager(QSqlDatabase &db, const QString &migrationNamespace);
@@ -1,7 +1,10 @@
 #include "utils.hpp"
+#include "lib/proto-string.hpp"
 #include <cmath>
 #include <cstdlib>
 #include <filesystem>
+#include <qjsonarray.h>
+#include <qjsonobject.h>
 #include <qmimedatabase.h>
 #include <qmimetype.h>
 
@@ -103,7 +106,7 @@ google::protobuf::Value transformJsonValueToProto(const QJsonValue &value) {
   if (value.isBool())
     protoValue.set_bool_value(value.toBool());
   else if (value.isString())
-    protoValue.set_string_value(value.toString().toStdString());
+    ProtoString::assign(protoValue.mutable_string_value(), value.toString());
   else if (value.isDouble())
     protoValue.set_number_value(value.toDouble());
   else if (value.isNull())
@@ -119,9 +122,27 @@ QJsonValue protoToJsonValue(const google::protobuf::Value &value) {
   case Value::kNumberValue:
     return value.number_value();
   case Value::kStringValue:
-    return QString::fromStdString(value.string_value());
+    return ProtoString::toQString(value.string_value());
   case Value::kBoolValue:
     return value.bool_value();
+  case Value::kStructValue: {
+    QJsonObject obj;
+
+    for (const auto &[key, field] : value.struct_value().fields()) {
+      ProtoString::insert(obj, key, protoToJsonValue(field));
+    }
+
+    return obj;
+  }
+  case Value::kListValue: {
+    QJsonArray array;
+
+    for (const auto &item : value.list_value().values()) {
+      array.append(protoToJsonValue(item));
+    }
+
+    return array;
+  }
   default:
     return QJsonValue();
   }
@@ -20,6 +20,7 @@ fs::path Omnicast::configDir() {
 }
 
 fs::path Omnicast::commandSocketPath() { return runtimeDir() / "vicinae.sock"; }
+fs::path Omnicast::extensionChannelSocketPath() { return runtimeDir() / "extension-channel.sock"; }
 fs::path Omnicast::pidFile() { return runtimeDir() / "vicinae.pid"; }
 
 std::vector<fs::path> Omnicast::xdgConfigDirs() {
@@ -31,6 +31,7 @@ static const SemanticColor ACCENT_COLOR = SemanticColor::Cyan;
 
 std::filesystem::path runtimeDir();
 std::filesystem::path commandSocketPath();
+std::filesystem::path extensionChannelSocketPath();
 std::filesystem::path pidFile();
 std::filesystem::path dataDir();
 std::filesystem::path configDir();
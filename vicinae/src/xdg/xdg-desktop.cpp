@@ -1,15 +1,11 @@
 #include "xdg-desktop.hpp"
+#include <QMutex>
+#include <QSet>
+#include <algorithm>
+#include <qfile.h>
 #include <qnamespace.h>
 #include <qstringview.h>
 
-static bool isGroupHeaderNameChar(QChar c) { return c.isPrint() && c != '[' && c != ']'; }
-
-static bool isEntryKey(QChar c) { return c.isLetterOrNumber() || c == '-'; }
-
-static bool isValueKey(QChar c) { return c != '\n'; }
-
-static bool isLocaleKey(QChar c) { return c.isLetter() || c == '_' || c == '@' || c == '-'; }
-
 Locale::Locale(QStringView data) {
   enum State { LANG, COUNTRY, ENC, AT, MOD, DONE };
   State state = LANG;
@@ -144,222 +140,267 @@ QString Locale::toString() {
   return fmt;
 }
 
-XdgDesktopEntry::Parser::Parser(QStringView view) noexcept : rawLocale("C"), data(view), cursor(0) {
-  if (auto locale = std::setlocale(LC_MESSAGES, nullptr)) { rawLocale = locale; }
-}
-
-void XdgDesktopEntry::Parser::skipWS() {
-  while (cursor < data.size() && data.at(cursor).isSpace())
-    ++cursor;
-}
+static bool isEntryKey(char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '-'; }
 
-QStringView XdgDesktopEntry::Parser::parseGroupHeader() {
-  size_t end = cursor;
+static bool isBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
 
-  while (isGroupHeaderNameChar(data.at(end))) {
-    ++end;
+static std::string_view trimmed(std::string_view view) {
+  while (!view.empty() && isBlank(view.front())) {
+    view.remove_prefix(1);
+  }
+  while (!view.empty() && isBlank(view.back())) {
+    view.remove_suffix(1);
   }
 
-  QStringView view = data.sliced(cursor, end - cursor);
+  return view;
+}
 
-  if (data.at(end) != ']') throw std::runtime_error("Invalid group header");
+/**
+ * Categories and mime types are the same few hundred strings across all desktop files, every entry
+ * holding a copy of them would be a waste.
+ */
+static QString intern(QStringView str) {
+  static QMutex mutex;
+  static QSet<QString> pool;
+  QString string = str.toString();
+  QMutexLocker lock(&mutex);
 
-  cursor = end + 1;
+  if (auto it = pool.constFind(string); it != pool.cend()) return *it;
 
-  return view;
+  return *pool.insert(string);
 }
 
-QStringView XdgDesktopEntry::Parser::parseEntryKey() {
-  size_t end = cursor;
+struct LocaleParts {
+  std::string_view lang;
+  std::string_view country;
+  std::string_view modifier;
 
-  while (isEntryKey(data.at(end)))
-    ++end;
+  // lang_COUNTRY.ENCODING@MODIFIER, every part but lang being optional
+  LocaleParts(std::string_view locale) {
+    if (auto at = locale.find('@'); at != std::string_view::npos) {
+      modifier = locale.substr(at + 1);
+      locale = locale.substr(0, at);
+    }
+    if (auto dot = locale.find('.'); dot != std::string_view::npos) { locale = locale.substr(0, dot); }
+    if (auto sep = locale.find_first_of("_-"); sep != std::string_view::npos) {
+      country = locale.substr(sep + 1);
+      locale = locale.substr(0, sep);
+    }
 
-  auto key = data.sliced(cursor, end - cursor);
+    lang = locale;
+  }
+};
+
+uint XdgDesktopEntry::Parser::computeLocalePriority(std::string_view locale) {
+  // the locale of the process does not change once it is set up
+  static const std::string processLocale = []() -> std::string {
+    auto locale = std::setlocale(LC_MESSAGES, nullptr);
+    return locale ? locale : "C";
+  }();
+  static const LocaleParts process(processLocale);
+  LocaleParts parts(locale);
+
+  if (parts.lang != process.lang) return 0;
+  if (parts.country != process.country) return 1;
+  if (parts.modifier != process.modifier) return 2;
+
+  return 3;
+}
 
-  cursor = end;
+QString XdgDesktopEntry::Parser::decode(std::string_view raw) {
+  if (raw.find('\\') == std::string_view::npos) { return QString::fromUtf8(raw.data(), raw.size()); }
 
-  return key;
-}
+  std::string value;
+
+  value.reserve(raw.size());
 
-QChar XdgDesktopEntry::Parser::parseEscaped() {
-  QChar c = data.at(cursor++);
+  for (size_t i = 0; i < raw.size(); ++i) {
+    if (raw[i] != '\\' || i + 1 == raw.size()) {
+      value += raw[i];
+      continue;
+    }
 
-  switch (c.row()) {
+    switch (char c = raw[++i]) {
     // clang-format off
-	  case 's': return ' ';
-	  case 'n': return '\n';
-	  case 't': return '\t';
-	  case 'r': return '\r';
-	  default: return c;
-    // clang-format on
+    case 's': value += ' '; break;
+    case 'n': value += '\n'; break;
+    case 't': value += '\t'; break;
+    case 'r': value += '\r'; break;
+    default: value += c;
+      // clang-format on
+    }
   }
+
+  return QString::fromStdString(value);
 }
 
-QString XdgDesktopEntry::Parser::parseEntryValue() {
-  static const QString leadingWsSet = " \t"; // only space and tab as we don't want to skip newlines
+std::string_view XdgDesktopEntry::Parser::nextLine() {
+  auto end = data.find('\n', cursor);
 
-  while (cursor < data.size() && leadingWsSet.contains(data.at(cursor))) {
-    ++cursor;
-  }
+  if (end == std::string_view::npos) end = data.size();
 
-  QString value;
-  QChar c;
+  auto line = data.substr(cursor, end - cursor);
 
-  while (cursor < data.size()) {
-    c = data.at(cursor);
+  cursor = end + 1;
 
-    if (!isValueKey(c)) { break; }
+  return line;
+}
 
-    if (c == '\\') {
-      cursor++;
-      value += parseEscaped();
-    } else {
-      value += c;
-      cursor++;
-    }
-  }
+void XdgDesktopEntry::Parser::parseGroupHeader(std::string_view line, Group *&currentGroup) {
+  auto end = line.find(']');
+
+  if (end == std::string_view::npos) throw std::runtime_error("Invalid group header");
 
-  ++cursor;
+  auto name = line.substr(1, end - 1);
 
-  return value;
+  if (name.find('[') != std::string_view::npos) throw std::runtime_error("Invalid group header");
+
+  // other groups are never read, their entries need not be kept
+  if (name == "Desktop Entry" || name.starts_with("Desktop Action ")) {
+    currentGroup = &groups.emplace_back(name, Group{}).second;
+  } else {
+    currentGroup = nullptr;
+  }
 }
 
-XdgDesktopEntry::Parser::Entry XdgDesktopEntry::Parser::parseEntry() {
-  Entry entry;
+void XdgDesktopEntry::Parser::parseEntry(std::string_view line, Group &group) {
+  size_t end = 0;
 
-  skipWS();
-  entry.key = parseEntryKey();
+  while (end < line.size() && isEntryKey(line[end])) {
+    ++end;
+  }
+
+  auto key = line.substr(0, end);
+  uint score = 0;
+
+  if (end < line.size() && line[end] == '[') {
+    auto close = line.find(']', end);
 
-  if (data.at(cursor) == '[') {
-    size_t end = ++cursor;
+    if (close == std::string_view::npos) close = line.size();
 
-    while (end < data.size() && data.at(end) != ']')
-      ++end;
+    score = computeLocalePriority(line.substr(end + 1, close - end - 1));
 
-    auto view = data.sliced(cursor, end - cursor);
+    // translations to other languages are the bulk of most desktop files
+    if (score == 0) return;
 
-    entry.locale = {view};
-    cursor = end + 1;
+    end = close + 1;
   }
 
-  skipWS();
+  auto rest = trimmed(line.substr(std::min(end, line.size())));
 
-  if (cursor < data.size() && data.at(cursor) != '=') { throw std::runtime_error("Invalid key name"); }
+  if (rest.empty() || rest.front() != '=') throw std::runtime_error("Invalid key name");
 
-  cursor++;
-  entry.value = parseEntryValue();
+  auto raw = trimmed(rest.substr(1));
+  auto it = std::ranges::find(group, key, &std::pair<std::string_view, Value>::first);
 
-  return entry;
+  if (it == group.end()) {
+    group.emplace_back(key, Value{.raw = raw, .score = score});
+  } else if (score > it->second.score) {
+    it->second = {.raw = raw, .score = score};
+  }
 }
 
-uint XdgDesktopEntry::Parser::computeLocalePriority(Locale lhs, Locale rhs) {
-  if (lhs.lang == rhs.lang) {
-    if (lhs.country == rhs.country) {
-      if (lhs.modifier == rhs.modifier) return 3;
-      return 2;
-    }
-    return 1;
-  }
+const XdgDesktopEntry::Parser::Group *
+XdgDesktopEntry::Parser::find(const std::vector<std::pair<std::string_view, Group>> &groups,
+                              std::string_view name) {
+  auto it = std::ranges::find(groups, name, &std::pair<std::string_view, Group>::first);
 
-  return 0;
+  return it == groups.end() ? nullptr : &it->second;
 }
 
-XdgDesktopEntry XdgDesktopEntry::Parser::parse() {
-  QHash<QStringView, size_t> localePriorities;
+QString XdgDesktopEntry::Parser::value(const Group &group, std::string_view key) {
+  auto it = std::ranges::find(group, key, &std::pair<std::string_view, Value>::first);
 
-  skipWS();
+  return it == group.end() ? QString() : decode(it->second.raw);
+}
 
-  while (cursor < data.size()) {
-    QChar ch = data.at(cursor);
+QList<QString> XdgDesktopEntry::Parser::list(const Group &group, std::string_view key) {
+  QList<QString> list;
+  QString str = value(group, key);
 
-    if (ch == '#') {
-      while (data.at(cursor) != '\n')
-        ++cursor;
-    }
+  for (const auto &part : QStringView(str).split(';', Qt::SkipEmptyParts)) {
+    list.push_back(intern(part));
+  }
 
-    else if (ch == '[') {
-      ++cursor;
-      auto groupName = parseGroupHeader();
-      auto it = groups.insert(groupName, {});
+  return list;
+}
 
-      currentGroup = &*it;
-      localePriorities.clear();
-    }
+XdgDesktopEntry XdgDesktopEntry::Parser::parse() {
+  Group *currentGroup = nullptr;
 
-    else {
-      auto entry = parseEntry();
+  while (cursor < data.size()) {
+    auto line = trimmed(nextLine());
 
-      auto previousScore = localePriorities.find(entry.key);
+    if (line.empty() || line.front() == '#') continue;
 
-      if (!entry.locale && previousScore == localePriorities.end()) {
-        localePriorities.insert(entry.key, 0);
-        currentGroup->insert(entry.key, entry.value);
-      }
+    if (line.front() == '[') {
+      parseGroupHeader(line, currentGroup);
+    } else if (currentGroup) {
+      parseEntry(line, *currentGroup);
+    }
+  }
 
-      if (entry.locale) {
-        size_t score = computeLocalePriority(Locale(rawLocale), *entry.locale);
+  XdgDesktopEntry entry;
+  auto group = find(groups, "Desktop Entry");
+
+  if (!group) throw std::runtime_error("No Desktop Entry group");
+
+  auto &it = *group;
+
+  entry.type = value(it, "Type");
+  entry.version = value(it, "Version");
+  entry.name = value(it, "Name");
+  entry.genericName = value(it, "GenericName");
+  entry.noDisplay = value(it, "NoDisplay") == "true";
+  entry.comment = value(it, "Comment");
+  entry.icon = value(it, "Icon");
+  entry.hidden = value(it, "Hidden") == "true";
+  entry.tryExec = value(it, "TryExec");
+  entry.exec = ExecParser::parse(value(it, "Exec"));
+
+  entry.path = value(it, "Path");
+  entry.terminal = value(it, "Terminal") == "true";
+  auto actions = value(it, "Actions").split(';', Qt::SkipEmptyParts);
+  entry.mimeType = list(it, "MimeType");
+  entry.categories = list(it, "Categories");
+  entry.keywords = value(it, "Keywords").split(';', Qt::SkipEmptyParts);
+  entry.startupWMClass = value(it, "StartupWMClass");
+  entry.singleMainWindow = value(it, "SingleMainWindow") == "true";
+
+  for (const auto &id : actions) {
+    auto actionId = id.toStdString();
+    auto group = find(groups, "Desktop Action " + actionId);
+
+    if (!group) continue;
+
+    XdgDesktopEntry::Action action;
+
+    action.id = id;
+    action.name = value(*group, "Name");
+    action.icon = value(*group, "Icon");
+    action.exec = ExecParser::parse(value(*group, "Exec"));
+    entry.actions.push_back(action);
+  }
 
-        if (previousScore != localePriorities.end() && *previousScore < score) {
-          // qDebug() << "out did local score for " << entry.key << entry.locale->toString() << rawLocale;
-          *previousScore = score;
+  return entry;
+}
 
-          currentGroup->insert(entry.key, entry.value);
-        }
+XdgDesktopEntry::XdgDesktopEntry(const fs::path &parentPath, const fs::path &childPath) {
+  QFile file(parentPath / childPath);
 
-        if (previousScore == localePriorities.end() && score > 0) {
-          localePriorities.insert(entry.key, score);
-          currentGroup->insert(entry.key, entry.value);
-        }
-      }
-    }
+  file.open(QIODevice::ReadOnly);
 
-    skipWS();
-  }
+  // files are parsed in place, empty files can not be mapped and have no entry anyway
+  auto mapped = file.size() > 0 ? file.map(0, file.size()) : nullptr;
+  QByteArray data = mapped ? QByteArray() : file.readAll();
+  std::string_view view = mapped ? std::string_view(reinterpret_cast<const char *>(mapped), file.size())
+                                 : std::string_view(data.constData(), data.size());
 
-  XdgDesktopEntry entry;
+  *this = XdgDesktopEntry::Parser(view).parse();
 
-  auto it = groups.find(QStringLiteral("Desktop Entry"));
-
-  if (it == groups.end()) throw std::runtime_error("No Desktop Entry group");
-
-  entry.type = (*it)[QStringLiteral("Type")];
-  entry.version = (*it)[QStringLiteral("Version")];
-  entry.name = (*it)[QStringLiteral("Name")];
-  entry.genericName = (*it)[QStringLiteral("GenericName")];
-  entry.noDisplay = (*it)[QStringLiteral("NoDisplay")] == "true";
-  entry.comment = (*it)[QStringLiteral("Comment")];
-  entry.icon = (*it)[QStringLiteral("Icon")];
-  entry.hidden = (*it)[QStringLiteral("Hidden")] == "true";
-  entry.tryExec = (*it)[QStringLiteral("TryExec")];
-  entry.exec = ExecParser::parse((*it)[QStringLiteral("Exec")]);
-
-  entry.path = (*it)[QStringLiteral("Path")];
-  entry.terminal = (*it)[QStringLiteral("Terminal")] == "true";
-  auto actions = (*it)[QStringLiteral("Actions")].split(';', Qt::SkipEmptyParts);
-  entry.mimeType = (*it)[QStringLiteral("MimeType")].split(';', Qt::SkipEmptyParts);
-  entry.categories = (*it)[QStringLiteral("Categories")].split(';', Qt::SkipEmptyParts);
-  entry.keywords = (*it)[QStringLiteral("Keywords")].split(';', Qt::SkipEmptyParts);
-  entry.startupWMClass = (*it)[QStringLiteral("StartupWMClass")];
-  entry.singleMainWindow = (*it)[QStringLiteral("SingleMainWindow")] == "true";
-
-  for (const auto &groupName : groups.keys()) {
-    auto parts = groupName.split(' ');
-
-    if (parts.size() == 3 && parts[0] == QStringLiteral("Desktop") && parts[1] == QStringLiteral("Action") &&
-        actions.contains(parts[2])) {
-
-      XdgDesktopEntry::Action action;
-
-      auto group = groups[groupName];
-
-      action.id = parts[2].toString();
-      action.name = group[QStringLiteral("Name")];
-      action.icon = group[QStringLiteral("Icon")];
-      action.exec = ExecParser::parse(group[QStringLiteral("Exec")]);
-      entry.actions.push_back(action);
-    }
+  for (auto dir : childPath.parent_path()) {
+    id += dir.c_str();
+    id += '-';
   }
-
-  return entry;
+  id += childPath.filename().c_str();
 }
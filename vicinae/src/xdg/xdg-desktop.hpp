@@ -12,6 +12,8 @@
 #include <qregularexpression.h>
 #include <qstringliteral.h>
 #include <qstringview.h>
+#include <string_view>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -108,69 +110,47 @@ class XdgDesktopEntry {
     }
   };
 
+  /**
+   * Parses the UTF-8 content of a desktop file in place, usually straight from its memory mapping.
+   *
+   * Keys are kept as slices of the content, localized keys only when they match the locale of the
+   * process, so that the many translations most desktop files carry are skipped without decoding them.
+   * Only the values of the keys that are read end up converted to QString.
+   */
   class Parser {
-    struct Entry {
-      QStringView key;
-      QString value;
-      std::optional<Locale> locale;
+    struct Value {
+      std::string_view raw;
+      uint score;
     };
 
-    QString rawLocale;
-    QStringView data;
-    size_t cursor;
+    // only the groups and keys we read, a desktop file has a few dozens of them at most
+    using Group = std::vector<std::pair<std::string_view, Value>>;
 
-    using Group = QHash<QStringView, QString>;
+    std::string_view data;
+    size_t cursor = 0;
+    std::vector<std::pair<std::string_view, Group>> groups;
 
-    Group top;
-    QHash<QStringView, Group> groups;
-    Group *currentGroup = &top;
+    std::string_view nextLine();
+    void parseGroupHeader(std::string_view line, Group *&currentGroup);
+    void parseEntry(std::string_view line, Group &group);
 
-    QStringView parseGroupHeader();
-    QStringView parseEntryKey();
-    QChar parseEscaped();
-    QString parseEntryValue();
-    Entry parseEntry();
-
-    void skipWS();
-    uint computeLocalePriority(Locale lhs, Locale rhs);
+    static uint computeLocalePriority(std::string_view locale);
+    static QString decode(std::string_view raw);
+    static QString value(const Group &group, std::string_view key);
+    static QList<QString> list(const Group &group, std::string_view key);
+    static const Group *find(const std::vector<std::pair<std::string_view, Group>> &groups,
+                             std::string_view name);
 
   public:
     XdgDesktopEntry parse();
 
-    Parser(QStringView view) noexcept;
-
-    void dump() {
-      dumpGroup(top);
-      for (const auto &entry : groups) {
-        dumpGroup(entry);
-      }
-    }
-
-    void dumpGroup(const Group &grp) {
-      for (const auto &entry : grp.keys()) {
-        qDebug() << entry << "=" << grp[entry];
-      }
-    }
+    Parser(std::string_view data) noexcept : data(data) {}
   };
 
   XdgDesktopEntry() {}
 
 public:
-  XdgDesktopEntry(const fs::path &parentPath, const fs::path &childPath) {
-    QFile file(parentPath / childPath);
-
-    file.open(QIODevice::ReadOnly);
-
-    QString data = file.readAll();
-
-    *this = XdgDesktopEntry::Parser(data).parse();
-
-    for (auto dir: childPath.parent_path()) {
-      id += dir.c_str();
-      id += '-';
-    }
-    id += childPath.filename().c_str();
-  }
+  XdgDesktopEntry(const fs::path &parentPath, const fs::path &childPath);
 
   struct Action {
     QString id;
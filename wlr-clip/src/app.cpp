@@ -1,6 +1,10 @@
 #include "app.hpp"
+#include "offer-selection.hpp"
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <sys/socket.h>
+#include <sys/stat.h>
 #include "proto/wlr-clipboard.pb.h"
 
 void Clipman::global(WaylandRegistry &reg, uint32_t name, const char *interface, uint32_t version) {
@@ -15,12 +19,152 @@ void Clipman::global(WaylandRegistry &reg, uint32_t name, const char *interface,
   }
 }
 
+static DataOffer::Request fullRequest(const std::string &mime) {
+  return {.mime = mime,
+          .maxSize = OfferSelection::MAX_OFFER_SIZE,
+          .truncate = OfferSelection::isTruncatable(mime)};
+}
+
+static const char *statusName(DataOffer::Status status) {
+  switch (status) {
+  case DataOffer::Status::Complete:
+    return "complete";
+  case DataOffer::Status::Truncated:
+    return "truncated";
+  case DataOffer::Status::TooLarge:
+    return "too large";
+  case DataOffer::Status::TimedOut:
+    return "timed out";
+  case DataOffer::Status::Aborted:
+    return "aborted";
+  case DataOffer::Status::Failed:
+    return "failed";
+  }
+
+  return "unknown";
+}
+
+/**
+ * Fill `selection` with the offers of `received` that have data, the ones that do not are listed as
+ * skipped.
+ */
+static void describeSelection(proto::ext::wlrclip::Selection &selection,
+                              const std::vector<DataOffer::Received> &received) {
+  for (const auto &result : received) {
+    if (result.fd != -1) {
+      auto offer = selection.add_offers();
+
+      offer->set_mime_type(result.mime);
+      offer->set_truncated(result.status == DataOffer::Status::Truncated);
+      continue;
+    }
+
+    auto skipped = selection.add_skipped();
+
+    skipped->set_mime_type(result.mime);
+
+    switch (result.status) {
+    case DataOffer::Status::TooLarge:
+      skipped->set_reason(proto::ext::wlrclip::TooLarge);
+      break;
+    case DataOffer::Status::TimedOut:
+      skipped->set_reason(proto::ext::wlrclip::TimedOut);
+      break;
+    default:
+      skipped->set_reason(proto::ext::wlrclip::Failed);
+      break;
+    }
+  }
+}
+
+static bool readAll(int fd, std::string &data) {
+  size_t offset = 0;
+
+  while (offset < data.size()) {
+    ssize_t rc = pread(fd, data.data() + offset, data.size() - offset, offset);
+
+    if (rc == -1 && errno == EINTR) continue;
+    if (rc <= 0) return false;
+
+    offset += rc;
+  }
+
+  return true;
+}
+
+/**
+ * Whether reading `received` was aborted for a newer selection, in which case it is closed.
+ */
+static bool discardAborted(std::vector<DataOffer::Received> &received) {
+  bool aborted = std::ranges::any_of(received, [](const DataOffer::Received &result) {
+    return result.status == DataOffer::Status::Aborted;
+  });
+
+  if (!aborted) return false;
+
+  for (auto &result : received) {
+    if (result.fd != -1) close(result.fd);
+    result.fd = -1;
+  }
+
+  return true;
+}
+
 void Clipman::selection(DataDevice &device, DataOffer &offer) {
+  // read once it settles, from the main loop (see `start`)
+  if (m_pendingSelection) {
+    ++m_coalescedSelections;
+  } else {
+    m_pendingSince = DataOffer::Clock::now();
+  }
+
+  m_pendingSelection = device.offer();
+}
+
+std::optional<DataOffer::Interrupt> Clipman::interrupt() {
+  if (m_coalesceWindow.count() == 0) return std::nullopt;
+
+  return DataOffer::Interrupt{.fd = fd(), .interrupted = [this]() {
+                                if (WaylandDisplay::dispatch(0) == -1) { exit(1); }
+                                return m_pendingSelection != nullptr;
+                              }};
+}
+
+void Clipman::setCounters(proto::ext::wlrclip::Selection &selection) const {
+  selection.set_coalesced_selections(m_coalescedSelections);
+  selection.set_dropped_selections(m_droppedSelections);
+}
+
+void Clipman::processSelection() {
+  auto offer = std::move(m_pendingSelection);
+
+  if (m_socket) {
+    sendSelection(*offer);
+  } else {
+    writeSelection(*offer);
+  }
+}
+
+void Clipman::writeSelection(DataOffer &offer) {
+  std::vector<DataOffer::Request> requests;
+
+  for (const auto &mime : offer.mimes()) {
+    requests.emplace_back(fullRequest(mime));
+  }
+
+  auto received = offer.receive(requests, DataOffer::Clock::now() + SELECTION_TIMEOUT, interrupt());
+
+  if (discardAborted(received)) {
+    ++m_droppedSelections;
+    return;
+  }
+
   if (isatty(STDOUT_FILENO)) {
     std::cout << "********** " << "BEGIN SELECTION" << "**********" << std::endl;
-    for (const auto &mime : offer.mimes()) {
-      auto path = offer.receive(mime);
-      std::cout << std::left << std::setw(30) << mime << path << std::endl;
+    for (const auto &result : received) {
+      std::cout << std::left << std::setw(30) << result.mime << result.size << " bytes ("
+                << statusName(result.status) << ")" << std::endl;
+      if (result.fd != -1) close(result.fd);
     }
     std::cout << "********** " << "END SELECTION" << "**********" << std::endl;
 
@@ -29,11 +173,20 @@ void Clipman::selection(DataDevice &device, DataOffer &offer) {
 
   proto::ext::wlrclip::Selection selection;
 
-  for (const auto &mime : offer.mimes()) {
-    auto dataOffer = selection.add_offers();
+  describeSelection(selection, received);
+  setCounters(selection);
+
+  int index = 0;
+
+  for (const auto &result : received) {
+    if (result.fd == -1) continue;
 
-    dataOffer->set_data(offer.receive(mime));
-    dataOffer->set_mime_type(mime);
+    // the data is written once, straight to where it is serialized from
+    auto data = selection.mutable_offers(index++)->mutable_data();
+
+    data->resize(result.size);
+    if (!readAll(result.fd, *data)) perror("failed to read offer data");
+    close(result.fd);
   }
 
   std::string data;
@@ -47,6 +200,137 @@ void Clipman::selection(DataDevice &device, DataOffer &offer) {
   std::cout.flush();
 }
 
+std::vector<DataOffer::Received> Clipman::receiveSelection(DataOffer &offer) {
+  auto deadline = DataOffer::Clock::now() + SELECTION_TIMEOUT;
+  std::vector<DataOffer::Request> requests;
+
+  if (m_sendAllOffers) {
+    for (const auto &mime : offer.mimes()) {
+      requests.emplace_back(fullRequest(mime));
+    }
+
+    return offer.receive(requests, deadline, interrupt());
+  }
+
+  std::vector<DataOffer::Received> received;
+  std::vector<std::string> fetched;
+  bool hasPrimary = false;
+
+  for (const auto &mime : OfferSelection::primaryCandidates(offer.mimes())) {
+    auto request = fullRequest(mime);
+    auto result = std::move(offer.receive({&request, 1}, deadline, interrupt()).front());
+    bool aborted = result.status == DataOffer::Status::Aborted;
+
+    // keep looking if there is no data, the next candidate may have some
+    hasPrimary = result.fd != -1 && result.size > 0;
+    fetched.emplace_back(mime);
+    received.emplace_back(std::move(result));
+
+    if (hasPrimary || aborted) break;
+  }
+
+  if (!hasPrimary) return received;
+
+  for (const auto &mime : offer.mimes()) {
+    if (!OfferSelection::isWorthFetching(mime, fetched)) continue;
+
+    // conversions of an offer that was too large are not going to be smaller
+    fetched.emplace_back(mime);
+    requests.push_back({.mime = mime, .maxSize = OfferSelection::MAX_EXTRA_OFFER_SIZE});
+  }
+
+  size_t extraBudget = OfferSelection::MAX_EXTRA_OFFERS_SIZE;
+
+  // the budget goes to the offers the source lists first, which it prefers
+  for (auto &result : offer.receive(requests, deadline, interrupt())) {
+    if (result.fd != -1 && result.size > extraBudget) {
+      close(result.fd);
+      result.fd = -1;
+      result.status = DataOffer::Status::TooLarge;
+    }
+
+    if (result.fd != -1) extraBudget -= result.size;
+    received.emplace_back(std::move(result));
+  }
+
+  return received;
+}
+
+void Clipman::sendSelection(DataOffer &offer) {
+  proto::ext::wlrclip::Selection selection;
+  std::vector<int> fds;
+  auto received = receiveSelection(offer);
+  size_t shared = 0;
+
+  if (discardAborted(received)) {
+    ++m_droppedSelections;
+    return;
+  }
+
+  for (auto &result : received) {
+    if (result.fd == -1 || ++shared <= MAX_SHARED_OFFERS) continue;
+
+    close(result.fd);
+    result.fd = -1;
+  }
+
+  if (shared > MAX_SHARED_OFFERS) {
+    std::cerr << "[Warning] Selection has more than " << MAX_SHARED_OFFERS
+              << " offers, ignoring the remaining ones" << std::endl;
+  }
+
+  // keep the order of the source, which is also a preference order
+  std::ranges::stable_sort(received, {}, [&](const DataOffer::Received &result) {
+    return std::ranges::find(offer.mimes(), result.mime) - offer.mimes().begin();
+  });
+
+  // the data of every offer is in the file descriptor at the same position
+  describeSelection(selection, received);
+  setCounters(selection);
+
+  for (const auto &result : received) {
+    if (result.fd != -1) fds.emplace_back(result.fd);
+  }
+
+  std::string data;
+
+  selection.SerializeToString(&data);
+
+  std::vector<char> control(CMSG_SPACE(sizeof(int) * fds.size()));
+  iovec iov{.iov_base = data.data(), .iov_len = data.size()};
+  msghdr msg{};
+
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+
+  if (!fds.empty()) {
+    msg.msg_control = control.data();
+    msg.msg_controllen = control.size();
+
+    cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int) * fds.size());
+    memcpy(CMSG_DATA(cmsg), fds.data(), sizeof(int) * fds.size());
+  }
+
+  ssize_t rc = 0;
+
+  while ((rc = sendmsg(*m_socket, &msg, MSG_NOSIGNAL)) == -1 && errno == EINTR) {}
+
+  // the receiving process holds its own references to the files once sent
+  for (int fd : fds) {
+    close(fd);
+  }
+
+  if (rc == -1) {
+    perror("failed to send selection");
+    // the receiving end is gone, nobody is left to send selections to
+    if (errno == EPIPE || errno == ECONNRESET) { exit(1); }
+  }
+}
+
 void Clipman::start() {
   roundtrip();
 
@@ -58,7 +342,20 @@ void Clipman::start() {
 
   for (;;) {
     try {
-      if (dispatch() == -1) { exit(1); }
+      int timeout = -1;
+
+      if (m_pendingSelection) {
+        auto settlesIn = m_pendingSince + m_coalesceWindow - DataOffer::Clock::now();
+
+        timeout = std::max<int>(0, std::chrono::ceil<std::chrono::milliseconds>(settlesIn).count());
+      }
+
+      if (timeout == 0) {
+        processSelection();
+        continue;
+      }
+
+      if (WaylandDisplay::dispatch(timeout) == -1) { exit(1); }
     } catch (const std::exception &e) { std::cerr << "Uncaught exception: " << e.what() << std::endl; }
   }
 }
@@ -1,10 +1,12 @@
 #pragma once
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <netinet/in.h>
 #include <memory>
+#include <optional>
 #include <sys/syscall.h>
 #include <unistd.h>
 #include <wayland-client-core.h>
@@ -12,19 +14,64 @@
 #include <wayland-util.h>
 #include "data-control-client.hpp"
 #include "display.hpp"
+#include "proto/wlr-clipboard.pb.h"
 
 class Clipman : public WaylandDisplay, public WaylandRegistry::Listener, public DataDevice::Listener {
 
 public:
   static Clipman *instance();
   void start();
+
+  /**
+   * Send selections over the unix socket `fd` instead of writing them to stdout. The data of every offer
+   * is passed as a sealed memfd: no copy of it is made, in this process or in the receiving one.
+   */
+  void setSocket(int fd) { m_socket = fd; }
+
+  /**
+   * Send every offer of selections over the socket, instead of only the ones worth keeping
+   * (see `OfferSelection`).
+   */
+  void setSendAllOffers(bool value) { m_sendAllOffers = value; }
+
+  /**
+   * Only read the latest of the selections set within `window` of each other, for bursts of them to be
+   * read once: selections replaced within the window are never read (coalesced), and reading one is
+   * aborted if another one comes in meanwhile (dropped). 0, the default, reads every selection.
+   */
+  void setCoalesceWindow(std::chrono::milliseconds window) { m_coalesceWindow = window; }
+
   Clipman();
 
 private:
+  // maximum number of file descriptors that can be passed in a single message (SCM_MAX_FD)
+  static constexpr size_t MAX_SHARED_OFFERS = 253;
+  // sources still writing their offers by then are given up on
+  static constexpr auto SELECTION_TIMEOUT = std::chrono::seconds(5);
+
+  std::optional<int> m_socket;
+  bool m_sendAllOffers = false;
+  std::chrono::milliseconds m_coalesceWindow{0};
+  // latest selection, not read yet, and since when there is one
+  std::shared_ptr<DataOffer> m_pendingSelection;
+  DataOffer::Clock::time_point m_pendingSince;
+  // since the start, sent along with selections
+  uint64_t m_coalescedSelections = 0;
+  uint64_t m_droppedSelections = 0;
   std::unique_ptr<WaylandRegistry> _registry;
   std::unique_ptr<DataControlManager> _dcm;
   std::unique_ptr<WaylandSeat> _seat;
 
   void global(WaylandRegistry &reg, uint32_t name, const char *interface, uint32_t version) override;
   void selection(DataDevice &device, DataOffer &offer) override;
+  void processSelection();
+  void writeSelection(DataOffer &offer);
+  void sendSelection(DataOffer &offer);
+  void setCounters(proto::ext::wlrclip::Selection &selection) const;
+
+  /**
+   * Interrupts reading a selection when a newer one comes in, if selections are coalesced.
+   */
+  std::optional<DataOffer::Interrupt> interrupt();
+  std::vector<DataOffer::Received> receiveSelection(DataOffer &offer);
 };
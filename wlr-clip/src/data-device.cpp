@@ -26,7 +26,7 @@ void DataDevice::selection(void *data, zwlr_data_control_device_v1 *device, zwlr
                  "pending offer's";
   }
 
-  // will destroy the previous offer (as requested by the protocol)
+  // will destroy the previous offer (as requested by the protocol), once no longer being read
   self->m_offer = std::move(self->m_pendingOffer);
 
   for (auto lstn : self->_listeners) {
@@ -16,7 +16,7 @@ private:
   zwlr_data_control_device_v1 *_dev;
   std::vector<Listener *> _listeners;
   std::unique_ptr<DataOffer> m_pendingOffer;
-  std::unique_ptr<DataOffer> m_offer;
+  std::shared_ptr<DataOffer> m_offer;
 
   static void dataOffer(void *data, zwlr_data_control_device_v1 *device, zwlr_data_control_offer_v1 *id);
   static void selection(void *data, zwlr_data_control_device_v1 *device, zwlr_data_control_offer_v1 *id);
@@ -33,6 +33,11 @@ private:
 public:
   void registerListener(Listener *listener) { _listeners.push_back(listener); }
 
+  /**
+   * The current selection. It is destroyed when it is replaced, unless it is still referenced.
+   */
+  std::shared_ptr<DataOffer> offer() const { return m_offer; }
+
   DataDevice(zwlr_data_control_device_v1 *dev);
   ~DataDevice();
 };
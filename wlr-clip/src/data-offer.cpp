@@ -1,6 +1,9 @@
 #include "data-offer.hpp"
 #include "app.hpp"
 #include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
 
 DataOffer::DataOffer(zwlr_data_control_offer_v1 *offer) : _offer(offer) {
   zwlr_data_control_offer_v1_add_listener(offer, &_listener, this);
@@ -14,28 +17,194 @@ void DataOffer::offer(void *data, zwlr_data_control_offer_v1 *offer, const char
   self->_mimes.push_back(mime);
 }
 
-std::string DataOffer::DataOffer::receive(const std::string &mime) {
-  std::string data;
-  int pipefd[2];
+static bool writeAll(int fd, const char *data, size_t size) {
+  while (size > 0) {
+    ssize_t rc = write(fd, data, size);
 
-  if (pipe(pipefd) == -1) { throw std::runtime_error(std::string("Failed to pipe(): ") + strerror(errno)); }
+    if (rc == -1) {
+      if (errno == EINTR) continue;
+      return false;
+    }
 
-  zwlr_data_control_offer_v1_receive(_offer, mime.c_str(), pipefd[1]);
-  // Important, otherwise we will block on read forever
-  Clipman::instance()->flush();
-  close(pipefd[1]);
+    data += rc;
+    size -= rc;
+  }
+
+  return true;
+}
+
+// not every kernel supports splicing into a memfd, nothing is consumed in that case
+static bool s_canSplice = true;
+
+std::vector<DataOffer::Received> DataOffer::receive(std::span<const Request> requests,
+                                                    Clock::time_point deadline,
+                                                    const std::optional<Interrupt> &interrupt) {
+  std::vector<Received> results(requests.size());
+  // read end of the pipe of every request, -1 once it is done
+  std::vector<int> pipes(requests.size(), -1);
+  std::vector<int> writeEnds;
+
+  auto finish = [&](size_t index, Status status) {
+    auto &result = results[index];
+
+    close(pipes[index]);
+    pipes[index] = -1;
+
+    if (status == Status::Truncated) {
+      result.size = requests[index].maxSize;
+
+      if (ftruncate(result.fd, result.size) == -1) {
+        perror("failed to truncate offer data");
+        status = Status::Failed;
+      }
+    }
+
+    bool hasData = status == Status::Complete || status == Status::Truncated;
+
+    if (hasData &&
+        fcntl(result.fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) == -1) {
+      perror("failed to seal offer data");
+      hasData = false;
+      status = Status::Failed;
+    }
+
+    if (!hasData) {
+      close(result.fd);
+      result.fd = -1;
+    }
+
+    result.status = status;
+  };
+
+  // moves what the source wrote so far, until it is done or has nothing more for now
+  auto transfer = [&](size_t index) {
+    auto &result = results[index];
+    const auto &request = requests[index];
+    // one byte past the limit is enough to know it is exceeded
+    auto chunkSize = [&](size_t max) {
+      return request.maxSize - result.size < max ? request.maxSize - result.size + 1 : max;
+    };
+
+    while (true) {
+      ssize_t rc = 0;
+
+      if (s_canSplice) {
+        rc = splice(pipes[index], nullptr, result.fd, nullptr, chunkSize(1 << 20),
+                    SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+        if (rc == -1 && errno == EINVAL) {
+          s_canSplice = false;
+          continue;
+        }
+      } else if ((rc = read(pipes[index], _buf, chunkSize(sizeof(_buf)))) > 0 &&
+                 !writeAll(result.fd, _buf, rc)) {
+        perror("failed to write offer data");
+        return finish(index, Status::Failed);
+      }
+
+      if (rc > 0) {
+        result.size += rc;
+
+        if (result.size > request.maxSize) {
+          return finish(index, request.truncate ? Status::Truncated : Status::TooLarge);
+        }
+
+        continue;
+      }
+
+      if (rc == 0) return finish(index, Status::Complete);
+      if (errno == EINTR) continue;
+      if (errno == EAGAIN) return;
 
-  int rc = 0;
+      perror("failed to receive offer data");
+      return finish(index, Status::Failed);
+    }
+  };
 
-  while ((rc = read(pipefd[0], _buf, sizeof(_buf))) > 0) {
-    data += std::string_view(_buf, rc);
+  for (size_t i = 0; i != requests.size(); ++i) {
+    auto &result = results[i];
+    int pipefd[2];
+
+    result.mime = requests[i].mime;
+
+    if (pipe2(pipefd, O_CLOEXEC) == -1) {
+      perror("failed to pipe()");
+      continue;
+    }
+
+    result.fd = memfd_create("wlr-clip-offer", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+
+    // only our end is non blocking, sources are not all prepared to get EAGAIN
+    if (result.fd == -1 || fcntl(pipefd[0], F_SETFL, O_NONBLOCK) == -1) {
+      perror("failed to set up offer transfer");
+      if (result.fd != -1) close(result.fd);
+      result.fd = -1;
+      close(pipefd[0]);
+      close(pipefd[1]);
+      continue;
+    }
+
+    zwlr_data_control_offer_v1_receive(_offer, result.mime.c_str(), pipefd[1]);
+    pipes[i] = pipefd[0];
+    writeEnds.push_back(pipefd[1]);
   }
 
-  if (rc == -1) { perror("failed to read read end of the pipe"); }
+  // Important, otherwise we will wait on sources that were never asked to write
+  Clipman::instance()->flush();
+
+  for (int fd : writeEnds) {
+    close(fd);
+  }
+
+  std::vector<pollfd> polled;
+  std::vector<size_t> indices;
+  Status unfinished = Status::Failed;
+
+  while (true) {
+    polled.clear();
+    indices.clear();
+
+    for (size_t i = 0; i != pipes.size(); ++i) {
+      if (pipes[i] == -1) continue;
 
-  close(pipefd[0]);
+      polled.push_back({.fd = pipes[i], .events = POLLIN, .revents = 0});
+      indices.push_back(i);
+    }
+
+    if (polled.empty()) break;
+    if (interrupt) polled.push_back({.fd = interrupt->fd, .events = POLLIN, .revents = 0});
+
+    auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - Clock::now());
+
+    if (remaining.count() <= 0) {
+      unfinished = Status::TimedOut;
+      break;
+    }
+
+    int rc = poll(polled.data(), polled.size(), remaining.count());
+
+    if (rc == -1) {
+      if (errno == EINTR) continue;
+      perror("failed to poll offers");
+      break;
+    }
+
+    for (size_t i = 0; i != indices.size(); ++i) {
+      if (polled[i].revents) transfer(indices[i]);
+    }
+
+    if (interrupt && polled.back().revents && interrupt->interrupted()) {
+      unfinished = Status::Aborted;
+      break;
+    }
+  }
+
+  // the sources get EPIPE if they were not done writing, which is what we want
+  for (size_t i = 0; i != pipes.size(); ++i) {
+    if (pipes[i] != -1) finish(i, unfinished);
+  }
 
-  return data;
+  return results;
 }
 
 DataOffer::~DataOffer() {
@@ -1,8 +1,13 @@
 #pragma once
 #include "display.hpp"
 #include "wlr-data-control-unstable-v1-client-protocol.h"
-#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
 #include <string>
+#include <vector>
 
 class DataOffer {
   zwlr_data_control_offer_v1 *_offer;
@@ -10,18 +15,50 @@ class DataOffer {
   char _buf[1 << 16];
 
 public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Request {
+    std::string mime;
+    size_t maxSize = SIZE_MAX;
+    // keep the first `maxSize` bytes of larger data instead of dropping it
+    bool truncate = false;
+  };
+
+  enum class Status { Complete, Truncated, TooLarge, TimedOut, Aborted, Failed };
+
+  /**
+   * What can abort receiving: `fd` is polled along with the offers, and receiving is aborted if
+   * `interrupted` returns true once it is readable.
+   */
+  struct Interrupt {
+    int fd;
+    std::function<bool()> interrupted;
+  };
+
+  struct Received {
+    std::string mime;
+    // sealed memfd holding the data if it is complete or truncated, -1 otherwise. Owned by the caller.
+    int fd = -1;
+    size_t size = 0;
+    Status status = Status::Failed;
+  };
+
   static void offer(void *data, zwlr_data_control_offer_v1 *offer, const char *mime);
 
   constexpr static struct zwlr_data_control_offer_v1_listener _listener = {.offer = offer};
 
   /**
-   * Receives the data associated with the specified mime type.
-   * The passing of the display is required to properly dispatch the receive request.
-   * Instead of the raw data itself, a path to a temporary file is returned.
-   * The caller is responsible for the cleaning of this file after they are done
-   * processing it.
+   * Receives the data of every request into a sealed memfd, without it going through user space when the
+   * kernel allows it. The files can no longer be modified or resized once returned, so receivers can
+   * safely map them.
+   *
+   * All the requests are received at once, so that a source slow to write one of its types does not hold
+   * back the others. Whatever is not received by `deadline` is dropped as timed out, or as aborted if
+   * `interrupt` says so first.
+   * Results are in the order of the requests.
    */
-  std::string receive(const std::string &mime);
+  std::vector<Received> receive(std::span<const Request> requests, Clock::time_point deadline,
+                                const std::optional<Interrupt> &interrupt = std::nullopt);
   const std::vector<std::string> &mimes() const;
   zwlr_data_control_offer_v1 *pointer() const { return _offer; }
 
@@ -1,4 +1,6 @@
 #include "display.hpp"
+#include <cerrno>
+#include <poll.h>
 
 WaylandDisplay::WaylandDisplay() { _display = wl_display_connect(nullptr); }
 WaylandDisplay::~WaylandDisplay() {
@@ -9,6 +11,28 @@ std::unique_ptr<WaylandRegistry> WaylandDisplay::registry() const {
   return std::make_unique<WaylandRegistry>(wl_display_get_registry(_display));
 }
 int WaylandDisplay::dispatch() const { return wl_display_dispatch(_display); };
+
+int WaylandDisplay::dispatch(int timeout) const {
+  // events already read have to be dispatched before reading new ones
+  while (wl_display_prepare_read(_display) != 0) {
+    if (wl_display_dispatch_pending(_display) == -1) return -1;
+  }
+
+  wl_display_flush(_display);
+
+  pollfd pfd{.fd = fd(), .events = POLLIN, .revents = 0};
+  int rc = poll(&pfd, 1, timeout);
+
+  if (rc <= 0) {
+    wl_display_cancel_read(_display);
+    return rc == -1 && errno != EINTR ? -1 : 0;
+  }
+
+  if (wl_display_read_events(_display) == -1) return -1;
+
+  return wl_display_dispatch_pending(_display);
+}
 wl_display *WaylandDisplay::display() const { return _display; }
+int WaylandDisplay::fd() const { return wl_display_get_fd(_display); }
 int WaylandDisplay::roundtrip() const { return wl_display_roundtrip(_display); };
 int WaylandDisplay::flush() const { return wl_display_flush(_display); }
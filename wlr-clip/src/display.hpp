@@ -13,7 +13,14 @@ public:
 
   std::unique_ptr<WaylandRegistry> registry() const;
   int dispatch() const;
+
+  /**
+   * Dispatch the events received within `timeout` milliseconds, -1 waiting for as long as it takes.
+   * Returns the number of events dispatched, or -1 if the connection failed.
+   */
+  int dispatch(int timeout) const;
   int roundtrip() const;
   wl_display *display() const;
+  int fd() const;
   int flush() const;
 };
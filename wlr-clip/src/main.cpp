@@ -13,6 +13,14 @@
 #include <wayland-util.h>
 
 int main(int ac, char **av) {
+  for (int i = 1; i < ac; ++i) {
+    if (strcmp(av[i], "--socket-fd") == 0 && i + 1 < ac) { Clipman::instance()->setSocket(atoi(av[++i])); }
+    if (strcmp(av[i], "--all-offers") == 0) { Clipman::instance()->setSendAllOffers(true); }
+    if (strcmp(av[i], "--coalesce-ms") == 0 && i + 1 < ac) {
+      Clipman::instance()->setCoalesceWindow(std::chrono::milliseconds(atoi(av[++i])));
+    }
+  }
+
   if (isatty(STDIN_FILENO)) {
     std::cerr << av[0]
               << " started directly from TTY. Start interacting with the clipboard and "
@@ -0,0 +1,50 @@
+#include "offer-selection.hpp"
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+static constexpr std::array<std::string_view, 6> PLAIN_TEXT_MIME_TYPES = {
+    "text/plain", "text/plain;charset=utf-8", "UTF8_STRING", "STRING", "TEXT", "COMPOUND_TEXT"};
+
+// types only meaningful to the application that offers them
+static constexpr std::array<std::string_view, 5> PRIVATE_MIME_TYPE_PREFIXES = {
+    "chromium/", "text/_moz_", "application/x-moz-", "text/x-moz-url-priv", "application/x-qt-"};
+
+static bool isPlainText(std::string_view mime) { return std::ranges::contains(PLAIN_TEXT_MIME_TYPES, mime); }
+
+static bool isImage(std::string_view mime) { return mime.starts_with("image/"); }
+
+std::vector<std::string> OfferSelection::primaryCandidates(const std::vector<std::string> &mimes) {
+  std::vector<std::string> candidates;
+  auto append = [&](auto &&pred) {
+    for (const auto &mime : mimes) {
+      if (pred(mime) && !std::ranges::contains(candidates, mime)) { candidates.emplace_back(mime); }
+    }
+  };
+
+  for (const auto &text : PLAIN_TEXT_MIME_TYPES) {
+    append([&](const std::string &mime) { return mime == text; });
+  }
+
+  append([](const std::string &mime) { return isImage(mime); });
+  append([](const std::string &mime) { return mime == "text/html"; });
+  append([](const std::string &mime) { return !mime.starts_with("text/_moz_html"); });
+
+  return candidates;
+}
+
+bool OfferSelection::isWorthFetching(const std::string &mime, const std::vector<std::string> &fetched) {
+  bool isRedundant = std::ranges::any_of(fetched, [&](const std::string &other) {
+    // aliases of the same text, or conversions of the same image
+    return other == mime || (isPlainText(mime) && isPlainText(other)) || (isImage(mime) && isImage(other));
+  });
+
+  if (isRedundant) return false;
+
+  return std::ranges::none_of(PRIVATE_MIME_TYPE_PREFIXES,
+                              [&](std::string_view prefix) { return mime.starts_with(prefix); });
+}
+
+bool OfferSelection::isTruncatable(const std::string &mime) {
+  return isPlainText(mime) || mime.starts_with("text/");
+}
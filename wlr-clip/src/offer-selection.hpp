@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Decides which offers of a selection are worth fetching.
+ *
+ * Sources commonly advertise a lot of representations of the same content: browsers offer several plain
+ * text aliases along with their own private types, image editors offer the same image converted to every
+ * format they support. Fetching all of them on every copy makes the source convert and write each one.
+ *
+ * Only the primary offer, the one the clipboard history displays, is always fetched in full. Other offers
+ * are fetched if they are not an alias or a conversion of an offer already fetched, are not known to be
+ * private to their application, and fit into a small size budget.
+ */
+namespace OfferSelection {
+
+// offers larger than this are truncated if they are text, dropped otherwise
+constexpr size_t MAX_OFFER_SIZE = 256 << 20;
+
+// offers other than the primary one larger than this are dropped
+constexpr size_t MAX_EXTRA_OFFER_SIZE = 1 << 20;
+// and all of them together
+constexpr size_t MAX_EXTRA_OFFERS_SIZE = 4 << 20;
+
+/**
+ * Mime types of `mimes` that can be the primary offer, from the most to the least preferred. The first one
+ * of them with data is the primary offer.
+ * This must match the preferred mime type selection of the clipboard service.
+ */
+std::vector<std::string> primaryCandidates(const std::vector<std::string> &mimes);
+
+/**
+ * Whether the offer of type `mime` is worth fetching in addition to the already fetched `fetched` ones.
+ */
+bool isWorthFetching(const std::string &mime, const std::vector<std::string> &fetched);
+
+/**
+ * Whether the beginning of an offer of type `mime` is still meaningful on its own.
+ */
+bool isTruncatable(const std::string &mime);
+
+} // namespace OfferSelection